@@ -31,11 +31,68 @@
 //
 #import <Foundation/Foundation.h>
 
+// This header is altered from Nick's original version: the codec is rewritten to work on raw buffers, a piece at a
+// time if need be, and to have a URL-safe alphabet.
+
+/*
+ * The URL-safe alphabet has '-' and '_' in place of '+' and '/', and is written without '=' padding. Decoding takes
+ * either alphabet, padded or not, and skips any other characters, such as line breaks.
+ */
+typedef enum
+{
+    JRBase64Standard,
+    JRBase64URLSafe,
+} JRBase64Alphabet;
+
+/* The most characters encoding length bytes makes, and the most bytes decoding length characters makes */
+#define JRBase64EncodedLengthForLength(length) (((length) + 2) / 3 * 4)
+#define JRBase64DecodedLengthForLength(length) (((length) + 3) / 4 * 3)
+
+typedef struct
+{
+    JRBase64Alphabet alphabet;
+    uint8_t pending[2];
+    size_t pendingLength;
+} JRBase64Encoder;
+
+typedef struct
+{
+    uint32_t accumulated;
+    size_t accumulatedLength;
+} JRBase64Decoder;
+
+void JRBase64EncoderInit(JRBase64Encoder *encoder, JRBase64Alphabet alphabet);
+
+/* Writes the characters for all but the last one or two bytes that don't fill a group of three, and returns how many
+ * it wrote; output needs room for JRBase64EncodedLengthForLength(length + 2) */
+size_t JRBase64EncoderUpdate(JRBase64Encoder *encoder, const void *bytes, size_t length, char *output);
+
+/* Writes the characters for the bytes held back by the updates, at most four */
+size_t JRBase64EncoderFinal(JRBase64Encoder *encoder, char *output);
+
+/* All of the above at once; output needs room for JRBase64EncodedLengthForLength(length) */
+size_t JRBase64Encode(const void *bytes, size_t length, JRBase64Alphabet alphabet, char *output);
+
+void JRBase64DecoderInit(JRBase64Decoder *decoder);
+
+/* Writes the bytes for each whole group of four characters and returns how many it wrote; output needs room for
+ * JRBase64DecodedLengthForLength(length + 3) */
+size_t JRBase64DecoderUpdate(JRBase64Decoder *decoder, const char *characters, size_t length, uint8_t *output);
+
+/* Writes the bytes for the characters of an unfinished group, at most two */
+size_t JRBase64DecoderFinal(JRBase64Decoder *decoder, uint8_t *output);
+
+/* All of the above at once; output needs room for JRBase64DecodedLengthForLength(length) */
+size_t JRBase64Decode(const char *characters, size_t length, uint8_t *output);
+
 @interface NSData (JRBase64)
 
 + (NSData *)dataWithJRBase64EncodedString:(NSString *)string;
++ (NSData *)dataWithJRBase64EncodedData:(NSData *)data;
 - (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth;
 - (NSString *)JRBase64EncodedString;
+- (NSString *)JRBase64URLEncodedString;
+- (NSData *)JRBase64EncodedData;
 
 @end
 
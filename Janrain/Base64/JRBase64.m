@@ -34,127 +34,279 @@
 
 #import "JRBase64.h"
 
-@implementation NSData (JRBase64)
+static const char JRBase64Alphabets[2][65] =
+{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+};
 
-+ (NSData *)dataWithJRBase64EncodedString:(NSString *)string
+#define JR_BASE64_INVALID 0x01000000
+
+/*
+ * Encoding looks up two characters at a time, for each twelve bits; decoding looks up a whole group of four
+ * characters at a time, each through its own table with its sextet already shifted into place, so that the group's
+ * three bytes are the OR of four lookups, and any character outside both alphabets sets JR_BASE64_INVALID
+ */
+typedef struct
 {
-    const unsigned char lookup[] =
-    {
-        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 
-        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 
-        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 62, 99, 99, 99, 63, 
-        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 99, 99, 99, 99, 99, 99, 
-        99,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 
-        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 99, 99, 99, 99, 99, 
-        99, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 
-        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 99, 99, 99, 99, 99
-    };
-    
-    NSData *inputData = [string dataUsingEncoding:NSASCIIStringEncoding allowLossyConversion:YES];
-    NSUInteger inputLength = [inputData length];
-    const unsigned char *inputBytes = [inputData bytes];
-    
-    NSUInteger maxOutputLength = (inputLength / 4 + 1) * 3;
-    NSMutableData *outputData = [NSMutableData dataWithLength:maxOutputLength];
-    unsigned char *outputBytes = (unsigned char *)[outputData mutableBytes];
-
-    int accumulator = 0;
-    NSUInteger outputLength = 0;
-    unsigned char accumulated[] = {0, 0, 0, 0};
-    for (long long i = 0; i < inputLength; i++)
+    uint16_t encodedPairs[2][4096];
+    uint32_t decodedQuads[4][256];
+} JRBase64Tables;
+
+static const JRBase64Tables *JRBase64GetTables(void)
+{
+    static JRBase64Tables tables;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
     {
-        unsigned char decoded = lookup[inputBytes[i] & 0x7F];
-        if (decoded != 99)
-        {
-            accumulated[accumulator] = decoded;
-            if (accumulator == 3)
+        for (int alphabet = 0; alphabet < 2; alphabet++)
+            for (int i = 0; i < 4096; i++)
             {
-                outputBytes[outputLength++] = (accumulated[0] << 2) | (accumulated[1] >> 4);  
-                outputBytes[outputLength++] = (accumulated[1] << 4) | (accumulated[2] >> 2);  
-                outputBytes[outputLength++] = (accumulated[2] << 6) | accumulated[3];
+                char pair[2] = { JRBase64Alphabets[alphabet][i >> 6], JRBase64Alphabets[alphabet][i & 0x3F] };
+                memcpy(&tables.encodedPairs[alphabet][i], pair, 2);
             }
-            accumulator = (accumulator + 1) % 4;
-        }
-    }
-    
-    //handle left-over data
-    if (accumulator > 0) outputBytes[outputLength] = (accumulated[0] << 2) | (accumulated[1] >> 4);
-    if (accumulator > 1) outputBytes[++outputLength] = (accumulated[1] << 4) | (accumulated[2] >> 2);
-    if (accumulator > 2) outputLength++;
-    
-    //truncate data to match actual output length
-    outputData.length = outputLength;
-    return outputLength? outputData: nil;
+
+        for (int c = 0; c < 256; c++)
+            for (int position = 0; position < 4; position++)
+                tables.decodedQuads[position][c] = JR_BASE64_INVALID;
+
+        for (int alphabet = 0; alphabet < 2; alphabet++)
+            for (uint32_t sextet = 0; sextet < 64; sextet++)
+            {
+                uint8_t c = (uint8_t) JRBase64Alphabets[alphabet][sextet];
+                for (int position = 0; position < 4; position++)
+                    tables.decodedQuads[position][c] = sextet << (18 - 6 * position);
+            }
+    });
+
+    return &tables;
 }
 
-- (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth
+static inline char *JRBase64EncodeGroup(const uint16_t *pairs, const uint8_t *bytes, char *output)
+{
+    uint32_t group = (uint32_t) bytes[0] << 16 | (uint32_t) bytes[1] << 8 | bytes[2];
+    memcpy(output, &pairs[group >> 12], 2);
+    memcpy(output + 2, &pairs[group & 0xFFF], 2);
+    return output + 4;
+}
+
+void JRBase64EncoderInit(JRBase64Encoder *encoder, JRBase64Alphabet alphabet)
+{
+    encoder->alphabet = alphabet;
+    encoder->pendingLength = 0;
+}
+
+size_t JRBase64EncoderUpdate(JRBase64Encoder *encoder, const void *bytes, size_t length, char *output)
 {
-    //ensure wrapWidth is a multiple of 4
-    wrapWidth = (wrapWidth / 4) * 4;
-    
-    unsigned char *lookup = (unsigned char *) "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    
-    NSUInteger inputLength = [self length];
-    const unsigned char *inputBytes = [self bytes];
-    
-    NSUInteger maxOutputLength = (inputLength / 3 + 1) * 4;
-    maxOutputLength += wrapWidth? (maxOutputLength / wrapWidth) * 2: 0;
-    unsigned char *outputBytes = (unsigned char *)malloc(maxOutputLength);
-    
-    long long i;
-    NSUInteger outputLength = 0;
-    for (i = 0; i < inputLength - 2; i += 3)
+    const uint16_t *pairs = JRBase64GetTables()->encodedPairs[encoder->alphabet];
+    const uint8_t *input = bytes;
+    char *start = output;
+
+    if (encoder->pendingLength)
     {
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0xFC) >> 2];
-        outputBytes[outputLength++] = lookup[((inputBytes[i] & 0x03) << 4) | ((inputBytes[i + 1] & 0xF0) >> 4)];
-        outputBytes[outputLength++] = lookup[((inputBytes[i + 1] & 0x0F) << 2) | ((inputBytes[i + 2] & 0xC0) >> 6)];
-        outputBytes[outputLength++] = lookup[inputBytes[i + 2] & 0x3F];
-        
-        //add line break
-        if (wrapWidth && (outputLength + 2) % (wrapWidth + 2) == 0)
+        if (encoder->pendingLength + length < 3)
         {
-            outputBytes[outputLength++] = '\r';
-            outputBytes[outputLength++] = '\n';
+            memcpy(encoder->pending + encoder->pendingLength, input, length);
+            encoder->pendingLength += length;
+            return 0;
         }
+
+        uint8_t group[3];
+        memcpy(group, encoder->pending, encoder->pendingLength);
+        memcpy(group + encoder->pendingLength, input, 3 - encoder->pendingLength);
+        input += 3 - encoder->pendingLength;
+        length -= 3 - encoder->pendingLength;
+        encoder->pendingLength = 0;
+        output = JRBase64EncodeGroup(pairs, group, output);
     }
-    
-    //handle left-over data
-    if (i == inputLength - 2)
-    {
-        // = terminator
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0xFC) >> 2];
-        outputBytes[outputLength++] = lookup[((inputBytes[i] & 0x03) << 4) | ((inputBytes[i + 1] & 0xF0) >> 4)];
-        outputBytes[outputLength++] = lookup[(inputBytes[i + 1] & 0x0F) << 2];
-        outputBytes[outputLength++] =   '=';
-    }
-    else if (i == inputLength - 1)
+
+    for (; length >= 12; input += 12, length -= 12)
     {
-        // == terminator
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0xFC) >> 2];
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0x03) << 4];
-        outputBytes[outputLength++] = '=';
-        outputBytes[outputLength++] = '=';
+        output = JRBase64EncodeGroup(pairs, input, output);
+        output = JRBase64EncodeGroup(pairs, input + 3, output);
+        output = JRBase64EncodeGroup(pairs, input + 6, output);
+        output = JRBase64EncodeGroup(pairs, input + 9, output);
     }
-    
-    if (outputLength >= 4)
+    for (; length >= 3; input += 3, length -= 3)
+        output = JRBase64EncodeGroup(pairs, input, output);
+
+    memcpy(encoder->pending, input, length);
+    encoder->pendingLength = length;
+    return (size_t) (output - start);
+}
+
+size_t JRBase64EncoderFinal(JRBase64Encoder *encoder, char *output)
+{
+    if (!encoder->pendingLength) return 0;
+
+    const char *alphabet = JRBase64Alphabets[encoder->alphabet];
+    uint8_t b0 = encoder->pending[0], b1 = encoder->pendingLength > 1 ? encoder->pending[1] : 0;
+    size_t length = encoder->pendingLength + 1;
+
+    output[0] = alphabet[b0 >> 2];
+    output[1] = alphabet[(b0 & 0x03) << 4 | b1 >> 4];
+    if (length == 3) output[2] = alphabet[(b1 & 0x0F) << 2];
+
+    if (encoder->alphabet == JRBase64Standard)
+        for (; length < 4; length++) output[length] = '=';
+
+    encoder->pendingLength = 0;
+    return length;
+}
+
+size_t JRBase64Encode(const void *bytes, size_t length, JRBase64Alphabet alphabet, char *output)
+{
+    JRBase64Encoder encoder;
+    JRBase64EncoderInit(&encoder, alphabet);
+    size_t outputLength = JRBase64EncoderUpdate(&encoder, bytes, length, output);
+    return outputLength + JRBase64EncoderFinal(&encoder, output + outputLength);
+}
+
+void JRBase64DecoderInit(JRBase64Decoder *decoder)
+{
+    decoder->accumulated = 0;
+    decoder->accumulatedLength = 0;
+}
+
+static inline uint8_t *JRBase64WriteGroup(uint32_t group, uint8_t *output)
+{
+    output[0] = (uint8_t) (group >> 16);
+    output[1] = (uint8_t) (group >> 8);
+    output[2] = (uint8_t) group;
+    return output + 3;
+}
+
+size_t JRBase64DecoderUpdate(JRBase64Decoder *decoder, const char *characters, size_t length, uint8_t *output)
+{
+    const JRBase64Tables *tables = JRBase64GetTables();
+    const uint8_t *input = (const uint8_t *) characters, *end = input + length;
+    uint8_t *start = output;
+
+    while (input < end)
     {
-        //truncate data to match actual output length
-        outputBytes = realloc(outputBytes, outputLength);
-        return [[NSString alloc] initWithBytesNoCopy:outputBytes
-                                               length:outputLength
-                                             encoding:NSASCIIStringEncoding
-                                         freeWhenDone:YES];
+        /* Whole groups of four alphabet characters, the usual case, go four at a time */
+        if (!decoder->accumulatedLength)
+            for (; end - input >= 4; input += 4)
+            {
+                uint32_t group = tables->decodedQuads[0][input[0]] | tables->decodedQuads[1][input[1]] |
+                        tables->decodedQuads[2][input[2]] | tables->decodedQuads[3][input[3]];
+                if (group & JR_BASE64_INVALID) break;
+                output = JRBase64WriteGroup(group, output);
+            }
+
+        /* Anything else, like padding, line breaks or a group split between updates, a character at a time */
+        for (; input < end; input++)
+        {
+            uint32_t sextet = tables->decodedQuads[3][*input];
+            if (sextet & JR_BASE64_INVALID) continue;
+
+            decoder->accumulated = decoder->accumulated << 6 | sextet;
+            if (++decoder->accumulatedLength == 4)
+            {
+                output = JRBase64WriteGroup(decoder->accumulated, output);
+                decoder->accumulated = 0;
+                decoder->accumulatedLength = 0;
+                input++;
+                break;
+            }
+        }
     }
-    else if (outputBytes)
+
+    return (size_t) (output - start);
+}
+
+size_t JRBase64DecoderFinal(JRBase64Decoder *decoder, uint8_t *output)
+{
+    size_t length = decoder->accumulatedLength ? decoder->accumulatedLength - 1 : 0;
+    uint32_t group = decoder->accumulated << (6 * (4 - decoder->accumulatedLength));
+
+    if (length > 0) output[0] = (uint8_t) (group >> 16);
+    if (length > 1) output[1] = (uint8_t) (group >> 8);
+
+    JRBase64DecoderInit(decoder);
+    return length;
+}
+
+size_t JRBase64Decode(const char *characters, size_t length, uint8_t *output)
+{
+    JRBase64Decoder decoder;
+    JRBase64DecoderInit(&decoder);
+    size_t outputLength = JRBase64DecoderUpdate(&decoder, characters, length, output);
+    return outputLength + JRBase64DecoderFinal(&decoder, output + outputLength);
+}
+
+static NSData *JRBase64DecodedDataOfCharacters(const char *characters, size_t length)
+{
+    NSMutableData *outputData = [NSMutableData dataWithLength:JRBase64DecodedLengthForLength(length)];
+    size_t outputLength = JRBase64Decode(characters, length, [outputData mutableBytes]);
+
+    outputData.length = outputLength;
+    return outputLength ? outputData : nil;
+}
+
+static NSString *JRBase64EncodedStringOfBytes(const void *bytes, size_t length, JRBase64Alphabet alphabet,
+                                              NSUInteger wrapWidth)
+{
+    if (!length) return nil;
+
+    /* A line break follows each full line of whole groups, but never the last, padded, group */
+    NSUInteger lineLength = wrapWidth / 4 * 3;
+    size_t maxOutputLength = JRBase64EncodedLengthForLength(length) + (lineLength ? length / lineLength * 2 : 0);
+    char *output = malloc(maxOutputLength);
+    size_t outputLength = 0;
+
+    JRBase64Encoder encoder;
+    JRBase64EncoderInit(&encoder, alphabet);
+    if (lineLength)
     {
-        free(outputBytes);
+        for (; length >= lineLength; bytes = (const uint8_t *) bytes + lineLength, length -= lineLength)
+        {
+            outputLength += JRBase64EncoderUpdate(&encoder, bytes, lineLength, output + outputLength);
+            output[outputLength++] = '\r';
+            output[outputLength++] = '\n';
+        }
     }
-    return nil;
+    outputLength += JRBase64EncoderUpdate(&encoder, bytes, length, output + outputLength);
+    outputLength += JRBase64EncoderFinal(&encoder, output + outputLength);
+
+    return [[NSString alloc] initWithBytesNoCopy:output length:outputLength encoding:NSASCIIStringEncoding
+                                    freeWhenDone:YES];
+}
+
+@implementation NSData (JRBase64)
+
++ (NSData *)dataWithJRBase64EncodedString:(NSString *)string
+{
+    /* Characters outside ASCII aren't in either alphabet, so they're skipped in their UTF-8 form as any others are */
+    const char *characters = [string UTF8String];
+    return characters ? JRBase64DecodedDataOfCharacters(characters, strlen(characters)) : nil;
+}
+
++ (NSData *)dataWithJRBase64EncodedData:(NSData *)data
+{
+    return JRBase64DecodedDataOfCharacters([data bytes], [data length]);
+}
+
+- (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth
+{
+    return JRBase64EncodedStringOfBytes([self bytes], [self length], JRBase64Standard, wrapWidth);
 }
 
 - (NSString *)JRBase64EncodedString
 {
-    return [self JRBase64EncodedStringWithWrapWidth:0];
+    return JRBase64EncodedStringOfBytes([self bytes], [self length], JRBase64Standard, 0);
+}
+
+- (NSString *)JRBase64URLEncodedString
+{
+    return JRBase64EncodedStringOfBytes([self bytes], [self length], JRBase64URLSafe, 0);
+}
+
+- (NSData *)JRBase64EncodedData
+{
+    NSMutableData *outputData = [NSMutableData dataWithLength:JRBase64EncodedLengthForLength([self length])];
+    outputData.length = JRBase64Encode([self bytes], [self length], JRBase64Standard, [outputData mutableBytes]);
+    return outputData;
 }
 
 @end
@@ -174,14 +326,14 @@
 
 - (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth __unused
 {
-    NSData *data = [self dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:YES];
-    return [data JRBase64EncodedStringWithWrapWidth:wrapWidth];
+    const char *bytes = [self UTF8String];
+    return JRBase64EncodedStringOfBytes(bytes, strlen(bytes), JRBase64Standard, wrapWidth);
 }
 
 - (NSString *)JRBase64EncodedString __unused
 {
-    NSData *data = [self dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:YES];
-    return [data JRBase64EncodedString];
+    const char *bytes = [self UTF8String];
+    return JRBase64EncodedStringOfBytes(bytes, strlen(bytes), JRBase64Standard, 0);
 }
 
 - (NSString *)JRBase64DecodedString __unused
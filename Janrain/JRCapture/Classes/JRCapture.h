@@ -795,7 +795,9 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                                  forDelegate:(id <JRCaptureDelegate>)delegate __attribute__((deprecated));
 
 /**
- * Refreshes the signed-in user's access token
+ * Refreshes the signed-in user's access token. The token is also refreshed in the background shortly before it
+ * expires, and when a request fails because it has expired, in which case the request is sent again afterwards. If a
+ * refresh is already in flight this waits on it rather than sending another.
  */
 + (void)refreshAccessTokenForDelegate:(id <JRCaptureDelegate>)delegate context:(id <NSObject>)context __unused;
 
@@ -34,6 +34,8 @@
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 
+#define JR_LOG_CATEGORY JRLogCategoryCapture
+
 #import "JRCaptureApidInterface.h"
 #import <CommonCrypto/CommonDigest.h>
 #import <CommonCrypto/CommonHMAC.h>
@@ -41,6 +43,7 @@
 #import "JREngageWrapper.h"
 #import "JRCaptureData.h"
 #import "debug_log.h"
+#import "JRTrace.h"
 #import "JRBase64.h"
 #import "JRCaptureError.h"
 #import "JRCaptureUser+Extras.h"
@@ -52,12 +55,63 @@
 #import "JRJsonUtils.h"
 #import "NSMutableURLRequest+JRRequestUtils.h"
 #import "JREngage.h"
+#import "JRNSDate+ISO8601_CaptureDateTimeString.h"
 
 
 NSString* const JRDownloadFlowResult = @"JRDownloadFlowResult";
 
+static NSString *const cJRDecodedResponse = @"response";
+static NSString *const cJRDecodedCaptureUser = @"captureUser";
+
 @implementation JRCapture
 
+/**
+ * Checks that a Capture API response is a dictionary with an "ok" stat, and otherwise turns it into a JRCaptureError.
+ * Runs on JRConnectionManager's decoding queue, so none of this work happens on the main thread.
+ */
++ (JRResponseDecoder)statDecoder
+{
+    return ^id(id parsedResponse, NSError **error)
+    {
+        if (![parsedResponse isKindOfClass:[NSDictionary class]])
+        {
+            *error = [JRCaptureError invalidApiResponseErrorWithObject:parsedResponse];
+            return nil;
+        }
+
+        if (![parsedResponse JR_isOKStatus])
+        {
+            *error = [JRCaptureError errorFromResult:parsedResponse onProvider:nil engageToken:nil];
+            return nil;
+        }
+
+        return parsedResponse;
+    };
+}
+
+/**
+ * Like statDecoder, and also builds the JRCaptureUser from the record found under userKey (in the response or in its
+ * "result"), so large user records are materialized off the main thread. Decodes to a dictionary holding the
+ * response and the user under cJRDecodedResponse and cJRDecodedCaptureUser.
+ */
++ (JRResponseDecoder)statAndCaptureUserDecoderForKey:(NSString *)userKey
+{
+    JRResponseDecoder statDecoder = [self statDecoder];
+    return ^id(id parsedResponse, NSError **error)
+    {
+        NSDictionary *response = statDecoder(parsedResponse, error);
+        if (!response) return nil;
+
+        NSMutableDictionary *decoded = [NSMutableDictionary dictionaryWithObject:response forKey:cJRDecodedResponse];
+        NSDictionary *captureUserJson = [response objectForKey:userKey];
+        if ([captureUserJson isKindOfClass:[NSDictionary class]])
+            [decoded JR_maybeSetObject:[JRCaptureUser captureUserObjectFromDictionary:captureUserJson]
+                                forKey:cJRDecodedCaptureUser];
+
+        return decoded;
+    };
+}
+
 + (void)setCaptureConfig:(JRCaptureConfig *)config
 {
     [JRCaptureData setCaptureConfig:config];
@@ -410,6 +464,10 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         return;
     }
 
+    // from the Engage dialog's traditional sign-in form, the sign-in is already being traced
+    JRTrace *trace = [JRTrace currentTrace] ? [JRTrace currentTrace] : [JRTrace beginTraceNamed:@"sign-in"];
+    [trace endSpansOfKind:JRTraceSpanKindUIWait];
+
     NSMutableDictionary *params = [@{@"user" : user, @"password" : password} mutableCopy];
     [params JR_maybeSetObject:mergeToken forKey:@"merge_token"];
 
@@ -418,18 +476,37 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                                                                            delegate:delegate];
     NSString *tradAuthUrl = [[[JRCaptureData requestWithPath:kJRTradAuthUrlPath] URL] absoluteString];
 
-    [JRConnectionManager jsonRequestToUrl:tradAuthUrl params:tradAuthParams
-                        completionHandler:^(id json, NSError *error) {
-                            [self signInHandler:json error:error delegate:delegate];
+    [JRConnectionManager jsonRequestToUrl:tradAuthUrl params:tradAuthParams trace:trace
+                                  decoder:[self statAndCaptureUserDecoderForKey:@"capture_user"]
+                        completionHandler:^(id decoded, NSError *error) {
+                            [self signInHandler:[decoded objectForKey:cJRDecodedResponse]
+                                    captureUser:[decoded objectForKey:cJRDecodedCaptureUser]
+                                          error:error delegate:delegate];
                         }];
 }
 
 + (void)signInHandler:(id)json error:(NSError *)error delegate:(id <JRCaptureDelegate>)delegate
+{
+    JRCaptureUser *captureUser = nil;
+    if (!error && [json isKindOfClass:[NSDictionary class]] && [[json objectForKey:@"stat"] isEqual:@"ok"])
+    {
+        JRTraceSpan *span = [[JRTrace currentTrace] beginSpanNamed:@"capture_user"
+                                                              kind:JRTraceSpanKindModelBuild];
+        captureUser = [JRCaptureUser captureUserObjectFromDictionary:[json objectForKey:@"capture_user"]];
+        [span end];
+    }
+
+    [self signInHandler:json captureUser:captureUser error:error delegate:delegate];
+}
+
++ (void)signInHandler:(id)json captureUser:(JRCaptureUser *)captureUser error:(NSError *)error
+             delegate:(id <JRCaptureDelegate>)delegate
 {
     if (error || ![json isKindOfClass:[NSDictionary class]] || ![[json objectForKey:@"stat"] isEqual:@"ok"]) {
         if (!error) {
             error = [JRCaptureError errorFromResult:json onProvider:nil engageToken:nil];
         }
+        [[JRTrace currentTrace] finishWithError:error];
         if ([delegate respondsToSelector:@selector(captureSignInDidFailWithError:)]){
             [delegate captureSignInDidFailWithError:error];
         }
@@ -440,20 +517,21 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     NSString *authorizationCode = [json objectForKey:@"authorization_code"];
     BOOL isNew = [(NSNumber *) [json objectForKey:@"is_new"] boolValue];
     NSDictionary *captureUserJson = [json objectForKey:@"capture_user"];
-    JRCaptureUser *captureUser = [JRCaptureUser captureUserObjectFromDictionary:captureUserJson];
 
     if (!captureUserJson || !captureUser || !accessToken) {
         JRCaptureError *captureError = [JRCaptureError invalidApiResponseErrorWithString:json];
+        [[JRTrace currentTrace] finishWithError:captureError];
         if ([delegate respondsToSelector:@selector(captureSignInDidFailWithError:)]){
             [delegate captureSignInDidFailWithError:captureError];
         }
         return;
     }
 
-    [JRCaptureData setAccessToken:accessToken];
+    [JRCaptureData setAccessToken:accessToken expiresIn:[json objectForKey:@"expires_in"]];
     NSArray *linkedProfile = [captureUserJson valueForKey:@"profiles"];
     [JRCaptureData setLinkedProfiles:linkedProfile];
     [UIApplication sharedApplication].networkActivityIndicatorVisible = NO;
+    [[JRTrace currentTrace] finishWithError:nil];
 
     JRCaptureRecordStatus recordStatus = isNew ? JRCaptureRecordNewlyCreated : JRCaptureRecordExists;
     // XXX maybeDispatch inlined here because the second arg is actually an enum and logging it as an object will
@@ -477,6 +555,28 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 }
 
 + (void)refreshAccessTokenForDelegate:(id <JRCaptureDelegate>)delegate context:(id <NSObject>)context
+{
+    [JRCaptureApidInterface refreshAccessTokenWithCompletion:^(NSError *error)
+    {
+        if (error)
+        {
+            if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
+                [delegate refreshAccessTokenDidFailWithError:error context:context];
+            }
+            return;
+        }
+
+        if ([delegate respondsToSelector:@selector(refreshAccessTokenDidSucceedWithContext:)]){
+            [delegate refreshAccessTokenDidSucceedWithContext:context];
+        }
+    }];
+}
+
+/**
+ * Sends the refresh itself, and stores the new access token. Goes through
+ * +[JRCaptureApidInterface refreshAccessTokenWithCompletion:], so that there's only ever one refresh in flight.
+ */
++ (void)startRefreshAccessTokenWithCompletion:(void (^)(NSError *error))completion
 {
     NSString *date = [self utcTimeString];
     NSString *accessToken = [JRCaptureData sharedCaptureData].accessToken;
@@ -488,11 +588,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
     if (!signature || !accessToken || !date)
     {
-        if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
-            [delegate refreshAccessTokenDidFailWithError:
-                    [JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate signature"]
-                                                 context:context];
-        }
+        completion([JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate signature"]);
         return;
     }
 
@@ -507,32 +603,19 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
             @"flow_version" : [JRCaptureData sharedCaptureData].downloadedFlowVersion
     };
 
-    [JRConnectionManager jsonRequestToUrl:refreshUrl params:params completionHandler:^(id r, NSError *e)
+    [JRConnectionManager jsonRequestToUrl:refreshUrl params:params decoder:[self statDecoder]
+                        completionHandler:^(id r, NSError *e)
     {
         if (e)
         {
             ALog(@"Failure refreshing access token: %@", e);
-            if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
-                [delegate refreshAccessTokenDidFailWithError:e context:context];
-            }
+            completion(e);
             return;
         }
 
-        if ([@"ok" isEqual:[r objectForKey:@"stat"]])
-        {
-            [JRCaptureData setAccessToken:[r objectForKey:@"access_token"]];
-            DLog(@"refreshed access token");
-            if ([delegate respondsToSelector:@selector(refreshAccessTokenDidSucceedWithContext:)]){
-                [delegate refreshAccessTokenDidSucceedWithContext:context];
-            }
-        }
-        else
-        {
-            if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
-                [delegate refreshAccessTokenDidFailWithError:
-                        [JRCaptureError errorFromResult:r onProvider:nil engageToken:nil] context:context];
-            }
-        }
+        [JRCaptureData setAccessToken:[r objectForKey:@"access_token"] expiresIn:[r objectForKey:@"expires_in"]];
+        DLog(@"refreshed access token");
+        completion(nil);
     }];
 }
 
@@ -634,21 +717,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                 [propInvoker setArgument:&error atIndex:2 /*yes, that's right. 2 is the first arg*/];
                 [propInvoker invoke];
             }
-        } else if (![result isKindOfClass:[NSDictionary class]]) {
-            JRCaptureError *captureError = [JRCaptureError invalidApiResponseErrorWithObject:result];
-            if (failureSelector){
-                NSMethodSignature *propSignature = [[delegate class] instanceMethodSignatureForSelector:failureSelector];
-                NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
-                if (!propSignature || !propInvoker)
-                {
-                    DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(failureSelector));
-                }
-                [propInvoker setSelector:failureSelector];
-                [propInvoker setTarget:delegate];
-                [propInvoker setArgument:&captureError atIndex:2 /*yes, that's right. 2 is the first arg*/];
-                [propInvoker invoke];
-            }
-        } else if ([result JR_isOKStatus]) {
+        } else {
             DLog(@"Success %@", message);
             if (extraOnSuccessHandler) extraOnSuccessHandler(result);
             if (successSelector){
@@ -662,24 +731,11 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                 [propInvoker setTarget:delegate];
                 [propInvoker invoke];
             }
-        } else {
-            JRCaptureError *captureError = [JRCaptureError errorFromResult:result onProvider:nil engageToken:nil];
-            if (failureSelector){
-                NSMethodSignature *propSignature = [[delegate class] instanceMethodSignatureForSelector:failureSelector];
-                NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
-                if (!propSignature || !propInvoker)
-                {
-                    DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(failureSelector));
-                }
-                [propInvoker setSelector:failureSelector];
-                [propInvoker setTarget:delegate];
-                [propInvoker setArgument:&captureError atIndex:2 /*yes, that's right. 2 is the first arg*/];
-                [propInvoker invoke];
-            }
         }
     };
 
-    [JRConnectionManager startURLConnectionWithRequest:request completionHandler:handler];
+    [JRConnectionManager startURLConnectionWithRequest:request decoder:[self statDecoder] callbackQueue:nil
+                                     completionHandler:handler];
 }
 
 +(void)startAccountUnLinking:(id<JRCaptureDelegate>)delegate
@@ -717,11 +773,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
 + (NSString *)utcTimeString
 {
-    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
-    [dateFormatter setTimeZone:[NSTimeZone timeZoneWithName:@"UTC"]];
-    [dateFormatter setDateFormat:@"yyyy-MM-dd HH:mm:ss"];
-    NSString *dateString = [dateFormatter stringFromDate:[NSDate date]];
-    return dateString;
+    return [[NSDate date] stringFromISO8601DateTimeWithoutFraction];
 }
 
 + (NSString *)base64SignatureForRefreshWithDate:(NSString *)dateString refreshSecret:(NSString *)refreshSecret
@@ -737,16 +789,25 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
     CCHmac(kCCHmacAlgSHA1, cKey, strlen(cKey), cData, strlen(cData), cHMAC);
 
-    return [[[NSData alloc] initWithBytes:cHMAC length:sizeof(cHMAC)] JRBase64EncodedString];
+    char signature[JRBase64EncodedLengthForLength(CC_SHA1_DIGEST_LENGTH)];
+    size_t signatureLength = JRBase64Encode(cHMAC, sizeof(cHMAC), JRBase64Standard, signature);
+
+    return [[NSString alloc] initWithBytes:signature length:signatureLength encoding:NSASCIIStringEncoding];
 }
 
 + (void)registerNewUser:(JRCaptureUser *)newUser socialRegistrationToken:(NSString *)socialRegistrationToken
             forDelegate:(id <JRCaptureDelegate>)delegate
 {
+    // a social registration carries on the sign-in trace that ended in a two-step registration flow error
+    JRTrace *trace = [JRTrace currentTrace] ? [JRTrace currentTrace] : [JRTrace beginTraceNamed:@"registration"];
+    [trace endSpansOfKind:JRTraceSpanKindUIWait];
+
     if (!newUser)
     {
+        JRCaptureError *error = [JRCaptureError invalidArgumentErrorWithParameterName:@"newUser"];
+        [trace finishWithError:error];
         if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
-            [delegate registerUserDidFailWithError:[JRCaptureError invalidArgumentErrorWithParameterName:@"newUser"]];
+            [delegate registerUserDidFailWithError:error];
         }
         return;
     }
@@ -759,9 +820,11 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
     if (!refreshSecret)
     {
+        JRCaptureError *error = [JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate secure "
+                "random refresh secret"];
+        [trace finishWithError:error];
         if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
-            [delegate registerUserDidFailWithError:[JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate secure "
-                    "random refresh secret"]];
+            [delegate registerUserDidFailWithError:error];
         }
         return;
     }
@@ -789,13 +852,14 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         urlString = [NSString stringWithFormat:@"%@/oauth/register_native_traditional", config.captureBaseUrl];
     }
 
-    [JRConnectionManager jsonRequestToUrl:urlString params:params completionHandler:^(id parsedResponse, NSError *e)
+    [JRConnectionManager jsonRequestToUrl:urlString params:params trace:trace decoder:[self statDecoder]
+                        completionHandler:^(id parsedResponse, NSError *e)
     {
-        [self handleRegistrationResponse:parsedResponse orError:e delegate:delegate];
+        [self handleRegistrationResponse:parsedResponse orError:e trace:trace delegate:delegate];
     }];
 }
 
-+ (void)handleRegistrationResponse:(id)parsedResponse orError:(NSError *)e
++ (void)handleRegistrationResponse:(id)parsedResponse orError:(NSError *)e trace:(JRTrace *)trace
                           delegate:(id <JRCaptureDelegate>)delegate
 {
     NSString *accessToken;
@@ -813,6 +877,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
     if (e) {
         ALog(@"%@", e);
+        [trace finishWithError:e];
         if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
             [delegate registerUserDidFailWithError:e];
         }
@@ -821,24 +886,23 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
     NSString *authorizationCode = [parsedResponse objectForKey:@"authorization_code"];
 
-    void (^handler)(id, NSError *) = ^(id entityResponse, NSError *e_) {
-        if (e_ || ![entityResponse isKindOfClass:[NSDictionary class]] ||
-                ![@"ok" isEqual:[entityResponse objectForKey:@"stat"]] ||
-                ![entityResponse objectForKey:@"result"]
-        ) {
+    void (^handler)(id, NSError *) = ^(id decoded, NSError *e_) {
+        NSDictionary *entityResponse = [decoded objectForKey:cJRDecodedResponse];
+        JRCaptureUser *newUser = [decoded objectForKey:cJRDecodedCaptureUser];
+        if (e_ || !newUser) {
             if (!e_) e_ = [JRCaptureError invalidApiResponseErrorWithObject:entityResponse];
-            ALog(@"%@", e);
+            ALog(@"%@", e_);
+            [trace finishWithError:e_];
             if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
                 [delegate registerUserDidFailWithError:e_];
             }
             return;
         }
 
-        JRCaptureUser *newUser =
-            [JRCaptureUser captureUserObjectFromDictionary:[entityResponse objectForKey:@"result"]];
-        [self setAccessToken:accessToken];
+        [JRCaptureData setAccessToken:accessToken expiresIn:[parsedResponse objectForKey:@"expires_in"]];
         NSArray *linkedProfile = [[entityResponse objectForKey:@"result"] valueForKey:@"profiles"];
         [JRCaptureData setLinkedProfiles:linkedProfile];
+        [trace finishWithError:nil];
         if ([delegate respondsToSelector:@selector(registerUserDidSucceed:)]){
             [delegate registerUserDidSucceed:newUser];
         }
@@ -851,7 +915,9 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     };
 
     NSString *entityUrl = [NSString stringWithFormat:@"%@/entity", [JRCaptureData sharedCaptureData].captureBaseUrl];
-    [JRConnectionManager jsonRequestToUrl:entityUrl params:@{@"access_token" : accessToken} completionHandler:handler];
+    [JRConnectionManager jsonRequestToUrl:entityUrl params:@{@"access_token" : accessToken} trace:trace
+                                  decoder:[self statAndCaptureUserDecoderForKey:@"result"]
+                        completionHandler:handler];
 }
 
 + (void)updateProfileForUser:(JRCaptureUser *)user delegate:(id <JRCaptureDelegate>)delegate
@@ -33,6 +33,7 @@
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #import <Foundation/Foundation.h>
+#import "JRJsonFormWriter.h"
 
 #define JRCaptureInterfaceDelegate JRCaptureInternalDelegate
 
@@ -116,6 +117,50 @@ FOUNDATION_EXPORT NSString *const kJRTradAuthUrlPath;
                 forDelegate:(id <JRCaptureInternalDelegate>)delegate
                 withContext:(NSObject *)context;
 
+/**
+ * The same three writes, with the attributes written by a block straight into the request body rather than
+ * serialized from an NSDictionary or NSArray. The block is called once, before the method returns.
+ */
++ (void)updateCaptureObjectWithAttributes:(JRJsonWritingBlock)writeAttributes
+                                   atPath:(NSString *)entityPath
+                                withToken:(NSString *)token
+                              forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                              withContext:(NSObject *)context;
+
++ (void)replaceCaptureObjectWithAttributes:(JRJsonWritingBlock)writeAttributes
+                                    atPath:(NSString *)entityPath
+                                 withToken:(NSString *)token
+                               forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                               withContext:(NSObject *)context;
+
++ (void)replaceCaptureArrayWithAttributes:(JRJsonWritingBlock)writeAttributes
+                                   atPath:(NSString *)entityPath
+                                withToken:(NSString *)token
+                              forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                              withContext:(NSObject *)context;
+
+/**
+ * The number of /entity reads sent, and the number of reads that were instead coalesced into an identical read (same
+ * path and access token) that was already in flight
+ */
++ (NSUInteger)sentReadCount;
++ (NSUInteger)coalescedReadCount;
+
+/**
+ * Refreshes the access token, or, if a refresh is already in flight, waits on that one instead of sending another.
+ * Requests that fail because their access token expired are parked until the refresh finishes, then sent again with
+ * the new token, once; if the refresh fails they fail with their original error. Requests held back only because the
+ * token looked expired by its age are sent with the old token if the refresh fails. The completion, which may be nil,
+ * is called on the main queue with the refresh's error, if any.
+ */
++ (void)refreshAccessTokenWithCompletion:(void (^)(NSError *error))completion;
+
+/**
+ * The number of refreshes sent, and the number of times a refresh was wanted while one was already in flight
+ */
++ (NSUInteger)sentRefreshCount;
++ (NSUInteger)coalescedRefreshCount;
+
 + (NSMutableDictionary *)tradAuthParamsWithParams:(NSDictionary *)paramsDict refreshSecret:(NSString *)refreshSecret
                                          delegate:(id)delegate;
 @end
@@ -32,8 +32,11 @@
  Date:   Thursday, January 26, 2012
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#define JR_LOG_CATEGORY JRLogCategoryCapture
+
 #import "debug_log.h"
 #import "JRConnectionManager.h"
+#import "JRConnectionMetrics.h"
 #import "JRCaptureApidInterface.h"
 #import "JRCaptureData.h"
 #import "NSMutableDictionary+JRDictionaryUtils.h"
@@ -41,28 +44,134 @@
 #import "JRCaptureError.h"
 #import "JRJsonUtils.h"
 #import "JRCaptureFlow.h"
+#import "JRJsonFormWriter.h"
+#import "JRJsonReader.h"
+#import "JRCaptureObject+Internal.h"
+#import "JRCaptureUser.h"
+#import "JRCapture.h"
 
-static NSString *const cSignInUser = @"signinUser";
-static NSString *const cGetUser = @"getUser";
-static NSString *const cGetObject = @"getObject";
-static NSString *const cUpdateObject = @"updateObject";
-static NSString *const cReplaceObject = @"replaceObject";
-static NSString *const cReplaceArray = @"replaceArray";
-static NSString *const cTagAction = @"action";
+static NSString *const cEntityUpdatePath = @"/entity.update";
+static NSString *const cEntityReplacePath = @"/entity.replace";
 
 NSString *const kJRTradAuthUrlPath = @"/oauth/auth_native_traditional";
 
+/* The "code" Capture answers with when the access token has expired */
+static const NSInteger cAccessTokenExpiredCode = 414;
+
+typedef enum CaptureInterfaceStatEnum
+{
+    StatOk,
+    StatFail,
+} CaptureInterfaceStat;
+
+typedef void (^JRCaptureApidFinishBlock)(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload);
+typedef NSMutableURLRequest *(^JRCaptureApidRequestBuilder)(NSString *accessToken);
+
+/**
+ * Describes one request sent to Capture, and is the tag its connection is created with. finish is called exactly once
+ * with the parsed response (or an error dictionary) and the raw response body. readKey and readPath are only set for
+ * /entity reads. If unparsedKey is set, the value of that member of the response is left unparsed, as a JRJsonReader.
+ *
+ * Requests that carry an access token have it in token, and a build block that builds the request for any token, so
+ * that they can be sent again once an expired token has been refreshed. retries counts those replays, and
+ * expiredResult is what the request finishes with if the refresh fails. Requests held back only because their token
+ * looked expired by its age have no expiredResult; if the refresh fails they're sent with the old token anyway.
+ */
+@interface JRCaptureApidRequest : NSObject
+@property(nonatomic, copy) NSString *readKey;
+@property(nonatomic, copy) NSString *readPath;
+@property(nonatomic, copy) NSString *unparsedKey;
+@property(nonatomic, copy) JRCaptureApidFinishBlock finish;
+@property(nonatomic, copy) NSString *token;
+@property(nonatomic, copy) JRCaptureApidRequestBuilder build;
+@property(nonatomic) NSUInteger retries;
+@property(nonatomic) NSDictionary *expiredResult;
+@end
+
+@implementation JRCaptureApidRequest
++ (JRCaptureApidRequest *)requestWithFinish:(JRCaptureApidFinishBlock)finish
+{
+    JRCaptureApidRequest *request = [[JRCaptureApidRequest alloc] init];
+    request.finish = finish;
+    return request;
+}
+@end
+
+@interface JRCapture (JRCaptureApidInterface)
++ (void)startRefreshAccessTokenWithCompletion:(void (^)(NSError *error))completion;
+@end
+
+/**
+ * Runs the block straight away on the main thread, and from any other thread asynchronously on the main queue
+ */
+static void JRCaptureApidRunOnMainThread(dispatch_block_t block)
+{
+    if ([NSThread isMainThread])
+        block();
+    else
+        dispatch_async(dispatch_get_main_queue(), block);
+}
+
+/**
+ * inFlightReads maps the key of every /entity read that is currently on the wire (see readKeyForPath:token:) to the
+ * requests of all the callers waiting on it, the first of which is the one the connection was created with.
+ *
+ * While a refresh of the access token is in flight, parkedRequests holds the requests waiting to be sent again with
+ * the new token, and refreshCompletions the completions waiting on the refresh. failedRefreshToken is the last token
+ * that couldn't be refreshed; requests with it are sent as they are, whatever its age says, and left to Capture.
+ *
+ * All of this state belongs to the main thread. The connection manager calls back on its callbackQueue, which need not
+ * be the main queue, so the callbacks, the refresh's completion and requests made off the main thread are moved onto
+ * it with JRCaptureApidRunOnMainThread before they touch anything.
+ */
 @interface JRCaptureApidInterface ()  <JRConnectionManagerDelegate>
+@property(nonatomic) NSMutableDictionary *inFlightReads;
+@property(nonatomic) NSUInteger sentReadCount;
+@property(nonatomic) NSUInteger coalescedReadCount;
+@property(nonatomic) BOOL refreshInFlight;
+@property(nonatomic) NSMutableArray *parkedRequests;
+@property(nonatomic) NSMutableArray *refreshCompletions;
+@property(nonatomic) NSTimer *refreshTimer;
+@property(nonatomic, copy) NSString *failedRefreshToken;
+@property(nonatomic) NSUInteger sentRefreshCount;
+@property(nonatomic) NSUInteger coalescedRefreshCount;
 @end
 
 @implementation JRCaptureApidInterface
 - (JRCaptureApidInterface *)init
 {
-    if ((self = [super init])) { }
+    if ((self = [super init]))
+    {
+        _inFlightReads = [NSMutableDictionary dictionary];
+        _parkedRequests = [NSMutableArray array];
+        _refreshCompletions = [NSMutableArray array];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(accessTokenDidChange:)
+                                                     name:JRCaptureAccessTokenDidChangeNotification object:nil];
+    }
 
     return self;
 }
 
++ (NSUInteger)sentReadCount
+{
+    return [JRCaptureApidInterface sharedCaptureApidInterface].sentReadCount;
+}
+
++ (NSUInteger)coalescedReadCount
+{
+    return [JRCaptureApidInterface sharedCaptureApidInterface].coalescedReadCount;
+}
+
++ (NSUInteger)sentRefreshCount
+{
+    return [JRCaptureApidInterface sharedCaptureApidInterface].sentRefreshCount;
+}
+
++ (NSUInteger)coalescedRefreshCount
+{
+    return [JRCaptureApidInterface sharedCaptureApidInterface].coalescedRefreshCount;
+}
+
 + (JRCaptureApidInterface *)captureInterfaceInstance __attribute__((deprecated))
 {
     return [self sharedCaptureApidInterface];
@@ -88,12 +197,6 @@ NSString *const kJRTradAuthUrlPath = @"/oauth/auth_native_traditional";
     return self;
 }
 
-typedef enum CaptureInterfaceStatEnum
-{
-    StatOk,
-    StatFail,
-} CaptureInterfaceStat;
-
 + (void)finishSignInFailureWithError:(JRCaptureError *)error forDelegate:(id)delegate
                          withContext:(NSObject *)context
 {
@@ -126,16 +229,249 @@ typedef enum CaptureInterfaceStatEnum
 
 + (void)startTradAuthForDelegate:(id)delegate context:(NSObject *)context request:(NSURLRequest *)request
 {
-    NSMutableDictionary *tag = [@{cTagAction : cSignInUser, @"delegate" : delegate } mutableCopy];
-    if (context) [tag setObject:context forKey:@"context"];
     JRCaptureApidInterface *singleton = [JRCaptureApidInterface sharedCaptureApidInterface];
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:singleton withTag:tag])
+    JRCaptureApidRequest *apidRequest = [JRCaptureApidRequest requestWithFinish:
+            ^(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload)
     {
-        JRCaptureError *err = [JRCaptureError connectionCreationErr:request forDelegate:singleton withTag:tag];
+        [singleton finishSignInUserWithPayload:payload context:context response:result stat:stat delegate:delegate];
+    }];
+
+    if (![singleton startRequest:request withApidRequest:apidRequest])
+    {
+        JRCaptureError *err = [JRCaptureError connectionCreationErr:request forDelegate:singleton
+                                                            withTag:apidRequest];
         [self finishSignInFailureWithError:err forDelegate:delegate withContext:context];
     }
 }
 
+- (BOOL)startRequest:(NSURLRequest *)request withApidRequest:(JRCaptureApidRequest *)apidRequest
+{
+    return [JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:YES
+                                                    withTag:apidRequest];
+}
+
+/**
+ * Sends the request, or finishes the apidRequest with a url_connection error if no connection could be created for it
+ */
+- (void)sendRequest:(NSURLRequest *)request withApidRequest:(JRCaptureApidRequest *)apidRequest
+{
+    if ([self startRequest:request withApidRequest:apidRequest]) return;
+
+    NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
+                                                   [[request URL] absoluteString]];
+    NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorUrlConnection];
+    NSDictionary *result = @{
+            @"stat" : @"error",
+            @"error" : @"url_connection",
+            @"error_description" : errDesc,
+            @"code" : errCode,
+    };
+    [self finishApidRequest:apidRequest withStat:StatFail result:result payload:nil];
+}
+
+/**
+ * Sends a request that carries an access token, built for the token it has. If that's the stored token, and there's a
+ * refresh secret to refresh it with, and it has expired, by the stored token's age, the request is parked for the
+ * refresh instead of being sent to fail; if it's merely due to be refreshed, a refresh is started in the background.
+ */
+- (void)sendApidRequest:(JRCaptureApidRequest *)apidRequest
+{
+    if (![NSThread isMainThread])
+    {
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            [self sendApidRequest:apidRequest];
+        });
+        return;
+    }
+
+    JRCaptureData *data = [JRCaptureData sharedCaptureData];
+    if ([apidRequest.token isEqualToString:data.accessToken] && data.refreshSecret &&
+            ![apidRequest.token isEqualToString:self.failedRefreshToken])
+    {
+        if (!self.refreshTimer) [self scheduleAccessTokenRefresh];
+
+        if ([data accessTokenIsExpired])
+        {
+            [self parkApidRequest:apidRequest result:nil];
+            return;
+        }
+
+        if ([[data accessTokenRefreshDate] timeIntervalSinceNow] <= 0)
+            [self refreshAccessTokenWithCompletion:nil];
+    }
+
+    [self buildAndSendApidRequest:apidRequest];
+}
+
+- (void)buildAndSendApidRequest:(JRCaptureApidRequest *)apidRequest
+{
+    NSMutableURLRequest *request = apidRequest.build(apidRequest.token);
+    if (apidRequest.retries)
+        [NSURLProtocol setProperty:[NSNumber numberWithUnsignedInteger:apidRequest.retries]
+                            forKey:JRRequestRetryCountProperty inRequest:request];
+
+    [self sendRequest:request withApidRequest:apidRequest];
+}
+
+/**
+ * Returns YES if the request failed only because its access token had expired, in which case it has been parked
+ * until the refresh finishes, or, if the stored token has been refreshed since it was sent, sent again already.
+ * Requests are only sent again once.
+ */
+- (BOOL)replayIfAccessTokenExpired:(JRCaptureApidRequest *)apidRequest result:(NSDictionary *)result
+{
+    if (!apidRequest.build || apidRequest.retries || ![result isKindOfClass:[NSDictionary class]]) return NO;
+    if ([[result objectForKey:@"code"] integerValue] != cAccessTokenExpiredCode) return NO;
+
+    NSString *accessToken = [JRCaptureData sharedCaptureData].accessToken;
+    if (!accessToken) return NO;
+
+    if (!self.refreshInFlight && ![apidRequest.token isEqualToString:accessToken])
+        [self replayApidRequest:apidRequest];
+    else
+        [self parkApidRequest:apidRequest result:result];
+
+    return YES;
+}
+
+- (void)parkApidRequest:(JRCaptureApidRequest *)apidRequest result:(NSDictionary *)result
+{
+    DLog(@"parking a request until the access token is refreshed");
+    apidRequest.expiredResult = result;
+    [self.parkedRequests addObject:apidRequest];
+    [self refreshAccessTokenWithCompletion:nil];
+}
+
+/**
+ * Sends the request again with the stored access token. A read is moved, with the callers waiting on it, to the key
+ * for the new token, and joins the read that's in flight under that key if there is one.
+ */
+- (void)replayApidRequest:(JRCaptureApidRequest *)apidRequest
+{
+    NSString *accessToken = [JRCaptureData sharedCaptureData].accessToken;
+    apidRequest.token = accessToken;
+    apidRequest.retries++;
+
+    if (apidRequest.readKey)
+    {
+        NSArray *waitingRequests = [self.inFlightReads objectForKey:apidRequest.readKey];
+        if (!waitingRequests) waitingRequests = @[apidRequest];
+        [self.inFlightReads removeObjectForKey:apidRequest.readKey];
+        apidRequest.readKey = [self readKeyForPath:apidRequest.readPath token:accessToken];
+
+        NSMutableArray *joinedRequests = [self.inFlightReads objectForKey:apidRequest.readKey];
+        if (joinedRequests)
+        {
+            [joinedRequests addObjectsFromArray:waitingRequests];
+            self.coalescedReadCount += [waitingRequests count];
+            return;
+        }
+
+        [self.inFlightReads setObject:[waitingRequests mutableCopy] forKey:apidRequest.readKey];
+        self.sentReadCount++;
+    }
+
+    [self sendApidRequest:apidRequest];
+}
+
+- (void)refreshAccessTokenWithCompletion:(void (^)(NSError *error))completion
+{
+    if (completion) [self.refreshCompletions addObject:[completion copy]];
+    if (self.refreshInFlight)
+    {
+        self.coalescedRefreshCount++;
+        return;
+    }
+
+    DLog(@"refreshing the access token");
+    self.refreshInFlight = YES;
+    self.sentRefreshCount++;
+    [JRCapture startRefreshAccessTokenWithCompletion:^(NSError *error)
+    {
+        JRCaptureApidRunOnMainThread(^
+        {
+            [self finishRefreshWithError:error];
+        });
+    }];
+}
+
+- (void)finishRefreshWithError:(NSError *)error
+{
+    NSArray *parkedRequests = self.parkedRequests;
+    NSArray *completions = self.refreshCompletions;
+    self.parkedRequests = [NSMutableArray array];
+    self.refreshCompletions = [NSMutableArray array];
+    self.refreshInFlight = NO;
+
+    DLog(@"access token refresh %@, %lu parked requests", error ? @"failed" : @"done",
+         (unsigned long) [parkedRequests count]);
+    if (error) self.failedRefreshToken = [JRCaptureData sharedCaptureData].accessToken;
+
+    for (JRCaptureApidRequest *apidRequest in parkedRequests)
+    {
+        if (!error)
+            [self replayApidRequest:apidRequest];
+        else if (apidRequest.expiredResult)
+            [self finishApidRequest:apidRequest withStat:StatFail result:apidRequest.expiredResult payload:nil];
+        else
+            [self buildAndSendApidRequest:apidRequest];
+    }
+
+    for (void (^completion)(NSError *) in completions)
+        completion(error);
+}
+
+- (void)scheduleAccessTokenRefresh
+{
+    [self.refreshTimer invalidate];
+    self.refreshTimer = nil;
+
+    NSDate *refreshDate = [[JRCaptureData sharedCaptureData] accessTokenRefreshDate];
+    if (!refreshDate) return;
+
+    self.refreshTimer = [[NSTimer alloc] initWithFireDate:refreshDate interval:0 target:self
+                                                 selector:@selector(refreshTimerDidFire:) userInfo:nil repeats:NO];
+    [[NSRunLoop mainRunLoop] addTimer:self.refreshTimer forMode:NSRunLoopCommonModes];
+}
+
+- (void)refreshTimerDidFire:(NSTimer *)timer
+{
+    self.refreshTimer = nil;
+
+    /* The token may have changed since the timer was armed, and its replacement not be due yet */
+    JRCaptureData *data = [JRCaptureData sharedCaptureData];
+    NSDate *refreshDate = [data accessTokenRefreshDate];
+    if (data.accessToken && data.refreshSecret && refreshDate && [refreshDate timeIntervalSinceNow] <= 0)
+        [self refreshAccessTokenWithCompletion:nil];
+}
+
++ (void)refreshAccessTokenWithCompletion:(void (^)(NSError *error))completion
+{
+    JRCaptureApidRunOnMainThread(^
+    {
+        [[JRCaptureApidInterface sharedCaptureApidInterface] refreshAccessTokenWithCompletion:completion];
+    });
+}
+
+/* A new token is due to be refreshed at a different time, and no token at all isn't refreshed */
+- (void)accessTokenDidChange:(NSNotification *)notification
+{
+    dispatch_async(dispatch_get_main_queue(), ^
+    {
+        [self scheduleAccessTokenRefresh];
+    });
+}
+
+- (void)finishApidRequest:(JRCaptureApidRequest *)apidRequest withStat:(CaptureInterfaceStat)stat
+                   result:(NSDictionary *)result payload:(NSData *)payload
+{
+    if (apidRequest.readKey)
+        [self finishReadWithRequest:apidRequest stat:stat result:result payload:payload];
+    else
+        apidRequest.finish(stat, result, payload);
+}
+
 - (void)finishGetCaptureUserWithStat:(CaptureInterfaceStat)stat andResult:(NSDictionary *)result
                          forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
 {
@@ -156,23 +492,23 @@ typedef enum CaptureInterfaceStatEnum
 - (void)getCaptureUserWithToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
                     withContext:(NSObject *)context
 {
-    NSMutableURLRequest *request = [self entityRequestForPath:nil token:token];
-
-    NSMutableDictionary *tag = [@{cTagAction : cGetUser, @"delegate" : delegate } mutableCopy];
-    [tag JR_maybeSetObject:context forKey:@"context"];
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
-    {
-        NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
-                                                       [[request URL] absoluteString]];
-        NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorUrlConnection];
-        NSDictionary *result = @{
-                @"stat" : @"error",
-                @"error" : @"url_connection",
-                @"error_description" : errDesc,
-                @"code" : errCode,
-        };
-        [self finishGetCaptureUserWithStat:StatFail andResult:result forDelegate:delegate withContext:context];
-    }
+    JRCaptureApidRequest *apidRequest = [JRCaptureApidRequest requestWithFinish:
+            ^(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload)
+    {
+        [self finishGetCaptureUserWithStat:stat andResult:result forDelegate:delegate withContext:context];
+    }];
+    apidRequest.readKey = [self readKeyForPath:nil token:token];
+    apidRequest.unparsedKey = @"result";
+    apidRequest.token = token;
+    apidRequest.build = ^(NSString *accessToken)
+    {
+        return [self entityRequestForPath:nil token:accessToken];
+    };
+
+    JRCaptureApidRunOnMainThread(^
+    {
+        if (![self joinInFlightRead:apidRequest]) [self sendApidRequest:apidRequest];
+    });
 }
 
 - (void)finishGetObjectWithStat:(CaptureInterfaceStat)stat andResult:(NSDictionary *)result
@@ -195,23 +531,111 @@ typedef enum CaptureInterfaceStatEnum
 - (void)getCaptureObjectAtPath:(NSString *)entityPath withToken:(NSString *)token
                    forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
 {
-    NSMutableURLRequest *request = [self entityRequestForPath:entityPath token:token];
-
-    NSMutableDictionary *tag = [@{cTagAction : cGetObject, @"delegate" : delegate } mutableCopy];
-    [tag JR_maybeSetObject:context forKey:@"context"];
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
-    {
-        NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
-                                                       [[request URL] absoluteString]];
-        NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorUrlConnection];
-        NSDictionary *result = @{
-                @"stat" : @"error",
-                @"error" : @"url_connection",
-                @"error_description" : errDesc,
-                @"code" : errCode 
-        };
-        [self finishGetObjectWithStat:StatFail andResult:result forDelegate:delegate withContext:context];
+    JRCaptureApidRequest *apidRequest = [JRCaptureApidRequest requestWithFinish:
+            ^(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload)
+    {
+        [self finishGetObjectWithStat:stat andResult:result forDelegate:delegate withContext:context];
+    }];
+    apidRequest.readKey = [self readKeyForPath:entityPath token:token];
+    apidRequest.readPath = entityPath;
+    apidRequest.token = token;
+    apidRequest.build = ^(NSString *accessToken)
+    {
+        return [self entityRequestForPath:entityPath token:accessToken];
+    };
+
+    JRCaptureApidRunOnMainThread(^
+    {
+        if (![self joinInFlightRead:apidRequest]) [self sendApidRequest:apidRequest];
+    });
+}
+
+/**
+ * Two reads share a key exactly when entityRequestForPath:token: would build the same request for them
+ */
+- (NSString *)readKeyForPath:(NSString *)entityPath token:(NSString *)token
+{
+    return [NSString stringWithFormat:@"%@\n%@", entityPath ? entityPath : @"", token];
+}
+
+/**
+ * Returns YES if an identical read is already in flight, in which case the request has been queued to get that read's
+ * result. Otherwise records the request's read as in flight and returns NO; the caller then has to send the request.
+ */
+- (BOOL)joinInFlightRead:(JRCaptureApidRequest *)apidRequest
+{
+    NSMutableArray *waitingRequests = [self.inFlightReads objectForKey:apidRequest.readKey];
+    if (waitingRequests)
+    {
+        DLog(@"coalescing into in-flight read of '%@'", apidRequest.readKey);
+        [waitingRequests addObject:apidRequest];
+        self.coalescedReadCount++;
+        return YES;
     }
+
+    [self.inFlightReads setObject:[NSMutableArray arrayWithObject:apidRequest] forKey:apidRequest.readKey];
+    self.sentReadCount++;
+    return NO;
+}
+
+/**
+ * Fans the result of a read out to every caller that was waiting on it, each with its own delegate and context
+ */
+- (void)finishReadWithRequest:(JRCaptureApidRequest *)apidRequest stat:(CaptureInterfaceStat)stat
+                       result:(NSDictionary *)result payload:(NSData *)payload
+{
+    NSArray *waitingRequests = [self.inFlightReads objectForKey:apidRequest.readKey];
+    [self.inFlightReads removeObjectForKey:apidRequest.readKey];
+    if (!waitingRequests) waitingRequests = @[apidRequest];
+
+    /* Reads that want the whole response parsed may have joined one that left part of it unparsed */
+    NSDictionary *parsedResult = nil;
+    for (JRCaptureApidRequest *waitingRequest in waitingRequests)
+    {
+        if (!waitingRequest.unparsedKey && !parsedResult)
+            parsedResult = [self result:result parsingKey:apidRequest.unparsedKey];
+
+        waitingRequest.finish(stat, waitingRequest.unparsedKey ? result : parsedResult, payload);
+    }
+}
+
+- (NSDictionary *)result:(NSDictionary *)result parsingKey:(NSString *)key
+{
+    id unparsed = key ? [result objectForKey:key] : nil;
+    if (![unparsed isKindOfClass:[JRJsonReader class]]) return result;
+
+    NSMutableDictionary *parsedResult = [result mutableCopy];
+    [parsedResult setValue:[[unparsed copy] readValue] forKey:key];
+    return parsedResult;
+}
+
+/**
+ * The part of the user's attribute projection below entityPath, relative to it; e.g. @[ @"city" ] at @"/primaryAddress"
+ * when the user was generated with @"primaryAddress.city". nil if the user was generated from the whole schema, or if
+ * the whole object at entityPath was
+ */
+- (NSArray *)attributeProjectionForPath:(NSString *)entityPath
+{
+    NSArray *projection = [JRCaptureUser attributeProjection];
+    if (!projection || !entityPath || [entityPath isEqualToString:@""]) return projection;
+
+    NSMutableArray *names = [NSMutableArray array];
+    for (NSString *segment in [entityPath componentsSeparatedByString:@"/"])
+        if ([segment length])
+            [names addObject:[[segment componentsSeparatedByString:@"#"] objectAtIndex:0]];
+
+    NSString *prefix = [[names componentsJoinedByString:@"."] stringByAppendingString:@"."];
+    NSMutableArray *pathProjection = [NSMutableArray array];
+    for (NSString *path in projection)
+    {
+        if ([prefix hasPrefix:[path stringByAppendingString:@"."]])
+            return nil;
+
+        if ([path hasPrefix:prefix])
+            [pathProjection addObject:[path substringFromIndex:[prefix length]]];
+    }
+
+    return [pathProjection count] ? pathProjection : nil;
 }
 
 - (NSMutableURLRequest *)entityRequestForPath:(NSString *)entityPath token:(NSString *)token
@@ -221,11 +645,59 @@ typedef enum CaptureInterfaceStatEnum
     if (entityPath && ![entityPath isEqualToString:@""])
         [params setObject:entityPath forKey:@"attribute_name"];
 
+    NSArray *projection = [self attributeProjectionForPath:entityPath];
+    if (projection)
+        [params setObject:[projection JR_jsonString] forKey:@"attributes"];
+
     NSMutableURLRequest *request = [JRCaptureData requestWithPath:@"/entity"];
     [request JR_setBodyWithParams:params];
     return request;
 }
 
+/**
+ * Sends an /entity.update or /entity.replace, whose bodies differ only in the attributes they carry. The attributes
+ * are written as JSON straight into the form-encoded body, which becomes the request's HTTPBody as is. The access
+ * token is written last, so that a replay with a refreshed token reuses the attributes rather than writing them again.
+ */
+- (void)sendEntityWriteToApiPath:(NSString *)apiPath attributes:(JRJsonWritingBlock)writeAttributes
+                      entityPath:(NSString *)entityPath token:(NSString *)token
+                     apidRequest:(JRCaptureApidRequest *)apidRequest
+{
+    JRJsonFormWriter *writer = [[JRJsonFormWriter alloc] init];
+    [writer appendFormParameterNamed:@"attributes"];
+    writeAttributes(writer);
+    [writer appendFormParameterNamed:@"include_record" value:@"true"];
+
+    if (entityPath && ![entityPath isEqualToString:@""])
+        [writer appendFormParameterNamed:@"attribute_name" value:entityPath];
+
+    NSUInteger tokenOffset = writer.length;
+    [writer appendFormParameterNamed:@"access_token" value:token];
+    NSData *body = [writer data];
+
+    apidRequest.token = token;
+    apidRequest.build = ^(NSString *accessToken)
+    {
+        NSData *requestBody = body;
+        if (accessToken != token && ![accessToken isEqualToString:token])
+        {
+            JRJsonFormWriter *tokenWriter = [[JRJsonFormWriter alloc] init];
+            [tokenWriter appendFormParameterNamed:@"access_token" value:accessToken];
+            NSMutableData *replayBody = [NSMutableData dataWithBytes:[body bytes] length:tokenOffset];
+            [replayBody appendBytes:"&" length:1];
+            [replayBody appendData:[tokenWriter data]];
+            requestBody = replayBody;
+        }
+
+        NSMutableURLRequest *request = [JRCaptureData requestWithPath:apiPath];
+        [request setHTTPMethod:@"POST"];
+        [request setHTTPBody:requestBody];
+        return request;
+    };
+
+    [self sendApidRequest:apidRequest];
+}
+
 - (void)finishUpdateObjectWithStat:(CaptureInterfaceStat)stat andResult:(NSDictionary *)result
                        forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
 {
@@ -243,54 +715,20 @@ typedef enum CaptureInterfaceStatEnum
     }
 }
 
-- (void)updateObject:(NSDictionary *)captureObject atPath:(NSString *)entityPath
-           withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
-         withContext:(NSObject *)context
+- (void)updateObjectWithAttributes:(JRJsonWritingBlock)writeAttributes atPath:(NSString *)entityPath
+                         withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                       withContext:(NSObject *)context
 {
     DLog(@"");
 
-    NSString *attributes = [[captureObject JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSMutableData *body = [NSMutableData data];
-
-    NSString *attrArgString = [NSString stringWithFormat:@"&attributes=%@", attributes];
-    [body appendData:[attrArgString dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&access_token=%@", token] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    if (!entityPath || [entityPath isEqualToString:@""])
-    {
-        ;
-    }
-    else
+    JRCaptureApidRequest *apidRequest = [JRCaptureApidRequest requestWithFinish:
+            ^(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload)
     {
-        NSString *attrNameArgString = [NSString stringWithFormat:@"&attribute_name=%@", entityPath];
-        [body appendData:[attrNameArgString dataUsingEncoding:NSUTF8StringEncoding]];
-    }
-
-    NSString *updateUrl = [NSString stringWithFormat:@"%@/entity.update",
-                                                     [JRCaptureData sharedCaptureData].captureBaseUrl];
-    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:updateUrl]];
-
-    [request setHTTPMethod:@"POST"];
-    [request setHTTPBody:body];
-
-    NSMutableDictionary *tag = [@{cTagAction : cUpdateObject, @"delegate" : delegate} mutableCopy];
-    [tag JR_maybeSetObject:context forKey:@"context"];
-
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
-    {
-        NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
-                                                       [[request URL] absoluteString]];
-        NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorUrlConnection];
-        NSDictionary *result = @{
-                @"stat" : @"error",
-                @"error" : @"url_connection",
-                @"error_description" : errDesc,
-                @"code" : errCode,
-        };
-        [self finishUpdateObjectWithStat:StatFail andResult:result forDelegate:delegate withContext:context];
-    }
+        [self finishUpdateObjectWithStat:stat andResult:result forDelegate:delegate withContext:context];
+    }];
 
+    [self sendEntityWriteToApiPath:cEntityUpdatePath attributes:writeAttributes entityPath:entityPath token:token
+                       apidRequest:apidRequest];
 }
 
 - (void)finishReplaceObjectWithStat:(CaptureInterfaceStat)stat andResult:(NSDictionary *)result
@@ -309,53 +747,20 @@ typedef enum CaptureInterfaceStatEnum
     }
 }
 
-- (void)replaceObject:(NSDictionary *)captureObject atPath:(NSString *)entityPath
-            withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
-          withContext:(NSObject *)context
+- (void)replaceObjectWithAttributes:(JRJsonWritingBlock)writeAttributes atPath:(NSString *)entityPath
+                          withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                        withContext:(NSObject *)context
 {
     DLog(@"");
 
-    NSString *attributes = [[captureObject JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSMutableData *body = [NSMutableData data];
-
-    [body appendData:[[NSString stringWithFormat:@"&attributes=%@", attributes] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&access_token=%@", token] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    if (!entityPath || [entityPath isEqualToString:@""])
-    {
-        ;
-    }
-    else
+    JRCaptureApidRequest *apidRequest = [JRCaptureApidRequest requestWithFinish:
+            ^(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload)
     {
-        NSString *argString = [NSString stringWithFormat:@"&attribute_name=%@", entityPath];
-        [body appendData:[argString dataUsingEncoding:NSUTF8StringEncoding]];        
-    }
-
-    NSString *replaceUrl = [NSString stringWithFormat:@"%@/entity.replace",
-                                                      [JRCaptureData sharedCaptureData].captureBaseUrl];
-    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:replaceUrl]];
-
-    [request setHTTPMethod:@"POST"];
-    [request setHTTPBody:body];
-
-    NSMutableDictionary *tag = [@{cTagAction : cReplaceObject, @"delegate" : delegate} mutableCopy];
-    [tag JR_maybeSetObject:context forKey:@"context"];
-
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
-    {
-        NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
-                                                      [[request URL] absoluteString]];
-        NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorUrlConnection];
-        NSDictionary *result = @{
-                @"stat" : @"error",
-                @"error" : @"url_connection",
-                @"error_description" : errDesc,
-                @"code" : errCode,
-        };
-        [self finishReplaceObjectWithStat:StatFail andResult:result forDelegate:delegate withContext:context];
-    }
+        [self finishReplaceObjectWithStat:stat andResult:result forDelegate:delegate withContext:context];
+    }];
 
+    [self sendEntityWriteToApiPath:cEntityReplacePath attributes:writeAttributes entityPath:entityPath token:token
+                       apidRequest:apidRequest];
 }
 
 - (void)finishReplaceArrayWithStat:(CaptureInterfaceStat)stat andResult:(NSDictionary *)result
@@ -374,54 +779,20 @@ typedef enum CaptureInterfaceStatEnum
     }
 }
 
-- (void)replaceArray:(NSArray *)captureArray atPath:(NSString *)entityPath
-           withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
-         withContext:(NSObject *)context
+- (void)replaceArrayWithAttributes:(JRJsonWritingBlock)writeAttributes atPath:(NSString *)entityPath
+                         withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                       withContext:(NSObject *)context
 {
     DLog(@"");
 
-    NSString *attributes = [[captureArray JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSMutableData *body = [NSMutableData data];
-
-    [body appendData:[[NSString stringWithFormat:@"&attributes=%@", attributes] 
-            dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&access_token=%@", token] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    if (entityPath && ![entityPath isEqualToString:@""])
-    {
-        NSString *argString = [NSString stringWithFormat:@"&attribute_name=%@", entityPath];
-        [body appendData:[argString dataUsingEncoding:NSUTF8StringEncoding]];
-    }
-
-    NSString *captureBaseUrl = [JRCaptureData sharedCaptureData].captureBaseUrl;
-    NSString *replaceUrl = [NSString stringWithFormat:@"%@/entity.replace", captureBaseUrl];
-    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:replaceUrl]];
-
-    [request setHTTPMethod:@"POST"];
-    [request setHTTPBody:body];
-
-    NSMutableDictionary *tag = [@{cTagAction : cReplaceArray, @"delegate" : delegate} mutableCopy];
-    [tag JR_maybeSetObject:context forKey:@"context"];
-
-    DLog(@"%@ attributes=%@ access_token=%@ attribute_name=%@", [[request URL] absoluteString], attributes, token,
-        entityPath);
-
-    /* tag vs context for workaround */
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag]) 
+    JRCaptureApidRequest *apidRequest = [JRCaptureApidRequest requestWithFinish:
+            ^(CaptureInterfaceStat stat, NSDictionary *result, NSData *payload)
     {
-        NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
-                                                       [[request URL] absoluteString]];
-        NSNumber *code = [NSNumber numberWithInteger:JRCaptureLocalApidErrorUrlConnection];
-        NSDictionary *result = @{
-                @"stat" : @"error",
-                @"error" : @"url_connection",
-                @"error_description" : errDesc,
-                @"code" : code,
-        };
-        [self finishReplaceArrayWithStat:StatFail andResult:result forDelegate:delegate withContext:context];
-    }
+        [self finishReplaceArrayWithStat:stat andResult:result forDelegate:delegate withContext:context];
+    }];
 
+    [self sendEntityWriteToApiPath:cEntityReplacePath attributes:writeAttributes entityPath:entityPath token:token
+                       apidRequest:apidRequest];
 }
 
 + (void)signInCaptureUserWithCredentials:(NSDictionary *)credentials ofType:(NSString *)signInType
@@ -446,90 +817,103 @@ typedef enum CaptureInterfaceStatEnum
 
 + (void)updateCaptureObject:(NSDictionary *)captureObject atPath:(NSString *)entityPath withToken:(NSString *)token
                 forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
+{
+    [JRCaptureApidInterface updateCaptureObjectWithAttributes:^(JRJsonFormWriter *writer)
+    {
+        [writer writeValue:captureObject];
+    } atPath:entityPath withToken:token forDelegate:delegate withContext:context];
+}
+
++ (void)updateCaptureObjectWithAttributes:(JRJsonWritingBlock)writeAttributes atPath:(NSString *)entityPath
+                                withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                              withContext:(NSObject *)context
 {
     [[JRCaptureApidInterface sharedCaptureApidInterface]
-            updateObject:captureObject atPath:entityPath withToken:token forDelegate:delegate withContext:context];
+            updateObjectWithAttributes:writeAttributes atPath:entityPath withToken:token forDelegate:delegate
+                           withContext:context];
 }
 
 + (void)replaceCaptureObject:(NSDictionary *)captureObject atPath:(NSString *)entityPath withToken:(NSString *)token
                  forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
+{
+    [JRCaptureApidInterface replaceCaptureObjectWithAttributes:^(JRJsonFormWriter *writer)
+    {
+        [writer writeValue:captureObject];
+    } atPath:entityPath withToken:token forDelegate:delegate withContext:context];
+}
+
++ (void)replaceCaptureObjectWithAttributes:(JRJsonWritingBlock)writeAttributes atPath:(NSString *)entityPath
+                                 withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                               withContext:(NSObject *)context
 {
     [[JRCaptureApidInterface sharedCaptureApidInterface]
-            replaceObject:captureObject atPath:entityPath withToken:token forDelegate:delegate
-              withContext:context];
+            replaceObjectWithAttributes:writeAttributes atPath:entityPath withToken:token forDelegate:delegate
+                            withContext:context];
 }
 
 + (void)replaceCaptureArray:(NSArray *)captureArray atPath:(NSString *)entityPath withToken:(NSString *)token
                 forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
 {
-    [[JRCaptureApidInterface sharedCaptureApidInterface]
-            replaceArray:captureArray atPath:entityPath withToken:token forDelegate:delegate withContext:context];
+    [JRCaptureApidInterface replaceCaptureArrayWithAttributes:^(JRJsonFormWriter *writer)
+    {
+        [writer writeValue:captureArray];
+    } atPath:entityPath withToken:token forDelegate:delegate withContext:context];
 }
 
-- (void)connectionDidFinishLoadingWithPayload:(NSString *)payload request:(NSURLRequest*)request andTag:(id)userData
++ (void)replaceCaptureArrayWithAttributes:(JRJsonWritingBlock)writeAttributes atPath:(NSString *)entityPath
+                                withToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                              withContext:(NSObject *)context
 {
-    DLog(@"%@", payload);
+    [[JRCaptureApidInterface sharedCaptureApidInterface]
+            replaceArrayWithAttributes:writeAttributes atPath:entityPath withToken:token forDelegate:delegate
+                           withContext:context];
+}
 
-    NSDictionary *tag       = (NSDictionary *) userData;
-    NSString     *action    = [tag objectForKey:cTagAction];
-    NSObject     *context   = [tag objectForKey:@"context"];
+- (void)connectionDidFinishLoadingWithFullResponse:(NSURLResponse*)fullResponse unencodedPayload:(NSData*)payload
+                                           request:(NSURLRequest*)request andTag:(id)userData
+{
+    JRCaptureApidRequest *apidRequest = userData;
+    NSDictionary *response = apidRequest.unparsedKey ?
+            [JRJsonReader dictionaryFromData:payload deferringKey:apidRequest.unparsedKey] :
+            [payload JR_objectFromJSONData];
+    CaptureInterfaceStat stat = [response isKindOfClass:[NSDictionary class]] && [response JR_isOKStatus] ?
+            StatOk : StatFail;
 
-    NSDictionary *response    = [payload JR_objectFromJSONString];
-    CaptureInterfaceStat stat = [[response objectForKey:@"stat"] isEqualToString:@"ok"] ? StatOk : StatFail;
+    JRCaptureApidRunOnMainThread(^
+    {
+        if (stat == StatFail && [self replayIfAccessTokenExpired:apidRequest result:response]) return;
 
-    id<JRCaptureInternalDelegate> delegate = [tag objectForKey:@"delegate"];
+        [self finishApidRequest:apidRequest withStat:stat result:response payload:payload];
+    });
+}
 
-    if ([action isEqualToString:cSignInUser])
-    {
-        [self finishSignInUserWithPayload:payload context:context response:response stat:stat delegate:delegate];
-    }
-    else if ([action isEqualToString:cGetUser])
-    {
-        [self finishGetCaptureUserWithStat:stat andResult:response forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cGetObject])
-    {
-        [self finishGetObjectWithStat:stat andResult:response forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cUpdateObject])
-    {
-        [self finishUpdateObjectWithStat:stat andResult:response forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cReplaceObject])
-    {
-        [self finishReplaceObjectWithStat:stat andResult:response forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cReplaceArray])
-    {
-        [self finishReplaceArrayWithStat:stat andResult:response forDelegate:delegate withContext:context];
-    }
+/* Only sent if the connection never got a response to go with its body */
+- (void)connectionDidFinishLoadingWithPayload:(NSString *)payload request:(NSURLRequest*)request andTag:(id)userData
+{
+    NSData *payloadData = [payload dataUsingEncoding:NSUTF8StringEncoding];
+    [self connectionDidFinishLoadingWithFullResponse:nil unencodedPayload:payloadData request:request andTag:userData];
 }
 
-- (void)finishSignInUserWithPayload:(NSString *)payload context:(NSObject *)context response:(NSDictionary *)response
+- (void)finishSignInUserWithPayload:(NSData *)payload context:(NSObject *)context response:(NSDictionary *)response
                                stat:(CaptureInterfaceStat)stat delegate:(id)delegate
 {
     if (stat == StatOk) {
         if ([delegate conformsToProtocol:@protocol(JRCaptureInternalDelegate)] &&
                 [delegate respondsToSelector:@selector(signInCaptureUserDidSucceedWithResult:context:)])
-            [delegate signInCaptureUserDidSucceedWithResult:payload context:context];
+        {
+            NSString *result = [[NSString alloc] initWithData:payload encoding:NSUTF8StringEncoding];
+            [delegate signInCaptureUserDidSucceedWithResult:result context:context];
+        }
     } else {
         JRCaptureError *error = [JRCaptureError errorFromResult:response onProvider:nil engageToken:nil];    
         [JRCaptureApidInterface finishSignInFailureWithError:error forDelegate:delegate withContext:context];
     }
 }
 
-- (void)connectionDidFinishLoadingWithFullResponse:(NSURLResponse*)fullResponse unencodedPayload:(NSData*)payload
-                                           request:(NSURLRequest*)request andTag:(id)userData { }
-
 - (void)connectionDidFailWithError:(NSError *)error request:(NSURLRequest*)request andTag:(id)userData
 {
     DLog(@"");
 
-    NSDictionary *tag       = (NSDictionary*) userData;
-    NSString     *action    = [tag objectForKey:cTagAction];
-    NSObject     *context   = [tag objectForKey:@"context"];
-    id<JRCaptureInternalDelegate> delegate = [tag objectForKey:@"delegate"];
-
     NSString *localizedFailureReason = [error localizedFailureReason];
     localizedFailureReason = localizedFailureReason ? localizedFailureReason : @"";
     NSDictionary *errDict = @{
@@ -540,32 +924,10 @@ typedef enum CaptureInterfaceStatEnum
             @"wrapped_error" : error,
     };
 
-    JRCaptureError *wrappingError = [JRCaptureError errorFromResult:errDict onProvider:nil engageToken:nil];
-
-    if ([action isEqualToString:cSignInUser])
+    JRCaptureApidRunOnMainThread(^
     {
-        [JRCaptureApidInterface finishSignInFailureWithError:wrappingError forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cGetUser])
-    {
-        [self finishGetCaptureUserWithStat:StatFail andResult:errDict forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cGetObject])
-    {
-        [self finishGetObjectWithStat:StatFail andResult:errDict forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cUpdateObject])
-    {
-        [self finishUpdateObjectWithStat:StatFail andResult:errDict forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cReplaceObject])
-    {
-        [self finishReplaceObjectWithStat:StatFail andResult:errDict forDelegate:delegate withContext:context];
-    }
-    else if ([action isEqualToString:cReplaceArray])
-    {
-        [self finishReplaceArrayWithStat:StatFail andResult:errDict forDelegate:delegate withContext:context];
-    }
+        [self finishApidRequest:userData withStat:StatFail result:errDict payload:nil];
+    });
 }
 
 + (NSMutableDictionary *)tradAuthParamsWithParams:(NSDictionary *)paramsDict refreshSecret:(NSString *)refreshSecret
@@ -621,23 +983,18 @@ typedef enum CaptureInterfaceStatEnum
 + (NSDictionary *)flowTraditionalSignInCredentialsForName:(NSString *)name andPassword:(NSString *)password {
     JRCaptureData *data = [JRCaptureData sharedCaptureData];
     JRCaptureFlow *captureFlow = [data captureFlow];
-    NSDictionary *fields = [captureFlow objectForKey:@"fields"];
     NSString *tradSignInFormName = [data captureTraditionalSignInFormName];
-    NSDictionary *tradSignInForm = [fields objectForKey:tradSignInFormName];
-    NSArray *tradSignInFields = [tradSignInForm objectForKey:@"fields"];
+    NSArray *tradSignInFields = [captureFlow fieldNamesForForm:tradSignInFormName];
 
     if ([tradSignInFields count] > 2) [NSException raiseJRDebugException:@"unsupportedFormException"
                                                                   format:@"the traditional sign-in form configured in"
                                                                           " your flow uses more than two fields, which"
                                                                           " is unsupported in the native clients."];
 
-    NSString *passwordFieldName = nil;
+    NSString *passwordFieldName = [captureFlow passwordFieldForForm:tradSignInFormName];
     NSString *anyOtherFieldName = nil;
     for (NSString *fieldName in tradSignInFields) {
-        NSDictionary *field = [fields objectForKey:fieldName];
-        NSString *type = [field objectForKey:@"type"];
-        if ([type isEqualToString:@"password"]) passwordFieldName = fieldName;
-        else anyOtherFieldName = fieldName;
+        if (![fieldName isEqual:passwordFieldName]) anyOtherFieldName = fieldName;
     }
 
     if (anyOtherFieldName && passwordFieldName && name && password) {
@@ -647,5 +1004,14 @@ typedef enum CaptureInterfaceStatEnum
     }
 }
 
-- (void)connectionWasStoppedWithTag:(id)userData { }
+- (void)connectionWasStoppedWithTag:(id)userData
+{
+    NSString *readKey = ((JRCaptureApidRequest *) userData).readKey;
+    if (!readKey) return;
+
+    JRCaptureApidRunOnMainThread(^
+    {
+        [self.inFlightReads removeObjectForKey:readKey];
+    });
+}
 @end
@@ -0,0 +1,146 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * The version of the archive format that JRCaptureArchiveWriter writes and JRCaptureArchiveReader reads. Archives of
+ * any other version are not read.
+ **/
+#define cJRCaptureArchiveVersion 1
+
+/**
+ * @brief Writes Capture objects to a compact binary archive
+ *
+ *  The generated Capture objects write themselves member by member, each under its schema key, so an archive can be
+ *  read back by a later schema that has gained or lost attributes. Each key is stored once, in a table at the end of
+ *  the archive, and members refer to it by index. Objects and arrays are prefixed with their length, so a reader can
+ *  skip any of them without reading what's inside.
+ **/
+@interface JRCaptureArchiveWriter : NSObject
+- (void)beginObject;
+- (void)writeKey:(NSString *)key;
+- (void)endObject;
+
+- (void)beginArray;
+- (void)endArray;
+
+- (void)writeNull;
+- (void)writeBool:(BOOL)value;
+
+/**
+ * Writes string, or null if string is nil
+ **/
+- (void)writeString:(NSString *)string;
+
+/**
+ * Writes the names in set, each as a reference to the key table
+ **/
+- (void)writeNameSet:(NSSet *)set;
+
+/**
+ * Writes an NSString, NSNumber or NSNull, or an NSDictionary or NSArray of those. nil is written as null.
+ **/
+- (void)writeValue:(id)value;
+
+/**
+ * Appends the key table and returns the archive. Nothing more can be written afterwards.
+ **/
+- (NSData *)finishedData;
+@end
+
+/**
+ * @brief Reads Capture objects back out of an archive written by JRCaptureArchiveWriter
+ *
+ *  Keys are handed out as bytes in the archive's key table, just as JRJsonReader hands them out, so generated objects
+ *  match them with JRJsonKeyHash and JRJsonKeyEquals. A reader over a memory-mapped file only touches the pages of the
+ *  values it reads. A malformed archive stops the reader and sets failed; from then on it is at the end of every object
+ *  and array, and reads nil.
+ **/
+@interface JRCaptureArchiveReader : NSObject
+
+/**
+ * \c YES once a malformed archive has been read
+ **/
+@property(readonly) BOOL failed;
+
+/**
+ * Returns nil if data isn't an archive of cJRCaptureArchiveVersion
+ **/
+- (id)initWithData:(NSData *)data;
+
+/**
+ * A reader that skips every member of the top-level object that isn't named in keys, as if the archive didn't have
+ * them, or reads every member if keys is nil. Returns nil if data isn't an archive of cJRCaptureArchiveVersion.
+ **/
+- (id)initWithData:(NSData *)data keys:(NSSet *)keys;
+
+/**
+ * A reader over the memory-mapped contents of the file at path, or nil if it can't be mapped or isn't an archive
+ **/
++ (id)readerWithContentsOfFile:(NSString *)path keys:(NSSet *)keys;
+
+/**
+ * Enters the object that is the next value and returns \c YES, or skips the next value and returns \c NO if it isn't
+ * an object
+ **/
+- (BOOL)beginObject;
+
+/**
+ * Returns the next member's key and sets length to its length in bytes, or returns \c NULL once the object is done.
+ * The key isn't NUL-terminated.
+ **/
+- (const char *)nextKey:(size_t *)length;
+
+/**
+ * Enters the array that is the next value and returns \c YES, or skips the next value and returns \c NO if it isn't
+ * an array
+ **/
+- (BOOL)beginArray;
+
+/**
+ * \c YES if the array has another element to read, \c NO once it is done
+ **/
+- (BOOL)nextElement;
+
+/**
+ * Reads the next value as an NSString, NSNumber, NSNull, or an NSDictionary or NSArray of those
+ **/
+- (id)readValue;
+- (void)skipValue;
+
+/**
+ * Reads the next value as a string, or nil if it is null or not a string
+ **/
+- (NSString *)readString;
+- (BOOL)readBool;
+- (NSSet *)readNameSet;
+@end
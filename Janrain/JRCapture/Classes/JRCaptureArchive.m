@@ -0,0 +1,744 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRCaptureArchive.h"
+
+/*
+ * An archive is a header, the top-level value, and the key table:
+ *
+ *   header     'J' 'R' 'C' 'A', the version, and the key table's offset as 4 bytes, little-endian
+ *   value      a tag, followed by
+ *                null, false, true  nothing
+ *                integer            the zigzag-encoded value as a varint
+ *                double             8 bytes, little-endian
+ *                string             the length in bytes as a varint, and the UTF-8 bytes
+ *                object             the length of the rest as 4 bytes, the members, each a varint of 1 + the index of
+ *                                   its key followed by its value, and a 0
+ *                array              the length of the rest as 4 bytes, the elements, and an end tag
+ *                name set           the count as a varint, and the key index of each name as a varint
+ *   key table  the count as a varint, and each key as its length in bytes as a varint and its UTF-8 bytes
+ */
+typedef enum
+{
+    JRArchiveTagNull,
+    JRArchiveTagFalse,
+    JRArchiveTagTrue,
+    JRArchiveTagInteger,
+    JRArchiveTagDouble,
+    JRArchiveTagString,
+    JRArchiveTagObject,
+    JRArchiveTagArray,
+    JRArchiveTagNameSet,
+    JRArchiveTagEnd = 0xFF,
+} JRArchiveTag;
+
+static const uint8_t cJRArchiveMagic[4] = { 'J', 'R', 'C', 'A' };
+#define cJRArchiveKeyTableOffsetAt 5
+#define cJRArchiveHeaderLength     9
+
+static inline uint32_t JRArchiveReadUInt32(const uint8_t *bytes)
+{
+    return bytes[0] | (uint32_t) bytes[1] << 8 | (uint32_t) bytes[2] << 16 | (uint32_t) bytes[3] << 24;
+}
+
+@implementation JRCaptureArchiveWriter
+{
+    NSMutableData *_data;
+    NSMutableDictionary *_keyIndexes;
+    NSMutableArray *_keys;
+    NSUInteger *_containerStarts;
+    NSUInteger _depth;
+    NSUInteger _depthCapacity;
+}
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        _data = [NSMutableData dataWithCapacity:4096];
+        _keyIndexes = [NSMutableDictionary dictionary];
+        _keys = [NSMutableArray array];
+
+        uint8_t version = cJRCaptureArchiveVersion;
+        [_data appendBytes:cJRArchiveMagic length:sizeof(cJRArchiveMagic)];
+        [_data appendBytes:&version length:1];
+        [_data increaseLengthBy:4];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_containerStarts);
+}
+
+- (void)appendByte:(uint8_t)byte
+{
+    [_data appendBytes:&byte length:1];
+}
+
+- (void)appendVarint:(uint64_t)value
+{
+    uint8_t bytes[10];
+    NSUInteger count = 0;
+    while (value >= 0x80)
+    {
+        bytes[count++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    bytes[count++] = (uint8_t) value;
+
+    [_data appendBytes:bytes length:count];
+}
+
+- (void)setUInt32:(uint32_t)value at:(NSUInteger)offset
+{
+    uint8_t bytes[4] = { (uint8_t) value, (uint8_t) (value >> 8), (uint8_t) (value >> 16), (uint8_t) (value >> 24) };
+    [_data replaceBytesInRange:NSMakeRange(offset, 4) withBytes:bytes];
+}
+
+- (void)appendStringBytes:(NSString *)string
+{
+    NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    [self appendVarint:length];
+
+    NSUInteger offset = [_data length];
+    [_data increaseLengthBy:length];
+    [string getBytes:(uint8_t *) [_data mutableBytes] + offset maxLength:length usedLength:NULL
+            encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, [string length]) remainingRange:NULL];
+}
+
+- (NSUInteger)indexOfKey:(NSString *)key
+{
+    NSNumber *index = [_keyIndexes objectForKey:key];
+    if (!index)
+    {
+        index = [NSNumber numberWithUnsignedInteger:[_keys count]];
+        [_keys addObject:key];
+        [_keyIndexes setObject:index forKey:key];
+    }
+
+    return [index unsignedIntegerValue];
+}
+
+- (void)beginContainer:(JRArchiveTag)tag
+{
+    if (_depth == _depthCapacity)
+    {
+        _depthCapacity = MAX(16, _depthCapacity * 2);
+        _containerStarts = realloc(_containerStarts, _depthCapacity * sizeof(NSUInteger));
+    }
+
+    [self appendByte:tag];
+    _containerStarts[_depth++] = [_data length];
+    [_data increaseLengthBy:4];
+}
+
+- (void)endContainer:(uint8_t)terminator
+{
+    if (!_depth)
+    {
+        DLog(@"ended a container that wasn't begun");
+        return;
+    }
+
+    [self appendByte:terminator];
+    NSUInteger start = _containerStarts[--_depth];
+    [self setUInt32:(uint32_t) ([_data length] - start - 4) at:start];
+}
+
+- (void)beginObject
+{
+    [self beginContainer:JRArchiveTagObject];
+}
+
+- (void)writeKey:(NSString *)key
+{
+    [self appendVarint:[self indexOfKey:key] + 1];
+}
+
+- (void)endObject
+{
+    [self endContainer:0];
+}
+
+- (void)beginArray
+{
+    [self beginContainer:JRArchiveTagArray];
+}
+
+- (void)endArray
+{
+    [self endContainer:JRArchiveTagEnd];
+}
+
+- (void)writeNull
+{
+    [self appendByte:JRArchiveTagNull];
+}
+
+- (void)writeBool:(BOOL)value
+{
+    [self appendByte:value ? JRArchiveTagTrue : JRArchiveTagFalse];
+}
+
+- (void)writeString:(NSString *)string
+{
+    if (!string)
+    {
+        [self writeNull];
+        return;
+    }
+
+    [self appendByte:JRArchiveTagString];
+    [self appendStringBytes:string];
+}
+
+- (void)writeNameSet:(NSSet *)set
+{
+    [self appendByte:JRArchiveTagNameSet];
+    [self appendVarint:[set count]];
+    for (NSString *name in set)
+        [self appendVarint:[self indexOfKey:name]];
+}
+
+- (void)writeNumber:(NSNumber *)number
+{
+    if (CFGetTypeID((__bridge CFTypeRef) number) == CFBooleanGetTypeID())
+    {
+        [self writeBool:[number boolValue]];
+        return;
+    }
+
+    const char *type = [number objCType];
+    if (*type == 'f' || *type == 'd' || (*type == 'Q' && [number unsignedLongLongValue] > LLONG_MAX))
+    {
+        double value = [number doubleValue];
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        bits = CFSwapInt64HostToLittle(bits);
+
+        [self appendByte:JRArchiveTagDouble];
+        [_data appendBytes:&bits length:sizeof(bits)];
+        return;
+    }
+
+    int64_t value = [number longLongValue];
+    [self appendByte:JRArchiveTagInteger];
+    [self appendVarint:((uint64_t) value << 1) ^ (uint64_t) (value >> 63)];
+}
+
+- (void)writeValue:(id)value
+{
+    if ([value isKindOfClass:[NSString class]])
+    {
+        [self writeString:value];
+    }
+    else if ([value isKindOfClass:[NSNumber class]])
+    {
+        [self writeNumber:value];
+    }
+    else if ([value isKindOfClass:[NSDictionary class]])
+    {
+        [self beginObject];
+        for (id key in value)
+        {
+            [self writeKey:[key isKindOfClass:[NSString class]] ? key : [key description]];
+            [self writeValue:[value objectForKey:key]];
+        }
+        [self endObject];
+    }
+    else if ([value isKindOfClass:[NSArray class]])
+    {
+        [self beginArray];
+        for (id element in value)
+            [self writeValue:element];
+        [self endArray];
+    }
+    else
+    {
+        if (value && value != [NSNull null]) DLog(@"can't archive a %@, writing null instead", [value class]);
+        [self writeNull];
+    }
+}
+
+- (NSData *)finishedData
+{
+    if (_depth) DLog(@"finished with %lu containers still open", (unsigned long) _depth);
+
+    NSUInteger keyTableOffset = [_data length];
+    [self appendVarint:[_keys count]];
+    for (NSString *key in _keys)
+        [self appendStringBytes:key];
+    [self setUInt32:(uint32_t) keyTableOffset at:cJRArchiveKeyTableOffsetAt];
+
+    NSData *data = _data;
+    _data = nil;
+
+    return data;
+}
+@end
+
+typedef struct
+{
+    const char *bytes;
+    size_t length;
+} JRArchiveKey;
+
+@implementation JRCaptureArchiveReader
+{
+    NSData *_data;
+    const uint8_t *_bytes;
+    size_t _length;
+    size_t _position;
+    NSUInteger _depth;
+    NSUInteger _keyCount;
+    JRArchiveKey *_keys;
+    NSArray *_keyStrings;
+    BOOL *_skippedKeys;
+}
+@synthesize failed = _failed;
+
+- (id)initWithData:(NSData *)data
+{
+    return [self initWithData:data keys:nil];
+}
+
+- (id)initWithData:(NSData *)data keys:(NSSet *)keys
+{
+    if ((self = [super init]))
+    {
+        _data = data;
+        _bytes = [data bytes];
+        _length = [data length];
+
+        if (_length < cJRArchiveHeaderLength || memcmp(_bytes, cJRArchiveMagic, sizeof(cJRArchiveMagic)) != 0)
+        {
+            DLog(@"not a Capture archive");
+            return nil;
+        }
+
+        if (_bytes[sizeof(cJRArchiveMagic)] != cJRCaptureArchiveVersion)
+        {
+            DLog(@"can't read a version %d Capture archive", _bytes[sizeof(cJRArchiveMagic)]);
+            return nil;
+        }
+
+        size_t keyTableOffset = JRArchiveReadUInt32(_bytes + cJRArchiveKeyTableOffsetAt);
+        if (keyTableOffset < cJRArchiveHeaderLength || keyTableOffset > _length)
+        {
+            DLog(@"malformed Capture archive");
+            return nil;
+        }
+
+        if (![self readKeyTableAt:keyTableOffset skippingAllBut:keys])
+            return nil;
+
+        _position = cJRArchiveHeaderLength;
+        _length = keyTableOffset;
+    }
+
+    return self;
+}
+
++ (id)readerWithContentsOfFile:(NSString *)path keys:(NSSet *)keys
+{
+    NSError *error = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:&error];
+    if (!data)
+    {
+        DLog(@"couldn't map %@: %@", path, error);
+        return nil;
+    }
+
+    return [[self alloc] initWithData:data keys:keys];
+}
+
+- (void)dealloc
+{
+    free(_keys);
+    free(_skippedKeys);
+}
+
+- (void)fail
+{
+    if (!_failed) DLog(@"malformed Capture archive at byte %lu", (unsigned long) _position);
+    _failed = YES;
+    _position = _length;
+}
+
+- (BOOL)advance:(uint64_t)count
+{
+    if (count > _length - _position)
+    {
+        [self fail];
+        return NO;
+    }
+
+    _position += count;
+    return YES;
+}
+
+- (uint64_t)readVarint
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64 && _position < _length; shift += 7)
+    {
+        uint8_t byte = _bytes[_position++];
+        value |= (uint64_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+
+    [self fail];
+    return 0;
+}
+
+- (uint32_t)readUInt32
+{
+    if (_length - _position < 4)
+    {
+        [self fail];
+        return 0;
+    }
+
+    uint32_t value = JRArchiveReadUInt32(_bytes + _position);
+    _position += 4;
+    return value;
+}
+
+- (BOOL)readKeyTableAt:(size_t)offset skippingAllBut:(NSSet *)keys
+{
+    _position = offset;
+    uint64_t count = [self readVarint];
+    if (count > _length - _position)
+        [self fail];
+    if (_failed)
+        return NO;
+
+    _keyCount = (NSUInteger) count;
+    _keys = calloc(MAX(_keyCount, 1), sizeof(JRArchiveKey));
+    if (keys)
+        _skippedKeys = calloc(MAX(_keyCount, 1), sizeof(BOOL));
+
+    NSMutableArray *keyStrings = [NSMutableArray arrayWithCapacity:_keyCount];
+    for (NSUInteger i = 0; i < _keyCount; i++)
+    {
+        uint64_t length = [self readVarint];
+        const uint8_t *bytes = _bytes + _position;
+        if (![self advance:length])
+            return NO;
+
+        NSString *key = [[NSString alloc] initWithBytes:bytes length:(NSUInteger) length
+                                               encoding:NSUTF8StringEncoding];
+        if (!key)
+        {
+            [self fail];
+            return NO;
+        }
+
+        _keys[i].bytes = (const char *) bytes;
+        _keys[i].length = (size_t) length;
+        [keyStrings addObject:key];
+        if (keys)
+            _skippedKeys[i] = ![keys containsObject:key];
+    }
+
+    _keyStrings = keyStrings;
+    return YES;
+}
+
+/**
+ * Enters the container that is the next value if it is one of type tag
+ */
+- (BOOL)beginContainer:(JRArchiveTag)tag
+{
+    if (_position >= _length || _bytes[_position] != tag)
+    {
+        [self skipValue];
+        return NO;
+    }
+
+    _position++;
+    if (![self advance:4])
+        return NO;
+
+    _depth++;
+    return YES;
+}
+
+- (BOOL)beginObject
+{
+    return [self beginContainer:JRArchiveTagObject];
+}
+
+/**
+ * The index of the next member's key, or -1 once the object is done
+ */
+- (NSInteger)nextKeyIndex
+{
+    while (!_failed)
+    {
+        uint64_t index = [self readVarint];
+        if (index == 0)
+            break;
+
+        if (index > _keyCount)
+        {
+            [self fail];
+            break;
+        }
+
+        if (_depth == 1 && _skippedKeys && _skippedKeys[index - 1])
+        {
+            [self skipValue];
+            continue;
+        }
+
+        return (NSInteger) index - 1;
+    }
+
+    if (_depth) _depth--;
+    return -1;
+}
+
+- (const char *)nextKey:(size_t *)length
+{
+    NSInteger index = [self nextKeyIndex];
+    if (index < 0)
+        return NULL;
+
+    *length = _keys[index].length;
+    return _keys[index].bytes;
+}
+
+- (BOOL)beginArray
+{
+    return [self beginContainer:JRArchiveTagArray];
+}
+
+- (BOOL)nextElement
+{
+    if (_position >= _length)
+        [self fail];
+
+    if (_failed || _bytes[_position] == JRArchiveTagEnd)
+    {
+        if (!_failed) _position++;
+        if (_depth) _depth--;
+        return NO;
+    }
+
+    return YES;
+}
+
+- (id)readValue
+{
+    if (_position >= _length)
+    {
+        [self fail];
+        return nil;
+    }
+
+    switch (_bytes[_position])
+    {
+        case JRArchiveTagNull:
+            _position++;
+            return [NSNull null];
+
+        case JRArchiveTagFalse:
+        case JRArchiveTagTrue:
+            return [NSNumber numberWithBool:[self readBool]];
+
+        case JRArchiveTagInteger:
+        {
+            _position++;
+            uint64_t zigzag = [self readVarint];
+            return _failed ? nil : [NSNumber numberWithLongLong:(int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1)];
+        }
+
+        case JRArchiveTagDouble:
+        {
+            _position++;
+            uint64_t bits;
+            const uint8_t *bytes = _bytes + _position;
+            if (![self advance:sizeof(bits)])
+                return nil;
+
+            memcpy(&bits, bytes, sizeof(bits));
+            bits = CFSwapInt64LittleToHost(bits);
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            return [NSNumber numberWithDouble:value];
+        }
+
+        case JRArchiveTagString:
+            return [self readString];
+
+        case JRArchiveTagObject:
+        {
+            [self beginObject];
+            NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+            NSInteger index;
+            while ((index = [self nextKeyIndex]) >= 0)
+            {
+                id value = [self readValue];
+                if (value)
+                    [dictionary setObject:value forKey:[_keyStrings objectAtIndex:(NSUInteger) index]];
+            }
+
+            return _failed ? nil : dictionary;
+        }
+
+        case JRArchiveTagArray:
+        {
+            [self beginArray];
+            NSMutableArray *array = [NSMutableArray array];
+            while ([self nextElement])
+            {
+                id value = [self readValue];
+                if (value)
+                    [array addObject:value];
+            }
+
+            return _failed ? nil : array;
+        }
+
+        default:
+            [self fail];
+            return nil;
+    }
+}
+
+- (void)skipValue
+{
+    if (_position >= _length)
+    {
+        [self fail];
+        return;
+    }
+
+    switch (_bytes[_position++])
+    {
+        case JRArchiveTagNull:
+        case JRArchiveTagFalse:
+        case JRArchiveTagTrue:
+            break;
+
+        case JRArchiveTagInteger:
+            [self readVarint];
+            break;
+
+        case JRArchiveTagDouble:
+            [self advance:8];
+            break;
+
+        case JRArchiveTagString:
+            [self advance:[self readVarint]];
+            break;
+
+        case JRArchiveTagObject:
+        case JRArchiveTagArray:
+            [self advance:[self readUInt32]];
+            break;
+
+        case JRArchiveTagNameSet:
+            for (uint64_t count = [self readVarint]; count && !_failed; count--)
+                [self readVarint];
+            break;
+
+        default:
+            [self fail];
+    }
+}
+
+- (NSString *)readString
+{
+    if (_position >= _length || _bytes[_position] != JRArchiveTagString)
+    {
+        [self skipValue];
+        return nil;
+    }
+
+    _position++;
+    uint64_t length = [self readVarint];
+    const uint8_t *bytes = _bytes + _position;
+    if (![self advance:length])
+        return nil;
+
+    NSString *string = [[NSString alloc] initWithBytes:bytes length:(NSUInteger) length
+                                              encoding:NSUTF8StringEncoding];
+    if (!string)
+        [self fail];
+
+    return string;
+}
+
+- (BOOL)readBool
+{
+    if (_position < _length && (_bytes[_position] == JRArchiveTagTrue || _bytes[_position] == JRArchiveTagFalse))
+        return _bytes[_position++] == JRArchiveTagTrue;
+
+    [self skipValue];
+    return NO;
+}
+
+- (NSSet *)readNameSet
+{
+    if (_position >= _length || _bytes[_position] != JRArchiveTagNameSet)
+    {
+        [self skipValue];
+        return nil;
+    }
+
+    _position++;
+    uint64_t count = [self readVarint];
+    if (count > _length - _position)
+    {
+        [self fail];
+        return nil;
+    }
+
+    NSMutableSet *set = [NSMutableSet setWithCapacity:(NSUInteger) count];
+    for (; count && !_failed; count--)
+    {
+        uint64_t index = [self readVarint];
+        if (index >= _keyCount)
+            [self fail];
+        else
+            [set addObject:[_keyStrings objectAtIndex:(NSUInteger) index]];
+    }
+
+    return _failed ? nil : set;
+}
+@end
@@ -33,6 +33,11 @@
 @class JRCaptureConfig;
 @class JRCaptureFlow;
 
+/**
+ * Posted, on the thread that changed it, whenever the access token is stored or cleared
+ */
+FOUNDATION_EXPORT NSString *const JRCaptureAccessTokenDidChangeNotification;
+
 /**
  * @internal
  */
@@ -42,6 +47,16 @@
 @property(nonatomic, readonly) NSString *captureRedirectUri;
 @property(nonatomic, readonly) NSString *clientId;
 @property(nonatomic, readonly) NSString *accessToken;
+
+/**
+ * When the access token was stored, or nil if its lifetime is unknown
+ */
+@property(nonatomic, readonly) NSDate *accessTokenDate;
+
+/**
+ * How long the access token lasts from accessTokenDate, as the response it came in said; 0 if it didn't say
+ */
+@property(nonatomic, readonly) NSTimeInterval accessTokenLifetime;
 @property(nonatomic, readonly) NSString *refreshSecret;
 @property(nonatomic, readonly) NSString *captureLocale;
 @property(nonatomic, readonly) NSString *captureTraditionalSignInFormName;
@@ -60,6 +75,13 @@
 
 + (void)setAccessToken:(NSString *)token;
 
+/**
+ * Stores the token and starts tracking its age. expiresIn is the "expires_in" of the response the token came in;
+ * if it isn't a positive number the token's lifetime is unknown, and it's only refreshed once Capture says it has
+ * expired.
+ */
++ (void)setAccessToken:(NSString *)token expiresIn:(id)expiresIn;
+
 + (void)setCaptureRedirectUri:(NSString *)redirectUri;
 
 + (void)setCaptureConfig:(JRCaptureConfig *)config;
@@ -84,8 +106,24 @@
 
 - (NSString *)downloadedFlowVersion;
 
+- (NSTimeInterval)accessTokenAge;
+
+/**
+ * NO while the token's age is unknown
+ */
+- (BOOL)accessTokenIsExpired;
+
+/**
+ * When to refresh the access token so that it's replaced before it expires: five minutes before then, or a quarter
+ * of its lifetime for short-lived tokens. nil while the token's age is unknown.
+ */
+- (NSDate *)accessTokenRefreshDate;
+
 - (NSString *)redirectUri;
 
+/**
+ * Reads the flow from the flow cache now, rather than when it's first used
+ */
 - (void)loadFlow;
 
 - (NSString *)getForgottenPasswordFieldName;
@@ -28,6 +28,8 @@
  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#define JR_LOG_CATEGORY JRLogCategoryCapture
+
 #import "debug_log.h"
 #import "JRCaptureData.h"
 #import "SFHFKeychainUtils.h"
@@ -37,6 +39,7 @@
 #import "JRCaptureFlow.h"
 #import "JRCaptureError.h"
 #import "JRCapture.h"
+#import "JRConnectionManager.h"
 
 #define cJRCaptureKeychainIdentifier @"capture_tokens.janrain"
 #define cJRCaptureKeychainUserName @"capture_user"
@@ -69,11 +72,28 @@ typedef enum
     JRTokenTypeRefresh,
 } JRTokenType;
 
+/* When the access token was stored and how long it lasts, kept next to it in the user defaults */
+static NSString *const ACCESS_TOKEN_DATE_KEY = @"JR_capture_access_token_date";
+static NSString *const ACCESS_TOKEN_LIFETIME_KEY = @"JR_capture_access_token_lifetime";
+
+/* At most how long before access tokens expire they're refreshed */
+static const NSTimeInterval cJRAccessTokenRefreshMargin = 300;
+
+NSString *const JRCaptureAccessTokenDidChangeNotification = @"JRCaptureAccessTokenDidChangeNotification";
+
+/* Where the flow used to be kept, archived into the user defaults; only read now, to move it to the flow cache */
 static NSString *const FLOW_KEY = @"JR_capture_flow";
 
+/* The flow cache: the flow's JSON as it was downloaded, and the URL and validators it was downloaded with */
+static NSString *const FLOW_CACHE_DIRECTORY = @"JRCapture";
+static NSString *const FLOW_CACHE_FILE = @"flow.json";
+static NSString *const FLOW_CACHE_INFO_FILE = @"flow.plist";
+
 @interface JRCaptureData ()
 
 @property(nonatomic) NSString *accessToken;
+@property(nonatomic) NSDate *accessTokenDate;
+@property(nonatomic) NSTimeInterval accessTokenLifetime;
 @property(nonatomic) NSString *refreshSecret;
 
 @property(nonatomic) NSString *captureBaseUrl;
@@ -99,6 +119,7 @@ static NSString *const FLOW_KEY = @"JR_capture_flow";
 @property(nonatomic) NSString *engageAppUrl;
 
 @property(nonatomic) JRCaptureFlow *captureFlow;
+@property(nonatomic) BOOL flowLoadPending;
 @property(nonatomic) NSArray *linkedProfiles;
 @property(nonatomic) BOOL initialized;
 @property(nonatomic) BOOL socialSignMode;
@@ -110,6 +131,8 @@ static JRCaptureData *singleton = nil;
 @synthesize clientId;
 @synthesize captureBaseUrl;
 @synthesize accessToken;
+@synthesize accessTokenDate;
+@synthesize accessTokenLifetime;
 @synthesize refreshSecret;
 @synthesize captureLocale;
 @synthesize captureTraditionalSignInFormName;
@@ -133,6 +156,11 @@ static JRCaptureData *singleton = nil;
     {
         self.accessToken = [self readTokenForTokenName:@"access_token"];
         self.refreshSecret = [self readTokenForTokenName:@"refresh_secret"];
+
+        NSUserDefaults *defaults = [NSUserDefaults standardUserDefaults];
+        self.accessTokenLifetime = [defaults doubleForKey:ACCESS_TOKEN_LIFETIME_KEY];
+        if (self.accessToken && self.accessTokenLifetime)
+            self.accessTokenDate = [defaults objectForKey:ACCESS_TOKEN_DATE_KEY];
     }
 
     return self;
@@ -221,7 +249,7 @@ static JRCaptureData *singleton = nil;
 
 - (NSString *)downloadedFlowVersion
 {
-    id version = [captureFlow objectForKey:@"version"];
+    id version = [self.captureFlow objectForKey:@"version"];
     if ([version isKindOfClass:[NSString class]]) return version;
     ALog(@"Error parsing flow version: %@", version);
     return nil;
@@ -261,18 +289,137 @@ static JRCaptureData *singleton = nil;
     if ([captureDataInstance.captureLocale length] &&
             [captureDataInstance.captureFlowName length] && [captureDataInstance.captureAppId length])
     {
-        [captureDataInstance loadFlow];
+        /* The cached flow is read the first time it's needed, rather than here at launch */
+        captureDataInstance.flowLoadPending = YES;
         [captureDataInstance downloadFlow];
     }
 }
 
+- (JRCaptureFlow *)captureFlow
+{
+    @synchronized (self)
+    {
+        if (self.flowLoadPending) [self loadFlow];
+        return captureFlow;
+    }
+}
+
+- (void)setCaptureFlow:(JRCaptureFlow *)flow
+{
+    @synchronized (self)
+    {
+        self.flowLoadPending = NO;
+        captureFlow = flow;
+    }
+}
+
++ (NSString *)flowCachePathForFile:(NSString *)fileName
+{
+    NSString *supportDirectory = [NSSearchPathForDirectoriesInDomains(NSApplicationSupportDirectory, NSUserDomainMask,
+                                                                      YES) objectAtIndex:0];
+    return [[supportDirectory stringByAppendingPathComponent:FLOW_CACHE_DIRECTORY]
+            stringByAppendingPathComponent:fileName];
+}
+
 - (void)loadFlow
 {
-    NSDictionary *flowDict =
-            [NSKeyedUnarchiver unarchiveObjectWithData:[[NSUserDefaults standardUserDefaults] objectForKey:FLOW_KEY]];
+    NSDictionary *flowDict = nil;
+    NSString *path = [JRCaptureData flowCachePathForFile:FLOW_CACHE_FILE];
+    NSData *flowData = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:nil];
+
+    if (flowData)
+    {
+        flowDict = [NSJSONSerialization JSONObjectWithData:flowData options:(NSJSONReadingOptions) 0 error:nil];
+        if (![flowDict isKindOfClass:[NSDictionary class]])
+        {
+            ALog(@"Discarding unreadable cached flow at %@", path);
+            flowDict = nil;
+            [JRCaptureData removeCachedFlow];
+        }
+    }
+    else if ([[NSUserDefaults standardUserDefaults] objectForKey:FLOW_KEY])
+    {
+        flowDict = [NSKeyedUnarchiver unarchiveObjectWithData:
+                [[NSUserDefaults standardUserDefaults] objectForKey:FLOW_KEY]];
+        if ([flowDict isKindOfClass:[NSDictionary class]] && [NSJSONSerialization isValidJSONObject:flowDict])
+            [JRCaptureData writeFlowData:[NSJSONSerialization dataWithJSONObject:flowDict options:0 error:nil]
+                                  forUrl:nil response:nil];
+        [[NSUserDefaults standardUserDefaults] removeObjectForKey:FLOW_KEY];
+    }
+
     self.captureFlow = [JRCaptureFlow flowWithDictionary:flowDict];
 }
 
++ (void)removeCachedFlow
+{
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    [fileManager removeItemAtPath:[self flowCachePathForFile:FLOW_CACHE_INFO_FILE] error:nil];
+    [fileManager removeItemAtPath:[self flowCachePathForFile:FLOW_CACHE_FILE] error:nil];
+}
+
+/**
+ * Keeps the flow's JSON as it came, along with the URL it came from and its ETag and Last-Modified headers, so the
+ * next download can ask for it only if it has changed
+ */
++ (void)writeFlowData:(NSData *)flowData forUrl:(NSString *)url response:(NSHTTPURLResponse *)response
+{
+    NSString *path = [self flowCachePathForFile:FLOW_CACHE_FILE];
+    NSString *directory = [path stringByDeletingLastPathComponent];
+    NSError *error = nil;
+
+    if (![[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES
+                                                     attributes:nil error:&error])
+    {
+        ALog(@"Couldn't create the flow cache directory %@: %@", directory, error);
+        return;
+    }
+    [[NSURL fileURLWithPath:directory] setResourceValue:@YES forKey:NSURLIsExcludedFromBackupKey error:nil];
+
+    /* The info goes first, so that a flow written without it is never paired with another flow's validators */
+    NSMutableDictionary *info = [NSMutableDictionary dictionary];
+    if (url) [info setObject:url forKey:@"url"];
+    NSDictionary *headers = [response allHeaderFields];
+    for (NSString *header in headers)
+    {
+        if ([header caseInsensitiveCompare:@"ETag"] == NSOrderedSame)
+            [info setObject:[headers objectForKey:header] forKey:@"etag"];
+        else if ([header caseInsensitiveCompare:@"Last-Modified"] == NSOrderedSame)
+            [info setObject:[headers objectForKey:header] forKey:@"lastModified"];
+    }
+
+    if (![info writeToFile:[self flowCachePathForFile:FLOW_CACHE_INFO_FILE] atomically:YES] ||
+            ![flowData writeToFile:path options:NSDataWritingAtomic error:&error])
+    {
+        ALog(@"Couldn't write the flow cache: %@", error);
+        [self removeCachedFlow];
+    }
+}
+
+/**
+ * The ETag and Last-Modified of the cached flow, if it was downloaded from url
+ */
++ (NSDictionary *)cachedFlowValidatorsForUrl:(NSString *)url
+{
+    NSDictionary *info = [NSDictionary dictionaryWithContentsOfFile:[self flowCachePathForFile:FLOW_CACHE_INFO_FILE]];
+    if (![[info objectForKey:@"url"] isEqual:url]) return nil;
+    if (![[NSFileManager defaultManager] fileExistsAtPath:[self flowCachePathForFile:FLOW_CACHE_FILE]]) return nil;
+    return info;
+}
+
++ (NSOperationQueue *)flowQueue
+{
+    static NSOperationQueue *queue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        queue = [[NSOperationQueue alloc] init];
+        queue.name = @"com.janrain.capture.flow";
+        queue.maxConcurrentOperationCount = 1;
+    });
+
+    return queue;
+}
+
 - (NSString *)getForgottenPasswordFieldName {
     if (!self.captureForgottenPasswordFormName) {
         [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
@@ -303,33 +450,65 @@ static JRCaptureData *singleton = nil;
     NSMutableURLRequest *downloadRequest = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:flowUrlString]];
     [downloadRequest setValue:@"gzip" forHTTPHeaderField:@"Accept-Encoding"];
 
-    [NSURLConnection
+    /* Revalidate what's in the flow cache instead of downloading it again; the 304 has to reach us, not NSURLCache */
+    NSDictionary *validators = [JRCaptureData cachedFlowValidatorsForUrl:flowUrlString];
+    if ([validators objectForKey:@"etag"] || [validators objectForKey:@"lastModified"])
+    {
+        [downloadRequest setCachePolicy:NSURLRequestReloadIgnoringLocalCacheData];
+        if ([validators objectForKey:@"etag"])
+            [downloadRequest setValue:[validators objectForKey:@"etag"] forHTTPHeaderField:@"If-None-Match"];
+        if ([validators objectForKey:@"lastModified"])
+            [downloadRequest setValue:[validators objectForKey:@"lastModified"]
+                   forHTTPHeaderField:@"If-Modified-Since"];
+    }
+
+    /* The flow is parsed and indexed on the flow queue; only the result is handed to the main queue */
+    [JRConnectionManager
        sendAsynchronousRequest:downloadRequest
-                         queue:[NSOperationQueue mainQueue]
+                         queue:[JRCaptureData flowQueue]
              completionHandler:^(NSURLResponse *r, NSData *d, NSError *e)
              {
-                 /*
-                  * "Notification Centers" @ developer.apple.com
-                  * A notification center delivers notifications to observers synchronously. In other words,
-                  * when posting a notification, control does not return to the poster until all observers
-                  * have received and processed the notification. To send notifications asynchronously use
-                  * a notification queue, which is described in “Notification Queues.”
-                  */
+                 NSError *error = e;
+                 JRCaptureFlow *flow = nil;
                  if (e)
                  {
                      ALog(@"Error downloading flow: %@", e);
-                     NSNotification *notification = [NSNotification notificationWithName:JRDownloadFlowResult object:e];
-                     [[NSNotificationQueue defaultQueue] enqueueNotification:notification postingStyle:NSPostWhenIdle];
-                     return;
                  }
-                 DLog(@"Fetched flow URL: %@", flowUrlString);
-                 NSError *error = [self processFlow:d response:(NSHTTPURLResponse *) r];
-                 NSNotification *notification = [NSNotification notificationWithName:JRDownloadFlowResult object:error];
-                 [[NSNotificationQueue defaultQueue] enqueueNotification:notification postingStyle:NSPostWhenIdle];
+                 else if ([(NSHTTPURLResponse *) r statusCode] == 304)
+                 {
+                     DLog(@"Flow not modified: %@", flowUrlString);
+                 }
+                 else
+                 {
+                     DLog(@"Fetched flow URL: %@", flowUrlString);
+                     flow = [JRCaptureData flowFromData:d response:(NSHTTPURLResponse *) r error:&error];
+                     if (flow) [JRCaptureData writeFlowData:d forUrl:flowUrlString response:(NSHTTPURLResponse *) r];
+                 }
+
+                 dispatch_async(dispatch_get_main_queue(), ^
+                 {
+                     if (flow)
+                     {
+                         self.captureFlow = flow;
+                         DLog(@"Parsed flow, version: %@", [self downloadedFlowVersion]);
+                     }
+
+                     /*
+                      * "Notification Centers" @ developer.apple.com
+                      * A notification center delivers notifications to observers synchronously. In other words,
+                      * when posting a notification, control does not return to the poster until all observers
+                      * have received and processed the notification. To send notifications asynchronously use
+                      * a notification queue, which is described in “Notification Queues.”
+                      */
+                     NSNotification *notification = [NSNotification notificationWithName:JRDownloadFlowResult
+                                                                                   object:error];
+                     [[NSNotificationQueue defaultQueue] enqueueNotification:notification
+                                                                postingStyle:NSPostWhenIdle];
+                 });
              }];
 }
 
-- (NSError *)processFlow:(NSData *)flowData response:(NSHTTPURLResponse *)response
++ (JRCaptureFlow *)flowFromData:(NSData *)flowData response:(NSHTTPURLResponse *)response error:(NSError **)error
 {
     NSError *jsonErr = nil;
     NSObject *parsedFlow = [NSJSONSerialization JSONObjectWithData:flowData options:(NSJSONReadingOptions) 0
@@ -340,7 +519,8 @@ static JRCaptureData *singleton = nil;
         NSString *responseString = [NSHTTPURLResponse localizedStringForStatusCode:[response statusCode]];
         ALog(@"Error parsing flow JSON, response: %@", responseString);
         ALog(@"Error parsing flow JSON, err: %@", [jsonErr description]);
-        return jsonErr;
+        if (error) *error = jsonErr;
+        return nil;
     }
     
     if (![parsedFlow isKindOfClass:[NSDictionary class]])
@@ -349,24 +529,15 @@ static JRCaptureData *singleton = nil;
                         [parsedFlow description]];
 
         ALog(@"%@", errorMsg);
-        JRCaptureError *error = [JRCaptureError errorWithErrorString:@"JSON Parsing Error"
-                                                                code:JRCaptureErrorWhileParsingJson
-                                                         description:errorMsg
-                                                         extraFields:nil];
-        return error;
+        JRCaptureError *captureError = [JRCaptureError errorWithErrorString:@"JSON Parsing Error"
+                                                                       code:JRCaptureErrorWhileParsingJson
+                                                                description:errorMsg
+                                                                extraFields:nil];
+        if (error) *error = captureError;
+        return nil;
     }
 
-    self.captureFlow = [JRCaptureFlow flowWithDictionary:(NSDictionary *) parsedFlow];
-    DLog(@"Parsed flow, version: %@", [self downloadedFlowVersion]);
-    
-    [self writeCaptureFlow];
-    return nil;
-}
-
-- (void)writeCaptureFlow
-{
-    [[NSUserDefaults standardUserDefaults] setValue:[NSKeyedArchiver archivedDataWithRootObject:[captureFlow dictionary]]
-                                             forKey:FLOW_KEY];
+    return [JRCaptureFlow flowWithDictionary:(NSDictionary *) parsedFlow];
 }
 
 + (NSString *)serviceNameForTokenName:(NSString *)tokenName
@@ -420,7 +591,42 @@ static JRCaptureData *singleton = nil;
 
 + (void)setAccessToken:(NSString *)token
 {
+    [JRCaptureData setAccessToken:token expiresIn:nil];
+}
+
++ (void)setAccessToken:(NSString *)token expiresIn:(id)expiresIn
+{
+    NSTimeInterval lifetime = [expiresIn isKindOfClass:[NSNumber class]] && [expiresIn doubleValue] > 0 ?
+            [expiresIn doubleValue] : 0;
+    JRCaptureData *data = [JRCaptureData sharedCaptureData];
+    data.accessTokenDate = token && lifetime ? [NSDate date] : nil;
+    data.accessTokenLifetime = lifetime;
+
+    NSUserDefaults *defaults = [NSUserDefaults standardUserDefaults];
+    if (data.accessTokenDate)
+        [defaults setObject:data.accessTokenDate forKey:ACCESS_TOKEN_DATE_KEY];
+    else
+        [defaults removeObjectForKey:ACCESS_TOKEN_DATE_KEY];
+    [defaults setDouble:lifetime forKey:ACCESS_TOKEN_LIFETIME_KEY];
+
     [JRCaptureData saveNewToken:token ofType:JRTokenTypeAccess];
+    [[NSNotificationCenter defaultCenter] postNotificationName:JRCaptureAccessTokenDidChangeNotification object:data];
+}
+
+- (NSTimeInterval)accessTokenAge
+{
+    return accessTokenDate ? -[accessTokenDate timeIntervalSinceNow] : 0;
+}
+
+- (BOOL)accessTokenIsExpired
+{
+    return accessTokenDate && [self accessTokenAge] >= accessTokenLifetime;
+}
+
+- (NSDate *)accessTokenRefreshDate
+{
+    NSTimeInterval margin = MIN(cJRAccessTokenRefreshMargin, accessTokenLifetime / 4);
+    return [accessTokenDate dateByAddingTimeInterval:accessTokenLifetime - margin];
 }
 
 + (NSString *)captureBaseUrl __unused
@@ -446,7 +652,11 @@ static JRCaptureData *singleton = nil;
     [JRCaptureData deleteTokenNameFromKeychain:@"access_token"];
     [JRCaptureData deleteTokenNameFromKeychain:@"refresh_secret"];
     [JRCaptureData sharedCaptureData].accessToken = nil;
+    [JRCaptureData sharedCaptureData].accessTokenDate = nil;
     [JRCaptureData sharedCaptureData].refreshSecret = nil;
+    [[NSUserDefaults standardUserDefaults] removeObjectForKey:ACCESS_TOKEN_DATE_KEY];
+    [[NSNotificationCenter defaultCenter] postNotificationName:JRCaptureAccessTokenDidChangeNotification
+                                                        object:[JRCaptureData sharedCaptureData]];
 }
 
 + (NSMutableURLRequest *)requestWithPath:(NSString *)path
@@ -73,6 +73,8 @@ typedef enum
     JRCaptureLocalApidErrorUrlConnection        = JRCaptureLocalApidErrorGeneric + 201, /**< Error returned when a URL connection could not be established */
     JRCaptureLocalApidErrorConnectionDidFail    = JRCaptureLocalApidErrorGeneric + 202, /**< Error returned when a URL connection failed */
     JRCaptureLocalApidErrorInvalidArgument      = JRCaptureLocalApidErrorGeneric + 203, /**< Error returned when an invalid parameter has been passed to a Capture method */
+    JRCaptureLocalApidErrorConstraintViolation  = JRCaptureLocalApidErrorGeneric + 204, /**< Error returned when a property's value violates one of its constraints in the Capture schema, found before it was sent to Capture. @sa JRCaptureObject#validate */
+    JRCaptureLocalApidErrorPartialProjection    = JRCaptureLocalApidErrorGeneric + 205, /**< Error returned when an object generated with only some of its attributes (CaptureSchemaParser.pl -p) is replaced on Capture, which would delete the rest. Update it instead */
     JRCaptureLocalApidErrorInvalidResultClass   = JRCaptureLocalApidErrorGeneric + 301, /**< Error returned when the JSON returned by Capture wasn't the expected structure (e.g., a string when expecting a plural) */
     JRCaptureLocalApidErrorInvalidResultStat    = JRCaptureLocalApidErrorGeneric + 302, /**< Error returned when the stat returned by Capture is missing or something unexpected */
     JRCaptureLocalApidErrorInvalidResultData    = JRCaptureLocalApidErrorGeneric + 303, /**< Error returned when the data returned by Capture was unexpected or incorrect */
@@ -167,6 +169,10 @@ typedef enum
 - (BOOL)isFormValidationError;
 
 - (id)validationFailureMessages;
+
+- (BOOL)isConstraintViolationError;
+- (NSString *)violatedConstraint;
+- (NSString *)violatingAttributePath;
 @end
 /** @}*/
 
@@ -213,6 +219,8 @@ typedef enum
 + (NSDictionary *)invalidDataErrorDictForResult:(NSObject *)result;
 
 + (NSDictionary *)invalidParameterErrorDictWithParam:(NSString *)param;
++ (NSDictionary *)constraintViolationErrorDictForAttribute:(NSString *)attributeName atPath:(NSString *)capturePath
+                                                constraint:(NSString *)constraint;
 @end
 
 /**
@@ -130,6 +130,21 @@ static NSString *const ENGAGE_TOKEN_KEY = @"merge_token";
 {
     return [self.userInfo objectForKey:@"invalid_fields"];
 }
+
+- (BOOL)isConstraintViolationError
+{
+    return self.code == JRCaptureLocalApidErrorConstraintViolation;
+}
+
+- (NSString *)violatedConstraint
+{
+    return [self.userInfo objectForKey:@"constraint"];
+}
+
+- (NSString *)violatingAttributePath
+{
+    return [self.userInfo objectForKey:@"attribute_path"];
+}
 @end
 
 @implementation JRCaptureError (JRCaptureError_Builders)
@@ -202,8 +217,17 @@ static NSString *const ENGAGE_TOKEN_KEY = @"merge_token";
                               extraFields:extraFields];
 
     if (between([code integerValue], LOCAL_APID_ERROR_RANGE, APID_ERROR_RANGE))
+    {
+        if ([code integerValue] == JRCaptureLocalApidErrorConstraintViolation)
+        {
+            [self maybeCopyEntry:@"attribute_name" from:result to:extraFields];
+            [self maybeCopyEntry:@"attribute_path" from:result to:extraFields];
+            [self maybeCopyEntry:@"constraint" from:result to:extraFields];
+        }
+
         return [self errorWithErrorString:errorString code:[code integerValue] description:errorDescription
                               extraFields:extraFields];
+    }
 
     if ([code integerValue] > CAPTURE_WRAPPED_ENGAGE_ERROR_RANGE)
         return [self errorWithErrorString:errorString code:[code integerValue] description:errorDescription
@@ -336,6 +360,23 @@ static NSString *const ENGAGE_TOKEN_KEY = @"merge_token";
             @"code" : [NSNumber numberWithInteger:JRCaptureLocalApidErrorInvalidArgument],
     };
 }
+
++ (NSDictionary *)constraintViolationErrorDictForAttribute:(NSString *)attributeName atPath:(NSString *)capturePath
+                                                constraint:(NSString *)constraint
+{
+    NSString *attributePath = [NSString stringWithFormat:@"%@/%@", capturePath ? capturePath : @"", attributeName];
+    NSString *errDesc = [NSString stringWithFormat:@"The value of %@ violates its %@ constraint", attributePath,
+                                                   constraint];
+    return @{
+            @"stat" : @"error",
+            @"error" : @"constraint_violation",
+            @"error_description" : errDesc,
+            @"code" : [NSNumber numberWithInteger:JRCaptureLocalApidErrorConstraintViolation],
+            @"attribute_name" : attributeName,
+            @"attribute_path" : attributePath,
+            @"constraint" : constraint,
+    };
+}
 @end
 
 @implementation NSError (JRCaptureError_Extensions)
@@ -31,6 +31,31 @@
 
 #import <Foundation/Foundation.h>
 
+/**
+ * A schemaId from the flow, e.g. @"profiles#3.profile.gender", split once into the attribute names and plural element
+ * ids along it
+ **/
+@interface JRCaptureFieldPath : NSObject
++ (JRCaptureFieldPath *)fieldPathWithDotPath:(NSString *)dotPath;
+
+/**
+ * The value at the path in a user's dictionary, or nil. A plural element is found by its id through an index of the
+ * plural, made the first time the plural is passed through and kept in pluralIndexes; pass the same pluralIndexes to
+ * every lookup in the same dictionary, and a new one for any other dictionary
+ **/
+- (id)valueInUserDictionary:(NSDictionary *)userDict pluralIndexes:(NSMutableDictionary *)pluralIndexes;
+@end
+
+/**
+ * One form parameter filled in from the user: a form field with a string schemaId, or one subscript of a field with
+ * a dictionary schemaId
+ **/
+@interface JRCaptureFormField : NSObject
+@property (nonatomic, readonly) NSString *parameterName;
+@property (nonatomic, readonly) JRCaptureFieldPath *path;
+@property (nonatomic, readonly) BOOL isDateSelect;
+@end
+
 
 @interface JRCaptureFlow : NSObject
 + (JRCaptureFlow *)flowWithDictionary:(NSDictionary *)dictionary;
@@ -40,4 +65,21 @@
 - (id)schemaIdForFieldName:(NSString *)fieldName;
 - (NSMutableDictionary *)fieldsForForm:(NSString *)form fromDictionary:(NSDictionary *)dict;
 - (NSString *)userIdentifyingFieldForForm:(NSString *)formName;
+
+/**
+ * The form's fields as JRCaptureFormFields, in the form's order, parsed when the flow was made
+ **/
+- (NSArray *)compiledFieldsForForm:(NSString *)formName;
+
+/** The names of the form's fields, in the form's order, or nil if there is no such form **/
+- (NSArray *)fieldNamesForForm:(NSString *)formName;
+
+/** The name of the form's password field, or nil if it has none **/
+- (NSString *)passwordFieldForForm:(NSString *)formName;
+
+/** The field's definition from the flow: its type, schemaId, label and so on **/
+- (NSDictionary *)fieldForName:(NSString *)fieldName;
+
+/** The name of a field whose schemaId is the given dot path, or nil **/
+- (NSString *)fieldNameForSchemaId:(NSString *)schemaId;
 @end
\ No newline at end of file
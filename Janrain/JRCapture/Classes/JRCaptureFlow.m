@@ -29,14 +29,104 @@
 
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#import "debug_log.h"
 #import "JRCaptureFlow.h"
 
+@implementation JRCaptureFieldPath {
+    NSArray *_keys;
+    NSArray *_elementIds; // an element id for each key, or NSNull where the key isn't a plural
+}
+
++ (JRCaptureFieldPath *)fieldPathWithDotPath:(NSString *)dotPath {
+    NSArray *components = [dotPath componentsSeparatedByString:@"."];
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:[components count]];
+    NSMutableArray *elementIds = [NSMutableArray arrayWithCapacity:[components count]];
+
+    for (NSString *component in components) {
+        NSRange hash = [component rangeOfString:@"#"];
+        if (hash.location == NSNotFound) {
+            [keys addObject:component];
+            [elementIds addObject:[NSNull null]];
+        } else {
+            [keys addObject:[component substringToIndex:hash.location]];
+            NSString *elementId = [component substringFromIndex:hash.location + 1];
+            NSRange nextHash = [elementId rangeOfString:@"#"];
+            if (nextHash.location != NSNotFound) elementId = [elementId substringToIndex:nextHash.location];
+            [elementIds addObject:elementId];
+        }
+    }
+
+    JRCaptureFieldPath *path = [[JRCaptureFieldPath alloc] init];
+    path->_keys = keys;
+    path->_elementIds = elementIds;
+    return path;
+}
+
++ (NSDictionary *)indexOfPlural:(NSArray *)plural {
+    NSMutableDictionary *index = [NSMutableDictionary dictionaryWithCapacity:[plural count]];
+    for (id element in plural) {
+        if (![element isKindOfClass:[NSDictionary class]]) continue;
+        id elementId = [element objectForKey:@"id"];
+        // Ids come from the server as numbers but from the schemaId as strings, so both are indexed by their text
+        if (elementId && ![index objectForKey:[elementId description]])
+            [index setObject:element forKey:[elementId description]];
+    }
+
+    return index;
+}
+
+- (id)valueInUserDictionary:(NSDictionary *)userDict pluralIndexes:(NSMutableDictionary *)pluralIndexes {
+    id value = userDict;
+    NSUInteger count = [_keys count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        if (![value isKindOfClass:[NSDictionary class]]) return nil;
+        value = [value objectForKey:[_keys objectAtIndex:i]];
+
+        id elementId = [_elementIds objectAtIndex:i];
+        if (elementId == [NSNull null]) continue;
+        if (![value isKindOfClass:[NSArray class]]) return nil;
+
+        NSValue *pluralKey = [NSValue valueWithNonretainedObject:value];
+        NSDictionary *index = [pluralIndexes objectForKey:pluralKey];
+        if (!index) {
+            index = [JRCaptureFieldPath indexOfPlural:value];
+            [pluralIndexes setObject:index forKey:pluralKey];
+        }
+
+        value = [index objectForKey:elementId];
+    }
+
+    return value;
+}
+@end
+
+@implementation JRCaptureFormField
+- (id)initWithParameterName:(NSString *)parameterName dotPath:(NSString *)dotPath dateSelect:(BOOL)dateSelect {
+    self = [super init];
+    if (self) {
+        _parameterName = [parameterName copy];
+        _path = [JRCaptureFieldPath fieldPathWithDotPath:dotPath];
+        _isDateSelect = dateSelect;
+    }
+
+    return self;
+}
+@end
+
 @interface JRCaptureFlow()
 @property (nonatomic, copy) NSDictionary *flowDict;
 @end
 
 @implementation JRCaptureFlow {
-
+    // All made once, when the flow is, and never changed after
+    NSDictionary *_fields;
+    NSDictionary *_schemaPaths;
+    NSDictionary *_formFieldNames;
+    NSDictionary *_compiledForms;
+    NSDictionary *_userIdentifyingFields;
+    NSDictionary *_passwordFields;
+    NSDictionary *_fieldNamesBySchemaId;
 }
 + (JRCaptureFlow *)flowWithDictionary:(NSDictionary *)dict {
     JRCaptureFlow *flow = [[JRCaptureFlow alloc] initWithDictionary:dict];
@@ -47,11 +137,89 @@
     self = [super init];
     if (self) {
         _flowDict = [dict copy];
+        [self indexFlow];
     }
 
     return self;
 }
 
+static NSDictionary *JRDictionaryOrNil(id object) {
+    return [object isKindOfClass:[NSDictionary class]] ? object : nil;
+}
+
+- (void)indexFlow {
+    _fields = JRDictionaryOrNil([self.flowDict objectForKey:@"fields"]);
+    _schemaPaths = JRDictionaryOrNil([JRDictionaryOrNil([self.flowDict objectForKey:@"schema_info"])
+            objectForKey:@"paths"]);
+
+    NSMutableDictionary *formFieldNames = [NSMutableDictionary dictionary];
+    NSMutableDictionary *compiledForms = [NSMutableDictionary dictionary];
+    NSMutableDictionary *userIdentifyingFields = [NSMutableDictionary dictionary];
+    NSMutableDictionary *passwordFields = [NSMutableDictionary dictionary];
+    NSMutableDictionary *fieldNamesBySchemaId = [NSMutableDictionary dictionary];
+
+    // Sorted, so that when two fields share a schemaId the same one is always found for it
+    for (NSString *name in [[_fields allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+        NSDictionary *field = JRDictionaryOrNil([_fields objectForKey:name]);
+
+        id schemaId = [field objectForKey:@"schemaId"];
+        if ([schemaId isKindOfClass:[NSString class]] && ![fieldNamesBySchemaId objectForKey:schemaId])
+            [fieldNamesBySchemaId setObject:name forKey:schemaId];
+
+        NSArray *formFields = [field objectForKey:@"fields"];
+        if (![formFields isKindOfClass:[NSArray class]]) continue;
+
+        [formFieldNames setObject:formFields forKey:name];
+        [compiledForms setObject:[self compileFieldsOfForm:formFields] forKey:name];
+
+        for (NSString *fieldName in formFields) {
+            NSString *type = [JRDictionaryOrNil([_fields objectForKey:fieldName]) objectForKey:@"type"];
+            if (([type isEqual:@"email"] || [type isEqual:@"text"]) && ![userIdentifyingFields objectForKey:name])
+                [userIdentifyingFields setObject:fieldName forKey:name];
+            if ([type isEqual:@"password"])
+                [passwordFields setObject:fieldName forKey:name];
+        }
+    }
+
+    _formFieldNames = formFieldNames;
+    _compiledForms = compiledForms;
+    _userIdentifyingFields = userIdentifyingFields;
+    _passwordFields = passwordFields;
+    _fieldNamesBySchemaId = fieldNamesBySchemaId;
+}
+
+- (NSArray *)compileFieldsOfForm:(NSArray *)formFields {
+    NSMutableArray *compiledFields = [NSMutableArray array];
+    for (NSString *fieldName in formFields) {
+        NSDictionary *field = [_fields objectForKey:fieldName];
+        if (![field isKindOfClass:[NSDictionary class]]) {
+            ALog(@"unrecognized field defn: %@", [field description]);
+            continue;
+        }
+
+        id schemaId = [field objectForKey:@"schemaId"];
+        if (schemaId == nil) {
+            ALog(@"field defn missing schemaId (skipping): %@", [field description]);
+            continue;
+        }
+
+        if ([schemaId isKindOfClass:[NSString class]]) {
+            BOOL dateSelect = [[field objectForKey:@"type"] isEqual:@"dateselect"];
+            [compiledFields addObject:[[JRCaptureFormField alloc] initWithParameterName:fieldName dotPath:schemaId
+                                                                             dateSelect:dateSelect]];
+        } else if ([schemaId isKindOfClass:[NSDictionary class]]) {
+            for (NSString *subscript in schemaId) {
+                NSString *parameterName = [NSString stringWithFormat:@"%@[%@]", fieldName, subscript];
+                NSString *dotPath = [schemaId objectForKey:subscript];
+                [compiledFields addObject:[[JRCaptureFormField alloc] initWithParameterName:parameterName
+                                                                                    dotPath:dotPath dateSelect:NO]];
+            }
+        }
+    }
+
+    return [compiledFields copy];
+}
+
 - (NSDictionary *)dictionary {
     return self.flowDict;
 }
@@ -61,43 +229,45 @@
 }
 
 - (id)schemaIdForFieldName:(NSString *)fieldName {
-    NSDictionary *schemaInfo = [self.flowDict objectForKey:@"schema_info"];
-    NSDictionary *paths = [schemaInfo objectForKey:@"paths"];
-    return [paths objectForKey:fieldName];
+    return [_schemaPaths objectForKey:fieldName];
 }
 
 - (NSMutableDictionary *)fieldsForForm:(NSString *)formName fromDictionary:(NSDictionary *)dict {
-    NSDictionary *form = [self.fields objectForKey:formName];
-    NSArray *fieldNames = [form objectForKey:@"fields"];
     NSMutableDictionary *fields = [NSMutableDictionary dictionary];
 
-    for (NSString *key in fieldNames) {
+    for (NSString *key in [self fieldNamesForForm:formName]) {
         if ([dict objectForKey:key]) [fields setObject:[dict objectForKey:key] forKey:key];
     }
 
     return fields;
 }
 
-- (NSString *)userIdentifyingFieldForForm:(NSString *)formName{
+- (NSString *)userIdentifyingFieldForForm:(NSString *)formName {
+    return formName ? [_userIdentifyingFields objectForKey:formName] : nil;
+}
+
+- (NSArray *)compiledFieldsForForm:(NSString *)formName {
+    return formName ? [_compiledForms objectForKey:formName] : nil;
+}
 
-    NSDictionary *fields = [self fields];
-    NSDictionary *form = [fields objectForKey:formName];
-    NSArray *formFields = [form objectForKey:@"fields"];
+- (NSArray *)fieldNamesForForm:(NSString *)formName {
+    return formName ? [_formFieldNames objectForKey:formName] : nil;
+}
 
-    for (NSString *fieldName in formFields) {
-        NSDictionary *field = [fields objectForKey:fieldName];
-        NSString * type = [field objectForKey:@"type"];
+- (NSString *)passwordFieldForForm:(NSString *)formName {
+    return formName ? [_passwordFields objectForKey:formName] : nil;
+}
 
-        if ([type isEqualToString:@"email"] || [type isEqualToString:@"text"]) {
-            return fieldName;
-        }
-    }
+- (NSDictionary *)fieldForName:(NSString *)fieldName {
+    return fieldName ? JRDictionaryOrNil([_fields objectForKey:fieldName]) : nil;
+}
 
-    return nil;
+- (NSString *)fieldNameForSchemaId:(NSString *)schemaId {
+    return schemaId ? [_fieldNamesBySchemaId objectForKey:schemaId] : nil;
 }
 
 - (NSDictionary *)fields {
-    return [self objectForKey:@"fields"];
+    return _fields;
 }
 
 - (void)dealloc
@@ -105,4 +275,4 @@
 }
 
 
-@end
\ No newline at end of file
+@end
@@ -30,6 +30,9 @@
 
 #import <Foundation/Foundation.h>
 #import "JRCaptureObject.h"
+#import "JRJsonFormWriter.h"
+#import "JRJsonReader.h"
+#import "JRCaptureArchive.h"
 
 #define cJREncodedCaptureUser @"jrcapture.encodedCaptureUser"
 
@@ -73,14 +76,127 @@ didSucceedWithResult:(NSString *)result context:(NSObject *)context;
 @end
 
 
+/**
+ * Generated classes number their non-array properties from 0, and keep which of them are dirty as one bit per property
+ * in an array of JRDirtyPropertyWords. JRCaptureObject#dirtyPropertySet is a mutable view of the same bits, by name.
+ **/
+typedef uint64_t JRDirtyPropertyWord;
+
+#define JRDirtyPropertyWordBits 64
+#define JRDirtyPropertyWordCount(propertyCount) (((propertyCount) + JRDirtyPropertyWordBits - 1) / JRDirtyPropertyWordBits)
+
+static inline void JRSetDirtyProperty(JRDirtyPropertyWord *words, NSUInteger index)
+{
+    words[index / JRDirtyPropertyWordBits] |= (JRDirtyPropertyWord) 1 << (index % JRDirtyPropertyWordBits);
+}
+
+static inline BOOL JRIsDirtyProperty(const JRDirtyPropertyWord *words, NSUInteger index)
+{
+    return (words[index / JRDirtyPropertyWordBits] >> (index % JRDirtyPropertyWordBits)) & 1;
+}
+
+/**
+ * Classes generated in table mode (CaptureSchemaParser.pl -t) don't stamp out their methods once per property.
+ * Each describes its properties in a static JRCaptureSchema instead, and JRCaptureObject implements the methods, and
+ * the properties' accessors, from that table. A property's value is kept in the slot at its attribute's index.
+ * Test/JUMPTests/JUMPTableTests.xcodeproj runs the JUMPTests suite against test_user1.json generated this way.
+ **/
+typedef enum
+{
+    JRCaptureAttributeTypeValue,        /* string, decimal, ipAddress, password, json and uuid; kept as they are */
+    JRCaptureAttributeTypeBoolean,
+    JRCaptureAttributeTypeInteger,      /* integer and id */
+    JRCaptureAttributeTypeDate,
+    JRCaptureAttributeTypeDateTime,
+    JRCaptureAttributeTypeStringPlural,
+    JRCaptureAttributeTypePlural,
+    JRCaptureAttributeTypeObject,
+} JRCaptureAttributeType;
+
+typedef enum
+{
+    JRCaptureAttributeRequired         = 1 << 0,
+    JRCaptureAttributeUnique           = 1 << 1,
+    JRCaptureAttributeLocallyUnique    = 1 << 2,
+    JRCaptureAttributeAlphabetic       = 1 << 3,
+    JRCaptureAttributeAlphanumeric     = 1 << 4,
+    JRCaptureAttributeUnicodeLetters   = 1 << 5,
+    JRCaptureAttributeUnicodePrintable = 1 << 6,
+    JRCaptureAttributeEmailAddress     = 1 << 7,
+    JRCaptureAttributeReadOnly         = 1 << 8,    /* id, uuid, created and lastUpdated are never sent to Capture */
+} JRCaptureAttributeFlag;
+
+typedef struct
+{
+    __unsafe_unretained NSString *key;              /* The attribute's name on Capture */
+    const char *cKey;                               /* The same, as the JSON and archive readers see it */
+    __unsafe_unretained NSString *propertyName;     /* Differs from the key when that is a keyword or repeated */
+    __unsafe_unretained NSString *typeName;         /* What objectProperties reports, e.g. @"JRDateTime" */
+    JRCaptureAttributeType type;
+    unsigned int flags;
+    NSUInteger length;                              /* The schema's maximum length, or 0 */
+    NSInteger dirtyProperty;                        /* The property's dirty bit, or -1 for plurals */
+    const char *className;                          /* The class of a sub-object, or of a plural's elements */
+    __unsafe_unretained NSString *elementType;      /* The key of the string in a string plural's elements */
+} JRCaptureAttribute;
+
+typedef struct
+{
+    __unsafe_unretained NSString *name;             /* The object's name, e.g. @"captureUser" */
+    __unsafe_unretained NSString *key;              /* What is appended to the parent's path */
+    __unsafe_unretained NSString *path;             /* The path init sets; @"" below a plural, until one is read */
+    BOOL isPluralElement;
+    BOOL hasPluralParent;
+    NSUInteger attributeCount;
+    const JRCaptureAttribute *attributes;
+} JRCaptureSchema;
+
+/**
+ * Check a property's value against the constraints in flags and the schema's maximum length, or 0, adding the error
+ * result of each violation, as JRCaptureError#errorFromResult:onProvider:engageToken: takes it, to violations. Only
+ * the constraints Capture applies to strings, and required, are checked; sub-objects and plurals check themselves
+ **/
+void JRValidateCaptureAttribute(id value, NSString *key, NSString *capturePath, unsigned int flags, NSUInteger length,
+                                NSMutableArray *violations);
+
 @interface JRCaptureObject (Private) <NSCoding>
 @property(readwrite, nonatomic) NSString *captureObjectPath;
-@property(readwrite, nonatomic) NSMutableSet *dirtyPropertySet;
+@property(readonly, nonatomic) NSMutableSet *dirtyPropertySet;
+@property(readonly, nonatomic) JRDirtyPropertyWord *dirtyPropertyWords;
 @property(readwrite) BOOL canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames;
++ (NSUInteger)dirtyPropertyCount;
+
+/**
+ * The attributes a user generated from a projection file (CaptureSchemaParser.pl -p) is read from Capture with, as
+ * paths like @"primaryAddress.city"; nil for classes generated from the whole schema
+ **/
++ (NSArray *)attributeProjection;
+
+/**
+ * YES for classes generated from a projection file that left out some of their attributes, which replacing them on
+ * Capture would delete; NO otherwise
+ **/
++ (BOOL)isPartialProjection;
+- (NSData *)dirtyPropertyWordsSnapshot;
+- (void)restoreDirtyPropertyWordsFromSnapshot:(NSData *)snapshot;
+
 - (NSDictionary *)newDictionaryForEncoder:(BOOL)forEncoder;
 - (NSDictionary *)toUpdateDictionary;
 - (NSDictionary *)toReplaceDictionary;
+
+/**
+ * Write the same JSON as toUpdateDictionary and toReplaceDictionary, and clear the dirty properties the same way, but
+ * straight into an /entity.update or /entity.replace request body
+ **/
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer;
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer;
+
+/**
+ * Write the object, its sub-objects and plurals, and their paths and dirty properties, to a binary archive
+ **/
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer;
 - (NSDictionary *)objectProperties;
 
 - (NSSet *)updatablePropertySet;
@@ -93,6 +209,10 @@ didSucceedWithResult:(NSString *)result context:(NSObject *)context;
 - (void)updateFromDictionary:(__unused NSDictionary*)dictionary withPath:(__unused NSString *)capturePath __unused;
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath;
 
+/**
+ * Replace the object on Capture with exactly its attributes. Fails locally, with
+ * JRCaptureLocalApidErrorPartialProjection, for classes that +isPartialProjection
+ **/
 - (void)replaceOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context __unused;
 
 - (void)replaceArrayOnCapture:(NSArray *)array named:(NSString *)arrayName isArrayOfStrings:(BOOL)isStringArray
@@ -100,4 +220,27 @@ didSucceedWithResult:(NSString *)result context:(NSObject *)context;
                   withContext:(NSObject *)context;
 
 - (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj;
+
+/**
+ * Add the error results of the object's constraint violations, and those of its sub-objects, to violations. With
+ * dirtyPropertiesOnly, only what an update would send is checked: the dirty properties, and the sub-objects' dirty
+ * properties, but not the plurals
+ **/
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly;
+
+/**
+ * The table a table mode class describes itself with, or NULL for classes that implement their own methods
+ **/
++ (const JRCaptureSchema *)captureSchema;
+
+/**
+ * The table driven implementations of a table mode class's ...FromDictionary:, ...FromJsonReader:,
+ * ...FromArchive:, decodeFromDictionary: and isEqualTo...: methods
+ **/
++ (id)captureObjectFromDictionary:(NSDictionary *)dictionary withPath:(NSString *)capturePath
+                      fromDecoder:(BOOL)fromDecoder;
++ (id)captureObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)captureObjectFromArchive:(JRCaptureArchiveReader *)reader;
+- (void)decodeAttributesFromDictionary:(NSDictionary *)dictionary;
+- (BOOL)isEqualToCaptureObject:(JRCaptureObject *)otherObject;
 @end
@@ -191,6 +191,23 @@
  **/
 - (BOOL)needsUpdate;
 
+/**
+ * Use this method to check the object against the constraints its attributes have in the Capture schema before
+ * sending it to Capture. The required, length, alphabetic, alphanumeric, unicode-letters, unicode-printable and
+ * email-address constraints are checked locally; unique and locally-unique constraints can only be checked by Capture.
+ *
+ * @return
+ * An array of JRCaptureError objects, one for each violated constraint, each with the code
+ * JRCaptureLocalApidErrorConstraintViolation and the violating attribute's path and constraint. An empty array if the
+ * object is valid.
+ *
+ * @note
+ * This method recursively checks all of the sub-objects of the JRCaptureObject, and the elements of its arrays.
+ * updateOnCaptureForDelegate:context:() checks the same constraints on the properties it would send, and fails with
+ * the first violation, without a round trip to Capture, if any are violated.
+ **/
+- (NSArray *)validate;
+
 /**
  * Sent if ...
  *
@@ -205,5 +222,52 @@
  **/
 - (void)updateOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate
                            context:(NSObject *)context;
+
+/**
+ * Turns on batching of JRCaptureObject#updateOnCaptureForDelegate:context:() calls. While batching is on, updates made
+ * within \e window seconds of the first pending update are merged into a single update, rooted at the nearest path
+ * the objects have in common, and sent to Capture in one request. Each object's delegate is still messaged with its own
+ * context, and on failure each object's dirty properties are restored as they would be for an unbatched update.
+ *
+ * @param window
+ *   The number of seconds to collect updates for, or \c 0 (the default) to send each update immediately. Setting the
+ *   window to \c 0 sends any pending updates.
+ *
+ * @note
+ * Updates to elements of different plurals, or to elements and objects outside of those plurals, cannot be merged and
+ * are sent as separate requests.
+ **/
++ (void)setUpdateBatchingWindow:(NSTimeInterval)window;
+
+/**
+ * The current update batching window, in seconds. \c 0 if batching is off.
+ **/
++ (NSTimeInterval)updateBatchingWindow;
+
+/**
+ * Sends any batched updates now, without waiting for the batching window to close.
+ **/
++ (void)flushBatchedUpdates;
+
+/**
+ * Turns on lazy loading of Capture objects. While it is on, objects loaded from Capture keep the JSON of their
+ * sub-objects and plurals, and only build those sub-objects and the plurals' elements the first time their properties
+ * are read. Objects that are only partly read, such as a user whose \c email and \c displayName are all that's used,
+ * then never pay for the rest of the record.
+ *
+ * @param lazily
+ *   \c YES to load sub-objects and plurals lazily, or \c NO (the default) to build them all up front
+ *
+ * @note
+ * Lazily loaded sub-objects and plural elements are built in the state they would have been in had they been built up
+ * front, so their dirty properties, and what JRCaptureObject#needsUpdate returns, are the same either way. Objects
+ * restored from an archive are always built up front.
+ **/
++ (void)setMaterializesLazily:(BOOL)lazily;
+
+/**
+ * \c YES if objects loaded from Capture build their sub-objects and plurals lazily. \c NO by default.
+ **/
++ (BOOL)materializesLazily;
 @end
 
@@ -28,15 +28,16 @@
  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#import <objc/runtime.h>
 #import "debug_log.h"
 #import "JRCaptureObject.h"
 #import "JRCaptureUser+Extras.h"
 #import "JRCaptureObject+Internal.h"
-#import <objc/runtime.h>
 #import "JRCaptureApidInterface.h"
 #import "JRCaptureData.h"
 #import "JRCaptureError.h"
 #import "JRJsonUtils.h"
+#import "JRNSDate+ISO8601_CaptureDateTimeString.h"
 
 @implementation NSArray (JRArray_StringArray)
 // TODO: Test this!
@@ -59,6 +60,303 @@
 }
 @end
 
+/* The conversions table mode classes make between their attributes and JSON; these are the same conversions that
+   CaptureSchemaParser.pl writes out per property for the classes it generates in full */
+static NSString *JRCaptureObjectPath(const JRCaptureSchema *schema, NSString *capturePath, id elementId)
+{
+    if (!schema->isPluralElement)
+        return [NSString stringWithFormat:@"%@/%@", capturePath, schema->key];
+
+    NSInteger integerId = [elementId respondsToSelector:@selector(integerValue)] ? [elementId integerValue] : 0;
+    return [NSString stringWithFormat:@"%@/%@#%ld", capturePath, schema->key, (long)integerId];
+}
+
+static NSUInteger JRAttributeIndexForKey(const JRCaptureSchema *schema, const char *key, size_t keyLength,
+                                         NSUInteger hint)
+{
+    /* Keys usually come in the order the schema lists them, so start looking after the last one found */
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        NSUInteger index = (hint + i) % schema->attributeCount;
+        if (JRJsonKeyEquals(key, keyLength, schema->attributes[index].cKey))
+            return index;
+    }
+
+    return NSNotFound;
+}
+
+static id JRJsonFromAttributeValue(const JRCaptureAttribute *attribute, id value, BOOL forEncoder)
+{
+    switch (attribute->type)
+    {
+        case JRCaptureAttributeTypeBoolean:
+            return [NSNumber numberWithBool:[(NSNumber *)value boolValue]];
+        case JRCaptureAttributeTypeInteger:
+            return [NSNumber numberWithInteger:[(NSNumber *)value integerValue]];
+        case JRCaptureAttributeTypeDate:
+            return [(NSDate *)value stringFromISO8601Date];
+        case JRCaptureAttributeTypeDateTime:
+            return [(NSDate *)value stringFromISO8601DateTime];
+        case JRCaptureAttributeTypeObject:
+            return [(JRCaptureObject *)value newDictionaryForEncoder:forEncoder];
+        case JRCaptureAttributeTypePlural:
+        {
+            Class elementClass = objc_getClass(attribute->className);
+            NSMutableArray *dictionaries = [NSMutableArray arrayWithCapacity:[(NSArray *)value count]];
+            for (NSObject *element in (NSArray *)value)
+                if ([element isKindOfClass:elementClass])
+                    [dictionaries addObject:[(JRCaptureObject *)element newDictionaryForEncoder:forEncoder]];
+
+            return dictionaries;
+        }
+        default:
+            return value;
+    }
+}
+
+static id JRAttributeValueFromJson(const JRCaptureAttribute *attribute, id json, NSString *capturePath,
+                                   BOOL fromDecoder)
+{
+    switch (attribute->type)
+    {
+        case JRCaptureAttributeTypeBoolean:
+            return [NSNumber numberWithBool:[(NSNumber *)json boolValue]];
+        case JRCaptureAttributeTypeInteger:
+            return [NSNumber numberWithInteger:[(NSNumber *)json integerValue]];
+        case JRCaptureAttributeTypeDate:
+            return [NSDate dateFromISO8601DateString:json];
+        case JRCaptureAttributeTypeDateTime:
+            return [NSDate dateFromISO8601DateTimeString:json];
+        case JRCaptureAttributeTypeStringPlural:
+            return [(NSArray *)json arrayOfStringsFromStringPluralDictionariesWithType:attribute->elementType];
+        case JRCaptureAttributeTypeObject:
+            if (![json isKindOfClass:[NSDictionary class]])
+                return nil;
+
+            return [objc_getClass(attribute->className) captureObjectFromDictionary:json withPath:capturePath
+                                                                        fromDecoder:fromDecoder];
+        case JRCaptureAttributeTypePlural:
+        {
+            if (![json isKindOfClass:[NSArray class]])
+                return nil;
+
+            Class elementClass = objc_getClass(attribute->className);
+            NSMutableArray *elements = [NSMutableArray arrayWithCapacity:[(NSArray *)json count]];
+            for (NSObject *dictionary in (NSArray *)json)
+                if ([dictionary isKindOfClass:[NSDictionary class]])
+                    [elements addObject:[elementClass captureObjectFromDictionary:(NSDictionary *)dictionary
+                                                                         withPath:capturePath fromDecoder:fromDecoder]];
+
+            return elements;
+        }
+        default:
+            return json;
+    }
+}
+
+static NSArray *JRElementsFromJsonReader(const JRCaptureAttribute *attribute, JRJsonReader *reader,
+                                         NSString *capturePath)
+{
+    if (![reader beginArray])
+        return nil;
+
+    Class elementClass = objc_getClass(attribute->className);
+    NSMutableArray *elements = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRCaptureObject *element = [elementClass captureObjectFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [elements addObject:element];
+    }
+
+    return elements;
+}
+
+static NSArray *JRElementsFromArchive(const JRCaptureAttribute *attribute, JRCaptureArchiveReader *reader)
+{
+    if (![reader beginArray])
+        return nil;
+
+    Class elementClass = objc_getClass(attribute->className);
+    NSMutableArray *elements = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRCaptureObject *element = [elementClass captureObjectFromArchive:reader];
+        if (element)
+            [elements addObject:element];
+    }
+
+    return elements;
+}
+
+static const JRCaptureAttribute *JRAttributeForPropertyName(const JRCaptureSchema *schema, NSString *propertyName)
+{
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        if ([schema->attributes[i].propertyName isEqualToString:propertyName])
+            return &schema->attributes[i];
+
+    return NULL;
+}
+
+/* The character classes of Capture's string constraints. ASCII characters are looked up in a table of class bits that
+   is built once; anything else falls back on the matching NSCharacterSet, or fails if the class is ASCII only */
+typedef enum
+{
+    JRCharacterClassAlphabetic   = 1 << 0,
+    JRCharacterClassAlphanumeric = 1 << 1,
+    JRCharacterClassLetter       = 1 << 2,
+    JRCharacterClassPrintable    = 1 << 3,
+    JRCharacterClassEmailLocal   = 1 << 4,
+    JRCharacterClassEmailDomain  = 1 << 5,
+} JRCharacterClass;
+
+static uint8_t JRAsciiCharacterClasses[128];
+static NSCharacterSet *JRUnicodeLetterCharacterSet;
+static NSCharacterSet *JRUnicodePrintableCharacterSet;
+
+static void JRBuildCharacterClassTables()
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        for (unsigned char c = 0x20; c < 0x7f; c++)
+        {
+            BOOL isAlpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            BOOL isDigit = c >= '0' && c <= '9';
+
+            JRAsciiCharacterClasses[c] |= JRCharacterClassPrintable;
+            if (isAlpha)
+                JRAsciiCharacterClasses[c] |= JRCharacterClassAlphabetic | JRCharacterClassLetter;
+            if (isAlpha || isDigit)
+                JRAsciiCharacterClasses[c] |= JRCharacterClassAlphanumeric | JRCharacterClassEmailLocal |
+                        JRCharacterClassEmailDomain;
+            if (strchr("!#$%&'*+-/=?^_`{|}~.", c))
+                JRAsciiCharacterClasses[c] |= JRCharacterClassEmailLocal;
+            if (c == '-' || c == '.')
+                JRAsciiCharacterClasses[c] |= JRCharacterClassEmailDomain;
+        }
+
+        JRUnicodeLetterCharacterSet = [NSCharacterSet letterCharacterSet];
+        NSMutableCharacterSet *printable = [[NSCharacterSet controlCharacterSet] mutableCopy];
+        [printable formUnionWithCharacterSet:[NSCharacterSet illegalCharacterSet]];
+        JRUnicodePrintableCharacterSet = [printable invertedSet];
+    });
+}
+
+static NSCharacterSet *JRNonAsciiCharacterSetForClass(JRCharacterClass characterClass)
+{
+    switch (characterClass)
+    {
+        case JRCharacterClassLetter:
+        case JRCharacterClassEmailLocal:
+        case JRCharacterClassEmailDomain:
+            return JRUnicodeLetterCharacterSet;
+        case JRCharacterClassPrintable:
+            return JRUnicodePrintableCharacterSet;
+        default:
+            return nil;
+    }
+}
+
+static BOOL JRStringIsInCharacterClass(NSString *string, JRCharacterClass characterClass)
+{
+    NSCharacterSet *nonAsciiSet = JRNonAsciiCharacterSetForClass(characterClass);
+    CFStringRef cfString = (__bridge CFStringRef) string;
+    CFIndex length = CFStringGetLength(cfString);
+    CFStringInlineBuffer buffer;
+    CFStringInitInlineBuffer(cfString, &buffer, CFRangeMake(0, length));
+
+    for (CFIndex i = 0; i < length; i++)
+    {
+        UniChar c = CFStringGetCharacterFromInlineBuffer(&buffer, i);
+
+        if (c < 128)
+        {
+            if (!(JRAsciiCharacterClasses[c] & characterClass))
+                return NO;
+        }
+        else if (!nonAsciiSet)
+        {
+            return NO;
+        }
+        else if (CFStringIsSurrogateHighCharacter(c) && i + 1 < length)
+        {
+            UniChar low = CFStringGetCharacterFromInlineBuffer(&buffer, ++i);
+            if (![nonAsciiSet longCharacterIsMember:CFStringGetLongCharacterForSurrogatePair(c, low)])
+                return NO;
+        }
+        else if (![nonAsciiSet characterIsMember:c])
+        {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+static BOOL JRStringIsEmailAddress(NSString *string)
+{
+    NSRange at = [string rangeOfString:@"@"];
+    if (at.location == NSNotFound || at.location == 0 || NSMaxRange(at) >= [string length])
+        return NO;
+
+    NSString *local  = [string substringToIndex:at.location];
+    NSString *domain = [string substringFromIndex:NSMaxRange(at)];
+
+    for (NSString *part in @[local, domain])
+        if ([part hasPrefix:@"."] || [part hasSuffix:@"."] || [part rangeOfString:@".."].location != NSNotFound)
+            return NO;
+
+    return [domain rangeOfString:@"."].location != NSNotFound &&
+            JRStringIsInCharacterClass(local, JRCharacterClassEmailLocal) &&
+            JRStringIsInCharacterClass(domain, JRCharacterClassEmailDomain);
+}
+
+void JRValidateCaptureAttribute(id value, NSString *key, NSString *capturePath, unsigned int flags, NSUInteger length,
+                                NSMutableArray *violations)
+{
+    static const struct
+    {
+        unsigned int flag;
+        JRCharacterClass characterClass;
+        __unsafe_unretained NSString *constraint;
+    } formats[] = {
+            { JRCaptureAttributeAlphabetic,       JRCharacterClassAlphabetic,   @"alphabetic" },
+            { JRCaptureAttributeAlphanumeric,     JRCharacterClassAlphanumeric, @"alphanumeric" },
+            { JRCaptureAttributeUnicodeLetters,   JRCharacterClassLetter,       @"unicode-letters" },
+            { JRCaptureAttributeUnicodePrintable, JRCharacterClassPrintable,    @"unicode-printable" },
+    };
+
+    if (flags & JRCaptureAttributeReadOnly)
+        return;
+
+    if (!value || value == [NSNull null])
+    {
+        if (flags & JRCaptureAttributeRequired)
+            [violations addObject:[JRCaptureError constraintViolationErrorDictForAttribute:key atPath:capturePath
+                                                                                constraint:@"required"]];
+        return;
+    }
+
+    if (![value isKindOfClass:[NSString class]])
+        return;
+
+    JRBuildCharacterClassTables();
+
+    if (length && [(NSString *) value length] > length)
+        [violations addObject:[JRCaptureError constraintViolationErrorDictForAttribute:key atPath:capturePath
+                                                                            constraint:@"length"]];
+
+    for (NSUInteger i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+        if ((flags & formats[i].flag) && !JRStringIsInCharacterClass(value, formats[i].characterClass))
+            [violations addObject:[JRCaptureError constraintViolationErrorDictForAttribute:key atPath:capturePath
+                                                                                constraint:formats[i].constraint]];
+
+    if ((flags & JRCaptureAttributeEmailAddress) && !JRStringIsEmailAddress(value))
+        [violations addObject:[JRCaptureError constraintViolationErrorDictForAttribute:key atPath:capturePath
+                                                                            constraint:@"email-address"]];
+}
+
 @interface JRCaptureObjectApidHandler : NSObject <JRCaptureInternalDelegate>
 @end
 
@@ -313,6 +611,18 @@
     {
         newArray = [resultsArray arrayOfStringsFromStringPluralDictionariesWithType:elementType];
     }
+    else if ([[captureObject class] captureSchema])
+    {
+        const JRCaptureAttribute *attribute = JRAttributeForPropertyName([[captureObject class] captureSchema],
+                                                                         arrayName);
+        if (!attribute)
+        {
+            DLog(@"ERROR! Plural %@ not found", arrayName);
+            return;
+        }
+
+        newArray = JRAttributeValueFromJson(attribute, resultsArray, capturePath, NO);
+    }
     else
     {
         NSString *selName = [NSString stringWithFormat:@"arrayOf%@ElementsFrom%@DictionariesWithPath:", capitalizedName,
@@ -366,169 +676,1178 @@
 }
 @end
 
-@interface JRCaptureObject ()
-@property(nonatomic, readwrite) NSString *captureObjectPath;
-@property(readwrite) BOOL canBeUpdatedOnCapture;
-@property(nonatomic, readwrite) NSMutableSet *dirtyPropertySet;
+/* Collects the updates sent by -[JRCaptureObject updateOnCaptureForDelegate:context:] while batching is on, merges
+   them into as few /entity.update calls as possible, and fans each result back out to the individual objects through
+   JRCaptureObjectApidHandler, which restores each object's own dirty property snapshot on failure. */
+@interface JRCaptureObjectUpdateBatcher : NSObject <JRCaptureInternalDelegate>
+@property(nonatomic) NSTimeInterval window;
+@property(nonatomic) NSMutableArray *pendingUpdates;
+@property(nonatomic) NSUInteger generation;
 @end
 
-@implementation JRCaptureObject
+@implementation JRCaptureObjectUpdateBatcher
++ (JRCaptureObjectUpdateBatcher *)sharedBatcher
+{
+    static JRCaptureObjectUpdateBatcher *sharedBatcher = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        sharedBatcher = [[JRCaptureObjectUpdateBatcher alloc] init];
+    });
+
+    return sharedBatcher;
+}
+
 - (id)init
 {
     if ((self = [super init]))
     {
-        self.dirtyPropertySet = [NSMutableSet setWithCapacity:0];
+        _pendingUpdates = [NSMutableArray array];
     }
+
     return self;
 }
 
-- (id)copyWithZone:(NSZone*)zone __unused
+- (void)setWindow:(NSTimeInterval)window
 {
-    JRCaptureObject *objectCopy = [[[self class] allocWithZone:zone] init];
+    _window = window;
+    if (window <= 0) [self flush];
+}
 
-    for (NSString *dirtyProperty in [self.dirtyPropertySet allObjects])
-        [objectCopy.dirtyPropertySet addObject:dirtyProperty];
+- (void)addUpdate:(NSDictionary *)updateDictionary withContext:(NSDictionary *)context
+{
+    [self.pendingUpdates addObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                         updateDictionary, @"updateDictionary",
+                                                         context, @"context", nil]];
 
-    objectCopy.captureObjectPath      = self.captureObjectPath;
-    objectCopy.canBeUpdatedOnCapture  = self.canBeUpdatedOnCapture;
+    if ([self.pendingUpdates count] > 1) return;
 
-    return objectCopy;
+    /* A flush that happens before the window closes bumps the generation, so this one becomes a no-op */
+    NSUInteger generation = self.generation;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (self.window * NSEC_PER_SEC)),
+                   dispatch_get_main_queue(), ^
+    {
+        if (self.generation == generation) [self flush];
+    });
 }
 
-- (void)encodeWithCoder:(NSCoder *)coder
++ (NSArray *)segmentsForPath:(NSString *)capturePath
 {
-    NSDictionary *dictionary = [self newDictionaryForEncoder:YES];
-    [coder encodeObject:dictionary forKey:cJREncodedCaptureUser];
+    NSMutableArray *segments = [NSMutableArray array];
+    for (NSString *segment in [capturePath componentsSeparatedByString:@"/"])
+        if ([segment length]) [segments addObject:segment];
+
+    return segments;
 }
 
-- (id)initWithCoder:(NSCoder *)coder
++ (NSString *)pathForSegments:(NSArray *)segments
 {
-    if (self = [self init])
+    if (![segments count]) return @"";
+    return [@"/" stringByAppendingString:[segments componentsJoinedByString:@"/"]];
+}
+
+/* Plural elements ("statuses#12") can't be expressed as keys of an update dictionary, so updates can only be merged
+   below the deepest plural element in their path */
++ (NSArray *)anchorSegmentsForSegments:(NSArray *)segments
+{
+    NSUInteger anchorLength = 0;
+    for (NSUInteger i = 0; i < [segments count]; i++)
+        if ([[segments objectAtIndex:i] rangeOfString:@"#"].location != NSNotFound) anchorLength = i + 1;
+
+    return [segments subarrayWithRange:NSMakeRange(0, anchorLength)];
+}
+
++ (void)mergeDictionary:(NSDictionary *)source intoDictionary:(NSMutableDictionary *)target
+{
+    for (NSString *key in source)
     {
-        [self.dirtyPropertySet removeAllObjects];
-        NSDictionary *dictionary = [coder decodeObjectForKey:cJREncodedCaptureUser];
-        if ([self isKindOfClass:[JRCaptureUser class]])
-            [((JRCaptureUser *) self) decodeFromDictionary:dictionary];
+        id value = [source objectForKey:key];
+        id existing = [target objectForKey:key];
+
+        if ([value isKindOfClass:[NSDictionary class]])
+        {
+            if (![existing isKindOfClass:[NSMutableDictionary class]])
+            {
+                existing = [NSMutableDictionary dictionary];
+                [target setObject:existing forKey:key];
+            }
+            [self mergeDictionary:value intoDictionary:existing];
+        }
+        else
+        {
+            [target setObject:value forKey:key];
+        }
     }
+}
 
-    return self;
+- (void)flush
+{
+    self.generation++;
+    if (![self.pendingUpdates count]) return;
+
+    NSArray *updates = self.pendingUpdates;
+    self.pendingUpdates = [NSMutableArray array];
+
+    NSMutableArray *anchors = [NSMutableArray array];
+    NSMutableDictionary *groups = [NSMutableDictionary dictionary];
+    for (NSDictionary *update in updates)
+    {
+        NSString *capturePath = [[update objectForKey:@"context"] objectForKey:@"capturePath"];
+        NSArray *segments = [JRCaptureObjectUpdateBatcher segmentsForPath:capturePath];
+        NSString *anchor = [JRCaptureObjectUpdateBatcher pathForSegments:
+                [JRCaptureObjectUpdateBatcher anchorSegmentsForSegments:segments]];
+
+        NSMutableArray *group = [groups objectForKey:anchor];
+        if (!group)
+        {
+            group = [NSMutableArray array];
+            [groups setObject:group forKey:anchor];
+            [anchors addObject:anchor];
+        }
+        [group addObject:update];
+    }
+
+    for (NSString *anchor in anchors)
+        [self sendGroup:[groups objectForKey:anchor]];
 }
 
-- (NSDictionary *)newDictionaryForEncoder:(BOOL)forEncoder
+- (void)sendGroup:(NSArray *)group
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
+    NSMutableArray *segmentsList = [NSMutableArray arrayWithCapacity:[group count]];
+    NSArray *rootSegments = nil;
+    for (NSDictionary *update in group)
+    {
+        NSArray *segments = [JRCaptureObjectUpdateBatcher segmentsForPath:
+                [[update objectForKey:@"context"] objectForKey:@"capturePath"]];
+        [segmentsList addObject:segments];
+
+        if (!rootSegments)
+        {
+            rootSegments = segments;
+            continue;
+        }
+
+        NSUInteger common = 0;
+        while (common < [rootSegments count] && common < [segments count] &&
+                [[rootSegments objectAtIndex:common] isEqualToString:[segments objectAtIndex:common]])
+            common++;
+        rootSegments = [rootSegments subarrayWithRange:NSMakeRange(0, common)];
+    }
+
+    NSMutableDictionary *mergedDictionary = [NSMutableDictionary dictionary];
+    NSMutableArray *contexts = [NSMutableArray arrayWithCapacity:[group count]];
+    for (NSUInteger i = 0; i < [group count]; i++)
+    {
+        NSDictionary *update = [group objectAtIndex:i];
+        NSArray *segments = [segmentsList objectAtIndex:i];
+
+        NSMutableDictionary *target = mergedDictionary;
+        for (NSUInteger j = [rootSegments count]; j < [segments count]; j++)
+        {
+            NSString *key = [segments objectAtIndex:j];
+            NSMutableDictionary *child = [target objectForKey:key];
+            if (![child isKindOfClass:[NSMutableDictionary class]])
+            {
+                child = [NSMutableDictionary dictionary];
+                [target setObject:child forKey:key];
+            }
+            target = child;
+        }
+
+        [JRCaptureObjectUpdateBatcher mergeDictionary:[update objectForKey:@"updateDictionary"] intoDictionary:target];
+        [contexts addObject:[update objectForKey:@"context"]];
+    }
+
+    DLog(@"Sending %lu batched updates at %@", (unsigned long) [contexts count],
+         [JRCaptureObjectUpdateBatcher pathForSegments:rootSegments]);
+
+    [JRCaptureApidInterface updateCaptureObject:mergedDictionary
+                                         atPath:[JRCaptureObjectUpdateBatcher pathForSegments:rootSegments]
+                                      withToken:[[JRCaptureData sharedCaptureData] accessToken]
+                                    forDelegate:self
+                                    withContext:contexts];
 }
 
-- (NSDictionary *)toUpdateDictionary
+- (void)updateCaptureObjectDidSucceedWithResult:(NSObject *)result context:(NSObject *)context
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
+    for (NSDictionary *objectContext in (NSArray *)context)
+        [[JRCaptureObjectApidHandler captureObjectApidHandler] updateCaptureObjectDidSucceedWithResult:result
+                                                                                               context:objectContext];
 }
 
-- (NSDictionary *)toReplaceDictionary
+- (void)updateCaptureObjectDidFailWithResult:(NSDictionary *)result context:(NSObject *)context
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
+    for (NSDictionary *objectContext in (NSArray *)context)
+        [[JRCaptureObjectApidHandler captureObjectApidHandler] updateCaptureObjectDidFailWithResult:result
+                                                                                            context:objectContext];
 }
+@end
 
-- (NSDictionary*)objectProperties
+/**
+ * A mutable set of property names backed by an object's dirty property bits. Names that are not one of the class's
+ * properties are kept in an ordinary set, so that the set behaves as it did before it was backed by bits.
+ **/
+@interface JRDirtyPropertySet : NSMutableSet
+@property(nonatomic, readonly) JRDirtyPropertyWord *words;
+- (id)initWithPropertyNames:(const char *const *)names count:(NSUInteger)count;
+- (void)addAllProperties;
+- (NSData *)wordsSnapshot;
+- (void)addWordsFromSnapshot:(NSData *)snapshot;
+@end
+
+@implementation JRDirtyPropertySet
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
+    const char *const *_names;
+    NSUInteger _propertyCount;
+    NSUInteger _wordCount;
+    NSMutableSet *_otherNames;
 }
+@synthesize words = _words;
 
-- (NSSet *)setOfAllUpdatableProperties __unused
+- (id)initWithPropertyNames:(const char *const *)names count:(NSUInteger)count
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
+    if ((self = [super init]))
+    {
+        _names = names;
+        _propertyCount = count;
+        _wordCount = JRDirtyPropertyWordCount(count);
+        _words = calloc(MAX(_wordCount, 1), sizeof(JRDirtyPropertyWord));
+    }
+
+    return self;
 }
 
-- (BOOL)needsUpdate
+- (id)init
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return NO;
+    return [self initWithPropertyNames:NULL count:0];
 }
 
-- (NSSet *)updatablePropertySet
+- (id)initWithCapacity:(NSUInteger)capacity
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
+    return [self initWithPropertyNames:NULL count:0];
 }
 
-- (void)setAllPropertiesToDirty
+- (void)dealloc
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    free(_words);
 }
 
-- (void)deepClearDirtyProperties
+- (NSUInteger)indexOfName:(id)name
 {
-    [self.dirtyPropertySet removeAllObjects];
-    unsigned int pCount;
-    objc_property_t *properties = class_copyPropertyList([self class], &pCount);
-    for (int i=0; i<pCount; i++)
-    {
-        NSString *pName = [NSString stringWithUTF8String:property_getName(properties[i])];
-        NSString *pAttr = [NSString stringWithUTF8String:property_getAttributes(properties[i])];
+    if (![name isKindOfClass:[NSString class]]) return NSNotFound;
 
-        SEL pSelector = NSSelectorFromString(pName);
-        if (![self respondsToSelector:pSelector]) continue;
+    const char *utf8Name = [(NSString *) name UTF8String];
+    for (NSUInteger i = 0; i < _propertyCount; i++)
+        if (!strcmp(_names[i], utf8Name)) return i;
 
-        id __unsafe_unretained pVal;
+    return NSNotFound;
+}
 
-        NSMethodSignature *propSignature = [[self class] instanceMethodSignatureForSelector:pSelector];
-        NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
-        if (!propSignature || !propInvoker)
-        {
-            DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(pSelector));
-            return;
-        }
-        [propInvoker setSelector:pSelector];
-        [propInvoker setTarget:self];
-        [propInvoker invoke];
-        [propInvoker getReturnValue:&pVal];
+- (NSUInteger)count
+{
+    NSUInteger count = [_otherNames count];
+    for (NSUInteger i = 0; i < _wordCount; i++)
+        count += __builtin_popcountll(_words[i]);
 
-        if ([pAttr characterAtIndex:1] != '@' || ![pVal isKindOfClass:[JRCaptureObject class]]) continue;
-        [pVal deepClearDirtyProperties];
-    }
-    free(properties);
+    return count;
 }
 
-- (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
+- (id)member:(id)object
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
-    return nil;
-}
+    NSUInteger index = [self indexOfName:object];
+    if (index == NSNotFound) return [_otherNames member:object];
 
+    return JRIsDirtyProperty(_words, index) ? object : nil;
+}
 
-- (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshot
+- (NSEnumerator *)objectEnumerator
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    NSMutableArray *names = [NSMutableArray arrayWithCapacity:[self count]];
+    for (NSUInteger i = 0; i < _propertyCount; i++)
+        if (JRIsDirtyProperty(_words, i)) [names addObject:[NSString stringWithUTF8String:_names[i]]];
+
+    if (_otherNames) [names addObjectsFromArray:[_otherNames allObjects]];
+
+    return [names objectEnumerator];
 }
 
-- (void)updateFromDictionary:(__unused NSDictionary *)dictionary withPath:(__unused NSString *)capturePath __unused
+- (void)addObject:(id)object
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    NSUInteger index = [self indexOfName:object];
+    if (index != NSNotFound)
+        JRSetDirtyProperty(_words, index);
+    else
+        [(_otherNames ? _otherNames : (_otherNames = [NSMutableSet set])) addObject:object];
 }
 
-- (void)replaceFromDictionary:(NSDictionary *)dictionary withPath:(NSString *)capturePath
+- (void)removeObject:(id)object
 {
-    [NSException raise:NSInternalInconsistencyException
-                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    NSUInteger index = [self indexOfName:object];
+    if (index != NSNotFound)
+        _words[index / JRDirtyPropertyWordBits] &= ~((JRDirtyPropertyWord) 1 << (index % JRDirtyPropertyWordBits));
+    else
+        [_otherNames removeObject:object];
 }
 
-- (void)updateOnCaptureForDelegate:(id <JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+- (void)removeAllObjects
+{
+    memset(_words, 0, _wordCount * sizeof(JRDirtyPropertyWord));
+    [_otherNames removeAllObjects];
+}
+
+- (void)addAllProperties
+{
+    for (NSUInteger i = 0; i < _propertyCount; i++)
+        JRSetDirtyProperty(_words, i);
+}
+
+- (BOOL)hasSamePropertiesAsSet:(NSSet *)otherSet
+{
+    return [otherSet isKindOfClass:[JRDirtyPropertySet class]] && ((JRDirtyPropertySet *) otherSet)->_names == _names;
+}
+
+- (void)setSet:(NSSet *)otherSet
+{
+    if (![self hasSamePropertiesAsSet:otherSet])
+    {
+        [super setSet:otherSet];
+        return;
+    }
+
+    JRDirtyPropertySet *otherDirtyPropertySet = (JRDirtyPropertySet *) otherSet;
+    memcpy(_words, otherDirtyPropertySet->_words, _wordCount * sizeof(JRDirtyPropertyWord));
+    if (_otherNames || otherDirtyPropertySet->_otherNames)
+        _otherNames = [otherDirtyPropertySet->_otherNames mutableCopy];
+}
+
+- (BOOL)isEqual:(id)object
+{
+    return [object isKindOfClass:[NSSet class]] && [self isEqualToSet:object];
+}
+
+- (BOOL)isEqualToSet:(NSSet *)otherSet
+{
+    if (![self hasSamePropertiesAsSet:otherSet]) return [super isEqualToSet:otherSet];
+
+    JRDirtyPropertySet *otherDirtyPropertySet = (JRDirtyPropertySet *) otherSet;
+    if (memcmp(_words, otherDirtyPropertySet->_words, _wordCount * sizeof(JRDirtyPropertyWord))) return NO;
+
+    return [_otherNames count] == [otherDirtyPropertySet->_otherNames count] &&
+            (![_otherNames count] || [_otherNames isEqualToSet:otherDirtyPropertySet->_otherNames]);
+}
+
+- (NSData *)wordsSnapshot
+{
+    return [NSData dataWithBytes:_words length:_wordCount * sizeof(JRDirtyPropertyWord)];
+}
+
+- (void)addWordsFromSnapshot:(NSData *)snapshot
+{
+    const JRDirtyPropertyWord *snapshotWords = [snapshot bytes];
+    NSUInteger snapshotWordCount = MIN(_wordCount, [snapshot length] / sizeof(JRDirtyPropertyWord));
+    for (NSUInteger i = 0; i < snapshotWordCount; i++)
+        _words[i] |= snapshotWords[i];
+}
+@end
+
+@interface JRCaptureObject ()
+@property(nonatomic, readwrite) NSString *captureObjectPath;
+@property(readwrite) BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JRCaptureObject
+{
+    JRDirtyPropertySet *_dirtyPropertySet;
+    JRDirtyPropertyWord *_dirtyPropertyWords;
+    const JRCaptureSchema *_schema;
+    __strong id *_attributeValues;
+}
+
+/* Sets a table mode property the way a generated setter would: marks it dirty, copies values, and marks all of a new
+   sub-object's properties dirty */
+static void JRSetAttributeValue(JRCaptureObject *object, NSUInteger index, id value)
+{
+    const JRCaptureAttribute *attribute = &object->_schema->attributes[index];
+
+    if (attribute->dirtyProperty >= 0)
+        JRSetDirtyProperty(object->_dirtyPropertyWords, (NSUInteger) attribute->dirtyProperty);
+
+    if (attribute->type == JRCaptureAttributeTypeObject)
+    {
+        object->_attributeValues[index] = value;
+        [(JRCaptureObject *)value setAllPropertiesToDirty];
+    }
+    else
+    {
+        object->_attributeValues[index] = [value copy];
+    }
+}
+
+static const JRCaptureSchema *JRCaptureSchemaOrRaise(id objectOrClass, SEL selector)
+{
+    const JRCaptureSchema *schema = [[objectOrClass class] captureSchema];
+    if (!schema)
+        [NSException raise:NSInternalInconsistencyException
+                    format:@"You must override %@ in a subclass", NSStringFromSelector(selector)];
+
+    return schema;
+}
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        _dirtyPropertySet = [[JRDirtyPropertySet alloc] initWithPropertyNames:[[self class] dirtyPropertyNames]
+                                                                        count:[[self class] dirtyPropertyCount]];
+        _dirtyPropertyWords = _dirtyPropertySet.words;
+
+        if ((_schema = [[self class] captureSchema]))
+        {
+            _attributeValues = (__strong id *) calloc(_schema->attributeCount, sizeof(id));
+
+            self.captureObjectPath     = _schema->path;
+            self.canBeUpdatedOnCapture = !_schema->hasPluralParent;
+
+            for (NSUInteger i = 0; i < _schema->attributeCount; i++)
+                if (_schema->attributes[i].type == JRCaptureAttributeTypeObject)
+                    _attributeValues[i] = [[objc_getClass(_schema->attributes[i].className) alloc] init];
+
+            [self setAllPropertiesToDirty];
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_attributeValues)
+    {
+        for (NSUInteger i = 0; i < _schema->attributeCount; i++)
+            _attributeValues[i] = nil;
+
+        free(_attributeValues);
+    }
+}
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return NULL;
+}
+
+/* Table mode classes declare their properties @dynamic, and get their getters and setters here the first time
+   each is called */
++ (BOOL)resolveInstanceMethod:(SEL)selector
+{
+    const JRCaptureSchema *schema = [self captureSchema];
+    const char *name = sel_getName(selector);
+    size_t length = strlen(name);
+
+    for (NSUInteger i = 0; schema && i < schema->attributeCount; i++)
+    {
+        const char *propertyName = [schema->attributes[i].propertyName UTF8String];
+        size_t propertyLength = strlen(propertyName);
+
+        if (length == propertyLength && memcmp(name, propertyName, length) == 0)
+        {
+            IMP getter = imp_implementationWithBlock(^id (JRCaptureObject *object)
+            {
+                return object->_attributeValues[i];
+            });
+
+            return class_addMethod(self, selector, getter, "@@:");
+        }
+
+        if (length == propertyLength + 4 && memcmp(name, "set", 3) == 0 && name[3] == toupper(propertyName[0]) &&
+                memcmp(name + 4, propertyName + 1, propertyLength - 1) == 0 && name[length - 1] == ':')
+        {
+            IMP setter = imp_implementationWithBlock(^(JRCaptureObject *object, id value)
+            {
+                JRSetAttributeValue(object, i, value);
+            });
+
+            return class_addMethod(self, selector, setter, "v@:@");
+        }
+    }
+
+    return [super resolveInstanceMethod:selector];
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return NULL;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return 0;
+}
+
++ (NSArray *)attributeProjection
+{
+    return nil;
+}
+
++ (BOOL)isPartialProjection
+{
+    return NO;
+}
+
+- (NSMutableSet *)dirtyPropertySet
+{
+    return _dirtyPropertySet;
+}
+
+- (JRDirtyPropertyWord *)dirtyPropertyWords
+{
+    return _dirtyPropertyWords;
+}
+
+- (NSData *)dirtyPropertyWordsSnapshot
+{
+    return [_dirtyPropertySet wordsSnapshot];
+}
+
+- (void)restoreDirtyPropertyWordsFromSnapshot:(NSData *)snapshot
+{
+    [_dirtyPropertySet addWordsFromSnapshot:snapshot];
+}
+
+- (id)copyWithZone:(NSZone*)zone __unused
+{
+    JRCaptureObject *objectCopy = [[[self class] allocWithZone:zone] init];
+
+    [objectCopy.dirtyPropertySet setSet:self.dirtyPropertySet];
+
+    objectCopy.captureObjectPath      = self.captureObjectPath;
+    objectCopy.canBeUpdatedOnCapture  = self.canBeUpdatedOnCapture;
+
+    /* Straight into the slots, since the setters would mark every property of the copy dirty again. Sub-objects are
+       copied too, so the copy doesn't share the original's, or change their dirty properties */
+    for (NSUInteger i = 0; _schema && i < _schema->attributeCount; i++)
+        objectCopy->_attributeValues[i] = [_attributeValues[i] copy];
+
+    return objectCopy;
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder
+{
+    NSDictionary *dictionary = [self newDictionaryForEncoder:YES];
+    [coder encodeObject:dictionary forKey:cJREncodedCaptureUser];
+}
+
+- (id)initWithCoder:(NSCoder *)coder
+{
+    if (self = [self init])
+    {
+        [self.dirtyPropertySet removeAllObjects];
+        NSDictionary *dictionary = [coder decodeObjectForKey:cJREncodedCaptureUser];
+        if ([self isKindOfClass:[JRCaptureUser class]])
+            [((JRCaptureUser *) self) decodeFromDictionary:dictionary];
+    }
+
+    return self;
+}
+
+- (NSDictionary *)newDictionaryForEncoder:(BOOL)forEncoder
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:schema->attributeCount + 3];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &schema->attributes[i];
+        id value = _attributeValues[i];
+
+        [dictionary setObject:(value ? JRJsonFromAttributeValue(attribute, value, forEncoder) : [NSNull null])
+                       forKey:attribute->key];
+    }
+
+    if (forEncoder)
+    {
+        [dictionary setObject:[self.dirtyPropertySet allObjects] forKey:@"dirtyPropertiesSet"];
+        [dictionary setObject:(self.captureObjectPath ? self.captureObjectPath : [NSNull null])
+                       forKey:@"captureObjectPath"];
+        [dictionary setObject:[NSNumber numberWithBool:self.canBeUpdatedOnCapture]
+                       forKey:@"canBeUpdatedOnCapture"];
+    }
+
+    return [NSDictionary dictionaryWithDictionary:dictionary];
+}
+
+static void JRSetAttributesFromDictionary(JRCaptureObject *object, NSDictionary *dictionary, BOOL fromDecoder)
+{
+    const JRCaptureSchema *schema = object->_schema;
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        id json = [dictionary objectForKey:schema->attributes[i].key];
+        JRSetAttributeValue(object, i, json != [NSNull null] ?
+                JRAttributeValueFromJson(&schema->attributes[i], json, object.captureObjectPath, fromDecoder) : nil);
+    }
+}
+
++ (id)captureObjectFromDictionary:(NSDictionary *)dictionary withPath:(NSString *)capturePath
+                      fromDecoder:(BOOL)fromDecoder
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    if (!dictionary)
+        return nil;
+
+    JRCaptureObject *captureObject = [[self alloc] init];
+
+    NSSet *dirtyPropertySetCopy = nil;
+    if (fromDecoder)
+    {
+        dirtyPropertySetCopy = [NSSet setWithArray:[dictionary objectForKey:@"dirtyPropertiesSet"]];
+        captureObject.captureObjectPath = ([dictionary objectForKey:@"captureObjectPath"] == [NSNull null] ?
+                                           nil : [dictionary objectForKey:@"captureObjectPath"]);
+        if (schema->hasPluralParent)
+            captureObject.canBeUpdatedOnCapture =
+                    [(NSNumber *)[dictionary objectForKey:@"canBeUpdatedOnCapture"] boolValue];
+    }
+    else if (schema->hasPluralParent)
+    {
+        captureObject.captureObjectPath     = JRCaptureObjectPath(schema, capturePath, [dictionary objectForKey:@"id"]);
+        captureObject.canBeUpdatedOnCapture = YES;
+    }
+
+    JRSetAttributesFromDictionary(captureObject, dictionary, fromDecoder);
+
+    if (fromDecoder)
+        [captureObject.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    else
+        [captureObject.dirtyPropertySet removeAllObjects];
+
+    return captureObject;
+}
+
+- (void)decodeAttributesFromDictionary:(NSDictionary *)dictionary
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSSet *dirtyPropertySetCopy = [NSSet setWithArray:[dictionary objectForKey:@"dirtyPropertiesSet"]];
+
+    self.captureObjectPath     = schema->path;
+    self.canBeUpdatedOnCapture = YES;
+
+    JRSetAttributesFromDictionary(self, dictionary, YES);
+
+    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+}
+
++ (id)captureObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    if (![reader beginObject])
+        return nil;
+
+    JRCaptureObject *captureObject = [[self alloc] init];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    id elementId = nil;
+    NSUInteger hint = 0;
+    const char *key;
+    size_t keyLength;
+
+    if (schema->hasPluralParent && !schema->isPluralElement)
+    {
+        captureObject.captureObjectPath     = JRCaptureObjectPath(schema, capturePath, nil);
+        captureObject.canBeUpdatedOnCapture = YES;
+    }
+
+    /* Whatever ...FromDictionary: would leave for a missing key */
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        captureObject->_attributeValues[i] = JRAttributeValueFromJson(&schema->attributes[i], nil, nil, NO);
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        NSUInteger index = JRAttributeIndexForKey(schema, key, keyLength, hint);
+        const JRCaptureAttribute *attribute = index != NSNotFound ? &schema->attributes[index] : NULL;
+        BOOL isElementId = schema->isPluralElement && JRJsonKeyEquals(key, keyLength, "id");
+        BOOL isContainer = attribute && (attribute->type == JRCaptureAttributeTypeObject ||
+                                         attribute->type == JRCaptureAttributeTypePlural);
+        id value;
+
+        if (attribute)
+            hint = index + 1;
+
+        /* An element's path depends on its id, which may come last, so its sub-objects and plurals are kept as JSON
+           until the path is known */
+        if (isContainer && schema->isPluralElement)
+        {
+            if ((value = [reader readValue]))
+                [dictionary setObject:value forKey:attribute->key];
+        }
+        else if (isContainer && attribute->type == JRCaptureAttributeTypeObject)
+        {
+            JRSetAttributeValue(captureObject, index,
+                                [objc_getClass(attribute->className) captureObjectFromJsonReader:reader
+                                                                        withPath:captureObject.captureObjectPath]);
+        }
+        else if (isContainer)
+        {
+            JRSetAttributeValue(captureObject, index,
+                                JRElementsFromJsonReader(attribute, reader, captureObject.captureObjectPath));
+        }
+        else if (attribute || isElementId)
+        {
+            value = [reader readValue];
+            if (isElementId)
+                elementId = value;
+            if (attribute)
+                JRSetAttributeValue(captureObject, index, value != [NSNull null] ?
+                                    JRAttributeValueFromJson(attribute, value, nil, NO) : nil);
+        }
+        else
+        {
+            [reader skipValue];
+        }
+    }
+
+    if (schema->isPluralElement)
+    {
+        captureObject.captureObjectPath     = JRCaptureObjectPath(schema, capturePath, elementId);
+        captureObject.canBeUpdatedOnCapture = YES;
+
+        for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        {
+            const JRCaptureAttribute *attribute = &schema->attributes[i];
+            if (attribute->type != JRCaptureAttributeTypeObject && attribute->type != JRCaptureAttributeTypePlural)
+                continue;
+
+            id json = [dictionary objectForKey:attribute->key];
+            JRSetAttributeValue(captureObject, i, json != [NSNull null] ?
+                    JRAttributeValueFromJson(attribute, json, captureObject.captureObjectPath, NO) : nil);
+        }
+    }
+
+    [captureObject.dirtyPropertySet removeAllObjects];
+
+    return captureObject;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &schema->attributes[i];
+        id value = _attributeValues[i];
+
+        [writer writeKey:attribute->key];
+        if (attribute->type == JRCaptureAttributeTypeObject && value)
+        {
+            [(JRCaptureObject *)value writeToArchive:writer];
+        }
+        else if (attribute->type == JRCaptureAttributeTypePlural && value)
+        {
+            Class elementClass = objc_getClass(attribute->className);
+
+            [writer beginArray];
+            for (NSObject *element in (NSArray *)value)
+                if ([element isKindOfClass:elementClass])
+                    [(JRCaptureObject *)element writeToArchive:writer];
+            [writer endArray];
+        }
+        else if (attribute->type == JRCaptureAttributeTypeObject || attribute->type == JRCaptureAttributeTypePlural)
+        {
+            [writer writeNull];
+        }
+        else
+        {
+            [writer writeValue:(value ? JRJsonFromAttributeValue(attribute, value, NO) : nil)];
+        }
+    }
+
+    [writer endObject];
+}
+
++ (id)captureObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    if (![reader beginObject])
+        return nil;
+
+    JRCaptureObject *captureObject = [[self alloc] init];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    captureObject.captureObjectPath = [reader readString];
+    captureObject.canBeUpdatedOnCapture = [reader readBool];
+    NSUInteger hint = 0;
+    const char *key;
+    size_t keyLength;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        NSUInteger index = JRAttributeIndexForKey(schema, key, keyLength, hint);
+        if (index == NSNotFound)
+        {
+            [reader skipValue];
+            continue;
+        }
+
+        const JRCaptureAttribute *attribute = &schema->attributes[index];
+        hint = index + 1;
+
+        if (attribute->type == JRCaptureAttributeTypeObject)
+        {
+            JRSetAttributeValue(captureObject, index,
+                                [objc_getClass(attribute->className) captureObjectFromArchive:reader]);
+        }
+        else if (attribute->type == JRCaptureAttributeTypePlural)
+        {
+            JRSetAttributeValue(captureObject, index, JRElementsFromArchive(attribute, reader));
+        }
+        else
+        {
+            id value = [reader readValue];
+            JRSetAttributeValue(captureObject, index, value != [NSNull null] ?
+                                JRAttributeValueFromJson(attribute, value, nil, NO) : nil);
+        }
+    }
+
+    [captureObject.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return captureObject;
+}
+
+- (NSDictionary *)toUpdateDictionary
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:10];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &schema->attributes[i];
+        id value = _attributeValues[i];
+
+        if (attribute->flags & JRCaptureAttributeReadOnly || attribute->dirtyProperty < 0)
+            continue;
+
+        BOOL isDirty = JRIsDirtyProperty(_dirtyPropertyWords, (NSUInteger) attribute->dirtyProperty);
+        if (attribute->type == JRCaptureAttributeTypeObject)
+        {
+            /* Use the default constructor to create an empty object */
+            if (isDirty)
+                [dictionary setObject:[(value ? value : [[objc_getClass(attribute->className) alloc] init])
+                                                      toUpdateDictionary]
+                               forKey:attribute->key];
+            else if ([(JRCaptureObject *)value needsUpdate])
+                [dictionary setObject:[(JRCaptureObject *)value toUpdateDictionary] forKey:attribute->key];
+        }
+        else if (isDirty)
+        {
+            [dictionary setObject:(value ? JRJsonFromAttributeValue(attribute, value, NO) : [NSNull null])
+                           forKey:attribute->key];
+        }
+    }
+
+    [self.dirtyPropertySet removeAllObjects];
+
+    return [NSDictionary dictionaryWithDictionary:dictionary];
+}
+
+- (NSDictionary *)toReplaceDictionary
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:10];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &schema->attributes[i];
+        id value = _attributeValues[i];
+        id json;
+
+        if (attribute->flags & JRCaptureAttributeReadOnly)
+            continue;
+
+        if (attribute->type == JRCaptureAttributeTypeObject)
+        {
+            /* Use the default constructor to create an empty object */
+            json = value ? [(JRCaptureObject *)value toReplaceDictionary] :
+                           [[[objc_getClass(attribute->className) alloc] init] toUpdateDictionary];
+        }
+        else if (attribute->type == JRCaptureAttributeTypePlural)
+        {
+            NSMutableArray *elements = [NSMutableArray arrayWithCapacity:[(NSArray *)value count]];
+            Class elementClass = objc_getClass(attribute->className);
+            for (NSObject *element in (NSArray *)value)
+                if ([element isKindOfClass:elementClass])
+                    [elements addObject:[(JRCaptureObject *)element toReplaceDictionary]];
+
+            json = elements;
+        }
+        else if (attribute->type == JRCaptureAttributeTypeStringPlural)
+        {
+            json = value ? value : [NSArray array];
+        }
+        else
+        {
+            json = value ? JRJsonFromAttributeValue(attribute, value, NO) : [NSNull null];
+        }
+
+        [dictionary setObject:json forKey:attribute->key];
+    }
+
+    [self.dirtyPropertySet removeAllObjects];
+
+    return [NSDictionary dictionaryWithDictionary:dictionary];
+}
+
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    if (!_schema)
+    {
+        [writer writeValue:[self toUpdateDictionary]];
+        return;
+    }
+
+    [writer beginObject];
+
+    for (NSUInteger i = 0; i < _schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &_schema->attributes[i];
+        id value = _attributeValues[i];
+
+        if (attribute->flags & JRCaptureAttributeReadOnly || attribute->dirtyProperty < 0)
+            continue;
+
+        BOOL isDirty = JRIsDirtyProperty(_dirtyPropertyWords, (NSUInteger) attribute->dirtyProperty);
+        if (attribute->type == JRCaptureAttributeTypeObject && (isDirty || [(JRCaptureObject *)value needsUpdate]))
+        {
+            [writer writeKey:attribute->key];
+            [(value ? value : [[objc_getClass(attribute->className) alloc] init]) writeUpdateJsonToWriter:writer];
+        }
+        else if (attribute->type != JRCaptureAttributeTypeObject && isDirty)
+        {
+            [writer writeKey:attribute->key];
+            [writer writeValue:(value ? JRJsonFromAttributeValue(attribute, value, NO) : nil)];
+        }
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    if (!_schema)
+    {
+        [writer writeValue:[self toReplaceDictionary]];
+        return;
+    }
+
+    [writer beginObject];
+
+    for (NSUInteger i = 0; i < _schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &_schema->attributes[i];
+        id value = _attributeValues[i];
+
+        if (attribute->flags & JRCaptureAttributeReadOnly)
+            continue;
+
+        [writer writeKey:attribute->key];
+        if (attribute->type == JRCaptureAttributeTypeObject)
+        {
+            if (value)
+                [(JRCaptureObject *)value writeReplaceJsonToWriter:writer];
+            else /* Use the default constructor to create an empty object */
+                [[[objc_getClass(attribute->className) alloc] init] writeUpdateJsonToWriter:writer];
+        }
+        else if (attribute->type == JRCaptureAttributeTypePlural)
+        {
+            Class elementClass = objc_getClass(attribute->className);
+
+            [writer beginArray];
+            for (NSObject *element in (NSArray *)value)
+                if ([element isKindOfClass:elementClass])
+                    [(JRCaptureObject *)element writeReplaceJsonToWriter:writer];
+            [writer endArray];
+        }
+        else if (attribute->type == JRCaptureAttributeTypeStringPlural)
+        {
+            [writer writeValue:(value ? value : [NSArray array])];
+        }
+        else
+        {
+            [writer writeValue:(value ? JRJsonFromAttributeValue(attribute, value, NO) : nil)];
+        }
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (NSDictionary*)objectProperties
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:schema->attributeCount];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        [dictionary setObject:schema->attributes[i].typeName forKey:schema->attributes[i].propertyName];
+
+    return [NSDictionary dictionaryWithDictionary:dictionary];
+}
+
+- (NSSet *)setOfAllUpdatableProperties __unused
+{
+    [NSException raise:NSInternalInconsistencyException
+                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    return nil;
+}
+
+- (BOOL)needsUpdate
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+
+    if ([self.dirtyPropertySet count])
+        return YES;
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        if (schema->attributes[i].type == JRCaptureAttributeTypeObject &&
+                [(JRCaptureObject *)_attributeValues[i] needsUpdate])
+            return YES;
+
+    return NO;
+}
+
+- (NSArray *)validate
+{
+    NSMutableArray *violations = [NSMutableArray array];
+    [self validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    NSMutableArray *errors = [NSMutableArray arrayWithCapacity:[violations count]];
+    for (NSDictionary *violation in violations)
+        [errors addObject:[JRCaptureError errorFromResult:violation onProvider:nil engageToken:nil]];
+
+    return errors;
+}
+
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    for (NSUInteger i = 0; _schema && i < _schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &_schema->attributes[i];
+
+        if (attribute->type == JRCaptureAttributeTypeObject)
+        {
+            [(JRCaptureObject *)_attributeValues[i] validateIntoViolations:violations
+                                                       dirtyPropertiesOnly:dirtyPropertiesOnly];
+        }
+        else if (attribute->type == JRCaptureAttributeTypePlural)
+        {
+            if (dirtyPropertiesOnly)
+                continue;
+
+            for (JRCaptureObject *element in (NSArray *)_attributeValues[i])
+                [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+        }
+        else if (attribute->type != JRCaptureAttributeTypeStringPlural && (!dirtyPropertiesOnly ||
+                JRIsDirtyProperty(_dirtyPropertyWords, (NSUInteger) attribute->dirtyProperty)))
+        {
+            JRValidateCaptureAttribute(_attributeValues[i], attribute->key, self.captureObjectPath, attribute->flags,
+                                       attribute->length, violations);
+        }
+    }
+}
+
+- (NSSet *)updatablePropertySet
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSMutableSet *updatablePropertySet = [NSMutableSet setWithCapacity:schema->attributeCount];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        if (schema->attributes[i].dirtyProperty >= 0)
+            [updatablePropertySet addObject:schema->attributes[i].propertyName];
+
+    return updatablePropertySet;
+}
+
+- (void)setAllPropertiesToDirty
+{
+    [_dirtyPropertySet addAllProperties];
+}
+
+- (void)deepClearDirtyProperties
+{
+    [self.dirtyPropertySet removeAllObjects];
+
+    for (NSUInteger i = 0; _schema && i < _schema->attributeCount; i++)
+        if (_schema->attributes[i].type == JRCaptureAttributeTypeObject)
+            [(JRCaptureObject *)_attributeValues[i] deepClearDirtyProperties];
+}
+
+- (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    NSMutableDictionary *snapshotDictionary = [NSMutableDictionary dictionaryWithCapacity:10];
+
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:schema->name];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        if (schema->attributes[i].type == JRCaptureAttributeTypeObject && _attributeValues[i])
+            [snapshotDictionary setObject:[_attributeValues[i] snapshotDictionaryFromDirtyPropertySet]
+                                   forKey:schema->attributes[i].propertyName];
+
+    return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
+}
+
+
+- (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshot
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+
+    if ([snapshot objectForKey:schema->name])
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshot objectForKey:schema->name]];
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+        if (schema->attributes[i].type == JRCaptureAttributeTypeObject &&
+                [snapshot objectForKey:schema->attributes[i].propertyName])
+            [(JRCaptureObject *)_attributeValues[i] restoreDirtyPropertiesFromSnapshotDictionary:
+                    [snapshot objectForKey:schema->attributes[i].propertyName]];
+}
+
+- (void)updateFromDictionary:(__unused NSDictionary *)dictionary withPath:(__unused NSString *)capturePath __unused
+{
+    [NSException raise:NSInternalInconsistencyException
+                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+}
+
+- (void)replaceFromDictionary:(NSDictionary *)dictionary withPath:(NSString *)capturePath
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    DLog(@"%@ %@", capturePath, [dictionary description]);
+
+    NSData *dirtyPropertyWordsCopy = [self dirtyPropertyWordsSnapshot];
+
+    self.canBeUpdatedOnCapture = YES;
+    if (schema->hasPluralParent)
+        self.captureObjectPath = JRCaptureObjectPath(schema, capturePath, [dictionary objectForKey:@"id"]);
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &schema->attributes[i];
+        id json = [dictionary objectForKey:attribute->key];
+
+        if (attribute->type != JRCaptureAttributeTypeObject)
+            JRSetAttributeValue(self, i, json != [NSNull null] ?
+                                JRAttributeValueFromJson(attribute, json, self.captureObjectPath, NO) : nil);
+        else if (!json || json == [NSNull null])
+            JRSetAttributeValue(self, i, nil);
+        else if (!_attributeValues[i])
+            JRSetAttributeValue(self, i, JRAttributeValueFromJson(attribute, json, self.captureObjectPath, NO));
+        else
+            [(JRCaptureObject *)_attributeValues[i] replaceFromDictionary:json withPath:self.captureObjectPath];
+    }
+
+    memcpy(_dirtyPropertyWords, [dirtyPropertyWordsCopy bytes], [dirtyPropertyWordsCopy length]);
+}
+
+- (void)updateOnCaptureForDelegate:(id <JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     NSDictionary *newContext = [NSDictionary dictionaryWithObjectsAndKeys:
                                                      self, @"captureObject",
@@ -538,11 +1857,6 @@
                                                      delegate, @"delegate",
                                                      context, @"callerContext", nil];
 
-    NSDictionary *updateDictionary = [self toUpdateDictionary];
-
-//    /* Removing the objects from the set here, because if there's an error, they will all get put back anyway... */
-//    [dirtyPropertySet removeAllObjects];
-
     if (!self.canBeUpdatedOnCapture)
     {
         NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorInvalidArrayElement];
@@ -557,11 +1871,54 @@
         return;
     }
 
-    [JRCaptureApidInterface updateCaptureObject:updateDictionary
-                                         atPath:self.captureObjectPath
-                                      withToken:[[JRCaptureData sharedCaptureData] accessToken]
-                                    forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler]
-                                    withContext:newContext];
+    /* Capture would only reject an update that violates the schema's constraints, so fail it here instead */
+    NSMutableArray *violations = [NSMutableArray array];
+    [self validateIntoViolations:violations dirtyPropertiesOnly:YES];
+    if ([violations count])
+    {
+        [[JRCaptureObjectApidHandler captureObjectApidHandler] updateCaptureObjectDidFailWithResult:violations[0]
+                                                                                            context:newContext];
+        return;
+    }
+
+    if ([JRCaptureObjectUpdateBatcher sharedBatcher].window > 0)
+    {
+        [[JRCaptureObjectUpdateBatcher sharedBatcher] addUpdate:[self toUpdateDictionary] withContext:newContext];
+        return;
+    }
+
+    [JRCaptureApidInterface updateCaptureObjectWithAttributes:^(JRJsonFormWriter *writer)
+    {
+        [self writeUpdateJsonToWriter:writer];
+    } atPath:self.captureObjectPath withToken:[[JRCaptureData sharedCaptureData] accessToken]
+      forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler] withContext:newContext];
+}
+
++ (void)setUpdateBatchingWindow:(NSTimeInterval)window
+{
+    [JRCaptureObjectUpdateBatcher sharedBatcher].window = window;
+}
+
++ (NSTimeInterval)updateBatchingWindow
+{
+    return [JRCaptureObjectUpdateBatcher sharedBatcher].window;
+}
+
++ (void)flushBatchedUpdates
+{
+    [[JRCaptureObjectUpdateBatcher sharedBatcher] flush];
+}
+
+static BOOL materializesLazily = NO;
+
++ (void)setMaterializesLazily:(BOOL)lazily
+{
+    materializesLazily = lazily;
+}
+
++ (BOOL)materializesLazily
+{
+    return materializesLazily;
 }
 
 - (void)replaceOnCaptureForDelegate:(id <JRCaptureObjectDelegate>)delegate context:(NSObject *)context __unused
@@ -587,11 +1944,26 @@
         return;
     }
 
-    [JRCaptureApidInterface replaceCaptureObject:[self toReplaceDictionary]
-                                          atPath:self.captureObjectPath
-                                       withToken:[[JRCaptureData sharedCaptureData] accessToken]
-                                     forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler]
-                                     withContext:newContext];
+    if ([[self class] isPartialProjection])
+    {
+        NSNumber *errCode = [NSNumber numberWithInteger:JRCaptureLocalApidErrorPartialProjection];
+        NSDictionary *errDict = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                      @"error", @"stat",
+                                                      @"partial_projection", @"error",
+                                                      @"This object was generated with only some of its attributes, and replacing it would delete the rest on Capture; update it instead",
+                                                      @"error_description",
+                                                      errCode, @"code", nil];
+        [[JRCaptureObjectApidHandler captureObjectApidHandler] replaceCaptureObjectDidFailWithResult:errDict
+                                                                                             context:newContext];
+
+        return;
+    }
+
+    [JRCaptureApidInterface replaceCaptureObjectWithAttributes:^(JRJsonFormWriter *writer)
+    {
+        [self writeReplaceJsonToWriter:writer];
+    } atPath:self.captureObjectPath withToken:[[JRCaptureData sharedCaptureData] accessToken]
+      forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler] withContext:newContext];
 }
 
 - (void)replaceArrayOnCapture:(NSArray *)array named:(NSString *)arrayName isArrayOfStrings:(BOOL)isStringArray
@@ -605,32 +1977,18 @@
                     [arrayName stringByReplacingCharactersInRange:NSMakeRange(0,1)
                                                        withString:[[arrayName substringToIndex:1] capitalizedString]];
 
-    NSArray *serialized;
-
-    if (!isStringArray)
+    /* Arrays of plural elements write themselves with their generated NSArray category method, or, in table mode,
+       element by element */
+    SEL writeSelector = NULL;
+    if (!isStringArray && !_schema)
     {
-        NSString *selectorString = [NSString stringWithFormat:
-                @"arrayOf%@ReplaceDictionariesFrom%@Elements",
-                        capitalizedName,
-                        capitalizedName];
-        SEL pSelector = NSSelectorFromString(selectorString);
-        NSMethodSignature *propSignature = [[array class] instanceMethodSignatureForSelector:pSelector];
-        NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
-        if (!propSignature || !propInvoker)
+        writeSelector = NSSelectorFromString([NSString stringWithFormat:@"writeReplaceJsonOf%@ElementsToWriter:",
+                                                                        capitalizedName]);
+        if (![array respondsToSelector:writeSelector])
         {
-            DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(pSelector));
+            DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(writeSelector));
             return;
         }
-        [propInvoker setSelector:pSelector];
-        [propInvoker setTarget:array];
-        [propInvoker invoke];
-        id __unsafe_unretained result;
-        [propInvoker getReturnValue:&result];
-        serialized = (NSArray *)result;
-    }
-    else
-    {
-        serialized = array;
     }
 
     NSDictionary *newContext = [NSDictionary dictionaryWithObjectsAndKeys:
@@ -642,11 +2000,27 @@
                                                      delegate, @"delegate",
                                                      context, @"callerContext", nil];
 
-    [JRCaptureApidInterface replaceCaptureArray:serialized
-                                         atPath:captureArrayPath
-                                      withToken:[[JRCaptureData sharedCaptureData] accessToken]
-                                    forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler]
-                                    withContext:newContext];
+    [JRCaptureApidInterface replaceCaptureArrayWithAttributes:^(JRJsonFormWriter *writer)
+    {
+        if (isStringArray)
+        {
+            [writer writeValue:array];
+        }
+        else if (!writeSelector)
+        {
+            [writer beginArray];
+            for (JRCaptureObject *element in array)
+                [element writeReplaceJsonToWriter:writer];
+            [writer endArray];
+        }
+        else
+        {
+            void (*writeElements)(id, SEL, JRJsonFormWriter *) =
+                    (void (*)(id, SEL, JRJsonFormWriter *)) [array methodForSelector:writeSelector];
+            writeElements(array, writeSelector, writer);
+        }
+    } atPath:captureArrayPath withToken:[[JRCaptureData sharedCaptureData] accessToken]
+      forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler] withContext:newContext];
 }
 
 + (void)testCaptureObjectApidHandlerUpdateCaptureObjectDidFailWithResult:(NSDictionary *)result
@@ -697,54 +2071,75 @@
     if (![self.dirtyPropertySet isEqual:otherObj.dirtyPropertySet]) return NO;
     if (self.canBeUpdatedOnCapture != otherObj.canBeUpdatedOnCapture) return NO;
 
-    NSDictionary *const props = [self objectProperties];
-    for (NSString *key in props)
+    if (_schema && ![otherObj isKindOfClass:[self class]]) return NO;
+
+    for (NSUInteger i = 0; _schema && i < _schema->attributeCount; i++)
     {
-        const SEL selectorForProp = NSSelectorFromString(key);
+        const JRCaptureAttribute *attribute = &_schema->attributes[i];
+        id value = _attributeValues[i];
 
-        // call the selector on self to get an id object named 'prop'
-        id __unsafe_unretained prop = nil;
-        NSMethodSignature *propSignature = [[self class] instanceMethodSignatureForSelector:selectorForProp];
-        NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
-        if (!propSignature || !propInvoker)
+        if (attribute->type == JRCaptureAttributeTypeObject && value)
         {
-            DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(selectorForProp));
-            return NO;
+            if (![(JRCaptureObject *)value isEqualByPrivateProperties:otherObj->_attributeValues[i]]) return NO;
         }
-        [propInvoker setSelector:selectorForProp];
-        [propInvoker setTarget:self];
-        [propInvoker invoke];
-        [propInvoker getReturnValue:&prop];
-
-        // call the selector on otherObj to get an id object named 'otherProp'
-        id __unsafe_unretained otherProp = nil;
-        NSMethodSignature *otherPropSignature = [[otherObj class] instanceMethodSignatureForSelector:selectorForProp];
-        NSInvocation *otherPropInvoker = [NSInvocation invocationWithMethodSignature:otherPropSignature];
-        if (!otherPropSignature || !otherPropInvoker)
+        else if (attribute->type == JRCaptureAttributeTypePlural && value)
         {
-            DLog(@"ERROR! Selector %@ not found", NSStringFromSelector(selectorForProp));
-            return NO;
+            NSArray *otherArray = otherObj->_attributeValues[i];
+            if (![otherArray isKindOfClass:[NSArray class]]) return NO;
+            if ([(NSArray *)value count] != [otherArray count]) return NO;
+
+            for (NSUInteger j = 0; j < [(NSArray *)value count]; j++)
+                if (![[(NSArray *)value objectAtIndex:j] isEqualByPrivateProperties:[otherArray objectAtIndex:j]])
+                    return NO;
         }
-        [propInvoker setSelector:selectorForProp];
-        [propInvoker setTarget:otherObj];
-        [propInvoker invoke];
-        [propInvoker getReturnValue:&otherProp];
+    }
+
+    return YES;
+}
 
+- (BOOL)isEqualToCaptureObject:(JRCaptureObject *)otherObject
+{
+    const JRCaptureSchema *schema = JRCaptureSchemaOrRaise(self, _cmd);
+    BOOL hasOtherValues = otherObject && otherObject->_schema == schema;
+
+    for (NSUInteger i = 0; i < schema->attributeCount; i++)
+    {
+        const JRCaptureAttribute *attribute = &schema->attributes[i];
+        id value = _attributeValues[i];
+        id otherValue = hasOtherValues ? otherObject->_attributeValues[i] : nil;
 
-        if ([prop isKindOfClass:[JRCaptureObject class]])
-            if (![((JRCaptureObject *) prop) isEqualByPrivateProperties:otherProp]) return NO;
+        if (attribute->flags & JRCaptureAttributeReadOnly) continue;
 
-        if ([prop isKindOfClass:[NSArray class]])
+        if (!value && !otherValue) /* Keep going... */;
+        else if (attribute->type == JRCaptureAttributeTypeObject)
         {
-            if (![otherProp isKindOfClass:[NSArray class]] || [otherProp count] != [prop count]) return NO;
-            for (id element in ((NSArray *) prop))
-            {
-                id element_ = [((NSArray *) otherProp) objectAtIndex:[((NSArray *) prop) indexOfObject:element]];
-                if ([element isKindOfClass:[JRCaptureObject class]])
-                    if (![((JRCaptureObject *) element) isEqualByPrivateProperties:element_]) return NO;
-            }
+            /* A missing object is the same as an empty one */
+            JRCaptureObject *emptyObject = [[objc_getClass(attribute->className) alloc] init];
+
+            if (!value && [(JRCaptureObject *)otherValue isEqualToCaptureObject:emptyObject]) /* Keep going... */;
+            else if (!otherValue && [(JRCaptureObject *)value isEqualToCaptureObject:emptyObject]) /* Keep going... */;
+            else if (![(JRCaptureObject *)value isEqualToCaptureObject:otherValue]) return NO;
+        }
+        else if (attribute->type == JRCaptureAttributeTypePlural)
+        {
+            if (!value && ![(NSArray *)otherValue count]) /* Keep going... */;
+            else if (!otherValue && ![(NSArray *)value count]) /* Keep going... */;
+            else if ([(NSArray *)value count] != [(NSArray *)otherValue count]) return NO;
+            else
+                for (NSUInteger j = 0; j < [(NSArray *)value count]; j++)
+                    if (![[(NSArray *)value objectAtIndex:j] isEqualToCaptureObject:[otherValue objectAtIndex:j]])
+                        return NO;
         }
+        else if (attribute->type == JRCaptureAttributeTypeStringPlural)
+        {
+            if (!value && ![(NSArray *)otherValue count]) /* Keep going... */;
+            else if (!otherValue && ![(NSArray *)value count]) /* Keep going... */;
+            else if (![(NSArray *)value isEqualToArray:otherValue]) return NO;
+        }
+        else if ((value == nil) ^ (otherValue == nil)) return NO; // xor
+        else if (![value isEqual:otherValue]) return NO;
     }
+
     return YES;
 }
 @end
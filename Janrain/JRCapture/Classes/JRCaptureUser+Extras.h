@@ -32,6 +32,8 @@
 #import "JRCaptureUser.h"
 
 @class JRCaptureFlow;
+@class JRJsonReader;
+@class JRCaptureArchiveReader;
 
 /**
  * @internal
@@ -39,6 +41,10 @@
 @interface JRCaptureUser (Private)
 + (id)captureUserObjectFromDictionary:(NSDictionary *)dictionary withPath:(NSString *)capturePath;
 
++ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
+
++ (id)captureUserObjectFromArchive:(JRCaptureArchiveReader *)reader;
+
 - (void)decodeFromDictionary:(NSDictionary *)dictionary;
 @end
 
@@ -51,6 +57,12 @@
 + (JRCaptureUser *)captureUserObjectWithPrefilledFields:(NSDictionary *)prefilledFields flow:(JRCaptureFlow *)flow;
 
 + (BOOL)hasPasswordField:(NSDictionary *)userDict;
+
+/**
+ * Reads the user straight out of the reader, as captureUserObjectFromDictionary: would make it from the parsed JSON.
+ * nil if the JSON is malformed.
+ **/
++ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader;
 @end
 
 @protocol JRCaptureObjectDelegate;
@@ -114,6 +126,33 @@
  **/
 + (void)fetchCaptureUserFromServerForDelegate:(id <JRCaptureUserDelegate>)delegate context:(NSObject *)context __unused;
 
+/**
+ * Archives the user, along with its unsaved changes, in a compact binary form that captureUserWithArchivedData:() and
+ * captureUserWithContentsOfArchiveFile:keys:() read back. It is smaller, and quicker to write and to read, than the
+ * archive NSKeyedArchiver makes of the user.
+ **/
+- (NSData *)archivedData;
+
+/**
+ * Writes archivedData to the file at path, returning \c NO if it couldn't be written
+ **/
+- (BOOL)writeArchiveToFile:(NSString *)path;
+
+/**
+ * The user that archivedData archived, or \c nil if data isn't such an archive
+ **/
++ (id)captureUserWithArchivedData:(NSData *)data;
+
+/**
+ * The user that writeArchiveToFile:() archived to the file at path, or \c nil if the file can't be read or isn't such
+ * an archive. The file is memory-mapped rather than read in.
+ *
+ * @param keys
+ *   The schema keys of the attributes to read, or \c nil to read all of them. The user's other attributes are left as
+ *   they would be in a new JRCaptureUser, and the parts of the file that hold them are not read.
+ **/
++ (id)captureUserWithContentsOfArchiveFile:(NSString *)path keys:(NSSet *)keys;
+
 /**
  * @internal
  **/
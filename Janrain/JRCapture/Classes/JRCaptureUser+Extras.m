@@ -36,6 +36,8 @@
 #import "JRCaptureError.h"
 #import "JRCaptureObject+Internal.h"
 #import "JRCaptureFlow.h"
+#import "JRJsonReader.h"
+#import "JRCaptureArchive.h"
 
 @interface JRCaptureUserApidHandler : NSObject <JRCaptureInternalDelegate>
 @end
@@ -73,13 +75,26 @@
         return [self getCaptureUserDidFailWithResult:[JRCaptureError invalidStatErrorDictForResult:result]
                                              context:context];
 
-    NSDictionary *result_ = [result objectForKey:@"result"];
-    if (!result_ || ![result_ isKindOfClass:[NSDictionary class]])
+    /* The user is usually left unparsed by JRCaptureApidInterface, to be read straight into the JRCaptureUser */
+    id result_ = [result objectForKey:@"result"];
+    JRCaptureUser *captureUser = nil;
+    NSArray *linkedProfiles = nil;
+    if ([result_ isKindOfClass:[JRJsonReader class]])
+    {
+        captureUser = [JRCaptureUser captureUserObjectFromJsonReader:[result_ copy]];
+        linkedProfiles = [[result_ copy] readValueForKey:@"profiles"];
+    }
+    else if ([result_ isKindOfClass:[NSDictionary class]])
+    {
+        captureUser = [JRCaptureUser captureUserObjectFromDictionary:result_];
+        linkedProfiles = [result_ valueForKey:@"profiles"];
+    }
+
+    if (!captureUser)
         return [self getCaptureUserDidFailWithResult:[JRCaptureError invalidDataErrorDictForResult:result]
                                              context:context];
 
-    JRCaptureUser *captureUser = [JRCaptureUser captureUserObjectFromDictionary:result_];
-    [JRCaptureData setLinkedProfiles:[[result valueForKey:@"result"] valueForKey:@"profiles"]];
+    [JRCaptureData setLinkedProfiles:linkedProfiles];
 
     if ([delegate respondsToSelector:@selector(fetchUserDidSucceed:context:)])
         [delegate fetchUserDidSucceed:captureUser context:callerContext];
@@ -110,6 +125,41 @@
     return user;
 }
 
+- (NSData *)archivedData
+{
+    JRCaptureArchiveWriter *writer = [[JRCaptureArchiveWriter alloc] init];
+    [self writeToArchive:writer];
+    return [writer finishedData];
+}
+
+- (BOOL)writeArchiveToFile:(NSString *)path
+{
+    NSError *error = nil;
+    if (![[self archivedData] writeToFile:path options:NSDataWritingAtomic error:&error])
+    {
+        ALog(@"Couldn't write the user to %@: %@", path, error);
+        return NO;
+    }
+
+    return YES;
+}
+
++ (id)captureUserWithArchive:(JRCaptureArchiveReader *)reader
+{
+    JRCaptureUser *user = [JRCaptureUser captureUserObjectFromArchive:reader];
+    return reader.failed ? nil : user;
+}
+
++ (id)captureUserWithArchivedData:(NSData *)data
+{
+    return [self captureUserWithArchive:[[JRCaptureArchiveReader alloc] initWithData:data]];
+}
+
++ (id)captureUserWithContentsOfArchiveFile:(NSString *)path keys:(NSSet *)keys
+{
+    return [self captureUserWithArchive:[JRCaptureArchiveReader readerWithContentsOfFile:path keys:keys]];
+}
+
 + (void)testCaptureUserApidHandlerGetCaptureUserDidFailWithResult:(NSDictionary *)result
                                                           context:(NSObject *)context __unused
 {
@@ -124,46 +174,24 @@
 
 @end
 
-@interface NSArray (JRArrayExtensions)
-- (NSArray *)tail;
-@end
-
 @implementation JRCaptureUser (JRCaptureUser_Internal_Extras)
 - (NSMutableDictionary *)toFormFieldsForForm:(NSString *)formName withFlow:(JRCaptureFlow *)flow
 {
     if (!formName || !flow) return nil;
 
     NSMutableDictionary *retval = [NSMutableDictionary dictionary];
-    NSDictionary *form = [[flow objectForKey:@"fields"] objectForKey:formName];
-    NSArray *fieldNames = [form objectForKey:@"fields"];
-    NSArray *fields = [[flow objectForKey:@"fields"] objectsForKeys:fieldNames notFoundMarker:[NSNull null]];
-
-    for (NSObject *field in fields) {
-        if (![field isKindOfClass:[NSDictionary class]]) {
-            ALog(@"unrecognized field defn: %@", [field description]);
-            continue;
-        }
-        
-        if([(NSDictionary *) field objectForKey:@"schemaId"] == nil) {
-            ALog(@"field defn missing schemaId (skipping): %@", [field description]);
-            continue;
-        }
-        
-        id schemaId = [(NSDictionary *) field objectForKey:@"schemaId"];
-        NSString *key = [fieldNames objectAtIndex:[fields indexOfObject:field]];
-
-        if ([schemaId isKindOfClass:[NSString class]]) {
-            if ([[(NSDictionary *) field objectForKey:@"type"] isEqualToString:@"dateselect"]) {
-                [self setForDateValueFromDotPath:schemaId forKey:key dictionary:retval];
-            } else {
-                [self setForValueFromDotPath:schemaId forKey:key dictionary:retval];
-            }
-        } else if ([schemaId isKindOfClass:[NSDictionary class]]) {
-            for (NSString *subscript in schemaId) {
-                NSString *dotPath = [schemaId objectForKey:subscript];
-                NSString *paramName = [NSString stringWithFormat:@"%@[%@]", key, subscript];
-                [self setForValueFromDotPath:dotPath forKey:paramName dictionary:retval];
-            }
+    NSDictionary *userDict = [self newDictionaryForEncoder:NO];
+    NSMutableDictionary *pluralIndexes = [NSMutableDictionary dictionary];
+
+    for (JRCaptureFormField *field in [flow compiledFieldsForForm:formName]) {
+        id value = [field.path valueInUserDictionary:userDict pluralIndexes:pluralIndexes];
+        NSString *formFieldValue = [JRCaptureUser jsonStringForValue:value];
+        if (!formFieldValue) continue;
+
+        if (field.isDateSelect) {
+            [JRCaptureUser setDateValue:formFieldValue forKey:field.parameterName dictionary:retval];
+        } else {
+            [retval setObject:formFieldValue forKey:field.parameterName];
         }
     }
 
@@ -172,76 +200,28 @@
 
 +(BOOL)hasPasswordField:(NSDictionary *)dict {
     NSString *component = [[[JRCaptureData sharedCaptureData] captureFlow] schemaIdForFieldName:@"password"];
-    NSArray *pathComponents = [component componentsSeparatedByString:@"."];
-    NSString *passwordValue =  [JRCaptureUser valueForAttrByDotPathComponents:pathComponents userDict:dict];
+    JRCaptureFieldPath *path = [JRCaptureFieldPath fieldPathWithDotPath:component];
+    id value = [path valueInUserDictionary:dict pluralIndexes:[NSMutableDictionary dictionary]];
+    NSString *passwordValue = [JRCaptureUser jsonStringForValue:value];
 
     return (passwordValue && [passwordValue length]);
 }
-- (void)setForValueFromDotPath:(NSString *)dotPath forKey:(NSString *)key dictionary:(NSMutableDictionary *)dictionary
-{
-    NSString *formFieldValue = [self valueForAttrByDotPath:dotPath];
-
-    if (formFieldValue) {
-        [dictionary setObject:formFieldValue forKey:key];
-    }
-}
 
-- (void)setForDateValueFromDotPath:(NSString *)dotPath forKey:(NSString *)key
-                        dictionary:(NSMutableDictionary *)dictionary
++ (void)setDateValue:(NSString *)formFieldValue forKey:(NSString *)key dictionary:(NSMutableDictionary *)dictionary
 {
-
-    NSString *formFieldValue = [self valueForAttrByDotPath:dotPath];
-
-    if (formFieldValue) {
-        // The date is in the format yyyy-MM-dd
-        NSArray *dateParts = [formFieldValue componentsSeparatedByString:@"-"];
-        if ([dateParts count] == 3) {
-            [dictionary setObject:dateParts[0] forKey:[key stringByAppendingString:@"[dateselect_year]"]];
-            [dictionary setObject:dateParts[1] forKey:[key stringByAppendingString:@"[dateselect_month]"]];
-            [dictionary setObject:dateParts[2] forKey:[key stringByAppendingString:@"[dateselect_day]"]];
-        }
-    }
-}
-
-- (NSString *)valueForAttrByDotPath:(NSString *)dotPath
-{
-    NSArray *pathComponents = [dotPath componentsSeparatedByString:@"."];
-    return [JRCaptureUser valueForAttrByDotPathComponents:pathComponents userDict:[self newDictionaryForEncoder:NO]];
-}
-
-+ (NSString *)valueForAttrByDotPathComponents:(NSArray *)dotPathComponents userDict:(id)userDict
-{
-    if ([dotPathComponents count] == 0) return [self jsonStringForValue:userDict];
-
-    if (![userDict isKindOfClass:[NSDictionary class]]) return nil;
-    NSDictionary *userDict_ = userDict;
-    NSString *dotPathComponent = [dotPathComponents objectAtIndex:0];
-    NSArray *tail = [dotPathComponents tail];
-    NSArray *pluralSplit = [dotPathComponent componentsSeparatedByString:@"#"];
-    if ([pluralSplit count] > 1)
-    {
-        id val = [userDict_ objectForKey:[pluralSplit objectAtIndex:0]];
-        if (![val isKindOfClass:[NSArray class]]) return nil;
-        for (id elt in val)
-        {
-            if (![elt isKindOfClass:[NSDictionary class]]) return nil;
-            if ([[elt objectForKey:@"id"] isEqual:[pluralSplit objectAtIndex:1]])
-            {
-                return [self valueForAttrByDotPathComponents:tail userDict:elt];
-            }
-        }
-        return nil;
-    }
-    else
-    {
-        id val = [userDict_ objectForKey:dotPathComponent];
-        return [self valueForAttrByDotPathComponents:tail userDict:val];
+    // The date is in the format yyyy-MM-dd
+    NSArray *dateParts = [formFieldValue componentsSeparatedByString:@"-"];
+    if ([dateParts count] == 3) {
+        [dictionary setObject:dateParts[0] forKey:[key stringByAppendingString:@"[dateselect_year]"]];
+        [dictionary setObject:dateParts[1] forKey:[key stringByAppendingString:@"[dateselect_month]"]];
+        [dictionary setObject:dateParts[2] forKey:[key stringByAppendingString:@"[dateselect_day]"]];
     }
 }
 
 + (NSString *)jsonStringForValue:(id)userDict
 {
     if (!userDict || userDict == [NSNull null]) return nil;
+    if ([userDict isKindOfClass:[NSString class]]) return userDict;
     // This hack will get us the string-ified version of a JSON-able value.
     NSError *ignore = nil;
     NSArray *thisIsAHack = [NSArray arrayWithObject:userDict];
@@ -258,6 +238,16 @@
         }
 }
 
++ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader
+{
+    JRCaptureUser *user = [JRCaptureUser captureUserObjectFromJsonReader:reader withPath:@""];
+    if (reader.failed) return nil;
+
+    // MOB-143, clear DPS on all sub-objects
+    [user deepClearDirtyProperties];
+    return user;
+}
+
 + (JRCaptureUser *)captureUserObjectWithPrefilledFields:(NSDictionary *)prefilledFields flow:(JRCaptureFlow *)flow
 {
     NSMutableDictionary *preregAttributes = [NSMutableDictionary dictionary];
@@ -265,7 +255,7 @@
     {
         id value = [prefilledFields objectForKey:key];
         if ([value isEqual:[NSNull null]]) continue;
-        NSDictionary *fieldDefn = [self fieldDictForFieldName:key flow:flow];
+        NSDictionary *fieldDefn = [flow fieldForName:key];
         if ([fieldDefn isKindOfClass:[NSDictionary class]] && [fieldDefn objectForKey:@"schemaId"])
         {
             [preregAttributes setObject:value forKey:[fieldDefn objectForKey:@"schemaId"]];
@@ -274,23 +264,4 @@
     return [JRCaptureUser captureUserObjectFromDictionary:preregAttributes];
 }
 
-+ (NSDictionary *)fieldDictForFieldName:(NSString *)fieldName flow:(JRCaptureFlow *)flow
-{
-    NSDictionary *fields = [flow objectForKey:@"fields"];
-    for (id key in fields)
-    {
-        if ([key isEqual:fieldName]) return [fields objectForKey:key];
-    }
-    return nil;
-}
-
-@end
-
-@implementation NSArray (JRArrayExtensions)
-- (NSArray *)tail
-{
-    if ([self count] == 0) return nil;
-    if ([self count] == 1) return @[];
-    return [self subarrayWithRange:NSMakeRange(1, [self count] - 1)];
-}
 @end
@@ -37,6 +37,7 @@
 #import "JRTraditionalSigninViewController.h"
 #import "JRCapture.h"
 #import "JRJsonUtils.h"
+#import "JRTrace.h"
 
 typedef enum {
     JREngageDialogStateAuthentication,
@@ -53,6 +54,9 @@ typedef enum {
 @property JREngageDialogState dialogState;
 @property bool didTearDownViewControllers;
 @property NSString *redirectUri;
+
+/* The Engage stage of the sign-in being traced: the dialog, or getting auth_info for a native provider's token */
+@property JRTraceSpan *engageSpan;
 @end
 
 @implementation JREngageWrapper
@@ -163,6 +167,8 @@ static JREngageWrapper *singleton = nil;
     [wrapper setDialogState:JREngageDialogStateAuthentication];
     if(linkAccount)
         [wrapper setRedirectUri:redirectUri];
+    else
+        [self beginSignInTraceWithSpanNamed:@"engage_dialog" kind:JRTraceSpanKindUIWait];
     
     NSMutableDictionary *expandedCustomInterfaceOverrides =
     [NSMutableDictionary dictionaryWithDictionary:customInterfaceOverrides];
@@ -221,6 +227,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 
     [[JREngageWrapper singletonInstance] setDelegate:delegate];
     [[JREngageWrapper singletonInstance] setDialogState:JREngageDialogStateAuthentication];
+    [self beginSignInTraceWithSpanNamed:@"engage_dialog" kind:JRTraceSpanKindUIWait];
 
     [JREngage showAuthenticationDialogForProvider:provider withCustomInterfaceOverrides:customInterfaceOverrides];
 }
@@ -236,6 +243,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
     
     [[JREngageWrapper singletonInstance] setDelegate:delegate];
     [[JREngageWrapper singletonInstance] setDialogState:JREngageDialogStateAuthentication];
+    [self beginSignInTraceWithSpanNamed:@"engage_auth_info" kind:JRTraceSpanKindNetwork];
     
     [JREngage getAuthInfoTokenForNativeProvider:provider withToken:token andTokenSecret:tokenSecret];
 }
@@ -252,10 +260,29 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
     
     [[JREngageWrapper singletonInstance] setDelegate:delegate];
     [[JREngageWrapper singletonInstance] setDialogState:JREngageDialogStateAuthentication];
+    [self beginSignInTraceWithSpanNamed:@"engage_auth_info" kind:JRTraceSpanKindNetwork];
     
     [JREngage getAuthInfoTokenForNativeProvider:provider withToken:token andTokenSecret:tokenSecret andEngageAppUrl:engageAppUrl];
 }
 
++ (void)beginSignInTraceWithSpanNamed:(NSString *)spanName kind:(JRTraceSpanKind)kind
+{
+    JRTrace *trace = [JRTrace beginTraceNamed:@"sign-in"];
+    [[JREngageWrapper singletonInstance] setEngageSpan:[trace beginSpanNamed:spanName kind:kind]];
+}
+
+- (void)finishSignInTraceWithError:(NSError *)error
+{
+    JRTrace *trace = [JRTrace currentTrace];
+    if ([error isJRTwoStepRegFlowError])
+        // the sign-in goes on once the user fills in the registration form, in +[JRCapture registerNewUser:...]
+        [trace beginSpanNamed:@"registration_form" kind:JRTraceSpanKindUIWait];
+    else
+        [trace finishWithError:error];
+
+    self.engageSpan = nil;
+}
+
 - (void)tearingDownViewControllers:(NSNotification *)notification {
     DLog();
     self.didTearDownViewControllers = YES;
@@ -272,6 +299,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
         self.engageToken = nil;
         self.didTearDownViewControllers = NO;
         self.redirectUri = nil;
+        self.engageSpan = nil;
     }
 }
 
@@ -279,6 +307,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
                          forProvider:(NSString *)provider
 {
     DLog();
+    [self finishSignInTraceWithError:error];
     if ([delegate respondsToSelector:@selector(captureSignInDidFailWithError:)])
         [delegate captureSignInDidFailWithError:error];
 
@@ -288,6 +317,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 - (void)authenticationDidFailWithError:(NSError *)error forProvider:(NSString *)provider
 {
     DLog();
+    [self finishSignInTraceWithError:error];
     if ([delegate respondsToSelector:@selector(engageAuthenticationDidFailWithError:forProvider:)])
         [delegate engageAuthenticationDidFailWithError:error forProvider:provider];
 
@@ -297,6 +327,8 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 - (void)authenticationDidNotComplete
 {
     DLog();
+    [self finishSignInTraceWithError:[NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError
+                                                     userInfo:nil]];
     if ([delegate respondsToSelector:@selector(engageAuthenticationDidCancel)])
         [delegate engageAuthenticationDidCancel];
 
@@ -306,8 +338,10 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 - (void)authenticationDidReachTokenUrl:(NSString *)tokenUrl withResponse:(NSURLResponse *)response
                             andPayload:(NSData *)tokenUrlPayload forProvider:(NSString *)provider
 {
+    JRTraceSpan *parseSpan = [[JRTrace currentTrace] beginSpanNamed:@"token_url" kind:JRTraceSpanKindParse];
     NSString *payload = [[NSString alloc] initWithData:tokenUrlPayload encoding:NSUTF8StringEncoding];
     NSDictionary *payloadDict = [payload JR_objectFromJSONString];
+    [parseSpan end];
 
     DLog(@"%@", payload);
 
@@ -333,6 +367,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 {
     self.engageToken = [auth_info objectForKey:@"token"];
     [UIApplication sharedApplication].networkActivityIndicatorVisible = YES;
+    [self.engageSpan end];
 
     if ([delegate respondsToSelector:@selector(engageAuthenticationDidSucceedForUser:forProvider:)])
         [delegate engageAuthenticationDidSucceedForUser:auth_info forProvider:provider];
@@ -352,6 +387,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 
 - (void)engageDialogDidFailToShowWithError:(NSError *)error
 {
+    [self finishSignInTraceWithError:error];
     if (dialogState == JREngageDialogStateAuthentication)
     {
         if ([delegate respondsToSelector:@selector(engageAuthenticationDialogDidFailToShowWithError:)])
@@ -0,0 +1,80 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @brief Writes JSON straight into an application/x-www-form-urlencoded request body
+ *
+ *  Everything is written into one growable byte buffer, percent-escaped as it goes, so a body never exists as an
+ *  NSDictionary, a JSON NSString or an escaped NSString along the way. Values are separated with commas automatically;
+ *  callers only have to pair beginObject/endObject and beginArray/endArray, and precede each object member with
+ *  writeKey:.
+ **/
+@interface JRJsonFormWriter : NSObject
+
+/**
+ * The number of bytes written so far
+ **/
+@property(readonly) NSUInteger length;
+
+/**
+ * How many times the buffer has been allocated or grown
+ **/
+@property(readonly) NSUInteger allocationCount;
+
+- (id)initWithCapacity:(NSUInteger)capacity;
+
+/**
+ * Starts the next form parameter, writing <code>&name=</code> (or <code>name=</code> for the first one). The
+ * parameter's value is whatever is written next.
+ **/
+- (void)appendFormParameterNamed:(NSString *)name;
+- (void)appendFormParameterNamed:(NSString *)name value:(NSString *)value;
+
+- (void)beginObject;
+- (void)endObject;
+- (void)beginArray;
+- (void)endArray;
+- (void)writeKey:(NSString *)key;
+
+/**
+ * Writes an NSString, NSNumber, NSNull, or an NSDictionary or NSArray of those. nil is written as null.
+ **/
+- (void)writeValue:(NSObject *)value;
+
+/**
+ * Hands the buffer over, without copying it, as the body's NSData, and leaves the writer empty
+ **/
+- (NSData *)data;
+@end
+
+typedef void (^JRJsonWritingBlock)(JRJsonFormWriter *writer);
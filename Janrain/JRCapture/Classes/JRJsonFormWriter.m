@@ -0,0 +1,348 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRJsonFormWriter.h"
+
+#define cJRDefaultWriterCapacity 4096
+#define cJRWriterSliceLength 256
+
+/* The longest a single input byte can get: a control character becomes \u00XX, and each of those six characters %XX */
+#define cJRMaxEscapedByteLength 18
+
+static const char JRHexDigits[] = "0123456789ABCDEF";
+
+static inline BOOL JRIsFormSafeByte(uint8_t c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+            c == '-' || c == '.' || c == '_' || c == '~';
+}
+
+static inline uint8_t *JRPutFormByte(uint8_t *out, uint8_t c)
+{
+    if (JRIsFormSafeByte(c))
+    {
+        *out++ = c;
+    }
+    else
+    {
+        *out++ = '%';
+        *out++ = (uint8_t) JRHexDigits[c >> 4];
+        *out++ = (uint8_t) JRHexDigits[c & 0xF];
+    }
+
+    return out;
+}
+
+static inline uint8_t *JRPutJsonFormByte(uint8_t *out, uint8_t c)
+{
+    if (c == '"' || c == '\\')
+    {
+        out = JRPutFormByte(out, '\\');
+        return JRPutFormByte(out, c);
+    }
+
+    if (c >= 0x20) return JRPutFormByte(out, c);
+
+    out = JRPutFormByte(out, '\\');
+    switch (c)
+    {
+        case '\n': return JRPutFormByte(out, 'n');
+        case '\r': return JRPutFormByte(out, 'r');
+        case '\t': return JRPutFormByte(out, 't');
+        case '\b': return JRPutFormByte(out, 'b');
+        case '\f': return JRPutFormByte(out, 'f');
+        default:
+            out = JRPutFormByte(out, 'u');
+            out = JRPutFormByte(out, '0');
+            out = JRPutFormByte(out, '0');
+            out = JRPutFormByte(out, (uint8_t) JRHexDigits[c >> 4]);
+            return JRPutFormByte(out, (uint8_t) JRHexDigits[c & 0xF]);
+    }
+}
+
+@implementation JRJsonFormWriter
+{
+    uint8_t *_bytes;
+    NSUInteger _capacity;
+    BOOL _needsSeparator;
+}
+@synthesize length = _length;
+@synthesize allocationCount = _allocationCount;
+
+- (id)init
+{
+    return [self initWithCapacity:cJRDefaultWriterCapacity];
+}
+
+- (id)initWithCapacity:(NSUInteger)capacity
+{
+    if ((self = [super init]))
+    {
+        _capacity = MAX(capacity, (NSUInteger) 64);
+        _bytes = malloc(_capacity);
+        _allocationCount = 1;
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_bytes);
+}
+
+- (uint8_t *)reserve:(NSUInteger)count
+{
+    if (_length + count > _capacity)
+    {
+        if (!_capacity) _capacity = 64;
+        while (_length + count > _capacity) _capacity *= 2;
+
+        _bytes = realloc(_bytes, _capacity);
+        _allocationCount++;
+    }
+
+    return _bytes + _length;
+}
+
+/**
+ * Escapes a slice at a time, so that the buffer only has to have room for the worst case of one slice
+ */
+- (void)appendBytes:(const uint8_t *)bytes length:(NSUInteger)length asJson:(BOOL)asJson
+{
+    while (length)
+    {
+        NSUInteger count = MIN(length, (NSUInteger) cJRWriterSliceLength);
+        uint8_t *out = [self reserve:count * cJRMaxEscapedByteLength];
+        uint8_t *start = out;
+
+        for (NSUInteger i = 0; i < count; i++)
+            out = asJson ? JRPutJsonFormByte(out, bytes[i]) : JRPutFormByte(out, bytes[i]);
+
+        _length += out - start;
+        bytes += count;
+        length -= count;
+    }
+}
+
+- (void)appendPunctuation:(char)c
+{
+    uint8_t *out = [self reserve:3];
+    _length += JRPutFormByte(out, (uint8_t) c) - out;
+}
+
+/**
+ * Appends the string's UTF-8 bytes without making a UTF-8 copy of it: ASCII strings are read in place, anything else
+ * is transcoded a chunk at a time on the stack
+ */
+- (void)appendString:(NSString *)string asJson:(BOOL)asJson
+{
+    const char *ascii = CFStringGetCStringPtr((__bridge CFStringRef) string, kCFStringEncodingASCII);
+    if (ascii && strlen(ascii) == [string length])
+    {
+        [self appendBytes:(const uint8_t *) ascii length:[string length] asJson:asJson];
+        return;
+    }
+
+    uint8_t chunk[cJRWriterSliceLength];
+    NSRange remaining = NSMakeRange(0, [string length]);
+    while (remaining.length)
+    {
+        NSUInteger used = 0;
+        [string getBytes:chunk maxLength:sizeof(chunk) usedLength:&used encoding:NSUTF8StringEncoding
+                 options:NSStringEncodingConversionAllowLossy range:remaining remainingRange:&remaining];
+        if (!used) break;
+
+        [self appendBytes:chunk length:used asJson:asJson];
+    }
+}
+
+- (void)appendFormParameterNamed:(NSString *)name
+{
+    if (_length)
+    {
+        *[self reserve:1] = '&';
+        _length++;
+    }
+
+    [self appendString:name asJson:NO];
+    *[self reserve:1] = '=';
+    _length++;
+    _needsSeparator = NO;
+}
+
+- (void)appendFormParameterNamed:(NSString *)name value:(NSString *)value
+{
+    [self appendFormParameterNamed:name];
+    [self appendString:value asJson:NO];
+}
+
+- (void)beginValue
+{
+    if (_needsSeparator) [self appendPunctuation:','];
+    _needsSeparator = YES;
+}
+
+- (void)beginObject
+{
+    [self beginValue];
+    [self appendPunctuation:'{'];
+    _needsSeparator = NO;
+}
+
+- (void)endObject
+{
+    [self appendPunctuation:'}'];
+    _needsSeparator = YES;
+}
+
+- (void)beginArray
+{
+    [self beginValue];
+    [self appendPunctuation:'['];
+    _needsSeparator = NO;
+}
+
+- (void)endArray
+{
+    [self appendPunctuation:']'];
+    _needsSeparator = YES;
+}
+
+- (void)writeKey:(NSString *)key
+{
+    [self beginValue];
+    [self appendPunctuation:'"'];
+    [self appendString:key asJson:YES];
+    [self appendPunctuation:'"'];
+    [self appendPunctuation:':'];
+    _needsSeparator = NO;
+}
+
+- (void)writeLiteral:(const char *)literal
+{
+    [self beginValue];
+    [self appendBytes:(const uint8_t *) literal length:strlen(literal) asJson:NO];
+}
+
+- (void)writeNumber:(NSNumber *)number
+{
+    if (CFGetTypeID((__bridge CFTypeRef) number) == CFBooleanGetTypeID())
+    {
+        [self writeLiteral:[number boolValue] ? "true" : "false"];
+        return;
+    }
+
+    char buffer[32];
+    switch (*[number objCType])
+    {
+        case 'f':
+        case 'd':
+        {
+            double value = [number doubleValue];
+            if (!isfinite(value))
+            {
+                DLog(@"Writing non-finite number %@ as null", number);
+                [self writeLiteral:"null"];
+                return;
+            }
+
+            /* The shortest of the two that reads back as the same double */
+            snprintf(buffer, sizeof(buffer), "%.15g", value);
+            if (strtod(buffer, NULL) != value) snprintf(buffer, sizeof(buffer), "%.17g", value);
+            break;
+        }
+        case 'Q':
+        case 'L':
+        case 'I':
+        case 'S':
+            snprintf(buffer, sizeof(buffer), "%llu", [number unsignedLongLongValue]);
+            break;
+        default:
+            snprintf(buffer, sizeof(buffer), "%lld", [number longLongValue]);
+            break;
+    }
+
+    [self writeLiteral:buffer];
+}
+
+- (void)writeValue:(NSObject *)value
+{
+    if (!value || value == [NSNull null])
+    {
+        [self writeLiteral:"null"];
+    }
+    else if ([value isKindOfClass:[NSString class]])
+    {
+        [self beginValue];
+        [self appendPunctuation:'"'];
+        [self appendString:(NSString *) value asJson:YES];
+        [self appendPunctuation:'"'];
+    }
+    else if ([value isKindOfClass:[NSNumber class]])
+    {
+        [self writeNumber:(NSNumber *) value];
+    }
+    else if ([value isKindOfClass:[NSDictionary class]])
+    {
+        [self beginObject];
+        [(NSDictionary *) value enumerateKeysAndObjectsUsingBlock:^(id key, id object, BOOL *stop)
+        {
+            [self writeKey:[key description]];
+            [self writeValue:object];
+        }];
+        [self endObject];
+    }
+    else if ([value isKindOfClass:[NSArray class]])
+    {
+        [self beginArray];
+        for (NSObject *element in (NSArray *) value)
+            [self writeValue:element];
+        [self endArray];
+    }
+    else
+    {
+        DLog(@"Writing value of unsupported class %@ as null", [value class]);
+        [self writeLiteral:"null"];
+    }
+}
+
+- (NSData *)data
+{
+    NSData *data = [NSData dataWithBytesNoCopy:_bytes length:_length freeWhenDone:YES];
+    _bytes = NULL;
+    _length = _capacity = 0;
+    _needsSeparator = NO;
+
+    return data;
+}
+@end
@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @brief Reads JSON a value at a time, straight out of a response body
+ *
+ *  The generated Capture objects use a reader to fill in their properties without the body being parsed into a tree
+ *  of NSDictionaries and NSArrays first. Keys are handed out as the bytes in the body, so matching them allocates
+ *  nothing, and only the values that end up in properties are made into objects. Commas between members and elements
+ *  are optional. Malformed JSON stops the reader and sets failed; from then on it is at the end of every object and
+ *  array, and reads nil.
+ **/
+@interface JRJsonReader : NSObject <NSCopying>
+
+/**
+ * The JSON being read. A copy of the reader starts over at the beginning of it.
+ **/
+@property(readonly) NSData *data;
+
+/**
+ * \c YES once malformed JSON has been read
+ **/
+@property(readonly) BOOL failed;
+
+- (id)initWithData:(NSData *)data;
+
+/**
+ * Parses a JSON object, like JR_objectFromJSONData, except that the value of the top-level member named key is
+ * skipped over rather than parsed, and left in the dictionary as a JRJsonReader over just that value. nil if data
+ * doesn't hold a JSON object.
+ **/
++ (NSDictionary *)dictionaryFromData:(NSData *)data deferringKey:(NSString *)key;
+
+/**
+ * Enters the object that is the next value and returns \c YES, or skips the next value and returns \c NO if it isn't
+ * an object
+ **/
+- (BOOL)beginObject;
+
+/**
+ * Returns the next member's key and sets length to its length in bytes, or returns \c NULL once the object is done.
+ * The key isn't NUL-terminated, and is only good until the reader moves on.
+ **/
+- (const char *)nextKey:(size_t *)length;
+
+/**
+ * Enters the array that is the next value and returns \c YES, or skips the next value and returns \c NO if it isn't
+ * an array
+ **/
+- (BOOL)beginArray;
+
+/**
+ * \c YES if the array has another element to read, \c NO once it is done
+ **/
+- (BOOL)nextElement;
+
+/**
+ * Reads the next value as an NSString, NSNumber, NSNull, or an NSDictionary or NSArray of those
+ **/
+- (id)readValue;
+- (void)skipValue;
+
+/**
+ * Reads the value of the member named key of the object that is the next value, skipping over every other member, or
+ * nil if it has no such member. The reader is left inside the object.
+ **/
+- (id)readValueForKey:(NSString *)key;
+@end
+
+/**
+ * FNV-1a, salted with seed. CaptureSchemaParser.pl picks a seed for each generated class that gives each of the class's
+ * keys a slot of its own, and has its own copy of this function, so the two must be changed together.
+ **/
+static inline uint32_t JRJsonKeyHash(const char *key, size_t length, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (uint8_t) key[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static inline BOOL JRJsonKeyEquals(const char *key, size_t length, const char *literal)
+{
+    return strlen(literal) == length && memcmp(key, literal, length) == 0;
+}
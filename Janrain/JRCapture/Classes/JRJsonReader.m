@@ -0,0 +1,541 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRJsonReader.h"
+
+/* Numbers longer than this can't be exact anyway, and are read as malformed */
+#define cJRMaxNumberLength 64
+
+static inline BOOL JRIsJsonSpace(uint8_t c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline int JRHexValue(uint8_t c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+@implementation JRJsonReader
+{
+    const uint8_t *_bytes;
+    size_t _length;
+    size_t _position;
+    uint8_t *_scratch;
+    size_t _scratchCapacity;
+}
+@synthesize data = _data;
+@synthesize failed = _failed;
+
+- (id)initWithData:(NSData *)data
+{
+    if ((self = [super init]))
+    {
+        _data = data;
+        _bytes = [data bytes];
+        _length = [data length];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_scratch);
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return [[JRJsonReader allocWithZone:zone] initWithData:_data];
+}
+
+- (void)fail
+{
+    if (!_failed) DLog(@"malformed JSON at byte %lu", (unsigned long) _position);
+    _failed = YES;
+    _position = _length;
+}
+
+/**
+ * Skips whitespace and returns the next byte without consuming it, or 0 at the end
+ */
+- (uint8_t)peek
+{
+    while (_position < _length && JRIsJsonSpace(_bytes[_position])) _position++;
+    return _position < _length ? _bytes[_position] : 0;
+}
+
+- (BOOL)consumeLiteral:(const char *)literal
+{
+    size_t length = strlen(literal);
+    if (_length - _position < length || memcmp(_bytes + _position, literal, length) != 0)
+    {
+        [self fail];
+        return NO;
+    }
+
+    _position += length;
+    return YES;
+}
+
+- (uint8_t *)scratchWithCapacity:(size_t)capacity
+{
+    if (capacity > _scratchCapacity)
+    {
+        _scratchCapacity = MAX(capacity, _scratchCapacity * 2);
+        _scratch = realloc(_scratch, _scratchCapacity);
+    }
+
+    return _scratch;
+}
+
+- (NSUInteger)readHexQuad
+{
+    if (_length - _position < 4)
+    {
+        [self fail];
+        return 0;
+    }
+
+    NSUInteger unit = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        int digit = JRHexValue(_bytes[_position++]);
+        if (digit < 0)
+        {
+            [self fail];
+            return 0;
+        }
+        unit = unit << 4 | (NSUInteger) digit;
+    }
+
+    return unit;
+}
+
+/**
+ * Reads the string the reader is at, returning its UTF-8 bytes: straight from the body if it has no escapes, otherwise
+ * unescaped into the scratch buffer
+ */
+- (const uint8_t *)readStringBytes:(size_t *)length
+{
+    if ([self peek] != '"')
+    {
+        [self fail];
+        return NULL;
+    }
+
+    size_t start = ++_position;
+    while (_position < _length && _bytes[_position] != '"' && _bytes[_position] != '\\') _position++;
+
+    if (_position >= _length)
+    {
+        [self fail];
+        return NULL;
+    }
+
+    if (_bytes[_position] == '"')
+    {
+        *length = _position++ - start;
+        return _bytes + start;
+    }
+
+    /* Unescaping never makes a string longer */
+    size_t end = start;
+    while (end < _length && _bytes[end] != '"') end += _bytes[end] == '\\' ? 2 : 1;
+    uint8_t *out = [self scratchWithCapacity:end - start];
+    size_t count = _position - start;
+    memcpy(out, _bytes + start, count);
+
+    while (_position < _length && _bytes[_position] != '"')
+    {
+        uint8_t c = _bytes[_position++];
+        if (c != '\\')
+        {
+            out[count++] = c;
+            continue;
+        }
+
+        if (_position >= _length) break;
+        switch (_bytes[_position++])
+        {
+            case '"': out[count++] = '"'; break;
+            case '\\': out[count++] = '\\'; break;
+            case '/': out[count++] = '/'; break;
+            case 'b': out[count++] = '\b'; break;
+            case 'f': out[count++] = '\f'; break;
+            case 'n': out[count++] = '\n'; break;
+            case 'r': out[count++] = '\r'; break;
+            case 't': out[count++] = '\t'; break;
+            case 'u':
+            {
+                NSUInteger codePoint = [self readHexQuad];
+                if (codePoint >= 0xD800 && codePoint < 0xDC00 && _length - _position >= 6 &&
+                        _bytes[_position] == '\\' && _bytes[_position + 1] == 'u')
+                {
+                    _position += 2;
+                    NSUInteger low = [self readHexQuad];
+                    if (low >= 0xDC00 && low < 0xE000)
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    else
+                        codePoint = 0xFFFD;
+                }
+                else if (codePoint >= 0xD800 && codePoint < 0xE000)
+                {
+                    codePoint = 0xFFFD;
+                }
+
+                /* \uXXXX is six bytes and at most three in UTF-8, a surrogate pair twelve and four */
+                if (codePoint < 0x80)
+                {
+                    out[count++] = (uint8_t) codePoint;
+                }
+                else if (codePoint < 0x800)
+                {
+                    out[count++] = (uint8_t) (0xC0 | codePoint >> 6);
+                    out[count++] = (uint8_t) (0x80 | (codePoint & 0x3F));
+                }
+                else if (codePoint < 0x10000)
+                {
+                    out[count++] = (uint8_t) (0xE0 | codePoint >> 12);
+                    out[count++] = (uint8_t) (0x80 | (codePoint >> 6 & 0x3F));
+                    out[count++] = (uint8_t) (0x80 | (codePoint & 0x3F));
+                }
+                else
+                {
+                    out[count++] = (uint8_t) (0xF0 | codePoint >> 18);
+                    out[count++] = (uint8_t) (0x80 | (codePoint >> 12 & 0x3F));
+                    out[count++] = (uint8_t) (0x80 | (codePoint >> 6 & 0x3F));
+                    out[count++] = (uint8_t) (0x80 | (codePoint & 0x3F));
+                }
+                break;
+            }
+            default:
+                [self fail];
+                return NULL;
+        }
+    }
+
+    if (_failed || _position >= _length)
+    {
+        [self fail];
+        return NULL;
+    }
+
+    _position++;
+    *length = count;
+    return out;
+}
+
+/**
+ * Moves past the string the reader is at without unescaping it
+ */
+- (BOOL)skipString
+{
+    _position++;
+    while (_position < _length && _bytes[_position] != '"') _position += _bytes[_position] == '\\' ? 2 : 1;
+
+    if (_position >= _length)
+    {
+        [self fail];
+        return NO;
+    }
+
+    _position++;
+    return YES;
+}
+
+- (NSString *)readString
+{
+    size_t length;
+    const uint8_t *bytes = [self readStringBytes:&length];
+    if (!bytes) return nil;
+
+    NSString *string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+    if (!string) [self fail];
+
+    return string;
+}
+
+- (NSNumber *)readNumber
+{
+    size_t start = _position;
+    BOOL isInteger = YES;
+    while (_position < _length)
+    {
+        uint8_t c = _bytes[_position];
+        if (c == '.' || c == 'e' || c == 'E') isInteger = NO;
+        else if (!(c >= '0' && c <= '9') && c != '-' && c != '+') break;
+        _position++;
+    }
+
+    size_t length = _position - start;
+    if (!length || length >= cJRMaxNumberLength)
+    {
+        [self fail];
+        return nil;
+    }
+
+    char number[cJRMaxNumberLength];
+    memcpy(number, _bytes + start, length);
+    number[length] = '\0';
+
+    char *end;
+    errno = 0;
+    if (isInteger)
+    {
+        long long value = strtoll(number, &end, 10);
+        if (*end == '\0' && errno != ERANGE) return [NSNumber numberWithLongLong:value];
+    }
+
+    double value = strtod(number, &end);
+    if (*end != '\0')
+    {
+        [self fail];
+        return nil;
+    }
+
+    return [NSNumber numberWithDouble:value];
+}
+
+- (BOOL)beginObject
+{
+    if ([self peek] == '{')
+    {
+        _position++;
+        return YES;
+    }
+
+    [self skipValue];
+    return NO;
+}
+
+- (const char *)nextKey:(size_t *)length
+{
+    uint8_t c = [self peek];
+    if (c == ',')
+    {
+        _position++;
+        c = [self peek];
+    }
+
+    if (c == '}')
+    {
+        _position++;
+        return NULL;
+    }
+
+    const uint8_t *key = [self readStringBytes:length];
+    if (!key) return NULL;
+
+    if ([self peek] != ':')
+    {
+        [self fail];
+        return NULL;
+    }
+
+    _position++;
+    return (const char *) key;
+}
+
+- (BOOL)beginArray
+{
+    if ([self peek] == '[')
+    {
+        _position++;
+        return YES;
+    }
+
+    [self skipValue];
+    return NO;
+}
+
+- (BOOL)nextElement
+{
+    uint8_t c = [self peek];
+    if (c == ',')
+    {
+        _position++;
+        c = [self peek];
+    }
+
+    if (c == ']')
+    {
+        _position++;
+        return NO;
+    }
+
+    if (!c) [self fail];
+    return !_failed;
+}
+
+- (id)readValue
+{
+    switch ([self peek])
+    {
+        case '{':
+        {
+            _position++;
+            NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+            const char *key;
+            size_t length;
+            while ((key = [self nextKey:&length]))
+            {
+                NSString *name = [[NSString alloc] initWithBytes:key length:length encoding:NSUTF8StringEncoding];
+                if (!name) [self fail];
+
+                id value = [self readValue];
+                if (!value) break;
+                [dictionary setObject:value forKey:name];
+            }
+            return _failed ? nil : dictionary;
+        }
+        case '[':
+        {
+            _position++;
+            NSMutableArray *array = [NSMutableArray array];
+            while ([self nextElement])
+            {
+                id value = [self readValue];
+                if (!value) break;
+                [array addObject:value];
+            }
+            return _failed ? nil : array;
+        }
+        case '"':
+            return [self readString];
+        case 't':
+            return [self consumeLiteral:"true"] ? [NSNumber numberWithBool:YES] : nil;
+        case 'f':
+            return [self consumeLiteral:"false"] ? [NSNumber numberWithBool:NO] : nil;
+        case 'n':
+            return [self consumeLiteral:"null"] ? [NSNull null] : nil;
+        default:
+            return [self readNumber];
+    }
+}
+
+- (void)skipValue
+{
+    switch ([self peek])
+    {
+        case '{':
+        case '[':
+        {
+            NSUInteger depth = 0;
+            while (_position < _length)
+            {
+                uint8_t c = _bytes[_position];
+                if (c == '"')
+                {
+                    if (![self skipString]) return;
+                    continue;
+                }
+
+                _position++;
+                if (c == '{' || c == '[') depth++;
+                else if ((c == '}' || c == ']') && --depth == 0) return;
+            }
+            [self fail];
+            return;
+        }
+        case '"':
+            [self skipString];
+            return;
+        case 't':
+            [self consumeLiteral:"true"];
+            return;
+        case 'f':
+            [self consumeLiteral:"false"];
+            return;
+        case 'n':
+            [self consumeLiteral:"null"];
+            return;
+        default:
+            [self readNumber];
+            return;
+    }
+}
+
+- (id)readValueForKey:(NSString *)key
+{
+    if (![self beginObject]) return nil;
+
+    const char *name = [key UTF8String];
+    const char *nextKey;
+    size_t length;
+    while ((nextKey = [self nextKey:&length]))
+    {
+        if (JRJsonKeyEquals(nextKey, length, name)) return [self readValue];
+        [self skipValue];
+    }
+
+    return nil;
+}
+
++ (NSDictionary *)dictionaryFromData:(NSData *)data deferringKey:(NSString *)key
+{
+    JRJsonReader *reader = [[JRJsonReader alloc] initWithData:data];
+    if ([reader peek] != '{') return nil;
+    reader->_position++;
+
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    const char *deferredKey = [key UTF8String];
+    const char *nextKey;
+    size_t length;
+    while ((nextKey = [reader nextKey:&length]))
+    {
+        NSString *name = [[NSString alloc] initWithBytes:nextKey length:length encoding:NSUTF8StringEncoding];
+        id value;
+        if (JRJsonKeyEquals(nextKey, length, deferredKey))
+        {
+            [reader peek];
+            size_t start = reader->_position;
+            [reader skipValue];
+            value = [[JRJsonReader alloc] initWithData:
+                    [data subdataWithRange:NSMakeRange(start, reader->_position - start)]];
+        }
+        else
+        {
+            value = [reader readValue];
+        }
+
+        if (!name || !value) return nil;
+        [dictionary setObject:value forKey:name];
+    }
+
+    if (reader.failed || [reader peek]) return nil;
+    return dictionary;
+}
+@end
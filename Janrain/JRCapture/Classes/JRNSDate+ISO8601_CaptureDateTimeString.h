@@ -35,4 +35,7 @@
 + (NSDate *)dateFromISO8601DateTimeString:(NSString *)dateTimeString;
 - (NSString *)stringFromISO8601Date;
 - (NSString *)stringFromISO8601DateTime;
+
+/** The date in UTC as yyyy-MM-dd HH:mm:ss, as Capture wants it in signatures **/
+- (NSString *)stringFromISO8601DateTimeWithoutFraction;
 @end
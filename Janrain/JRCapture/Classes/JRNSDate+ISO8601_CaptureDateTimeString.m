@@ -31,122 +31,249 @@
 #import "debug_log.h"
 #import "JRNSDate+ISO8601_CaptureDateTimeString.h"
 
-@implementation NSDate (JRDate_ISO8601_CaptureDateTimeString)
-+ (NSDate *)dateFromISO8601DateString:(NSString *)dateString
+/*
+ * Capture's dates and date-times are parsed and formatted by hand, in a single pass and without any shared state, so
+ * that they're fast and safe on any thread. They accept what the NSDateFormatters used to, in UTC and the Gregorian
+ * calendar:
+ *   yyyy-MM-dd and yyyyMMdd for dates;
+ *   yyyy-MM-dd HH:mm:ss with a 'T' or a space before the time, optional fractional seconds (kept to the millisecond,
+ *   as NSDateFormatter keeps them) and an optional time zone: +hhmm, +hh:mm, +hh or Z
+ */
+#define JR_MAX_DATE_STRING_LENGTH 64
+
+static int64_t JRDaysFromCivil(int64_t y, unsigned m, unsigned d)
 {
-    if (!dateString) return nil;
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned) (y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t) doe - 719468;
+}
 
-    static NSDateFormatter *dateFormatter = nil;
-    if (!dateFormatter)
-    {
-        dateFormatter = [[NSDateFormatter alloc] init];
-        [dateFormatter setLocale:[[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"]];
-        [dateFormatter setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT:0]];
-        [dateFormatter setLenient:NO];
-    }
+static void JRCivilFromDays(int64_t z, int64_t *y, unsigned *m, unsigned *d)
+{
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = (unsigned) (z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp + (mp < 10 ? 3 : -9);
+    *y = (int64_t) yoe + era * 400 + (*m <= 2);
+}
 
-    NSDate *date = nil;
-    NSString *ISO8601String = [[NSString stringWithString:dateString] uppercaseString];
-    /* Try e.g. 1983-03-12 */
-    [dateFormatter setDateFormat:@"yyyy-MM-dd"];
-    date = [dateFormatter dateFromString:ISO8601String];
+static BOOL JRIsLeapYear(int64_t y)
+{
+    return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
 
-    if (!date) /* 19830312 */
+static unsigned JRDaysInMonth(int64_t y, unsigned m)
+{
+    static const unsigned days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return m == 2 && JRIsLeapYear(y) ? 29 : days[m - 1];
+}
+
+typedef struct
+{
+    const unichar *chars;
+    NSUInteger length;
+    NSUInteger index;
+} JRDateScanner;
+
+static BOOL JRScanDigits(JRDateScanner *scanner, NSUInteger count, unsigned *value)
+{
+    if (scanner->index + count > scanner->length) return NO;
+
+    unsigned result = 0;
+    for (NSUInteger i = 0; i < count; i++)
     {
-        [dateFormatter setDateFormat:@"yyyyMMdd"];
-        date = [dateFormatter dateFromString:ISO8601String];
+        unichar c = scanner->chars[scanner->index + i];
+        if (c < '0' || c > '9') return NO;
+        result = result * 10 + (c - '0');
     }
 
-    if (!date) NSLog(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateString);
-    return date;
+    scanner->index += count;
+    *value = result;
+    return YES;
 }
 
-+ (NSDate *)dateFromISO8601DateTimeString:(NSString *)dateTimeString
+static BOOL JRScanCharacter(JRDateScanner *scanner, unichar c)
 {
-    if (!dateTimeString) return nil;
+    if (scanner->index >= scanner->length || scanner->chars[scanner->index] != c) return NO;
+    scanner->index++;
+    return YES;
+}
 
-    static NSDateFormatter *dateFormatter = nil;
-    if (!dateFormatter)
-    {
-        dateFormatter = [[NSDateFormatter alloc] init];
-        [dateFormatter setLocale:[[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"]];
-        [dateFormatter setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT:0]];
-    }
+static BOOL JRScanDate(JRDateScanner *scanner, BOOL allowBasicFormat, int64_t *days)
+{
+    unsigned year, month, day;
+    if (!JRScanDigits(scanner, 4, &year)) return NO;
 
-    NSString *ISO8601String = [[NSString stringWithString:dateTimeString] uppercaseString];
-    NSDate *date = nil;
-    /* Try full ISO8601; e.g., 2012-02-02 01:33:20.122198 +0000 */
-    [dateFormatter setDateFormat:@"yyyy-MM-dd HH:mm:ss.SSSSSS ZZZ"];
-    date = [dateFormatter dateFromString:ISO8601String];
+    BOOL extended = JRScanCharacter(scanner, '-');
+    if (!extended && !allowBasicFormat) return NO;
+    if (!JRScanDigits(scanner, 2, &month)) return NO;
+    if (extended && !JRScanCharacter(scanner, '-')) return NO;
+    if (!JRScanDigits(scanner, 2, &day)) return NO;
 
-    if (!date) /* With a 'T'; e.g., 2012-02-02T01:33:20.122198 +0000 */
-    {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd'T'HH:mm:ss.SSSSSS ZZZ"];
-        date = [dateFormatter dateFromString:ISO8601String];
-    }
-    if (!date) /* No timezone; e.g., 2012-02-02 01:33:20.122198 */
-    {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd HH:mm:ss.SSSSSS"];
-        date = [dateFormatter dateFromString:ISO8601String];
-    }
-    if (!date) /* No timezone and a 'T'; e.g., 2012-02-02T01:33:20.122198 */
-    {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd'T'HH:mm:ss.SSSSSS"];
-        date = [dateFormatter dateFromString:ISO8601String];
-    }
-    if (!date) /* No milis; e.g., 2012-02-02 01:33:20 +0000 */
+    if (month < 1 || month > 12 || day < 1 || day > JRDaysInMonth(year, month)) return NO;
+    *days = JRDaysFromCivil(year, month, day);
+    return YES;
+}
+
+static BOOL JRUnicharsOfString(NSString *string, unichar *buffer, NSUInteger *length)
+{
+    *length = [string length];
+    if (*length > JR_MAX_DATE_STRING_LENGTH) return NO;
+    [string getCharacters:buffer range:NSMakeRange(0, *length)];
+    return YES;
+}
+
+static NSDate *JRParseCaptureDate(NSString *string)
+{
+    unichar buffer[JR_MAX_DATE_STRING_LENGTH];
+    JRDateScanner scanner = { buffer, 0, 0 };
+    if (!JRUnicharsOfString(string, buffer, &scanner.length)) return nil;
+
+    int64_t days;
+    if (!JRScanDate(&scanner, YES, &days) || scanner.index != scanner.length) return nil;
+    return [NSDate dateWithTimeIntervalSince1970:days * 86400.0];
+}
+
+static NSDate *JRParseCaptureDateTime(NSString *string)
+{
+    unichar buffer[JR_MAX_DATE_STRING_LENGTH];
+    JRDateScanner scanner = { buffer, 0, 0 };
+    if (!JRUnicharsOfString(string, buffer, &scanner.length)) return nil;
+
+    int64_t days;
+    unsigned hour, minute, second, millis = 0;
+    if (!JRScanDate(&scanner, NO, &days)) return nil;
+    if (!JRScanCharacter(&scanner, ' ') && !JRScanCharacter(&scanner, 'T') && !JRScanCharacter(&scanner, 't'))
+        return nil;
+    if (!JRScanDigits(&scanner, 2, &hour) || !JRScanCharacter(&scanner, ':') ||
+            !JRScanDigits(&scanner, 2, &minute) || !JRScanCharacter(&scanner, ':') ||
+            !JRScanDigits(&scanner, 2, &second))
+        return nil;
+    if (hour > 23 || minute > 59 || second > 59) return nil;
+
+    if (JRScanCharacter(&scanner, '.'))
     {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd HH:mm:ss ZZZ"];
-        date = [dateFormatter dateFromString:ISO8601String];
+        unsigned digit, digits = 0;
+        while (JRScanDigits(&scanner, 1, &digit))
+            if (digits++ < 3) millis = millis * 10 + digit;
+        if (!digits) return nil;
+        for (; digits < 3; digits++) millis *= 10;
     }
-    if (!date) /* No milis and a 'T'; e.g., 2012-02-02T01:33:20 +0000 */
+
+    int offset = 0;
+    BOOL spaced = JRScanCharacter(&scanner, ' ');
+    if (JRScanCharacter(&scanner, 'Z') || JRScanCharacter(&scanner, 'z'))
     {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd'T'HH:mm:ss ZZZ"];
-        date = [dateFormatter dateFromString:ISO8601String];
     }
-    if (!date) /* No milis or timezone; e.g., 2012-02-02 01:33:20 */
+    else if (scanner.index < scanner.length)
     {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd HH:mm:ss"];
-        date = [dateFormatter dateFromString:ISO8601String];
+        unichar sign = scanner.chars[scanner.index++];
+        if (sign != '+' && sign != '-') return nil;
+
+        unsigned offsetHours, offsetMinutes = 0;
+        if (!JRScanDigits(&scanner, 2, &offsetHours)) return nil;
+        BOOL colon = JRScanCharacter(&scanner, ':');
+        if ((colon || scanner.index < scanner.length) && !JRScanDigits(&scanner, 2, &offsetMinutes)) return nil;
+        if (offsetHours > 23 || offsetMinutes > 59) return nil;
+
+        offset = (int) (offsetHours * 3600 + offsetMinutes * 60) * (sign == '-' ? -1 : 1);
     }
-    if (!date) /* No milis or timezone and a 'T'; e.g., 2012-02-02T01:33:20 */
+    else if (spaced)
     {
-        [dateFormatter setDateFormat:@"yyyy-MM-dd'T'HH:mm:ss"];
-        date = [dateFormatter dateFromString:ISO8601String];
+        return nil;
     }
 
-    if (!date) NSLog(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateTimeString);
+    if (scanner.index != scanner.length) return nil;
+
+    int64_t seconds = days * 86400 + hour * 3600 + minute * 60 + second - offset;
+    return [NSDate dateWithTimeIntervalSince1970:(double) seconds + millis / 1000.0];
+}
+
+/*
+ * The date's UTC fields, to the millisecond, rounded down as NSDateFormatter rounds them; but from the nearest tenth
+ * of a millisecond, so that a date parsed from e.g. ".190" isn't printed as ".189" for want of a binary fraction
+ */
+static void JRUtcFieldsOfDate(NSDate *date, int64_t *year, unsigned *month, unsigned *day, unsigned *hour,
+                              unsigned *minute, unsigned *second, unsigned *millis)
+{
+    double interval = [date timeIntervalSince1970];
+    double wholeSeconds = floor(interval);
+    int64_t totalMillis = (int64_t) wholeSeconds * 1000 + llround((interval - wholeSeconds) * 1e4) / 10;
+    int64_t days = totalMillis >= 0 ? totalMillis / 86400000 : -((-totalMillis + 86399999) / 86400000);
+    int64_t millisOfDay = totalMillis - days * 86400000;
+
+    JRCivilFromDays(days, year, month, day);
+    *hour = (unsigned) (millisOfDay / 3600000);
+    *minute = (unsigned) (millisOfDay / 60000 % 60);
+    *second = (unsigned) (millisOfDay / 1000 % 60);
+    *millis = (unsigned) (millisOfDay % 1000);
+}
+
+typedef enum
+{
+    JRCaptureDateFormatDate,
+    JRCaptureDateFormatDateTime,
+    JRCaptureDateFormatDateTimeWithFraction,
+} JRCaptureDateFormat;
+
+static NSString *JRFormatCaptureDate(NSDate *date, JRCaptureDateFormat format)
+{
+    int64_t year;
+    unsigned month, day, hour, minute, second, millis;
+    JRUtcFieldsOfDate(date, &year, &month, &day, &hour, &minute, &second, &millis);
+
+    char buffer[48];
+    int length;
+    if (format == JRCaptureDateFormatDate)
+        length = snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02u", (long long) year, month, day);
+    else if (format == JRCaptureDateFormatDateTime)
+        length = snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02u %02u:%02u:%02u", (long long) year, month, day,
+                          hour, minute, second);
+    else
+        length = snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02u %02u:%02u:%02u.%03u000 +0000", (long long) year,
+                          month, day, hour, minute, second, millis);
+
+    return [[NSString alloc] initWithBytes:buffer length:(NSUInteger) length encoding:NSASCIIStringEncoding];
+}
+
+@implementation NSDate (JRDate_ISO8601_CaptureDateTimeString)
++ (NSDate *)dateFromISO8601DateString:(NSString *)dateString
+{
+    if (!dateString) return nil;
+
+    NSDate *date = JRParseCaptureDate(dateString);
+    if (!date) NSLog(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateString);
     return date;
 }
 
-- (NSString *)stringFromISO8601Date
++ (NSDate *)dateFromISO8601DateTimeString:(NSString *)dateTimeString
 {
-    DLog(@"");
-    static NSDateFormatter *dateFormatter = nil;
-    if (!dateFormatter)
-    {
-        dateFormatter = [[NSDateFormatter alloc] init];
-        [dateFormatter setLocale:[[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"]];
-        [dateFormatter setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT:0]];
+    if (!dateTimeString) return nil;
 
-        [dateFormatter setDateFormat:@"yyyy-MM-dd"];
-    }
+    NSDate *date = JRParseCaptureDateTime(dateTimeString);
+    if (!date) NSLog(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateTimeString);
+    return date;
+}
 
-    return [dateFormatter stringFromDate:self];
+- (NSString *)stringFromISO8601Date
+{
+    return JRFormatCaptureDate(self, JRCaptureDateFormatDate);
 }
 
 - (NSString *)stringFromISO8601DateTime
 {
-    static NSDateFormatter *dateFormatter = nil;
-    if (!dateFormatter)
-    {
-        dateFormatter = [[NSDateFormatter alloc] init];
-        [dateFormatter setLocale:[[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"]];
-        [dateFormatter setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT:0]];
-
-        [dateFormatter setDateFormat:@"yyyy-MM-dd HH:mm:ss.SSSSSS ZZZ"];
-    }
+    return JRFormatCaptureDate(self, JRCaptureDateFormatDateTimeWithFraction);
+}
 
-    return [dateFormatter stringFromDate:self];
+- (NSString *)stringFromISO8601DateTimeWithoutFraction
+{
+    return JRFormatCaptureDate(self, JRCaptureDateFormatDateTime);
 }
 @end
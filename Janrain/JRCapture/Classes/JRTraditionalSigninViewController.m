@@ -310,7 +310,7 @@ typedef enum
     } else {
         JRCaptureData *data = [JRCaptureData sharedCaptureData];
         NSString *fieldName = [data getForgottenPasswordFieldName];
-        NSDictionary *field = [[data.captureFlow objectForKey:@"fields"] objectForKey:fieldName];
+        NSDictionary *field = [data.captureFlow fieldForName:fieldName];
         NSString *placeholder = [field objectForKey:@"placeholder"];
         if (!placeholder)
         {
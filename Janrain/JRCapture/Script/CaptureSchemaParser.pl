@@ -38,6 +38,7 @@ use strict;
 use warnings;
 use JSON;
 use Getopt::Std;
+use Digest::MD5 qw(md5_hex);
 
 require './ObjCMethodParts.pl';
 
@@ -51,7 +52,11 @@ sub openSchemaNamed {
 
 sub usage {
   print "Usage:\n";
-  print "CaptureSchemaParser.pl -f path/to/schema.json -o path/to/output/directory\n";
+  print "CaptureSchemaParser.pl -f path/to/schema.json -o path/to/output/directory [-t] [-j jobs] [-p projection]\n";
+  print "  -t  Describe each class with a table that JRCaptureObject implements the class's methods from\n";
+  print "  -j  Generate the user's sub-objects and plurals in this many worker processes (default 4)\n";
+  print "  -p  Only generate, and read from Capture, the attributes listed in this file, one path per line;\n";
+  print "      plurals can only be listed whole\n";
   die $_[0];
 }
 
@@ -61,7 +66,10 @@ sub usage {
 ########################################################################
 our ($opt_o);
 our ($opt_f);
-getopt('fo');
+our ($opt_t);
+our ($opt_j);
+our ($opt_p);
+getopts('f:o:tj:p:');
 my $schemaName = $opt_f;
 my $schema = "";
 my $reserved_schema = "";
@@ -89,6 +97,50 @@ if (defined $opt_o) {
   usage("[ERROR] Missing output directory parameter.");
 }
 
+########################################################################
+# with the option '-t', write the classes in table mode: rather than
+# writing out their methods property by property, each class describes
+# its properties in a static JRCaptureSchema, and JRCaptureObject
+# implements the methods from it
+########################################################################
+my $tableMode = defined $opt_t;
+
+########################################################################
+# the number of worker processes was passed in on the command line with
+# the option '-j'; with 1, everything is generated in this process
+########################################################################
+my $jobCount = defined $opt_j ? $opt_j : 4;
+
+if ($jobCount !~ /^\d+$/ || $jobCount < 1) {
+  usage("[ERROR] The number of jobs must be a positive integer.");
+}
+
+########################################################################
+# the projection file was passed in on the command line with the option
+# '-p'. It lists the attributes the app uses, one path per line, e.g.
+# 'email' or 'primaryAddress.city'; a path to an object or plural keeps
+# all of it, and '#' starts a comment. Only those attributes are
+# generated, and only they are read from Capture.
+#
+# Capture replaces an object or plural element with exactly what is
+# sent, so whatever a class leaves out would be deleted by replacing it.
+# Plurals can therefore only be listed whole: their elements are always
+# replaced, with the array. The user, and objects that are only partly
+# listed, fail replaceOnCaptureForDelegate:context: locally; they can
+# still be updated, which only sends what changed
+########################################################################
+my %projection = ();
+
+if (defined $opt_p) {
+  foreach my $line (split (/\n/, openSchemaNamed($opt_p))) {
+    $line =~ s/#.*//;
+    $line = trim($line);
+    $projection{$line} = 1 if ($line ne "");
+  }
+
+  usage("[ERROR] The projection file '$opt_p' does not list any attributes.") unless (%projection);
+}
+
 
 ############################################
 # CONSTANTS
@@ -112,6 +164,22 @@ my %mFiles = ();
 my %repeatNamesHash = ();
 
 
+############################################
+# THE USER'S SUB-OBJECTS AND PLURALS, WHEN
+# THEY ARE GENERATED SEPARATELY FROM IT
+############################################
+my $deferSubtrees = 0;
+my @subtreeJobs   = ();
+
+
+############################################
+# THE PATHS OF THE PROJECTED ATTRIBUTES, AS
+# THE USER ASKS CAPTURE FOR THEM
+############################################
+my @attributeProjection = ();
+my $userIsProjected     = 0;
+
+
 ############################################
 # HELPER METHODS
 ############################################
@@ -241,6 +309,48 @@ sub getIsReadOnly {
   return 0;
 }
 
+##########################################################
+# Keep the attributes in attr_defs that the projection
+# names, those that lead to attributes it names, and the
+# ones every object needs ('id', 'uuid', 'created' and
+# 'lastUpdated'). An object that loses some of its
+# attributes, directly or in a sub-object, is marked
+# 'projected'; a plural can't lose any. Returns the kept
+# attributes, whether any were left out, and the paths
+# Capture is asked for, e.g.:
+#   ('email', 'primaryAddress.city', 'profiles')
+##########################################################
+sub projectAttrDefs {
+  my $attrDefsRef  = $_[0];
+  my $pathPrefix   = $_[1];
+  my $usedPathsRef = $_[2];
+  my @keptAttrDefs = ();
+  my @keptPaths    = ();
+
+  foreach my $attrDef (@$attrDefsRef) {
+    my $path = $pathPrefix . $attrDef->{"name"};
+
+    if ($projection{$path} || getIsReadOnly($attrDef->{"name"})) {
+      push (@keptAttrDefs, $attrDef);
+      push (@keptPaths, $path);
+      $usedPathsRef->{$path} = 1;
+    } elsif ($attrDef->{"attr_defs"} && grep { index ($_, "$path.") == 0 } keys (%projection)) {
+      if ($attrDef->{"type"} eq "plural") {
+        die "[ERROR] The projection file lists only part of the plural '$path'. Replacing its elements on Capture " .
+            "would delete the rest, so list '$path' whole instead.\n\n";
+      }
+
+      my ($keptChildrenRef, $isProjected, @childPaths) =
+          projectAttrDefs($attrDef->{"attr_defs"}, "$path.", $usedPathsRef);
+      push (@keptAttrDefs, { %$attrDef, "attr_defs" => $keptChildrenRef, "projected" => $isProjected });
+      push (@keptPaths, @childPaths);
+    }
+  }
+
+  my $isProjected = @keptAttrDefs < @$attrDefsRef || grep { $_->{"projected"} } @keptAttrDefs;
+  return (\@keptAttrDefs, ($isProjected ? 1 : 0), @keptPaths);
+}
+
 ##########################################################
 # Certain properties may share a name with Objective-C
 # keywords and reserved words (e.g., 'id'). Make sure
@@ -276,6 +386,81 @@ sub trim {
 }
 
 
+##########################################################
+# Add the names of an object and of all of its sub-objects
+# and plurals to the repeatNamesHash, renaming them just
+# as recursiveParse would, without generating anything.
+# Used to skip over a subtree that is generated elsewhere
+##########################################################
+sub collectObjectNames {
+  my $objectName      = $_[0];
+  my $arrRef          = $_[1];
+  my $isPluralElement = $_[2];
+
+  $repeatNamesHash{$objectName} = 1;
+
+  if ($isPluralElement) {
+    $objectName .= "Element";
+  }
+
+  foreach my $hashRef (@$arrRef) {
+    my $propertyName = $hashRef->{"name"};
+    my $propertyType = $hashRef->{"type"};
+
+    if (getIsPropertyNameObjcKeyword($propertyName)) {
+      $propertyName = $objectName . ucfirst($propertyName);
+    }
+
+    if (($propertyType eq "plural" && !getIsAnArrayOfStrings($hashRef->{"attr_defs"})) || $propertyType eq "object") {
+      if ($repeatNamesHash{$propertyName}) {
+        $propertyName = $objectName . ucfirst($propertyName);
+      }
+
+      collectObjectNames($propertyName, $hashRef->{"attr_defs"}, $propertyType eq "plural");
+    }
+  }
+}
+
+##########################################################
+# Recurse on a sub-object or plural; or, for those of the
+# user, when they are generated separately, remember how
+# to parse it and the names taken so far, and skip it
+##########################################################
+sub parseSubtree {
+  my $parentName = shift @_;
+
+  if (!$deferSubtrees || $parentName ne "captureUser") {
+    recursiveParse(@_);
+    return;
+  }
+
+  push (@subtreeJobs, { args => [@_], names => { %repeatNamesHash } });
+  collectObjectNames($_[0], $_[1], $_[4]);
+}
+
+##########################################################
+# Write a generated file, unless it's already there with
+# the same contents, so that Xcode doesn't recompile it
+##########################################################
+sub writeFileIfChanged {
+  my $path     = $_[0];
+  my $contents = $_[1];
+
+  if (-e $path && open (my $existing, "<", $path)) {
+    local $/;
+    my $existingContents = <$existing>;
+    close ($existing);
+
+    return 0 if (defined $existingContents && $existingContents eq $contents);
+  }
+
+  open (my $file, ">", $path) or die "[ERROR] Unable to open '$path' for writing\n\n";
+  print $file $contents;
+  close ($file);
+
+  return 1;
+}
+
 ##############################################################################################################
 # RECURSIVE PARSING METHOD
 #
@@ -345,6 +530,7 @@ sub recursiveParse {
   my $isPluralElement = $_[4];
   my $hasPluralParent = $_[5];
   my $objectDesc      = $_[6];
+  my $isProjected     = $_[7];
 
   my $className;
   my $objectPath;
@@ -455,14 +641,26 @@ sub recursiveParse {
   my $extraImportsSection        = "";
   my $propertiesSection          = "";
   my $privateIvarsSection        = "";
+  my $hasLazyProperties          = 0;
+  my @jsonReaderKeys             = ();
+  my %jsonReaderCases            = ();
+  my $jsonReaderDefaults         = "";
+  my $jsonReaderDeferred         = "";
+  my $archiveWriterLines         = "";
+  my %archiveReaderCases         = ();
   my $arrayCategoriesSection     = "";
   my $objectCategoriesSection    = "";
   my $synthesizeSection          = ""; # Well, now it's all dynamic, but the section is still needed
   my $getterSettersSection       = "";
+  my $dirtyPropertyIndexSection  = "";
+  my $dirtyPropertyNamesSection  = "";
   my $replaceArrayIntfSection    = "";
   my $replaceArrayImplSection    = "";
   my $arrayCompareIntfSection    = "";
   my $arrayCompareImplSection    = "";
+  my $attributeTableSection      = "";
+  my $tableAccessorsSection      = "";
+  my $tableConstructorLines      = "";
   my @minConstructorSection      = getMinConstructorParts();
   my @constructorSection         = getConstructorParts();
   my @minClassConstructorSection = getMinClassConstructorParts();
@@ -477,9 +675,14 @@ sub recursiveParse {
   my @updateRemotelySection      = getUpdateRemotelyParts();
   my @dirtyPropertySection       = getDirtyPropertySnapshotParts();
   my @toReplaceDictSection       = getToReplaceDictParts();
+  my @writeUpdateJsonSection     = getWriteUpdateJsonParts();
+  my @writeReplaceJsonSection    = getWriteReplaceJsonParts();
   my @needsUpdateSection         = getNeedsUpdateParts();
   my @isEqualObjectSection       = getIsEqualObjectParts();
   my @objectPropertiesSection    = getObjectPropertiesParts();
+  my @deepClearDirtySection      = getDeepClearDirtyPropertiesParts();
+  my @isEqualByPrivateSection    = getIsEqualByPrivatePropertiesParts();
+  my @validateSection            = getValidateParts();
 
   my @doxygenClassDescSection       = getDoxygenClassDescParts();
   my @minConstructorDocSection      = getMinConstructorDocParts();
@@ -686,11 +889,22 @@ sub recursiveParse {
   #       [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"captureUser"] allObjects]];
   $dirtyPropertySection[12] = $dirtyPropertySection[14] = $objectName;
 
+  # e.g.:
+  #   JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRExampleObjectPropertyCount)];
+  $updateFromDictSection[3] = $replaceFromDictSection[3] = $className;
+
   # e.g.:
   #   - (BOOL)isEqualToExampleElement:(JRExampleElement *)otherExampleElement
   #   {
   $isEqualObjectSection[1]    = ucfirst($objectName) . ":(" . $className . " *)other" . ucfirst($objectName);
 
+  # e.g.:
+  #   if (![otherObj isKindOfClass:[JRExampleElement class]]) return NO;
+  #
+  #   JRExampleElement *otherExampleElement = (JRExampleElement *)otherObj;
+  $isEqualByPrivateSection[4] = $isEqualByPrivateSection[6] = $isEqualByPrivateSection[10] = $className;
+  $isEqualByPrivateSection[8] = ucfirst($objectName);
+
   ################################################################################
   # Deal with the Capture path and id depending on whether the object itself
   # is an element of a plural or if it is a decendent of an object in a plural
@@ -717,15 +931,15 @@ sub recursiveParse {
 
     # e.g.:
     #   self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%d", capturePath, @"exampleElement", [(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
-    $updateFromDictSection[4]  = "#%ld";
-    $updateFromDictSection[6]  = "\@\"" . $pathAppend . "\"";
-    $updateFromDictSection[7]  = ", (long)[(NSNumber*)[dictionary objectForKey:\@\"id\"] integerValue]";
+    $updateFromDictSection[6]  = "#%ld";
+    $updateFromDictSection[8]  = "\@\"" . $pathAppend . "\"";
+    $updateFromDictSection[9]  = ", (long)[(NSNumber*)[dictionary objectForKey:\@\"id\"] integerValue]";
 
     # e.g.:
     #   self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%d", capturePath, @"exampleElement", [(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
-    $replaceFromDictSection[4] = "#%ld";
-    $replaceFromDictSection[6] = "\@\"" . $pathAppend . "\"";
-    $replaceFromDictSection[7] = ", (long)[(NSNumber*)[dictionary objectForKey:\@\"id\"] integerValue]";
+    $replaceFromDictSection[6] = "#%ld";
+    $replaceFromDictSection[8] = "\@\"" . $pathAppend . "\"";
+    $replaceFromDictSection[9] = ", (long)[(NSNumber*)[dictionary objectForKey:\@\"id\"] integerValue]";
 
   } elsif ($hasPluralParent) {
   ################################################################################
@@ -746,8 +960,8 @@ sub recursiveParse {
 
     # e.g.:
     #   self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"exampleElement"];
-    $updateFromDictSection[6]  = "\@\"" . $pathAppend . "\"";
-    $replaceFromDictSection[6] = "\@\"" . $pathAppend . "\"";
+    $updateFromDictSection[8]  = "\@\"" . $pathAppend . "\"";
+    $replaceFromDictSection[8] = "\@\"" . $pathAppend . "\"";
 
 
     $propertiesSection .= "/**\n" .
@@ -777,8 +991,8 @@ sub recursiveParse {
   ################################################################################
 
     for (my $i = 10; $i <= 18; $i++) { $objFromDictSection[$i]     = ""; }
-    for (my $i = 3;  $i <= 8;  $i++) { $updateFromDictSection[$i]  = ""; }
-    for (my $i = 3;  $i <= 8;  $i++) { $replaceFromDictSection[$i] = ""; }
+    for (my $i = 5;  $i <= 10; $i++) { $updateFromDictSection[$i]  = ""; }
+    for (my $i = 5;  $i <= 10; $i++) { $replaceFromDictSection[$i] = ""; }
 
   }
 
@@ -920,6 +1134,7 @@ sub recursiveParse {
     my $toDictionary           = "self.$propertyName";        # Default operation is to insert the NSObject into an NSMutableDictionary with no other modifications
     my $toUpDictionary         = "self.$propertyName";        # Default operation for toUpdateDictionary
     my $toRplDictionary        = "self.$propertyName";        # Default operation for toReplaceDictionary
+    my $toRplWriter            = "";                          # How an array of plural elements writes its replace JSON
     my $frDictionary           =                              # Default operation is to just pull the NSObject from
           "[dictionary objectForKey:\@\"$dictionaryKey\"]";   # the dictionary and stick it into the property
     my $frUpDictionary         =
@@ -927,6 +1142,7 @@ sub recursiveParse {
     my $frRplDictionary        =
           "[dictionary objectForKey:\@\"$dictionaryKey\"]";
     my $frDcdDictionary        = "";
+    my $frJson                 = "";                          # How a lazily loaded property is built from its JSON
     my $isEqualMethod          = "";
 
     if ($propertyDesc) {                                         # Use the property description for the Doxygen comment
@@ -1105,22 +1321,33 @@ sub recursiveParse {
 
         $toDictionary    = "[self." . $propertyName . " arrayOf" . ucfirst($propertyName) . "DictionariesFrom" . ucfirst($propertyName) . "ElementsForEncoder:forEncoder]";
         $toRplDictionary = "[self." . $propertyName . " arrayOf" . ucfirst($propertyName) . "ReplaceDictionariesFrom" . ucfirst($propertyName) . "Elements]";
+        $toRplWriter     = "writeReplaceJsonOf" . ucfirst($propertyName) . "ElementsToWriter:writer";
         $frDictionary    = "[(NSArray*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:" . $objectName . ".captureObjectPath fromDecoder:fromDecoder]";
         $frRplDictionary = "[(NSArray*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:self.captureObjectPath fromDecoder:NO]";
         $frDcdDictionary = "[(NSArray*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:self.captureObjectPath fromDecoder:YES]";
+        $frJson          = "[[json arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy]";
 
         $extraImportsSection     .= "#import \"JR" . ucfirst($propertyName) . "Element.h\"\n";
         $objectCategoriesSection .= createObjectCategoryForSubobject ($propertyName . "Element", 1);
         $arrayCategoriesSection  .= createArrayCategoryForSubobject ($propertyName);
         $arrayCompareIntfSection .= getArrayComparisonDeclaration($propertyName);
         $arrayCompareImplSection .= getArrayComparisonImplementation($propertyName);
+        $arrayCompareIntfSection .= getArrayPrivateComparisonDeclaration($propertyName);
+        $arrayCompareImplSection .= getArrayPrivateComparisonImplementation($propertyName);
+
+        # e.g.:
+        #   if (self.bar && ![self.bar isEqualByPrivatePropertiesToBarArray:otherExampleObject.bar])
+        #       return NO;
+        $isEqualByPrivateSection[12] .=
+              "    if (self." . $propertyName . " && ![self." . $propertyName . " isEqualByPrivatePropertiesTo" . ucfirst($propertyName) . "Array:other" . ucfirst($objectName) . "." . $propertyName . "])\n" .
+              "        return NO;\n\n";
 
         $isEqualMethod  = "isEqualTo" . ucfirst($propertyName) . "Array:";
 
         $propertyNotes .= " \@note This is an array of JR" . ucfirst($propertyName) . "Element objects";
 
         ######## AND RECURSE!! ########
-        recursiveParse ($propertyName, $propertyAttrDefsRef, $objectPath, $pathName, $IS_PLURAL_ELEMENT, $HAS_PLURAL_PARENT, $propertyDesc);
+        parseSubtree ($objectName, $propertyName, $propertyAttrDefsRef, $objectPath, $pathName, $IS_PLURAL_ELEMENT, $HAS_PLURAL_PARENT, $propertyDesc);
 
       }
 
@@ -1150,6 +1377,7 @@ sub recursiveParse {
       $frUpDictionary  = "[JR" . ucfirst($propertyName) . " " . $propertyName . "ObjectFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath fromDecoder:NO]";
       $frRplDictionary = "[JR" . ucfirst($propertyName) . " " . $propertyName . "ObjectFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath fromDecoder:NO]";
       $frDcdDictionary = "[JR" . ucfirst($propertyName) . " " . $propertyName . "ObjectFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath fromDecoder:YES]";
+      $frJson          = "[JR" . ucfirst($propertyName) . " " . $propertyName . "ObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO]";
 
       $isEqualMethod   = "isEqualTo" . ucfirst($propertyName) . ":";
 
@@ -1158,7 +1386,7 @@ sub recursiveParse {
       $objectCategoriesSection .= createObjectCategoryForSubobject ($propertyName, 0);
 
       ######## AND RECURSE!! ########
-      recursiveParse ($propertyName, $propertyAttrDefsRef, $objectPath, $pathName, $NOT_PLURAL_ELEMENT, $hasPluralParent, $propertyDesc);
+      parseSubtree ($objectName, $propertyName, $propertyAttrDefsRef, $objectPath, $pathName, $NOT_PLURAL_ELEMENT, $hasPluralParent, $propertyDesc, ($propertyHash{"projected"} ? 1 : 0));
 
     ######## OTHER ########
     } else {
@@ -1290,9 +1518,116 @@ sub recursiveParse {
     #   exampleElement.baz =
     #       [dictionary objectForKey:@"baz"] != [NSNull null] ?
     #       [dictionary objectForKey:@"baz"] : nil;
-    $objFromDictSection[20]     .= "\n    " . $objectName . "." . $propertyName . " =\n";
-    $objFromDictSection[20]     .= "        [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
-    $objFromDictSection[20]     .= "        " . $frDictionary . " : nil;\n";
+    # Sub-objects and plurals of elements can instead be left as JSON until their getters are first called, e.g.:
+    #   if (lazily && [[dictionary objectForKey:@"foo"] isKindOfClass:[NSDictionary class]])
+    #       exampleElement->_fooJson = [dictionary objectForKey:@"foo"];
+    #   else
+    #       exampleElement.foo = ...
+    my $fromDictLines = "";
+    if ($frJson) {
+      if (!$hasLazyProperties) {
+        $objFromDictSection[19]  .= "\n    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];\n";
+        $hasLazyProperties = 1;
+      }
+
+      $fromDictLines  = "\n    if (lazily && [[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] isKindOfClass:[" .
+                        ($isObject ? "NSDictionary" : "NSArray") . " class]])\n";
+      $fromDictLines .= "        " . $objectName . "->_" . $propertyName . "Json = [dictionary objectForKey:\@\"" . $dictionaryKey . "\"];\n";
+      $fromDictLines .= "    else\n";
+      $fromDictLines .= "        " . $objectName . "." . $propertyName . " =\n";
+      $fromDictLines .= "            [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
+      $fromDictLines .= "            " . $frDictionary . " : nil;\n";
+    } else {
+      $fromDictLines  = "\n    " . $objectName . "." . $propertyName . " =\n";
+      $fromDictLines .= "        [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
+      $fromDictLines .= "        " . $frDictionary . " : nil;\n";
+    }
+    $objFromDictSection[20] .= $fromDictLines;
+
+    ##################################################################################################################
+    # The same, read straight from a JRJsonReader, is a case of the reader method's switch on the key's hash, e.g.:
+    #   if (!JRJsonKeyEquals(key, keyLength, "baz")) break;
+    #   value = [reader readValue];
+    #   exampleElement.baz = value != [NSNull null] ? value : nil;
+    #   continue;
+    # The sub-objects and plurals of plural elements are only collected while reading, into a dictionary, and made
+    # from it afterwards, as their paths depend on the element's id, which might not have been read yet
+    ##################################################################################################################
+    my $readerCase = "                if (!JRJsonKeyEquals(key, keyLength, \"" . $dictionaryKey . "\")) break;\n";
+    my $frValue    = $frDictionary;
+    $frValue       =~ s/\[dictionary objectForKey:\@"\Q$dictionaryKey\E"\]/value/g;
+    if ($isPluralElement && ($isObject || ($isArray && !$isStringArray))) {
+      $readerCase .= "                if ((value = [reader readValue]))\n";
+      $readerCase .= "                    [dictionary setObject:value forKey:\@\"" . $dictionaryKey . "\"];\n";
+
+      my $deferredLines = $fromDictLines;
+      $deferredLines =~ s/fromDecoder:fromDecoder/fromDecoder:NO/g;
+      $jsonReaderDeferred .= $deferredLines;
+    } elsif ($isObject) {
+      $readerCase .= "                if (!lazily)\n";
+      $readerCase .= "                    " . $objectName . "." . $propertyName . " = [JR" . ucfirst($propertyName) . " " . $propertyName .
+                     "ObjectFromJsonReader:reader withPath:" . $objectName . ".captureObjectPath];\n";
+      $readerCase .= "                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])\n";
+      $readerCase .= "                    " . $objectName . "->_" . $propertyName . "Json = value;\n";
+
+      $jsonReaderDefaults .= "    " . $objectName . "." . $propertyName . " = nil;\n";
+    } elsif ($isArray && !$isStringArray) {
+      $readerCase .= "                if (!lazily)\n";
+      $readerCase .= "                    " . $objectName . "." . $propertyName . " = [NSArray arrayOf" . ucfirst($propertyName) .
+                     "ElementsFromJsonReader:reader withPath:" . $objectName . ".captureObjectPath];\n";
+      $readerCase .= "                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])\n";
+      $readerCase .= "                    " . $objectName . "->_" . $propertyName . "Json = value;\n";
+    } else {
+      $readerCase .= "                value = [reader readValue];\n";
+      $readerCase .= "                " . $objectName . "." . $propertyName . " = value != [NSNull null] ? " . $frValue . " : nil;\n";
+
+      # Booleans and integers missing from the JSON are NO and 0, not nil, as they would be from a dictionary
+      if ($frDictionary =~ /^\[NSNumber numberWithBool:/) {
+        $jsonReaderDefaults .= "    " . $objectName . "." . $propertyName . " = [NSNumber numberWithBool:NO];\n";
+      } elsif ($frDictionary =~ /^\[NSNumber numberWithInteger:/) {
+        $jsonReaderDefaults .= "    " . $objectName . "." . $propertyName . " = [NSNumber numberWithInteger:0];\n";
+      }
+    }
+    $readerCase .= "                continue;\n";
+
+    push (@jsonReaderKeys, $dictionaryKey);
+    $jsonReaderCases{$dictionaryKey} = $readerCase;
+
+    ##################################################################################################################
+    # Archiving writes each property under its key, and reading the archive back is a switch like the JSON reader's:
+    #   [writer writeKey:@"baz"];
+    #   [writer writeValue:self.baz];
+    # Sub-objects and plurals write themselves, along with their own paths, so an element's can be read in place
+    ##################################################################################################################
+    my $archiveCase = "                if (!JRJsonKeyEquals(key, keyLength, \"" . $dictionaryKey . "\")) break;\n";
+    $archiveWriterLines .= "    [writer writeKey:\@\"" . $dictionaryKey . "\"];\n";
+    if ($isObject) {
+      $archiveWriterLines .= "    if (self." . $propertyName . ")\n";
+      $archiveWriterLines .= "        [self." . $propertyName . " writeToArchive:writer];\n";
+      $archiveWriterLines .= "    else\n        [writer writeNull];\n";
+
+      $archiveCase .= "                " . $objectName . "." . $propertyName . " = [JR" . ucfirst($propertyName) . " " . $propertyName .
+                      "ObjectFromArchive:reader];\n";
+    } elsif ($isArray && !$isStringArray) {
+      $archiveWriterLines .= "    if (self." . $propertyName . ")\n";
+      $archiveWriterLines .= "        [self." . $propertyName . " write" . ucfirst($propertyName) . "ElementsToArchive:writer];\n";
+      $archiveWriterLines .= "    else\n        [writer writeNull];\n";
+
+      $archiveCase .= "                " . $objectName . "." . $propertyName . " = [NSArray arrayOf" . ucfirst($propertyName) .
+                      "ElementsFromArchive:reader];\n";
+    } else {
+      if ($toDictionary eq "self." . $propertyName) {
+        $archiveWriterLines .= "    [writer writeValue:self." . $propertyName . "];\n";
+      } else {
+        $archiveWriterLines .= "    [writer writeValue:(self." . $propertyName . " ? " . $toDictionary . " : nil)];\n";
+      }
+
+      $archiveCase .= "                value = [reader readValue];\n";
+      $archiveCase .= "                " . $objectName . "." . $propertyName . " = value != [NSNull null] ? " . $frValue . " : nil;\n";
+    }
+    $archiveCase .= "                continue;\n";
+
+    $archiveReaderCases{$dictionaryKey} = $archiveCase;
 
     # e.g.:
     #   [dictionary setObject:(self.baz ? self.baz : [NSNull null])
@@ -1307,6 +1642,14 @@ sub recursiveParse {
     ### All pretty straightforward stuff here... ###
 
     $privateIvarsSection  .= "    " . $objectiveType . "_" . $propertyName . ";\n";
+
+    if ($frJson) {
+      $privateIvarsSection  .= "    " . ($isObject ? "NSDictionary *" : "NSArray *") . "_" . $propertyName . "Json;\n";
+    }
+
+    if ($frJson && $isObject) {
+      $privateIvarsSection  .= "    BOOL _" . $propertyName . "JsonCleared;\n";
+    }
     $synthesizeSection    .= "\@dynamic $propertyName;\n";
 
     if ($isReadOnly) {
@@ -1317,12 +1660,106 @@ sub recursiveParse {
       $propertiesSection    .= "\@property (nonatomic, copy)     $objectiveType$propertyName; $propertyNotes \n";
     }
 
-    $getterSettersSection .= createGetterSetterForProperty ($propertyName, $objectiveType, $isAlsoPrimitive, $isArray, $isObject);
+    # e.g.:
+    #   JRExampleObjectFooProperty
+    my $dirtyProperty = $className . ucfirst($propertyName) . "Property";
+
+    $getterSettersSection .= createGetterSetterForProperty ($propertyName, $objectiveType, $isAlsoPrimitive, $isArray, $isObject, $dirtyProperty, $frJson);
+
+    ##################################################################################################################
+    # In table mode, the property is a row of the object's attribute table instead, e.g.:
+    #   { @"baz", "baz", @"baz", @"NSString", JRCaptureAttributeTypeValue, JRCaptureAttributeRequired, 100,
+    #     JRExampleObjectBazProperty, NULL, nil },
+    # and only its primitive accessors and its line of the required properties' constructor are written out
+    ##################################################################################################################
+    my $attributeType;
+    my $attributeClass = "";
+    if ($isObject) {
+      $attributeType  = "JRCaptureAttributeTypeObject";
+      $attributeClass = "JR" . ucfirst($propertyName);
+    } elsif ($isStringArray) {
+      $attributeType  = "JRCaptureAttributeTypeStringPlural";
+    } elsif ($isArray) {
+      $attributeType  = "JRCaptureAttributeTypePlural";
+      $attributeClass = "JR" . ucfirst($propertyName) . "Element";
+    } else {
+      $attributeType  = getAttributeTypeForPropertyType($propertyType);
+    }
+
+    $attributeTableSection .= createAttributeTableEntry($dictionaryKey, $propertyName, stripPointer($objectiveType),
+                                                        $attributeType, getAttributeFlags(\%propertyConstraints, $isReadOnly),
+                                                        $propertyHash{"length"}, ($isArray ? "-1" : $dirtyProperty),
+                                                        $attributeClass, $stringArrayType);
+    $tableAccessorsSection .= createTablePrimitiveGetterSetterForProperty($propertyName, $isAlsoPrimitive);
+
+    if ($isRequired && $isReadOnly) {
+      $tableConstructorLines .= "\n        [self setValue:new" . ucfirst($propertyName) . " forKey:\@\"" . $propertyName . "\"];";
+    } elsif ($isRequired) {
+      $tableConstructorLines .= "\n        self." . $propertyName . " = new" . ucfirst($propertyName) . ";";
+    }
 
     if (!$isArray) {
       # e.g.,
       #   return [NSSet setWithObjects:@"foo", @"bar", @"baz", ... nil];
       $dirtyPropertySection[1] .= "\@\"" . $propertyName . "\", ";
+
+      ##################################################################################################################
+      # Every property that can be dirty gets the next bit in the object's dirty property words. The enum and the table
+      # of names must stay in the same order, as the names are looked up by the property's bit
+      ##################################################################################################################
+      $dirtyPropertyIndexSection .= "    " . $dirtyProperty . ",\n";
+      $dirtyPropertyNamesSection .= "    \"" . $propertyName . "\",\n";
+    }
+
+    if ($isObject) {
+      # e.g.:
+      #   if (_fooJson)
+      #       _fooJsonCleared = YES;
+      #   else
+      #       [self.foo deepClearDirtyProperties];
+      $deepClearDirtySection[3]    .= "\n\n    if (_" . $propertyName . "Json)";
+      $deepClearDirtySection[3]    .= "\n        _" . $propertyName . "JsonCleared = YES;";
+      $deepClearDirtySection[3]    .= "\n    else";
+      $deepClearDirtySection[3]    .= "\n        [self." . $propertyName . " deepClearDirtyProperties];";
+
+      # e.g.:
+      #   if (self.foo && ![self.foo isEqualByPrivateProperties:otherExampleObject.foo])
+      #       return NO;
+      $isEqualByPrivateSection[12] .=
+            "    if (self." . $propertyName . " && ![self." . $propertyName . " isEqualByPrivateProperties:other" . ucfirst($objectName) . "." . $propertyName . "])\n" .
+            "        return NO;\n\n";
+    }
+
+    ##################################################################################################################
+    # The constraints that can be checked without Capture, all but unique and locally-unique, are checked in
+    # validateIntoViolations:dirtyPropertiesOnly:, e.g.:
+    #   if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRExampleObjectBazProperty))
+    #       JRValidateCaptureAttribute(self.baz, @"baz", self.captureObjectPath, JRCaptureAttributeRequired, 100, violations);
+    # Sub-objects, and the elements of plurals, check their own
+    ##################################################################################################################
+    my %checkedConstraints = %propertyConstraints;
+    delete @checkedConstraints{"unique", "locally-unique"};
+    my $checkedFlags  = getAttributeFlags(\%checkedConstraints, 0);
+    my $checkedLength = $propertyHash{"length"} ? $propertyHash{"length"} : 0;
+
+    if ($isObject) {
+      # e.g.:
+      #   if (!dirtyPropertiesOnly || !_fooJson)
+      #       [self.foo validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+      $validateSection[2] .= "\n    if (!dirtyPropertiesOnly || !_" . $propertyName . "Json)\n" .
+                             "        [self." . $propertyName . " validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];\n";
+    } elsif ($isArray && !$isStringArray) {
+      # e.g.:
+      #   if (!dirtyPropertiesOnly)
+      #       for (JRCaptureObject *element in self.bar)
+      #           [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+      $validateSection[2] .= "\n    if (!dirtyPropertiesOnly)\n" .
+                             "        for (JRCaptureObject *element in self." . $propertyName . ")\n" .
+                             "            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];\n";
+    } elsif (!$isArray && !$isReadOnly && ($checkedFlags ne "0" || $checkedLength)) {
+      $validateSection[2] .= "\n    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . "))\n" .
+                             "        JRValidateCaptureAttribute(self." . $propertyName . ", \@\"" . $dictionaryKey . "\", self.captureObjectPath, " .
+                             $checkedFlags . ", " . $checkedLength . ", violations);\n";
     }
 
     if ($isObject) {
@@ -1341,12 +1778,12 @@ sub recursiveParse {
       #       self.foo = [JRFoo fooObjectFromDictionary:[dictionary objectForKey:@"foo"] withPath:self.captureObjectPath];
       #   else if ([dictionary objectForKey:@"foo"])
       #       [self.foo updateFromDictionary:[dictionary objectForKey:@"foo"] withPath:self.captureObjectPath];
-      $updateFromDictSection[9]   .= "\n    if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"] == [NSNull null])";
-      $updateFromDictSection[9]   .= "\n        self." . $propertyName . " = nil;";
-      $updateFromDictSection[9]   .= "\n    else if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"] && !self." . $propertyName . ")";
-      $updateFromDictSection[9]   .= "\n        self." . $propertyName . " = " . $frUpDictionary . ";";
-      $updateFromDictSection[9]   .= "\n    else if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"])";
-      $updateFromDictSection[9]   .= "\n        [self." . $propertyName . " updateFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath];\n";
+      $updateFromDictSection[11]   .= "\n    if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"] == [NSNull null])";
+      $updateFromDictSection[11]   .= "\n        self." . $propertyName . " = nil;";
+      $updateFromDictSection[11]   .= "\n    else if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"] && !self." . $propertyName . ")";
+      $updateFromDictSection[11]   .= "\n        self." . $propertyName . " = " . $frUpDictionary . ";";
+      $updateFromDictSection[11]   .= "\n    else if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"])";
+      $updateFromDictSection[11]   .= "\n        [self." . $propertyName . " updateFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath];\n";
 
       # e.g.:
       #   if (![dictionary objectForKey:@"foo"] || [dictionary objectForKey:@"foo"] == [NSNull null])
@@ -1355,12 +1792,12 @@ sub recursiveParse {
       #       self.foo = [JRFoo fooObjectFromDictionary:[dictionary objectForKey:@"foo"] withPath:self.captureObjectPath];
       #   else
       #       [self.foo replaceFromDictionary:[dictionary objectForKey:@"foo"] withPath:self.captureObjectPath];
-      $replaceFromDictSection[9] .= "\n    if (![dictionary objectForKey:\@\"" . $dictionaryKey . "\"] || [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] == [NSNull null])";
-      $replaceFromDictSection[9] .= "\n        self." . $propertyName . " = nil;";
-      $replaceFromDictSection[9] .= "\n    else if (!self." . $propertyName . ")";
-      $replaceFromDictSection[9] .= "\n        self." . $propertyName . " = " . $frRplDictionary . ";";
-      $replaceFromDictSection[9] .= "\n    else";
-      $replaceFromDictSection[9] .= "\n        [self." . $propertyName . " replaceFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath];\n";
+      $replaceFromDictSection[11] .= "\n    if (![dictionary objectForKey:\@\"" . $dictionaryKey . "\"] || [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] == [NSNull null])";
+      $replaceFromDictSection[11] .= "\n        self." . $propertyName . " = nil;";
+      $replaceFromDictSection[11] .= "\n    else if (!self." . $propertyName . ")";
+      $replaceFromDictSection[11] .= "\n        self." . $propertyName . " = " . $frRplDictionary . ";";
+      $replaceFromDictSection[11] .= "\n    else";
+      $replaceFromDictSection[11] .= "\n        [self." . $propertyName . " replaceFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath];\n";
 
 
       # e.g.:
@@ -1382,9 +1819,9 @@ sub recursiveParse {
         #   if ([dictionary objectForKey:@"bar"])
         #       self.name = [dictionary objectForKey:@"bar"] != [NSNull null] ?
         #           [dictionary objectForKey:@"bar"] : nil;
-        $updateFromDictSection[9]   .= "\n    if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"])";
-        $updateFromDictSection[9]   .= "\n        self." . $propertyName . " = [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
-        $updateFromDictSection[9]   .= "            " . $frUpDictionary . " : nil;\n";
+        $updateFromDictSection[11]   .= "\n    if ([dictionary objectForKey:\@\"" . $dictionaryKey . "\"])";
+        $updateFromDictSection[11]   .= "\n        self." . $propertyName . " = [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
+        $updateFromDictSection[11]   .= "            " . $frUpDictionary . " : nil;\n";
 
       }
       ############################################
@@ -1395,9 +1832,9 @@ sub recursiveParse {
       #   self.baz =
       #       [dictionary objectForKey:@"baz"] != [NSNull null] ?
       #       [dictionary objectForKey:@"baz"] : nil;
-      $replaceFromDictSection[9] .= "\n    self." . $propertyName . " =\n";
-      $replaceFromDictSection[9] .= "        [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
-      $replaceFromDictSection[9] .= "        " . $frRplDictionary . " : nil;\n";
+      $replaceFromDictSection[11] .= "\n    self." . $propertyName . " =\n";
+      $replaceFromDictSection[11] .= "        [dictionary objectForKey:\@\"" . $dictionaryKey . "\"] != [NSNull null] ? \n";
+      $replaceFromDictSection[11] .= "        " . $frRplDictionary . " : nil;\n";
 
     }
 
@@ -1415,7 +1852,7 @@ sub recursiveParse {
       ##################################################################################################################
 
         # e.g.:
-        #   if ([self.dirtyPropertySet containsObject:@"foo"])
+        #   if (JRIsDirtyProperty(self.dirtyPropertyWords, JRExampleObjectFooProperty))
         #       [dictionary setObject:(self.foo ?
         #                             [self.foo toUpdateDictionary] :
         #                             [[JRFoo foo] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -1423,7 +1860,7 @@ sub recursiveParse {
         #   else if ([self.foo needsUpdate])
         #       [dictionary setObject:[self.foo toUpdateDictionary]
         #                      forKey:@"foo"];
-        $toUpdateDictSection[3]  .= "\n    if ([self.dirtyPropertySet containsObject:\@\"" . $propertyName . "\"])\n";
+        $toUpdateDictSection[3]  .= "\n    if (JRIsDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . "))\n";
         $toUpdateDictSection[3]  .= "        [dictionary setObject:(self." . $propertyName . " ?\n" .
                                     "                              [self." . $propertyName . " toUpdateDictionary] :\n" .
                                     "                              [[JR" . ucfirst($propertyName) . " " . $propertyName . "] toUpdateDictionary]) /* Use the default constructor to create an empty object */\n" .
@@ -1442,6 +1879,38 @@ sub recursiveParse {
                                     "                          [[JR" . ucfirst($propertyName) . " " . $propertyName . "] toUpdateDictionary]) /* Use the default constructor to create an empty object */\n" .
                                     "                   forKey:\@\"" . $dictionaryKey . "\"];\n";
 
+        # e.g.:
+        #   if (JRIsDirtyProperty(self.dirtyPropertyWords, JRExampleObjectFooProperty))
+        #   {
+        #       [writer writeKey:@"foo"];
+        #       [(self.foo ? self.foo : [JRFoo foo]) writeUpdateJsonToWriter:writer];
+        #   }
+        #   else if ([self.foo needsUpdate])
+        #   {
+        #       [writer writeKey:@"foo"];
+        #       [self.foo writeUpdateJsonToWriter:writer];
+        #   }
+        $writeUpdateJsonSection[3]  .= "\n    if (JRIsDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . "))\n    {\n" .
+                                       "        [writer writeKey:\@\"" . $dictionaryKey . "\"];\n" .
+                                       "        [(self." . $propertyName . " ? self." . $propertyName . " : [JR" . ucfirst($propertyName) . " " . $propertyName . "]) writeUpdateJsonToWriter:writer];\n" .
+                                       "    }\n" .
+                                       "    else if ([self." . $propertyName . " needsUpdate])\n    {\n" .
+                                       "        [writer writeKey:\@\"" . $dictionaryKey . "\"];\n" .
+                                       "        [self." . $propertyName . " writeUpdateJsonToWriter:writer];\n" .
+                                       "    }\n";
+
+        # e.g.:
+        #   [writer writeKey:@"foo"];
+        #   if (self.foo)
+        #       [self.foo writeReplaceJsonToWriter:writer];
+        #   else
+        #       [[JRFoo foo] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+        $writeReplaceJsonSection[3] .= "\n    [writer writeKey:\@\"" . $dictionaryKey . "\"];\n" .
+                                       "    if (self." . $propertyName . ")\n" .
+                                       "        [self." . $propertyName . " writeReplaceJsonToWriter:writer];\n" .
+                                       "    else\n" .
+                                       "        [[JR" . ucfirst($propertyName) . " " . $propertyName . "] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */\n";
+
         # e.g.:
         #   if ([self.foo needsUpdate])
         #       return YES;
@@ -1502,6 +1971,18 @@ sub recursiveParse {
                                     "                          [NSArray array])\n" .
                                     "                   forKey:\@\"" . $dictionaryKey . "\"];\n";
 
+        # e.g.:
+        #   [writer writeKey:@"bar"];
+        #   [(self.bar ? self.bar : [NSArray array]) writeReplaceJsonOfBarElementsToWriter:writer];
+        #     OR, for an array of strings,
+        #   [writer writeValue:(self.bar ? self.bar : [NSArray array])];
+        $writeReplaceJsonSection[3] .= "\n    [writer writeKey:\@\"" . $dictionaryKey . "\"];\n";
+        if ($toRplWriter) {
+          $writeReplaceJsonSection[3] .= "    [(self." . $propertyName . " ? self." . $propertyName . " : [NSArray array]) " . $toRplWriter . "];\n";
+        } else {
+          $writeReplaceJsonSection[3] .= "    [writer writeValue:(self." . $propertyName . " ? self." . $propertyName . " : [NSArray array])];\n";
+        }
+
         ####################################################################################################
         # For arrays, they are considered equal in the following cases:
         #   a. They are both null
@@ -1551,15 +2032,37 @@ sub recursiveParse {
       } else { ### Not an object or array ###
 
         # e.g.:
-        #   if ([self.dirtyPropertySet containsObject:@"baz"])
+        #   if (JRIsDirtyProperty(self.dirtyPropertyWords, JRExampleObjectBazProperty))
         #       [dictionary setObject:self.baz forKey:@"baz"];
-        $toUpdateDictSection[3]  .= "\n    if ([self.dirtyPropertySet containsObject:\@\"" . $propertyName . "\"])\n";
+        $toUpdateDictSection[3]  .= "\n    if (JRIsDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . "))\n";
         $toUpdateDictSection[3]  .= "        [dictionary setObject:(self." . $propertyName . " ? " . $toUpDictionary . " : [NSNull null]) forKey:\@\"" . $dictionaryKey . "\"];\n";
 
         # e.g.:
         #   [dictionary setObject:(self.baz ? self.baz : [NSNull null]) forKey:@"baz"];
         $toReplaceDictSection[3] .= "    [dictionary setObject:(self." . $propertyName . " ? " . $toRplDictionary . " : [NSNull null]) forKey:\@\"" . $dictionaryKey . "\"];\n";
 
+        # e.g.:
+        #   if (JRIsDirtyProperty(self.dirtyPropertyWords, JRExampleObjectBazProperty))
+        #   {
+        #       [writer writeKey:@"baz"];
+        #       [writer writeValue:self.baz];
+        #   }
+        #
+        #   [writer writeKey:@"baz"];
+        #   [writer writeValue:self.baz];
+        my $upWriterValue  = $toUpDictionary eq "self.$propertyName" ?
+                             $toUpDictionary : "(self." . $propertyName . " ? " . $toUpDictionary . " : nil)";
+        my $rplWriterValue = $toRplDictionary eq "self.$propertyName" ?
+                             $toRplDictionary : "(self." . $propertyName . " ? " . $toRplDictionary . " : nil)";
+
+        $writeUpdateJsonSection[3]  .= "\n    if (JRIsDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . "))\n    {\n" .
+                                       "        [writer writeKey:\@\"" . $dictionaryKey . "\"];\n" .
+                                       "        [writer writeValue:" . $upWriterValue . "];\n" .
+                                       "    }\n";
+
+        $writeReplaceJsonSection[3] .= "\n    [writer writeKey:\@\"" . $dictionaryKey . "\"];\n" .
+                                       "    [writer writeValue:" . $rplWriterValue . "];\n";
+
         # e.g.:
         #   if ((self.foo == nil) ^ (otherExampleObject.foo == nil)) // xor
         #       return NO;
@@ -1637,6 +2140,16 @@ sub recursiveParse {
   for (my $i = 0; $i < @minClassConstructorDocSection; $i++) { $hFile .= $minClassConstructorDocSection[$i]; }
   $hFile .= "$minClassConstructorSection[0]$minClassConstructorSection[1];\n\n";
 
+  ##########################################################################
+  # Objects without sub-objects or arrays of objects have nothing to cast
+  # their counterpart for
+  ##########################################################################
+  if ($isEqualByPrivateSection[12] eq "") {
+    $isEqualByPrivateSection[5] = " class]]) return NO;\n\n";
+    $isEqualByPrivateSection[6] = $isEqualByPrivateSection[7] = $isEqualByPrivateSection[8] = "";
+    $isEqualByPrivateSection[9] = $isEqualByPrivateSection[10] = $isEqualByPrivateSection[11] = "";
+  }
+
   if ($requiredProperties) {
     for (my $i = 0; $i < @constructorDocSection; $i++) { $hFile .= $constructorDocSection[$i]; }
     $hFile .= "$constructorSection[0]$constructorSection[1];\n\n";
@@ -1697,6 +2210,36 @@ sub recursiveParse {
   $hFile .= "\@end\n";
 
 
+  ##########################################################################
+  # Generated from a projection file, the user tells JRCaptureApidInterface
+  # which attributes to ask Capture for, and the classes that left some out
+  # refuse to be replaced on Capture
+  ##########################################################################
+  my $projectionSection = "";
+
+  if ($objectName eq "captureUser" && @attributeProjection) {
+    $projectionSection = createAttributeProjectionMethod(@attributeProjection);
+  }
+
+  if ($isProjected) {
+    $projectionSection .= createPartialProjectionMethod();
+  }
+
+  if ($tableMode) {
+    $constructorSection[8] = $tableConstructorLines;
+
+    $mFiles{$className . ".m"} = createTableModeImplementation($objectName, $className, $pathAppend,
+                                   ($hasPluralParent || $objectName eq "captureUser" ? "" : $objectPath),
+                                   $isPluralElement, $hasPluralParent, $dirtyPropertyIndexSection,
+                                   $dirtyPropertyNamesSection, $attributeTableSection, $synthesizeSection,
+                                   $tableAccessorsSection, ($requiredProperties ? join("", @constructorSection) : ""),
+                                   join("", @minClassConstructorSection),
+                                   ($requiredProperties ? join("", @classConstructorSection) : ""),
+                                   $isEqualObjectSection[1], $replaceArrayImplSection, $projectionSection);
+    $hFiles{$className . ".h"} = $hFile;
+    return;
+  }
+
   ##########################################################################
   # Add Dlog
   ##########################################################################
@@ -1708,6 +2251,15 @@ sub recursiveParse {
   ##########################################################################
   $mFile .= "\n#import \"JRCaptureObject+Internal.h\"\n#import \"$className.h\"\n\n";
 
+  ##########################################################################
+  # Number the properties that can be dirty, and name them
+  ##########################################################################
+  $mFile .= "enum\n{\n" . $dirtyPropertyIndexSection . "    " . $className . "PropertyCount\n};\n\n";
+
+  if ($dirtyPropertyNamesSection ne "") {
+    $mFile .= "static const char *const " . $className . "PropertyNames[] =\n{\n" . $dirtyPropertyNamesSection . "};\n\n";
+  }
+
   ##########################################################################
   # Add any of the array categories, if needed to parse an array of objects
   ##########################################################################
@@ -1732,6 +2284,12 @@ sub recursiveParse {
   $mFile .= "{\n" . $privateIvarsSection . "}\n";
   #$mFile .= $synthesizeSection;
   $mFile .= "\@synthesize canBeUpdatedOnCapture;\n\n";
+
+  $mFile .= "+ (const char *const *)dirtyPropertyNames\n{\n";
+  $mFile .= "    return " . ($dirtyPropertyNamesSection ne "" ? $className . "PropertyNames" : "NULL") . ";\n}\n\n";
+  $mFile .= "+ (NSUInteger)dirtyPropertyCount\n{\n";
+  $mFile .= "    return " . $className . "PropertyCount;\n}\n\n";
+  $mFile .= $projectionSection;
   $mFile .= $getterSettersSection;
 
   ##########################################################################
@@ -1775,6 +2333,14 @@ sub recursiveParse {
     $mFile .= $objFromDictSection[$i];
   }
 
+  $mFile .= createFromJsonReaderImplementation($objectName, $className, $objFromDictSection[1], $isPluralElement,
+                                               join("", @objFromDictSection[11..18]), $jsonReaderDefaults,
+                                               $jsonReaderDeferred, $hasLazyProperties, \@jsonReaderKeys,
+                                               \%jsonReaderCases);
+
+  $mFile .= createArchiveImplementations($objectName, $className, $objFromDictSection[1], $archiveWriterLines,
+                                         \@jsonReaderKeys, \%archiveReaderCases);
+
   if ($objectName eq "captureUser") {
     for (my $i = 0; $i < @decodeUserFromDictSection; $i++) {
       $mFile .= $decodeUserFromDictSection[$i];
@@ -1801,12 +2367,26 @@ sub recursiveParse {
     $mFile .= $toReplaceDictSection[$i];
   }
 
+  for (my $i = 0; $i < @writeUpdateJsonSection; $i++) {
+    $mFile .= $writeUpdateJsonSection[$i];
+  }
+
+  for (my $i = 0; $i < @writeReplaceJsonSection; $i++) {
+    $mFile .= $writeReplaceJsonSection[$i];
+  }
+
   $mFile .= $replaceArrayImplSection;
 
   for (my $i = 0; $i < @needsUpdateSection; $i++) {
     $mFile .= $needsUpdateSection[$i];
   }
 
+  if ($validateSection[2]) {
+    for (my $i = 0; $i < @validateSection; $i++) {
+      $mFile .= $validateSection[$i];
+    }
+  }
+
   for (my $i = 0; $i < @isEqualObjectSection; $i++) {
     $mFile .= $isEqualObjectSection[$i];
   }
@@ -1815,6 +2395,14 @@ sub recursiveParse {
     $mFile .= $objectPropertiesSection[$i];
   }
 
+  for (my $i = 0; $i < @deepClearDirtySection; $i++) {
+    $mFile .= $deepClearDirtySection[$i];
+  }
+
+  for (my $i = 0; $i < @isEqualByPrivateSection; $i++) {
+    $mFile .= $isEqualByPrivateSection[$i];
+  }
+
   $mFile .= "\@end\n";
 
   ##########################################################################
@@ -1862,19 +2450,23 @@ for my $attrDef (@$attrDefsArrayRef) {
     delete $reservedAttrsToAdd{$name} if (exists $reservedAttrsToAdd{$name});
 }
 
-push @$attrDefsArrayRef, values %reservedAttrsToAdd;
+# In the order reserved_attributes.json lists them, so that the user's generated files come out the same every run
+push @$attrDefsArrayRef, grep { exists $reservedAttrsToAdd{$_->{'name'}} } @$reservedAttributes;
 
-##########################################################################
-# Then recursively parse it...
-##########################################################################
-recursiveParse ("captureUser", $attrDefsArrayRef, "", "", $NOT_PLURAL_ELEMENT, $NO_PLURAL_PARENT, "");
+if (%projection) {
+  my %usedPaths = ();
+  ($attrDefsArrayRef, $userIsProjected, @attributeProjection) = projectAttrDefs($attrDefsArrayRef, "", \%usedPaths);
+
+  foreach my $path (sort (keys (%projection))) {
+    print "[WARNING] '$path' in the projection file is not an attribute of the schema\n" unless ($usedPaths{$path});
+  }
+}
 
 ##########################################################################
-# Finally, print our .h/.m files
+# The sub-objects and plurals of the user are each generated from a
+# subtree of the schema that nothing else reads, so they can be generated
+# apart from the user, and from each other
 ##########################################################################
-my @hFileNames = keys (%hFiles);
-my @mFileNames = keys (%mFiles);
-
 my $pathToOutputDir = "";
 my $pathToDocsDir   = "";
 my $genDir          = "Generated";
@@ -1897,18 +2489,154 @@ unless (-d "$pathToOutputDir/$genDir") {
     mkdir "$pathToOutputDir/$genDir" or die "[ERROR] Unable to make the directory '$pathToOutputDir/$genDir'\n\n";
 }
 
-foreach my $fileName (@hFileNames) {
-  open (FILE, ">$pathToOutputDir/$genDir/$fileName") or die "[ERROR] Unable to open '$pathToOutputDir/$genDir/$fileName' for writing\n\n";
-  print "Writing $fileName... ";
-  print FILE $hFiles{$fileName};
-  print "Finished $fileName.\n";
+##########################################################################
+# The manifest remembers, for each subtree, a hash of everything its
+# files are generated from, and which files those are
+##########################################################################
+my $manifestPath     = "$pathToOutputDir/$genDir/.schema-manifest";
+my %previousManifest = ();
+
+if (open (my $manifest, "<", $manifestPath)) {
+  while (my $line = <$manifest>) {
+    chomp ($line);
+    my ($subtreeName, $subtreeHash, @subtreeFiles) = split (/ /, $line);
+    $previousManifest{$subtreeName} = { hash => $subtreeHash, files => [@subtreeFiles] };
+  }
+  close ($manifest);
+}
+
+my $generatorHash = md5_hex(join ("", map { openSchemaNamed($_) } ($0, "./ObjCMethodParts.pl")) . ($tableMode ? "t" : ""));
+my $canonicalJson = JSON->new->canonical->allow_nonref;
+
+my %newManifest   = ();
+my $filesWritten  = 0;
+my $filesKept     = 0;
+
+sub writeGeneratedFiles {
+  my @fileNames = (sort (keys (%hFiles)), sort (keys (%mFiles)));
+
+  foreach my $fileName (@fileNames) {
+    my $contents = exists($hFiles{$fileName}) ? $hFiles{$fileName} : $mFiles{$fileName};
+
+    if (writeFileIfChanged("$pathToOutputDir/$genDir/$fileName", $contents)) {
+      print "Wrote $fileName.\n";
+      $filesWritten++;
+    } else {
+      $filesKept++;
+    }
+  }
+
+  %hFiles = ();
+  %mFiles = ();
+
+  return @fileNames;
+}
+
+##########################################################################
+# Then recursively parse it...
+##########################################################################
+$deferSubtrees = 1;
+recursiveParse ("captureUser", $attrDefsArrayRef, "", "", $NOT_PLURAL_ELEMENT, $NO_PLURAL_PARENT, "", $userIsProjected);
+$deferSubtrees = 0;
+
+##########################################################################
+# ...print the user's .h/.m files...
+##########################################################################
+$newManifest{"captureUser"} = { hash => "-", files => [writeGeneratedFiles()] };
+
+##########################################################################
+# ...and then the subtrees that changed, a few at a time, in worker
+# processes that each report back the names of the files they generated
+##########################################################################
+my @pendingJobs = ();
+
+foreach my $job (@subtreeJobs) {
+  my $subtreeName = $job->{args}[0];
+  my $subtreeHash = md5_hex($generatorHash . $canonicalJson->encode([$job->{args}, [sort (keys (%{$job->{names}}))]]));
+  my $previous    = $previousManifest{$subtreeName};
+
+  if ($previous && $previous->{hash} eq $subtreeHash &&
+      !grep { !-e "$pathToOutputDir/$genDir/$_" } @{$previous->{files}}) {
+    $newManifest{$subtreeName} = $previous;
+    $filesKept += @{$previous->{files}};
+  } else {
+    $newManifest{$subtreeName} = { hash => $subtreeHash, files => [] };
+    push (@pendingJobs, $job);
+  }
+}
+
+sub runSubtreeJob {
+  my $job = $_[0];
+
+  %repeatNamesHash = %{$job->{names}};
+  recursiveParse(@{$job->{args}});
+
+  return writeGeneratedFiles();
+}
+
+if ($jobCount == 1) {
+  foreach my $job (@pendingJobs) {
+    $newManifest{$job->{args}[0]}{files} = [runSubtreeJob($job)];
+  }
+} else {
+  my @running = ();
+
+  while (@pendingJobs || @running) {
+    while (@pendingJobs && @running < $jobCount) {
+      my $job = shift (@pendingJobs);
+
+      pipe (my $reader, my $writer) or die "[ERROR] Unable to create a pipe\n\n";
+      my $pid = fork();
+      die "[ERROR] Unable to start a worker process\n\n" unless (defined $pid);
+
+      if ($pid == 0) {
+        close ($reader);
+        $filesWritten = 0;
+        my @fileNames = runSubtreeJob($job);
+        print $writer join (" ", $filesWritten, @fileNames) . "\n";
+        close ($writer);
+        exit (0);
+      }
+
+      close ($writer);
+      push (@running, { pid => $pid, reader => $reader, name => $job->{args}[0] });
+    }
+
+    my $worker = shift (@running);
+    my $reader = $worker->{reader};
+    my ($written, @fileNames) = split (/ /, join ("", <$reader>));
+    close ($reader);
+
+    waitpid ($worker->{pid}, 0);
+    die "[ERROR] Generating $worker->{name} failed\n\n" if ($? != 0 || !defined $written);
+
+    chomp (@fileNames);
+    $newManifest{$worker->{name}}{files} = [@fileNames];
+    $filesWritten += $written;
+    $filesKept    += @fileNames - $written;
+  }
+}
+
+##########################################################################
+# Remove what's left of subtrees that are gone from the schema, and save
+# the manifest for next time
+##########################################################################
+my %currentFiles = map { $_ => 1 } map { @{$_->{files}} } values (%newManifest);
+
+foreach my $previous (values (%previousManifest)) {
+  foreach my $fileName (@{$previous->{files}}) {
+    if (!$currentFiles{$fileName} && -e "$pathToOutputDir/$genDir/$fileName") {
+      unlink ("$pathToOutputDir/$genDir/$fileName");
+      print "Removed $fileName.\n";
+    }
+  }
 }
 
-foreach my $fileName (@mFileNames) {
-  open (FILE, ">$pathToOutputDir/$genDir/$fileName") or die "[ERROR] Unable to open '$pathToOutputDir/$genDir/$fileName' for writing\n\n";
-  print "Writing $fileName... ";
-  print FILE $mFiles{$fileName};
-  print "Finished $fileName.\n";
+open (my $manifest, ">", $manifestPath) or die "[ERROR] Unable to open '$manifestPath' for writing\n\n";
+foreach my $subtreeName (sort (keys (%newManifest))) {
+  print $manifest join (" ", $subtreeName, $newManifest{$subtreeName}{hash}, @{$newManifest{$subtreeName}{files}}) . "\n";
 }
+close ($manifest);
 
+print "\n$filesWritten files written, $filesKept unchanged.\n";
 print "\n[SUCCESS] Capture schema successfully parsed.\n\n";
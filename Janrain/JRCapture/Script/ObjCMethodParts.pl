@@ -62,7 +62,7 @@
 #
 #         <subobjectProperty> = [JR<subobjectClass> alloc] init];
 #
-#         [self.dirtyPropertySet setSet:[NSMutableSet setWithObjects:@"<objectProperty1>", @"<objectProperty2>, ... , nil]];
+#         [self setAllPropertiesToDirty];
 #     }
 #
 #     return self;
@@ -85,7 +85,7 @@ my @minConstructorParts = (
     {\n",
     "","
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }\n\n");
@@ -122,7 +122,7 @@ my @minConstructorParts = (
 #
 #         <subobjectProperty> = [JR<subobjectClass> alloc] init];
 #
-#         [self.dirtyPropertySet setSet:[NSMutableSet setWithObjects:@"<objectProperty1>", @"<objectProperty2>, ... , nil]];
+#         [self setAllPropertiesToDirty];
 #     }
 #
 #     return self;
@@ -151,7 +151,7 @@ my @constructorParts = (
     {\n",
     "","
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }\n\n");
@@ -510,9 +510,8 @@ my @toDictionaryParts = (
 #  **/
 # - (void)updateFromDictionary:(NSDictionary *)dictionary withPath:(NSString *)capturePath
 # {
-#     self.canBeUpdatedOnCapture = YES;
-#
-#     NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+#     JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(<className>PropertyCount)];
+#     memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 #
 #     self.canBeUpdatedOnCapture = YES;
 #     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%d", capturePath, @"<object>", [(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -525,7 +524,7 @@ my @toDictionaryParts = (
 #                                       [<propertyFromDictionaryMethod>:[dictionary objectForKey:@"<property>"]] : nil;
 #           ...
 #
-#     [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+#     memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 # }
 ###################################################################
 
@@ -560,12 +559,13 @@ my @updateFrDictDocParts = (
 my @updateFrDictParts = (
 "- (void)updateFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath",
 "\n{\n    DLog(@\"\%\@ \%\@\", capturePath, [dictionary description]);\n","
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(","","PropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;\n",
 "    self.captureObjectPath = [NSString stringWithFormat:\@\"\%\@/\%\@","","\", capturePath, ","","","];\n",
 "","
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }\n\n");
 
 
@@ -602,13 +602,17 @@ my @updateFrDictParts = (
 # {
 #     DLog(@"%@ %@", capturePath, [dictionary description]);
 #
+#     JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(<className>PropertyCount)];
+#     memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
+#
 #     self.<property> = [dictionary objectForKey:@"<property>"] != [NSNull null] ?
 #                                   [dictionary objectForKey:@"<property>"] : nil;
 #       OR
 #     self.<property> = [dictionary objectForKey:@"<property>"] != [NSNull null] ?
 #                                   [<propertyFromDictionaryMethod>:[dictionary objectForKey:@"<property>"]] : nil;
 #       ...
-#     [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+#
+#     memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 # }
 ###################################################################
 
@@ -644,12 +648,13 @@ my @replaceFrDictParts = (
 "- (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath",
 "\n{
     DLog(@\"\%\@ \%\@\", capturePath, [dictionary description]);\n","
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(","","PropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;\n",
 "    self.captureObjectPath = [NSString stringWithFormat:\@\"\%\@/\%\@","","\", capturePath, ","","","];\n",
 "","
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }\n\n");
 
 
@@ -664,24 +669,22 @@ my @dirtyPropertySnapshotParts = (
 {
     return [NSSet setWithObjects:","","nil];
 }\n\n",
-"- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];\n",
 "",
-"\n}\n\n",
+"",
+"",
 "- (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:\@\"","","\"];\n\n",
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:\@\"","","\"];\n\n",
 "",
 "    return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }\n\n",
 "- (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:\@\"","","\"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:\@\"","","\"] allObjects]];\n",
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:\@\"","","\"]];\n",
 "",
 "\n}\n\n");
 
@@ -694,7 +697,7 @@ my @dirtyPropertySnapshotParts = (
 #     NSMutableDictionary *dictionary =
 #          [NSMutableDictionary dictionaryWithCapacity:10];
 #
-#     if ([self.dirtyPropertySet containsObject:@"<property>"])
+#     if (JRIsDirtyProperty(self.dirtyPropertyWords, <className><Property>Property))
 #         [dictionary setObject:(self.<property> ? self.<property> : [NSNull null]) forKey:@"<property>"];
 #           OR
 #         [dictionary setObject:(self.<property> ? <propertyToUpdateDictionaryMethod> : [NSNull null]) forKey:@"<property>"];
@@ -799,6 +802,59 @@ my @toReplaceDictionaryParts = (
     return [NSDictionary dictionaryWithDictionary:dictionary];",
 "\n}\n\n");
 
+
+###################################################################
+# WRITE UPDATE/REPLACE JSON
+#
+# The same updates and replaces as toUpdateDictionary and
+# toReplaceDictionary, written straight into the request body
+#
+# - (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+# {
+#     [writer beginObject];
+#
+#     if (JRIsDirtyProperty(self.dirtyPropertyWords, <className><Property>Property))
+#     {
+#         [writer writeKey:@"<property>"];
+#         [writer writeValue:self.<property>];
+#     }
+#
+#     [writer endObject];
+#     [self.dirtyPropertySet removeAllObjects];
+# }
+#
+# - (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+# {
+#     [writer beginObject];
+#
+#     [writer writeKey:@"<property>"];
+#     [writer writeValue:self.<property>];
+#
+#     [writer endObject];
+#     [self.dirtyPropertySet removeAllObjects];
+# }
+###################################################################
+
+my @writeUpdateJsonParts = (
+"- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer",
+"\n{\n",
+"    [writer beginObject];\n",
+"",
+"
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];",
+"\n}\n\n");
+
+my @writeReplaceJsonParts = (
+"- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer",
+"\n{\n",
+"    [writer beginObject];\n",
+"",
+"
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];",
+"\n}\n\n");
+
 #my @replaceRemotelyParts = (
 #"- (void)replaceObjectOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate withContext:(NSObject *)context",
 #"\n{\n",
@@ -893,6 +949,85 @@ my @needsUpdateParts = (
 "\n}\n\n");
 
 
+###################################################################
+# RECURSIVELY CLEAR DIRTY PROPERTIES
+#
+# - (void)deepClearDirtyProperties
+# {
+#     [super deepClearDirtyProperties];
+#     [self.<objectProperty> deepClearDirtyProperties];
+#       ...
+# }
+###################################################################
+
+my @deepClearDirtyPropertiesParts = (
+"- (void)deepClearDirtyProperties",
+"\n{\n",
+"    [super deepClearDirtyProperties];",
+"",
+"\n}\n\n");
+
+
+###################################################################
+# CHECK THE OBJECT AGAINST ITS SCHEMA'S CONSTRAINTS
+#
+# - (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+# {
+#     if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, <dirtyProperty>))
+#         JRValidateCaptureAttribute(self.<property>, @"<key>", self.captureObjectPath, <flags>, <length>, violations);
+#       ...
+#     if (!dirtyPropertiesOnly || !_<objectProperty>Json)
+#         [self.<objectProperty> validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+#       ...
+#     if (!dirtyPropertiesOnly)
+#         for (JRCaptureObject *element in self.<arrayProperty>)
+#             [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+#       ...
+# }
+###################################################################
+
+my @validateParts = (
+"- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly",
+"\n{",
+"",
+"}\n\n");
+
+
+###################################################################
+# COMPARE OBJECTS BY PRIVATE PROPERTIES
+#
+# - (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+# {
+#     if (![super isEqualByPrivateProperties:otherObj]) return NO;
+#     if (![otherObj isKindOfClass:[<className> class]]) return NO;
+#
+#     <className> *other<objectName> = (<className> *)otherObj;
+#
+#     if (self.<objectProperty> && ![self.<objectProperty> isEqualByPrivateProperties:other<objectName>.<objectProperty>])
+#         return NO;
+#       ...
+#     if (self.<arrayProperty> && ![self.<arrayProperty> isEqualByPrivatePropertiesTo<ArrayProperty>Array:other<objectName>.<arrayProperty>])
+#         return NO;
+#       ...
+#
+#     return YES;
+# }
+###################################################################
+
+my @isEqualByPrivatePropertiesParts = (
+"- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj",
+"\n{\n",
+"    if (![super isEqualByPrivateProperties:otherObj]) return NO;\n",
+"    if (![otherObj isKindOfClass:[","",
+" class]]) return NO;\n\n    ","",
+" *other","",
+" = (","",
+" *)otherObj;\n\n",
+"",
+"    return YES;",
+"\n}\n\n");
+
+
 ###################################################################
 # MAKE DICTIONARY OF OBJECT'S PROPERTIES
 #
@@ -973,8 +1108,12 @@ sub createArrayCategoryForSubobject {
   my $methodName3 = "- (NSArray*)arrayOf" . ucfirst($propertyName) . "DictionariesFrom" . ucfirst($propertyName) . "ElementsForEncoder:(BOOL)forEncoder";
   my $methodName4 = "- (NSArray*)arrayOf" . ucfirst($propertyName) . "DictionariesFrom" . ucfirst($propertyName) . "Elements";
   my $methodName5 = "- (NSArray*)arrayOf" . ucfirst($propertyName) . "ReplaceDictionariesFrom" . ucfirst($propertyName) . "Elements";
+  my $methodName6 = "- (void)writeReplaceJsonOf" . ucfirst($propertyName) . "ElementsToWriter:(JRJsonFormWriter *)writer";
+  my $methodName7 = "+ (NSArray*)arrayOf" . ucfirst($propertyName) . "ElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath";
+  my $methodName8 = "- (void)write" . ucfirst($propertyName) . "ElementsToArchive:(JRCaptureArchiveWriter *)writer";
+  my $methodName9 = "+ (NSArray*)arrayOf" . ucfirst($propertyName) . "ElementsFromArchive:(JRCaptureArchiveReader *)reader";
 
-  $arrayCategoryIntf .= "$methodName1;\n$methodName2;\n$methodName3;\n$methodName4;\n$methodName5;\n\@end\n\n";
+  $arrayCategoryIntf .= "$methodName1;\n$methodName2;\n$methodName3;\n$methodName4;\n$methodName5;\n$methodName6;\n$methodName7;\n$methodName8;\n$methodName9;\n\@end\n\n";
 
   $arrayCategoryImpl .= "$methodName1\n{\n";
   $arrayCategoryImpl .=
@@ -1007,17 +1146,281 @@ sub createArrayCategoryForSubobject {
        "    for (NSObject *object in self)\n" .
        "        if ([object isKindOfClass:[JR" . ucfirst($propertyName) . "Element class]])\n" .
        "            [filteredDictionaryArray addObject:[(JR" . ucfirst($propertyName) . "Element*)object toReplaceDictionary]];\n\n" .
-       "    return filteredDictionaryArray;\n}\n\@end\n\n";
+       "    return filteredDictionaryArray;\n}\n\n";
+
+  $arrayCategoryImpl .= "$methodName6\n{\n";
+  $arrayCategoryImpl .=
+       "    [writer beginArray];\n" .
+       "    for (NSObject *object in self)\n" .
+       "        if ([object isKindOfClass:[JR" . ucfirst($propertyName) . "Element class]])\n" .
+       "            [(JR" . ucfirst($propertyName) . "Element*)object writeReplaceJsonToWriter:writer];\n" .
+       "    [writer endArray];\n}\n\n";
+
+  $arrayCategoryImpl .= "$methodName7\n{\n";
+  $arrayCategoryImpl .=
+       "    if (![reader beginArray])\n" .
+       "        return nil;\n\n" .
+       "    NSMutableArray *filtered" . ucfirst($propertyName) . "Array = [NSMutableArray array];\n" .
+       "    while ([reader nextElement])\n" .
+       "    {\n" .
+       "        JR" . ucfirst($propertyName) . "Element *element = [JR" . ucfirst($propertyName) . "Element " . $propertyName . "ElementFromJsonReader:reader withPath:capturePath];\n" .
+       "        if (element)\n" .
+       "            [filtered" . ucfirst($propertyName) . "Array addObject:element];\n" .
+       "    }\n\n" .
+       "    return filtered" . ucfirst($propertyName) . "Array;\n}\n\n";
+
+  $arrayCategoryImpl .= "$methodName8\n{\n";
+  $arrayCategoryImpl .=
+       "    [writer beginArray];\n" .
+       "    for (NSObject *object in self)\n" .
+       "        if ([object isKindOfClass:[JR" . ucfirst($propertyName) . "Element class]])\n" .
+       "            [(JR" . ucfirst($propertyName) . "Element*)object writeToArchive:writer];\n" .
+       "    [writer endArray];\n}\n\n";
+
+  $arrayCategoryImpl .= "$methodName9\n{\n";
+  $arrayCategoryImpl .=
+       "    if (![reader beginArray])\n" .
+       "        return nil;\n\n" .
+       "    NSMutableArray *filtered" . ucfirst($propertyName) . "Array = [NSMutableArray array];\n" .
+       "    while ([reader nextElement])\n" .
+       "    {\n" .
+       "        JR" . ucfirst($propertyName) . "Element *element = [JR" . ucfirst($propertyName) . "Element " . $propertyName . "ElementFromArchive:reader];\n" .
+       "        if (element)\n" .
+       "            [filtered" . ucfirst($propertyName) . "Array addObject:element];\n" .
+       "    }\n\n" .
+       "    return filtered" . ucfirst($propertyName) . "Array;\n}\n\@end\n\n";
 
   return $arrayCategoryImpl;#"$arrayCategoryIntf$arrayCategoryImpl";
 }
 
+##########################################################################
+# The reader's key hash; this must match JRJsonKeyHash in JRJsonReader.h
+##########################################################################
+sub getJsonKeyHash {
+  my $key  = $_[0];
+  my $seed = $_[1];
+
+  my $hash = 2166136261 ^ $seed;
+  foreach my $byte (unpack("C*", $key)) {
+    $hash ^= $byte;
+    $hash  = ($hash * 16777619) & 0xFFFFFFFF;
+  }
+
+  return $hash;
+}
+
+##########################################################################
+# Find a seed and a power-of-two table size for which every key hashes to
+# a slot of its own, so the reader's switch needs one comparison per key
+##########################################################################
+sub getPerfectJsonKeyHash {
+  my @keys = @{$_[0]};
+
+  my $size = 2;
+  $size *= 2 while ($size < 2 * @keys);
+
+  while (1) {
+    for (my $seed = 0; $seed < 4096; $seed++) {
+      my %slots;
+      my $collides = 0;
+
+      foreach my $key (@keys) {
+        my $slot = getJsonKeyHash($key, $seed) & ($size - 1);
+        if (exists $slots{$slot}) { $collides = 1; last; }
+        $slots{$slot} = $key;
+      }
+
+      return ($seed, $size - 1, \%slots) unless $collides;
+    }
+
+    $size *= 2;
+  }
+}
+
+##########################################################################
+# + (id)exampleObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+# {
+#     if (![reader beginObject])
+#         return nil;
+#
+#     JRExampleObject *exampleObject = [JRExampleObject exampleObject];
+#     ...
+#     while ((key = [reader nextKey:&keyLength]))
+#     {
+#         switch (JRJsonKeyHash(key, keyLength, 12) & 15)
+#         {
+#             case 3:
+#                 if (!JRJsonKeyEquals(key, keyLength, "foo")) break;
+#                 ...
+#                 continue;
+#         }
+#
+#         [reader skipValue];
+#     }
+#
+#     [exampleObject.dirtyPropertySet removeAllObjects];
+#
+#     return exampleObject;
+# }
+##########################################################################
+sub createFromJsonReaderImplementation {
+  my $objectName        = $_[0];
+  my $className         = $_[1];
+  my $methodPrefix      = $_[2];
+  my $isPluralElement   = $_[3];
+  my $pathSection       = $_[4];
+  my $defaults          = $_[5];
+  my $deferred          = $_[6];
+  my $hasLazyProperties = $_[7];
+  my @keys              = @{$_[8]};
+  my %cases             = %{$_[9]};
+
+  # The path is set the way ...FromDictionary: sets it, reindented; an element's depends on its id, so it is read too
+  my $pathSetup = $pathSection;
+  $pathSetup =~ s/\n        /\n    /g;
+  $pathSetup = "    " . $pathSetup . "\n" if ($pathSetup);
+
+  if ($isPluralElement) {
+    $pathSetup =~ s/\(long\)\[\(NSNumber\*\)\[dictionary objectForKey:\@"id"\] integerValue\]/(long)elementId/;
+
+    my $readId = "                elementId = [value respondsToSelector:\@selector(integerValue)] ? [value integerValue] : 0;\n";
+    if ($cases{"id"}) {
+      $cases{"id"} =~ s/(value = \[reader readValue\];\n)/$1$readId/;
+    } else {
+      push (@keys, "id");
+      $cases{"id"} = "                if (!JRJsonKeyEquals(key, keyLength, \"id\")) break;\n" .
+                     "                value = [reader readValue];\n" . $readId .
+                     "                continue;\n";
+    }
+  }
+
+  my $usesValue = grep { /value/ } values %cases;
+
+  my $method = "+ (id)" . $methodPrefix . "FromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath\n{\n";
+  $method .= "    if (![reader beginObject])\n        return nil;\n\n";
+  $method .= "    " . $className . " *" . $objectName . " = [" . $className . " " . $objectName . "];\n";
+  $method .= "    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];\n" if ($deferred);
+  $method .= "    NSInteger elementId = 0;\n" if ($isPluralElement);
+  $method .= "    BOOL lazily = [JRCaptureObject materializesLazily];\n" if ($hasLazyProperties);
+  $method .= "    const char *key;\n    size_t keyLength;\n";
+  $method .= "    id value;\n" if ($usesValue);
+  $method .= "\n" . $pathSetup if ($pathSetup && !$isPluralElement);
+  $method .= "\n" . $defaults if ($defaults);
+  $method .= "\n    while ((key = [reader nextKey:&keyLength]))\n    {\n";
+
+  if (@keys) {
+    my ($seed, $mask, $slotsRef) = getPerfectJsonKeyHash(\@keys);
+    my %slots = %{$slotsRef};
+
+    $method .= "        switch (JRJsonKeyHash(key, keyLength, " . $seed . ") & " . $mask . ")\n        {\n";
+    foreach my $slot (sort { $a <=> $b } keys %slots) {
+      $method .= "            case " . $slot . ":\n" . $cases{$slots{$slot}};
+    }
+    $method .= "        }\n\n";
+  }
+
+  $method .= "        [reader skipValue];\n    }\n";
+  $method .= "\n" . $pathSetup if ($pathSetup && $isPluralElement);
+  $method .= $deferred;
+  $method .= "\n    [" . $objectName . ".dirtyPropertySet removeAllObjects];\n\n";
+  $method .= "    return " . $objectName . ";\n}\n\n";
+
+  return $method;
+}
+
+##########################################################################
+# - (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+# {
+#     [writer beginObject];
+#     [writer writeNameSet:self.dirtyPropertySet];
+#     [writer writeString:self.captureObjectPath];
+#     [writer writeBool:self.canBeUpdatedOnCapture];
+#
+#     [writer writeKey:@"foo"];
+#     [writer writeValue:self.foo];
+#     ...
+#     [writer endObject];
+# }
+#
+# + (id)exampleObjectFromArchive:(JRCaptureArchiveReader *)reader
+# {
+#     if (![reader beginObject])
+#         return nil;
+#
+#     JRExampleObject *exampleObject = [JRExampleObject exampleObject];
+#     NSSet *dirtyPropertySetCopy = [reader readNameSet];
+#     exampleObject.captureObjectPath = [reader readString];
+#     exampleObject.canBeUpdatedOnCapture = [reader readBool];
+#     ...
+#     while ((key = [reader nextKey:&keyLength]))
+#     {
+#         switch (JRJsonKeyHash(key, keyLength, 12) & 15)
+#         {
+#             ...
+#         }
+#
+#         [reader skipValue];
+#     }
+#
+#     [exampleObject.dirtyPropertySet setSet:dirtyPropertySetCopy];
+#
+#     return exampleObject;
+# }
+##########################################################################
+sub createArchiveImplementations {
+  my $objectName   = $_[0];
+  my $className    = $_[1];
+  my $methodPrefix = $_[2];
+  my $writerLines  = $_[3];
+  my @keys         = @{$_[4]};
+  my %cases        = %{$_[5]};
+
+  my $method = "- (void)writeToArchive:(JRCaptureArchiveWriter *)writer\n{\n";
+  $method .= "    [writer beginObject];\n";
+  $method .= "    [writer writeNameSet:self.dirtyPropertySet];\n";
+  $method .= "    [writer writeString:self.captureObjectPath];\n";
+  $method .= "    [writer writeBool:self.canBeUpdatedOnCapture];\n";
+  $method .= "\n" . $writerLines if ($writerLines);
+  $method .= "    [writer endObject];\n}\n\n";
+
+  my $usesValue = grep { /value/ } values %cases;
+
+  $method .= "+ (id)" . $methodPrefix . "FromArchive:(JRCaptureArchiveReader *)reader\n{\n";
+  $method .= "    if (![reader beginObject])\n        return nil;\n\n";
+  $method .= "    " . $className . " *" . $objectName . " = [" . $className . " " . $objectName . "];\n";
+  $method .= "    NSSet *dirtyPropertySetCopy = [reader readNameSet];\n";
+  $method .= "    " . $objectName . ".captureObjectPath = [reader readString];\n";
+  $method .= "    " . $objectName . ".canBeUpdatedOnCapture = [reader readBool];\n";
+  $method .= "    const char *key;\n    size_t keyLength;\n";
+  $method .= "    id value;\n" if ($usesValue);
+  $method .= "\n    while ((key = [reader nextKey:&keyLength]))\n    {\n";
+
+  if (@keys) {
+    my ($seed, $mask, $slotsRef) = getPerfectJsonKeyHash(\@keys);
+    my %slots = %{$slotsRef};
+
+    $method .= "        switch (JRJsonKeyHash(key, keyLength, " . $seed . ") & " . $mask . ")\n        {\n";
+    foreach my $slot (sort { $a <=> $b } keys %slots) {
+      $method .= "            case " . $slot . ":\n" . $cases{$slots{$slot}};
+    }
+    $method .= "        }\n\n";
+  }
+
+  $method .= "        [reader skipValue];\n    }\n";
+  $method .= "\n    [" . $objectName . ".dirtyPropertySet setSet:dirtyPropertySetCopy];\n\n";
+  $method .= "    return " . $objectName . ";\n}\n\n";
+
+  return $method;
+}
+
 sub createObjectCategoryForSubobject {
   my $propertyName   = $_[0];
   my $isArrayElement = $_[1];
 
   my $objectCategoryIntf = "\@interface JR" . ucfirst($propertyName) . " (JR" . ucfirst($propertyName) . "_InternalMethods)\n" .
                            "+ (id)" . $propertyName . ($isArrayElement ? "" : "Object") . "FromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;\n" .
+                           "+ (id)" . $propertyName . ($isArrayElement ? "" : "Object") . "FromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;\n" .
+                           "+ (id)" . $propertyName . ($isArrayElement ? "" : "Object") . "FromArchive:(JRCaptureArchiveReader *)reader;\n" .
                            "- (BOOL)isEqualTo" . ucfirst($propertyName) . ":(JR" . ucfirst($propertyName) . " *)other" . ucfirst($propertyName) . ";\n" .
                            "\@end\n\n";
 
@@ -1042,6 +1445,24 @@ sub getArrayComparisonImplementation {
   "    return YES;\n}\n";
 }
 
+sub getArrayPrivateComparisonDeclaration {
+  my $propertyName = $_[0];
+
+  return "- (BOOL)isEqualByPrivatePropertiesTo" . ucfirst($propertyName) . "Array:(NSArray *)otherArray;\n";
+}
+
+sub getArrayPrivateComparisonImplementation {
+  my $propertyName = $_[0];
+
+  return "\n" .
+  "- (BOOL)isEqualByPrivatePropertiesTo" . ucfirst($propertyName) . "Array:(NSArray *)otherArray\n{\n" .
+  "    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;\n\n" .
+  "    for (NSUInteger i = 0; i < [self count]; i++)\n" .
+  "        if (![((JR" . ucfirst($propertyName) . "Element *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])\n" .
+  "            return NO;\n\n" .
+  "    return YES;\n}\n";
+}
+
 sub createArrayReplaceMethodDeclaration {
   my $propertyName = $_[0];
   my $className    = $_[1];
@@ -1117,6 +1538,8 @@ sub createGetterSetterForProperty {
   my $isBoolOrInt   = $_[2];
   my $isArray       = $_[3];
   my $isObject      = $_[4];
+  my $dirtyProperty = $_[5];
+  my $fromJson      = $_[6];
   my $getter;
   my $setter;
   my $primitiveGetter = "";
@@ -1125,17 +1548,52 @@ sub createGetterSetterForProperty {
   $getter = "- (" . $propertyType . ")" . $propertyName;
 
   $getter .= "\n{\n";
+
+  ##########################################################################
+  # Lazily loaded sub-objects and plurals keep their JSON until the getter
+  # is first called, and are then built just as the eager load would have
+  # built them, e.g.:
+  #   if (_fooJson)
+  #   {
+  #       NSDictionary *json = _fooJson;
+  #       _fooJson = nil;
+  #       _foo = [JRFoo fooObjectFromDictionary:json withPath:...];
+  #       ...
+  #   }
+  ##########################################################################
+  if ($fromJson) {
+    $getter .= "    if (_" . $propertyName . "Json)\n";
+    $getter .= "    {\n";
+    $getter .= "        " . ($isObject ? "NSDictionary *" : "NSArray *") . "json = _" . $propertyName . "Json;\n";
+    $getter .= "        _" . $propertyName . "Json = nil;\n";
+    $getter .= "        _" . $propertyName . " = " . $fromJson . ";\n";
+
+    if ($isObject) {
+      $getter .= "\n";
+      $getter .= "        if (_" . $propertyName . "JsonCleared)\n";
+      $getter .= "            [_" . $propertyName . " deepClearDirtyProperties];\n";
+      $getter .= "        else\n";
+      $getter .= "            [_" . $propertyName . " setAllPropertiesToDirty];\n";
+    }
+
+    $getter .= "    }\n\n";
+  }
+
   $getter .= "    return _" . $propertyName . ";";
   $getter .= "\n}\n\n";
 
   $setter .= "- (void)set". ucfirst($propertyName) . ":(" . $propertyType . ")new" . ucfirst($propertyName);
   $setter .= "\n{\n";
 
+  if ($fromJson) {
+    $setter .= "    _" . $propertyName . "Json = nil;\n\n";
+  }
+
 #  if ($isArray) {
 #    $setter .= "    [self.dirtyArraySet addObject:@\"" . $propertyName . "\"];\n\n";
 #  } else {
   if (!$isArray) {
-    $setter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n\n";
+    $setter .= "    JRSetDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . ");\n\n";
   }
 
   if ($isObject) {
@@ -1156,7 +1614,7 @@ sub createGetterSetterForProperty {
 
     $primitiveSetter .= "- (void)set" . ucfirst($propertyName) . "WithBool:(BOOL)boolVal";
     $primitiveSetter .= "\n{\n";
-    $primitiveSetter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n\n";
+    $primitiveSetter .= "    JRSetDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . ");\n\n";
 
     $primitiveSetter .= "    _" . $propertyName .  " = [NSNumber numberWithBool:boolVal];";
     $primitiveSetter .= "\n}\n\n";
@@ -1170,7 +1628,7 @@ sub createGetterSetterForProperty {
 
     $primitiveSetter .= "- (void)set" . ucfirst($propertyName) . "WithInteger:(NSInteger)integerVal";
     $primitiveSetter .= "\n{\n";
-    $primitiveSetter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n\n";
+    $primitiveSetter .= "    JRSetDirtyProperty(self.dirtyPropertyWords, " . $dirtyProperty . ");\n\n";
 
     $primitiveSetter .= "    _" . $propertyName .  " = [NSNumber numberWithInteger:integerVal];";
     $primitiveSetter .= "\n}\n\n";
@@ -1207,6 +1665,209 @@ sub createGetterSetterForProperty {
 #   return $getter . $setter;
 # }
 
+###################################################################
+# TABLE MODE
+#
+# In table mode (CaptureSchemaParser.pl -t) a class's .m describes
+# the class's properties in a static JRCaptureSchema, e.g.:
+#
+# static const JRCaptureAttribute JRExampleObjectAttributes[] =
+# {
+#     { @"baz", "baz", @"baz", @"NSString", JRCaptureAttributeTypeValue, 0, 100, JRExampleObjectBazProperty, NULL, nil },
+#       ...
+# };
+#
+# static const JRCaptureSchema JRExampleObjectSchema =
+# {
+#     @"exampleObject", @"exampleObject", @"/exampleObject", NO, NO,
+#     sizeof(JRExampleObjectAttributes) / sizeof(JRExampleObjectAttributes[0]), JRExampleObjectAttributes
+# };
+#
+# and leaves its properties @dynamic, and the methods that work
+# through them to JRCaptureObject
+###################################################################
+
+sub getAttributeTypeForPropertyType {
+  my $propertyType = $_[0];
+
+  if ($propertyType eq "boolean") {
+    return "JRCaptureAttributeTypeBoolean";
+  } elsif ($propertyType eq "integer" || $propertyType eq "id") {
+    return "JRCaptureAttributeTypeInteger";
+  } elsif ($propertyType eq "date") {
+    return "JRCaptureAttributeTypeDate";
+  } elsif ($propertyType eq "dateTime") {
+    return "JRCaptureAttributeTypeDateTime";
+  }
+
+  return "JRCaptureAttributeTypeValue";
+}
+
+sub getAttributeFlags {
+  my %constraints = %{$_[0]};
+  my $isReadOnly  = $_[1];
+  my @flags;
+
+  my @constraintFlags = ("required",         "JRCaptureAttributeRequired",
+                         "unique",           "JRCaptureAttributeUnique",
+                         "locally-unique",   "JRCaptureAttributeLocallyUnique",
+                         "alphabetic",       "JRCaptureAttributeAlphabetic",
+                         "alphanumeric",     "JRCaptureAttributeAlphanumeric",
+                         "unicode-letters",  "JRCaptureAttributeUnicodeLetters",
+                         "unicode-printable","JRCaptureAttributeUnicodePrintable",
+                         "email-address",    "JRCaptureAttributeEmailAddress");
+
+  for (my $i = 0; $i < @constraintFlags; $i += 2) {
+    push (@flags, $constraintFlags[$i + 1]) if (exists($constraints{$constraintFlags[$i]}));
+  }
+
+  push (@flags, "JRCaptureAttributeReadOnly") if ($isReadOnly);
+
+  return @flags ? join(" | ", @flags) : "0";
+}
+
+sub createAttributeTableEntry {
+  my $dictionaryKey = $_[0];
+  my $propertyName  = $_[1];
+  my $typeName      = $_[2];
+  my $attributeType = $_[3];
+  my $flags         = $_[4];
+  my $length        = $_[5];
+  my $dirtyProperty = $_[6];
+  my $className     = $_[7];
+  my $elementType   = $_[8];
+
+  return "    { \@\"" . $dictionaryKey . "\", \"" . $dictionaryKey . "\", \@\"" . $propertyName . "\", \@\"" . $typeName . "\",\n" .
+         "      " . $attributeType . ", " . $flags . ", " . ($length ? $length : 0) . ", " . $dirtyProperty . ", " .
+         ($className ? "\"" . $className . "\"" : "NULL") . ", " . ($elementType ? "\@\"" . $elementType . "\"" : "nil") . " },\n";
+}
+
+sub createTablePrimitiveGetterSetterForProperty {
+  my $propertyName = $_[0];
+  my $isBoolOrInt  = $_[1];
+
+  if ($isBoolOrInt eq "b") {
+    return "- (BOOL)get" . ucfirst($propertyName) . "BoolValue\n{\n" .
+           "    return [self." . $propertyName . " boolValue];\n}\n\n" .
+           "- (void)set" . ucfirst($propertyName) . "WithBool:(BOOL)boolVal\n{\n" .
+           "    self." . $propertyName . " = [NSNumber numberWithBool:boolVal];\n}\n\n";
+  } elsif ($isBoolOrInt eq "i") {
+    return "- (NSInteger)get" . ucfirst($propertyName) . "IntegerValue\n{\n" .
+           "    return [self." . $propertyName . " integerValue];\n}\n\n" .
+           "- (void)set" . ucfirst($propertyName) . "WithInteger:(NSInteger)integerVal\n{\n" .
+           "    self." . $propertyName . " = [NSNumber numberWithInteger:integerVal];\n}\n\n";
+  }
+
+  return "";
+}
+
+###################################################################
+# THE ATTRIBUTES A PROJECTED USER IS READ WITH
+#
+# + (NSArray *)attributeProjection
+# {
+#     return @[
+#             @"<path>",
+#               ...
+#     ];
+# }
+###################################################################
+sub createAttributeProjectionMethod {
+  my @paths = @_;
+
+  return "+ (NSArray *)attributeProjection\n{\n    return \@[\n" .
+         join ("", map { "            \@\"" . $_ . "\",\n" } @paths) .
+         "    ];\n}\n\n";
+}
+
+sub createPartialProjectionMethod {
+  return "+ (BOOL)isPartialProjection\n{\n    return YES;\n}\n\n";
+}
+
+sub createTableModeImplementation {
+  my $objectName          = $_[0];
+  my $className           = $_[1];
+  my $pathAppend          = $_[2];
+  my $objectPath          = $_[3];
+  my $isPluralElement     = $_[4];
+  my $hasPluralParent     = $_[5];
+  my $dirtyIndexSection   = $_[6];
+  my $dirtyNamesSection   = $_[7];
+  my $attributeTable      = $_[8];
+  my $dynamicSection      = $_[9];
+  my $accessorsSection    = $_[10];
+  my $constructor         = $_[11];
+  my $minClassConstructor = $_[12];
+  my $classConstructor    = $_[13];
+  my $isEqualSignature    = $_[14];
+  my $replaceArrays       = $_[15];
+  my $projection          = $_[16];
+
+  my $mFile = getCopyrightHeader();
+
+  $mFile .= "#ifdef DEBUG\n#define DLog(fmt, ...) NSLog((\@\"\%s [Line \%d] \" fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)\n";
+  $mFile .= "#else\n#define DLog(...)\n#endif\n\n#define ALog(fmt, ...) NSLog((\@\"\%s [Line \%d] \" fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)\n\n";
+  $mFile .= "\n#import \"JRCaptureObject+Internal.h\"\n#import \"$className.h\"\n\n";
+
+  $mFile .= "enum\n{\n" . $dirtyIndexSection . "    " . $className . "PropertyCount\n};\n\n";
+
+  if ($dirtyNamesSection ne "") {
+    $mFile .= "static const char *const " . $className . "PropertyNames[] =\n{\n" . $dirtyNamesSection . "};\n\n";
+  }
+
+  if ($attributeTable ne "") {
+    $mFile .= "static const JRCaptureAttribute " . $className . "Attributes[] =\n{\n" . $attributeTable . "};\n\n";
+  }
+
+  $mFile .= "static const JRCaptureSchema " . $className . "Schema =\n{\n";
+  $mFile .= "    \@\"" . $objectName . "\", \@\"" . $pathAppend . "\", \@\"" . $objectPath . "\", " .
+            ($isPluralElement ? "YES" : "NO") . ", " . ($hasPluralParent ? "YES" : "NO") . ",\n";
+  if ($attributeTable ne "") {
+    $mFile .= "    sizeof(" . $className . "Attributes) / sizeof(" . $className . "Attributes[0]), " . $className . "Attributes\n";
+  } else {
+    $mFile .= "    0, NULL\n";
+  }
+  $mFile .= "};\n\n";
+
+  $mFile .= "\@interface $className ()\n";
+  $mFile .= "\@property BOOL canBeUpdatedOnCapture;\n";
+  $mFile .= "\@end\n\n";
+  $mFile .= "\@implementation $className\n";
+  $mFile .= $dynamicSection;
+  $mFile .= "\@synthesize canBeUpdatedOnCapture;\n\n";
+
+  $mFile .= "+ (const JRCaptureSchema *)captureSchema\n{\n";
+  $mFile .= "    return &" . $className . "Schema;\n}\n\n";
+  $mFile .= "+ (const char *const *)dirtyPropertyNames\n{\n";
+  $mFile .= "    return " . ($dirtyNamesSection ne "" ? $className . "PropertyNames" : "NULL") . ";\n}\n\n";
+  $mFile .= "+ (NSUInteger)dirtyPropertyCount\n{\n";
+  $mFile .= "    return " . $className . "PropertyCount;\n}\n\n";
+  $mFile .= $projection;
+  $mFile .= $accessorsSection;
+
+  $mFile .= $constructor . $minClassConstructor . $classConstructor;
+
+  if ($objectName eq "captureUser") {
+    $mFile .= "+ (id)captureUserObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath\n{\n";
+    $mFile .= "    return [self captureObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];\n}\n\n";
+    $mFile .= "+ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath\n{\n";
+    $mFile .= "    return [self captureObjectFromJsonReader:reader withPath:capturePath];\n}\n\n";
+    $mFile .= "+ (id)captureUserObjectFromArchive:(JRCaptureArchiveReader *)reader\n{\n";
+    $mFile .= "    return [self captureObjectFromArchive:reader];\n}\n\n";
+    $mFile .= "- (void)decodeFromDictionary:(NSDictionary*)dictionary\n{\n";
+    $mFile .= "    [self decodeAttributesFromDictionary:dictionary];\n}\n\n";
+  }
+
+  $mFile .= $replaceArrays;
+
+  $mFile .= "- (BOOL)isEqualTo" . $isEqualSignature . "\n{\n";
+  $mFile .= "    return [self isEqualToCaptureObject:other" . ucfirst($objectName) . "];\n}\n\n";
+
+  $mFile .= "\@end\n";
+
+  return $mFile;
+}
+
 sub getMinConstructorParts {
   return @minConstructorParts;
 }
@@ -1263,6 +1924,14 @@ sub getToReplaceDictParts {
   return @toReplaceDictionaryParts;
 }
 
+sub getWriteUpdateJsonParts {
+  return @writeUpdateJsonParts;
+}
+
+sub getWriteReplaceJsonParts {
+  return @writeReplaceJsonParts;
+}
+
 #sub getReplaceRemotelyParts {
 #  return @replaceRemotelyParts;
 #}
@@ -1287,6 +1956,18 @@ sub getObjectPropertiesParts {
   return @objectPropertiesParts;
 }
 
+sub getDeepClearDirtyPropertiesParts {
+  return @deepClearDirtyPropertiesParts;
+}
+
+sub getIsEqualByPrivatePropertiesParts {
+  return @isEqualByPrivatePropertiesParts;
+}
+
+sub getValidateParts {
+  return @validateParts;
+}
+
 sub getCopyrightHeader {
   return $copyrightHeader;
 }
@@ -0,0 +1,15 @@
+# Generating twice in a row into the same directory must leave every file alone the second time, or Xcode recompiles
+# generated classes that didn't change
+for schema in simple_capture_demo_schema.json ../../../Test/JUMPTests/test_user1.json; do
+  for mode in "" "-t"; do
+    out=$(mktemp -d)
+    ./CaptureSchemaParser.pl $mode -f $schema -o $out/ > /dev/null || exit 1
+    summary=$(./CaptureSchemaParser.pl $mode -f $schema -o $out/ | grep "files written")
+    rm -rf $out
+    case "$summary" in
+      "0 files written,"*) ;;
+      *) echo "[ERROR] $schema $mode: the second run wrote files: $summary"; exit 1 ;;
+    esac
+  done
+done
+echo "Generated files are stable."
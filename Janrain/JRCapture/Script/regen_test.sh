@@ -1 +1,2 @@
 ./CaptureSchemaParser.pl -f ../../../Test/JUMPTests/test_user1.json -o ../../../Test/JUMPTests/JRCapture/
+./CaptureSchemaParser.pl -t -f ../../../Test/JUMPTests/test_user1.json -o ../../../Test/JUMPTests/JRCaptureTable/
@@ -59,10 +59,29 @@
 
 
 
-@interface JRConnectionManager : NSObject <NSURLConnectionDelegate, NSURLConnectionDataDelegate>
+@protocol JRConnectionTransport;
+@protocol JRConnectionMetricsObserver;
+@class JRTrace;
+
+/**
+ * Turns a successfully parsed JSON response into the value handed to a completion handler, or fails it by returning
+ * nil and setting *error. Decoders run on JRConnectionManager's background decoding queue, never on the main thread.
+ **/
+typedef id (^JRResponseDecoder)(id parsedResponse, NSError **error);
+
+@interface JRConnectionManager : NSObject
 {
 }
 
+/**
+ * The transport every connection and JSON request is sent over. Defaults to a JRURLSessionTransport; set it (e.g. to
+ * a JRURLConnectionTransport, or a JRURLSessionTransport with a different per-host limit) before making requests.
+ * Setting nil restores the default. A JRURLSessionTransport that is replaced has its sessions invalidated, after
+ * letting their outstanding tasks finish.
+ **/
++ (id <JRConnectionTransport>)transport;
++ (void)setTransport:(id <JRConnectionTransport>)transport;
+
 + (bool)createConnectionFromRequest:(NSURLRequest *)request
                         forDelegate:(id <JRConnectionManagerDelegate>)delegate
                             withTag:(id)userData;
@@ -76,8 +95,52 @@
 
 + (NSUInteger)openConnections;
 
+/**
+ * Observers are sent the JRRequestMetrics of every request that completes or fails, see JRConnectionMetrics.h. They
+ * are not retained.
+ **/
++ (void)addMetricsObserver:(id <JRConnectionMetricsObserver>)observer;
++ (void)removeMetricsObserver:(id <JRConnectionMetricsObserver>)observer;
+
+/**
+ * The queue completion handlers are called on when the caller does not pick one. Defaults to the main queue; setting
+ * nil restores the default.
+ **/
++ (NSOperationQueue *)callbackQueue;
++ (void)setCallbackQueue:(NSOperationQueue *)callbackQueue;
+
 + (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params
        completionHandler:(void (^)(id, NSError *))handler;
 
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params decoder:(JRResponseDecoder)decoder
+       completionHandler:(void (^)(id result, NSError *e))handler;
+
+/** As above, recording network, parse and model build spans for the request in the trace, if it's not nil **/
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params trace:(JRTrace *)trace
+                 decoder:(JRResponseDecoder)decoder completionHandler:(void (^)(id result, NSError *e))handler;
+
+/**
+ * Sends the request over the transport and calls the handler on the queue with the whole response, as the transport's
+ * sendAsynchronousRequest:queue:completionHandler: does, recording the request's metrics on the way.
+ **/
++ (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler;
+
 + (void)startURLConnectionWithRequest:(NSURLRequest *)request completionHandler:(void (^)(id parsedResponse, NSError *e))handler;
+
+/**
+ * Sends the request and parses the JSON response body, then runs the decoder (if any) on it, all on a background
+ * queue. Only the final call to the handler happens on callbackQueue, or on the default callbackQueue if that is nil.
+ **/
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request decoder:(JRResponseDecoder)decoder
+                        callbackQueue:(NSOperationQueue *)callbackQueue
+                    completionHandler:(void (^)(id result, NSError *e))handler;
+
+/**
+ * As above, recording network, parse and model build spans for the request in the trace, if it's not nil. Only the
+ * requests of the traced flow are passed their trace, so that others sent meanwhile stay out of it.
+ **/
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request trace:(JRTrace *)trace
+                              decoder:(JRResponseDecoder)decoder callbackQueue:(NSOperationQueue *)callbackQueue
+                    completionHandler:(void (^)(id result, NSError *e))handler;
 @end
@@ -33,8 +33,13 @@
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 
+#define JR_LOG_CATEGORY JRLogCategoryNetwork
+
 #import "NSMutableURLRequest+JRRequestUtils.h"
 #import "JRConnectionManager.h"
+#import "JRConnectionTransport.h"
+#import "JRConnectionMetrics.h"
+#import "JRTrace.h"
 #import "debug_log.h"
 #import "JRCompatibilityUtils.h"
 
@@ -55,10 +60,10 @@
 
 
 /**
- * @brief Stores the NSURLConnection and other connection data
+ * @brief Stores the transport task and other connection data
  *
  *  ConnectionData is the root object that is collected by
- *  JRConnectionManager in an NSMutableArray. This object is not intended to
+ *  JRConnectionManager keyed by its task. This object is not intended to
  *  be used in a public interface
  *
  * @sa
@@ -72,12 +77,14 @@
 @property           NSURLRequest    *request;
 @property           NSMutableData   *response;
 @property           NSURLResponse   *fullResponse;
+@property           JRRequestMetrics *metrics;
 @property(readonly) id              tag;
 @property(readonly) BOOL            returnFullResponse;
 @property(readonly) id <JRConnectionManagerDelegate> delegate;
 
-// NOTE that NSURLConnection objects are not copyable
-@property           NSURLConnection* connection;
+// NOTE that transport tasks are not copyable
+@property           id              task;
+@property           id <JRConnectionTransport> transport;
 @end
 
 @implementation ConnectionData
@@ -89,16 +96,18 @@
     objectCopy.request      = self.request;
     objectCopy.response     = self.response;
     objectCopy.fullResponse = self.fullResponse;
+    objectCopy.metrics      = self.metrics;
     objectCopy->_tag        = self.tag;
     objectCopy->_returnFullResponse = self.returnFullResponse;
     objectCopy->_delegate   = self.delegate;
-    objectCopy->_connection = self.connection;
+    objectCopy->_task       = self.task;
+    objectCopy.transport    = self.transport;
     return objectCopy;
 }
 
 - (id)initWithRequest:(NSURLRequest *)request
           forDelegate:(id <JRConnectionManagerDelegate>)delegate
-       withConnection:(NSURLConnection*)connection
+             withTask:(id)task
    returnFullResponse:(BOOL)returnFullResponse
               withTag:(id)userdata
 {
@@ -112,7 +121,7 @@
         _response = nil;
         _fullResponse = nil;
         self->_delegate = delegate;
-        self->_connection = connection;
+        self->_task = task;
     }
     return self;
 }
@@ -123,9 +132,14 @@
  * @brief JRConnectionManager category that hides the internal collection
  * of ConnectionData objects
  *
+ * connectionBuffers maps each transport task (by pointer identity) to its ConnectionData, so the per-chunk
+ * transport callbacks route in constant time. delegateIndex maps each delegate (also by pointer identity) to
+ * the ordered set of its in-flight ConnectionData objects, so stopConnectionsForDelegate: does not have to visit
+ * every open connection.
  **/
-@interface JRConnectionManager()
-@property NSMutableArray *connectionBuffers;
+@interface JRConnectionManager() <JRConnectionTransportClient>
+@property NSMapTable *connectionBuffers;
+@property NSMapTable *delegateIndex;
 @end
 
 
@@ -134,6 +148,9 @@
 @implementation JRConnectionManager
 
 static JRConnectionManager *singleton = nil;
+static id <JRConnectionTransport> transport = nil;
+static NSOperationQueue *callbackQueue = nil;
+static NSHashTable *metricsObservers = nil;
 
 
 + (id)getJRConnectionManager
@@ -156,28 +173,98 @@ static JRConnectionManager *singleton = nil;
     return self;
 }
 
++ (id <JRConnectionTransport>)transport
+{
+    if (!transport)
+        transport = [[JRURLSessionTransport alloc] init];
+
+    return transport;
+}
+
++ (void)setTransport:(id <JRConnectionTransport>)newTransport
+{
+    /* Sessions keep their delegate alive until they are invalidated, so the old transport would never go away */
+    if (transport != newTransport && [transport isKindOfClass:[JRURLSessionTransport class]])
+        [(JRURLSessionTransport *) transport invalidateSessions];
+
+    transport = newTransport;
+}
+
 + (NSUInteger)openConnections
 {
     JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
     return [[connectionManager connectionBuffers] count];
 }
 
-+ (ConnectionData*) getConnectionDataFromConnection:(NSURLConnection *)connection
++ (void)addMetricsObserver:(id <JRConnectionMetricsObserver>)observer
 {
-    for (ConnectionData* connectionData in [JRConnectionManager getConnectionBuffers])
+    @synchronized (self)
     {
-        if (connectionData.connection == connection)
-        {
-            return connectionData;
-        }
+        if (!metricsObservers) metricsObservers = [NSHashTable weakObjectsHashTable];
+        [metricsObservers addObject:observer];
+    }
+}
+
++ (void)removeMetricsObserver:(id <JRConnectionMetricsObserver>)observer
+{
+    @synchronized (self)
+    {
+        [metricsObservers removeObject:observer];
     }
-    return nil;
 }
 
-+ (NSMutableArray *) getConnectionBuffers
++ (void)reportMetrics:(JRRequestMetrics *)metrics error:(NSError *)error
 {
+    if (!metrics) return;
+    [metrics recordCompletionWithError:error];
+
+    NSArray *observers;
+    @synchronized (self)
+    {
+        observers = [metricsObservers allObjects];
+    }
+
+    for (id <JRConnectionMetricsObserver> observer in observers)
+        [observer connectionDidCompleteWithMetrics:metrics];
+}
+
++ (ConnectionData*) getConnectionDataFromTask:(id)task
+{
+    if (!task) return nil;
+
     JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
-    return [connectionManager connectionBuffers];
+    return [[connectionManager connectionBuffers] objectForKey:task];
+}
+
+- (void)addConnectionData:(ConnectionData *)connectionData
+{
+    [self.connectionBuffers setObject:connectionData forKey:connectionData.task];
+
+    id delegate = connectionData.delegate;
+    if (!delegate) return;
+
+    NSMutableOrderedSet *delegateConnections = [self.delegateIndex objectForKey:delegate];
+    if (!delegateConnections)
+    {
+        delegateConnections = [NSMutableOrderedSet orderedSet];
+        [self.delegateIndex setObject:delegateConnections forKey:delegate];
+    }
+    [delegateConnections addObject:connectionData];
+}
+
+- (void)removeConnectionData:(ConnectionData *)connectionData
+{
+    if (!connectionData) return;
+
+    [self.connectionBuffers removeObjectForKey:connectionData.task];
+
+    id delegate = connectionData.delegate;
+    if (!delegate) return;
+
+    NSMutableOrderedSet *delegateConnections = [self.delegateIndex objectForKey:delegate];
+    [delegateConnections removeObject:connectionData];
+    if (delegateConnections && ![delegateConnections count])
+        [self.delegateIndex removeObjectForKey:delegate];
 }
 
 + (bool)createConnectionFromRequest:(NSURLRequest *)request
@@ -185,29 +272,29 @@ static JRConnectionManager *singleton = nil;
                  returnFullResponse:(BOOL)returnFullResponse
                             withTag:(id)userData
 {
-    NSString *body = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
-    DLog(@"request to '%@' with body: '%@'", [[request URL] absoluteString], body);
+    DLog(@"request to '%@' with body: '%@'", [[request URL] absoluteString],
+         [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding]);
 
     JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
-    NSMutableArray *connectionBuffers = [connectionManager connectionBuffers];
+    id <JRConnectionTransport> connectionTransport = [JRConnectionManager transport];
 
-    if (![NSURLConnection canHandleRequest:request])
+    if (![connectionTransport canHandleRequest:request])
         return NO;
 
-    NSURLConnection *connection = [[NSURLConnection alloc]
-            initWithRequest:request delegate:connectionManager startImmediately:NO];
+    id task = [connectionTransport newTaskWithRequest:request client:connectionManager];
 
-    if (!connection)
+    if (!task)
         return NO;
 
     ConnectionData *connectionData = [[ConnectionData alloc] initWithRequest:request
                                                                  forDelegate:delegate
-                                                              withConnection:connection
+                                                                    withTask:task
                                                           returnFullResponse:returnFullResponse
                                                                      withTag:userData];
-    [connectionBuffers addObject:connectionData];
-    [connection scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
-    [connection start];
+    connectionData.transport = connectionTransport;
+    connectionData.metrics = [[JRRequestMetrics alloc] initWithRequest:request];
+    [connectionManager addConnectionData:connectionData];
+    [connectionTransport resumeTask:task];
     [connectionManager startActivity];
 
     return YES;
@@ -224,68 +311,168 @@ static JRConnectionManager *singleton = nil;
 + (void)stopConnectionsForDelegate:(id <JRConnectionManagerDelegate>)delegate
 {
     DLog(@"delegate=%@", delegate.debugDescription);
-    for (ConnectionData *connectionData in [JRConnectionManager getConnectionBuffers])
-    {
-        if (connectionData.delegate == delegate)
-        {
-            [connectionData.connection cancel];
+    if (!delegate) return;
 
-            if ([connectionData tag])
-            {
-                if ([delegate respondsToSelector:@selector(connectionWasStoppedWithTag:)])
-                    [delegate connectionWasStoppedWithTag:[connectionData tag]];
-            }
+    JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
+
+    // Detach the delegate's connections from both indices before calling out, so a delegate that starts or stops
+    // connections from within connectionWasStoppedWithTag: can't mutate the collection being walked here
+    NSArray *delegateConnections = [[[connectionManager delegateIndex] objectForKey:delegate] array];
+    for (ConnectionData *connectionData in delegateConnections)
+        [connectionManager removeConnectionData:connectionData];
+
+    for (ConnectionData *connectionData in delegateConnections)
+    {
+        [connectionData.transport cancelTask:connectionData.task];
 
-            [[JRConnectionManager getConnectionBuffers] removeObject:connectionData];
+        if ([connectionData tag])
+        {
+            if ([delegate respondsToSelector:@selector(connectionWasStoppedWithTag:)])
+                [delegate connectionWasStoppedWithTag:[connectionData tag]];
         }
     }
 
-    [[JRConnectionManager getJRConnectionManager] stopActivity];
+    [connectionManager stopActivity];
+}
+
++ (NSOperationQueue *)callbackQueue
+{
+    return callbackQueue ? callbackQueue : [NSOperationQueue mainQueue];
+}
+
++ (void)setCallbackQueue:(NSOperationQueue *)queue
+{
+    callbackQueue = queue;
+}
+
++ (NSOperationQueue *)decodeQueue
+{
+    static NSOperationQueue *decodeQueue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        decodeQueue = [[NSOperationQueue alloc] init];
+        decodeQueue.name = @"com.janrain.JRConnectionManager.decode";
+    });
+
+    return decodeQueue;
 }
 
 + (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params
      completionHandler:(void(^)(id parsedResponse, NSError *e))handler
+{
+    [JRConnectionManager jsonRequestToUrl:url params:params decoder:nil completionHandler:handler];
+}
+
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params decoder:(JRResponseDecoder)decoder
+       completionHandler:(void (^)(id result, NSError *e))handler
+{
+    [JRConnectionManager jsonRequestToUrl:url params:params trace:nil decoder:decoder completionHandler:handler];
+}
+
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params trace:(JRTrace *)trace
+                 decoder:(JRResponseDecoder)decoder completionHandler:(void (^)(id result, NSError *e))handler
 {
     DLog(@"url=%@", url);
     NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
-    [JRConnectionManager startURLConnectionWithRequest:request completionHandler:handler];
+    [JRConnectionManager startURLConnectionWithRequest:request trace:trace decoder:decoder callbackQueue:nil
+                                     completionHandler:handler];
 }
 
 + (void)startURLConnectionWithRequest:(NSURLRequest *)request
                     completionHandler:(void(^)(id parsedResponse, NSError *e))handler
 {
-    NSString *p = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
-    NSString *url = [request.URL absoluteString];
-    DLog(@"URL: \"%@\" params: \"%@\"", url, p);
-    [NSURLConnection sendAsynchronousRequest:request queue:[NSOperationQueue mainQueue]
-                           completionHandler:^(NSURLResponse *r, NSData *d, NSError *e)
-                           {
-                               if (e)
-                               {
-                                   ALog(@"Error fetching JSON: %@", e);
-                                   handler(nil, e);
-                               }
-                               else
-                               {
-                                   NSString *bodyString =
-                                           [[NSString alloc] initWithData:d
-                                                                  encoding:NSUTF8StringEncoding];
-                                   NSError *err = nil;
-                                   id parsedJson = [NSJSONSerialization JSONObjectWithData:d
-                                                                                   options:(NSJSONReadingOptions) 0
-                                                                                     error:&err];
-                                   ALog(@"Fetched: \"%@\"", bodyString);
-                                   if (err)
-                                   {
-                                       ALog(@"Parse err: \"%@\"", err);
-                                       handler(nil, e);
-                                   }
-                                   else
-                                   {
-                                       handler(parsedJson, nil);
-                                   }
-                               }
-                           }];
+    [JRConnectionManager startURLConnectionWithRequest:request decoder:nil callbackQueue:nil
+                                     completionHandler:handler];
+}
+
++ (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler
+{
+    JRRequestMetrics *metrics = [[JRRequestMetrics alloc] initWithRequest:request];
+    void (^recordingHandler)(NSURLResponse *, NSData *, NSError *) = ^(NSURLResponse *r, NSData *d, NSError *e)
+    {
+        if (r) [metrics recordResponse:r];
+        [metrics recordResponseBytes:[d length]];
+        [JRConnectionManager reportMetrics:metrics error:e];
+        handler(r, d, e);
+    };
+
+    id <JRConnectionTransport> connectionTransport = [JRConnectionManager transport];
+    if ([connectionTransport respondsToSelector:@selector(sendAsynchronousRequest:queue:metrics:completionHandler:)])
+        [connectionTransport sendAsynchronousRequest:request queue:queue metrics:metrics
+                                   completionHandler:recordingHandler];
+    else
+        [connectionTransport sendAsynchronousRequest:request queue:queue completionHandler:recordingHandler];
+}
+
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request decoder:(JRResponseDecoder)decoder
+                        callbackQueue:(NSOperationQueue *)queue
+                    completionHandler:(void (^)(id result, NSError *e))handler
+{
+    [JRConnectionManager startURLConnectionWithRequest:request trace:nil decoder:decoder callbackQueue:queue
+                                     completionHandler:handler];
+}
+
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request trace:(JRTrace *)trace
+                              decoder:(JRResponseDecoder)decoder callbackQueue:(NSOperationQueue *)queue
+                    completionHandler:(void (^)(id result, NSError *e))handler
+{
+    DLog(@"URL: \"%@\" params: \"%@\"", [request.URL absoluteString],
+         [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding]);
+    if (!queue) queue = [JRConnectionManager callbackQueue];
+
+    void (^deliver)(id, NSError *) = ^(id result, NSError *error)
+    {
+        [queue addOperationWithBlock:^
+        {
+            handler(result, error);
+        }];
+    };
+
+    NSString *path = [request.URL path];
+    JRTraceSpan *networkSpan = [trace beginSpanNamed:path kind:JRTraceSpanKindNetwork];
+
+    [JRConnectionManager sendAsynchronousRequest:request queue:[JRConnectionManager decodeQueue]
+                               completionHandler:^(NSURLResponse *r, NSData *d, NSError *e)
+    {
+        [networkSpan end];
+        if (e)
+        {
+            ALog(@"Error fetching JSON: %@", e);
+            deliver(nil, e);
+            return;
+        }
+
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+        NSError *err = nil;
+        JRTraceSpan *parseSpan = [trace beginSpanNamed:path kind:JRTraceSpanKindParse];
+        id parsedJson = [NSJSONSerialization JSONObjectWithData:d options:(NSJSONReadingOptions) 0 error:&err];
+        [parseSpan end];
+        DLog(@"Fetched: \"%@\"", [[NSString alloc] initWithData:d encoding:NSUTF8StringEncoding]);
+        if (err)
+        {
+            ALog(@"Parse err: \"%@\"", err);
+            deliver(nil, err);
+            return;
+        }
+
+        if (decoder)
+        {
+            JRTraceSpan *decodeSpan = [trace beginSpanNamed:path kind:JRTraceSpanKindModelBuild];
+            parsedJson = decoder(parsedJson, &err);
+            [decodeSpan end];
+            if (err)
+            {
+                deliver(nil, err);
+                return;
+            }
+        }
+
+        DLog(@"decoded %lu bytes off the main thread in %.2fms", (unsigned long) [d length],
+             (CFAbsoluteTimeGetCurrent() - start) * 1000);
+        deliver(parsedJson, nil);
+    }];
 }
 
 
@@ -293,7 +480,12 @@ static JRConnectionManager *singleton = nil;
 {
     if ((self = [super init]))
     {
-        _connectionBuffers = [[NSMutableArray alloc] init];
+        NSPointerFunctionsOptions identityKeys =
+                NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+        _connectionBuffers = [[NSMapTable alloc] initWithKeyOptions:identityKeys
+                                                       valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+        _delegateIndex = [[NSMapTable alloc] initWithKeyOptions:identityKeys
+                                                   valueOptions:NSPointerFunctionsStrongMemory capacity:0];
     }
     
     return self;
@@ -317,59 +509,62 @@ static JRConnectionManager *singleton = nil;
 - (void)dealloc
 {
     DLog(@"");
-    NSEnumerator *enumerator = [[self connectionBuffers] objectEnumerator];
-    ConnectionData *connectionData;
-    while ((connectionData = [enumerator nextObject]))
+    NSArray *openConnections = [[[self connectionBuffers] objectEnumerator] allObjects];
+    [[self connectionBuffers] removeAllObjects];
+    [[self delegateIndex] removeAllObjects];
+
+    for (ConnectionData *connectionData in openConnections)
     {
-        [connectionData.connection cancel];
+        [connectionData.transport cancelTask:connectionData.task];
         
         if ([connectionData tag])
         {
-            [[connectionData delegate] connectionWasStoppedWithTag:[connectionData tag]];
+            if ([[connectionData delegate] respondsToSelector:@selector(connectionWasStoppedWithTag:)])
+                [[connectionData delegate] connectionWasStoppedWithTag:[connectionData tag]];
         }
-        
-        [[self connectionBuffers] removeObject:connectionData];
     }
     [self stopActivity];
 }
 
-- (void)connection:(NSURLConnection *)connection didReceiveData:(NSData *)data
+#pragma mark JRConnectionTransportClient
+
+- (void)transportTask:(id)task didReceiveData:(NSData *)data
 {
-    DLog(@"data=%@", [data jrBase64Encode]);
-    for (ConnectionData *connectionData in [self connectionBuffers])
-    {
-        if (connectionData.connection == connection)
-        {
-            [[connectionData response] appendData:data];
-            break;
-        }
-    }
+    DLog(@"received %lu bytes", (unsigned long) [data length]);
+    ConnectionData *connectionData = [JRConnectionManager getConnectionDataFromTask:task];
+    [[connectionData response] appendData:data];
+    [[connectionData metrics] recordResponseBytes:[data length]];
 }
 
-- (void)connection:(NSURLConnection *)connection didReceiveResponse:(NSURLResponse *)response
+- (void)transportTask:(id)task didReceiveResponse:(NSURLResponse *)response
 {
     DLog(@"response=%@", response.URL.absoluteString);
-    for (ConnectionData *connectionData in [self connectionBuffers])
-    {
-        if (connectionData.connection == connection)
-        {
-            [connectionData setResponse:[[NSMutableData alloc] init]];
-            if ([connectionData returnFullResponse])
-                connectionData.fullResponse = response;
-            break;
-        }
-    }
+    ConnectionData *connectionData = [JRConnectionManager getConnectionDataFromTask:task];
+    [connectionData setResponse:[[NSMutableData alloc] init]];
+    [[connectionData metrics] recordResponse:response];
+    if ([connectionData returnFullResponse])
+        connectionData.fullResponse = response;
 }
 
-- (void)connectionDidFinishLoading:(NSURLConnection *)connection
+- (void)transportTask:(id)task didCompleteWithError:(NSError *)error
 {
-    DLog(@"connection=%@", connection.description);
+    if (error)
+        [self transportTask:task didFailWithError:error];
+    else
+        [self transportTaskDidFinishLoading:task];
+}
+
+- (void)transportTaskDidFinishLoading:(id)task
+{
+    DLog(@"task=%@", [task description]);
     
-    ConnectionData *connectionData  = [JRConnectionManager getConnectionDataFromConnection:connection];
-    if (!connectionData || (connectionData.connection != connection))
+    ConnectionData *connectionData  = [JRConnectionManager getConnectionDataFromTask:task];
+    if (!connectionData || (connectionData.task != task))
     {
         return;
     }
+
+    [JRConnectionManager reportMetrics:[connectionData metrics] error:nil];
     
     NSURLRequest*   request         = [connectionData request];
     NSURLResponse*  fullResponse    = [connectionData fullResponse];
@@ -394,69 +589,41 @@ static JRConnectionManager *singleton = nil;
                                                          request:request andTag:userData];
     }
 
-    JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
-    [[connectionManager connectionBuffers] removeObject:connectionData];
+    [self removeConnectionData:connectionData];
 
     [self stopActivity];
 }
 
-- (void)connection:(NSURLConnection *)connection didFailWithError:(NSError *)error
+- (void)transportTask:(id)task didFailWithError:(NSError *)error
 {
     DLog(@"error message: %@", [error localizedDescription]);
 
-    ConnectionData* connectionData  = [JRConnectionManager getConnectionDataFromConnection:connection];
+    ConnectionData* connectionData  = [JRConnectionManager getConnectionDataFromTask:task];
     NSURLRequest*   request         = [connectionData request];
     id              userData        = [connectionData tag];
     
     id <JRConnectionManagerDelegate> delegate = [connectionData delegate];
 
+    [JRConnectionManager reportMetrics:[connectionData metrics] error:error];
+
     if ([delegate respondsToSelector:@selector(connectionDidFailWithError:request:andTag:)])
         [delegate connectionDidFailWithError:error request:request andTag:userData];
 
-    JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
-    [[connectionManager connectionBuffers] removeObject:connectionData];
+    [self removeConnectionData:connectionData];
 
     [self stopActivity];
 }
 
-- (NSURLRequest *)connection:(NSURLConnection *)connection willSendRequest:(NSURLRequest *)request
-            redirectResponse:(NSURLResponse *)redirectResponse
+- (void)transportTask:(id)task willSendRequest:(NSURLRequest *)request redirectResponse:(NSURLResponse *)redirectResponse
 {
-    NSString *body = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
-    DLog(@"request to '%@' with body: '%@'", [[request URL] absoluteString], body);
-    ConnectionData* connectionData  = [JRConnectionManager getConnectionDataFromConnection:connection];
+    DLog(@"request to '%@' with body: '%@'", [[request URL] absoluteString],
+         [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding]);
+    ConnectionData* connectionData  = [JRConnectionManager getConnectionDataFromTask:task];
 
+    if (redirectResponse)
+        [[connectionData metrics] recordRedirect];
     if ([connectionData returnFullResponse])
         connectionData.fullResponse = redirectResponse;
-
-    return request;
-}
-
-- (void)              connection:(NSURLConnection *)connection
-didCancelAuthenticationChallenge:(NSURLAuthenticationChallenge *)challenge
-{
-    DLog(@"");
-}
-
-- (void)               connection:(NSURLConnection *)connection
-didReceiveAuthenticationChallenge:(NSURLAuthenticationChallenge *)challenge
-{
-    DLog(@"");
-}
-
-- (NSCachedURLResponse *)connection:(NSURLConnection *)connection
-                  willCacheResponse:(NSCachedURLResponse *)cachedResponse
-{
-    /*DLog(@"");*/
-    return cachedResponse;
-}
-
-- (void)connection:(NSURLConnection *)connection didSendBodyData:(NSInteger)bytesWritten
-        totalBytesWritten:(NSInteger)totalBytesWritten
-totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite
-{
-    //DLog(@"bytesWritten: %d, totalBytesWritten: %d, totalBytesExpected: %d", bytesWritten, totalBytesWritten,
-    //    totalBytesExpectedToWrite);
 }
 
 @end
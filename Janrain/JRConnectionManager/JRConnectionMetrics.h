@@ -0,0 +1,126 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ * The kinds of request the metrics are grouped by
+ **/
+typedef enum
+{
+    JREndpointClassOther,
+    JREndpointClassEntity,              /**< Capture /entity */
+    JREndpointClassEntityUpdate,        /**< Capture /entity.update and /entity.replace */
+    JREndpointClassTraditionalSignIn,   /**< Capture /oauth/auth_native_traditional */
+    JREndpointClassFlow,                /**< The flow, from the CDN */
+    JREndpointClassEngageApi,           /**< Engage /api/v2/... */
+    JREndpointClassCount,
+} JREndpointClass;
+
+JREndpointClass JREndpointClassForURL(NSURL *url);
+
+/** The endpoint class's key in JRConnectionMetrics' JSON, e.g. @"entity.update" **/
+NSString *JREndpointClassName(JREndpointClass endpointClass);
+
+/**
+ * Code that sends a request again sets this property on the new request, with +[NSURLProtocol setProperty:forKey:
+ * inRequest:], to the number of times it was sent before; its metrics report that number as retries.
+ **/
+extern NSString *const JRRequestRetryCountProperty;
+
+/**
+ * @brief What one request through JRConnectionManager cost
+ *
+ *  Times are CFAbsoluteTimes as seen by JRConnectionManager. firstByteTime is when the response headers arrived; for
+ *  transports that only hand over whole responses it's the same as endTime. Byte counts are of the bodies, as
+ *  Foundation hands them over, i.e. after any content decoding.
+ **/
+@interface JRRequestMetrics : NSObject
+@property(nonatomic, readonly) NSURL *url;
+@property(nonatomic, readonly) JREndpointClass endpointClass;
+@property(nonatomic, readonly) CFAbsoluteTime startTime;
+@property(nonatomic, readonly) CFAbsoluteTime firstByteTime;
+@property(nonatomic, readonly) CFAbsoluteTime endTime;
+@property(nonatomic, readonly) NSUInteger requestBytes;
+@property(nonatomic, readonly) NSUInteger responseBytes;
+
+/** 0 if no HTTP response arrived **/
+@property(nonatomic, readonly) NSInteger statusCode;
+@property(nonatomic, readonly) NSUInteger redirects;
+@property(nonatomic, readonly) NSUInteger retries;
+@property(nonatomic, readonly) NSError *error;
+
+- (NSTimeInterval)timeToFirstByte;
+- (NSTimeInterval)duration;
+
+/**
+ * @name Recording
+ * Used by JRConnectionManager and its transports while the request is under way
+ **/
+/*@{*/
+- (id)initWithRequest:(NSURLRequest *)request;
+
+/** Only the first call counts **/
+- (void)recordFirstByte;
+
+/** Records the status code, and the first byte if it isn't recorded yet **/
+- (void)recordResponse:(NSURLResponse *)response;
+- (void)recordResponseBytes:(NSUInteger)length;
+- (void)recordRedirect;
+- (void)recordCompletionWithError:(NSError *)error;
+/*@}*/
+@end
+
+@protocol JRConnectionMetricsObserver <NSObject>
+/**
+ * Sent once for each request that completes or fails, but not for connections that are stopped, on whichever queue
+ * the request completed on
+ **/
+- (void)connectionDidCompleteWithMetrics:(JRRequestMetrics *)metrics;
+@end
+
+/**
+ * @brief Latency histograms and totals of requests, per endpoint class
+ *
+ *  Start one collecting with +[JRConnectionManager addMetricsObserver:], which doesn't retain it. Safe to use from
+ *  any thread.
+ **/
+@interface JRConnectionMetrics : NSObject <JRConnectionMetricsObserver>
+
+/**
+ * Keyed by JREndpointClassName, for the endpoint classes with at least one request. Each has the request, error,
+ * redirect and retry counts, the request and response byte totals, the count of each status code, and the latency
+ * in milliseconds: its minimum, mean, maximum, estimated 50th/90th/99th percentiles, mean time to the first byte,
+ * and a histogram of counts by upper bound ("le").
+ **/
+- (NSDictionary *)dictionaryRepresentation;
+- (NSData *)JSONData;
+- (void)reset;
+@end
@@ -0,0 +1,267 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#import "JRConnectionMetrics.h"
+
+NSString *const JRRequestRetryCountProperty = @"JRRequestRetryCount";
+
+JREndpointClass JREndpointClassForURL(NSURL *url)
+{
+    NSString *path = [url path];
+
+    if ([path hasSuffix:@"/entity"]) return JREndpointClassEntity;
+    if ([path hasSuffix:@"/entity.update"] || [path hasSuffix:@"/entity.replace"]) return JREndpointClassEntityUpdate;
+    if ([path hasSuffix:@"/oauth/auth_native_traditional"]) return JREndpointClassTraditionalSignIn;
+    if ([path rangeOfString:@"/widget_data/flows/"].location != NSNotFound) return JREndpointClassFlow;
+    if ([path hasPrefix:@"/api/v2/"]) return JREndpointClassEngageApi;
+
+    return JREndpointClassOther;
+}
+
+NSString *JREndpointClassName(JREndpointClass endpointClass)
+{
+    switch (endpointClass)
+    {
+        case JREndpointClassEntity:
+            return @"entity";
+        case JREndpointClassEntityUpdate:
+            return @"entity.update";
+        case JREndpointClassTraditionalSignIn:
+            return @"oauth/auth_native_traditional";
+        case JREndpointClassFlow:
+            return @"flow";
+        case JREndpointClassEngageApi:
+            return @"engage/api/v2";
+        default:
+            return @"other";
+    }
+}
+
+@implementation JRRequestMetrics
+
+- (id)initWithRequest:(NSURLRequest *)request
+{
+    if ((self = [super init]))
+    {
+        _url = [request URL];
+        _endpointClass = JREndpointClassForURL(_url);
+        _startTime = CFAbsoluteTimeGetCurrent();
+        _requestBytes = [[request HTTPBody] length];
+        _retries = [[NSURLProtocol propertyForKey:JRRequestRetryCountProperty inRequest:request] unsignedIntegerValue];
+    }
+
+    return self;
+}
+
+- (void)recordFirstByte
+{
+    if (!_firstByteTime) _firstByteTime = CFAbsoluteTimeGetCurrent();
+}
+
+- (void)recordResponse:(NSURLResponse *)response
+{
+    [self recordFirstByte];
+    if ([response isKindOfClass:[NSHTTPURLResponse class]])
+        _statusCode = [(NSHTTPURLResponse *) response statusCode];
+}
+
+- (void)recordResponseBytes:(NSUInteger)length
+{
+    _responseBytes += length;
+}
+
+- (void)recordRedirect
+{
+    _redirects++;
+}
+
+- (void)recordCompletionWithError:(NSError *)error
+{
+    _endTime = CFAbsoluteTimeGetCurrent();
+    if (!_firstByteTime) _firstByteTime = _endTime;
+    _error = error;
+}
+
+- (NSTimeInterval)timeToFirstByte
+{
+    return _firstByteTime - _startTime;
+}
+
+- (NSTimeInterval)duration
+{
+    return _endTime - _startTime;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %@ %ld %.1fms (first byte %.1fms) %lu/%lu bytes>",
+                                      NSStringFromClass([self class]), JREndpointClassName(_endpointClass),
+                                      (long) _statusCode, [self duration] * 1000, [self timeToFirstByte] * 1000,
+                                      (unsigned long) _requestBytes, (unsigned long) _responseBytes];
+}
+@end
+
+/* Upper bounds of the latency buckets, in milliseconds; the last bucket takes everything slower */
+static const double JRLatencyBucketBounds[] = { 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 30000 };
+#define JR_LATENCY_BUCKET_COUNT (sizeof(JRLatencyBucketBounds) / sizeof(JRLatencyBucketBounds[0]) + 1)
+
+typedef struct
+{
+    NSUInteger count;
+    NSUInteger errors;
+    NSUInteger redirects;
+    NSUInteger retries;
+    unsigned long long requestBytes;
+    unsigned long long responseBytes;
+    double totalMilliseconds;
+    double totalFirstByteMilliseconds;
+    double minMilliseconds;
+    double maxMilliseconds;
+    NSUInteger buckets[JR_LATENCY_BUCKET_COUNT];
+} JREndpointHistogram;
+
+static double JRHistogramPercentile(const JREndpointHistogram *histogram, double fraction)
+{
+    NSUInteger rank = (NSUInteger) ceil(fraction * histogram->count), seen = 0;
+    for (NSUInteger i = 0; i < JR_LATENCY_BUCKET_COUNT - 1; i++)
+    {
+        seen += histogram->buckets[i];
+        if (seen >= rank) return MIN(JRLatencyBucketBounds[i], histogram->maxMilliseconds);
+    }
+
+    return histogram->maxMilliseconds;
+}
+
+@implementation JRConnectionMetrics
+{
+    JREndpointHistogram _histograms[JREndpointClassCount];
+    NSArray *_statusCodes;
+}
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        [self reset];
+    }
+
+    return self;
+}
+
+- (void)reset
+{
+    @synchronized (self)
+    {
+        memset(_histograms, 0, sizeof(_histograms));
+        NSMutableArray *statusCodes = [NSMutableArray arrayWithCapacity:JREndpointClassCount];
+        for (NSUInteger i = 0; i < JREndpointClassCount; i++) [statusCodes addObject:[NSCountedSet set]];
+        _statusCodes = statusCodes;
+    }
+}
+
+- (void)connectionDidCompleteWithMetrics:(JRRequestMetrics *)metrics
+{
+    double milliseconds = [metrics duration] * 1000;
+    NSUInteger bucket = 0;
+    while (bucket < JR_LATENCY_BUCKET_COUNT - 1 && milliseconds > JRLatencyBucketBounds[bucket]) bucket++;
+
+    @synchronized (self)
+    {
+        JREndpointHistogram *histogram = &_histograms[metrics.endpointClass];
+        histogram->minMilliseconds = histogram->count ? MIN(histogram->minMilliseconds, milliseconds) : milliseconds;
+        histogram->maxMilliseconds = MAX(histogram->maxMilliseconds, milliseconds);
+        histogram->count++;
+        if (metrics.error) histogram->errors++;
+        histogram->redirects += metrics.redirects;
+        histogram->retries += metrics.retries;
+        histogram->requestBytes += metrics.requestBytes;
+        histogram->responseBytes += metrics.responseBytes;
+        histogram->totalMilliseconds += milliseconds;
+        histogram->totalFirstByteMilliseconds += [metrics timeToFirstByte] * 1000;
+        histogram->buckets[bucket]++;
+
+        if (metrics.statusCode) [[_statusCodes objectAtIndex:metrics.endpointClass] addObject:@(metrics.statusCode)];
+    }
+}
+
+- (NSDictionary *)dictionaryRepresentation
+{
+    NSMutableDictionary *endpoints = [NSMutableDictionary dictionary];
+
+    @synchronized (self)
+    {
+        for (NSUInteger i = 0; i < JREndpointClassCount; i++)
+        {
+            const JREndpointHistogram *histogram = &_histograms[i];
+            if (!histogram->count) continue;
+
+            NSMutableArray *buckets = [NSMutableArray arrayWithCapacity:JR_LATENCY_BUCKET_COUNT];
+            for (NSUInteger j = 0; j < JR_LATENCY_BUCKET_COUNT; j++)
+            {
+                id bound = j < JR_LATENCY_BUCKET_COUNT - 1 ? (id) @(JRLatencyBucketBounds[j]) : @"+Inf";
+                [buckets addObject:@{ @"le" : bound, @"count" : @(histogram->buckets[j]) }];
+            }
+
+            NSMutableDictionary *statusCodes = [NSMutableDictionary dictionary];
+            for (NSNumber *statusCode in [_statusCodes objectAtIndex:i])
+                [statusCodes setObject:@([[_statusCodes objectAtIndex:i] countForObject:statusCode])
+                                forKey:[statusCode stringValue]];
+
+            [endpoints setObject:@{
+                    @"count" : @(histogram->count),
+                    @"errors" : @(histogram->errors),
+                    @"redirects" : @(histogram->redirects),
+                    @"retries" : @(histogram->retries),
+                    @"request_bytes" : @(histogram->requestBytes),
+                    @"response_bytes" : @(histogram->responseBytes),
+                    @"status_codes" : statusCodes,
+                    @"latency_ms" : @{
+                            @"min" : @(histogram->minMilliseconds),
+                            @"mean" : @(histogram->totalMilliseconds / histogram->count),
+                            @"max" : @(histogram->maxMilliseconds),
+                            @"p50" : @(JRHistogramPercentile(histogram, 0.5)),
+                            @"p90" : @(JRHistogramPercentile(histogram, 0.9)),
+                            @"p99" : @(JRHistogramPercentile(histogram, 0.99)),
+                            @"first_byte_mean" : @(histogram->totalFirstByteMilliseconds / histogram->count),
+                            @"histogram" : buckets
+                    }
+            } forKey:JREndpointClassName((JREndpointClass) i)];
+        }
+    }
+
+    return @{ @"endpoints" : endpoints };
+}
+
+- (NSData *)JSONData
+{
+    return [NSJSONSerialization dataWithJSONObject:[self dictionaryRepresentation] options:(NSJSONWritingOptions) 0
+                                             error:nil];
+}
+@end
@@ -0,0 +1,130 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+@class JRRequestMetrics;
+
+/**
+ * @brief Receives the events of a transport task started on behalf of a client
+ *
+ *  JRURLSessionTransport sends these messages on the main queue; JRURLConnectionTransport sends them on the run loop of
+ *  the thread that created the task. They arrive in the order the underlying transport produced them. After
+ *  transportTask:didCompleteWithError: (or after the client cancels the task) no further messages are sent for that
+ *  task.
+ **/
+@protocol JRConnectionTransportClient <NSObject>
+- (void)transportTask:(id)task didReceiveResponse:(NSURLResponse *)response;
+- (void)transportTask:(id)task didReceiveData:(NSData *)data;
+- (void)transportTask:(id)task willSendRequest:(NSURLRequest *)request redirectResponse:(NSURLResponse *)redirectResponse;
+- (void)transportTask:(id)task didCompleteWithError:(NSError *)error;
+@end
+
+/**
+ * @brief The pluggable layer that actually moves bytes for JRConnectionManager
+ *
+ *  Task handles are opaque to the client; they are only compared by identity and handed back to the transport.
+ **/
+@protocol JRConnectionTransport <NSObject>
+- (BOOL)canHandleRequest:(NSURLRequest *)request;
+
+/**
+ * Creates, but does not start, a task for the request. Returns nil if the task could not be created.
+ **/
+- (id)newTaskWithRequest:(NSURLRequest *)request client:(id <JRConnectionTransportClient>)client;
+- (void)resumeTask:(id)task;
+
+/**
+ * Cancels the task. The client receives no further messages for it.
+ **/
+- (void)cancelTask:(id)task;
+
+/**
+ * One-shot request whose handler is called on the given queue with the whole response body.
+ **/
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler;
+
+@optional
+/**
+ * As sendAsynchronousRequest:queue:completionHandler:, also recording in metrics when the first byte of the response
+ * arrives and any redirects. JRConnectionManager uses it when the transport has it.
+ **/
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+                        metrics:(JRRequestMetrics *)metrics
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler;
+@end
+
+/**
+ * @brief NSURLSession based transport, and the default one
+ *
+ *  Keeps one persistent session per scheme/host/port, so requests to the same Capture or Engage host share
+ *  keep-alive connections instead of each paying for their own connection setup. Each session allows at most
+ *  maximumConnectionsPerHost concurrent connections (or the per-host override); further requests queue in the
+ *  session until a connection frees up. Session callbacks arrive on a private serial queue, so one-shot requests
+ *  never touch the main thread unless the caller asks for it; task events are forwarded to clients on the main queue.
+ **/
+@interface JRURLSessionTransport : NSObject <JRConnectionTransport>
+
+/**
+ * The configuration the per-host sessions are copied from. Defaults to +[NSURLSessionConfiguration
+ * defaultSessionConfiguration]. Changing it only affects sessions created afterwards, see invalidateSessions.
+ **/
+@property(nonatomic, copy) NSURLSessionConfiguration *configuration;
+
+/**
+ * Default per-host connection limit, 4 unless set.
+ **/
+@property(nonatomic) NSUInteger maximumConnectionsPerHost;
+
+- (id)initWithConfiguration:(NSURLSessionConfiguration *)configuration;
+
+/**
+ * Overrides maximumConnectionsPerHost for one host. Pass 0 to remove the override. The host's current session, if
+ * any, finishes its outstanding tasks and is replaced on the next request.
+ **/
+- (void)setMaximumConnections:(NSUInteger)maximumConnections forHost:(NSString *)host;
+
+/**
+ * Lets every current session finish its outstanding tasks and drops it, so the next request to each host opens a
+ * new session with the current settings. Sessions keep the transport alive until they are invalidated, so call this
+ * when you are done with a transport; +[JRConnectionManager setTransport:] does it for the transport it replaces.
+ **/
+- (void)invalidateSessions;
+@end
+
+/**
+ * @brief The original one-NSURLConnection-per-request transport
+ *
+ *  Connections are scheduled on the run loop of the thread that creates them, in the default mode.
+ **/
+@interface JRURLConnectionTransport : NSObject <JRConnectionTransport>
+@end
@@ -0,0 +1,465 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define JR_LOG_CATEGORY JRLogCategoryNetwork
+
+#import "JRConnectionTransport.h"
+#import "JRConnectionMetrics.h"
+#import "debug_log.h"
+
+static const NSUInteger cJRDefaultMaximumConnectionsPerHost = 4;
+
+static NSString *JRTransportHostKey(NSURL *url)
+{
+    NSString *scheme = [[url scheme] lowercaseString];
+    NSString *host = [[url host] lowercaseString];
+    NSNumber *port = [url port];
+    if (!port) port = [scheme isEqualToString:@"https"] ? @443 : @80;
+
+    return [NSString stringWithFormat:@"%@://%@:%@", scheme, host, port];
+}
+
+static NSMapTable *JRNewTaskTable()
+{
+    return [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory |
+                                                  NSPointerFunctionsObjectPointerPersonality
+                                     valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+}
+
+/**
+ * A one-shot request's response as it arrives, gathered on the session's delegate queue
+ **/
+@interface JRURLSessionOneShot : NSObject
+@property(nonatomic) NSURLResponse *response;
+@property(nonatomic) NSMutableData *data;
+@property(nonatomic) JRRequestMetrics *metrics;
+@property(nonatomic) NSOperationQueue *queue;
+@property(nonatomic, copy) void (^handler)(NSURLResponse *, NSData *, NSError *);
+@end
+
+@implementation JRURLSessionOneShot
+@end
+
+@interface JRURLSessionTransport () <NSURLSessionDataDelegate>
+@property(nonatomic) NSMutableDictionary *sessions;
+@property(nonatomic) NSMutableDictionary *hostConnectionLimits;
+@property(nonatomic) NSMapTable *taskClients;
+@property(nonatomic) NSMapTable *oneShots;
+@property(nonatomic) NSOperationQueue *delegateQueue;
+@end
+
+@implementation JRURLSessionTransport
+
+- (id)init
+{
+    return [self initWithConfiguration:nil];
+}
+
+- (id)initWithConfiguration:(NSURLSessionConfiguration *)configuration
+{
+    if ((self = [super init]))
+    {
+        _configuration = configuration ? [configuration copy] : [NSURLSessionConfiguration defaultSessionConfiguration];
+        _maximumConnectionsPerHost = cJRDefaultMaximumConnectionsPerHost;
+        _sessions = [NSMutableDictionary dictionary];
+        _hostConnectionLimits = [NSMutableDictionary dictionary];
+        _taskClients = JRNewTaskTable();
+        _oneShots = JRNewTaskTable();
+        _delegateQueue = [[NSOperationQueue alloc] init];
+        _delegateQueue.maxConcurrentOperationCount = 1;
+        _delegateQueue.name = @"com.janrain.JRURLSessionTransport";
+    }
+
+    return self;
+}
+
+- (NSURLSession *)sessionForURL:(NSURL *)url
+{
+    NSString *hostKey = JRTransportHostKey(url);
+
+    @synchronized (self)
+    {
+        NSURLSession *session = [self.sessions objectForKey:hostKey];
+        if (session) return session;
+
+        NSURLSessionConfiguration *configuration = [self.configuration copy];
+        NSNumber *limit = [self.hostConnectionLimits objectForKey:[[url host] lowercaseString]];
+        configuration.HTTPMaximumConnectionsPerHost = limit ? [limit integerValue] :
+                (NSInteger) self.maximumConnectionsPerHost;
+
+        DLog(@"new session for %@, %ld connection(s)", hostKey, (long) configuration.HTTPMaximumConnectionsPerHost);
+        session = [NSURLSession sessionWithConfiguration:configuration delegate:self
+                                           delegateQueue:self.delegateQueue];
+        [self.sessions setObject:session forKey:hostKey];
+
+        return session;
+    }
+}
+
+- (void)setMaximumConnections:(NSUInteger)maximumConnections forHost:(NSString *)host
+{
+    host = [host lowercaseString];
+
+    @synchronized (self)
+    {
+        if (maximumConnections)
+            [self.hostConnectionLimits setObject:@(maximumConnections) forKey:host];
+        else
+            [self.hostConnectionLimits removeObjectForKey:host];
+
+        for (NSString *hostKey in [self.sessions allKeys])
+        {
+            if (![[[NSURL URLWithString:hostKey] host] isEqualToString:host]) continue;
+
+            [[self.sessions objectForKey:hostKey] finishTasksAndInvalidate];
+            [self.sessions removeObjectForKey:hostKey];
+        }
+    }
+}
+
+- (void)invalidateSessions
+{
+    @synchronized (self)
+    {
+        for (NSURLSession *session in [self.sessions allValues])
+            [session finishTasksAndInvalidate];
+
+        [self.sessions removeAllObjects];
+    }
+}
+
+- (id <JRConnectionTransportClient>)clientForTask:(NSURLSessionTask *)task
+{
+    @synchronized (self)
+    {
+        return [self.taskClients objectForKey:task];
+    }
+}
+
+/**
+ * Hops from the session's delegate queue to the main queue and only then looks up the task's client, so a task that
+ * was cancelled on the main thread in the meantime gets no further messages.
+ **/
+- (void)notifyClientOfTask:(NSURLSessionTask *)task usingBlock:(void (^)(id <JRConnectionTransportClient> client))block
+{
+    [[NSOperationQueue mainQueue] addOperationWithBlock:^
+    {
+        id <JRConnectionTransportClient> client = [self clientForTask:task];
+        if (client) block(client);
+    }];
+}
+
+#pragma mark JRConnectionTransport
+
+- (BOOL)canHandleRequest:(NSURLRequest *)request
+{
+    if (![[request URL] host]) return NO;
+
+    for (Class protocolClass in self.configuration.protocolClasses)
+        if ([protocolClass canInitWithRequest:request]) return YES;
+
+    return NO;
+}
+
+- (id)newTaskWithRequest:(NSURLRequest *)request client:(id <JRConnectionTransportClient>)client
+{
+    NSURLSessionDataTask *task = [[self sessionForURL:[request URL]] dataTaskWithRequest:request];
+    if (!task) return nil;
+
+    @synchronized (self)
+    {
+        [self.taskClients setObject:client forKey:task];
+    }
+
+    return task;
+}
+
+- (void)resumeTask:(id)task
+{
+    [(NSURLSessionTask *) task resume];
+}
+
+- (void)cancelTask:(id)task
+{
+    @synchronized (self)
+    {
+        [self.taskClients removeObjectForKey:task];
+    }
+
+    [(NSURLSessionTask *) task cancel];
+}
+
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler
+{
+    [self sendAsynchronousRequest:request queue:queue metrics:nil completionHandler:handler];
+}
+
+/**
+ * One-shot tasks go through the delegate, rather than a completion handler, so the first byte can be timed; their
+ * events are handled on the delegate queue and never reach the main queue.
+ **/
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+                        metrics:(JRRequestMetrics *)metrics
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler
+{
+    NSURLSessionDataTask *task = [[self sessionForURL:[request URL]] dataTaskWithRequest:request];
+
+    /* The session may have been invalidated since it was looked up, by invalidateSessions or a new connection limit */
+    if (!task)
+    {
+        NSDictionary *userInfo = @{ NSLocalizedDescriptionKey : @"Could not create a task for the request" };
+        NSError *error = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorUnknown userInfo:userInfo];
+        [queue addOperationWithBlock:^
+        {
+            handler(nil, nil, error);
+        }];
+        return;
+    }
+
+    JRURLSessionOneShot *oneShot = [[JRURLSessionOneShot alloc] init];
+    oneShot.data = [NSMutableData data];
+    oneShot.metrics = metrics;
+    oneShot.queue = queue;
+    oneShot.handler = handler;
+
+    @synchronized (self)
+    {
+        [self.oneShots setObject:oneShot forKey:task];
+    }
+
+    [task resume];
+}
+
+- (JRURLSessionOneShot *)oneShotForTask:(NSURLSessionTask *)task
+{
+    @synchronized (self)
+    {
+        return [self.oneShots objectForKey:task];
+    }
+}
+
+#pragma mark NSURLSessionDataDelegate
+
+- (void)URLSession:(NSURLSession *)session didBecomeInvalidWithError:(NSError *)error
+{
+    DLog(@"session=%@ error=%@", session, error);
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask
+didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition disposition))completionHandler
+{
+    JRURLSessionOneShot *oneShot = [self oneShotForTask:dataTask];
+    if (oneShot)
+    {
+        oneShot.response = response;
+        [oneShot.metrics recordFirstByte];
+        completionHandler(NSURLSessionResponseAllow);
+        return;
+    }
+
+    [self notifyClientOfTask:dataTask usingBlock:^(id <JRConnectionTransportClient> client)
+    {
+        [client transportTask:dataTask didReceiveResponse:response];
+    }];
+    completionHandler(NSURLSessionResponseAllow);
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data
+{
+    JRURLSessionOneShot *oneShot = [self oneShotForTask:dataTask];
+    if (oneShot)
+    {
+        [oneShot.data appendData:data];
+        return;
+    }
+
+    [self notifyClientOfTask:dataTask usingBlock:^(id <JRConnectionTransportClient> client)
+    {
+        [client transportTask:dataTask didReceiveData:data];
+    }];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task
+willPerformHTTPRedirection:(NSHTTPURLResponse *)response newRequest:(NSURLRequest *)request
+ completionHandler:(void (^)(NSURLRequest *))completionHandler
+{
+    JRURLSessionOneShot *oneShot = [self oneShotForTask:task];
+    if (oneShot)
+    {
+        [oneShot.metrics recordRedirect];
+        completionHandler(request);
+        return;
+    }
+
+    [self notifyClientOfTask:task usingBlock:^(id <JRConnectionTransportClient> client)
+    {
+        [client transportTask:task willSendRequest:request redirectResponse:response];
+    }];
+    completionHandler(request);
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error
+{
+    JRURLSessionOneShot *oneShot = [self oneShotForTask:task];
+    if (oneShot)
+    {
+        @synchronized (self)
+        {
+            [self.oneShots removeObjectForKey:task];
+        }
+
+        NSData *data = error ? nil : oneShot.data;
+        [oneShot.queue addOperationWithBlock:^
+        {
+            oneShot.handler(oneShot.response, data, error);
+        }];
+        return;
+    }
+
+    [self notifyClientOfTask:task usingBlock:^(id <JRConnectionTransportClient> client)
+    {
+        @synchronized (self)
+        {
+            [self.taskClients removeObjectForKey:task];
+        }
+
+        [client transportTask:task didCompleteWithError:error];
+    }];
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask
+ willCacheResponse:(NSCachedURLResponse *)proposedResponse
+ completionHandler:(void (^)(NSCachedURLResponse *cachedResponse))completionHandler
+{
+    completionHandler(proposedResponse);
+}
+@end
+
+
+@interface JRURLConnectionTransport () <NSURLConnectionDataDelegate>
+@property(nonatomic) NSMapTable *connectionClients;
+@end
+
+@implementation JRURLConnectionTransport
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        _connectionClients = JRNewTaskTable();
+    }
+
+    return self;
+}
+
+- (id <JRConnectionTransportClient>)clientForConnection:(NSURLConnection *)connection
+{
+    return [self.connectionClients objectForKey:connection];
+}
+
+#pragma mark JRConnectionTransport
+
+- (BOOL)canHandleRequest:(NSURLRequest *)request
+{
+    return [NSURLConnection canHandleRequest:request];
+}
+
+- (id)newTaskWithRequest:(NSURLRequest *)request client:(id <JRConnectionTransportClient>)client
+{
+    NSURLConnection *connection = [[NSURLConnection alloc] initWithRequest:request delegate:self
+                                                          startImmediately:NO];
+    if (!connection) return nil;
+
+    [self.connectionClients setObject:client forKey:connection];
+    [connection scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+
+    return connection;
+}
+
+- (void)resumeTask:(id)task
+{
+    [(NSURLConnection *) task start];
+}
+
+- (void)cancelTask:(id)task
+{
+    [self.connectionClients removeObjectForKey:task];
+    [(NSURLConnection *) task cancel];
+}
+
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler
+{
+    [NSURLConnection sendAsynchronousRequest:request queue:queue completionHandler:handler];
+}
+
+#pragma mark NSURLConnectionDataDelegate
+
+- (void)connection:(NSURLConnection *)connection didReceiveResponse:(NSURLResponse *)response
+{
+    [[self clientForConnection:connection] transportTask:connection didReceiveResponse:response];
+}
+
+- (void)connection:(NSURLConnection *)connection didReceiveData:(NSData *)data
+{
+    [[self clientForConnection:connection] transportTask:connection didReceiveData:data];
+}
+
+- (NSURLRequest *)connection:(NSURLConnection *)connection willSendRequest:(NSURLRequest *)request
+            redirectResponse:(NSURLResponse *)redirectResponse
+{
+    [[self clientForConnection:connection] transportTask:connection willSendRequest:request
+                                        redirectResponse:redirectResponse];
+    return request;
+}
+
+- (void)connectionDidFinishLoading:(NSURLConnection *)connection
+{
+    id <JRConnectionTransportClient> client = [self clientForConnection:connection];
+    [self.connectionClients removeObjectForKey:connection];
+    [client transportTask:connection didCompleteWithError:nil];
+}
+
+- (void)connection:(NSURLConnection *)connection didFailWithError:(NSError *)error
+{
+    id <JRConnectionTransportClient> client = [self clientForConnection:connection];
+    [self.connectionClients removeObjectForKey:connection];
+    [client transportTask:connection didCompleteWithError:error];
+}
+
+- (NSCachedURLResponse *)connection:(NSURLConnection *)connection
+                  willCacheResponse:(NSCachedURLResponse *)cachedResponse
+{
+    return cachedResponse;
+}
+@end
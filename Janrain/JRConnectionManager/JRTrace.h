@@ -0,0 +1,137 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ * What a span's time went on
+ **/
+typedef enum
+{
+    JRTraceSpanKindUIWait,      /**< Waiting on the user, e.g. while the Engage dialog is up */
+    JRTraceSpanKindNetwork,     /**< From sending a request to having its whole response */
+    JRTraceSpanKindParse,       /**< Turning response bytes into JSON objects */
+    JRTraceSpanKindModelBuild,  /**< Turning JSON objects into model objects, e.g. a JRCaptureUser */
+} JRTraceSpanKind;
+
+/** The kind's category in Chrome trace JSON, e.g. @"ui_wait" **/
+NSString *JRTraceSpanKindName(JRTraceSpanKind kind);
+
+@class JRTrace;
+
+/**
+ * @brief One timed stage of a trace
+ *
+ *  Times are CFAbsoluteTimes. endTime is 0 while the span is open.
+ **/
+@interface JRTraceSpan : NSObject
+@property(nonatomic, readonly) NSString *name;
+@property(nonatomic, readonly) JRTraceSpanKind kind;
+@property(nonatomic, readonly) NSString *traceId;
+@property(nonatomic, readonly) CFAbsoluteTime startTime;
+@property(nonatomic, readonly) CFAbsoluteTime endTime;
+
+/** The thread the span began on **/
+@property(nonatomic, readonly) NSUInteger threadId;
+@property(nonatomic, readonly) NSString *threadName;
+
+/** Only the first call counts; safe from any thread **/
+- (void)end;
+- (BOOL)isOpen;
+- (NSTimeInterval)duration;
+@end
+
+@protocol JRTraceSink <NSObject>
+/** Sent once per trace, on the thread that finished it, after all of its spans have ended **/
+- (void)traceDidFinish:(JRTrace *)trace;
+@end
+
+/**
+ * @brief The spans of one sign-in, from showing the Engage dialog to having a JRCaptureUser, under one trace id
+ *
+ *  Tracing is off until a sink is set with +setSink:. While it's off +beginTraceNamed: and +currentTrace return nil,
+ *  so instrumented code messages nil and costs next to nothing.
+ *
+ *  There is at most one current trace. The stages of a sign-in run one after another across callbacks, so
+ *  instrumented code finds the trace with +currentTrace instead of passing it along. Requests are the exception: other
+ *  requests can be sent while a sign-in is being traced, so the sign-in passes its trace to JRConnectionManager with
+ *  each of its own requests, which get network, parse and model build spans in it.
+ **/
+@interface JRTrace : NSObject
+@property(nonatomic, readonly) NSString *traceId;
+@property(nonatomic, readonly) NSString *name;
+@property(nonatomic, readonly) CFAbsoluteTime startTime;
+@property(nonatomic, readonly) CFAbsoluteTime endTime;
+
+/** nil if the traced flow succeeded **/
+@property(nonatomic, readonly) NSError *error;
+
+/** In the order they began **/
+- (NSArray *)spans;
+
++ (void)setSink:(id <JRTraceSink>)sink;
++ (id <JRTraceSink>)sink;
+
+/**
+ * Begins a trace and makes it the current trace. A trace that is still current is finished first, with an
+ * NSUserCancelledError. Returns nil if there's no sink.
+ **/
++ (JRTrace *)beginTraceNamed:(NSString *)name;
++ (JRTrace *)currentTrace;
+
+/** Returns nil once the trace has finished **/
+- (JRTraceSpan *)beginSpanNamed:(NSString *)name kind:(JRTraceSpanKind)kind;
+
+/** Ends the open spans of the kind, e.g. all UI waits once the user has acted **/
+- (void)endSpansOfKind:(JRTraceSpanKind)kind;
+
+/**
+ * Ends the open spans, stops the trace being current and hands it to the sink. Only the first call counts.
+ **/
+- (void)finishWithError:(NSError *)error;
+@end
+
+/**
+ * @brief Writes each trace to <directory>/<trace name>-<trace id>.json as Chrome trace JSON
+ *
+ *  Load the files in chrome://tracing or Perfetto. There's a lane per thread the spans began on, and one for the
+ *  whole trace. Files are written on a background queue.
+ **/
+@interface JRChromeTraceFileSink : NSObject <JRTraceSink>
+@property(nonatomic, readonly) NSString *directory;
+
+- (id)initWithDirectory:(NSString *)directory;
+
+/**
+ * Chrome's "JSON Object Format": complete ("X") events in microseconds from the start of the trace, each with the
+ * trace id in its args, and thread name metadata events
+ **/
++ (NSData *)chromeTraceJSONDataForTrace:(JRTrace *)trace;
+@end
@@ -0,0 +1,298 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#import <pthread.h>
+#import "JRTrace.h"
+
+NSString *JRTraceSpanKindName(JRTraceSpanKind kind)
+{
+    switch (kind)
+    {
+        case JRTraceSpanKindUIWait:
+            return @"ui_wait";
+        case JRTraceSpanKindNetwork:
+            return @"network";
+        case JRTraceSpanKindParse:
+            return @"parse";
+        case JRTraceSpanKindModelBuild:
+            return @"model_build";
+        default:
+            return @"other";
+    }
+}
+
+static NSString *JRCurrentThreadName()
+{
+    if ([NSThread isMainThread]) return @"main";
+
+    const char *label = dispatch_queue_get_label(DISPATCH_CURRENT_QUEUE_LABEL);
+    if (label && *label) return [NSString stringWithUTF8String:label];
+
+    return [NSString stringWithFormat:@"thread %u", pthread_mach_thread_np(pthread_self())];
+}
+
+@interface JRTraceSpan ()
+- (id)initWithName:(NSString *)name kind:(JRTraceSpanKind)kind traceId:(NSString *)traceId;
+@end
+
+@implementation JRTraceSpan
+
+- (id)initWithName:(NSString *)name kind:(JRTraceSpanKind)kind traceId:(NSString *)traceId
+{
+    if ((self = [super init]))
+    {
+        _name = [name copy];
+        _kind = kind;
+        _traceId = traceId;
+        _threadId = pthread_mach_thread_np(pthread_self());
+        _threadName = JRCurrentThreadName();
+        _startTime = CFAbsoluteTimeGetCurrent();
+    }
+
+    return self;
+}
+
+- (void)end
+{
+    @synchronized (self)
+    {
+        if (!_endTime) _endTime = CFAbsoluteTimeGetCurrent();
+    }
+}
+
+- (BOOL)isOpen
+{
+    @synchronized (self)
+    {
+        return !_endTime;
+    }
+}
+
+- (NSTimeInterval)duration
+{
+    @synchronized (self)
+    {
+        return (_endTime ? _endTime : CFAbsoluteTimeGetCurrent()) - _startTime;
+    }
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %@ %@ %.1fms%@>", NSStringFromClass([self class]),
+                                      JRTraceSpanKindName(_kind), _name, [self duration] * 1000,
+                                      [self isOpen] ? @" (open)" : @""];
+}
+@end
+
+static id <JRTraceSink> traceSink = nil;
+static JRTrace *currentTrace = nil;
+
+@implementation JRTrace
+{
+    NSMutableArray *_spans;
+}
+
+- (id)initWithName:(NSString *)name
+{
+    if ((self = [super init]))
+    {
+        _name = [name copy];
+        _traceId = [[NSUUID UUID] UUIDString];
+        _startTime = CFAbsoluteTimeGetCurrent();
+        _spans = [NSMutableArray array];
+    }
+
+    return self;
+}
+
++ (void)setSink:(id <JRTraceSink>)sink
+{
+    @synchronized (self)
+    {
+        traceSink = sink;
+    }
+}
+
++ (id <JRTraceSink>)sink
+{
+    @synchronized (self)
+    {
+        return traceSink;
+    }
+}
+
++ (JRTrace *)beginTraceNamed:(NSString *)name
+{
+    JRTrace *trace, *superseded;
+    @synchronized (self)
+    {
+        if (!traceSink) return nil;
+
+        trace = [[JRTrace alloc] initWithName:name];
+        superseded = currentTrace;
+        currentTrace = trace;
+    }
+
+    [superseded finishWithError:[NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError
+                                                userInfo:nil]];
+    return trace;
+}
+
++ (JRTrace *)currentTrace
+{
+    @synchronized (self)
+    {
+        return currentTrace;
+    }
+}
+
+- (NSArray *)spans
+{
+    @synchronized (self)
+    {
+        return [NSArray arrayWithArray:_spans];
+    }
+}
+
+- (JRTraceSpan *)beginSpanNamed:(NSString *)name kind:(JRTraceSpanKind)kind
+{
+    JRTraceSpan *span = [[JRTraceSpan alloc] initWithName:name kind:kind traceId:_traceId];
+    @synchronized (self)
+    {
+        if (_endTime) return nil;
+        [_spans addObject:span];
+    }
+
+    return span;
+}
+
+- (void)endSpansOfKind:(JRTraceSpanKind)kind
+{
+    for (JRTraceSpan *span in [self spans])
+        if (span.kind == kind) [span end];
+}
+
+- (void)finishWithError:(NSError *)error
+{
+    @synchronized (self)
+    {
+        if (_endTime) return;
+        _endTime = CFAbsoluteTimeGetCurrent();
+        _error = error;
+    }
+
+    [[self spans] makeObjectsPerformSelector:@selector(end)];
+
+    @synchronized ([JRTrace class])
+    {
+        if (currentTrace == self) currentTrace = nil;
+    }
+
+    [[JRTrace sink] traceDidFinish:self];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %@ %@ %@>", NSStringFromClass([self class]), _name, _traceId,
+                                      [self spans]];
+}
+@end
+
+@implementation JRChromeTraceFileSink
+{
+    dispatch_queue_t _writeQueue;
+}
+
+- (id)initWithDirectory:(NSString *)directory
+{
+    if ((self = [super init]))
+    {
+        _directory = [directory copy];
+        _writeQueue = dispatch_queue_create("com.janrain.trace.write", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
+static NSNumber *JRTraceMicroseconds(CFTimeInterval interval)
+{
+    return [NSNumber numberWithDouble:round(interval * 1000000)];
+}
+
++ (NSData *)chromeTraceJSONDataForTrace:(JRTrace *)trace
+{
+    NSNumber *pid = [NSNumber numberWithInt:[[NSProcessInfo processInfo] processIdentifier]];
+    NSMutableArray *events = [NSMutableArray array];
+    NSMutableDictionary *threadNames = [NSMutableDictionary dictionary];
+
+    NSMutableDictionary *traceArgs = [NSMutableDictionary dictionaryWithObject:trace.traceId forKey:@"trace_id"];
+    if (trace.error) [traceArgs setObject:[trace.error description] forKey:@"error"];
+
+    [events addObject:@{@"name" : trace.name, @"cat" : @"trace", @"ph" : @"X", @"pid" : pid, @"tid" : @0,
+                        @"ts" : @0, @"dur" : JRTraceMicroseconds(trace.endTime - trace.startTime),
+                        @"args" : traceArgs}];
+    [threadNames setObject:[NSString stringWithFormat:@"trace %@", trace.name] forKey:@0];
+
+    for (JRTraceSpan *span in [trace spans])
+    {
+        NSNumber *tid = [NSNumber numberWithUnsignedInteger:span.threadId];
+        [events addObject:@{@"name" : span.name, @"cat" : JRTraceSpanKindName(span.kind), @"ph" : @"X",
+                            @"pid" : pid, @"tid" : tid, @"ts" : JRTraceMicroseconds(span.startTime - trace.startTime),
+                            @"dur" : JRTraceMicroseconds([span duration]), @"args" : @{@"trace_id" : span.traceId}}];
+        if (![threadNames objectForKey:tid]) [threadNames setObject:span.threadName forKey:tid];
+    }
+
+    for (NSNumber *tid in threadNames)
+        [events addObject:@{@"name" : @"thread_name", @"ph" : @"M", @"pid" : pid, @"tid" : tid,
+                            @"args" : @{@"name" : [threadNames objectForKey:tid]}}];
+
+    NSDictionary *chromeTrace = @{@"traceEvents" : events, @"displayTimeUnit" : @"ms",
+                                  @"otherData" : @{@"trace_id" : trace.traceId}};
+
+    return [NSJSONSerialization dataWithJSONObject:chromeTrace options:(NSJSONWritingOptions) 0 error:nil];
+}
+
+- (NSString *)pathForTrace:(JRTrace *)trace
+{
+    NSString *fileName = [NSString stringWithFormat:@"%@-%@.json", trace.name, trace.traceId];
+    return [_directory stringByAppendingPathComponent:fileName];
+}
+
+- (void)traceDidFinish:(JRTrace *)trace
+{
+    dispatch_async(_writeQueue, ^
+    {
+        [[NSFileManager defaultManager] createDirectoryAtPath:_directory withIntermediateDirectories:YES
+                                                   attributes:nil error:nil];
+        [[JRChromeTraceFileSink chromeTraceJSONDataForTrace:trace] writeToFile:[self pathForTrace:trace]
+                                                                    atomically:YES];
+    });
+}
+@end
@@ -38,6 +38,10 @@
 - (id)JR_objectFromJSONString;
 @end
 
+@interface NSData (JRJsonUtils)
+- (id)JR_objectFromJSONData;
+@end
+
 @interface NSDictionary (JRJsonUtils)
 - (NSString *)JR_jsonString;
 - (BOOL)JR_isOKStatus;
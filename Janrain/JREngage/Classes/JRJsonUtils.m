@@ -63,6 +63,13 @@
 }
 @end
 
+@implementation NSData (JRJsonUtils)
+- (id)JR_objectFromJSONData
+{
+    return [JRJsonUtils jsonObjectWithData:self];
+}
+@end
+
 @implementation NSDictionary (JRJsonUtils)
 - (NSString *)JR_jsonString
 {
@@ -32,12 +32,15 @@
  Date:   Tuesday, June 1, 2010
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#define JR_LOG_CATEGORY JRLogCategoryEngage
+
 #import "debug_log.h"
 #import "JRSessionData.h"
 #import "JREngageError.h"
 #import "JRUserInterfaceMaestro.h"
 #import "JREngage+CustomInterface.h"
 #import "JRJsonUtils.h"
+#import "JRTrace.h"
 
 static NSString *serverUrl = @"https://rpxnow.com";
 
@@ -1172,8 +1175,8 @@ static JRSessionData *singleton = nil;
                                               activity, @"activity",
                                               currentProvider.name, @"providerName", nil];
 
-    ALog ("Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
-    [NSString stringWithCString:body.bytes encoding:NSUTF8StringEncoding]);
+    DLog(@"Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
+         [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding]);
 
     if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
     {
@@ -1212,8 +1215,8 @@ static JRSessionData *singleton = nil;
                                               activity, @"activity",
                                               currentProvider.name, @"providerName", nil];
 
-    ALog ("Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
-    [NSString stringWithCString:body.bytes encoding:NSUTF8StringEncoding]);
+    DLog(@"Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
+         [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding]);
 
     if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
     {
@@ -1514,12 +1517,16 @@ static JRSessionData *singleton = nil;
     [request setHTTPMethod:@"POST"];
     [request setHTTPBody:body];
 
+    /* The span is the tag's last entry, as it's nil when no sign-in is being traced */
+    JRTraceSpan *span = [[JRTrace currentTrace] beginSpanNamed:@"token_url" kind:JRTraceSpanKindNetwork];
     NSDictionary *tag = [NSDictionary dictionaryWithObjectsAndKeys:_tokenUrl, @"tokenUrl",
                                                                    providerName, @"providerName",
-                                                                   @"callTokenUrl", @"action", nil];
+                                                                   @"callTokenUrl", @"action",
+                                                                   span, @"traceSpan", nil];
 
     if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:YES withTag:tag])
     {
+        [span end];
         NSError *_error = [JREngageError errorWithMessage:@"Problem initializing the connection to the token url"
                                                   andCode:JRAuthenticationTokenUrlFailedError];
 
@@ -1557,6 +1564,7 @@ static JRSessionData *singleton = nil;
 
         if ([action isEqualToString:@"callTokenUrl"])
         {
+            [[(NSDictionary *)tag objectForKey:@"traceSpan"] end];
             [self finishMakeCallToTokenUrl:[(NSDictionary *)tag objectForKey:@"tokenUrl"]
                               withResponse:fullResponse
                                 andPayload:payload
@@ -1658,6 +1666,7 @@ static JRSessionData *singleton = nil;
 
         if ([action isEqualToString:@"callTokenUrl"])
         {
+            [[(NSDictionary *)tag objectForKey:@"traceSpan"] end];
             NSArray *delegatesCopy = [NSArray arrayWithArray:delegates];
             for (id<JRSessionDelegate> delegate in delegatesCopy)
             {
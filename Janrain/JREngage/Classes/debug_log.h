@@ -30,27 +30,95 @@
 
 #import <Foundation/Foundation.h>
 
-#ifndef DLog
+/**
+ * Log levels, lowest first. A message is written when its level is at or above both the compile-time threshold,
+ * JR_LOG_COMPILED_LEVEL, and its category's run-time threshold, JRLogSetLevel.
+ **/
+typedef enum
+{
+    JRLogLevelDebug,
+    JRLogLevelInfo,
+    JRLogLevelWarning,
+    JRLogLevelError,
+    JRLogLevelOff,
+} JRLogLevel;
+
+typedef enum
+{
+    JRLogCategoryGeneral,
+    JRLogCategoryNetwork,
+    JRLogCategoryCapture,
+    JRLogCategoryEngage,
+    JRLogCategoryCount,
+} JRLogCategory;
+
+/**
+ * Messages below this level are compiled out altogether. Debug builds keep everything, release builds keep warnings
+ * and errors, and release builds with JR_NO_RELEASE_LOGGING keep nothing.
+ **/
+#ifndef JR_LOG_COMPILED_LEVEL
   #ifdef DEBUG
-    #define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+    #define JR_LOG_COMPILED_LEVEL JRLogLevelDebug
+  #elif defined(JR_NO_RELEASE_LOGGING)
+    #define JR_LOG_COMPILED_LEVEL JRLogLevelOff
   #else
-    #define DLog(fmt, ...) JRLogExpressionSink((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+    #define JR_LOG_COMPILED_LEVEL JRLogLevelWarning
   #endif
 #endif
 
+/** The category DLog and ALog write to; define it before importing this header to change it for a file **/
+#ifndef JR_LOG_CATEGORY
+  #define JR_LOG_CATEGORY JRLogCategoryGeneral
+#endif
+
+extern volatile JRLogLevel JRLogLevels[JRLogCategoryCount];
+
+#define JRLogEnabled(category, level) ((level) >= JR_LOG_COMPILED_LEVEL && (level) >= JRLogLevels[(category)])
+
+/**
+ * The arguments are only evaluated, and the message only formatted, when the message will be written. Formatting
+ * happens on the calling thread; writing the message out happens later, on a background queue, except for errors,
+ * which have reached the sink, after everything logged before them, by the time JRLog returns.
+ **/
+#define JRLog(category, level, fmt, ...) \
+    do \
+    { \
+        if (JRLogEnabled(category, level)) \
+            JRLogWrite(category, level, __PRETTY_FUNCTION__, __LINE__, (@"" fmt), ##__VA_ARGS__); \
+    } while (0)
+
+#ifndef DLog
+  #define DLog(fmt, ...) JRLog(JR_LOG_CATEGORY, JRLogLevelDebug, fmt, ##__VA_ARGS__)
+#endif
+
 #ifndef ALog
-  #ifdef DEBUG
-    #define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
-  #else
-    #ifdef JR_NO_RELEASE_LOGGING
-      #define ALog(fmt, ...) JRLogExpressionSink((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
-    #else
-      #define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
-    #endif
-  #endif
+  #define ALog(fmt, ...) JRLog(JR_LOG_CATEGORY, JRLogLevelError, fmt, ##__VA_ARGS__)
 #endif
 
-void JRLogExpressionSink(NSString *format, ...);
+typedef struct
+{
+    CFAbsoluteTime time;
+    JRLogLevel level;
+    JRLogCategory category;
+    const char *function;
+    int line;
+    __unsafe_unretained NSString *message;
+} JRLogEntry;
+
+/** Receives each written message on the logging queue, in order; NULL restores the default, which is NSLog **/
+typedef void (^JRLogSink)(const JRLogEntry *entry);
+
+void JRLogSetLevel(JRLogCategory category, JRLogLevel level);
+void JRLogSetSink(JRLogSink sink);
+
+/** Waits until every message written so far has reached the sink **/
+void JRLogFlush(void);
+
+/** How many messages were dropped because the buffer was full when they were written **/
+uint64_t JRLogDroppedCount(void);
+
+void JRLogWrite(JRLogCategory category, JRLogLevel level, const char *function, int line, NSString *format, ...)
+        NS_FORMAT_FUNCTION(5, 6);
 
 @interface NSException (JR_raiseDebugException)
 + (void)raiseJRDebugException:(NSString *)name format:(NSString *)format, ...;
@@ -30,16 +30,172 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #include "debug_log.h"
+#include <stdatomic.h>
 
-// UPS-2039
-void JRLogExpressionSink(NSString *format, ...)
+/* Must be a power of two */
+#define JR_LOG_BUFFER_SIZE 1024
+
+/*
+ * Writers on any thread claim a slot in the ring buffer with a compare-and-swap on the write index, fill it in, and
+ * publish it by moving the slot's sequence on; the logging queue, the only reader, takes published slots in order and
+ * hands them to the sink. A slot's sequence is its index when it's free to be written, its index + 1 when it holds a
+ * message, and its index + JR_LOG_BUFFER_SIZE once it's been read. Nothing waits: when the reader has fallen a whole
+ * buffer behind, new messages are dropped and counted.
+ *
+ * Errors don't go through the buffer. They're the only messages release builds keep, and often the last ones before a
+ * crash, so the writer drains the buffer and hands the error to the sink on the logging queue before returning.
+ */
+typedef struct
+{
+    atomic_uint_fast64_t sequence;
+    JRLogEntry entry;
+    CFTypeRef message;
+} JRLogSlot;
+
+volatile JRLogLevel JRLogLevels[JRLogCategoryCount] = { [0 ... JRLogCategoryCount - 1] = JR_LOG_COMPILED_LEVEL };
+
+static JRLogSlot JRLogBuffer[JR_LOG_BUFFER_SIZE];
+static atomic_uint_fast64_t JRLogWriteIndex;
+static atomic_uint_fast64_t JRLogDropped;
+static atomic_bool JRLogDrainScheduled;
+
+/* Only touched on the logging queue */
+static uint_fast64_t JRLogReadIndex;
+static JRLogSink JRLogCurrentSink;
+static char JRLogQueueKey;
+
+static dispatch_queue_t JRLogQueue(void)
+{
+    static dispatch_queue_t queue;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        for (uint_fast64_t i = 0; i < JR_LOG_BUFFER_SIZE; i++) atomic_init(&JRLogBuffer[i].sequence, i);
+        queue = dispatch_queue_create("com.janrain.log", DISPATCH_QUEUE_SERIAL);
+        dispatch_queue_set_specific(queue, &JRLogQueueKey, &JRLogQueueKey, NULL);
+        dispatch_set_target_queue(queue, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0));
+    });
+    return queue;
+}
+
+static void JRLogEmit(const JRLogEntry *entry)
+{
+    if (JRLogCurrentSink)
+        JRLogCurrentSink(entry);
+    else
+        NSLog(@"%s [Line %d] %@", entry->function, entry->line, entry->message);
+}
+
+static void JRLogDrain(void)
+{
+    /* Cleared before reading, so a message published after the last slot read here schedules another drain */
+    atomic_store(&JRLogDrainScheduled, false);
+
+    for (;;)
+    {
+        JRLogSlot *slot = &JRLogBuffer[JRLogReadIndex & (JR_LOG_BUFFER_SIZE - 1)];
+        if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != JRLogReadIndex + 1) break;
+
+        JRLogEntry entry = slot->entry;
+        NSString *message = CFBridgingRelease(slot->message);
+        entry.message = message;
+        atomic_store_explicit(&slot->sequence, JRLogReadIndex + JR_LOG_BUFFER_SIZE, memory_order_release);
+        JRLogReadIndex++;
+
+        JRLogEmit(&entry);
+    }
+}
+
+void JRLogWrite(JRLogCategory category, JRLogLevel level, const char *function, int line, NSString *format, ...)
 {
     va_list va;
     va_start(va, format);
-    NSString *string = [[NSString alloc] initWithFormat:format arguments:va];
+    NSString *message = [[NSString alloc] initWithFormat:format arguments:va];
     va_end(va);
-    NSString *description = [string description];
-    #pragma unused (description)
+
+    dispatch_queue_t queue = JRLogQueue();
+    if (level >= JRLogLevelError)
+    {
+        CFAbsoluteTime time = CFAbsoluteTimeGetCurrent();
+        void (^emit)(void) = ^
+        {
+            JRLogEntry entry = { time, level, category, function, line, message };
+            JRLogEmit(&entry);
+        };
+
+        /* A sink that logs an error is already on the logging queue, in the middle of a drain */
+        if (dispatch_get_specific(&JRLogQueueKey))
+            emit();
+        else
+            dispatch_sync(queue, ^
+            {
+                JRLogDrain();
+                emit();
+            });
+
+        return;
+    }
+
+    uint_fast64_t ticket = atomic_load_explicit(&JRLogWriteIndex, memory_order_relaxed);
+    JRLogSlot *slot;
+    for (;;)
+    {
+        slot = &JRLogBuffer[ticket & (JR_LOG_BUFFER_SIZE - 1)];
+        uint_fast64_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        if (sequence == ticket)
+        {
+            if (atomic_compare_exchange_weak_explicit(&JRLogWriteIndex, &ticket, ticket + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
+        }
+        else if (sequence < ticket)
+        {
+            atomic_fetch_add_explicit(&JRLogDropped, 1, memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            ticket = atomic_load_explicit(&JRLogWriteIndex, memory_order_relaxed);
+        }
+    }
+
+    slot->entry = (JRLogEntry) { CFAbsoluteTimeGetCurrent(), level, category, function, line, nil };
+    slot->message = CFBridgingRetain(message);
+    atomic_store_explicit(&slot->sequence, ticket + 1, memory_order_release);
+
+    if (!atomic_exchange(&JRLogDrainScheduled, true))
+        dispatch_async(queue, ^
+        {
+            JRLogDrain();
+        });
+}
+
+void JRLogSetLevel(JRLogCategory category, JRLogLevel level)
+{
+    JRLogLevels[category] = level;
+}
+
+void JRLogSetSink(JRLogSink sink)
+{
+    sink = [sink copy];
+    dispatch_async(JRLogQueue(), ^
+    {
+        JRLogDrain();
+        JRLogCurrentSink = sink;
+    });
+}
+
+void JRLogFlush(void)
+{
+    dispatch_sync(JRLogQueue(), ^
+    {
+        JRLogDrain();
+    });
+}
+
+uint64_t JRLogDroppedCount(void)
+{
+    return atomic_load_explicit(&JRLogDropped, memory_order_relaxed);
 }
 
 @implementation NSException (JR_raiseDebugException)
@@ -40,6 +40,39 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRAddressesElement.h"
 
+enum
+{
+    JRAddressesElementCountryProperty,
+    JRAddressesElementExtendedAddressProperty,
+    JRAddressesElementFormattedProperty,
+    JRAddressesElementLatitudeProperty,
+    JRAddressesElementLocalityProperty,
+    JRAddressesElementLongitudeProperty,
+    JRAddressesElementPoBoxProperty,
+    JRAddressesElementPostalCodeProperty,
+    JRAddressesElementPrimaryProperty,
+    JRAddressesElementRegionProperty,
+    JRAddressesElementStreetAddressProperty,
+    JRAddressesElementTypeProperty,
+    JRAddressesElementPropertyCount
+};
+
+static const char *const JRAddressesElementPropertyNames[] =
+{
+    "country",
+    "extendedAddress",
+    "formatted",
+    "latitude",
+    "locality",
+    "longitude",
+    "poBox",
+    "postalCode",
+    "primary",
+    "region",
+    "streetAddress",
+    "type",
+};
+
 @interface JRAddressesElement ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -61,6 +94,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRAddressesElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRAddressesElementPropertyCount;
+}
+
 - (NSString *)country
 {
     return _country;
@@ -68,7 +111,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
-    [self.dirtyPropertySet addObject:@"country"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementCountryProperty);
 
     _country = [newCountry copy];
 }
@@ -80,7 +123,7 @@
 
 - (void)setExtendedAddress:(NSString *)newExtendedAddress
 {
-    [self.dirtyPropertySet addObject:@"extendedAddress"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementExtendedAddressProperty);
 
     _extendedAddress = [newExtendedAddress copy];
 }
@@ -92,7 +135,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
-    [self.dirtyPropertySet addObject:@"formatted"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementFormattedProperty);
 
     _formatted = [newFormatted copy];
 }
@@ -104,7 +147,7 @@
 
 - (void)setLatitude:(JRDecimal *)newLatitude
 {
-    [self.dirtyPropertySet addObject:@"latitude"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLatitudeProperty);
 
     _latitude = [newLatitude copy];
 }
@@ -116,7 +159,7 @@
 
 - (void)setLocality:(NSString *)newLocality
 {
-    [self.dirtyPropertySet addObject:@"locality"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLocalityProperty);
 
     _locality = [newLocality copy];
 }
@@ -128,7 +171,7 @@
 
 - (void)setLongitude:(JRDecimal *)newLongitude
 {
-    [self.dirtyPropertySet addObject:@"longitude"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLongitudeProperty);
 
     _longitude = [newLongitude copy];
 }
@@ -140,7 +183,7 @@
 
 - (void)setPoBox:(NSString *)newPoBox
 {
-    [self.dirtyPropertySet addObject:@"poBox"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPoBoxProperty);
 
     _poBox = [newPoBox copy];
 }
@@ -152,7 +195,7 @@
 
 - (void)setPostalCode:(NSString *)newPostalCode
 {
-    [self.dirtyPropertySet addObject:@"postalCode"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPostalCodeProperty);
 
     _postalCode = [newPostalCode copy];
 }
@@ -164,7 +207,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPrimaryProperty);
 
     _primary = [newPrimary copy];
 }
@@ -176,7 +219,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPrimaryProperty);
 
     _primary = [NSNumber numberWithBool:boolVal];
 }
@@ -188,7 +231,7 @@
 
 - (void)setRegion:(NSString *)newRegion
 {
-    [self.dirtyPropertySet addObject:@"region"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementRegionProperty);
 
     _region = [newRegion copy];
 }
@@ -200,7 +243,7 @@
 
 - (void)setStreetAddress:(NSString *)newStreetAddress
 {
-    [self.dirtyPropertySet addObject:@"streetAddress"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementStreetAddressProperty);
 
     _streetAddress = [newStreetAddress copy];
 }
@@ -212,7 +255,7 @@
 
 - (void)setType:(NSString *)newType
 {
-    [self.dirtyPropertySet addObject:@"type"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAddressesElementTypeProperty);
 
     _type = [newType copy];
 }
@@ -225,7 +268,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -360,11 +403,228 @@
     return [JRAddressesElement addressesElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)addressesElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRAddressesElement *addressesElement = [JRAddressesElement addressesElement];
+    NSInteger elementId = 0;
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    addressesElement.primary = [NSNumber numberWithBool:NO];
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 63)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                addressesElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "latitude")) break;
+                value = [reader readValue];
+                addressesElement.latitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "poBox")) break;
+                value = [reader readValue];
+                addressesElement.poBox = value != [NSNull null] ? value : nil;
+                continue;
+            case 8:
+                if (!JRJsonKeyEquals(key, keyLength, "region")) break;
+                value = [reader readValue];
+                addressesElement.region = value != [NSNull null] ? value : nil;
+                continue;
+            case 9:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                addressesElement.type = value != [NSNull null] ? value : nil;
+                continue;
+            case 16:
+                if (!JRJsonKeyEquals(key, keyLength, "formatted")) break;
+                value = [reader readValue];
+                addressesElement.formatted = value != [NSNull null] ? value : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "streetAddress")) break;
+                value = [reader readValue];
+                addressesElement.streetAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "postalCode")) break;
+                value = [reader readValue];
+                addressesElement.postalCode = value != [NSNull null] ? value : nil;
+                continue;
+            case 27:
+                if (!JRJsonKeyEquals(key, keyLength, "extendedAddress")) break;
+                value = [reader readValue];
+                addressesElement.extendedAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 33:
+                if (!JRJsonKeyEquals(key, keyLength, "longitude")) break;
+                value = [reader readValue];
+                addressesElement.longitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 49:
+                if (!JRJsonKeyEquals(key, keyLength, "locality")) break;
+                value = [reader readValue];
+                addressesElement.locality = value != [NSNull null] ? value : nil;
+                continue;
+            case 54:
+                if (!JRJsonKeyEquals(key, keyLength, "country")) break;
+                value = [reader readValue];
+                addressesElement.country = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    addressesElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"addresses", (long)elementId];
+    addressesElement.canBeUpdatedOnCapture = YES;
+
+    [addressesElement.dirtyPropertySet removeAllObjects];
+
+    return addressesElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"country"];
+    [writer writeValue:self.country];
+    [writer writeKey:@"extendedAddress"];
+    [writer writeValue:self.extendedAddress];
+    [writer writeKey:@"formatted"];
+    [writer writeValue:self.formatted];
+    [writer writeKey:@"latitude"];
+    [writer writeValue:self.latitude];
+    [writer writeKey:@"locality"];
+    [writer writeValue:self.locality];
+    [writer writeKey:@"longitude"];
+    [writer writeValue:self.longitude];
+    [writer writeKey:@"poBox"];
+    [writer writeValue:self.poBox];
+    [writer writeKey:@"postalCode"];
+    [writer writeValue:self.postalCode];
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    [writer writeKey:@"region"];
+    [writer writeValue:self.region];
+    [writer writeKey:@"streetAddress"];
+    [writer writeValue:self.streetAddress];
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+    [writer endObject];
+}
+
++ (id)addressesElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRAddressesElement *addressesElement = [JRAddressesElement addressesElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    addressesElement.captureObjectPath = [reader readString];
+    addressesElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 31)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "extendedAddress")) break;
+                value = [reader readValue];
+                addressesElement.extendedAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "formatted")) break;
+                value = [reader readValue];
+                addressesElement.formatted = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "latitude")) break;
+                value = [reader readValue];
+                addressesElement.latitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 9:
+                if (!JRJsonKeyEquals(key, keyLength, "poBox")) break;
+                value = [reader readValue];
+                addressesElement.poBox = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                addressesElement.type = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "longitude")) break;
+                value = [reader readValue];
+                addressesElement.longitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "country")) break;
+                value = [reader readValue];
+                addressesElement.country = value != [NSNull null] ? value : nil;
+                continue;
+            case 20:
+                if (!JRJsonKeyEquals(key, keyLength, "locality")) break;
+                value = [reader readValue];
+                addressesElement.locality = value != [NSNull null] ? value : nil;
+                continue;
+            case 22:
+                if (!JRJsonKeyEquals(key, keyLength, "streetAddress")) break;
+                value = [reader readValue];
+                addressesElement.streetAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 23:
+                if (!JRJsonKeyEquals(key, keyLength, "postalCode")) break;
+                value = [reader readValue];
+                addressesElement.postalCode = value != [NSNull null] ? value : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                addressesElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 29:
+                if (!JRJsonKeyEquals(key, keyLength, "region")) break;
+                value = [reader readValue];
+                addressesElement.region = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [addressesElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return addressesElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRAddressesElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"addresses", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -417,7 +677,7 @@
         [dictionary objectForKey:@"type"] != [NSNull null] ? 
         [dictionary objectForKey:@"type"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -425,18 +685,12 @@
     return [NSSet setWithObjects:@"country", @"extendedAddress", @"formatted", @"latitude", @"locality", @"longitude", @"poBox", @"postalCode", @"primary", @"region", @"streetAddress", @"type", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"addressesElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"addressesElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -444,7 +698,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"addressesElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"addressesElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"addressesElement"]];
 
 }
 
@@ -453,40 +707,40 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"country"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementCountryProperty))
         [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
 
-    if ([self.dirtyPropertySet containsObject:@"extendedAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementExtendedAddressProperty))
         [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
 
-    if ([self.dirtyPropertySet containsObject:@"formatted"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementFormattedProperty))
         [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
 
-    if ([self.dirtyPropertySet containsObject:@"latitude"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLatitudeProperty))
         [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
 
-    if ([self.dirtyPropertySet containsObject:@"locality"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLocalityProperty))
         [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
 
-    if ([self.dirtyPropertySet containsObject:@"longitude"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLongitudeProperty))
         [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
 
-    if ([self.dirtyPropertySet containsObject:@"poBox"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPoBoxProperty))
         [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
 
-    if ([self.dirtyPropertySet containsObject:@"postalCode"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPostalCodeProperty))
         [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
 
-    if ([self.dirtyPropertySet containsObject:@"primary"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPrimaryProperty))
         [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
-    if ([self.dirtyPropertySet containsObject:@"region"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementRegionProperty))
         [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
 
-    if ([self.dirtyPropertySet containsObject:@"streetAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementStreetAddressProperty))
         [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
 
-    if ([self.dirtyPropertySet containsObject:@"type"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementTypeProperty))
         [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -520,6 +774,130 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementCountryProperty))
+    {
+        [writer writeKey:@"country"];
+        [writer writeValue:self.country];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementExtendedAddressProperty))
+    {
+        [writer writeKey:@"extendedAddress"];
+        [writer writeValue:self.extendedAddress];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementFormattedProperty))
+    {
+        [writer writeKey:@"formatted"];
+        [writer writeValue:self.formatted];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLatitudeProperty))
+    {
+        [writer writeKey:@"latitude"];
+        [writer writeValue:self.latitude];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLocalityProperty))
+    {
+        [writer writeKey:@"locality"];
+        [writer writeValue:self.locality];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLongitudeProperty))
+    {
+        [writer writeKey:@"longitude"];
+        [writer writeValue:self.longitude];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPoBoxProperty))
+    {
+        [writer writeKey:@"poBox"];
+        [writer writeValue:self.poBox];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPostalCodeProperty))
+    {
+        [writer writeKey:@"postalCode"];
+        [writer writeValue:self.postalCode];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPrimaryProperty))
+    {
+        [writer writeKey:@"primary"];
+        [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementRegionProperty))
+    {
+        [writer writeKey:@"region"];
+        [writer writeValue:self.region];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementStreetAddressProperty))
+    {
+        [writer writeKey:@"streetAddress"];
+        [writer writeValue:self.streetAddress];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementTypeProperty))
+    {
+        [writer writeKey:@"type"];
+        [writer writeValue:self.type];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"country"];
+    [writer writeValue:self.country];
+
+    [writer writeKey:@"extendedAddress"];
+    [writer writeValue:self.extendedAddress];
+
+    [writer writeKey:@"formatted"];
+    [writer writeValue:self.formatted];
+
+    [writer writeKey:@"latitude"];
+    [writer writeValue:self.latitude];
+
+    [writer writeKey:@"locality"];
+    [writer writeValue:self.locality];
+
+    [writer writeKey:@"longitude"];
+    [writer writeValue:self.longitude];
+
+    [writer writeKey:@"poBox"];
+    [writer writeValue:self.poBox];
+
+    [writer writeKey:@"postalCode"];
+    [writer writeValue:self.postalCode];
+
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+
+    [writer writeKey:@"region"];
+    [writer writeValue:self.region];
+
+    [writer writeKey:@"streetAddress"];
+    [writer writeValue:self.streetAddress];
+
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -528,6 +906,33 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementCountryProperty))
+        JRValidateCaptureAttribute(self.country, @"country", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementExtendedAddressProperty))
+        JRValidateCaptureAttribute(self.extendedAddress, @"extendedAddress", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementLocalityProperty))
+        JRValidateCaptureAttribute(self.locality, @"locality", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPoBoxProperty))
+        JRValidateCaptureAttribute(self.poBox, @"poBox", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementPostalCodeProperty))
+        JRValidateCaptureAttribute(self.postalCode, @"postalCode", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementRegionProperty))
+        JRValidateCaptureAttribute(self.region, @"region", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementStreetAddressProperty))
+        JRValidateCaptureAttribute(self.streetAddress, @"streetAddress", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAddressesElementTypeProperty))
+        JRValidateCaptureAttribute(self.type, @"type", self.captureObjectPath, 0, 1000, violations);
+}
+
 - (BOOL)isEqualToAddressesElement:(JRAddressesElement *)otherAddressesElement
 {
     if (!self.country && !otherAddressesElement.country) /* Keep going... */;
@@ -602,4 +1007,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRAddressesElement class]]) return NO;
+
+    return YES;
+}
+
 @end
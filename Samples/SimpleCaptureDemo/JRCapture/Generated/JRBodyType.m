@@ -40,6 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRBodyType.h"
 
+enum
+{
+    JRBodyTypeBuildProperty,
+    JRBodyTypeColorProperty,
+    JRBodyTypeEyeColorProperty,
+    JRBodyTypeHairColorProperty,
+    JRBodyTypeHeightProperty,
+    JRBodyTypePropertyCount
+};
+
+static const char *const JRBodyTypePropertyNames[] =
+{
+    "build",
+    "color",
+    "eyeColor",
+    "hairColor",
+    "height",
+};
+
 @interface JRBodyType ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -54,6 +73,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRBodyTypePropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRBodyTypePropertyCount;
+}
+
 - (NSString *)build
 {
     return _build;
@@ -61,7 +90,7 @@
 
 - (void)setBuild:(NSString *)newBuild
 {
-    [self.dirtyPropertySet addObject:@"build"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBodyTypeBuildProperty);
 
     _build = [newBuild copy];
 }
@@ -73,7 +102,7 @@
 
 - (void)setColor:(NSString *)newColor
 {
-    [self.dirtyPropertySet addObject:@"color"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBodyTypeColorProperty);
 
     _color = [newColor copy];
 }
@@ -85,7 +114,7 @@
 
 - (void)setEyeColor:(NSString *)newEyeColor
 {
-    [self.dirtyPropertySet addObject:@"eyeColor"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBodyTypeEyeColorProperty);
 
     _eyeColor = [newEyeColor copy];
 }
@@ -97,7 +126,7 @@
 
 - (void)setHairColor:(NSString *)newHairColor
 {
-    [self.dirtyPropertySet addObject:@"hairColor"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHairColorProperty);
 
     _hairColor = [newHairColor copy];
 }
@@ -109,7 +138,7 @@
 
 - (void)setHeight:(JRDecimal *)newHeight
 {
-    [self.dirtyPropertySet addObject:@"height"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHeightProperty);
 
     _height = [newHeight copy];
 }
@@ -122,7 +151,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,11 +244,136 @@
     return [JRBodyType bodyTypeObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)bodyTypeObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRBodyType *bodyType = [JRBodyType bodyType];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    bodyType.captureObjectPath      = [NSString stringWithFormat:@"%@/%@", capturePath, @"bodyType"];
+    bodyType.canBeUpdatedOnCapture = YES;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 15)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "height")) break;
+                value = [reader readValue];
+                bodyType.height = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "build")) break;
+                value = [reader readValue];
+                bodyType.build = value != [NSNull null] ? value : nil;
+                continue;
+            case 8:
+                if (!JRJsonKeyEquals(key, keyLength, "color")) break;
+                value = [reader readValue];
+                bodyType.color = value != [NSNull null] ? value : nil;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "hairColor")) break;
+                value = [reader readValue];
+                bodyType.hairColor = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "eyeColor")) break;
+                value = [reader readValue];
+                bodyType.eyeColor = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [bodyType.dirtyPropertySet removeAllObjects];
+
+    return bodyType;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"build"];
+    [writer writeValue:self.build];
+    [writer writeKey:@"color"];
+    [writer writeValue:self.color];
+    [writer writeKey:@"eyeColor"];
+    [writer writeValue:self.eyeColor];
+    [writer writeKey:@"hairColor"];
+    [writer writeValue:self.hairColor];
+    [writer writeKey:@"height"];
+    [writer writeValue:self.height];
+    [writer endObject];
+}
+
++ (id)bodyTypeObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRBodyType *bodyType = [JRBodyType bodyType];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    bodyType.captureObjectPath = [reader readString];
+    bodyType.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 15)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "height")) break;
+                value = [reader readValue];
+                bodyType.height = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "build")) break;
+                value = [reader readValue];
+                bodyType.build = value != [NSNull null] ? value : nil;
+                continue;
+            case 8:
+                if (!JRJsonKeyEquals(key, keyLength, "color")) break;
+                value = [reader readValue];
+                bodyType.color = value != [NSNull null] ? value : nil;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "hairColor")) break;
+                value = [reader readValue];
+                bodyType.hairColor = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "eyeColor")) break;
+                value = [reader readValue];
+                bodyType.eyeColor = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [bodyType.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return bodyType;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRBodyTypePropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"bodyType"];
@@ -244,7 +398,7 @@
         [dictionary objectForKey:@"height"] != [NSNull null] ? 
         [dictionary objectForKey:@"height"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -252,18 +406,12 @@
     return [NSSet setWithObjects:@"build", @"color", @"eyeColor", @"hairColor", @"height", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"bodyType"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"bodyType"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -271,7 +419,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"bodyType"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"bodyType"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"bodyType"]];
 
 }
 
@@ -280,19 +428,19 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"build"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeBuildProperty))
         [dictionary setObject:(self.build ? self.build : [NSNull null]) forKey:@"build"];
 
-    if ([self.dirtyPropertySet containsObject:@"color"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeColorProperty))
         [dictionary setObject:(self.color ? self.color : [NSNull null]) forKey:@"color"];
 
-    if ([self.dirtyPropertySet containsObject:@"eyeColor"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeEyeColorProperty))
         [dictionary setObject:(self.eyeColor ? self.eyeColor : [NSNull null]) forKey:@"eyeColor"];
 
-    if ([self.dirtyPropertySet containsObject:@"hairColor"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHairColorProperty))
         [dictionary setObject:(self.hairColor ? self.hairColor : [NSNull null]) forKey:@"hairColor"];
 
-    if ([self.dirtyPropertySet containsObject:@"height"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHeightProperty))
         [dictionary setObject:(self.height ? self.height : [NSNull null]) forKey:@"height"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -319,6 +467,67 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeBuildProperty))
+    {
+        [writer writeKey:@"build"];
+        [writer writeValue:self.build];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeColorProperty))
+    {
+        [writer writeKey:@"color"];
+        [writer writeValue:self.color];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeEyeColorProperty))
+    {
+        [writer writeKey:@"eyeColor"];
+        [writer writeValue:self.eyeColor];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHairColorProperty))
+    {
+        [writer writeKey:@"hairColor"];
+        [writer writeValue:self.hairColor];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHeightProperty))
+    {
+        [writer writeKey:@"height"];
+        [writer writeValue:self.height];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"build"];
+    [writer writeValue:self.build];
+
+    [writer writeKey:@"color"];
+    [writer writeValue:self.color];
+
+    [writer writeKey:@"eyeColor"];
+    [writer writeValue:self.eyeColor];
+
+    [writer writeKey:@"hairColor"];
+    [writer writeValue:self.hairColor];
+
+    [writer writeKey:@"height"];
+    [writer writeValue:self.height];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -327,6 +536,21 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeBuildProperty))
+        JRValidateCaptureAttribute(self.build, @"build", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeColorProperty))
+        JRValidateCaptureAttribute(self.color, @"color", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeEyeColorProperty))
+        JRValidateCaptureAttribute(self.eyeColor, @"eyeColor", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRBodyTypeHairColorProperty))
+        JRValidateCaptureAttribute(self.hairColor, @"hairColor", self.captureObjectPath, 0, 100, violations);
+}
+
 - (BOOL)isEqualToBodyType:(JRBodyType *)otherBodyType
 {
     if (!self.build && !otherBodyType.build) /* Keep going... */;
@@ -366,4 +590,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRBodyType class]]) return NO;
+
+    return YES;
+}
+
 @end
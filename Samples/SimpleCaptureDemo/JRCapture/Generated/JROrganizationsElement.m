@@ -40,8 +40,37 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROrganizationsElement.h"
 
+enum
+{
+    JROrganizationsElementDepartmentProperty,
+    JROrganizationsElementDescriptionProperty,
+    JROrganizationsElementEndDateProperty,
+    JROrganizationsElementLocationProperty,
+    JROrganizationsElementNameProperty,
+    JROrganizationsElementPrimaryProperty,
+    JROrganizationsElementStartDateProperty,
+    JROrganizationsElementTitleProperty,
+    JROrganizationsElementTypeProperty,
+    JROrganizationsElementPropertyCount
+};
+
+static const char *const JROrganizationsElementPropertyNames[] =
+{
+    "department",
+    "description",
+    "endDate",
+    "location",
+    "name",
+    "primary",
+    "startDate",
+    "title",
+    "type",
+};
+
 @interface JRLocation (JRLocation_InternalMethods)
 + (id)locationObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)locationObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)locationObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToLocation:(JRLocation *)otherLocation;
 @end
 
@@ -55,6 +84,8 @@
     NSString *_description;
     NSString *_endDate;
     JRLocation *_location;
+    NSDictionary *_locationJson;
+    BOOL _locationJsonCleared;
     NSString *_name;
     JRBoolean *_primary;
     NSString *_startDate;
@@ -63,6 +94,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROrganizationsElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROrganizationsElementPropertyCount;
+}
+
 - (NSString *)department
 {
     return _department;
@@ -70,7 +111,7 @@
 
 - (void)setDepartment:(NSString *)newDepartment
 {
-    [self.dirtyPropertySet addObject:@"department"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDepartmentProperty);
 
     _department = [newDepartment copy];
 }
@@ -82,7 +123,7 @@
 
 - (void)setDescription:(NSString *)newDescription
 {
-    [self.dirtyPropertySet addObject:@"description"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDescriptionProperty);
 
     _description = [newDescription copy];
 }
@@ -94,19 +135,33 @@
 
 - (void)setEndDate:(NSString *)newEndDate
 {
-    [self.dirtyPropertySet addObject:@"endDate"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementEndDateProperty);
 
     _endDate = [newEndDate copy];
 }
 
 - (JRLocation *)location
 {
+    if (_locationJson)
+    {
+        NSDictionary *json = _locationJson;
+        _locationJson = nil;
+        _location = [JRLocation locationObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_locationJsonCleared)
+            [_location deepClearDirtyProperties];
+        else
+            [_location setAllPropertiesToDirty];
+    }
+
     return _location;
 }
 
 - (void)setLocation:(JRLocation *)newLocation
 {
-    [self.dirtyPropertySet addObject:@"location"];
+    _locationJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementLocationProperty);
 
     _location = newLocation;
 
@@ -120,7 +175,7 @@
 
 - (void)setName:(NSString *)newName
 {
-    [self.dirtyPropertySet addObject:@"name"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementNameProperty);
 
     _name = [newName copy];
 }
@@ -132,7 +187,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementPrimaryProperty);
 
     _primary = [newPrimary copy];
 }
@@ -144,7 +199,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementPrimaryProperty);
 
     _primary = [NSNumber numberWithBool:boolVal];
 }
@@ -156,7 +211,7 @@
 
 - (void)setStartDate:(NSString *)newStartDate
 {
-    [self.dirtyPropertySet addObject:@"startDate"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementStartDateProperty);
 
     _startDate = [newStartDate copy];
 }
@@ -168,7 +223,7 @@
 
 - (void)setTitle:(NSString *)newTitle
 {
-    [self.dirtyPropertySet addObject:@"title"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTitleProperty);
 
     _title = [newTitle copy];
 }
@@ -180,7 +235,7 @@
 
 - (void)setType:(NSString *)newType
 {
-    [self.dirtyPropertySet addObject:@"type"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTypeProperty);
 
     _type = [newType copy];
 }
@@ -194,7 +249,7 @@
 
         _location = [[JRLocation alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -262,6 +317,8 @@
         organizationsElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     organizationsElement.department =
         [dictionary objectForKey:@"department"] != [NSNull null] ? 
         [dictionary objectForKey:@"department"] : nil;
@@ -274,9 +331,12 @@
         [dictionary objectForKey:@"endDate"] != [NSNull null] ? 
         [dictionary objectForKey:@"endDate"] : nil;
 
-    organizationsElement.location =
-        [dictionary objectForKey:@"location"] != [NSNull null] ? 
-        [JRLocation locationObjectFromDictionary:[dictionary objectForKey:@"location"] withPath:organizationsElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"location"] isKindOfClass:[NSDictionary class]])
+        organizationsElement->_locationJson = [dictionary objectForKey:@"location"];
+    else
+        organizationsElement.location =
+            [dictionary objectForKey:@"location"] != [NSNull null] ? 
+            [JRLocation locationObjectFromDictionary:[dictionary objectForKey:@"location"] withPath:organizationsElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     organizationsElement.name =
         [dictionary objectForKey:@"name"] != [NSNull null] ? 
@@ -311,11 +371,203 @@
     return [JROrganizationsElement organizationsElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)organizationsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROrganizationsElement *organizationsElement = [JROrganizationsElement organizationsElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    organizationsElement.primary = [NSNumber numberWithBool:NO];
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 5) & 31)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "name")) break;
+                value = [reader readValue];
+                organizationsElement.name = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "department")) break;
+                value = [reader readValue];
+                organizationsElement.department = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "location")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"location"];
+                continue;
+            case 8:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                organizationsElement.type = value != [NSNull null] ? value : nil;
+                continue;
+            case 10:
+                if (!JRJsonKeyEquals(key, keyLength, "description")) break;
+                value = [reader readValue];
+                organizationsElement.description = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                organizationsElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 22:
+                if (!JRJsonKeyEquals(key, keyLength, "title")) break;
+                value = [reader readValue];
+                organizationsElement.title = value != [NSNull null] ? value : nil;
+                continue;
+            case 24:
+                if (!JRJsonKeyEquals(key, keyLength, "startDate")) break;
+                value = [reader readValue];
+                organizationsElement.startDate = value != [NSNull null] ? value : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "endDate")) break;
+                value = [reader readValue];
+                organizationsElement.endDate = value != [NSNull null] ? value : nil;
+                continue;
+            case 29:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    organizationsElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"organizations", (long)elementId];
+    organizationsElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"location"] isKindOfClass:[NSDictionary class]])
+        organizationsElement->_locationJson = [dictionary objectForKey:@"location"];
+    else
+        organizationsElement.location =
+            [dictionary objectForKey:@"location"] != [NSNull null] ? 
+            [JRLocation locationObjectFromDictionary:[dictionary objectForKey:@"location"] withPath:organizationsElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [organizationsElement.dirtyPropertySet removeAllObjects];
+
+    return organizationsElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"department"];
+    [writer writeValue:self.department];
+    [writer writeKey:@"description"];
+    [writer writeValue:self.description];
+    [writer writeKey:@"endDate"];
+    [writer writeValue:self.endDate];
+    [writer writeKey:@"location"];
+    if (self.location)
+        [self.location writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"name"];
+    [writer writeValue:self.name];
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    [writer writeKey:@"startDate"];
+    [writer writeValue:self.startDate];
+    [writer writeKey:@"title"];
+    [writer writeValue:self.title];
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+    [writer endObject];
+}
+
++ (id)organizationsElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROrganizationsElement *organizationsElement = [JROrganizationsElement organizationsElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    organizationsElement.captureObjectPath = [reader readString];
+    organizationsElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 5) & 31)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "name")) break;
+                value = [reader readValue];
+                organizationsElement.name = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "department")) break;
+                value = [reader readValue];
+                organizationsElement.department = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "location")) break;
+                organizationsElement.location = [JRLocation locationObjectFromArchive:reader];
+                continue;
+            case 8:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                organizationsElement.type = value != [NSNull null] ? value : nil;
+                continue;
+            case 10:
+                if (!JRJsonKeyEquals(key, keyLength, "description")) break;
+                value = [reader readValue];
+                organizationsElement.description = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                organizationsElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 22:
+                if (!JRJsonKeyEquals(key, keyLength, "title")) break;
+                value = [reader readValue];
+                organizationsElement.title = value != [NSNull null] ? value : nil;
+                continue;
+            case 24:
+                if (!JRJsonKeyEquals(key, keyLength, "startDate")) break;
+                value = [reader readValue];
+                organizationsElement.startDate = value != [NSNull null] ? value : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "endDate")) break;
+                value = [reader readValue];
+                organizationsElement.endDate = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [organizationsElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return organizationsElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROrganizationsElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"organizations", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -359,7 +611,7 @@
         [dictionary objectForKey:@"type"] != [NSNull null] ? 
         [dictionary objectForKey:@"type"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -367,18 +619,12 @@
     return [NSSet setWithObjects:@"department", @"description", @"endDate", @"location", @"name", @"primary", @"startDate", @"title", @"type", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"organizationsElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"organizationsElement"];
 
     if (self.location)
         [snapshotDictionary setObject:[self.location snapshotDictionaryFromDirtyPropertySet]
@@ -390,7 +636,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"organizationsElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"organizationsElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"organizationsElement"]];
 
     if ([snapshotDictionary objectForKey:@"location"])
         [self.location restoreDirtyPropertiesFromSnapshotDictionary:
@@ -403,16 +649,16 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"department"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDepartmentProperty))
         [dictionary setObject:(self.department ? self.department : [NSNull null]) forKey:@"department"];
 
-    if ([self.dirtyPropertySet containsObject:@"description"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDescriptionProperty))
         [dictionary setObject:(self.description ? self.description : [NSNull null]) forKey:@"description"];
 
-    if ([self.dirtyPropertySet containsObject:@"endDate"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementEndDateProperty))
         [dictionary setObject:(self.endDate ? self.endDate : [NSNull null]) forKey:@"endDate"];
 
-    if ([self.dirtyPropertySet containsObject:@"location"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementLocationProperty))
         [dictionary setObject:(self.location ?
                               [self.location toUpdateDictionary] :
                               [[JRLocation location] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -421,19 +667,19 @@
         [dictionary setObject:[self.location toUpdateDictionary]
                        forKey:@"location"];
 
-    if ([self.dirtyPropertySet containsObject:@"name"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementNameProperty))
         [dictionary setObject:(self.name ? self.name : [NSNull null]) forKey:@"name"];
 
-    if ([self.dirtyPropertySet containsObject:@"primary"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementPrimaryProperty))
         [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
-    if ([self.dirtyPropertySet containsObject:@"startDate"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementStartDateProperty))
         [dictionary setObject:(self.startDate ? self.startDate : [NSNull null]) forKey:@"startDate"];
 
-    if ([self.dirtyPropertySet containsObject:@"title"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTitleProperty))
         [dictionary setObject:(self.title ? self.title : [NSNull null]) forKey:@"title"];
 
-    if ([self.dirtyPropertySet containsObject:@"type"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTypeProperty))
         [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -468,6 +714,111 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDepartmentProperty))
+    {
+        [writer writeKey:@"department"];
+        [writer writeValue:self.department];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDescriptionProperty))
+    {
+        [writer writeKey:@"description"];
+        [writer writeValue:self.description];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementEndDateProperty))
+    {
+        [writer writeKey:@"endDate"];
+        [writer writeValue:self.endDate];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementLocationProperty))
+    {
+        [writer writeKey:@"location"];
+        [(self.location ? self.location : [JRLocation location]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.location needsUpdate])
+    {
+        [writer writeKey:@"location"];
+        [self.location writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementNameProperty))
+    {
+        [writer writeKey:@"name"];
+        [writer writeValue:self.name];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementPrimaryProperty))
+    {
+        [writer writeKey:@"primary"];
+        [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementStartDateProperty))
+    {
+        [writer writeKey:@"startDate"];
+        [writer writeValue:self.startDate];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTitleProperty))
+    {
+        [writer writeKey:@"title"];
+        [writer writeValue:self.title];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTypeProperty))
+    {
+        [writer writeKey:@"type"];
+        [writer writeValue:self.type];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"department"];
+    [writer writeValue:self.department];
+
+    [writer writeKey:@"description"];
+    [writer writeValue:self.description];
+
+    [writer writeKey:@"endDate"];
+    [writer writeValue:self.endDate];
+
+    [writer writeKey:@"location"];
+    if (self.location)
+        [self.location writeReplaceJsonToWriter:writer];
+    else
+        [[JRLocation location] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"name"];
+    [writer writeValue:self.name];
+
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+
+    [writer writeKey:@"startDate"];
+    [writer writeValue:self.startDate];
+
+    [writer writeKey:@"title"];
+    [writer writeValue:self.title];
+
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -479,6 +830,24 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDepartmentProperty))
+        JRValidateCaptureAttribute(self.department, @"department", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementDescriptionProperty))
+        JRValidateCaptureAttribute(self.description, @"description", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || !_locationJson)
+        [self.location validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementNameProperty))
+        JRValidateCaptureAttribute(self.name, @"name", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JROrganizationsElementTitleProperty))
+        JRValidateCaptureAttribute(self.title, @"title", self.captureObjectPath, 0, 1000, violations);
+}
+
 - (BOOL)isEqualToOrganizationsElement:(JROrganizationsElement *)otherOrganizationsElement
 {
     if (!self.department && !otherOrganizationsElement.department) /* Keep going... */;
@@ -539,4 +908,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_locationJson)
+        _locationJsonCleared = YES;
+    else
+        [self.location deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROrganizationsElement class]]) return NO;
+
+    JROrganizationsElement *otherOrganizationsElement = (JROrganizationsElement *)otherObj;
+
+    if (self.location && ![self.location isEqualByPrivateProperties:otherOrganizationsElement.location])
+        return NO;
+
+    return YES;
+}
+
 @end
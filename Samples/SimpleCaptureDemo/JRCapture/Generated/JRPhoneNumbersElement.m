@@ -40,6 +40,21 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPhoneNumbersElement.h"
 
+enum
+{
+    JRPhoneNumbersElementPrimaryProperty,
+    JRPhoneNumbersElementTypeProperty,
+    JRPhoneNumbersElementValueProperty,
+    JRPhoneNumbersElementPropertyCount
+};
+
+static const char *const JRPhoneNumbersElementPropertyNames[] =
+{
+    "primary",
+    "type",
+    "value",
+};
+
 @interface JRPhoneNumbersElement ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -52,6 +67,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPhoneNumbersElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPhoneNumbersElementPropertyCount;
+}
+
 - (JRBoolean *)primary
 {
     return _primary;
@@ -59,7 +84,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementPrimaryProperty);
 
     _primary = [newPrimary copy];
 }
@@ -71,7 +96,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementPrimaryProperty);
 
     _primary = [NSNumber numberWithBool:boolVal];
 }
@@ -83,7 +108,7 @@
 
 - (void)setType:(NSString *)newType
 {
-    [self.dirtyPropertySet addObject:@"type"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementTypeProperty);
 
     _type = [newType copy];
 }
@@ -95,7 +120,7 @@
 
 - (void)setValue:(NSString *)newValue
 {
-    [self.dirtyPropertySet addObject:@"value"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementValueProperty);
 
     _value = [newValue copy];
 }
@@ -108,7 +133,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -189,11 +214,120 @@
     return [JRPhoneNumbersElement phoneNumbersElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)phoneNumbersElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPhoneNumbersElement *phoneNumbersElement = [JRPhoneNumbersElement phoneNumbersElement];
+    NSInteger elementId = 0;
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    phoneNumbersElement.primary = [NSNumber numberWithBool:NO];
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                phoneNumbersElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "value")) break;
+                value = [reader readValue];
+                phoneNumbersElement.value = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                phoneNumbersElement.type = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    phoneNumbersElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"phoneNumbers", (long)elementId];
+    phoneNumbersElement.canBeUpdatedOnCapture = YES;
+
+    [phoneNumbersElement.dirtyPropertySet removeAllObjects];
+
+    return phoneNumbersElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+    [writer writeKey:@"value"];
+    [writer writeValue:self.value];
+    [writer endObject];
+}
+
++ (id)phoneNumbersElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPhoneNumbersElement *phoneNumbersElement = [JRPhoneNumbersElement phoneNumbersElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    phoneNumbersElement.captureObjectPath = [reader readString];
+    phoneNumbersElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                phoneNumbersElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "value")) break;
+                value = [reader readValue];
+                phoneNumbersElement.value = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                phoneNumbersElement.type = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [phoneNumbersElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return phoneNumbersElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPhoneNumbersElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"phoneNumbers", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -210,7 +344,7 @@
         [dictionary objectForKey:@"value"] != [NSNull null] ? 
         [dictionary objectForKey:@"value"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -218,18 +352,12 @@
     return [NSSet setWithObjects:@"primary", @"type", @"value", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"phoneNumbersElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"phoneNumbersElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -237,7 +365,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"phoneNumbersElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"phoneNumbersElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"phoneNumbersElement"]];
 
 }
 
@@ -246,13 +374,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"primary"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementPrimaryProperty))
         [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
-    if ([self.dirtyPropertySet containsObject:@"type"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementTypeProperty))
         [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
 
-    if ([self.dirtyPropertySet containsObject:@"value"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementValueProperty))
         [dictionary setObject:(self.value ? self.value : [NSNull null]) forKey:@"value"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -277,6 +405,49 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementPrimaryProperty))
+    {
+        [writer writeKey:@"primary"];
+        [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementTypeProperty))
+    {
+        [writer writeKey:@"type"];
+        [writer writeValue:self.type];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPhoneNumbersElementValueProperty))
+    {
+        [writer writeKey:@"value"];
+        [writer writeValue:self.value];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+
+    [writer writeKey:@"value"];
+    [writer writeValue:self.value];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -314,4 +485,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPhoneNumbersElement class]]) return NO;
+
+    return YES;
+}
+
 @end
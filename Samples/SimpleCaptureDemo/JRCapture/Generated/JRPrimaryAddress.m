@@ -40,6 +40,35 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPrimaryAddress.h"
 
+enum
+{
+    JRPrimaryAddressAddress1Property,
+    JRPrimaryAddressAddress2Property,
+    JRPrimaryAddressCityProperty,
+    JRPrimaryAddressCompanyProperty,
+    JRPrimaryAddressCountryProperty,
+    JRPrimaryAddressMobileProperty,
+    JRPrimaryAddressPhoneProperty,
+    JRPrimaryAddressStateAbbreviationProperty,
+    JRPrimaryAddressZipProperty,
+    JRPrimaryAddressZipPlus4Property,
+    JRPrimaryAddressPropertyCount
+};
+
+static const char *const JRPrimaryAddressPropertyNames[] =
+{
+    "address1",
+    "address2",
+    "city",
+    "company",
+    "country",
+    "mobile",
+    "phone",
+    "stateAbbreviation",
+    "zip",
+    "zipPlus4",
+};
+
 @interface JRPrimaryAddress ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -59,6 +88,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPrimaryAddressPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPrimaryAddressPropertyCount;
+}
+
 - (NSString *)address1
 {
     return _address1;
@@ -66,7 +105,7 @@
 
 - (void)setAddress1:(NSString *)newAddress1
 {
-    [self.dirtyPropertySet addObject:@"address1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress1Property);
 
     _address1 = [newAddress1 copy];
 }
@@ -78,7 +117,7 @@
 
 - (void)setAddress2:(NSString *)newAddress2
 {
-    [self.dirtyPropertySet addObject:@"address2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress2Property);
 
     _address2 = [newAddress2 copy];
 }
@@ -90,7 +129,7 @@
 
 - (void)setCity:(NSString *)newCity
 {
-    [self.dirtyPropertySet addObject:@"city"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCityProperty);
 
     _city = [newCity copy];
 }
@@ -102,7 +141,7 @@
 
 - (void)setCompany:(NSString *)newCompany
 {
-    [self.dirtyPropertySet addObject:@"company"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCompanyProperty);
 
     _company = [newCompany copy];
 }
@@ -114,7 +153,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
-    [self.dirtyPropertySet addObject:@"country"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCountryProperty);
 
     _country = [newCountry copy];
 }
@@ -126,7 +165,7 @@
 
 - (void)setMobile:(NSString *)newMobile
 {
-    [self.dirtyPropertySet addObject:@"mobile"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressMobileProperty);
 
     _mobile = [newMobile copy];
 }
@@ -138,7 +177,7 @@
 
 - (void)setPhone:(NSString *)newPhone
 {
-    [self.dirtyPropertySet addObject:@"phone"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressPhoneProperty);
 
     _phone = [newPhone copy];
 }
@@ -150,7 +189,7 @@
 
 - (void)setStateAbbreviation:(NSString *)newStateAbbreviation
 {
-    [self.dirtyPropertySet addObject:@"stateAbbreviation"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressStateAbbreviationProperty);
 
     _stateAbbreviation = [newStateAbbreviation copy];
 }
@@ -162,7 +201,7 @@
 
 - (void)setZip:(NSString *)newZip
 {
-    [self.dirtyPropertySet addObject:@"zip"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipProperty);
 
     _zip = [newZip copy];
 }
@@ -174,7 +213,7 @@
 
 - (void)setZipPlus4:(NSString *)newZipPlus4
 {
-    [self.dirtyPropertySet addObject:@"zipPlus4"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipPlus4Property);
 
     _zipPlus4 = [newZipPlus4 copy];
 }
@@ -187,7 +226,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -304,11 +343,193 @@
     return [JRPrimaryAddress primaryAddressObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)primaryAddressObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPrimaryAddress *primaryAddress = [JRPrimaryAddress primaryAddress];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 31)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "zipPlus4")) break;
+                value = [reader readValue];
+                primaryAddress.zipPlus4 = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "city")) break;
+                value = [reader readValue];
+                primaryAddress.city = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "address1")) break;
+                value = [reader readValue];
+                primaryAddress.address1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 15:
+                if (!JRJsonKeyEquals(key, keyLength, "phone")) break;
+                value = [reader readValue];
+                primaryAddress.phone = value != [NSNull null] ? value : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "country")) break;
+                value = [reader readValue];
+                primaryAddress.country = value != [NSNull null] ? value : nil;
+                continue;
+            case 19:
+                if (!JRJsonKeyEquals(key, keyLength, "address2")) break;
+                value = [reader readValue];
+                primaryAddress.address2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 20:
+                if (!JRJsonKeyEquals(key, keyLength, "zip")) break;
+                value = [reader readValue];
+                primaryAddress.zip = value != [NSNull null] ? value : nil;
+                continue;
+            case 23:
+                if (!JRJsonKeyEquals(key, keyLength, "mobile")) break;
+                value = [reader readValue];
+                primaryAddress.mobile = value != [NSNull null] ? value : nil;
+                continue;
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "stateAbbreviation")) break;
+                value = [reader readValue];
+                primaryAddress.stateAbbreviation = value != [NSNull null] ? value : nil;
+                continue;
+            case 28:
+                if (!JRJsonKeyEquals(key, keyLength, "company")) break;
+                value = [reader readValue];
+                primaryAddress.company = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [primaryAddress.dirtyPropertySet removeAllObjects];
+
+    return primaryAddress;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"address1"];
+    [writer writeValue:self.address1];
+    [writer writeKey:@"address2"];
+    [writer writeValue:self.address2];
+    [writer writeKey:@"city"];
+    [writer writeValue:self.city];
+    [writer writeKey:@"company"];
+    [writer writeValue:self.company];
+    [writer writeKey:@"country"];
+    [writer writeValue:self.country];
+    [writer writeKey:@"mobile"];
+    [writer writeValue:self.mobile];
+    [writer writeKey:@"phone"];
+    [writer writeValue:self.phone];
+    [writer writeKey:@"stateAbbreviation"];
+    [writer writeValue:self.stateAbbreviation];
+    [writer writeKey:@"zip"];
+    [writer writeValue:self.zip];
+    [writer writeKey:@"zipPlus4"];
+    [writer writeValue:self.zipPlus4];
+    [writer endObject];
+}
+
++ (id)primaryAddressObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPrimaryAddress *primaryAddress = [JRPrimaryAddress primaryAddress];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    primaryAddress.captureObjectPath = [reader readString];
+    primaryAddress.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 31)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "zipPlus4")) break;
+                value = [reader readValue];
+                primaryAddress.zipPlus4 = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "city")) break;
+                value = [reader readValue];
+                primaryAddress.city = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "address1")) break;
+                value = [reader readValue];
+                primaryAddress.address1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 15:
+                if (!JRJsonKeyEquals(key, keyLength, "phone")) break;
+                value = [reader readValue];
+                primaryAddress.phone = value != [NSNull null] ? value : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "country")) break;
+                value = [reader readValue];
+                primaryAddress.country = value != [NSNull null] ? value : nil;
+                continue;
+            case 19:
+                if (!JRJsonKeyEquals(key, keyLength, "address2")) break;
+                value = [reader readValue];
+                primaryAddress.address2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 20:
+                if (!JRJsonKeyEquals(key, keyLength, "zip")) break;
+                value = [reader readValue];
+                primaryAddress.zip = value != [NSNull null] ? value : nil;
+                continue;
+            case 23:
+                if (!JRJsonKeyEquals(key, keyLength, "mobile")) break;
+                value = [reader readValue];
+                primaryAddress.mobile = value != [NSNull null] ? value : nil;
+                continue;
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "stateAbbreviation")) break;
+                value = [reader readValue];
+                primaryAddress.stateAbbreviation = value != [NSNull null] ? value : nil;
+                continue;
+            case 28:
+                if (!JRJsonKeyEquals(key, keyLength, "company")) break;
+                value = [reader readValue];
+                primaryAddress.company = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [primaryAddress.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return primaryAddress;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPrimaryAddressPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -352,7 +573,7 @@
         [dictionary objectForKey:@"zipPlus4"] != [NSNull null] ? 
         [dictionary objectForKey:@"zipPlus4"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -360,18 +581,12 @@
     return [NSSet setWithObjects:@"address1", @"address2", @"city", @"company", @"country", @"mobile", @"phone", @"stateAbbreviation", @"zip", @"zipPlus4", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"primaryAddress"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"primaryAddress"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -379,7 +594,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"primaryAddress"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"primaryAddress"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"primaryAddress"]];
 
 }
 
@@ -388,34 +603,34 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"address1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress1Property))
         [dictionary setObject:(self.address1 ? self.address1 : [NSNull null]) forKey:@"address1"];
 
-    if ([self.dirtyPropertySet containsObject:@"address2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress2Property))
         [dictionary setObject:(self.address2 ? self.address2 : [NSNull null]) forKey:@"address2"];
 
-    if ([self.dirtyPropertySet containsObject:@"city"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCityProperty))
         [dictionary setObject:(self.city ? self.city : [NSNull null]) forKey:@"city"];
 
-    if ([self.dirtyPropertySet containsObject:@"company"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCompanyProperty))
         [dictionary setObject:(self.company ? self.company : [NSNull null]) forKey:@"company"];
 
-    if ([self.dirtyPropertySet containsObject:@"country"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCountryProperty))
         [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
 
-    if ([self.dirtyPropertySet containsObject:@"mobile"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressMobileProperty))
         [dictionary setObject:(self.mobile ? self.mobile : [NSNull null]) forKey:@"mobile"];
 
-    if ([self.dirtyPropertySet containsObject:@"phone"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressPhoneProperty))
         [dictionary setObject:(self.phone ? self.phone : [NSNull null]) forKey:@"phone"];
 
-    if ([self.dirtyPropertySet containsObject:@"stateAbbreviation"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressStateAbbreviationProperty))
         [dictionary setObject:(self.stateAbbreviation ? self.stateAbbreviation : [NSNull null]) forKey:@"stateAbbreviation"];
 
-    if ([self.dirtyPropertySet containsObject:@"zip"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipProperty))
         [dictionary setObject:(self.zip ? self.zip : [NSNull null]) forKey:@"zip"];
 
-    if ([self.dirtyPropertySet containsObject:@"zipPlus4"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipPlus4Property))
         [dictionary setObject:(self.zipPlus4 ? self.zipPlus4 : [NSNull null]) forKey:@"zipPlus4"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -447,6 +662,112 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress1Property))
+    {
+        [writer writeKey:@"address1"];
+        [writer writeValue:self.address1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress2Property))
+    {
+        [writer writeKey:@"address2"];
+        [writer writeValue:self.address2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCityProperty))
+    {
+        [writer writeKey:@"city"];
+        [writer writeValue:self.city];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCompanyProperty))
+    {
+        [writer writeKey:@"company"];
+        [writer writeValue:self.company];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCountryProperty))
+    {
+        [writer writeKey:@"country"];
+        [writer writeValue:self.country];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressMobileProperty))
+    {
+        [writer writeKey:@"mobile"];
+        [writer writeValue:self.mobile];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressPhoneProperty))
+    {
+        [writer writeKey:@"phone"];
+        [writer writeValue:self.phone];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressStateAbbreviationProperty))
+    {
+        [writer writeKey:@"stateAbbreviation"];
+        [writer writeValue:self.stateAbbreviation];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipProperty))
+    {
+        [writer writeKey:@"zip"];
+        [writer writeValue:self.zip];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipPlus4Property))
+    {
+        [writer writeKey:@"zipPlus4"];
+        [writer writeValue:self.zipPlus4];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"address1"];
+    [writer writeValue:self.address1];
+
+    [writer writeKey:@"address2"];
+    [writer writeValue:self.address2];
+
+    [writer writeKey:@"city"];
+    [writer writeValue:self.city];
+
+    [writer writeKey:@"company"];
+    [writer writeValue:self.company];
+
+    [writer writeKey:@"country"];
+    [writer writeValue:self.country];
+
+    [writer writeKey:@"mobile"];
+    [writer writeValue:self.mobile];
+
+    [writer writeKey:@"phone"];
+    [writer writeValue:self.phone];
+
+    [writer writeKey:@"stateAbbreviation"];
+    [writer writeValue:self.stateAbbreviation];
+
+    [writer writeKey:@"zip"];
+    [writer writeValue:self.zip];
+
+    [writer writeKey:@"zipPlus4"];
+    [writer writeValue:self.zipPlus4];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -455,6 +776,39 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress1Property))
+        JRValidateCaptureAttribute(self.address1, @"address1", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressAddress2Property))
+        JRValidateCaptureAttribute(self.address2, @"address2", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCityProperty))
+        JRValidateCaptureAttribute(self.city, @"city", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCompanyProperty))
+        JRValidateCaptureAttribute(self.company, @"company", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressCountryProperty))
+        JRValidateCaptureAttribute(self.country, @"country", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressMobileProperty))
+        JRValidateCaptureAttribute(self.mobile, @"mobile", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressPhoneProperty))
+        JRValidateCaptureAttribute(self.phone, @"phone", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressStateAbbreviationProperty))
+        JRValidateCaptureAttribute(self.stateAbbreviation, @"stateAbbreviation", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipProperty))
+        JRValidateCaptureAttribute(self.zip, @"zip", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPrimaryAddressZipPlus4Property))
+        JRValidateCaptureAttribute(self.zipPlus4, @"zipPlus4", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 100, violations);
+}
+
 - (BOOL)isEqualToPrimaryAddress:(JRPrimaryAddress *)otherPrimaryAddress
 {
     if (!self.address1 && !otherPrimaryAddress.address1) /* Keep going... */;
@@ -519,4 +873,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPrimaryAddress class]]) return NO;
+
+    return YES;
+}
+
 @end
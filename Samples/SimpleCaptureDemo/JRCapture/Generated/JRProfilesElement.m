@@ -40,8 +40,33 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRProfilesElement.h"
 
+enum
+{
+    JRProfilesElementAccessCredentialsProperty,
+    JRProfilesElementDomainProperty,
+    JRProfilesElementIdentifierProperty,
+    JRProfilesElementProfileProperty,
+    JRProfilesElementProviderProperty,
+    JRProfilesElementRemote_keyProperty,
+    JRProfilesElementVerifiedEmailProperty,
+    JRProfilesElementPropertyCount
+};
+
+static const char *const JRProfilesElementPropertyNames[] =
+{
+    "accessCredentials",
+    "domain",
+    "identifier",
+    "profile",
+    "provider",
+    "remote_key",
+    "verifiedEmail",
+};
+
 @interface JRProfile (JRProfile_InternalMethods)
 + (id)profileObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)profileObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)profileObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToProfile:(JRProfile *)otherProfile;
 @end
 
@@ -58,12 +83,24 @@
     JRStringArray *_friends;
     NSString *_identifier;
     JRProfile *_profile;
+    NSDictionary *_profileJson;
+    BOOL _profileJsonCleared;
     JRJsonObject *_provider;
     NSString *_remote_key;
     JRJsonObject *_verifiedEmail;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRProfilesElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRProfilesElementPropertyCount;
+}
+
 - (JRJsonObject *)accessCredentials
 {
     return _accessCredentials;
@@ -71,7 +108,7 @@
 
 - (void)setAccessCredentials:(JRJsonObject *)newAccessCredentials
 {
-    [self.dirtyPropertySet addObject:@"accessCredentials"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementAccessCredentialsProperty);
 
     _accessCredentials = [newAccessCredentials copy];
 }
@@ -83,7 +120,7 @@
 
 - (void)setDomain:(NSString *)newDomain
 {
-    [self.dirtyPropertySet addObject:@"domain"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementDomainProperty);
 
     _domain = [newDomain copy];
 }
@@ -125,19 +162,33 @@
 
 - (void)setIdentifier:(NSString *)newIdentifier
 {
-    [self.dirtyPropertySet addObject:@"identifier"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementIdentifierProperty);
 
     _identifier = [newIdentifier copy];
 }
 
 - (JRProfile *)profile
 {
+    if (_profileJson)
+    {
+        NSDictionary *json = _profileJson;
+        _profileJson = nil;
+        _profile = [JRProfile profileObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_profileJsonCleared)
+            [_profile deepClearDirtyProperties];
+        else
+            [_profile setAllPropertiesToDirty];
+    }
+
     return _profile;
 }
 
 - (void)setProfile:(JRProfile *)newProfile
 {
-    [self.dirtyPropertySet addObject:@"profile"];
+    _profileJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementProfileProperty);
 
     _profile = newProfile;
 
@@ -151,7 +202,7 @@
 
 - (void)setProvider:(JRJsonObject *)newProvider
 {
-    [self.dirtyPropertySet addObject:@"provider"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementProviderProperty);
 
     _provider = [newProvider copy];
 }
@@ -163,7 +214,7 @@
 
 - (void)setRemote_key:(NSString *)newRemote_key
 {
-    [self.dirtyPropertySet addObject:@"remote_key"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementRemote_keyProperty);
 
     _remote_key = [newRemote_key copy];
 }
@@ -175,7 +226,7 @@
 
 - (void)setVerifiedEmail:(JRJsonObject *)newVerifiedEmail
 {
-    [self.dirtyPropertySet addObject:@"verifiedEmail"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilesElementVerifiedEmailProperty);
 
     _verifiedEmail = [newVerifiedEmail copy];
 }
@@ -189,7 +240,7 @@
 
         _profile = [[JRProfile alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -210,7 +261,7 @@
         _identifier = [newIdentifier copy];
         _profile = [[JRProfile alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -285,6 +336,8 @@
         profilesElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     profilesElement.accessCredentials =
         [dictionary objectForKey:@"accessCredentials"] != [NSNull null] ? 
         [dictionary objectForKey:@"accessCredentials"] : nil;
@@ -309,9 +362,12 @@
         [dictionary objectForKey:@"identifier"] != [NSNull null] ? 
         [dictionary objectForKey:@"identifier"] : nil;
 
-    profilesElement.profile =
-        [dictionary objectForKey:@"profile"] != [NSNull null] ? 
-        [JRProfile profileObjectFromDictionary:[dictionary objectForKey:@"profile"] withPath:profilesElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"profile"] isKindOfClass:[NSDictionary class]])
+        profilesElement->_profileJson = [dictionary objectForKey:@"profile"];
+    else
+        profilesElement.profile =
+            [dictionary objectForKey:@"profile"] != [NSNull null] ? 
+            [JRProfile profileObjectFromDictionary:[dictionary objectForKey:@"profile"] withPath:profilesElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profilesElement.provider =
         [dictionary objectForKey:@"provider"] != [NSNull null] ? 
@@ -338,11 +394,213 @@
     return [JRProfilesElement profilesElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)profilesElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRProfilesElement *profilesElement = [JRProfilesElement profilesElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 3) & 31)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "verifiedEmail")) break;
+                value = [reader readValue];
+                profilesElement.verifiedEmail = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "provider")) break;
+                value = [reader readValue];
+                profilesElement.provider = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "following")) break;
+                value = [reader readValue];
+                profilesElement.following = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"identifier"] : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "accessCredentials")) break;
+                value = [reader readValue];
+                profilesElement.accessCredentials = value != [NSNull null] ? value : nil;
+                continue;
+            case 10:
+                if (!JRJsonKeyEquals(key, keyLength, "domain")) break;
+                value = [reader readValue];
+                profilesElement.domain = value != [NSNull null] ? value : nil;
+                continue;
+            case 11:
+                if (!JRJsonKeyEquals(key, keyLength, "profile")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"profile"];
+                continue;
+            case 19:
+                if (!JRJsonKeyEquals(key, keyLength, "friends")) break;
+                value = [reader readValue];
+                profilesElement.friends = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"identifier"] : nil;
+                continue;
+            case 21:
+                if (!JRJsonKeyEquals(key, keyLength, "identifier")) break;
+                value = [reader readValue];
+                profilesElement.identifier = value != [NSNull null] ? value : nil;
+                continue;
+            case 24:
+                if (!JRJsonKeyEquals(key, keyLength, "remote_key")) break;
+                value = [reader readValue];
+                profilesElement.remote_key = value != [NSNull null] ? value : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "followers")) break;
+                value = [reader readValue];
+                profilesElement.followers = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"identifier"] : nil;
+                continue;
+            case 27:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    profilesElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"profiles", (long)elementId];
+    profilesElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"profile"] isKindOfClass:[NSDictionary class]])
+        profilesElement->_profileJson = [dictionary objectForKey:@"profile"];
+    else
+        profilesElement.profile =
+            [dictionary objectForKey:@"profile"] != [NSNull null] ? 
+            [JRProfile profileObjectFromDictionary:[dictionary objectForKey:@"profile"] withPath:profilesElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [profilesElement.dirtyPropertySet removeAllObjects];
+
+    return profilesElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"accessCredentials"];
+    [writer writeValue:self.accessCredentials];
+    [writer writeKey:@"domain"];
+    [writer writeValue:self.domain];
+    [writer writeKey:@"followers"];
+    [writer writeValue:self.followers];
+    [writer writeKey:@"following"];
+    [writer writeValue:self.following];
+    [writer writeKey:@"friends"];
+    [writer writeValue:self.friends];
+    [writer writeKey:@"identifier"];
+    [writer writeValue:self.identifier];
+    [writer writeKey:@"profile"];
+    if (self.profile)
+        [self.profile writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"provider"];
+    [writer writeValue:self.provider];
+    [writer writeKey:@"remote_key"];
+    [writer writeValue:self.remote_key];
+    [writer writeKey:@"verifiedEmail"];
+    [writer writeValue:self.verifiedEmail];
+    [writer endObject];
+}
+
++ (id)profilesElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRProfilesElement *profilesElement = [JRProfilesElement profilesElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    profilesElement.captureObjectPath = [reader readString];
+    profilesElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 3) & 31)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "verifiedEmail")) break;
+                value = [reader readValue];
+                profilesElement.verifiedEmail = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "provider")) break;
+                value = [reader readValue];
+                profilesElement.provider = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "following")) break;
+                value = [reader readValue];
+                profilesElement.following = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"identifier"] : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "accessCredentials")) break;
+                value = [reader readValue];
+                profilesElement.accessCredentials = value != [NSNull null] ? value : nil;
+                continue;
+            case 10:
+                if (!JRJsonKeyEquals(key, keyLength, "domain")) break;
+                value = [reader readValue];
+                profilesElement.domain = value != [NSNull null] ? value : nil;
+                continue;
+            case 11:
+                if (!JRJsonKeyEquals(key, keyLength, "profile")) break;
+                profilesElement.profile = [JRProfile profileObjectFromArchive:reader];
+                continue;
+            case 19:
+                if (!JRJsonKeyEquals(key, keyLength, "friends")) break;
+                value = [reader readValue];
+                profilesElement.friends = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"identifier"] : nil;
+                continue;
+            case 21:
+                if (!JRJsonKeyEquals(key, keyLength, "identifier")) break;
+                value = [reader readValue];
+                profilesElement.identifier = value != [NSNull null] ? value : nil;
+                continue;
+            case 24:
+                if (!JRJsonKeyEquals(key, keyLength, "remote_key")) break;
+                value = [reader readValue];
+                profilesElement.remote_key = value != [NSNull null] ? value : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "followers")) break;
+                value = [reader readValue];
+                profilesElement.followers = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"identifier"] : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [profilesElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return profilesElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRProfilesElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"profiles", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -390,7 +648,7 @@
         [dictionary objectForKey:@"verifiedEmail"] != [NSNull null] ? 
         [dictionary objectForKey:@"verifiedEmail"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -398,18 +656,12 @@
     return [NSSet setWithObjects:@"accessCredentials", @"domain", @"identifier", @"profile", @"provider", @"remote_key", @"verifiedEmail", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"profilesElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"profilesElement"];
 
     if (self.profile)
         [snapshotDictionary setObject:[self.profile snapshotDictionaryFromDirtyPropertySet]
@@ -421,7 +673,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"profilesElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"profilesElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"profilesElement"]];
 
     if ([snapshotDictionary objectForKey:@"profile"])
         [self.profile restoreDirtyPropertiesFromSnapshotDictionary:
@@ -434,16 +686,16 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"accessCredentials"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementAccessCredentialsProperty))
         [dictionary setObject:(self.accessCredentials ? self.accessCredentials : [NSNull null]) forKey:@"accessCredentials"];
 
-    if ([self.dirtyPropertySet containsObject:@"domain"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementDomainProperty))
         [dictionary setObject:(self.domain ? self.domain : [NSNull null]) forKey:@"domain"];
 
-    if ([self.dirtyPropertySet containsObject:@"identifier"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementIdentifierProperty))
         [dictionary setObject:(self.identifier ? self.identifier : [NSNull null]) forKey:@"identifier"];
 
-    if ([self.dirtyPropertySet containsObject:@"profile"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementProfileProperty))
         [dictionary setObject:(self.profile ?
                               [self.profile toUpdateDictionary] :
                               [[JRProfile profile] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -452,13 +704,13 @@
         [dictionary setObject:[self.profile toUpdateDictionary]
                        forKey:@"profile"];
 
-    if ([self.dirtyPropertySet containsObject:@"provider"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementProviderProperty))
         [dictionary setObject:(self.provider ? self.provider : [NSNull null]) forKey:@"provider"];
 
-    if ([self.dirtyPropertySet containsObject:@"remote_key"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementRemote_keyProperty))
         [dictionary setObject:(self.remote_key ? self.remote_key : [NSNull null]) forKey:@"remote_key"];
 
-    if ([self.dirtyPropertySet containsObject:@"verifiedEmail"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementVerifiedEmailProperty))
         [dictionary setObject:(self.verifiedEmail ? self.verifiedEmail : [NSNull null]) forKey:@"verifiedEmail"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -506,6 +758,102 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementAccessCredentialsProperty))
+    {
+        [writer writeKey:@"accessCredentials"];
+        [writer writeValue:self.accessCredentials];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementDomainProperty))
+    {
+        [writer writeKey:@"domain"];
+        [writer writeValue:self.domain];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementIdentifierProperty))
+    {
+        [writer writeKey:@"identifier"];
+        [writer writeValue:self.identifier];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementProfileProperty))
+    {
+        [writer writeKey:@"profile"];
+        [(self.profile ? self.profile : [JRProfile profile]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.profile needsUpdate])
+    {
+        [writer writeKey:@"profile"];
+        [self.profile writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementProviderProperty))
+    {
+        [writer writeKey:@"provider"];
+        [writer writeValue:self.provider];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementRemote_keyProperty))
+    {
+        [writer writeKey:@"remote_key"];
+        [writer writeValue:self.remote_key];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementVerifiedEmailProperty))
+    {
+        [writer writeKey:@"verifiedEmail"];
+        [writer writeValue:self.verifiedEmail];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"accessCredentials"];
+    [writer writeValue:self.accessCredentials];
+
+    [writer writeKey:@"domain"];
+    [writer writeValue:self.domain];
+
+    [writer writeKey:@"followers"];
+    [writer writeValue:(self.followers ? self.followers : [NSArray array])];
+
+    [writer writeKey:@"following"];
+    [writer writeValue:(self.following ? self.following : [NSArray array])];
+
+    [writer writeKey:@"friends"];
+    [writer writeValue:(self.friends ? self.friends : [NSArray array])];
+
+    [writer writeKey:@"identifier"];
+    [writer writeValue:self.identifier];
+
+    [writer writeKey:@"profile"];
+    if (self.profile)
+        [self.profile writeReplaceJsonToWriter:writer];
+    else
+        [[JRProfile profile] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"provider"];
+    [writer writeValue:self.provider];
+
+    [writer writeKey:@"remote_key"];
+    [writer writeValue:self.remote_key];
+
+    [writer writeKey:@"verifiedEmail"];
+    [writer writeValue:self.verifiedEmail];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replaceFollowersArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.followers named:@"followers" isArrayOfStrings:YES
@@ -535,6 +883,21 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementDomainProperty))
+        JRValidateCaptureAttribute(self.domain, @"domain", self.captureObjectPath, JRCaptureAttributeRequired, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementIdentifierProperty))
+        JRValidateCaptureAttribute(self.identifier, @"identifier", self.captureObjectPath, JRCaptureAttributeRequired, 1000, violations);
+
+    if (!dirtyPropertiesOnly || !_profileJson)
+        [self.profile validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilesElementRemote_keyProperty))
+        JRValidateCaptureAttribute(self.remote_key, @"remote_key", self.captureObjectPath, 0, 4096, violations);
+}
+
 - (BOOL)isEqualToProfilesElement:(JRProfilesElement *)otherProfilesElement
 {
     if (!self.accessCredentials && !otherProfilesElement.accessCredentials) /* Keep going... */;
@@ -603,4 +966,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_profileJson)
+        _profileJsonCleared = YES;
+    else
+        [self.profile deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRProfilesElement class]]) return NO;
+
+    JRProfilesElement *otherProfilesElement = (JRProfilesElement *)otherObj;
+
+    if (self.profile && ![self.profile isEqualByPrivateProperties:otherProfilesElement.profile])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,6 +40,19 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRStatusesElement.h"
 
+enum
+{
+    JRStatusesElementStatusProperty,
+    JRStatusesElementStatusCreatedProperty,
+    JRStatusesElementPropertyCount
+};
+
+static const char *const JRStatusesElementPropertyNames[] =
+{
+    "status",
+    "statusCreated",
+};
+
 @interface JRStatusesElement ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -51,6 +64,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRStatusesElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRStatusesElementPropertyCount;
+}
+
 - (NSString *)status
 {
     return _status;
@@ -58,7 +81,7 @@
 
 - (void)setStatus:(NSString *)newStatus
 {
-    [self.dirtyPropertySet addObject:@"status"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusProperty);
 
     _status = [newStatus copy];
 }
@@ -70,7 +93,7 @@
 
 - (void)setStatusCreated:(JRDateTime *)newStatusCreated
 {
-    [self.dirtyPropertySet addObject:@"statusCreated"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusCreatedProperty);
 
     _statusCreated = [newStatusCreated copy];
 }
@@ -83,7 +106,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -158,11 +181,106 @@
     return [JRStatusesElement statusesElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)statusesElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRStatusesElement *statusesElement = [JRStatusesElement statusesElement];
+    NSInteger elementId = 0;
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "statusCreated")) break;
+                value = [reader readValue];
+                statusesElement.statusCreated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "status")) break;
+                value = [reader readValue];
+                statusesElement.status = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    statusesElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"statuses", (long)elementId];
+    statusesElement.canBeUpdatedOnCapture = YES;
+
+    [statusesElement.dirtyPropertySet removeAllObjects];
+
+    return statusesElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"status"];
+    [writer writeValue:self.status];
+    [writer writeKey:@"statusCreated"];
+    [writer writeValue:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : nil)];
+    [writer endObject];
+}
+
++ (id)statusesElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRStatusesElement *statusesElement = [JRStatusesElement statusesElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    statusesElement.captureObjectPath = [reader readString];
+    statusesElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 3)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "statusCreated")) break;
+                value = [reader readValue];
+                statusesElement.statusCreated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "status")) break;
+                value = [reader readValue];
+                statusesElement.status = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [statusesElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return statusesElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRStatusesElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"statuses", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -175,7 +293,7 @@
         [dictionary objectForKey:@"statusCreated"] != [NSNull null] ? 
         [JRDateTime dateFromISO8601DateTimeString:[dictionary objectForKey:@"statusCreated"]] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -183,18 +301,12 @@
     return [NSSet setWithObjects:@"status", @"statusCreated", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"statusesElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"statusesElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -202,7 +314,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"statusesElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"statusesElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"statusesElement"]];
 
 }
 
@@ -211,10 +323,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"status"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusProperty))
         [dictionary setObject:(self.status ? self.status : [NSNull null]) forKey:@"status"];
 
-    if ([self.dirtyPropertySet containsObject:@"statusCreated"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusCreatedProperty))
         [dictionary setObject:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : [NSNull null]) forKey:@"statusCreated"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -238,6 +350,40 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusProperty))
+    {
+        [writer writeKey:@"status"];
+        [writer writeValue:self.status];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusCreatedProperty))
+    {
+        [writer writeKey:@"statusCreated"];
+        [writer writeValue:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : nil)];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"status"];
+    [writer writeValue:self.status];
+
+    [writer writeKey:@"statusCreated"];
+    [writer writeValue:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : nil)];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -246,6 +392,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRStatusesElementStatusProperty))
+        JRValidateCaptureAttribute(self.status, @"status", self.captureObjectPath, 0, 1000, violations);
+}
+
 - (BOOL)isEqualToStatusesElement:(JRStatusesElement *)otherStatusesElement
 {
     if (!self.status && !otherStatusesElement.status) /* Keep going... */;
@@ -270,4 +422,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRStatusesElement class]]) return NO;
+
+    return YES;
+}
+
 @end
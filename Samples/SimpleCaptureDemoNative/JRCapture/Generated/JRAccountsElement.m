@@ -40,6 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRAccountsElement.h"
 
+enum
+{
+    JRAccountsElementDomainProperty,
+    JRAccountsElementPrimaryProperty,
+    JRAccountsElementUseridProperty,
+    JRAccountsElementUsernameProperty,
+    JRAccountsElementPropertyCount
+};
+
+static const char *const JRAccountsElementPropertyNames[] =
+{
+    "domain",
+    "primary",
+    "userid",
+    "username",
+};
+
 @interface JRAccountsElement ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -53,6 +70,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRAccountsElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRAccountsElementPropertyCount;
+}
+
 - (NSString *)domain
 {
     return _domain;
@@ -60,7 +87,7 @@
 
 - (void)setDomain:(NSString *)newDomain
 {
-    [self.dirtyPropertySet addObject:@"domain"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAccountsElementDomainProperty);
 
     _domain = [newDomain copy];
 }
@@ -72,7 +99,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAccountsElementPrimaryProperty);
 
     _primary = [newPrimary copy];
 }
@@ -84,7 +111,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
-    [self.dirtyPropertySet addObject:@"primary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAccountsElementPrimaryProperty);
 
     _primary = [NSNumber numberWithBool:boolVal];
 }
@@ -96,7 +123,7 @@
 
 - (void)setUserid:(NSString *)newUserid
 {
-    [self.dirtyPropertySet addObject:@"userid"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUseridProperty);
 
     _userid = [newUserid copy];
 }
@@ -108,7 +135,7 @@
 
 - (void)setUsername:(NSString *)newUsername
 {
-    [self.dirtyPropertySet addObject:@"username"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUsernameProperty);
 
     _username = [newUsername copy];
 }
@@ -121,7 +148,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -208,11 +235,132 @@
     return [JRAccountsElement accountsElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)accountsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRAccountsElement *accountsElement = [JRAccountsElement accountsElement];
+    NSInteger elementId = 0;
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    accountsElement.primary = [NSNumber numberWithBool:NO];
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 15)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "domain")) break;
+                value = [reader readValue];
+                accountsElement.domain = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                accountsElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "username")) break;
+                value = [reader readValue];
+                accountsElement.username = value != [NSNull null] ? value : nil;
+                continue;
+            case 9:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 10:
+                if (!JRJsonKeyEquals(key, keyLength, "userid")) break;
+                value = [reader readValue];
+                accountsElement.userid = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    accountsElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"accounts", (long)elementId];
+    accountsElement.canBeUpdatedOnCapture = YES;
+
+    [accountsElement.dirtyPropertySet removeAllObjects];
+
+    return accountsElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"domain"];
+    [writer writeValue:self.domain];
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    [writer writeKey:@"userid"];
+    [writer writeValue:self.userid];
+    [writer writeKey:@"username"];
+    [writer writeValue:self.username];
+    [writer endObject];
+}
+
++ (id)accountsElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRAccountsElement *accountsElement = [JRAccountsElement accountsElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    accountsElement.captureObjectPath = [reader readString];
+    accountsElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 15)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "domain")) break;
+                value = [reader readValue];
+                accountsElement.domain = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "primary")) break;
+                value = [reader readValue];
+                accountsElement.primary = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "username")) break;
+                value = [reader readValue];
+                accountsElement.username = value != [NSNull null] ? value : nil;
+                continue;
+            case 10:
+                if (!JRJsonKeyEquals(key, keyLength, "userid")) break;
+                value = [reader readValue];
+                accountsElement.userid = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [accountsElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return accountsElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRAccountsElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"accounts", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -233,7 +381,7 @@
         [dictionary objectForKey:@"username"] != [NSNull null] ? 
         [dictionary objectForKey:@"username"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -241,18 +389,12 @@
     return [NSSet setWithObjects:@"domain", @"primary", @"userid", @"username", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"accountsElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"accountsElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -260,7 +402,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"accountsElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"accountsElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"accountsElement"]];
 
 }
 
@@ -269,16 +411,16 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"domain"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementDomainProperty))
         [dictionary setObject:(self.domain ? self.domain : [NSNull null]) forKey:@"domain"];
 
-    if ([self.dirtyPropertySet containsObject:@"primary"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementPrimaryProperty))
         [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
-    if ([self.dirtyPropertySet containsObject:@"userid"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUseridProperty))
         [dictionary setObject:(self.userid ? self.userid : [NSNull null]) forKey:@"userid"];
 
-    if ([self.dirtyPropertySet containsObject:@"username"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUsernameProperty))
         [dictionary setObject:(self.username ? self.username : [NSNull null]) forKey:@"username"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -304,6 +446,58 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementDomainProperty))
+    {
+        [writer writeKey:@"domain"];
+        [writer writeValue:self.domain];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementPrimaryProperty))
+    {
+        [writer writeKey:@"primary"];
+        [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUseridProperty))
+    {
+        [writer writeKey:@"userid"];
+        [writer writeValue:self.userid];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUsernameProperty))
+    {
+        [writer writeKey:@"username"];
+        [writer writeValue:self.username];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"domain"];
+    [writer writeValue:self.domain];
+
+    [writer writeKey:@"primary"];
+    [writer writeValue:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : nil)];
+
+    [writer writeKey:@"userid"];
+    [writer writeValue:self.userid];
+
+    [writer writeKey:@"username"];
+    [writer writeValue:self.username];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -312,6 +506,18 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementDomainProperty))
+        JRValidateCaptureAttribute(self.domain, @"domain", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUseridProperty))
+        JRValidateCaptureAttribute(self.userid, @"userid", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRAccountsElementUsernameProperty))
+        JRValidateCaptureAttribute(self.username, @"username", self.captureObjectPath, 0, 1000, violations);
+}
+
 - (BOOL)isEqualToAccountsElement:(JRAccountsElement *)otherAccountsElement
 {
     if (!self.domain && !otherAccountsElement.domain) /* Keep going... */;
@@ -346,4 +552,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRAccountsElement class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -40,23 +40,76 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRCaptureUser.h"
 
+enum
+{
+    JRCaptureUserAboutMeProperty,
+    JRCaptureUserBirthdayProperty,
+    JRCaptureUserCurrentLocationProperty,
+    JRCaptureUserDisplayProperty,
+    JRCaptureUserDisplayNameProperty,
+    JRCaptureUserEmailProperty,
+    JRCaptureUserEmailVerifiedProperty,
+    JRCaptureUserFamilyNameProperty,
+    JRCaptureUserGenderProperty,
+    JRCaptureUserGivenNameProperty,
+    JRCaptureUserLastLoginProperty,
+    JRCaptureUserMiddleNameProperty,
+    JRCaptureUserPasswordProperty,
+    JRCaptureUserPrimaryAddressProperty,
+    JRCaptureUserCaptureUserIdProperty,
+    JRCaptureUserLastUpdatedProperty,
+    JRCaptureUserUuidProperty,
+    JRCaptureUserCreatedProperty,
+    JRCaptureUserPropertyCount
+};
+
+static const char *const JRCaptureUserPropertyNames[] =
+{
+    "aboutMe",
+    "birthday",
+    "currentLocation",
+    "display",
+    "displayName",
+    "email",
+    "emailVerified",
+    "familyName",
+    "gender",
+    "givenName",
+    "lastLogin",
+    "middleName",
+    "password",
+    "primaryAddress",
+    "captureUserId",
+    "lastUpdated",
+    "uuid",
+    "created",
+};
+
 @interface JRPhotosElement (JRPhotosElement_InternalMethods)
 + (id)photosElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)photosElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)photosElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPhotosElement:(JRPhotosElement *)otherPhotosElement;
 @end
 
 @interface JRPrimaryAddress (JRPrimaryAddress_InternalMethods)
 + (id)primaryAddressObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)primaryAddressObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)primaryAddressObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPrimaryAddress:(JRPrimaryAddress *)otherPrimaryAddress;
 @end
 
 @interface JRProfilesElement (JRProfilesElement_InternalMethods)
 + (id)profilesElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)profilesElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)profilesElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToProfilesElement:(JRProfilesElement *)otherProfilesElement;
 @end
 
 @interface JRStatusesElement (JRStatusesElement_InternalMethods)
 + (id)statusesElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)statusesElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)statusesElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToStatusesElement:(JRStatusesElement *)otherStatusesElement;
 @end
 
@@ -100,6 +153,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPhotosElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPhotosElement class]])
+            [(JRPhotosElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPhotosElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPhotosArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPhotosElement *element = [JRPhotosElement photosElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPhotosArray addObject:element];
+    }
+
+    return filteredPhotosArray;
+}
+
+- (void)writePhotosElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPhotosElement class]])
+            [(JRPhotosElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPhotosElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPhotosArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPhotosElement *element = [JRPhotosElement photosElementFromArchive:reader];
+        if (element)
+            [filteredPhotosArray addObject:element];
+    }
+
+    return filteredPhotosArray;
+}
 @end
 
 @implementation NSArray (JRArray_Profiles_ToFromDictionary)
@@ -142,6 +245,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfProfilesElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRProfilesElement class]])
+            [(JRProfilesElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfProfilesElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredProfilesArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRProfilesElement *element = [JRProfilesElement profilesElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredProfilesArray addObject:element];
+    }
+
+    return filteredProfilesArray;
+}
+
+- (void)writeProfilesElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRProfilesElement class]])
+            [(JRProfilesElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfProfilesElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredProfilesArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRProfilesElement *element = [JRProfilesElement profilesElementFromArchive:reader];
+        if (element)
+            [filteredProfilesArray addObject:element];
+    }
+
+    return filteredProfilesArray;
+}
 @end
 
 @implementation NSArray (JRArray_Statuses_ToFromDictionary)
@@ -184,12 +337,65 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfStatusesElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRStatusesElement class]])
+            [(JRStatusesElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfStatusesElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredStatusesArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRStatusesElement *element = [JRStatusesElement statusesElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredStatusesArray addObject:element];
+    }
+
+    return filteredStatusesArray;
+}
+
+- (void)writeStatusesElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRStatusesElement class]])
+            [(JRStatusesElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfStatusesElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredStatusesArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRStatusesElement *element = [JRStatusesElement statusesElementFromArchive:reader];
+        if (element)
+            [filteredStatusesArray addObject:element];
+    }
+
+    return filteredStatusesArray;
+}
 @end
 
 @interface NSArray (CaptureUser_ArrayComparison)
 - (BOOL)isEqualToPhotosArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPhotosArray:(NSArray *)otherArray;
 - (BOOL)isEqualToProfilesArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToProfilesArray:(NSArray *)otherArray;
 - (BOOL)isEqualToStatusesArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToStatusesArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (CaptureUser_ArrayComparison)
@@ -205,6 +411,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToPhotosArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPhotosElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToProfilesArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -216,6 +433,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToProfilesArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRProfilesElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToStatusesArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -226,6 +454,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToStatusesArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRStatusesElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRCaptureUser ()
@@ -248,9 +487,14 @@
     NSString *_middleName;
     JRPassword *_password;
     NSArray *_photos;
+    NSArray *_photosJson;
     JRPrimaryAddress *_primaryAddress;
+    NSDictionary *_primaryAddressJson;
+    BOOL _primaryAddressJsonCleared;
     NSArray *_profiles;
+    NSArray *_profilesJson;
     NSArray *_statuses;
+    NSArray *_statusesJson;
     JRObjectId *_captureUserId;
     JRDateTime *_lastUpdated;
     JRUuid *_uuid;
@@ -258,6 +502,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRCaptureUserPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRCaptureUserPropertyCount;
+}
+
 - (NSString *)aboutMe
 {
     return _aboutMe;
@@ -265,7 +519,7 @@
 
 - (void)setAboutMe:(NSString *)newAboutMe
 {
-    [self.dirtyPropertySet addObject:@"aboutMe"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserAboutMeProperty);
 
     _aboutMe = [newAboutMe copy];
 }
@@ -277,7 +531,7 @@
 
 - (void)setBirthday:(JRDate *)newBirthday
 {
-    [self.dirtyPropertySet addObject:@"birthday"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBirthdayProperty);
 
     _birthday = [newBirthday copy];
 }
@@ -289,7 +543,7 @@
 
 - (void)setCurrentLocation:(NSString *)newCurrentLocation
 {
-    [self.dirtyPropertySet addObject:@"currentLocation"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCurrentLocationProperty);
 
     _currentLocation = [newCurrentLocation copy];
 }
@@ -301,7 +555,7 @@
 
 - (void)setDisplay:(JRJsonObject *)newDisplay
 {
-    [self.dirtyPropertySet addObject:@"display"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayProperty);
 
     _display = [newDisplay copy];
 }
@@ -313,7 +567,7 @@
 
 - (void)setDisplayName:(NSString *)newDisplayName
 {
-    [self.dirtyPropertySet addObject:@"displayName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayNameProperty);
 
     _displayName = [newDisplayName copy];
 }
@@ -325,7 +579,7 @@
 
 - (void)setEmail:(NSString *)newEmail
 {
-    [self.dirtyPropertySet addObject:@"email"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty);
 
     _email = [newEmail copy];
 }
@@ -337,7 +591,7 @@
 
 - (void)setEmailVerified:(JRDateTime *)newEmailVerified
 {
-    [self.dirtyPropertySet addObject:@"emailVerified"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailVerifiedProperty);
 
     _emailVerified = [newEmailVerified copy];
 }
@@ -349,7 +603,7 @@
 
 - (void)setFamilyName:(NSString *)newFamilyName
 {
-    [self.dirtyPropertySet addObject:@"familyName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserFamilyNameProperty);
 
     _familyName = [newFamilyName copy];
 }
@@ -361,7 +615,7 @@
 
 - (void)setGender:(NSString *)newGender
 {
-    [self.dirtyPropertySet addObject:@"gender"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGenderProperty);
 
     _gender = [newGender copy];
 }
@@ -373,7 +627,7 @@
 
 - (void)setGivenName:(NSString *)newGivenName
 {
-    [self.dirtyPropertySet addObject:@"givenName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGivenNameProperty);
 
     _givenName = [newGivenName copy];
 }
@@ -385,7 +639,7 @@
 
 - (void)setLastLogin:(JRDateTime *)newLastLogin
 {
-    [self.dirtyPropertySet addObject:@"lastLogin"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserLastLoginProperty);
 
     _lastLogin = [newLastLogin copy];
 }
@@ -397,7 +651,7 @@
 
 - (void)setMiddleName:(NSString *)newMiddleName
 {
-    [self.dirtyPropertySet addObject:@"middleName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserMiddleNameProperty);
 
     _middleName = [newMiddleName copy];
 }
@@ -409,29 +663,52 @@
 
 - (void)setPassword:(JRPassword *)newPassword
 {
-    [self.dirtyPropertySet addObject:@"password"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPasswordProperty);
 
     _password = [newPassword copy];
 }
 
 - (NSArray *)photos
 {
+    if (_photosJson)
+    {
+        NSArray *json = _photosJson;
+        _photosJson = nil;
+        _photos = [[json arrayOfPhotosElementsFromPhotosDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _photos;
 }
 
 - (void)setPhotos:(NSArray *)newPhotos
 {
+    _photosJson = nil;
+
     _photos = [newPhotos copy];
 }
 
 - (JRPrimaryAddress *)primaryAddress
 {
+    if (_primaryAddressJson)
+    {
+        NSDictionary *json = _primaryAddressJson;
+        _primaryAddressJson = nil;
+        _primaryAddress = [JRPrimaryAddress primaryAddressObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_primaryAddressJsonCleared)
+            [_primaryAddress deepClearDirtyProperties];
+        else
+            [_primaryAddress setAllPropertiesToDirty];
+    }
+
     return _primaryAddress;
 }
 
 - (void)setPrimaryAddress:(JRPrimaryAddress *)newPrimaryAddress
 {
-    [self.dirtyPropertySet addObject:@"primaryAddress"];
+    _primaryAddressJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPrimaryAddressProperty);
 
     _primaryAddress = newPrimaryAddress;
 
@@ -440,21 +717,39 @@
 
 - (NSArray *)profiles
 {
+    if (_profilesJson)
+    {
+        NSArray *json = _profilesJson;
+        _profilesJson = nil;
+        _profiles = [[json arrayOfProfilesElementsFromProfilesDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _profiles;
 }
 
 - (void)setProfiles:(NSArray *)newProfiles
 {
+    _profilesJson = nil;
+
     _profiles = [newProfiles copy];
 }
 
 - (NSArray *)statuses
 {
+    if (_statusesJson)
+    {
+        NSArray *json = _statusesJson;
+        _statusesJson = nil;
+        _statuses = [[json arrayOfStatusesElementsFromStatusesDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _statuses;
 }
 
 - (void)setStatuses:(NSArray *)newStatuses
 {
+    _statusesJson = nil;
+
     _statuses = [newStatuses copy];
 }
 
@@ -465,7 +760,7 @@
 
 - (void)setCaptureUserId:(JRObjectId *)newCaptureUserId
 {
-    [self.dirtyPropertySet addObject:@"captureUserId"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCaptureUserIdProperty);
 
     _captureUserId = [newCaptureUserId copy];
 }
@@ -477,7 +772,7 @@
 
 - (void)setLastUpdated:(JRDateTime *)newLastUpdated
 {
-    [self.dirtyPropertySet addObject:@"lastUpdated"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserLastUpdatedProperty);
 
     _lastUpdated = [newLastUpdated copy];
 }
@@ -489,7 +784,7 @@
 
 - (void)setUuid:(JRUuid *)newUuid
 {
-    [self.dirtyPropertySet addObject:@"uuid"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserUuidProperty);
 
     _uuid = [newUuid copy];
 }
@@ -501,7 +796,7 @@
 
 - (void)setCreated:(JRDateTime *)newCreated
 {
-    [self.dirtyPropertySet addObject:@"created"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCreatedProperty);
 
     _created = [newCreated copy];
 }
@@ -515,7 +810,7 @@
 
         _primaryAddress = [[JRPrimaryAddress alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -535,7 +830,7 @@
         _email = [newEmail copy];
         _primaryAddress = [[JRPrimaryAddress alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -626,6 +921,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     captureUser.aboutMe =
         [dictionary objectForKey:@"aboutMe"] != [NSNull null] ? 
         [dictionary objectForKey:@"aboutMe"] : nil;
@@ -678,21 +975,33 @@
         [dictionary objectForKey:@"password"] != [NSNull null] ? 
         [dictionary objectForKey:@"password"] : nil;
 
-    captureUser.photos =
-        [dictionary objectForKey:@"photos"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"photos"] arrayOfPhotosElementsFromPhotosDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"photos"] isKindOfClass:[NSArray class]])
+        captureUser->_photosJson = [dictionary objectForKey:@"photos"];
+    else
+        captureUser.photos =
+            [dictionary objectForKey:@"photos"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"photos"] arrayOfPhotosElementsFromPhotosDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.primaryAddress =
-        [dictionary objectForKey:@"primaryAddress"] != [NSNull null] ? 
-        [JRPrimaryAddress primaryAddressObjectFromDictionary:[dictionary objectForKey:@"primaryAddress"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"primaryAddress"] isKindOfClass:[NSDictionary class]])
+        captureUser->_primaryAddressJson = [dictionary objectForKey:@"primaryAddress"];
+    else
+        captureUser.primaryAddress =
+            [dictionary objectForKey:@"primaryAddress"] != [NSNull null] ? 
+            [JRPrimaryAddress primaryAddressObjectFromDictionary:[dictionary objectForKey:@"primaryAddress"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.profiles =
-        [dictionary objectForKey:@"profiles"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"profiles"] arrayOfProfilesElementsFromProfilesDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"profiles"] isKindOfClass:[NSArray class]])
+        captureUser->_profilesJson = [dictionary objectForKey:@"profiles"];
+    else
+        captureUser.profiles =
+            [dictionary objectForKey:@"profiles"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"profiles"] arrayOfProfilesElementsFromProfilesDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.statuses =
-        [dictionary objectForKey:@"statuses"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"statuses"] arrayOfStatusesElementsFromStatusesDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"statuses"] isKindOfClass:[NSArray class]])
+        captureUser->_statusesJson = [dictionary objectForKey:@"statuses"];
+    else
+        captureUser.statuses =
+            [dictionary objectForKey:@"statuses"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"statuses"] arrayOfStatusesElementsFromStatusesDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     captureUser.captureUserId =
         [dictionary objectForKey:@"id"] != [NSNull null] ? 
@@ -723,6 +1032,339 @@
     return [JRCaptureUser captureUserObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    captureUser.primaryAddress = nil;
+    captureUser.captureUserId = [NSNumber numberWithInteger:0];
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 6) & 63)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "email")) break;
+                value = [reader readValue];
+                captureUser.email = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "birthday")) break;
+                value = [reader readValue];
+                captureUser.birthday = value != [NSNull null] ? [JRDate dateFromISO8601DateString:value] : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "aboutMe")) break;
+                value = [reader readValue];
+                captureUser.aboutMe = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                captureUser.captureUserId = value != [NSNull null] ? [NSNumber numberWithInteger:[(NSNumber*)value integerValue]] : nil;
+                continue;
+            case 16:
+                if (!JRJsonKeyEquals(key, keyLength, "lastLogin")) break;
+                value = [reader readValue];
+                captureUser.lastLogin = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "primaryAddress")) break;
+                if (!lazily)
+                    captureUser.primaryAddress = [JRPrimaryAddress primaryAddressObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_primaryAddressJson = value;
+                continue;
+            case 18:
+                if (!JRJsonKeyEquals(key, keyLength, "lastUpdated")) break;
+                value = [reader readValue];
+                captureUser.lastUpdated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 19:
+                if (!JRJsonKeyEquals(key, keyLength, "display")) break;
+                value = [reader readValue];
+                captureUser.display = value != [NSNull null] ? value : nil;
+                continue;
+            case 21:
+                if (!JRJsonKeyEquals(key, keyLength, "created")) break;
+                value = [reader readValue];
+                captureUser.created = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "emailVerified")) break;
+                value = [reader readValue];
+                captureUser.emailVerified = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "gender")) break;
+                value = [reader readValue];
+                captureUser.gender = value != [NSNull null] ? value : nil;
+                continue;
+            case 29:
+                if (!JRJsonKeyEquals(key, keyLength, "middleName")) break;
+                value = [reader readValue];
+                captureUser.middleName = value != [NSNull null] ? value : nil;
+                continue;
+            case 39:
+                if (!JRJsonKeyEquals(key, keyLength, "givenName")) break;
+                value = [reader readValue];
+                captureUser.givenName = value != [NSNull null] ? value : nil;
+                continue;
+            case 40:
+                if (!JRJsonKeyEquals(key, keyLength, "familyName")) break;
+                value = [reader readValue];
+                captureUser.familyName = value != [NSNull null] ? value : nil;
+                continue;
+            case 42:
+                if (!JRJsonKeyEquals(key, keyLength, "photos")) break;
+                if (!lazily)
+                    captureUser.photos = [NSArray arrayOfPhotosElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_photosJson = value;
+                continue;
+            case 43:
+                if (!JRJsonKeyEquals(key, keyLength, "currentLocation")) break;
+                value = [reader readValue];
+                captureUser.currentLocation = value != [NSNull null] ? value : nil;
+                continue;
+            case 45:
+                if (!JRJsonKeyEquals(key, keyLength, "profiles")) break;
+                if (!lazily)
+                    captureUser.profiles = [NSArray arrayOfProfilesElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_profilesJson = value;
+                continue;
+            case 48:
+                if (!JRJsonKeyEquals(key, keyLength, "uuid")) break;
+                value = [reader readValue];
+                captureUser.uuid = value != [NSNull null] ? value : nil;
+                continue;
+            case 50:
+                if (!JRJsonKeyEquals(key, keyLength, "password")) break;
+                value = [reader readValue];
+                captureUser.password = value != [NSNull null] ? value : nil;
+                continue;
+            case 56:
+                if (!JRJsonKeyEquals(key, keyLength, "displayName")) break;
+                value = [reader readValue];
+                captureUser.displayName = value != [NSNull null] ? value : nil;
+                continue;
+            case 57:
+                if (!JRJsonKeyEquals(key, keyLength, "statuses")) break;
+                if (!lazily)
+                    captureUser.statuses = [NSArray arrayOfStatusesElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_statusesJson = value;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [captureUser.dirtyPropertySet removeAllObjects];
+
+    return captureUser;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"aboutMe"];
+    [writer writeValue:self.aboutMe];
+    [writer writeKey:@"birthday"];
+    [writer writeValue:(self.birthday ? [self.birthday stringFromISO8601Date] : nil)];
+    [writer writeKey:@"currentLocation"];
+    [writer writeValue:self.currentLocation];
+    [writer writeKey:@"display"];
+    [writer writeValue:self.display];
+    [writer writeKey:@"displayName"];
+    [writer writeValue:self.displayName];
+    [writer writeKey:@"email"];
+    [writer writeValue:self.email];
+    [writer writeKey:@"emailVerified"];
+    [writer writeValue:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"familyName"];
+    [writer writeValue:self.familyName];
+    [writer writeKey:@"gender"];
+    [writer writeValue:self.gender];
+    [writer writeKey:@"givenName"];
+    [writer writeValue:self.givenName];
+    [writer writeKey:@"lastLogin"];
+    [writer writeValue:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"middleName"];
+    [writer writeValue:self.middleName];
+    [writer writeKey:@"password"];
+    [writer writeValue:self.password];
+    [writer writeKey:@"photos"];
+    if (self.photos)
+        [self.photos writePhotosElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"primaryAddress"];
+    if (self.primaryAddress)
+        [self.primaryAddress writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"profiles"];
+    if (self.profiles)
+        [self.profiles writeProfilesElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"statuses"];
+    if (self.statuses)
+        [self.statuses writeStatusesElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"id"];
+    [writer writeValue:(self.captureUserId ? [NSNumber numberWithInteger:[self.captureUserId integerValue]] : nil)];
+    [writer writeKey:@"lastUpdated"];
+    [writer writeValue:(self.lastUpdated ? [self.lastUpdated stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"uuid"];
+    [writer writeValue:self.uuid];
+    [writer writeKey:@"created"];
+    [writer writeValue:(self.created ? [self.created stringFromISO8601DateTime] : nil)];
+    [writer endObject];
+}
+
++ (id)captureUserObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    captureUser.captureObjectPath = [reader readString];
+    captureUser.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 6) & 63)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "email")) break;
+                value = [reader readValue];
+                captureUser.email = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "birthday")) break;
+                value = [reader readValue];
+                captureUser.birthday = value != [NSNull null] ? [JRDate dateFromISO8601DateString:value] : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "aboutMe")) break;
+                value = [reader readValue];
+                captureUser.aboutMe = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                captureUser.captureUserId = value != [NSNull null] ? [NSNumber numberWithInteger:[(NSNumber*)value integerValue]] : nil;
+                continue;
+            case 16:
+                if (!JRJsonKeyEquals(key, keyLength, "lastLogin")) break;
+                value = [reader readValue];
+                captureUser.lastLogin = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "primaryAddress")) break;
+                captureUser.primaryAddress = [JRPrimaryAddress primaryAddressObjectFromArchive:reader];
+                continue;
+            case 18:
+                if (!JRJsonKeyEquals(key, keyLength, "lastUpdated")) break;
+                value = [reader readValue];
+                captureUser.lastUpdated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 19:
+                if (!JRJsonKeyEquals(key, keyLength, "display")) break;
+                value = [reader readValue];
+                captureUser.display = value != [NSNull null] ? value : nil;
+                continue;
+            case 21:
+                if (!JRJsonKeyEquals(key, keyLength, "created")) break;
+                value = [reader readValue];
+                captureUser.created = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 25:
+                if (!JRJsonKeyEquals(key, keyLength, "emailVerified")) break;
+                value = [reader readValue];
+                captureUser.emailVerified = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "gender")) break;
+                value = [reader readValue];
+                captureUser.gender = value != [NSNull null] ? value : nil;
+                continue;
+            case 29:
+                if (!JRJsonKeyEquals(key, keyLength, "middleName")) break;
+                value = [reader readValue];
+                captureUser.middleName = value != [NSNull null] ? value : nil;
+                continue;
+            case 39:
+                if (!JRJsonKeyEquals(key, keyLength, "givenName")) break;
+                value = [reader readValue];
+                captureUser.givenName = value != [NSNull null] ? value : nil;
+                continue;
+            case 40:
+                if (!JRJsonKeyEquals(key, keyLength, "familyName")) break;
+                value = [reader readValue];
+                captureUser.familyName = value != [NSNull null] ? value : nil;
+                continue;
+            case 42:
+                if (!JRJsonKeyEquals(key, keyLength, "photos")) break;
+                captureUser.photos = [NSArray arrayOfPhotosElementsFromArchive:reader];
+                continue;
+            case 43:
+                if (!JRJsonKeyEquals(key, keyLength, "currentLocation")) break;
+                value = [reader readValue];
+                captureUser.currentLocation = value != [NSNull null] ? value : nil;
+                continue;
+            case 45:
+                if (!JRJsonKeyEquals(key, keyLength, "profiles")) break;
+                captureUser.profiles = [NSArray arrayOfProfilesElementsFromArchive:reader];
+                continue;
+            case 48:
+                if (!JRJsonKeyEquals(key, keyLength, "uuid")) break;
+                value = [reader readValue];
+                captureUser.uuid = value != [NSNull null] ? value : nil;
+                continue;
+            case 50:
+                if (!JRJsonKeyEquals(key, keyLength, "password")) break;
+                value = [reader readValue];
+                captureUser.password = value != [NSNull null] ? value : nil;
+                continue;
+            case 56:
+                if (!JRJsonKeyEquals(key, keyLength, "displayName")) break;
+                value = [reader readValue];
+                captureUser.displayName = value != [NSNull null] ? value : nil;
+                continue;
+            case 57:
+                if (!JRJsonKeyEquals(key, keyLength, "statuses")) break;
+                captureUser.statuses = [NSArray arrayOfStatusesElementsFromArchive:reader];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [captureUser.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return captureUser;
+}
+
 - (void)decodeFromDictionary:(NSDictionary*)dictionary
 {
     NSSet *dirtyPropertySetCopy = [NSSet setWithArray:[dictionary objectForKey:@"dirtyPropertiesSet"]];
@@ -821,7 +1463,8 @@
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRCaptureUserPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -912,7 +1555,7 @@
         [dictionary objectForKey:@"created"] != [NSNull null] ? 
         [JRDateTime dateFromISO8601DateTimeString:[dictionary objectForKey:@"created"]] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -920,18 +1563,12 @@
     return [NSSet setWithObjects:@"aboutMe", @"birthday", @"currentLocation", @"display", @"displayName", @"email", @"emailVerified", @"familyName", @"gender", @"givenName", @"lastLogin", @"middleName", @"password", @"primaryAddress", @"captureUserId", @"lastUpdated", @"uuid", @"created", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"captureUser"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"captureUser"];
 
     if (self.primaryAddress)
         [snapshotDictionary setObject:[self.primaryAddress snapshotDictionaryFromDirtyPropertySet]
@@ -943,7 +1580,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"captureUser"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"captureUser"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"captureUser"]];
 
     if ([snapshotDictionary objectForKey:@"primaryAddress"])
         [self.primaryAddress restoreDirtyPropertiesFromSnapshotDictionary:
@@ -956,46 +1593,46 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"aboutMe"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserAboutMeProperty))
         [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null]) forKey:@"aboutMe"];
 
-    if ([self.dirtyPropertySet containsObject:@"birthday"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBirthdayProperty))
         [dictionary setObject:(self.birthday ? [self.birthday stringFromISO8601Date] : [NSNull null]) forKey:@"birthday"];
 
-    if ([self.dirtyPropertySet containsObject:@"currentLocation"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCurrentLocationProperty))
         [dictionary setObject:(self.currentLocation ? self.currentLocation : [NSNull null]) forKey:@"currentLocation"];
 
-    if ([self.dirtyPropertySet containsObject:@"display"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayProperty))
         [dictionary setObject:(self.display ? self.display : [NSNull null]) forKey:@"display"];
 
-    if ([self.dirtyPropertySet containsObject:@"displayName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayNameProperty))
         [dictionary setObject:(self.displayName ? self.displayName : [NSNull null]) forKey:@"displayName"];
 
-    if ([self.dirtyPropertySet containsObject:@"email"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty))
         [dictionary setObject:(self.email ? self.email : [NSNull null]) forKey:@"email"];
 
-    if ([self.dirtyPropertySet containsObject:@"emailVerified"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailVerifiedProperty))
         [dictionary setObject:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : [NSNull null]) forKey:@"emailVerified"];
 
-    if ([self.dirtyPropertySet containsObject:@"familyName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserFamilyNameProperty))
         [dictionary setObject:(self.familyName ? self.familyName : [NSNull null]) forKey:@"familyName"];
 
-    if ([self.dirtyPropertySet containsObject:@"gender"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGenderProperty))
         [dictionary setObject:(self.gender ? self.gender : [NSNull null]) forKey:@"gender"];
 
-    if ([self.dirtyPropertySet containsObject:@"givenName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGivenNameProperty))
         [dictionary setObject:(self.givenName ? self.givenName : [NSNull null]) forKey:@"givenName"];
 
-    if ([self.dirtyPropertySet containsObject:@"lastLogin"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserLastLoginProperty))
         [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
 
-    if ([self.dirtyPropertySet containsObject:@"middleName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserMiddleNameProperty))
         [dictionary setObject:(self.middleName ? self.middleName : [NSNull null]) forKey:@"middleName"];
 
-    if ([self.dirtyPropertySet containsObject:@"password"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPasswordProperty))
         [dictionary setObject:(self.password ? self.password : [NSNull null]) forKey:@"password"];
 
-    if ([self.dirtyPropertySet containsObject:@"primaryAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPrimaryAddressProperty))
         [dictionary setObject:(self.primaryAddress ?
                               [self.primaryAddress toUpdateDictionary] :
                               [[JRPrimaryAddress primaryAddress] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -1056,6 +1693,165 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserAboutMeProperty))
+    {
+        [writer writeKey:@"aboutMe"];
+        [writer writeValue:self.aboutMe];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBirthdayProperty))
+    {
+        [writer writeKey:@"birthday"];
+        [writer writeValue:(self.birthday ? [self.birthday stringFromISO8601Date] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCurrentLocationProperty))
+    {
+        [writer writeKey:@"currentLocation"];
+        [writer writeValue:self.currentLocation];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayProperty))
+    {
+        [writer writeKey:@"display"];
+        [writer writeValue:self.display];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayNameProperty))
+    {
+        [writer writeKey:@"displayName"];
+        [writer writeValue:self.displayName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty))
+    {
+        [writer writeKey:@"email"];
+        [writer writeValue:self.email];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailVerifiedProperty))
+    {
+        [writer writeKey:@"emailVerified"];
+        [writer writeValue:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserFamilyNameProperty))
+    {
+        [writer writeKey:@"familyName"];
+        [writer writeValue:self.familyName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGenderProperty))
+    {
+        [writer writeKey:@"gender"];
+        [writer writeValue:self.gender];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGivenNameProperty))
+    {
+        [writer writeKey:@"givenName"];
+        [writer writeValue:self.givenName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserLastLoginProperty))
+    {
+        [writer writeKey:@"lastLogin"];
+        [writer writeValue:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserMiddleNameProperty))
+    {
+        [writer writeKey:@"middleName"];
+        [writer writeValue:self.middleName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPasswordProperty))
+    {
+        [writer writeKey:@"password"];
+        [writer writeValue:self.password];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPrimaryAddressProperty))
+    {
+        [writer writeKey:@"primaryAddress"];
+        [(self.primaryAddress ? self.primaryAddress : [JRPrimaryAddress primaryAddress]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.primaryAddress needsUpdate])
+    {
+        [writer writeKey:@"primaryAddress"];
+        [self.primaryAddress writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"aboutMe"];
+    [writer writeValue:self.aboutMe];
+
+    [writer writeKey:@"birthday"];
+    [writer writeValue:(self.birthday ? [self.birthday stringFromISO8601Date] : nil)];
+
+    [writer writeKey:@"currentLocation"];
+    [writer writeValue:self.currentLocation];
+
+    [writer writeKey:@"display"];
+    [writer writeValue:self.display];
+
+    [writer writeKey:@"displayName"];
+    [writer writeValue:self.displayName];
+
+    [writer writeKey:@"email"];
+    [writer writeValue:self.email];
+
+    [writer writeKey:@"emailVerified"];
+    [writer writeValue:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : nil)];
+
+    [writer writeKey:@"familyName"];
+    [writer writeValue:self.familyName];
+
+    [writer writeKey:@"gender"];
+    [writer writeValue:self.gender];
+
+    [writer writeKey:@"givenName"];
+    [writer writeValue:self.givenName];
+
+    [writer writeKey:@"lastLogin"];
+    [writer writeValue:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : nil)];
+
+    [writer writeKey:@"middleName"];
+    [writer writeValue:self.middleName];
+
+    [writer writeKey:@"password"];
+    [writer writeValue:self.password];
+
+    [writer writeKey:@"photos"];
+    [(self.photos ? self.photos : [NSArray array]) writeReplaceJsonOfPhotosElementsToWriter:writer];
+
+    [writer writeKey:@"primaryAddress"];
+    if (self.primaryAddress)
+        [self.primaryAddress writeReplaceJsonToWriter:writer];
+    else
+        [[JRPrimaryAddress primaryAddress] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"profiles"];
+    [(self.profiles ? self.profiles : [NSArray array]) writeReplaceJsonOfProfilesElementsToWriter:writer];
+
+    [writer writeKey:@"statuses"];
+    [(self.statuses ? self.statuses : [NSArray array]) writeReplaceJsonOfStatusesElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePhotosArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.photos named:@"photos" isArrayOfStrings:NO
@@ -1085,6 +1881,45 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCurrentLocationProperty))
+        JRValidateCaptureAttribute(self.currentLocation, @"currentLocation", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserDisplayNameProperty))
+        JRValidateCaptureAttribute(self.displayName, @"displayName", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty))
+        JRValidateCaptureAttribute(self.email, @"email", self.captureObjectPath, JRCaptureAttributeRequired | JRCaptureAttributeEmailAddress, 256, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserFamilyNameProperty))
+        JRValidateCaptureAttribute(self.familyName, @"familyName", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGenderProperty))
+        JRValidateCaptureAttribute(self.gender, @"gender", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserGivenNameProperty))
+        JRValidateCaptureAttribute(self.givenName, @"givenName", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserMiddleNameProperty))
+        JRValidateCaptureAttribute(self.middleName, @"middleName", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 1000, violations);
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.photos)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_primaryAddressJson)
+        [self.primaryAddress validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.profiles)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.statuses)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser
 {
     if (!self.aboutMe && !otherCaptureUser.aboutMe) /* Keep going... */;
@@ -1192,4 +2027,36 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_primaryAddressJson)
+        _primaryAddressJsonCleared = YES;
+    else
+        [self.primaryAddress deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRCaptureUser class]]) return NO;
+
+    JRCaptureUser *otherCaptureUser = (JRCaptureUser *)otherObj;
+
+    if (self.photos && ![self.photos isEqualByPrivatePropertiesToPhotosArray:otherCaptureUser.photos])
+        return NO;
+
+    if (self.primaryAddress && ![self.primaryAddress isEqualByPrivateProperties:otherCaptureUser.primaryAddress])
+        return NO;
+
+    if (self.profiles && ![self.profiles isEqualByPrivatePropertiesToProfilesArray:otherCaptureUser.profiles])
+        return NO;
+
+    if (self.statuses && ![self.statuses isEqualByPrivatePropertiesToStatusesArray:otherCaptureUser.statuses])
+        return NO;
+
+    return YES;
+}
+
 @end
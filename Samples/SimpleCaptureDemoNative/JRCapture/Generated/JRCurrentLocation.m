@@ -40,6 +40,37 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRCurrentLocation.h"
 
+enum
+{
+    JRCurrentLocationCountryProperty,
+    JRCurrentLocationExtendedAddressProperty,
+    JRCurrentLocationFormattedProperty,
+    JRCurrentLocationLatitudeProperty,
+    JRCurrentLocationLocalityProperty,
+    JRCurrentLocationLongitudeProperty,
+    JRCurrentLocationPoBoxProperty,
+    JRCurrentLocationPostalCodeProperty,
+    JRCurrentLocationRegionProperty,
+    JRCurrentLocationStreetAddressProperty,
+    JRCurrentLocationTypeProperty,
+    JRCurrentLocationPropertyCount
+};
+
+static const char *const JRCurrentLocationPropertyNames[] =
+{
+    "country",
+    "extendedAddress",
+    "formatted",
+    "latitude",
+    "locality",
+    "longitude",
+    "poBox",
+    "postalCode",
+    "region",
+    "streetAddress",
+    "type",
+};
+
 @interface JRCurrentLocation ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -60,6 +91,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRCurrentLocationPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRCurrentLocationPropertyCount;
+}
+
 - (NSString *)country
 {
     return _country;
@@ -67,7 +108,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
-    [self.dirtyPropertySet addObject:@"country"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationCountryProperty);
 
     _country = [newCountry copy];
 }
@@ -79,7 +120,7 @@
 
 - (void)setExtendedAddress:(NSString *)newExtendedAddress
 {
-    [self.dirtyPropertySet addObject:@"extendedAddress"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationExtendedAddressProperty);
 
     _extendedAddress = [newExtendedAddress copy];
 }
@@ -91,7 +132,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
-    [self.dirtyPropertySet addObject:@"formatted"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationFormattedProperty);
 
     _formatted = [newFormatted copy];
 }
@@ -103,7 +144,7 @@
 
 - (void)setLatitude:(JRDecimal *)newLatitude
 {
-    [self.dirtyPropertySet addObject:@"latitude"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLatitudeProperty);
 
     _latitude = [newLatitude copy];
 }
@@ -115,7 +156,7 @@
 
 - (void)setLocality:(NSString *)newLocality
 {
-    [self.dirtyPropertySet addObject:@"locality"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLocalityProperty);
 
     _locality = [newLocality copy];
 }
@@ -127,7 +168,7 @@
 
 - (void)setLongitude:(JRDecimal *)newLongitude
 {
-    [self.dirtyPropertySet addObject:@"longitude"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLongitudeProperty);
 
     _longitude = [newLongitude copy];
 }
@@ -139,7 +180,7 @@
 
 - (void)setPoBox:(NSString *)newPoBox
 {
-    [self.dirtyPropertySet addObject:@"poBox"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPoBoxProperty);
 
     _poBox = [newPoBox copy];
 }
@@ -151,7 +192,7 @@
 
 - (void)setPostalCode:(NSString *)newPostalCode
 {
-    [self.dirtyPropertySet addObject:@"postalCode"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPostalCodeProperty);
 
     _postalCode = [newPostalCode copy];
 }
@@ -163,7 +204,7 @@
 
 - (void)setRegion:(NSString *)newRegion
 {
-    [self.dirtyPropertySet addObject:@"region"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationRegionProperty);
 
     _region = [newRegion copy];
 }
@@ -175,7 +216,7 @@
 
 - (void)setStreetAddress:(NSString *)newStreetAddress
 {
-    [self.dirtyPropertySet addObject:@"streetAddress"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationStreetAddressProperty);
 
     _streetAddress = [newStreetAddress copy];
 }
@@ -187,7 +228,7 @@
 
 - (void)setType:(NSString *)newType
 {
-    [self.dirtyPropertySet addObject:@"type"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationTypeProperty);
 
     _type = [newType copy];
 }
@@ -200,7 +241,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -329,11 +370,208 @@
     return [JRCurrentLocation currentLocationObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)currentLocationObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRCurrentLocation *currentLocation = [JRCurrentLocation currentLocation];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    currentLocation.captureObjectPath      = [NSString stringWithFormat:@"%@/%@", capturePath, @"currentLocation"];
+    currentLocation.canBeUpdatedOnCapture = YES;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 31)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "extendedAddress")) break;
+                value = [reader readValue];
+                currentLocation.extendedAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "formatted")) break;
+                value = [reader readValue];
+                currentLocation.formatted = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "latitude")) break;
+                value = [reader readValue];
+                currentLocation.latitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 9:
+                if (!JRJsonKeyEquals(key, keyLength, "poBox")) break;
+                value = [reader readValue];
+                currentLocation.poBox = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                currentLocation.type = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "longitude")) break;
+                value = [reader readValue];
+                currentLocation.longitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "country")) break;
+                value = [reader readValue];
+                currentLocation.country = value != [NSNull null] ? value : nil;
+                continue;
+            case 20:
+                if (!JRJsonKeyEquals(key, keyLength, "locality")) break;
+                value = [reader readValue];
+                currentLocation.locality = value != [NSNull null] ? value : nil;
+                continue;
+            case 22:
+                if (!JRJsonKeyEquals(key, keyLength, "streetAddress")) break;
+                value = [reader readValue];
+                currentLocation.streetAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 23:
+                if (!JRJsonKeyEquals(key, keyLength, "postalCode")) break;
+                value = [reader readValue];
+                currentLocation.postalCode = value != [NSNull null] ? value : nil;
+                continue;
+            case 29:
+                if (!JRJsonKeyEquals(key, keyLength, "region")) break;
+                value = [reader readValue];
+                currentLocation.region = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [currentLocation.dirtyPropertySet removeAllObjects];
+
+    return currentLocation;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"country"];
+    [writer writeValue:self.country];
+    [writer writeKey:@"extendedAddress"];
+    [writer writeValue:self.extendedAddress];
+    [writer writeKey:@"formatted"];
+    [writer writeValue:self.formatted];
+    [writer writeKey:@"latitude"];
+    [writer writeValue:self.latitude];
+    [writer writeKey:@"locality"];
+    [writer writeValue:self.locality];
+    [writer writeKey:@"longitude"];
+    [writer writeValue:self.longitude];
+    [writer writeKey:@"poBox"];
+    [writer writeValue:self.poBox];
+    [writer writeKey:@"postalCode"];
+    [writer writeValue:self.postalCode];
+    [writer writeKey:@"region"];
+    [writer writeValue:self.region];
+    [writer writeKey:@"streetAddress"];
+    [writer writeValue:self.streetAddress];
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+    [writer endObject];
+}
+
++ (id)currentLocationObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRCurrentLocation *currentLocation = [JRCurrentLocation currentLocation];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    currentLocation.captureObjectPath = [reader readString];
+    currentLocation.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 31)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "extendedAddress")) break;
+                value = [reader readValue];
+                currentLocation.extendedAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "formatted")) break;
+                value = [reader readValue];
+                currentLocation.formatted = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "latitude")) break;
+                value = [reader readValue];
+                currentLocation.latitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 9:
+                if (!JRJsonKeyEquals(key, keyLength, "poBox")) break;
+                value = [reader readValue];
+                currentLocation.poBox = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "type")) break;
+                value = [reader readValue];
+                currentLocation.type = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "longitude")) break;
+                value = [reader readValue];
+                currentLocation.longitude = value != [NSNull null] ? value : nil;
+                continue;
+            case 17:
+                if (!JRJsonKeyEquals(key, keyLength, "country")) break;
+                value = [reader readValue];
+                currentLocation.country = value != [NSNull null] ? value : nil;
+                continue;
+            case 20:
+                if (!JRJsonKeyEquals(key, keyLength, "locality")) break;
+                value = [reader readValue];
+                currentLocation.locality = value != [NSNull null] ? value : nil;
+                continue;
+            case 22:
+                if (!JRJsonKeyEquals(key, keyLength, "streetAddress")) break;
+                value = [reader readValue];
+                currentLocation.streetAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 23:
+                if (!JRJsonKeyEquals(key, keyLength, "postalCode")) break;
+                value = [reader readValue];
+                currentLocation.postalCode = value != [NSNull null] ? value : nil;
+                continue;
+            case 29:
+                if (!JRJsonKeyEquals(key, keyLength, "region")) break;
+                value = [reader readValue];
+                currentLocation.region = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [currentLocation.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return currentLocation;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRCurrentLocationPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"currentLocation"];
@@ -382,7 +620,7 @@
         [dictionary objectForKey:@"type"] != [NSNull null] ? 
         [dictionary objectForKey:@"type"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -390,18 +628,12 @@
     return [NSSet setWithObjects:@"country", @"extendedAddress", @"formatted", @"latitude", @"locality", @"longitude", @"poBox", @"postalCode", @"region", @"streetAddress", @"type", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"currentLocation"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"currentLocation"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -409,7 +641,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"currentLocation"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"currentLocation"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"currentLocation"]];
 
 }
 
@@ -418,37 +650,37 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"country"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationCountryProperty))
         [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
 
-    if ([self.dirtyPropertySet containsObject:@"extendedAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationExtendedAddressProperty))
         [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
 
-    if ([self.dirtyPropertySet containsObject:@"formatted"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationFormattedProperty))
         [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
 
-    if ([self.dirtyPropertySet containsObject:@"latitude"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLatitudeProperty))
         [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
 
-    if ([self.dirtyPropertySet containsObject:@"locality"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLocalityProperty))
         [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
 
-    if ([self.dirtyPropertySet containsObject:@"longitude"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLongitudeProperty))
         [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
 
-    if ([self.dirtyPropertySet containsObject:@"poBox"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPoBoxProperty))
         [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
 
-    if ([self.dirtyPropertySet containsObject:@"postalCode"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPostalCodeProperty))
         [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
 
-    if ([self.dirtyPropertySet containsObject:@"region"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationRegionProperty))
         [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
 
-    if ([self.dirtyPropertySet containsObject:@"streetAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationStreetAddressProperty))
         [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
 
-    if ([self.dirtyPropertySet containsObject:@"type"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationTypeProperty))
         [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -481,6 +713,121 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationCountryProperty))
+    {
+        [writer writeKey:@"country"];
+        [writer writeValue:self.country];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationExtendedAddressProperty))
+    {
+        [writer writeKey:@"extendedAddress"];
+        [writer writeValue:self.extendedAddress];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationFormattedProperty))
+    {
+        [writer writeKey:@"formatted"];
+        [writer writeValue:self.formatted];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLatitudeProperty))
+    {
+        [writer writeKey:@"latitude"];
+        [writer writeValue:self.latitude];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLocalityProperty))
+    {
+        [writer writeKey:@"locality"];
+        [writer writeValue:self.locality];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLongitudeProperty))
+    {
+        [writer writeKey:@"longitude"];
+        [writer writeValue:self.longitude];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPoBoxProperty))
+    {
+        [writer writeKey:@"poBox"];
+        [writer writeValue:self.poBox];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPostalCodeProperty))
+    {
+        [writer writeKey:@"postalCode"];
+        [writer writeValue:self.postalCode];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationRegionProperty))
+    {
+        [writer writeKey:@"region"];
+        [writer writeValue:self.region];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationStreetAddressProperty))
+    {
+        [writer writeKey:@"streetAddress"];
+        [writer writeValue:self.streetAddress];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationTypeProperty))
+    {
+        [writer writeKey:@"type"];
+        [writer writeValue:self.type];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"country"];
+    [writer writeValue:self.country];
+
+    [writer writeKey:@"extendedAddress"];
+    [writer writeValue:self.extendedAddress];
+
+    [writer writeKey:@"formatted"];
+    [writer writeValue:self.formatted];
+
+    [writer writeKey:@"latitude"];
+    [writer writeValue:self.latitude];
+
+    [writer writeKey:@"locality"];
+    [writer writeValue:self.locality];
+
+    [writer writeKey:@"longitude"];
+    [writer writeValue:self.longitude];
+
+    [writer writeKey:@"poBox"];
+    [writer writeValue:self.poBox];
+
+    [writer writeKey:@"postalCode"];
+    [writer writeValue:self.postalCode];
+
+    [writer writeKey:@"region"];
+    [writer writeValue:self.region];
+
+    [writer writeKey:@"streetAddress"];
+    [writer writeValue:self.streetAddress];
+
+    [writer writeKey:@"type"];
+    [writer writeValue:self.type];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -489,6 +836,33 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationCountryProperty))
+        JRValidateCaptureAttribute(self.country, @"country", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationExtendedAddressProperty))
+        JRValidateCaptureAttribute(self.extendedAddress, @"extendedAddress", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationFormattedProperty))
+        JRValidateCaptureAttribute(self.formatted, @"formatted", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationLocalityProperty))
+        JRValidateCaptureAttribute(self.locality, @"locality", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPoBoxProperty))
+        JRValidateCaptureAttribute(self.poBox, @"poBox", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationPostalCodeProperty))
+        JRValidateCaptureAttribute(self.postalCode, @"postalCode", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationRegionProperty))
+        JRValidateCaptureAttribute(self.region, @"region", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCurrentLocationStreetAddressProperty))
+        JRValidateCaptureAttribute(self.streetAddress, @"streetAddress", self.captureObjectPath, 0, 1000, violations);
+}
+
 - (BOOL)isEqualToCurrentLocation:(JRCurrentLocation *)otherCurrentLocation
 {
     if (!self.country && !otherCurrentLocation.country) /* Keep going... */;
@@ -558,4 +932,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRCurrentLocation class]]) return NO;
+
+    return YES;
+}
+
 @end
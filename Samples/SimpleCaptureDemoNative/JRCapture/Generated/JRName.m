@@ -40,6 +40,27 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRName.h"
 
+enum
+{
+    JRNameFamilyNameProperty,
+    JRNameFormattedProperty,
+    JRNameGivenNameProperty,
+    JRNameHonorificPrefixProperty,
+    JRNameHonorificSuffixProperty,
+    JRNameMiddleNameProperty,
+    JRNamePropertyCount
+};
+
+static const char *const JRNamePropertyNames[] =
+{
+    "familyName",
+    "formatted",
+    "givenName",
+    "honorificPrefix",
+    "honorificSuffix",
+    "middleName",
+};
+
 @interface JRName ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -55,6 +76,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRNamePropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRNamePropertyCount;
+}
+
 - (NSString *)familyName
 {
     return _familyName;
@@ -62,7 +93,7 @@
 
 - (void)setFamilyName:(NSString *)newFamilyName
 {
-    [self.dirtyPropertySet addObject:@"familyName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRNameFamilyNameProperty);
 
     _familyName = [newFamilyName copy];
 }
@@ -74,7 +105,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
-    [self.dirtyPropertySet addObject:@"formatted"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRNameFormattedProperty);
 
     _formatted = [newFormatted copy];
 }
@@ -86,7 +117,7 @@
 
 - (void)setGivenName:(NSString *)newGivenName
 {
-    [self.dirtyPropertySet addObject:@"givenName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRNameGivenNameProperty);
 
     _givenName = [newGivenName copy];
 }
@@ -98,7 +129,7 @@
 
 - (void)setHonorificPrefix:(NSString *)newHonorificPrefix
 {
-    [self.dirtyPropertySet addObject:@"honorificPrefix"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRNameHonorificPrefixProperty);
 
     _honorificPrefix = [newHonorificPrefix copy];
 }
@@ -110,7 +141,7 @@
 
 - (void)setHonorificSuffix:(NSString *)newHonorificSuffix
 {
-    [self.dirtyPropertySet addObject:@"honorificSuffix"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRNameHonorificSuffixProperty);
 
     _honorificSuffix = [newHonorificSuffix copy];
 }
@@ -122,7 +153,7 @@
 
 - (void)setMiddleName:(NSString *)newMiddleName
 {
-    [self.dirtyPropertySet addObject:@"middleName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRNameMiddleNameProperty);
 
     _middleName = [newMiddleName copy];
 }
@@ -135,7 +166,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -234,11 +265,148 @@
     return [JRName nameObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)nameObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRName *name = [JRName name];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    name.captureObjectPath      = [NSString stringWithFormat:@"%@/%@", capturePath, @"name"];
+    name.canBeUpdatedOnCapture = YES;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 2) & 15)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "middleName")) break;
+                value = [reader readValue];
+                name.middleName = value != [NSNull null] ? value : nil;
+                continue;
+            case 11:
+                if (!JRJsonKeyEquals(key, keyLength, "givenName")) break;
+                value = [reader readValue];
+                name.givenName = value != [NSNull null] ? value : nil;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "familyName")) break;
+                value = [reader readValue];
+                name.familyName = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "formatted")) break;
+                value = [reader readValue];
+                name.formatted = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "honorificPrefix")) break;
+                value = [reader readValue];
+                name.honorificPrefix = value != [NSNull null] ? value : nil;
+                continue;
+            case 15:
+                if (!JRJsonKeyEquals(key, keyLength, "honorificSuffix")) break;
+                value = [reader readValue];
+                name.honorificSuffix = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [name.dirtyPropertySet removeAllObjects];
+
+    return name;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"familyName"];
+    [writer writeValue:self.familyName];
+    [writer writeKey:@"formatted"];
+    [writer writeValue:self.formatted];
+    [writer writeKey:@"givenName"];
+    [writer writeValue:self.givenName];
+    [writer writeKey:@"honorificPrefix"];
+    [writer writeValue:self.honorificPrefix];
+    [writer writeKey:@"honorificSuffix"];
+    [writer writeValue:self.honorificSuffix];
+    [writer writeKey:@"middleName"];
+    [writer writeValue:self.middleName];
+    [writer endObject];
+}
+
++ (id)nameObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRName *name = [JRName name];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    name.captureObjectPath = [reader readString];
+    name.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 2) & 15)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "middleName")) break;
+                value = [reader readValue];
+                name.middleName = value != [NSNull null] ? value : nil;
+                continue;
+            case 11:
+                if (!JRJsonKeyEquals(key, keyLength, "givenName")) break;
+                value = [reader readValue];
+                name.givenName = value != [NSNull null] ? value : nil;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "familyName")) break;
+                value = [reader readValue];
+                name.familyName = value != [NSNull null] ? value : nil;
+                continue;
+            case 13:
+                if (!JRJsonKeyEquals(key, keyLength, "formatted")) break;
+                value = [reader readValue];
+                name.formatted = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "honorificPrefix")) break;
+                value = [reader readValue];
+                name.honorificPrefix = value != [NSNull null] ? value : nil;
+                continue;
+            case 15:
+                if (!JRJsonKeyEquals(key, keyLength, "honorificSuffix")) break;
+                value = [reader readValue];
+                name.honorificSuffix = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [name.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return name;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRNamePropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"name"];
@@ -267,7 +435,7 @@
         [dictionary objectForKey:@"middleName"] != [NSNull null] ? 
         [dictionary objectForKey:@"middleName"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -275,18 +443,12 @@
     return [NSSet setWithObjects:@"familyName", @"formatted", @"givenName", @"honorificPrefix", @"honorificSuffix", @"middleName", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"name"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"name"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -294,7 +456,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"name"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"name"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"name"]];
 
 }
 
@@ -303,22 +465,22 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"familyName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameFamilyNameProperty))
         [dictionary setObject:(self.familyName ? self.familyName : [NSNull null]) forKey:@"familyName"];
 
-    if ([self.dirtyPropertySet containsObject:@"formatted"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameFormattedProperty))
         [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
 
-    if ([self.dirtyPropertySet containsObject:@"givenName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameGivenNameProperty))
         [dictionary setObject:(self.givenName ? self.givenName : [NSNull null]) forKey:@"givenName"];
 
-    if ([self.dirtyPropertySet containsObject:@"honorificPrefix"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameHonorificPrefixProperty))
         [dictionary setObject:(self.honorificPrefix ? self.honorificPrefix : [NSNull null]) forKey:@"honorificPrefix"];
 
-    if ([self.dirtyPropertySet containsObject:@"honorificSuffix"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameHonorificSuffixProperty))
         [dictionary setObject:(self.honorificSuffix ? self.honorificSuffix : [NSNull null]) forKey:@"honorificSuffix"];
 
-    if ([self.dirtyPropertySet containsObject:@"middleName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameMiddleNameProperty))
         [dictionary setObject:(self.middleName ? self.middleName : [NSNull null]) forKey:@"middleName"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -346,6 +508,76 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameFamilyNameProperty))
+    {
+        [writer writeKey:@"familyName"];
+        [writer writeValue:self.familyName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameFormattedProperty))
+    {
+        [writer writeKey:@"formatted"];
+        [writer writeValue:self.formatted];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameGivenNameProperty))
+    {
+        [writer writeKey:@"givenName"];
+        [writer writeValue:self.givenName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameHonorificPrefixProperty))
+    {
+        [writer writeKey:@"honorificPrefix"];
+        [writer writeValue:self.honorificPrefix];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameHonorificSuffixProperty))
+    {
+        [writer writeKey:@"honorificSuffix"];
+        [writer writeValue:self.honorificSuffix];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRNameMiddleNameProperty))
+    {
+        [writer writeKey:@"middleName"];
+        [writer writeValue:self.middleName];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"familyName"];
+    [writer writeValue:self.familyName];
+
+    [writer writeKey:@"formatted"];
+    [writer writeValue:self.formatted];
+
+    [writer writeKey:@"givenName"];
+    [writer writeValue:self.givenName];
+
+    [writer writeKey:@"honorificPrefix"];
+    [writer writeValue:self.honorificPrefix];
+
+    [writer writeKey:@"honorificSuffix"];
+    [writer writeValue:self.honorificSuffix];
+
+    [writer writeKey:@"middleName"];
+    [writer writeValue:self.middleName];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -354,6 +586,21 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRNameFamilyNameProperty))
+        JRValidateCaptureAttribute(self.familyName, @"familyName", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRNameFormattedProperty))
+        JRValidateCaptureAttribute(self.formatted, @"formatted", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRNameGivenNameProperty))
+        JRValidateCaptureAttribute(self.givenName, @"givenName", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRNameMiddleNameProperty))
+        JRValidateCaptureAttribute(self.middleName, @"middleName", self.captureObjectPath, 0, 1000, violations);
+}
+
 - (BOOL)isEqualToName:(JRName *)otherName
 {
     if (!self.familyName && !otherName.familyName) /* Keep going... */;
@@ -398,4 +645,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRName class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -40,58 +40,151 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRProfile.h"
 
+enum
+{
+    JRProfileAboutMeProperty,
+    JRProfileAnniversaryProperty,
+    JRProfileBirthdayProperty,
+    JRProfileBodyTypeProperty,
+    JRProfileCurrentLocationProperty,
+    JRProfileDisplayNameProperty,
+    JRProfileDrinkerProperty,
+    JRProfileEthnicityProperty,
+    JRProfileFashionProperty,
+    JRProfileGenderProperty,
+    JRProfileHappiestWhenProperty,
+    JRProfileHumorProperty,
+    JRProfileLivingArrangementProperty,
+    JRProfileNameProperty,
+    JRProfileNicknameProperty,
+    JRProfileNoteProperty,
+    JRProfilePoliticalViewsProperty,
+    JRProfilePreferredUsernameProperty,
+    JRProfileProfileSongProperty,
+    JRProfileProfileUrlProperty,
+    JRProfileProfileVideoProperty,
+    JRProfilePublishedProperty,
+    JRProfileRelationshipStatusProperty,
+    JRProfileReligionProperty,
+    JRProfileRomanceProperty,
+    JRProfileScaredOfProperty,
+    JRProfileSexualOrientationProperty,
+    JRProfileSmokerProperty,
+    JRProfileStatusProperty,
+    JRProfileUpdatedProperty,
+    JRProfileUtcOffsetProperty,
+    JRProfilePropertyCount
+};
+
+static const char *const JRProfilePropertyNames[] =
+{
+    "aboutMe",
+    "anniversary",
+    "birthday",
+    "bodyType",
+    "currentLocation",
+    "displayName",
+    "drinker",
+    "ethnicity",
+    "fashion",
+    "gender",
+    "happiestWhen",
+    "humor",
+    "livingArrangement",
+    "name",
+    "nickname",
+    "note",
+    "politicalViews",
+    "preferredUsername",
+    "profileSong",
+    "profileUrl",
+    "profileVideo",
+    "published",
+    "relationshipStatus",
+    "religion",
+    "romance",
+    "scaredOf",
+    "sexualOrientation",
+    "smoker",
+    "status",
+    "updated",
+    "utcOffset",
+};
+
 @interface JRAccountsElement (JRAccountsElement_InternalMethods)
 + (id)accountsElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)accountsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)accountsElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToAccountsElement:(JRAccountsElement *)otherAccountsElement;
 @end
 
 @interface JRAddressesElement (JRAddressesElement_InternalMethods)
 + (id)addressesElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)addressesElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)addressesElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToAddressesElement:(JRAddressesElement *)otherAddressesElement;
 @end
 
 @interface JRBodyType (JRBodyType_InternalMethods)
 + (id)bodyTypeObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)bodyTypeObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)bodyTypeObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToBodyType:(JRBodyType *)otherBodyType;
 @end
 
 @interface JRCurrentLocation (JRCurrentLocation_InternalMethods)
 + (id)currentLocationObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)currentLocationObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)currentLocationObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToCurrentLocation:(JRCurrentLocation *)otherCurrentLocation;
 @end
 
 @interface JREmailsElement (JREmailsElement_InternalMethods)
 + (id)emailsElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)emailsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)emailsElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToEmailsElement:(JREmailsElement *)otherEmailsElement;
 @end
 
 @interface JRImsElement (JRImsElement_InternalMethods)
 + (id)imsElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)imsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)imsElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToImsElement:(JRImsElement *)otherImsElement;
 @end
 
 @interface JRName (JRName_InternalMethods)
 + (id)nameObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)nameObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)nameObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToName:(JRName *)otherName;
 @end
 
 @interface JROrganizationsElement (JROrganizationsElement_InternalMethods)
 + (id)organizationsElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)organizationsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)organizationsElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOrganizationsElement:(JROrganizationsElement *)otherOrganizationsElement;
 @end
 
 @interface JRPhoneNumbersElement (JRPhoneNumbersElement_InternalMethods)
 + (id)phoneNumbersElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)phoneNumbersElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)phoneNumbersElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPhoneNumbersElement:(JRPhoneNumbersElement *)otherPhoneNumbersElement;
 @end
 
 @interface JRProfilePhotosElement (JRProfilePhotosElement_InternalMethods)
 + (id)profilePhotosElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)profilePhotosElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)profilePhotosElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToProfilePhotosElement:(JRProfilePhotosElement *)otherProfilePhotosElement;
 @end
 
 @interface JRUrlsElement (JRUrlsElement_InternalMethods)
 + (id)urlsElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)urlsElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)urlsElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToUrlsElement:(JRUrlsElement *)otherUrlsElement;
 @end
 
@@ -135,6 +228,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfAccountsElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRAccountsElement class]])
+            [(JRAccountsElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfAccountsElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredAccountsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRAccountsElement *element = [JRAccountsElement accountsElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredAccountsArray addObject:element];
+    }
+
+    return filteredAccountsArray;
+}
+
+- (void)writeAccountsElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRAccountsElement class]])
+            [(JRAccountsElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfAccountsElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredAccountsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRAccountsElement *element = [JRAccountsElement accountsElementFromArchive:reader];
+        if (element)
+            [filteredAccountsArray addObject:element];
+    }
+
+    return filteredAccountsArray;
+}
 @end
 
 @implementation NSArray (JRArray_Addresses_ToFromDictionary)
@@ -177,6 +320,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfAddressesElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRAddressesElement class]])
+            [(JRAddressesElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfAddressesElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredAddressesArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRAddressesElement *element = [JRAddressesElement addressesElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredAddressesArray addObject:element];
+    }
+
+    return filteredAddressesArray;
+}
+
+- (void)writeAddressesElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRAddressesElement class]])
+            [(JRAddressesElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfAddressesElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredAddressesArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRAddressesElement *element = [JRAddressesElement addressesElementFromArchive:reader];
+        if (element)
+            [filteredAddressesArray addObject:element];
+    }
+
+    return filteredAddressesArray;
+}
 @end
 
 @implementation NSArray (JRArray_Emails_ToFromDictionary)
@@ -219,6 +412,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfEmailsElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JREmailsElement class]])
+            [(JREmailsElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfEmailsElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredEmailsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JREmailsElement *element = [JREmailsElement emailsElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredEmailsArray addObject:element];
+    }
+
+    return filteredEmailsArray;
+}
+
+- (void)writeEmailsElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JREmailsElement class]])
+            [(JREmailsElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfEmailsElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredEmailsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JREmailsElement *element = [JREmailsElement emailsElementFromArchive:reader];
+        if (element)
+            [filteredEmailsArray addObject:element];
+    }
+
+    return filteredEmailsArray;
+}
 @end
 
 @implementation NSArray (JRArray_Ims_ToFromDictionary)
@@ -261,6 +504,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfImsElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRImsElement class]])
+            [(JRImsElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfImsElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredImsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRImsElement *element = [JRImsElement imsElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredImsArray addObject:element];
+    }
+
+    return filteredImsArray;
+}
+
+- (void)writeImsElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRImsElement class]])
+            [(JRImsElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfImsElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredImsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRImsElement *element = [JRImsElement imsElementFromArchive:reader];
+        if (element)
+            [filteredImsArray addObject:element];
+    }
+
+    return filteredImsArray;
+}
 @end
 
 @implementation NSArray (JRArray_Organizations_ToFromDictionary)
@@ -303,6 +596,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfOrganizationsElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROrganizationsElement class]])
+            [(JROrganizationsElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOrganizationsElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOrganizationsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROrganizationsElement *element = [JROrganizationsElement organizationsElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredOrganizationsArray addObject:element];
+    }
+
+    return filteredOrganizationsArray;
+}
+
+- (void)writeOrganizationsElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROrganizationsElement class]])
+            [(JROrganizationsElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOrganizationsElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOrganizationsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROrganizationsElement *element = [JROrganizationsElement organizationsElementFromArchive:reader];
+        if (element)
+            [filteredOrganizationsArray addObject:element];
+    }
+
+    return filteredOrganizationsArray;
+}
 @end
 
 @implementation NSArray (JRArray_PhoneNumbers_ToFromDictionary)
@@ -345,6 +688,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPhoneNumbersElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPhoneNumbersElement class]])
+            [(JRPhoneNumbersElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPhoneNumbersElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPhoneNumbersArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPhoneNumbersElement *element = [JRPhoneNumbersElement phoneNumbersElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPhoneNumbersArray addObject:element];
+    }
+
+    return filteredPhoneNumbersArray;
+}
+
+- (void)writePhoneNumbersElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPhoneNumbersElement class]])
+            [(JRPhoneNumbersElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPhoneNumbersElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPhoneNumbersArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPhoneNumbersElement *element = [JRPhoneNumbersElement phoneNumbersElementFromArchive:reader];
+        if (element)
+            [filteredPhoneNumbersArray addObject:element];
+    }
+
+    return filteredPhoneNumbersArray;
+}
 @end
 
 @implementation NSArray (JRArray_ProfilePhotos_ToFromDictionary)
@@ -387,6 +780,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfProfilePhotosElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRProfilePhotosElement class]])
+            [(JRProfilePhotosElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfProfilePhotosElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredProfilePhotosArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRProfilePhotosElement *element = [JRProfilePhotosElement profilePhotosElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredProfilePhotosArray addObject:element];
+    }
+
+    return filteredProfilePhotosArray;
+}
+
+- (void)writeProfilePhotosElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRProfilePhotosElement class]])
+            [(JRProfilePhotosElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfProfilePhotosElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredProfilePhotosArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRProfilePhotosElement *element = [JRProfilePhotosElement profilePhotosElementFromArchive:reader];
+        if (element)
+            [filteredProfilePhotosArray addObject:element];
+    }
+
+    return filteredProfilePhotosArray;
+}
 @end
 
 @implementation NSArray (JRArray_Urls_ToFromDictionary)
@@ -429,17 +872,75 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfUrlsElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRUrlsElement class]])
+            [(JRUrlsElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfUrlsElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredUrlsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRUrlsElement *element = [JRUrlsElement urlsElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredUrlsArray addObject:element];
+    }
+
+    return filteredUrlsArray;
+}
+
+- (void)writeUrlsElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRUrlsElement class]])
+            [(JRUrlsElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfUrlsElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredUrlsArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRUrlsElement *element = [JRUrlsElement urlsElementFromArchive:reader];
+        if (element)
+            [filteredUrlsArray addObject:element];
+    }
+
+    return filteredUrlsArray;
+}
 @end
 
 @interface NSArray (Profile_ArrayComparison)
 - (BOOL)isEqualToAccountsArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToAccountsArray:(NSArray *)otherArray;
 - (BOOL)isEqualToAddressesArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToAddressesArray:(NSArray *)otherArray;
 - (BOOL)isEqualToEmailsArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToEmailsArray:(NSArray *)otherArray;
 - (BOOL)isEqualToImsArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToImsArray:(NSArray *)otherArray;
 - (BOOL)isEqualToOrganizationsArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToOrganizationsArray:(NSArray *)otherArray;
 - (BOOL)isEqualToPhoneNumbersArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPhoneNumbersArray:(NSArray *)otherArray;
 - (BOOL)isEqualToProfilePhotosArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToProfilePhotosArray:(NSArray *)otherArray;
 - (BOOL)isEqualToUrlsArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToUrlsArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (Profile_ArrayComparison)
@@ -455,6 +956,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToAccountsArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRAccountsElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToAddressesArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -466,6 +978,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToAddressesArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRAddressesElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToEmailsArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -477,6 +1000,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToEmailsArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JREmailsElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToImsArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -488,6 +1022,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToImsArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRImsElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToOrganizationsArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -499,6 +1044,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToOrganizationsArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JROrganizationsElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToPhoneNumbersArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -510,6 +1066,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToPhoneNumbersArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPhoneNumbersElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToProfilePhotosArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -521,6 +1088,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToProfilePhotosArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRProfilePhotosElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToUrlsArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -531,6 +1109,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToUrlsArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRUrlsElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRProfile ()
@@ -541,18 +1130,25 @@
 {
     NSString *_aboutMe;
     NSArray *_accounts;
+    NSArray *_accountsJson;
     JRStringArray *_activities;
     NSArray *_addresses;
+    NSArray *_addressesJson;
     JRDate *_anniversary;
     NSString *_birthday;
     JRBodyType *_bodyType;
+    NSDictionary *_bodyTypeJson;
+    BOOL _bodyTypeJsonCleared;
     JRStringArray *_books;
     JRStringArray *_cars;
     JRStringArray *_children;
     JRCurrentLocation *_currentLocation;
+    NSDictionary *_currentLocationJson;
+    BOOL _currentLocationJsonCleared;
     NSString *_displayName;
     NSString *_drinker;
     NSArray *_emails;
+    NSArray *_emailsJson;
     NSString *_ethnicity;
     NSString *_fashion;
     JRStringArray *_food;
@@ -561,6 +1157,7 @@
     JRStringArray *_heroes;
     NSString *_humor;
     NSArray *_ims;
+    NSArray *_imsJson;
     JRStringArray *_interestedInMeeting;
     JRStringArray *_interests;
     JRStringArray *_jobInterests;
@@ -571,12 +1168,17 @@
     JRStringArray *_movies;
     JRStringArray *_music;
     JRName *_name;
+    NSDictionary *_nameJson;
+    BOOL _nameJsonCleared;
     NSString *_nickname;
     NSString *_note;
     NSArray *_organizations;
+    NSArray *_organizationsJson;
     JRStringArray *_pets;
     NSArray *_phoneNumbers;
+    NSArray *_phoneNumbersJson;
     NSArray *_profilePhotos;
+    NSArray *_profilePhotosJson;
     NSString *_politicalViews;
     NSString *_preferredUsername;
     NSString *_profileSong;
@@ -599,10 +1201,21 @@
     JRStringArray *_tvShows;
     JRDateTime *_updated;
     NSArray *_urls;
+    NSArray *_urlsJson;
     NSString *_utcOffset;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRProfilePropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRProfilePropertyCount;
+}
+
 - (NSString *)aboutMe
 {
     return _aboutMe;
@@ -610,18 +1223,27 @@
 
 - (void)setAboutMe:(NSString *)newAboutMe
 {
-    [self.dirtyPropertySet addObject:@"aboutMe"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileAboutMeProperty);
 
     _aboutMe = [newAboutMe copy];
 }
 
 - (NSArray *)accounts
 {
+    if (_accountsJson)
+    {
+        NSArray *json = _accountsJson;
+        _accountsJson = nil;
+        _accounts = [[json arrayOfAccountsElementsFromAccountsDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _accounts;
 }
 
 - (void)setAccounts:(NSArray *)newAccounts
 {
+    _accountsJson = nil;
+
     _accounts = [newAccounts copy];
 }
 
@@ -637,11 +1259,20 @@
 
 - (NSArray *)addresses
 {
+    if (_addressesJson)
+    {
+        NSArray *json = _addressesJson;
+        _addressesJson = nil;
+        _addresses = [[json arrayOfAddressesElementsFromAddressesDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _addresses;
 }
 
 - (void)setAddresses:(NSArray *)newAddresses
 {
+    _addressesJson = nil;
+
     _addresses = [newAddresses copy];
 }
 
@@ -652,7 +1283,7 @@
 
 - (void)setAnniversary:(JRDate *)newAnniversary
 {
-    [self.dirtyPropertySet addObject:@"anniversary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileAnniversaryProperty);
 
     _anniversary = [newAnniversary copy];
 }
@@ -664,19 +1295,33 @@
 
 - (void)setBirthday:(NSString *)newBirthday
 {
-    [self.dirtyPropertySet addObject:@"birthday"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileBirthdayProperty);
 
     _birthday = [newBirthday copy];
 }
 
 - (JRBodyType *)bodyType
 {
+    if (_bodyTypeJson)
+    {
+        NSDictionary *json = _bodyTypeJson;
+        _bodyTypeJson = nil;
+        _bodyType = [JRBodyType bodyTypeObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_bodyTypeJsonCleared)
+            [_bodyType deepClearDirtyProperties];
+        else
+            [_bodyType setAllPropertiesToDirty];
+    }
+
     return _bodyType;
 }
 
 - (void)setBodyType:(JRBodyType *)newBodyType
 {
-    [self.dirtyPropertySet addObject:@"bodyType"];
+    _bodyTypeJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileBodyTypeProperty);
 
     _bodyType = newBodyType;
 
@@ -715,12 +1360,26 @@
 
 - (JRCurrentLocation *)currentLocation
 {
+    if (_currentLocationJson)
+    {
+        NSDictionary *json = _currentLocationJson;
+        _currentLocationJson = nil;
+        _currentLocation = [JRCurrentLocation currentLocationObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_currentLocationJsonCleared)
+            [_currentLocation deepClearDirtyProperties];
+        else
+            [_currentLocation setAllPropertiesToDirty];
+    }
+
     return _currentLocation;
 }
 
 - (void)setCurrentLocation:(JRCurrentLocation *)newCurrentLocation
 {
-    [self.dirtyPropertySet addObject:@"currentLocation"];
+    _currentLocationJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileCurrentLocationProperty);
 
     _currentLocation = newCurrentLocation;
 
@@ -734,7 +1393,7 @@
 
 - (void)setDisplayName:(NSString *)newDisplayName
 {
-    [self.dirtyPropertySet addObject:@"displayName"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileDisplayNameProperty);
 
     _displayName = [newDisplayName copy];
 }
@@ -746,18 +1405,27 @@
 
 - (void)setDrinker:(NSString *)newDrinker
 {
-    [self.dirtyPropertySet addObject:@"drinker"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileDrinkerProperty);
 
     _drinker = [newDrinker copy];
 }
 
 - (NSArray *)emails
 {
+    if (_emailsJson)
+    {
+        NSArray *json = _emailsJson;
+        _emailsJson = nil;
+        _emails = [[json arrayOfEmailsElementsFromEmailsDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _emails;
 }
 
 - (void)setEmails:(NSArray *)newEmails
 {
+    _emailsJson = nil;
+
     _emails = [newEmails copy];
 }
 
@@ -768,7 +1436,7 @@
 
 - (void)setEthnicity:(NSString *)newEthnicity
 {
-    [self.dirtyPropertySet addObject:@"ethnicity"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileEthnicityProperty);
 
     _ethnicity = [newEthnicity copy];
 }
@@ -780,7 +1448,7 @@
 
 - (void)setFashion:(NSString *)newFashion
 {
-    [self.dirtyPropertySet addObject:@"fashion"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileFashionProperty);
 
     _fashion = [newFashion copy];
 }
@@ -802,7 +1470,7 @@
 
 - (void)setGender:(NSString *)newGender
 {
-    [self.dirtyPropertySet addObject:@"gender"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileGenderProperty);
 
     _gender = [newGender copy];
 }
@@ -814,7 +1482,7 @@
 
 - (void)setHappiestWhen:(NSString *)newHappiestWhen
 {
-    [self.dirtyPropertySet addObject:@"happiestWhen"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileHappiestWhenProperty);
 
     _happiestWhen = [newHappiestWhen copy];
 }
@@ -836,18 +1504,27 @@
 
 - (void)setHumor:(NSString *)newHumor
 {
-    [self.dirtyPropertySet addObject:@"humor"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileHumorProperty);
 
     _humor = [newHumor copy];
 }
 
 - (NSArray *)ims
 {
+    if (_imsJson)
+    {
+        NSArray *json = _imsJson;
+        _imsJson = nil;
+        _ims = [[json arrayOfImsElementsFromImsDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _ims;
 }
 
 - (void)setIms:(NSArray *)newIms
 {
+    _imsJson = nil;
+
     _ims = [newIms copy];
 }
 
@@ -908,7 +1585,7 @@
 
 - (void)setLivingArrangement:(NSString *)newLivingArrangement
 {
-    [self.dirtyPropertySet addObject:@"livingArrangement"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileLivingArrangementProperty);
 
     _livingArrangement = [newLivingArrangement copy];
 }
@@ -945,12 +1622,26 @@
 
 - (JRName *)name
 {
+    if (_nameJson)
+    {
+        NSDictionary *json = _nameJson;
+        _nameJson = nil;
+        _name = [JRName nameObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_nameJsonCleared)
+            [_name deepClearDirtyProperties];
+        else
+            [_name setAllPropertiesToDirty];
+    }
+
     return _name;
 }
 
 - (void)setName:(JRName *)newName
 {
-    [self.dirtyPropertySet addObject:@"name"];
+    _nameJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileNameProperty);
 
     _name = newName;
 
@@ -964,7 +1655,7 @@
 
 - (void)setNickname:(NSString *)newNickname
 {
-    [self.dirtyPropertySet addObject:@"nickname"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileNicknameProperty);
 
     _nickname = [newNickname copy];
 }
@@ -976,18 +1667,27 @@
 
 - (void)setNote:(NSString *)newNote
 {
-    [self.dirtyPropertySet addObject:@"note"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileNoteProperty);
 
     _note = [newNote copy];
 }
 
 - (NSArray *)organizations
 {
+    if (_organizationsJson)
+    {
+        NSArray *json = _organizationsJson;
+        _organizationsJson = nil;
+        _organizations = [[json arrayOfOrganizationsElementsFromOrganizationsDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _organizations;
 }
 
 - (void)setOrganizations:(NSArray *)newOrganizations
 {
+    _organizationsJson = nil;
+
     _organizations = [newOrganizations copy];
 }
 
@@ -1003,21 +1703,39 @@
 
 - (NSArray *)phoneNumbers
 {
+    if (_phoneNumbersJson)
+    {
+        NSArray *json = _phoneNumbersJson;
+        _phoneNumbersJson = nil;
+        _phoneNumbers = [[json arrayOfPhoneNumbersElementsFromPhoneNumbersDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _phoneNumbers;
 }
 
 - (void)setPhoneNumbers:(NSArray *)newPhoneNumbers
 {
+    _phoneNumbersJson = nil;
+
     _phoneNumbers = [newPhoneNumbers copy];
 }
 
 - (NSArray *)profilePhotos
 {
+    if (_profilePhotosJson)
+    {
+        NSArray *json = _profilePhotosJson;
+        _profilePhotosJson = nil;
+        _profilePhotos = [[json arrayOfProfilePhotosElementsFromProfilePhotosDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _profilePhotos;
 }
 
 - (void)setProfilePhotos:(NSArray *)newProfilePhotos
 {
+    _profilePhotosJson = nil;
+
     _profilePhotos = [newProfilePhotos copy];
 }
 
@@ -1028,7 +1746,7 @@
 
 - (void)setPoliticalViews:(NSString *)newPoliticalViews
 {
-    [self.dirtyPropertySet addObject:@"politicalViews"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilePoliticalViewsProperty);
 
     _politicalViews = [newPoliticalViews copy];
 }
@@ -1040,7 +1758,7 @@
 
 - (void)setPreferredUsername:(NSString *)newPreferredUsername
 {
-    [self.dirtyPropertySet addObject:@"preferredUsername"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilePreferredUsernameProperty);
 
     _preferredUsername = [newPreferredUsername copy];
 }
@@ -1052,7 +1770,7 @@
 
 - (void)setProfileSong:(NSString *)newProfileSong
 {
-    [self.dirtyPropertySet addObject:@"profileSong"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileProfileSongProperty);
 
     _profileSong = [newProfileSong copy];
 }
@@ -1064,7 +1782,7 @@
 
 - (void)setProfileUrl:(NSString *)newProfileUrl
 {
-    [self.dirtyPropertySet addObject:@"profileUrl"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileProfileUrlProperty);
 
     _profileUrl = [newProfileUrl copy];
 }
@@ -1076,7 +1794,7 @@
 
 - (void)setProfileVideo:(NSString *)newProfileVideo
 {
-    [self.dirtyPropertySet addObject:@"profileVideo"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileProfileVideoProperty);
 
     _profileVideo = [newProfileVideo copy];
 }
@@ -1088,7 +1806,7 @@
 
 - (void)setPublished:(JRDateTime *)newPublished
 {
-    [self.dirtyPropertySet addObject:@"published"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfilePublishedProperty);
 
     _published = [newPublished copy];
 }
@@ -1110,7 +1828,7 @@
 
 - (void)setRelationshipStatus:(NSString *)newRelationshipStatus
 {
-    [self.dirtyPropertySet addObject:@"relationshipStatus"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileRelationshipStatusProperty);
 
     _relationshipStatus = [newRelationshipStatus copy];
 }
@@ -1132,7 +1850,7 @@
 
 - (void)setReligion:(NSString *)newReligion
 {
-    [self.dirtyPropertySet addObject:@"religion"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileReligionProperty);
 
     _religion = [newReligion copy];
 }
@@ -1144,7 +1862,7 @@
 
 - (void)setRomance:(NSString *)newRomance
 {
-    [self.dirtyPropertySet addObject:@"romance"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileRomanceProperty);
 
     _romance = [newRomance copy];
 }
@@ -1156,7 +1874,7 @@
 
 - (void)setScaredOf:(NSString *)newScaredOf
 {
-    [self.dirtyPropertySet addObject:@"scaredOf"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileScaredOfProperty);
 
     _scaredOf = [newScaredOf copy];
 }
@@ -1168,7 +1886,7 @@
 
 - (void)setSexualOrientation:(NSString *)newSexualOrientation
 {
-    [self.dirtyPropertySet addObject:@"sexualOrientation"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileSexualOrientationProperty);
 
     _sexualOrientation = [newSexualOrientation copy];
 }
@@ -1180,7 +1898,7 @@
 
 - (void)setSmoker:(NSString *)newSmoker
 {
-    [self.dirtyPropertySet addObject:@"smoker"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileSmokerProperty);
 
     _smoker = [newSmoker copy];
 }
@@ -1202,7 +1920,7 @@
 
 - (void)setStatus:(NSString *)newStatus
 {
-    [self.dirtyPropertySet addObject:@"status"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileStatusProperty);
 
     _status = [newStatus copy];
 }
@@ -1254,18 +1972,27 @@
 
 - (void)setUpdated:(JRDateTime *)newUpdated
 {
-    [self.dirtyPropertySet addObject:@"updated"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileUpdatedProperty);
 
     _updated = [newUpdated copy];
 }
 
 - (NSArray *)urls
 {
+    if (_urlsJson)
+    {
+        NSArray *json = _urlsJson;
+        _urlsJson = nil;
+        _urls = [[json arrayOfUrlsElementsFromUrlsDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _urls;
 }
 
 - (void)setUrls:(NSArray *)newUrls
 {
+    _urlsJson = nil;
+
     _urls = [newUrls copy];
 }
 
@@ -1276,7 +2003,7 @@
 
 - (void)setUtcOffset:(NSString *)newUtcOffset
 {
-    [self.dirtyPropertySet addObject:@"utcOffset"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRProfileUtcOffsetProperty);
 
     _utcOffset = [newUtcOffset copy];
 }
@@ -1292,7 +2019,7 @@
         _currentLocation = [[JRCurrentLocation alloc] init];
         _name = [[JRName alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -1464,21 +2191,29 @@
         profile.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     profile.aboutMe =
         [dictionary objectForKey:@"aboutMe"] != [NSNull null] ? 
         [dictionary objectForKey:@"aboutMe"] : nil;
 
-    profile.accounts =
-        [dictionary objectForKey:@"accounts"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"accounts"] arrayOfAccountsElementsFromAccountsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"accounts"] isKindOfClass:[NSArray class]])
+        profile->_accountsJson = [dictionary objectForKey:@"accounts"];
+    else
+        profile.accounts =
+            [dictionary objectForKey:@"accounts"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"accounts"] arrayOfAccountsElementsFromAccountsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.activities =
         [dictionary objectForKey:@"activities"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"activities"] arrayOfStringsFromStringPluralDictionariesWithType:@"activity"] : nil;
 
-    profile.addresses =
-        [dictionary objectForKey:@"addresses"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"addresses"] arrayOfAddressesElementsFromAddressesDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"addresses"] isKindOfClass:[NSArray class]])
+        profile->_addressesJson = [dictionary objectForKey:@"addresses"];
+    else
+        profile.addresses =
+            [dictionary objectForKey:@"addresses"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"addresses"] arrayOfAddressesElementsFromAddressesDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.anniversary =
         [dictionary objectForKey:@"anniversary"] != [NSNull null] ? 
@@ -1488,9 +2223,12 @@
         [dictionary objectForKey:@"birthday"] != [NSNull null] ? 
         [dictionary objectForKey:@"birthday"] : nil;
 
-    profile.bodyType =
-        [dictionary objectForKey:@"bodyType"] != [NSNull null] ? 
-        [JRBodyType bodyTypeObjectFromDictionary:[dictionary objectForKey:@"bodyType"] withPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"bodyType"] isKindOfClass:[NSDictionary class]])
+        profile->_bodyTypeJson = [dictionary objectForKey:@"bodyType"];
+    else
+        profile.bodyType =
+            [dictionary objectForKey:@"bodyType"] != [NSNull null] ? 
+            [JRBodyType bodyTypeObjectFromDictionary:[dictionary objectForKey:@"bodyType"] withPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.books =
         [dictionary objectForKey:@"books"] != [NSNull null] ? 
@@ -1504,9 +2242,12 @@
         [dictionary objectForKey:@"children"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"children"] arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
 
-    profile.currentLocation =
-        [dictionary objectForKey:@"currentLocation"] != [NSNull null] ? 
-        [JRCurrentLocation currentLocationObjectFromDictionary:[dictionary objectForKey:@"currentLocation"] withPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"currentLocation"] isKindOfClass:[NSDictionary class]])
+        profile->_currentLocationJson = [dictionary objectForKey:@"currentLocation"];
+    else
+        profile.currentLocation =
+            [dictionary objectForKey:@"currentLocation"] != [NSNull null] ? 
+            [JRCurrentLocation currentLocationObjectFromDictionary:[dictionary objectForKey:@"currentLocation"] withPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.displayName =
         [dictionary objectForKey:@"displayName"] != [NSNull null] ? 
@@ -1516,9 +2257,12 @@
         [dictionary objectForKey:@"drinker"] != [NSNull null] ? 
         [dictionary objectForKey:@"drinker"] : nil;
 
-    profile.emails =
-        [dictionary objectForKey:@"emails"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"emails"] arrayOfEmailsElementsFromEmailsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"emails"] isKindOfClass:[NSArray class]])
+        profile->_emailsJson = [dictionary objectForKey:@"emails"];
+    else
+        profile.emails =
+            [dictionary objectForKey:@"emails"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"emails"] arrayOfEmailsElementsFromEmailsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.ethnicity =
         [dictionary objectForKey:@"ethnicity"] != [NSNull null] ? 
@@ -1548,9 +2292,12 @@
         [dictionary objectForKey:@"humor"] != [NSNull null] ? 
         [dictionary objectForKey:@"humor"] : nil;
 
-    profile.ims =
-        [dictionary objectForKey:@"ims"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"ims"] arrayOfImsElementsFromImsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"ims"] isKindOfClass:[NSArray class]])
+        profile->_imsJson = [dictionary objectForKey:@"ims"];
+    else
+        profile.ims =
+            [dictionary objectForKey:@"ims"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"ims"] arrayOfImsElementsFromImsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.interestedInMeeting =
         [dictionary objectForKey:@"interestedInMeeting"] != [NSNull null] ? 
@@ -1588,9 +2335,12 @@
         [dictionary objectForKey:@"music"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"music"] arrayOfStringsFromStringPluralDictionariesWithType:@"music"] : nil;
 
-    profile.name =
-        [dictionary objectForKey:@"name"] != [NSNull null] ? 
-        [JRName nameObjectFromDictionary:[dictionary objectForKey:@"name"] withPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"name"] isKindOfClass:[NSDictionary class]])
+        profile->_nameJson = [dictionary objectForKey:@"name"];
+    else
+        profile.name =
+            [dictionary objectForKey:@"name"] != [NSNull null] ? 
+            [JRName nameObjectFromDictionary:[dictionary objectForKey:@"name"] withPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.nickname =
         [dictionary objectForKey:@"nickname"] != [NSNull null] ? 
@@ -1600,21 +2350,30 @@
         [dictionary objectForKey:@"note"] != [NSNull null] ? 
         [dictionary objectForKey:@"note"] : nil;
 
-    profile.organizations =
-        [dictionary objectForKey:@"organizations"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"organizations"] arrayOfOrganizationsElementsFromOrganizationsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"organizations"] isKindOfClass:[NSArray class]])
+        profile->_organizationsJson = [dictionary objectForKey:@"organizations"];
+    else
+        profile.organizations =
+            [dictionary objectForKey:@"organizations"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"organizations"] arrayOfOrganizationsElementsFromOrganizationsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.pets =
         [dictionary objectForKey:@"pets"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pets"] arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
 
-    profile.phoneNumbers =
-        [dictionary objectForKey:@"phoneNumbers"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"phoneNumbers"] arrayOfPhoneNumbersElementsFromPhoneNumbersDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"phoneNumbers"] isKindOfClass:[NSArray class]])
+        profile->_phoneNumbersJson = [dictionary objectForKey:@"phoneNumbers"];
+    else
+        profile.phoneNumbers =
+            [dictionary objectForKey:@"phoneNumbers"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"phoneNumbers"] arrayOfPhoneNumbersElementsFromPhoneNumbersDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    profile.profilePhotos =
-        [dictionary objectForKey:@"photos"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"photos"] arrayOfProfilePhotosElementsFromProfilePhotosDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"photos"] isKindOfClass:[NSArray class]])
+        profile->_profilePhotosJson = [dictionary objectForKey:@"photos"];
+    else
+        profile.profilePhotos =
+            [dictionary objectForKey:@"photos"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"photos"] arrayOfProfilePhotosElementsFromProfilePhotosDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     profile.politicalViews =
         [dictionary objectForKey:@"politicalViews"] != [NSNull null] ? 
@@ -1700,32 +2459,881 @@
         [dictionary objectForKey:@"updated"] != [NSNull null] ? 
         [JRDateTime dateFromISO8601DateTimeString:[dictionary objectForKey:@"updated"]] : nil;
 
-    profile.urls =
-        [dictionary objectForKey:@"urls"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"urls"] arrayOfUrlsElementsFromUrlsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"urls"] isKindOfClass:[NSArray class]])
+        profile->_urlsJson = [dictionary objectForKey:@"urls"];
+    else
+        profile.urls =
+            [dictionary objectForKey:@"urls"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"urls"] arrayOfUrlsElementsFromUrlsDictionariesWithPath:profile.captureObjectPath fromDecoder:fromDecoder] : nil;
+
+    profile.utcOffset =
+        [dictionary objectForKey:@"utcOffset"] != [NSNull null] ? 
+        [dictionary objectForKey:@"utcOffset"] : nil;
+
+    if (fromDecoder)
+        [profile.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    else
+        [profile.dirtyPropertySet removeAllObjects];
+
+    return profile;
+}
+
++ (id)profileObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
+{
+    return [JRProfile profileObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
+}
+
++ (id)profileObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRProfile *profile = [JRProfile profile];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    profile.captureObjectPath      = [NSString stringWithFormat:@"%@/%@", capturePath, @"profile"];
+    profile.canBeUpdatedOnCapture = YES;
+
+    profile.bodyType = nil;
+    profile.currentLocation = nil;
+    profile.name = nil;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 50) & 511)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "movies")) break;
+                value = [reader readValue];
+                profile.movies = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"movie"] : nil;
+                continue;
+            case 38:
+                if (!JRJsonKeyEquals(key, keyLength, "gender")) break;
+                value = [reader readValue];
+                profile.gender = value != [NSNull null] ? value : nil;
+                continue;
+            case 51:
+                if (!JRJsonKeyEquals(key, keyLength, "lookingFor")) break;
+                value = [reader readValue];
+                profile.lookingFor = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
+                continue;
+            case 54:
+                if (!JRJsonKeyEquals(key, keyLength, "birthday")) break;
+                value = [reader readValue];
+                profile.birthday = value != [NSNull null] ? value : nil;
+                continue;
+            case 69:
+                if (!JRJsonKeyEquals(key, keyLength, "tvShows")) break;
+                value = [reader readValue];
+                profile.tvShows = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"tvShow"] : nil;
+                continue;
+            case 72:
+                if (!JRJsonKeyEquals(key, keyLength, "interestedInMeeting")) break;
+                value = [reader readValue];
+                profile.interestedInMeeting = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"interest"] : nil;
+                continue;
+            case 77:
+                if (!JRJsonKeyEquals(key, keyLength, "jobInterests")) break;
+                value = [reader readValue];
+                profile.jobInterests = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"jobInterest"] : nil;
+                continue;
+            case 79:
+                if (!JRJsonKeyEquals(key, keyLength, "food")) break;
+                value = [reader readValue];
+                profile.food = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"food"] : nil;
+                continue;
+            case 80:
+                if (!JRJsonKeyEquals(key, keyLength, "religion")) break;
+                value = [reader readValue];
+                profile.religion = value != [NSNull null] ? value : nil;
+                continue;
+            case 84:
+                if (!JRJsonKeyEquals(key, keyLength, "utcOffset")) break;
+                value = [reader readValue];
+                profile.utcOffset = value != [NSNull null] ? value : nil;
+                continue;
+            case 90:
+                if (!JRJsonKeyEquals(key, keyLength, "turnOns")) break;
+                value = [reader readValue];
+                profile.turnOns = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"turnOn"] : nil;
+                continue;
+            case 103:
+                if (!JRJsonKeyEquals(key, keyLength, "nickname")) break;
+                value = [reader readValue];
+                profile.nickname = value != [NSNull null] ? value : nil;
+                continue;
+            case 110:
+                if (!JRJsonKeyEquals(key, keyLength, "turnOffs")) break;
+                value = [reader readValue];
+                profile.turnOffs = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"turnOff"] : nil;
+                continue;
+            case 114:
+                if (!JRJsonKeyEquals(key, keyLength, "ims")) break;
+                if (!lazily)
+                    profile.ims = [NSArray arrayOfImsElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_imsJson = value;
+                continue;
+            case 121:
+                if (!JRJsonKeyEquals(key, keyLength, "phoneNumbers")) break;
+                if (!lazily)
+                    profile.phoneNumbers = [NSArray arrayOfPhoneNumbersElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_phoneNumbersJson = value;
+                continue;
+            case 126:
+                if (!JRJsonKeyEquals(key, keyLength, "interests")) break;
+                value = [reader readValue];
+                profile.interests = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"interest"] : nil;
+                continue;
+            case 127:
+                if (!JRJsonKeyEquals(key, keyLength, "currentLocation")) break;
+                if (!lazily)
+                    profile.currentLocation = [JRCurrentLocation currentLocationObjectFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    profile->_currentLocationJson = value;
+                continue;
+            case 141:
+                if (!JRJsonKeyEquals(key, keyLength, "happiestWhen")) break;
+                value = [reader readValue];
+                profile.happiestWhen = value != [NSNull null] ? value : nil;
+                continue;
+            case 150:
+                if (!JRJsonKeyEquals(key, keyLength, "quotes")) break;
+                value = [reader readValue];
+                profile.quotes = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"quote"] : nil;
+                continue;
+            case 162:
+                if (!JRJsonKeyEquals(key, keyLength, "emails")) break;
+                if (!lazily)
+                    profile.emails = [NSArray arrayOfEmailsElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_emailsJson = value;
+                continue;
+            case 167:
+                if (!JRJsonKeyEquals(key, keyLength, "relationshipStatus")) break;
+                value = [reader readValue];
+                profile.relationshipStatus = value != [NSNull null] ? value : nil;
+                continue;
+            case 188:
+                if (!JRJsonKeyEquals(key, keyLength, "displayName")) break;
+                value = [reader readValue];
+                profile.displayName = value != [NSNull null] ? value : nil;
+                continue;
+            case 193:
+                if (!JRJsonKeyEquals(key, keyLength, "status")) break;
+                value = [reader readValue];
+                profile.status = value != [NSNull null] ? value : nil;
+                continue;
+            case 204:
+                if (!JRJsonKeyEquals(key, keyLength, "preferredUsername")) break;
+                value = [reader readValue];
+                profile.preferredUsername = value != [NSNull null] ? value : nil;
+                continue;
+            case 222:
+                if (!JRJsonKeyEquals(key, keyLength, "smoker")) break;
+                value = [reader readValue];
+                profile.smoker = value != [NSNull null] ? value : nil;
+                continue;
+            case 223:
+                if (!JRJsonKeyEquals(key, keyLength, "published")) break;
+                value = [reader readValue];
+                profile.published = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 226:
+                if (!JRJsonKeyEquals(key, keyLength, "livingArrangement")) break;
+                value = [reader readValue];
+                profile.livingArrangement = value != [NSNull null] ? value : nil;
+                continue;
+            case 244:
+                if (!JRJsonKeyEquals(key, keyLength, "cars")) break;
+                value = [reader readValue];
+                profile.cars = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"car"] : nil;
+                continue;
+            case 254:
+                if (!JRJsonKeyEquals(key, keyLength, "languages")) break;
+                value = [reader readValue];
+                profile.languages = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"language"] : nil;
+                continue;
+            case 262:
+                if (!JRJsonKeyEquals(key, keyLength, "humor")) break;
+                value = [reader readValue];
+                profile.humor = value != [NSNull null] ? value : nil;
+                continue;
+            case 266:
+                if (!JRJsonKeyEquals(key, keyLength, "aboutMe")) break;
+                value = [reader readValue];
+                profile.aboutMe = value != [NSNull null] ? value : nil;
+                continue;
+            case 269:
+                if (!JRJsonKeyEquals(key, keyLength, "fashion")) break;
+                value = [reader readValue];
+                profile.fashion = value != [NSNull null] ? value : nil;
+                continue;
+            case 278:
+                if (!JRJsonKeyEquals(key, keyLength, "photos")) break;
+                if (!lazily)
+                    profile.profilePhotos = [NSArray arrayOfProfilePhotosElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_profilePhotosJson = value;
+                continue;
+            case 294:
+                if (!JRJsonKeyEquals(key, keyLength, "updated")) break;
+                value = [reader readValue];
+                profile.updated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 295:
+                if (!JRJsonKeyEquals(key, keyLength, "note")) break;
+                value = [reader readValue];
+                profile.note = value != [NSNull null] ? value : nil;
+                continue;
+            case 297:
+                if (!JRJsonKeyEquals(key, keyLength, "addresses")) break;
+                if (!lazily)
+                    profile.addresses = [NSArray arrayOfAddressesElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_addressesJson = value;
+                continue;
+            case 304:
+                if (!JRJsonKeyEquals(key, keyLength, "children")) break;
+                value = [reader readValue];
+                profile.children = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
+                continue;
+            case 336:
+                if (!JRJsonKeyEquals(key, keyLength, "languagesSpoken")) break;
+                value = [reader readValue];
+                profile.languagesSpoken = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"languageSpoken"] : nil;
+                continue;
+            case 348:
+                if (!JRJsonKeyEquals(key, keyLength, "sports")) break;
+                value = [reader readValue];
+                profile.sports = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"sport"] : nil;
+                continue;
+            case 355:
+                if (!JRJsonKeyEquals(key, keyLength, "books")) break;
+                value = [reader readValue];
+                profile.books = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"book"] : nil;
+                continue;
+            case 362:
+                if (!JRJsonKeyEquals(key, keyLength, "music")) break;
+                value = [reader readValue];
+                profile.music = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"music"] : nil;
+                continue;
+            case 368:
+                if (!JRJsonKeyEquals(key, keyLength, "romance")) break;
+                value = [reader readValue];
+                profile.romance = value != [NSNull null] ? value : nil;
+                continue;
+            case 369:
+                if (!JRJsonKeyEquals(key, keyLength, "profileSong")) break;
+                value = [reader readValue];
+                profile.profileSong = value != [NSNull null] ? value : nil;
+                continue;
+            case 371:
+                if (!JRJsonKeyEquals(key, keyLength, "accounts")) break;
+                if (!lazily)
+                    profile.accounts = [NSArray arrayOfAccountsElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_accountsJson = value;
+                continue;
+            case 375:
+                if (!JRJsonKeyEquals(key, keyLength, "bodyType")) break;
+                if (!lazily)
+                    profile.bodyType = [JRBodyType bodyTypeObjectFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    profile->_bodyTypeJson = value;
+                continue;
+            case 376:
+                if (!JRJsonKeyEquals(key, keyLength, "politicalViews")) break;
+                value = [reader readValue];
+                profile.politicalViews = value != [NSNull null] ? value : nil;
+                continue;
+            case 379:
+                if (!JRJsonKeyEquals(key, keyLength, "profileVideo")) break;
+                value = [reader readValue];
+                profile.profileVideo = value != [NSNull null] ? value : nil;
+                continue;
+            case 389:
+                if (!JRJsonKeyEquals(key, keyLength, "sexualOrientation")) break;
+                value = [reader readValue];
+                profile.sexualOrientation = value != [NSNull null] ? value : nil;
+                continue;
+            case 394:
+                if (!JRJsonKeyEquals(key, keyLength, "relationships")) break;
+                value = [reader readValue];
+                profile.relationships = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"relationship"] : nil;
+                continue;
+            case 399:
+                if (!JRJsonKeyEquals(key, keyLength, "anniversary")) break;
+                value = [reader readValue];
+                profile.anniversary = value != [NSNull null] ? [JRDate dateFromISO8601DateString:value] : nil;
+                continue;
+            case 400:
+                if (!JRJsonKeyEquals(key, keyLength, "ethnicity")) break;
+                value = [reader readValue];
+                profile.ethnicity = value != [NSNull null] ? value : nil;
+                continue;
+            case 409:
+                if (!JRJsonKeyEquals(key, keyLength, "profileUrl")) break;
+                value = [reader readValue];
+                profile.profileUrl = value != [NSNull null] ? value : nil;
+                continue;
+            case 417:
+                if (!JRJsonKeyEquals(key, keyLength, "organizations")) break;
+                if (!lazily)
+                    profile.organizations = [NSArray arrayOfOrganizationsElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_organizationsJson = value;
+                continue;
+            case 424:
+                if (!JRJsonKeyEquals(key, keyLength, "drinker")) break;
+                value = [reader readValue];
+                profile.drinker = value != [NSNull null] ? value : nil;
+                continue;
+            case 435:
+                if (!JRJsonKeyEquals(key, keyLength, "heroes")) break;
+                value = [reader readValue];
+                profile.heroes = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"hero"] : nil;
+                continue;
+            case 436:
+                if (!JRJsonKeyEquals(key, keyLength, "name")) break;
+                if (!lazily)
+                    profile.name = [JRName nameObjectFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    profile->_nameJson = value;
+                continue;
+            case 441:
+                if (!JRJsonKeyEquals(key, keyLength, "urls")) break;
+                if (!lazily)
+                    profile.urls = [NSArray arrayOfUrlsElementsFromJsonReader:reader withPath:profile.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    profile->_urlsJson = value;
+                continue;
+            case 454:
+                if (!JRJsonKeyEquals(key, keyLength, "scaredOf")) break;
+                value = [reader readValue];
+                profile.scaredOf = value != [NSNull null] ? value : nil;
+                continue;
+            case 458:
+                if (!JRJsonKeyEquals(key, keyLength, "tags")) break;
+                value = [reader readValue];
+                profile.tags = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"tag"] : nil;
+                continue;
+            case 477:
+                if (!JRJsonKeyEquals(key, keyLength, "pets")) break;
+                value = [reader readValue];
+                profile.pets = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
+                continue;
+            case 494:
+                if (!JRJsonKeyEquals(key, keyLength, "activities")) break;
+                value = [reader readValue];
+                profile.activities = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"activity"] : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [profile.dirtyPropertySet removeAllObjects];
+
+    return profile;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"aboutMe"];
+    [writer writeValue:self.aboutMe];
+    [writer writeKey:@"accounts"];
+    if (self.accounts)
+        [self.accounts writeAccountsElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"activities"];
+    [writer writeValue:self.activities];
+    [writer writeKey:@"addresses"];
+    if (self.addresses)
+        [self.addresses writeAddressesElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"anniversary"];
+    [writer writeValue:(self.anniversary ? [self.anniversary stringFromISO8601Date] : nil)];
+    [writer writeKey:@"birthday"];
+    [writer writeValue:self.birthday];
+    [writer writeKey:@"bodyType"];
+    if (self.bodyType)
+        [self.bodyType writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"books"];
+    [writer writeValue:self.books];
+    [writer writeKey:@"cars"];
+    [writer writeValue:self.cars];
+    [writer writeKey:@"children"];
+    [writer writeValue:self.children];
+    [writer writeKey:@"currentLocation"];
+    if (self.currentLocation)
+        [self.currentLocation writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"displayName"];
+    [writer writeValue:self.displayName];
+    [writer writeKey:@"drinker"];
+    [writer writeValue:self.drinker];
+    [writer writeKey:@"emails"];
+    if (self.emails)
+        [self.emails writeEmailsElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"ethnicity"];
+    [writer writeValue:self.ethnicity];
+    [writer writeKey:@"fashion"];
+    [writer writeValue:self.fashion];
+    [writer writeKey:@"food"];
+    [writer writeValue:self.food];
+    [writer writeKey:@"gender"];
+    [writer writeValue:self.gender];
+    [writer writeKey:@"happiestWhen"];
+    [writer writeValue:self.happiestWhen];
+    [writer writeKey:@"heroes"];
+    [writer writeValue:self.heroes];
+    [writer writeKey:@"humor"];
+    [writer writeValue:self.humor];
+    [writer writeKey:@"ims"];
+    if (self.ims)
+        [self.ims writeImsElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"interestedInMeeting"];
+    [writer writeValue:self.interestedInMeeting];
+    [writer writeKey:@"interests"];
+    [writer writeValue:self.interests];
+    [writer writeKey:@"jobInterests"];
+    [writer writeValue:self.jobInterests];
+    [writer writeKey:@"languages"];
+    [writer writeValue:self.languages];
+    [writer writeKey:@"languagesSpoken"];
+    [writer writeValue:self.languagesSpoken];
+    [writer writeKey:@"livingArrangement"];
+    [writer writeValue:self.livingArrangement];
+    [writer writeKey:@"lookingFor"];
+    [writer writeValue:self.lookingFor];
+    [writer writeKey:@"movies"];
+    [writer writeValue:self.movies];
+    [writer writeKey:@"music"];
+    [writer writeValue:self.music];
+    [writer writeKey:@"name"];
+    if (self.name)
+        [self.name writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"nickname"];
+    [writer writeValue:self.nickname];
+    [writer writeKey:@"note"];
+    [writer writeValue:self.note];
+    [writer writeKey:@"organizations"];
+    if (self.organizations)
+        [self.organizations writeOrganizationsElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pets"];
+    [writer writeValue:self.pets];
+    [writer writeKey:@"phoneNumbers"];
+    if (self.phoneNumbers)
+        [self.phoneNumbers writePhoneNumbersElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"photos"];
+    if (self.profilePhotos)
+        [self.profilePhotos writeProfilePhotosElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"politicalViews"];
+    [writer writeValue:self.politicalViews];
+    [writer writeKey:@"preferredUsername"];
+    [writer writeValue:self.preferredUsername];
+    [writer writeKey:@"profileSong"];
+    [writer writeValue:self.profileSong];
+    [writer writeKey:@"profileUrl"];
+    [writer writeValue:self.profileUrl];
+    [writer writeKey:@"profileVideo"];
+    [writer writeValue:self.profileVideo];
+    [writer writeKey:@"published"];
+    [writer writeValue:(self.published ? [self.published stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"quotes"];
+    [writer writeValue:self.quotes];
+    [writer writeKey:@"relationshipStatus"];
+    [writer writeValue:self.relationshipStatus];
+    [writer writeKey:@"relationships"];
+    [writer writeValue:self.relationships];
+    [writer writeKey:@"religion"];
+    [writer writeValue:self.religion];
+    [writer writeKey:@"romance"];
+    [writer writeValue:self.romance];
+    [writer writeKey:@"scaredOf"];
+    [writer writeValue:self.scaredOf];
+    [writer writeKey:@"sexualOrientation"];
+    [writer writeValue:self.sexualOrientation];
+    [writer writeKey:@"smoker"];
+    [writer writeValue:self.smoker];
+    [writer writeKey:@"sports"];
+    [writer writeValue:self.sports];
+    [writer writeKey:@"status"];
+    [writer writeValue:self.status];
+    [writer writeKey:@"tags"];
+    [writer writeValue:self.tags];
+    [writer writeKey:@"turnOffs"];
+    [writer writeValue:self.turnOffs];
+    [writer writeKey:@"turnOns"];
+    [writer writeValue:self.turnOns];
+    [writer writeKey:@"tvShows"];
+    [writer writeValue:self.tvShows];
+    [writer writeKey:@"updated"];
+    [writer writeValue:(self.updated ? [self.updated stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"urls"];
+    if (self.urls)
+        [self.urls writeUrlsElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"utcOffset"];
+    [writer writeValue:self.utcOffset];
+    [writer endObject];
+}
+
++ (id)profileObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
 
-    profile.utcOffset =
-        [dictionary objectForKey:@"utcOffset"] != [NSNull null] ? 
-        [dictionary objectForKey:@"utcOffset"] : nil;
+    JRProfile *profile = [JRProfile profile];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    profile.captureObjectPath = [reader readString];
+    profile.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 50) & 511)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "movies")) break;
+                value = [reader readValue];
+                profile.movies = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"movie"] : nil;
+                continue;
+            case 38:
+                if (!JRJsonKeyEquals(key, keyLength, "gender")) break;
+                value = [reader readValue];
+                profile.gender = value != [NSNull null] ? value : nil;
+                continue;
+            case 51:
+                if (!JRJsonKeyEquals(key, keyLength, "lookingFor")) break;
+                value = [reader readValue];
+                profile.lookingFor = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
+                continue;
+            case 54:
+                if (!JRJsonKeyEquals(key, keyLength, "birthday")) break;
+                value = [reader readValue];
+                profile.birthday = value != [NSNull null] ? value : nil;
+                continue;
+            case 69:
+                if (!JRJsonKeyEquals(key, keyLength, "tvShows")) break;
+                value = [reader readValue];
+                profile.tvShows = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"tvShow"] : nil;
+                continue;
+            case 72:
+                if (!JRJsonKeyEquals(key, keyLength, "interestedInMeeting")) break;
+                value = [reader readValue];
+                profile.interestedInMeeting = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"interest"] : nil;
+                continue;
+            case 77:
+                if (!JRJsonKeyEquals(key, keyLength, "jobInterests")) break;
+                value = [reader readValue];
+                profile.jobInterests = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"jobInterest"] : nil;
+                continue;
+            case 79:
+                if (!JRJsonKeyEquals(key, keyLength, "food")) break;
+                value = [reader readValue];
+                profile.food = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"food"] : nil;
+                continue;
+            case 80:
+                if (!JRJsonKeyEquals(key, keyLength, "religion")) break;
+                value = [reader readValue];
+                profile.religion = value != [NSNull null] ? value : nil;
+                continue;
+            case 84:
+                if (!JRJsonKeyEquals(key, keyLength, "utcOffset")) break;
+                value = [reader readValue];
+                profile.utcOffset = value != [NSNull null] ? value : nil;
+                continue;
+            case 90:
+                if (!JRJsonKeyEquals(key, keyLength, "turnOns")) break;
+                value = [reader readValue];
+                profile.turnOns = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"turnOn"] : nil;
+                continue;
+            case 103:
+                if (!JRJsonKeyEquals(key, keyLength, "nickname")) break;
+                value = [reader readValue];
+                profile.nickname = value != [NSNull null] ? value : nil;
+                continue;
+            case 110:
+                if (!JRJsonKeyEquals(key, keyLength, "turnOffs")) break;
+                value = [reader readValue];
+                profile.turnOffs = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"turnOff"] : nil;
+                continue;
+            case 114:
+                if (!JRJsonKeyEquals(key, keyLength, "ims")) break;
+                profile.ims = [NSArray arrayOfImsElementsFromArchive:reader];
+                continue;
+            case 121:
+                if (!JRJsonKeyEquals(key, keyLength, "phoneNumbers")) break;
+                profile.phoneNumbers = [NSArray arrayOfPhoneNumbersElementsFromArchive:reader];
+                continue;
+            case 126:
+                if (!JRJsonKeyEquals(key, keyLength, "interests")) break;
+                value = [reader readValue];
+                profile.interests = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"interest"] : nil;
+                continue;
+            case 127:
+                if (!JRJsonKeyEquals(key, keyLength, "currentLocation")) break;
+                profile.currentLocation = [JRCurrentLocation currentLocationObjectFromArchive:reader];
+                continue;
+            case 141:
+                if (!JRJsonKeyEquals(key, keyLength, "happiestWhen")) break;
+                value = [reader readValue];
+                profile.happiestWhen = value != [NSNull null] ? value : nil;
+                continue;
+            case 150:
+                if (!JRJsonKeyEquals(key, keyLength, "quotes")) break;
+                value = [reader readValue];
+                profile.quotes = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"quote"] : nil;
+                continue;
+            case 162:
+                if (!JRJsonKeyEquals(key, keyLength, "emails")) break;
+                profile.emails = [NSArray arrayOfEmailsElementsFromArchive:reader];
+                continue;
+            case 167:
+                if (!JRJsonKeyEquals(key, keyLength, "relationshipStatus")) break;
+                value = [reader readValue];
+                profile.relationshipStatus = value != [NSNull null] ? value : nil;
+                continue;
+            case 188:
+                if (!JRJsonKeyEquals(key, keyLength, "displayName")) break;
+                value = [reader readValue];
+                profile.displayName = value != [NSNull null] ? value : nil;
+                continue;
+            case 193:
+                if (!JRJsonKeyEquals(key, keyLength, "status")) break;
+                value = [reader readValue];
+                profile.status = value != [NSNull null] ? value : nil;
+                continue;
+            case 204:
+                if (!JRJsonKeyEquals(key, keyLength, "preferredUsername")) break;
+                value = [reader readValue];
+                profile.preferredUsername = value != [NSNull null] ? value : nil;
+                continue;
+            case 222:
+                if (!JRJsonKeyEquals(key, keyLength, "smoker")) break;
+                value = [reader readValue];
+                profile.smoker = value != [NSNull null] ? value : nil;
+                continue;
+            case 223:
+                if (!JRJsonKeyEquals(key, keyLength, "published")) break;
+                value = [reader readValue];
+                profile.published = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 226:
+                if (!JRJsonKeyEquals(key, keyLength, "livingArrangement")) break;
+                value = [reader readValue];
+                profile.livingArrangement = value != [NSNull null] ? value : nil;
+                continue;
+            case 244:
+                if (!JRJsonKeyEquals(key, keyLength, "cars")) break;
+                value = [reader readValue];
+                profile.cars = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"car"] : nil;
+                continue;
+            case 254:
+                if (!JRJsonKeyEquals(key, keyLength, "languages")) break;
+                value = [reader readValue];
+                profile.languages = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"language"] : nil;
+                continue;
+            case 262:
+                if (!JRJsonKeyEquals(key, keyLength, "humor")) break;
+                value = [reader readValue];
+                profile.humor = value != [NSNull null] ? value : nil;
+                continue;
+            case 266:
+                if (!JRJsonKeyEquals(key, keyLength, "aboutMe")) break;
+                value = [reader readValue];
+                profile.aboutMe = value != [NSNull null] ? value : nil;
+                continue;
+            case 269:
+                if (!JRJsonKeyEquals(key, keyLength, "fashion")) break;
+                value = [reader readValue];
+                profile.fashion = value != [NSNull null] ? value : nil;
+                continue;
+            case 278:
+                if (!JRJsonKeyEquals(key, keyLength, "photos")) break;
+                profile.profilePhotos = [NSArray arrayOfProfilePhotosElementsFromArchive:reader];
+                continue;
+            case 294:
+                if (!JRJsonKeyEquals(key, keyLength, "updated")) break;
+                value = [reader readValue];
+                profile.updated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 295:
+                if (!JRJsonKeyEquals(key, keyLength, "note")) break;
+                value = [reader readValue];
+                profile.note = value != [NSNull null] ? value : nil;
+                continue;
+            case 297:
+                if (!JRJsonKeyEquals(key, keyLength, "addresses")) break;
+                profile.addresses = [NSArray arrayOfAddressesElementsFromArchive:reader];
+                continue;
+            case 304:
+                if (!JRJsonKeyEquals(key, keyLength, "children")) break;
+                value = [reader readValue];
+                profile.children = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
+                continue;
+            case 336:
+                if (!JRJsonKeyEquals(key, keyLength, "languagesSpoken")) break;
+                value = [reader readValue];
+                profile.languagesSpoken = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"languageSpoken"] : nil;
+                continue;
+            case 348:
+                if (!JRJsonKeyEquals(key, keyLength, "sports")) break;
+                value = [reader readValue];
+                profile.sports = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"sport"] : nil;
+                continue;
+            case 355:
+                if (!JRJsonKeyEquals(key, keyLength, "books")) break;
+                value = [reader readValue];
+                profile.books = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"book"] : nil;
+                continue;
+            case 362:
+                if (!JRJsonKeyEquals(key, keyLength, "music")) break;
+                value = [reader readValue];
+                profile.music = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"music"] : nil;
+                continue;
+            case 368:
+                if (!JRJsonKeyEquals(key, keyLength, "romance")) break;
+                value = [reader readValue];
+                profile.romance = value != [NSNull null] ? value : nil;
+                continue;
+            case 369:
+                if (!JRJsonKeyEquals(key, keyLength, "profileSong")) break;
+                value = [reader readValue];
+                profile.profileSong = value != [NSNull null] ? value : nil;
+                continue;
+            case 371:
+                if (!JRJsonKeyEquals(key, keyLength, "accounts")) break;
+                profile.accounts = [NSArray arrayOfAccountsElementsFromArchive:reader];
+                continue;
+            case 375:
+                if (!JRJsonKeyEquals(key, keyLength, "bodyType")) break;
+                profile.bodyType = [JRBodyType bodyTypeObjectFromArchive:reader];
+                continue;
+            case 376:
+                if (!JRJsonKeyEquals(key, keyLength, "politicalViews")) break;
+                value = [reader readValue];
+                profile.politicalViews = value != [NSNull null] ? value : nil;
+                continue;
+            case 379:
+                if (!JRJsonKeyEquals(key, keyLength, "profileVideo")) break;
+                value = [reader readValue];
+                profile.profileVideo = value != [NSNull null] ? value : nil;
+                continue;
+            case 389:
+                if (!JRJsonKeyEquals(key, keyLength, "sexualOrientation")) break;
+                value = [reader readValue];
+                profile.sexualOrientation = value != [NSNull null] ? value : nil;
+                continue;
+            case 394:
+                if (!JRJsonKeyEquals(key, keyLength, "relationships")) break;
+                value = [reader readValue];
+                profile.relationships = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"relationship"] : nil;
+                continue;
+            case 399:
+                if (!JRJsonKeyEquals(key, keyLength, "anniversary")) break;
+                value = [reader readValue];
+                profile.anniversary = value != [NSNull null] ? [JRDate dateFromISO8601DateString:value] : nil;
+                continue;
+            case 400:
+                if (!JRJsonKeyEquals(key, keyLength, "ethnicity")) break;
+                value = [reader readValue];
+                profile.ethnicity = value != [NSNull null] ? value : nil;
+                continue;
+            case 409:
+                if (!JRJsonKeyEquals(key, keyLength, "profileUrl")) break;
+                value = [reader readValue];
+                profile.profileUrl = value != [NSNull null] ? value : nil;
+                continue;
+            case 417:
+                if (!JRJsonKeyEquals(key, keyLength, "organizations")) break;
+                profile.organizations = [NSArray arrayOfOrganizationsElementsFromArchive:reader];
+                continue;
+            case 424:
+                if (!JRJsonKeyEquals(key, keyLength, "drinker")) break;
+                value = [reader readValue];
+                profile.drinker = value != [NSNull null] ? value : nil;
+                continue;
+            case 435:
+                if (!JRJsonKeyEquals(key, keyLength, "heroes")) break;
+                value = [reader readValue];
+                profile.heroes = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"hero"] : nil;
+                continue;
+            case 436:
+                if (!JRJsonKeyEquals(key, keyLength, "name")) break;
+                profile.name = [JRName nameObjectFromArchive:reader];
+                continue;
+            case 441:
+                if (!JRJsonKeyEquals(key, keyLength, "urls")) break;
+                profile.urls = [NSArray arrayOfUrlsElementsFromArchive:reader];
+                continue;
+            case 454:
+                if (!JRJsonKeyEquals(key, keyLength, "scaredOf")) break;
+                value = [reader readValue];
+                profile.scaredOf = value != [NSNull null] ? value : nil;
+                continue;
+            case 458:
+                if (!JRJsonKeyEquals(key, keyLength, "tags")) break;
+                value = [reader readValue];
+                profile.tags = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"tag"] : nil;
+                continue;
+            case 477:
+                if (!JRJsonKeyEquals(key, keyLength, "pets")) break;
+                value = [reader readValue];
+                profile.pets = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"value"] : nil;
+                continue;
+            case 494:
+                if (!JRJsonKeyEquals(key, keyLength, "activities")) break;
+                value = [reader readValue];
+                profile.activities = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"activity"] : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
 
-    if (fromDecoder)
-        [profile.dirtyPropertySet setSet:dirtyPropertySetCopy];
-    else
-        [profile.dirtyPropertySet removeAllObjects];
+    [profile.dirtyPropertySet setSet:dirtyPropertySetCopy];
 
     return profile;
 }
 
-+ (id)profileObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
-{
-    return [JRProfile profileObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
-}
-
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRProfilePropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"profile"];
@@ -1983,7 +3591,7 @@
         [dictionary objectForKey:@"utcOffset"] != [NSNull null] ? 
         [dictionary objectForKey:@"utcOffset"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -1991,18 +3599,12 @@
     return [NSSet setWithObjects:@"aboutMe", @"anniversary", @"birthday", @"bodyType", @"currentLocation", @"displayName", @"drinker", @"ethnicity", @"fashion", @"gender", @"happiestWhen", @"humor", @"livingArrangement", @"name", @"nickname", @"note", @"politicalViews", @"preferredUsername", @"profileSong", @"profileUrl", @"profileVideo", @"published", @"relationshipStatus", @"religion", @"romance", @"scaredOf", @"sexualOrientation", @"smoker", @"status", @"updated", @"utcOffset", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"profile"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"profile"];
 
     if (self.bodyType)
         [snapshotDictionary setObject:[self.bodyType snapshotDictionaryFromDirtyPropertySet]
@@ -2022,7 +3624,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"profile"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"profile"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"profile"]];
 
     if ([snapshotDictionary objectForKey:@"bodyType"])
         [self.bodyType restoreDirtyPropertiesFromSnapshotDictionary:
@@ -2043,16 +3645,16 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"aboutMe"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileAboutMeProperty))
         [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null]) forKey:@"aboutMe"];
 
-    if ([self.dirtyPropertySet containsObject:@"anniversary"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileAnniversaryProperty))
         [dictionary setObject:(self.anniversary ? [self.anniversary stringFromISO8601Date] : [NSNull null]) forKey:@"anniversary"];
 
-    if ([self.dirtyPropertySet containsObject:@"birthday"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileBirthdayProperty))
         [dictionary setObject:(self.birthday ? self.birthday : [NSNull null]) forKey:@"birthday"];
 
-    if ([self.dirtyPropertySet containsObject:@"bodyType"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileBodyTypeProperty))
         [dictionary setObject:(self.bodyType ?
                               [self.bodyType toUpdateDictionary] :
                               [[JRBodyType bodyType] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2061,7 +3663,7 @@
         [dictionary setObject:[self.bodyType toUpdateDictionary]
                        forKey:@"bodyType"];
 
-    if ([self.dirtyPropertySet containsObject:@"currentLocation"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileCurrentLocationProperty))
         [dictionary setObject:(self.currentLocation ?
                               [self.currentLocation toUpdateDictionary] :
                               [[JRCurrentLocation currentLocation] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2070,31 +3672,31 @@
         [dictionary setObject:[self.currentLocation toUpdateDictionary]
                        forKey:@"currentLocation"];
 
-    if ([self.dirtyPropertySet containsObject:@"displayName"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileDisplayNameProperty))
         [dictionary setObject:(self.displayName ? self.displayName : [NSNull null]) forKey:@"displayName"];
 
-    if ([self.dirtyPropertySet containsObject:@"drinker"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileDrinkerProperty))
         [dictionary setObject:(self.drinker ? self.drinker : [NSNull null]) forKey:@"drinker"];
 
-    if ([self.dirtyPropertySet containsObject:@"ethnicity"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileEthnicityProperty))
         [dictionary setObject:(self.ethnicity ? self.ethnicity : [NSNull null]) forKey:@"ethnicity"];
 
-    if ([self.dirtyPropertySet containsObject:@"fashion"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileFashionProperty))
         [dictionary setObject:(self.fashion ? self.fashion : [NSNull null]) forKey:@"fashion"];
 
-    if ([self.dirtyPropertySet containsObject:@"gender"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileGenderProperty))
         [dictionary setObject:(self.gender ? self.gender : [NSNull null]) forKey:@"gender"];
 
-    if ([self.dirtyPropertySet containsObject:@"happiestWhen"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileHappiestWhenProperty))
         [dictionary setObject:(self.happiestWhen ? self.happiestWhen : [NSNull null]) forKey:@"happiestWhen"];
 
-    if ([self.dirtyPropertySet containsObject:@"humor"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileHumorProperty))
         [dictionary setObject:(self.humor ? self.humor : [NSNull null]) forKey:@"humor"];
 
-    if ([self.dirtyPropertySet containsObject:@"livingArrangement"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileLivingArrangementProperty))
         [dictionary setObject:(self.livingArrangement ? self.livingArrangement : [NSNull null]) forKey:@"livingArrangement"];
 
-    if ([self.dirtyPropertySet containsObject:@"name"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNameProperty))
         [dictionary setObject:(self.name ?
                               [self.name toUpdateDictionary] :
                               [[JRName name] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2103,55 +3705,55 @@
         [dictionary setObject:[self.name toUpdateDictionary]
                        forKey:@"name"];
 
-    if ([self.dirtyPropertySet containsObject:@"nickname"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNicknameProperty))
         [dictionary setObject:(self.nickname ? self.nickname : [NSNull null]) forKey:@"nickname"];
 
-    if ([self.dirtyPropertySet containsObject:@"note"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNoteProperty))
         [dictionary setObject:(self.note ? self.note : [NSNull null]) forKey:@"note"];
 
-    if ([self.dirtyPropertySet containsObject:@"politicalViews"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePoliticalViewsProperty))
         [dictionary setObject:(self.politicalViews ? self.politicalViews : [NSNull null]) forKey:@"politicalViews"];
 
-    if ([self.dirtyPropertySet containsObject:@"preferredUsername"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePreferredUsernameProperty))
         [dictionary setObject:(self.preferredUsername ? self.preferredUsername : [NSNull null]) forKey:@"preferredUsername"];
 
-    if ([self.dirtyPropertySet containsObject:@"profileSong"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileSongProperty))
         [dictionary setObject:(self.profileSong ? self.profileSong : [NSNull null]) forKey:@"profileSong"];
 
-    if ([self.dirtyPropertySet containsObject:@"profileUrl"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileUrlProperty))
         [dictionary setObject:(self.profileUrl ? self.profileUrl : [NSNull null]) forKey:@"profileUrl"];
 
-    if ([self.dirtyPropertySet containsObject:@"profileVideo"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileVideoProperty))
         [dictionary setObject:(self.profileVideo ? self.profileVideo : [NSNull null]) forKey:@"profileVideo"];
 
-    if ([self.dirtyPropertySet containsObject:@"published"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePublishedProperty))
         [dictionary setObject:(self.published ? [self.published stringFromISO8601DateTime] : [NSNull null]) forKey:@"published"];
 
-    if ([self.dirtyPropertySet containsObject:@"relationshipStatus"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileRelationshipStatusProperty))
         [dictionary setObject:(self.relationshipStatus ? self.relationshipStatus : [NSNull null]) forKey:@"relationshipStatus"];
 
-    if ([self.dirtyPropertySet containsObject:@"religion"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileReligionProperty))
         [dictionary setObject:(self.religion ? self.religion : [NSNull null]) forKey:@"religion"];
 
-    if ([self.dirtyPropertySet containsObject:@"romance"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileRomanceProperty))
         [dictionary setObject:(self.romance ? self.romance : [NSNull null]) forKey:@"romance"];
 
-    if ([self.dirtyPropertySet containsObject:@"scaredOf"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileScaredOfProperty))
         [dictionary setObject:(self.scaredOf ? self.scaredOf : [NSNull null]) forKey:@"scaredOf"];
 
-    if ([self.dirtyPropertySet containsObject:@"sexualOrientation"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileSexualOrientationProperty))
         [dictionary setObject:(self.sexualOrientation ? self.sexualOrientation : [NSNull null]) forKey:@"sexualOrientation"];
 
-    if ([self.dirtyPropertySet containsObject:@"smoker"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileSmokerProperty))
         [dictionary setObject:(self.smoker ? self.smoker : [NSNull null]) forKey:@"smoker"];
 
-    if ([self.dirtyPropertySet containsObject:@"status"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileStatusProperty))
         [dictionary setObject:(self.status ? self.status : [NSNull null]) forKey:@"status"];
 
-    if ([self.dirtyPropertySet containsObject:@"updated"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileUpdatedProperty))
         [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
 
-    if ([self.dirtyPropertySet containsObject:@"utcOffset"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileUtcOffsetProperty))
         [dictionary setObject:(self.utcOffset ? self.utcOffset : [NSNull null]) forKey:@"utcOffset"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -2366,6 +3968,415 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileAboutMeProperty))
+    {
+        [writer writeKey:@"aboutMe"];
+        [writer writeValue:self.aboutMe];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileAnniversaryProperty))
+    {
+        [writer writeKey:@"anniversary"];
+        [writer writeValue:(self.anniversary ? [self.anniversary stringFromISO8601Date] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileBirthdayProperty))
+    {
+        [writer writeKey:@"birthday"];
+        [writer writeValue:self.birthday];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileBodyTypeProperty))
+    {
+        [writer writeKey:@"bodyType"];
+        [(self.bodyType ? self.bodyType : [JRBodyType bodyType]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.bodyType needsUpdate])
+    {
+        [writer writeKey:@"bodyType"];
+        [self.bodyType writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileCurrentLocationProperty))
+    {
+        [writer writeKey:@"currentLocation"];
+        [(self.currentLocation ? self.currentLocation : [JRCurrentLocation currentLocation]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.currentLocation needsUpdate])
+    {
+        [writer writeKey:@"currentLocation"];
+        [self.currentLocation writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileDisplayNameProperty))
+    {
+        [writer writeKey:@"displayName"];
+        [writer writeValue:self.displayName];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileDrinkerProperty))
+    {
+        [writer writeKey:@"drinker"];
+        [writer writeValue:self.drinker];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileEthnicityProperty))
+    {
+        [writer writeKey:@"ethnicity"];
+        [writer writeValue:self.ethnicity];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileFashionProperty))
+    {
+        [writer writeKey:@"fashion"];
+        [writer writeValue:self.fashion];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileGenderProperty))
+    {
+        [writer writeKey:@"gender"];
+        [writer writeValue:self.gender];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileHappiestWhenProperty))
+    {
+        [writer writeKey:@"happiestWhen"];
+        [writer writeValue:self.happiestWhen];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileHumorProperty))
+    {
+        [writer writeKey:@"humor"];
+        [writer writeValue:self.humor];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileLivingArrangementProperty))
+    {
+        [writer writeKey:@"livingArrangement"];
+        [writer writeValue:self.livingArrangement];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNameProperty))
+    {
+        [writer writeKey:@"name"];
+        [(self.name ? self.name : [JRName name]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.name needsUpdate])
+    {
+        [writer writeKey:@"name"];
+        [self.name writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNicknameProperty))
+    {
+        [writer writeKey:@"nickname"];
+        [writer writeValue:self.nickname];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNoteProperty))
+    {
+        [writer writeKey:@"note"];
+        [writer writeValue:self.note];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePoliticalViewsProperty))
+    {
+        [writer writeKey:@"politicalViews"];
+        [writer writeValue:self.politicalViews];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePreferredUsernameProperty))
+    {
+        [writer writeKey:@"preferredUsername"];
+        [writer writeValue:self.preferredUsername];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileSongProperty))
+    {
+        [writer writeKey:@"profileSong"];
+        [writer writeValue:self.profileSong];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileUrlProperty))
+    {
+        [writer writeKey:@"profileUrl"];
+        [writer writeValue:self.profileUrl];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileVideoProperty))
+    {
+        [writer writeKey:@"profileVideo"];
+        [writer writeValue:self.profileVideo];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePublishedProperty))
+    {
+        [writer writeKey:@"published"];
+        [writer writeValue:(self.published ? [self.published stringFromISO8601DateTime] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileRelationshipStatusProperty))
+    {
+        [writer writeKey:@"relationshipStatus"];
+        [writer writeValue:self.relationshipStatus];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileReligionProperty))
+    {
+        [writer writeKey:@"religion"];
+        [writer writeValue:self.religion];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileRomanceProperty))
+    {
+        [writer writeKey:@"romance"];
+        [writer writeValue:self.romance];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileScaredOfProperty))
+    {
+        [writer writeKey:@"scaredOf"];
+        [writer writeValue:self.scaredOf];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileSexualOrientationProperty))
+    {
+        [writer writeKey:@"sexualOrientation"];
+        [writer writeValue:self.sexualOrientation];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileSmokerProperty))
+    {
+        [writer writeKey:@"smoker"];
+        [writer writeValue:self.smoker];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileStatusProperty))
+    {
+        [writer writeKey:@"status"];
+        [writer writeValue:self.status];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileUpdatedProperty))
+    {
+        [writer writeKey:@"updated"];
+        [writer writeValue:(self.updated ? [self.updated stringFromISO8601DateTime] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileUtcOffsetProperty))
+    {
+        [writer writeKey:@"utcOffset"];
+        [writer writeValue:self.utcOffset];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"aboutMe"];
+    [writer writeValue:self.aboutMe];
+
+    [writer writeKey:@"accounts"];
+    [(self.accounts ? self.accounts : [NSArray array]) writeReplaceJsonOfAccountsElementsToWriter:writer];
+
+    [writer writeKey:@"activities"];
+    [writer writeValue:(self.activities ? self.activities : [NSArray array])];
+
+    [writer writeKey:@"addresses"];
+    [(self.addresses ? self.addresses : [NSArray array]) writeReplaceJsonOfAddressesElementsToWriter:writer];
+
+    [writer writeKey:@"anniversary"];
+    [writer writeValue:(self.anniversary ? [self.anniversary stringFromISO8601Date] : nil)];
+
+    [writer writeKey:@"birthday"];
+    [writer writeValue:self.birthday];
+
+    [writer writeKey:@"bodyType"];
+    if (self.bodyType)
+        [self.bodyType writeReplaceJsonToWriter:writer];
+    else
+        [[JRBodyType bodyType] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"books"];
+    [writer writeValue:(self.books ? self.books : [NSArray array])];
+
+    [writer writeKey:@"cars"];
+    [writer writeValue:(self.cars ? self.cars : [NSArray array])];
+
+    [writer writeKey:@"children"];
+    [writer writeValue:(self.children ? self.children : [NSArray array])];
+
+    [writer writeKey:@"currentLocation"];
+    if (self.currentLocation)
+        [self.currentLocation writeReplaceJsonToWriter:writer];
+    else
+        [[JRCurrentLocation currentLocation] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"displayName"];
+    [writer writeValue:self.displayName];
+
+    [writer writeKey:@"drinker"];
+    [writer writeValue:self.drinker];
+
+    [writer writeKey:@"emails"];
+    [(self.emails ? self.emails : [NSArray array]) writeReplaceJsonOfEmailsElementsToWriter:writer];
+
+    [writer writeKey:@"ethnicity"];
+    [writer writeValue:self.ethnicity];
+
+    [writer writeKey:@"fashion"];
+    [writer writeValue:self.fashion];
+
+    [writer writeKey:@"food"];
+    [writer writeValue:(self.food ? self.food : [NSArray array])];
+
+    [writer writeKey:@"gender"];
+    [writer writeValue:self.gender];
+
+    [writer writeKey:@"happiestWhen"];
+    [writer writeValue:self.happiestWhen];
+
+    [writer writeKey:@"heroes"];
+    [writer writeValue:(self.heroes ? self.heroes : [NSArray array])];
+
+    [writer writeKey:@"humor"];
+    [writer writeValue:self.humor];
+
+    [writer writeKey:@"ims"];
+    [(self.ims ? self.ims : [NSArray array]) writeReplaceJsonOfImsElementsToWriter:writer];
+
+    [writer writeKey:@"interestedInMeeting"];
+    [writer writeValue:(self.interestedInMeeting ? self.interestedInMeeting : [NSArray array])];
+
+    [writer writeKey:@"interests"];
+    [writer writeValue:(self.interests ? self.interests : [NSArray array])];
+
+    [writer writeKey:@"jobInterests"];
+    [writer writeValue:(self.jobInterests ? self.jobInterests : [NSArray array])];
+
+    [writer writeKey:@"languages"];
+    [writer writeValue:(self.languages ? self.languages : [NSArray array])];
+
+    [writer writeKey:@"languagesSpoken"];
+    [writer writeValue:(self.languagesSpoken ? self.languagesSpoken : [NSArray array])];
+
+    [writer writeKey:@"livingArrangement"];
+    [writer writeValue:self.livingArrangement];
+
+    [writer writeKey:@"lookingFor"];
+    [writer writeValue:(self.lookingFor ? self.lookingFor : [NSArray array])];
+
+    [writer writeKey:@"movies"];
+    [writer writeValue:(self.movies ? self.movies : [NSArray array])];
+
+    [writer writeKey:@"music"];
+    [writer writeValue:(self.music ? self.music : [NSArray array])];
+
+    [writer writeKey:@"name"];
+    if (self.name)
+        [self.name writeReplaceJsonToWriter:writer];
+    else
+        [[JRName name] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"nickname"];
+    [writer writeValue:self.nickname];
+
+    [writer writeKey:@"note"];
+    [writer writeValue:self.note];
+
+    [writer writeKey:@"organizations"];
+    [(self.organizations ? self.organizations : [NSArray array]) writeReplaceJsonOfOrganizationsElementsToWriter:writer];
+
+    [writer writeKey:@"pets"];
+    [writer writeValue:(self.pets ? self.pets : [NSArray array])];
+
+    [writer writeKey:@"phoneNumbers"];
+    [(self.phoneNumbers ? self.phoneNumbers : [NSArray array]) writeReplaceJsonOfPhoneNumbersElementsToWriter:writer];
+
+    [writer writeKey:@"photos"];
+    [(self.profilePhotos ? self.profilePhotos : [NSArray array]) writeReplaceJsonOfProfilePhotosElementsToWriter:writer];
+
+    [writer writeKey:@"politicalViews"];
+    [writer writeValue:self.politicalViews];
+
+    [writer writeKey:@"preferredUsername"];
+    [writer writeValue:self.preferredUsername];
+
+    [writer writeKey:@"profileSong"];
+    [writer writeValue:self.profileSong];
+
+    [writer writeKey:@"profileUrl"];
+    [writer writeValue:self.profileUrl];
+
+    [writer writeKey:@"profileVideo"];
+    [writer writeValue:self.profileVideo];
+
+    [writer writeKey:@"published"];
+    [writer writeValue:(self.published ? [self.published stringFromISO8601DateTime] : nil)];
+
+    [writer writeKey:@"quotes"];
+    [writer writeValue:(self.quotes ? self.quotes : [NSArray array])];
+
+    [writer writeKey:@"relationshipStatus"];
+    [writer writeValue:self.relationshipStatus];
+
+    [writer writeKey:@"relationships"];
+    [writer writeValue:(self.relationships ? self.relationships : [NSArray array])];
+
+    [writer writeKey:@"religion"];
+    [writer writeValue:self.religion];
+
+    [writer writeKey:@"romance"];
+    [writer writeValue:self.romance];
+
+    [writer writeKey:@"scaredOf"];
+    [writer writeValue:self.scaredOf];
+
+    [writer writeKey:@"sexualOrientation"];
+    [writer writeValue:self.sexualOrientation];
+
+    [writer writeKey:@"smoker"];
+    [writer writeValue:self.smoker];
+
+    [writer writeKey:@"sports"];
+    [writer writeValue:(self.sports ? self.sports : [NSArray array])];
+
+    [writer writeKey:@"status"];
+    [writer writeValue:self.status];
+
+    [writer writeKey:@"tags"];
+    [writer writeValue:(self.tags ? self.tags : [NSArray array])];
+
+    [writer writeKey:@"turnOffs"];
+    [writer writeValue:(self.turnOffs ? self.turnOffs : [NSArray array])];
+
+    [writer writeKey:@"turnOns"];
+    [writer writeValue:(self.turnOns ? self.turnOns : [NSArray array])];
+
+    [writer writeKey:@"tvShows"];
+    [writer writeValue:(self.tvShows ? self.tvShows : [NSArray array])];
+
+    [writer writeKey:@"updated"];
+    [writer writeValue:(self.updated ? [self.updated stringFromISO8601DateTime] : nil)];
+
+    [writer writeKey:@"urls"];
+    [(self.urls ? self.urls : [NSArray array]) writeReplaceJsonOfUrlsElementsToWriter:writer];
+
+    [writer writeKey:@"utcOffset"];
+    [writer writeValue:self.utcOffset];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replaceAccountsArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.accounts named:@"accounts" isArrayOfStrings:NO
@@ -2563,6 +4574,77 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.accounts)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.addresses)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileBirthdayProperty))
+        JRValidateCaptureAttribute(self.birthday, @"birthday", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || !_bodyTypeJson)
+        [self.bodyType validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || !_currentLocationJson)
+        [self.currentLocation validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileDisplayNameProperty))
+        JRValidateCaptureAttribute(self.displayName, @"displayName", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.emails)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileEthnicityProperty))
+        JRValidateCaptureAttribute(self.ethnicity, @"ethnicity", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileGenderProperty))
+        JRValidateCaptureAttribute(self.gender, @"gender", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.ims)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_nameJson)
+        [self.name validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileNicknameProperty))
+        JRValidateCaptureAttribute(self.nickname, @"nickname", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.organizations)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.phoneNumbers)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.profilePhotos)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfilePreferredUsernameProperty))
+        JRValidateCaptureAttribute(self.preferredUsername, @"preferredUsername", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileProfileVideoProperty))
+        JRValidateCaptureAttribute(self.profileVideo, @"profileVideo", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileRelationshipStatusProperty))
+        JRValidateCaptureAttribute(self.relationshipStatus, @"relationshipStatus", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRProfileStatusProperty))
+        JRValidateCaptureAttribute(self.status, @"status", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.urls)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToProfile:(JRProfile *)otherProfile
 {
     if (!self.aboutMe && !otherProfile.aboutMe) /* Keep going... */;
@@ -2915,4 +4997,67 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_bodyTypeJson)
+        _bodyTypeJsonCleared = YES;
+    else
+        [self.bodyType deepClearDirtyProperties];
+
+    if (_currentLocationJson)
+        _currentLocationJsonCleared = YES;
+    else
+        [self.currentLocation deepClearDirtyProperties];
+
+    if (_nameJson)
+        _nameJsonCleared = YES;
+    else
+        [self.name deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRProfile class]]) return NO;
+
+    JRProfile *otherProfile = (JRProfile *)otherObj;
+
+    if (self.accounts && ![self.accounts isEqualByPrivatePropertiesToAccountsArray:otherProfile.accounts])
+        return NO;
+
+    if (self.addresses && ![self.addresses isEqualByPrivatePropertiesToAddressesArray:otherProfile.addresses])
+        return NO;
+
+    if (self.bodyType && ![self.bodyType isEqualByPrivateProperties:otherProfile.bodyType])
+        return NO;
+
+    if (self.currentLocation && ![self.currentLocation isEqualByPrivateProperties:otherProfile.currentLocation])
+        return NO;
+
+    if (self.emails && ![self.emails isEqualByPrivatePropertiesToEmailsArray:otherProfile.emails])
+        return NO;
+
+    if (self.ims && ![self.ims isEqualByPrivatePropertiesToImsArray:otherProfile.ims])
+        return NO;
+
+    if (self.name && ![self.name isEqualByPrivateProperties:otherProfile.name])
+        return NO;
+
+    if (self.organizations && ![self.organizations isEqualByPrivatePropertiesToOrganizationsArray:otherProfile.organizations])
+        return NO;
+
+    if (self.phoneNumbers && ![self.phoneNumbers isEqualByPrivatePropertiesToPhoneNumbersArray:otherProfile.phoneNumbers])
+        return NO;
+
+    if (self.profilePhotos && ![self.profilePhotos isEqualByPrivatePropertiesToProfilePhotosArray:otherProfile.profilePhotos])
+        return NO;
+
+    if (self.urls && ![self.urls isEqualByPrivatePropertiesToUrlsArray:otherProfile.urls])
+        return NO;
+
+    return YES;
+}
+
 @end
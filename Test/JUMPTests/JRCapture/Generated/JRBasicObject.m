@@ -40,6 +40,19 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRBasicObject.h"
 
+enum
+{
+    JRBasicObjectString1Property,
+    JRBasicObjectString2Property,
+    JRBasicObjectPropertyCount
+};
+
+static const char *const JRBasicObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRBasicObject ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -51,6 +64,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRBasicObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRBasicObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -58,7 +81,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBasicObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -70,7 +93,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBasicObjectString2Property);
 
     _string2 = [newString2 copy];
 }
@@ -83,7 +106,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -152,11 +175,97 @@
     return [JRBasicObject basicObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)basicObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRBasicObject *basicObject = [JRBasicObject basicObject];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 3)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                basicObject.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                basicObject.string1 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [basicObject.dirtyPropertySet removeAllObjects];
+
+    return basicObject;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer endObject];
+}
+
++ (id)basicObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRBasicObject *basicObject = [JRBasicObject basicObject];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    basicObject.captureObjectPath = [reader readString];
+    basicObject.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 3)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                basicObject.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                basicObject.string1 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [basicObject.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return basicObject;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRBasicObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -168,7 +277,7 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -176,18 +285,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"basicObject"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"basicObject"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -195,7 +298,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"basicObject"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"basicObject"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"basicObject"]];
 
 }
 
@@ -204,10 +307,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -231,6 +334,40 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -263,4 +400,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRBasicObject class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -40,6 +40,19 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRBasicPluralElement.h"
 
+enum
+{
+    JRBasicPluralElementString1Property,
+    JRBasicPluralElementString2Property,
+    JRBasicPluralElementPropertyCount
+};
+
+static const char *const JRBasicPluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRBasicPluralElement ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -51,6 +64,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRBasicPluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRBasicPluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -58,7 +81,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBasicPluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -70,7 +93,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRBasicPluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
@@ -83,7 +106,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -158,11 +181,106 @@
     return [JRBasicPluralElement basicPluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)basicPluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRBasicPluralElement *basicPluralElement = [JRBasicPluralElement basicPluralElement];
+    NSInteger elementId = 0;
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                basicPluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                basicPluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    basicPluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"basicPlural", (long)elementId];
+    basicPluralElement.canBeUpdatedOnCapture = YES;
+
+    [basicPluralElement.dirtyPropertySet removeAllObjects];
+
+    return basicPluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer endObject];
+}
+
++ (id)basicPluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRBasicPluralElement *basicPluralElement = [JRBasicPluralElement basicPluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    basicPluralElement.captureObjectPath = [reader readString];
+    basicPluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 3)
+        {
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                basicPluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                basicPluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [basicPluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return basicPluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRBasicPluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"basicPlural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -175,7 +293,7 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -183,18 +301,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"basicPluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"basicPluralElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -202,7 +314,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"basicPluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"basicPluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"basicPluralElement"]];
 
 }
 
@@ -211,10 +323,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicPluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicPluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -238,6 +350,40 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicPluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRBasicPluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -270,4 +416,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRBasicPluralElement class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -40,93 +40,214 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRCaptureUser.h"
 
+enum
+{
+    JRCaptureUserUuidProperty,
+    JRCaptureUserCreatedProperty,
+    JRCaptureUserLastUpdatedProperty,
+    JRCaptureUserEmailProperty,
+    JRCaptureUserBasicBooleanProperty,
+    JRCaptureUserBasicStringProperty,
+    JRCaptureUserBasicIntegerProperty,
+    JRCaptureUserBasicDecimalProperty,
+    JRCaptureUserBasicDateProperty,
+    JRCaptureUserBasicDateTimeProperty,
+    JRCaptureUserBasicIpAddressProperty,
+    JRCaptureUserBasicPasswordProperty,
+    JRCaptureUserJsonNumberProperty,
+    JRCaptureUserJsonStringProperty,
+    JRCaptureUserJsonArrayProperty,
+    JRCaptureUserJsonDictionaryProperty,
+    JRCaptureUserStringTestJsonProperty,
+    JRCaptureUserStringTestEmptyProperty,
+    JRCaptureUserStringTestNullProperty,
+    JRCaptureUserStringTestInvalidProperty,
+    JRCaptureUserStringTestNSNullProperty,
+    JRCaptureUserStringTestAlphanumericProperty,
+    JRCaptureUserStringTestUnicodeLettersProperty,
+    JRCaptureUserStringTestUnicodePrintableProperty,
+    JRCaptureUserStringTestEmailAddressProperty,
+    JRCaptureUserStringTestLengthProperty,
+    JRCaptureUserStringTestCaseSensitiveProperty,
+    JRCaptureUserStringTestFeaturesProperty,
+    JRCaptureUserBasicObjectProperty,
+    JRCaptureUserObjectTestRequiredProperty,
+    JRCaptureUserObjectTestRequiredUniqueProperty,
+    JRCaptureUserPinoL1ObjectProperty,
+    JRCaptureUserOinoL1ObjectProperty,
+    JRCaptureUserPinapinoL1ObjectProperty,
+    JRCaptureUserPinoinoL1ObjectProperty,
+    JRCaptureUserOnipinoL1ObjectProperty,
+    JRCaptureUserOinoinoL1ObjectProperty,
+    JRCaptureUserCaptureUserIdProperty,
+    JRCaptureUserPropertyCount
+};
+
+static const char *const JRCaptureUserPropertyNames[] =
+{
+    "uuid",
+    "created",
+    "lastUpdated",
+    "email",
+    "basicBoolean",
+    "basicString",
+    "basicInteger",
+    "basicDecimal",
+    "basicDate",
+    "basicDateTime",
+    "basicIpAddress",
+    "basicPassword",
+    "jsonNumber",
+    "jsonString",
+    "jsonArray",
+    "jsonDictionary",
+    "stringTestJson",
+    "stringTestEmpty",
+    "stringTestNull",
+    "stringTestInvalid",
+    "stringTestNSNull",
+    "stringTestAlphanumeric",
+    "stringTestUnicodeLetters",
+    "stringTestUnicodePrintable",
+    "stringTestEmailAddress",
+    "stringTestLength",
+    "stringTestCaseSensitive",
+    "stringTestFeatures",
+    "basicObject",
+    "objectTestRequired",
+    "objectTestRequiredUnique",
+    "pinoL1Object",
+    "oinoL1Object",
+    "pinapinoL1Object",
+    "pinoinoL1Object",
+    "onipinoL1Object",
+    "oinoinoL1Object",
+    "captureUserId",
+};
+
 @interface JRBasicPluralElement (JRBasicPluralElement_InternalMethods)
 + (id)basicPluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)basicPluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)basicPluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToBasicPluralElement:(JRBasicPluralElement *)otherBasicPluralElement;
 @end
 
 @interface JRBasicObject (JRBasicObject_InternalMethods)
 + (id)basicObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)basicObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)basicObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToBasicObject:(JRBasicObject *)otherBasicObject;
 @end
 
 @interface JRObjectTestRequired (JRObjectTestRequired_InternalMethods)
 + (id)objectTestRequiredObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)objectTestRequiredObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)objectTestRequiredObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToObjectTestRequired:(JRObjectTestRequired *)otherObjectTestRequired;
 @end
 
 @interface JRPluralTestUniqueElement (JRPluralTestUniqueElement_InternalMethods)
 + (id)pluralTestUniqueElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pluralTestUniqueElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pluralTestUniqueElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPluralTestUniqueElement:(JRPluralTestUniqueElement *)otherPluralTestUniqueElement;
 @end
 
 @interface JRObjectTestRequiredUnique (JRObjectTestRequiredUnique_InternalMethods)
 + (id)objectTestRequiredUniqueObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)objectTestRequiredUniqueObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)objectTestRequiredUniqueObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToObjectTestRequiredUnique:(JRObjectTestRequiredUnique *)otherObjectTestRequiredUnique;
 @end
 
 @interface JRPluralTestAlphabeticElement (JRPluralTestAlphabeticElement_InternalMethods)
 + (id)pluralTestAlphabeticElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pluralTestAlphabeticElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pluralTestAlphabeticElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPluralTestAlphabeticElement:(JRPluralTestAlphabeticElement *)otherPluralTestAlphabeticElement;
 @end
 
 @interface JRPinapL1PluralElement (JRPinapL1PluralElement_InternalMethods)
 + (id)pinapL1PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapL1PluralElement:(JRPinapL1PluralElement *)otherPinapL1PluralElement;
 @end
 
 @interface JRPinoL1Object (JRPinoL1Object_InternalMethods)
 + (id)pinoL1ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinoL1Object:(JRPinoL1Object *)otherPinoL1Object;
 @end
 
 @interface JROnipL1PluralElement (JROnipL1PluralElement_InternalMethods)
 + (id)onipL1PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipL1PluralElement:(JROnipL1PluralElement *)otherOnipL1PluralElement;
 @end
 
 @interface JROinoL1Object (JROinoL1Object_InternalMethods)
 + (id)oinoL1ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinoL1Object:(JROinoL1Object *)otherOinoL1Object;
 @end
 
 @interface JRPinapinapL1PluralElement (JRPinapinapL1PluralElement_InternalMethods)
 + (id)pinapinapL1PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapinapL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapinapL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapinapL1PluralElement:(JRPinapinapL1PluralElement *)otherPinapinapL1PluralElement;
 @end
 
 @interface JRPinonipL1PluralElement (JRPinonipL1PluralElement_InternalMethods)
 + (id)pinonipL1PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinonipL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinonipL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinonipL1PluralElement:(JRPinonipL1PluralElement *)otherPinonipL1PluralElement;
 @end
 
 @interface JRPinapinoL1Object (JRPinapinoL1Object_InternalMethods)
 + (id)pinapinoL1ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapinoL1Object:(JRPinapinoL1Object *)otherPinapinoL1Object;
 @end
 
 @interface JRPinoinoL1Object (JRPinoinoL1Object_InternalMethods)
 + (id)pinoinoL1ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinoinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinoinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinoinoL1Object:(JRPinoinoL1Object *)otherPinoinoL1Object;
 @end
 
 @interface JROnipinapL1PluralElement (JROnipinapL1PluralElement_InternalMethods)
 + (id)onipinapL1PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipinapL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipinapL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipinapL1PluralElement:(JROnipinapL1PluralElement *)otherOnipinapL1PluralElement;
 @end
 
 @interface JROinonipL1PluralElement (JROinonipL1PluralElement_InternalMethods)
 + (id)oinonipL1PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinonipL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinonipL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinonipL1PluralElement:(JROinonipL1PluralElement *)otherOinonipL1PluralElement;
 @end
 
 @interface JROnipinoL1Object (JROnipinoL1Object_InternalMethods)
 + (id)onipinoL1ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipinoL1Object:(JROnipinoL1Object *)otherOnipinoL1Object;
 @end
 
 @interface JROinoinoL1Object (JROinoinoL1Object_InternalMethods)
 + (id)oinoinoL1ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinoinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinoinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinoinoL1Object:(JROinoinoL1Object *)otherOinoinoL1Object;
 @end
 
@@ -170,6 +291,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfBasicPluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRBasicPluralElement class]])
+            [(JRBasicPluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfBasicPluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredBasicPluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRBasicPluralElement *element = [JRBasicPluralElement basicPluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredBasicPluralArray addObject:element];
+    }
+
+    return filteredBasicPluralArray;
+}
+
+- (void)writeBasicPluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRBasicPluralElement class]])
+            [(JRBasicPluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfBasicPluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredBasicPluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRBasicPluralElement *element = [JRBasicPluralElement basicPluralElementFromArchive:reader];
+        if (element)
+            [filteredBasicPluralArray addObject:element];
+    }
+
+    return filteredBasicPluralArray;
+}
 @end
 
 @implementation NSArray (JRArray_PluralTestUnique_ToFromDictionary)
@@ -212,6 +383,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPluralTestUniqueElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPluralTestUniqueElement class]])
+            [(JRPluralTestUniqueElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPluralTestUniqueElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPluralTestUniqueArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPluralTestUniqueElement *element = [JRPluralTestUniqueElement pluralTestUniqueElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPluralTestUniqueArray addObject:element];
+    }
+
+    return filteredPluralTestUniqueArray;
+}
+
+- (void)writePluralTestUniqueElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPluralTestUniqueElement class]])
+            [(JRPluralTestUniqueElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPluralTestUniqueElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPluralTestUniqueArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPluralTestUniqueElement *element = [JRPluralTestUniqueElement pluralTestUniqueElementFromArchive:reader];
+        if (element)
+            [filteredPluralTestUniqueArray addObject:element];
+    }
+
+    return filteredPluralTestUniqueArray;
+}
 @end
 
 @implementation NSArray (JRArray_PluralTestAlphabetic_ToFromDictionary)
@@ -254,6 +475,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPluralTestAlphabeticElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPluralTestAlphabeticElement class]])
+            [(JRPluralTestAlphabeticElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPluralTestAlphabeticElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPluralTestAlphabeticArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPluralTestAlphabeticElement *element = [JRPluralTestAlphabeticElement pluralTestAlphabeticElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPluralTestAlphabeticArray addObject:element];
+    }
+
+    return filteredPluralTestAlphabeticArray;
+}
+
+- (void)writePluralTestAlphabeticElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPluralTestAlphabeticElement class]])
+            [(JRPluralTestAlphabeticElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPluralTestAlphabeticElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPluralTestAlphabeticArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPluralTestAlphabeticElement *element = [JRPluralTestAlphabeticElement pluralTestAlphabeticElementFromArchive:reader];
+        if (element)
+            [filteredPluralTestAlphabeticArray addObject:element];
+    }
+
+    return filteredPluralTestAlphabeticArray;
+}
 @end
 
 @implementation NSArray (JRArray_PinapL1Plural_ToFromDictionary)
@@ -296,6 +567,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapL1PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapL1PluralElement class]])
+            [(JRPinapL1PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapL1PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapL1PluralElement *element = [JRPinapL1PluralElement pinapL1PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapL1PluralArray addObject:element];
+    }
+
+    return filteredPinapL1PluralArray;
+}
+
+- (void)writePinapL1PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapL1PluralElement class]])
+            [(JRPinapL1PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapL1PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapL1PluralElement *element = [JRPinapL1PluralElement pinapL1PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapL1PluralArray addObject:element];
+    }
+
+    return filteredPinapL1PluralArray;
+}
 @end
 
 @implementation NSArray (JRArray_OnipL1Plural_ToFromDictionary)
@@ -338,6 +659,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfOnipL1PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipL1PluralElement class]])
+            [(JROnipL1PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipL1PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipL1PluralElement *element = [JROnipL1PluralElement onipL1PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredOnipL1PluralArray addObject:element];
+    }
+
+    return filteredOnipL1PluralArray;
+}
+
+- (void)writeOnipL1PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipL1PluralElement class]])
+            [(JROnipL1PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipL1PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipL1PluralElement *element = [JROnipL1PluralElement onipL1PluralElementFromArchive:reader];
+        if (element)
+            [filteredOnipL1PluralArray addObject:element];
+    }
+
+    return filteredOnipL1PluralArray;
+}
 @end
 
 @implementation NSArray (JRArray_PinapinapL1Plural_ToFromDictionary)
@@ -380,6 +751,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapinapL1PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinapL1PluralElement class]])
+            [(JRPinapinapL1PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinapL1PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinapL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinapL1PluralElement *element = [JRPinapinapL1PluralElement pinapinapL1PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapinapL1PluralArray addObject:element];
+    }
+
+    return filteredPinapinapL1PluralArray;
+}
+
+- (void)writePinapinapL1PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinapL1PluralElement class]])
+            [(JRPinapinapL1PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinapL1PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinapL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinapL1PluralElement *element = [JRPinapinapL1PluralElement pinapinapL1PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapinapL1PluralArray addObject:element];
+    }
+
+    return filteredPinapinapL1PluralArray;
+}
 @end
 
 @implementation NSArray (JRArray_PinonipL1Plural_ToFromDictionary)
@@ -422,6 +843,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinonipL1PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinonipL1PluralElement class]])
+            [(JRPinonipL1PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinonipL1PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinonipL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinonipL1PluralElement *element = [JRPinonipL1PluralElement pinonipL1PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinonipL1PluralArray addObject:element];
+    }
+
+    return filteredPinonipL1PluralArray;
+}
+
+- (void)writePinonipL1PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinonipL1PluralElement class]])
+            [(JRPinonipL1PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinonipL1PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinonipL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinonipL1PluralElement *element = [JRPinonipL1PluralElement pinonipL1PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinonipL1PluralArray addObject:element];
+    }
+
+    return filteredPinonipL1PluralArray;
+}
 @end
 
 @implementation NSArray (JRArray_OnipinapL1Plural_ToFromDictionary)
@@ -464,6 +935,56 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfOnipinapL1PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipinapL1PluralElement class]])
+            [(JROnipinapL1PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipinapL1PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipinapL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipinapL1PluralElement *element = [JROnipinapL1PluralElement onipinapL1PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredOnipinapL1PluralArray addObject:element];
+    }
+
+    return filteredOnipinapL1PluralArray;
+}
+
+- (void)writeOnipinapL1PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipinapL1PluralElement class]])
+            [(JROnipinapL1PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipinapL1PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipinapL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipinapL1PluralElement *element = [JROnipinapL1PluralElement onipinapL1PluralElementFromArchive:reader];
+        if (element)
+            [filteredOnipinapL1PluralArray addObject:element];
+    }
+
+    return filteredOnipinapL1PluralArray;
+}
 @end
 
 @implementation NSArray (JRArray_OinonipL1Plural_ToFromDictionary)
@@ -506,18 +1027,77 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfOinonipL1PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROinonipL1PluralElement class]])
+            [(JROinonipL1PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOinonipL1PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOinonipL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROinonipL1PluralElement *element = [JROinonipL1PluralElement oinonipL1PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredOinonipL1PluralArray addObject:element];
+    }
+
+    return filteredOinonipL1PluralArray;
+}
+
+- (void)writeOinonipL1PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROinonipL1PluralElement class]])
+            [(JROinonipL1PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOinonipL1PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOinonipL1PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROinonipL1PluralElement *element = [JROinonipL1PluralElement oinonipL1PluralElementFromArchive:reader];
+        if (element)
+            [filteredOinonipL1PluralArray addObject:element];
+    }
+
+    return filteredOinonipL1PluralArray;
+}
 @end
 
 @interface NSArray (CaptureUser_ArrayComparison)
 - (BOOL)isEqualToBasicPluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToBasicPluralArray:(NSArray *)otherArray;
 - (BOOL)isEqualToPluralTestUniqueArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPluralTestUniqueArray:(NSArray *)otherArray;
 - (BOOL)isEqualToPluralTestAlphabeticArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPluralTestAlphabeticArray:(NSArray *)otherArray;
 - (BOOL)isEqualToPinapL1PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapL1PluralArray:(NSArray *)otherArray;
 - (BOOL)isEqualToOnipL1PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToOnipL1PluralArray:(NSArray *)otherArray;
 - (BOOL)isEqualToPinapinapL1PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapinapL1PluralArray:(NSArray *)otherArray;
 - (BOOL)isEqualToPinonipL1PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinonipL1PluralArray:(NSArray *)otherArray;
 - (BOOL)isEqualToOnipinapL1PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToOnipinapL1PluralArray:(NSArray *)otherArray;
 - (BOOL)isEqualToOinonipL1PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToOinonipL1PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (CaptureUser_ArrayComparison)
@@ -533,12 +1113,34 @@
     return YES;
 }
 
-- (BOOL)isEqualToPluralTestUniqueArray:(NSArray *)otherArray
+- (BOOL)isEqualByPrivatePropertiesToBasicPluralArray:(NSArray *)otherArray
 {
-    if ([self count] != [otherArray count]) return NO;
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
 
     for (NSUInteger i = 0; i < [self count]; i++)
-        if (![((JRPluralTestUniqueElement *)[self objectAtIndex:i]) isEqualToPluralTestUniqueElement:[otherArray objectAtIndex:i]])
+        if (![((JRBasicPluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
+- (BOOL)isEqualToPluralTestUniqueArray:(NSArray *)otherArray
+{
+    if ([self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPluralTestUniqueElement *)[self objectAtIndex:i]) isEqualToPluralTestUniqueElement:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
+- (BOOL)isEqualByPrivatePropertiesToPluralTestUniqueArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPluralTestUniqueElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
             return NO;
 
     return YES;
@@ -555,6 +1157,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToPluralTestAlphabeticArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPluralTestAlphabeticElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToPinapL1PluralArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -566,6 +1179,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToPinapL1PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapL1PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToOnipL1PluralArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -577,6 +1201,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToOnipL1PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JROnipL1PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToPinapinapL1PluralArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -588,6 +1223,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToPinapinapL1PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapinapL1PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToPinonipL1PluralArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -599,6 +1245,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToPinonipL1PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinonipL1PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToOnipinapL1PluralArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -610,6 +1267,17 @@
     return YES;
 }
 
+- (BOOL)isEqualByPrivatePropertiesToOnipinapL1PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JROnipinapL1PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
+
 - (BOOL)isEqualToOinonipL1PluralArray:(NSArray *)otherArray
 {
     if ([self count] != [otherArray count]) return NO;
@@ -620,6 +1288,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToOinonipL1PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JROinonipL1PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRCaptureUser ()
@@ -657,29 +1336,66 @@
     NSString *_stringTestCaseSensitive;
     NSString *_stringTestFeatures;
     NSArray *_basicPlural;
+    NSArray *_basicPluralJson;
     JRBasicObject *_basicObject;
+    NSDictionary *_basicObjectJson;
+    BOOL _basicObjectJsonCleared;
     JRObjectTestRequired *_objectTestRequired;
+    NSDictionary *_objectTestRequiredJson;
+    BOOL _objectTestRequiredJsonCleared;
     NSArray *_pluralTestUnique;
+    NSArray *_pluralTestUniqueJson;
     JRObjectTestRequiredUnique *_objectTestRequiredUnique;
+    NSDictionary *_objectTestRequiredUniqueJson;
+    BOOL _objectTestRequiredUniqueJsonCleared;
     NSArray *_pluralTestAlphabetic;
+    NSArray *_pluralTestAlphabeticJson;
     JRStringArray *_simpleStringPluralOne;
     JRStringArray *_simpleStringPluralTwo;
     NSArray *_pinapL1Plural;
+    NSArray *_pinapL1PluralJson;
     JRPinoL1Object *_pinoL1Object;
+    NSDictionary *_pinoL1ObjectJson;
+    BOOL _pinoL1ObjectJsonCleared;
     NSArray *_onipL1Plural;
+    NSArray *_onipL1PluralJson;
     JROinoL1Object *_oinoL1Object;
+    NSDictionary *_oinoL1ObjectJson;
+    BOOL _oinoL1ObjectJsonCleared;
     NSArray *_pinapinapL1Plural;
+    NSArray *_pinapinapL1PluralJson;
     NSArray *_pinonipL1Plural;
+    NSArray *_pinonipL1PluralJson;
     JRPinapinoL1Object *_pinapinoL1Object;
+    NSDictionary *_pinapinoL1ObjectJson;
+    BOOL _pinapinoL1ObjectJsonCleared;
     JRPinoinoL1Object *_pinoinoL1Object;
+    NSDictionary *_pinoinoL1ObjectJson;
+    BOOL _pinoinoL1ObjectJsonCleared;
     NSArray *_onipinapL1Plural;
+    NSArray *_onipinapL1PluralJson;
     NSArray *_oinonipL1Plural;
+    NSArray *_oinonipL1PluralJson;
     JROnipinoL1Object *_onipinoL1Object;
+    NSDictionary *_onipinoL1ObjectJson;
+    BOOL _onipinoL1ObjectJsonCleared;
     JROinoinoL1Object *_oinoinoL1Object;
+    NSDictionary *_oinoinoL1ObjectJson;
+    BOOL _oinoinoL1ObjectJsonCleared;
     JRObjectId *_captureUserId;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRCaptureUserPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRCaptureUserPropertyCount;
+}
+
 - (JRUuid *)uuid
 {
     return _uuid;
@@ -687,7 +1403,7 @@
 
 - (void)setUuid:(JRUuid *)newUuid
 {
-    [self.dirtyPropertySet addObject:@"uuid"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserUuidProperty);
 
     _uuid = [newUuid copy];
 }
@@ -699,7 +1415,7 @@
 
 - (void)setCreated:(JRDateTime *)newCreated
 {
-    [self.dirtyPropertySet addObject:@"created"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCreatedProperty);
 
     _created = [newCreated copy];
 }
@@ -711,7 +1427,7 @@
 
 - (void)setLastUpdated:(JRDateTime *)newLastUpdated
 {
-    [self.dirtyPropertySet addObject:@"lastUpdated"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserLastUpdatedProperty);
 
     _lastUpdated = [newLastUpdated copy];
 }
@@ -723,7 +1439,7 @@
 
 - (void)setEmail:(NSString *)newEmail
 {
-    [self.dirtyPropertySet addObject:@"email"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty);
 
     _email = [newEmail copy];
 }
@@ -735,7 +1451,7 @@
 
 - (void)setBasicBoolean:(JRBoolean *)newBasicBoolean
 {
-    [self.dirtyPropertySet addObject:@"basicBoolean"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicBooleanProperty);
 
     _basicBoolean = [newBasicBoolean copy];
 }
@@ -747,7 +1463,7 @@
 
 - (void)setBasicBooleanWithBool:(BOOL)boolVal
 {
-    [self.dirtyPropertySet addObject:@"basicBoolean"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicBooleanProperty);
 
     _basicBoolean = [NSNumber numberWithBool:boolVal];
 }
@@ -759,7 +1475,7 @@
 
 - (void)setBasicString:(NSString *)newBasicString
 {
-    [self.dirtyPropertySet addObject:@"basicString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicStringProperty);
 
     _basicString = [newBasicString copy];
 }
@@ -771,7 +1487,7 @@
 
 - (void)setBasicInteger:(JRInteger *)newBasicInteger
 {
-    [self.dirtyPropertySet addObject:@"basicInteger"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIntegerProperty);
 
     _basicInteger = [newBasicInteger copy];
 }
@@ -783,7 +1499,7 @@
 
 - (void)setBasicIntegerWithInteger:(NSInteger)integerVal
 {
-    [self.dirtyPropertySet addObject:@"basicInteger"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIntegerProperty);
 
     _basicInteger = [NSNumber numberWithInteger:integerVal];
 }
@@ -795,7 +1511,7 @@
 
 - (void)setBasicDecimal:(JRDecimal *)newBasicDecimal
 {
-    [self.dirtyPropertySet addObject:@"basicDecimal"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDecimalProperty);
 
     _basicDecimal = [newBasicDecimal copy];
 }
@@ -807,7 +1523,7 @@
 
 - (void)setBasicDate:(JRDate *)newBasicDate
 {
-    [self.dirtyPropertySet addObject:@"basicDate"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDateProperty);
 
     _basicDate = [newBasicDate copy];
 }
@@ -819,7 +1535,7 @@
 
 - (void)setBasicDateTime:(JRDateTime *)newBasicDateTime
 {
-    [self.dirtyPropertySet addObject:@"basicDateTime"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDateTimeProperty);
 
     _basicDateTime = [newBasicDateTime copy];
 }
@@ -831,7 +1547,7 @@
 
 - (void)setBasicIpAddress:(JRIpAddress *)newBasicIpAddress
 {
-    [self.dirtyPropertySet addObject:@"basicIpAddress"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIpAddressProperty);
 
     _basicIpAddress = [newBasicIpAddress copy];
 }
@@ -843,7 +1559,7 @@
 
 - (void)setBasicPassword:(JRPassword *)newBasicPassword
 {
-    [self.dirtyPropertySet addObject:@"basicPassword"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicPasswordProperty);
 
     _basicPassword = [newBasicPassword copy];
 }
@@ -855,7 +1571,7 @@
 
 - (void)setJsonNumber:(JRJsonObject *)newJsonNumber
 {
-    [self.dirtyPropertySet addObject:@"jsonNumber"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonNumberProperty);
 
     _jsonNumber = [newJsonNumber copy];
 }
@@ -867,7 +1583,7 @@
 
 - (void)setJsonString:(JRJsonObject *)newJsonString
 {
-    [self.dirtyPropertySet addObject:@"jsonString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonStringProperty);
 
     _jsonString = [newJsonString copy];
 }
@@ -879,7 +1595,7 @@
 
 - (void)setJsonArray:(JRJsonObject *)newJsonArray
 {
-    [self.dirtyPropertySet addObject:@"jsonArray"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonArrayProperty);
 
     _jsonArray = [newJsonArray copy];
 }
@@ -891,7 +1607,7 @@
 
 - (void)setJsonDictionary:(JRJsonObject *)newJsonDictionary
 {
-    [self.dirtyPropertySet addObject:@"jsonDictionary"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonDictionaryProperty);
 
     _jsonDictionary = [newJsonDictionary copy];
 }
@@ -903,7 +1619,7 @@
 
 - (void)setStringTestJson:(NSString *)newStringTestJson
 {
-    [self.dirtyPropertySet addObject:@"stringTestJson"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestJsonProperty);
 
     _stringTestJson = [newStringTestJson copy];
 }
@@ -915,7 +1631,7 @@
 
 - (void)setStringTestEmpty:(NSString *)newStringTestEmpty
 {
-    [self.dirtyPropertySet addObject:@"stringTestEmpty"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmptyProperty);
 
     _stringTestEmpty = [newStringTestEmpty copy];
 }
@@ -927,7 +1643,7 @@
 
 - (void)setStringTestNull:(NSString *)newStringTestNull
 {
-    [self.dirtyPropertySet addObject:@"stringTestNull"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestNullProperty);
 
     _stringTestNull = [newStringTestNull copy];
 }
@@ -939,7 +1655,7 @@
 
 - (void)setStringTestInvalid:(NSString *)newStringTestInvalid
 {
-    [self.dirtyPropertySet addObject:@"stringTestInvalid"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestInvalidProperty);
 
     _stringTestInvalid = [newStringTestInvalid copy];
 }
@@ -951,7 +1667,7 @@
 
 - (void)setStringTestNSNull:(NSString *)newStringTestNSNull
 {
-    [self.dirtyPropertySet addObject:@"stringTestNSNull"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestNSNullProperty);
 
     _stringTestNSNull = [newStringTestNSNull copy];
 }
@@ -963,7 +1679,7 @@
 
 - (void)setStringTestAlphanumeric:(NSString *)newStringTestAlphanumeric
 {
-    [self.dirtyPropertySet addObject:@"stringTestAlphanumeric"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestAlphanumericProperty);
 
     _stringTestAlphanumeric = [newStringTestAlphanumeric copy];
 }
@@ -975,7 +1691,7 @@
 
 - (void)setStringTestUnicodeLetters:(NSString *)newStringTestUnicodeLetters
 {
-    [self.dirtyPropertySet addObject:@"stringTestUnicodeLetters"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodeLettersProperty);
 
     _stringTestUnicodeLetters = [newStringTestUnicodeLetters copy];
 }
@@ -987,7 +1703,7 @@
 
 - (void)setStringTestUnicodePrintable:(NSString *)newStringTestUnicodePrintable
 {
-    [self.dirtyPropertySet addObject:@"stringTestUnicodePrintable"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodePrintableProperty);
 
     _stringTestUnicodePrintable = [newStringTestUnicodePrintable copy];
 }
@@ -999,7 +1715,7 @@
 
 - (void)setStringTestEmailAddress:(NSString *)newStringTestEmailAddress
 {
-    [self.dirtyPropertySet addObject:@"stringTestEmailAddress"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmailAddressProperty);
 
     _stringTestEmailAddress = [newStringTestEmailAddress copy];
 }
@@ -1011,7 +1727,7 @@
 
 - (void)setStringTestLength:(NSString *)newStringTestLength
 {
-    [self.dirtyPropertySet addObject:@"stringTestLength"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestLengthProperty);
 
     _stringTestLength = [newStringTestLength copy];
 }
@@ -1023,7 +1739,7 @@
 
 - (void)setStringTestCaseSensitive:(NSString *)newStringTestCaseSensitive
 {
-    [self.dirtyPropertySet addObject:@"stringTestCaseSensitive"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestCaseSensitiveProperty);
 
     _stringTestCaseSensitive = [newStringTestCaseSensitive copy];
 }
@@ -1035,29 +1751,52 @@
 
 - (void)setStringTestFeatures:(NSString *)newStringTestFeatures
 {
-    [self.dirtyPropertySet addObject:@"stringTestFeatures"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestFeaturesProperty);
 
     _stringTestFeatures = [newStringTestFeatures copy];
 }
 
 - (NSArray *)basicPlural
 {
+    if (_basicPluralJson)
+    {
+        NSArray *json = _basicPluralJson;
+        _basicPluralJson = nil;
+        _basicPlural = [[json arrayOfBasicPluralElementsFromBasicPluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _basicPlural;
 }
 
 - (void)setBasicPlural:(NSArray *)newBasicPlural
 {
+    _basicPluralJson = nil;
+
     _basicPlural = [newBasicPlural copy];
 }
 
 - (JRBasicObject *)basicObject
 {
+    if (_basicObjectJson)
+    {
+        NSDictionary *json = _basicObjectJson;
+        _basicObjectJson = nil;
+        _basicObject = [JRBasicObject basicObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_basicObjectJsonCleared)
+            [_basicObject deepClearDirtyProperties];
+        else
+            [_basicObject setAllPropertiesToDirty];
+    }
+
     return _basicObject;
 }
 
 - (void)setBasicObject:(JRBasicObject *)newBasicObject
 {
-    [self.dirtyPropertySet addObject:@"basicObject"];
+    _basicObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicObjectProperty);
 
     _basicObject = newBasicObject;
 
@@ -1066,12 +1805,26 @@
 
 - (JRObjectTestRequired *)objectTestRequired
 {
+    if (_objectTestRequiredJson)
+    {
+        NSDictionary *json = _objectTestRequiredJson;
+        _objectTestRequiredJson = nil;
+        _objectTestRequired = [JRObjectTestRequired objectTestRequiredObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_objectTestRequiredJsonCleared)
+            [_objectTestRequired deepClearDirtyProperties];
+        else
+            [_objectTestRequired setAllPropertiesToDirty];
+    }
+
     return _objectTestRequired;
 }
 
 - (void)setObjectTestRequired:(JRObjectTestRequired *)newObjectTestRequired
 {
-    [self.dirtyPropertySet addObject:@"objectTestRequired"];
+    _objectTestRequiredJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserObjectTestRequiredProperty);
 
     _objectTestRequired = newObjectTestRequired;
 
@@ -1080,22 +1833,45 @@
 
 - (NSArray *)pluralTestUnique
 {
+    if (_pluralTestUniqueJson)
+    {
+        NSArray *json = _pluralTestUniqueJson;
+        _pluralTestUniqueJson = nil;
+        _pluralTestUnique = [[json arrayOfPluralTestUniqueElementsFromPluralTestUniqueDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pluralTestUnique;
 }
 
 - (void)setPluralTestUnique:(NSArray *)newPluralTestUnique
 {
+    _pluralTestUniqueJson = nil;
+
     _pluralTestUnique = [newPluralTestUnique copy];
 }
 
 - (JRObjectTestRequiredUnique *)objectTestRequiredUnique
 {
+    if (_objectTestRequiredUniqueJson)
+    {
+        NSDictionary *json = _objectTestRequiredUniqueJson;
+        _objectTestRequiredUniqueJson = nil;
+        _objectTestRequiredUnique = [JRObjectTestRequiredUnique objectTestRequiredUniqueObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_objectTestRequiredUniqueJsonCleared)
+            [_objectTestRequiredUnique deepClearDirtyProperties];
+        else
+            [_objectTestRequiredUnique setAllPropertiesToDirty];
+    }
+
     return _objectTestRequiredUnique;
 }
 
 - (void)setObjectTestRequiredUnique:(JRObjectTestRequiredUnique *)newObjectTestRequiredUnique
 {
-    [self.dirtyPropertySet addObject:@"objectTestRequiredUnique"];
+    _objectTestRequiredUniqueJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserObjectTestRequiredUniqueProperty);
 
     _objectTestRequiredUnique = newObjectTestRequiredUnique;
 
@@ -1104,11 +1880,20 @@
 
 - (NSArray *)pluralTestAlphabetic
 {
+    if (_pluralTestAlphabeticJson)
+    {
+        NSArray *json = _pluralTestAlphabeticJson;
+        _pluralTestAlphabeticJson = nil;
+        _pluralTestAlphabetic = [[json arrayOfPluralTestAlphabeticElementsFromPluralTestAlphabeticDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pluralTestAlphabetic;
 }
 
 - (void)setPluralTestAlphabetic:(NSArray *)newPluralTestAlphabetic
 {
+    _pluralTestAlphabeticJson = nil;
+
     _pluralTestAlphabetic = [newPluralTestAlphabetic copy];
 }
 
@@ -1134,22 +1919,45 @@
 
 - (NSArray *)pinapL1Plural
 {
+    if (_pinapL1PluralJson)
+    {
+        NSArray *json = _pinapL1PluralJson;
+        _pinapL1PluralJson = nil;
+        _pinapL1Plural = [[json arrayOfPinapL1PluralElementsFromPinapL1PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapL1Plural;
 }
 
 - (void)setPinapL1Plural:(NSArray *)newPinapL1Plural
 {
+    _pinapL1PluralJson = nil;
+
     _pinapL1Plural = [newPinapL1Plural copy];
 }
 
 - (JRPinoL1Object *)pinoL1Object
 {
+    if (_pinoL1ObjectJson)
+    {
+        NSDictionary *json = _pinoL1ObjectJson;
+        _pinoL1ObjectJson = nil;
+        _pinoL1Object = [JRPinoL1Object pinoL1ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_pinoL1ObjectJsonCleared)
+            [_pinoL1Object deepClearDirtyProperties];
+        else
+            [_pinoL1Object setAllPropertiesToDirty];
+    }
+
     return _pinoL1Object;
 }
 
 - (void)setPinoL1Object:(JRPinoL1Object *)newPinoL1Object
 {
-    [self.dirtyPropertySet addObject:@"pinoL1Object"];
+    _pinoL1ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinoL1ObjectProperty);
 
     _pinoL1Object = newPinoL1Object;
 
@@ -1158,22 +1966,45 @@
 
 - (NSArray *)onipL1Plural
 {
+    if (_onipL1PluralJson)
+    {
+        NSArray *json = _onipL1PluralJson;
+        _onipL1PluralJson = nil;
+        _onipL1Plural = [[json arrayOfOnipL1PluralElementsFromOnipL1PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _onipL1Plural;
 }
 
 - (void)setOnipL1Plural:(NSArray *)newOnipL1Plural
 {
+    _onipL1PluralJson = nil;
+
     _onipL1Plural = [newOnipL1Plural copy];
 }
 
 - (JROinoL1Object *)oinoL1Object
 {
+    if (_oinoL1ObjectJson)
+    {
+        NSDictionary *json = _oinoL1ObjectJson;
+        _oinoL1ObjectJson = nil;
+        _oinoL1Object = [JROinoL1Object oinoL1ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinoL1ObjectJsonCleared)
+            [_oinoL1Object deepClearDirtyProperties];
+        else
+            [_oinoL1Object setAllPropertiesToDirty];
+    }
+
     return _oinoL1Object;
 }
 
 - (void)setOinoL1Object:(JROinoL1Object *)newOinoL1Object
 {
-    [self.dirtyPropertySet addObject:@"oinoL1Object"];
+    _oinoL1ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOinoL1ObjectProperty);
 
     _oinoL1Object = newOinoL1Object;
 
@@ -1182,32 +2013,64 @@
 
 - (NSArray *)pinapinapL1Plural
 {
+    if (_pinapinapL1PluralJson)
+    {
+        NSArray *json = _pinapinapL1PluralJson;
+        _pinapinapL1PluralJson = nil;
+        _pinapinapL1Plural = [[json arrayOfPinapinapL1PluralElementsFromPinapinapL1PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapinapL1Plural;
 }
 
 - (void)setPinapinapL1Plural:(NSArray *)newPinapinapL1Plural
 {
+    _pinapinapL1PluralJson = nil;
+
     _pinapinapL1Plural = [newPinapinapL1Plural copy];
 }
 
 - (NSArray *)pinonipL1Plural
 {
+    if (_pinonipL1PluralJson)
+    {
+        NSArray *json = _pinonipL1PluralJson;
+        _pinonipL1PluralJson = nil;
+        _pinonipL1Plural = [[json arrayOfPinonipL1PluralElementsFromPinonipL1PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinonipL1Plural;
 }
 
 - (void)setPinonipL1Plural:(NSArray *)newPinonipL1Plural
 {
+    _pinonipL1PluralJson = nil;
+
     _pinonipL1Plural = [newPinonipL1Plural copy];
 }
 
 - (JRPinapinoL1Object *)pinapinoL1Object
 {
+    if (_pinapinoL1ObjectJson)
+    {
+        NSDictionary *json = _pinapinoL1ObjectJson;
+        _pinapinoL1ObjectJson = nil;
+        _pinapinoL1Object = [JRPinapinoL1Object pinapinoL1ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_pinapinoL1ObjectJsonCleared)
+            [_pinapinoL1Object deepClearDirtyProperties];
+        else
+            [_pinapinoL1Object setAllPropertiesToDirty];
+    }
+
     return _pinapinoL1Object;
 }
 
 - (void)setPinapinoL1Object:(JRPinapinoL1Object *)newPinapinoL1Object
 {
-    [self.dirtyPropertySet addObject:@"pinapinoL1Object"];
+    _pinapinoL1ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinapinoL1ObjectProperty);
 
     _pinapinoL1Object = newPinapinoL1Object;
 
@@ -1216,12 +2079,26 @@
 
 - (JRPinoinoL1Object *)pinoinoL1Object
 {
+    if (_pinoinoL1ObjectJson)
+    {
+        NSDictionary *json = _pinoinoL1ObjectJson;
+        _pinoinoL1ObjectJson = nil;
+        _pinoinoL1Object = [JRPinoinoL1Object pinoinoL1ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_pinoinoL1ObjectJsonCleared)
+            [_pinoinoL1Object deepClearDirtyProperties];
+        else
+            [_pinoinoL1Object setAllPropertiesToDirty];
+    }
+
     return _pinoinoL1Object;
 }
 
 - (void)setPinoinoL1Object:(JRPinoinoL1Object *)newPinoinoL1Object
 {
-    [self.dirtyPropertySet addObject:@"pinoinoL1Object"];
+    _pinoinoL1ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinoinoL1ObjectProperty);
 
     _pinoinoL1Object = newPinoinoL1Object;
 
@@ -1230,32 +2107,64 @@
 
 - (NSArray *)onipinapL1Plural
 {
+    if (_onipinapL1PluralJson)
+    {
+        NSArray *json = _onipinapL1PluralJson;
+        _onipinapL1PluralJson = nil;
+        _onipinapL1Plural = [[json arrayOfOnipinapL1PluralElementsFromOnipinapL1PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _onipinapL1Plural;
 }
 
 - (void)setOnipinapL1Plural:(NSArray *)newOnipinapL1Plural
 {
+    _onipinapL1PluralJson = nil;
+
     _onipinapL1Plural = [newOnipinapL1Plural copy];
 }
 
 - (NSArray *)oinonipL1Plural
 {
+    if (_oinonipL1PluralJson)
+    {
+        NSArray *json = _oinonipL1PluralJson;
+        _oinonipL1PluralJson = nil;
+        _oinonipL1Plural = [[json arrayOfOinonipL1PluralElementsFromOinonipL1PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _oinonipL1Plural;
 }
 
 - (void)setOinonipL1Plural:(NSArray *)newOinonipL1Plural
 {
+    _oinonipL1PluralJson = nil;
+
     _oinonipL1Plural = [newOinonipL1Plural copy];
 }
 
 - (JROnipinoL1Object *)onipinoL1Object
 {
+    if (_onipinoL1ObjectJson)
+    {
+        NSDictionary *json = _onipinoL1ObjectJson;
+        _onipinoL1ObjectJson = nil;
+        _onipinoL1Object = [JROnipinoL1Object onipinoL1ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_onipinoL1ObjectJsonCleared)
+            [_onipinoL1Object deepClearDirtyProperties];
+        else
+            [_onipinoL1Object setAllPropertiesToDirty];
+    }
+
     return _onipinoL1Object;
 }
 
 - (void)setOnipinoL1Object:(JROnipinoL1Object *)newOnipinoL1Object
 {
-    [self.dirtyPropertySet addObject:@"onipinoL1Object"];
+    _onipinoL1ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOnipinoL1ObjectProperty);
 
     _onipinoL1Object = newOnipinoL1Object;
 
@@ -1264,12 +2173,26 @@
 
 - (JROinoinoL1Object *)oinoinoL1Object
 {
+    if (_oinoinoL1ObjectJson)
+    {
+        NSDictionary *json = _oinoinoL1ObjectJson;
+        _oinoinoL1ObjectJson = nil;
+        _oinoinoL1Object = [JROinoinoL1Object oinoinoL1ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinoinoL1ObjectJsonCleared)
+            [_oinoinoL1Object deepClearDirtyProperties];
+        else
+            [_oinoinoL1Object setAllPropertiesToDirty];
+    }
+
     return _oinoinoL1Object;
 }
 
 - (void)setOinoinoL1Object:(JROinoinoL1Object *)newOinoinoL1Object
 {
-    [self.dirtyPropertySet addObject:@"oinoinoL1Object"];
+    _oinoinoL1ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOinoinoL1ObjectProperty);
 
     _oinoinoL1Object = newOinoinoL1Object;
 
@@ -1283,7 +2206,7 @@
 
 - (void)setCaptureUserId:(JRObjectId *)newCaptureUserId
 {
-    [self.dirtyPropertySet addObject:@"captureUserId"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRCaptureUserCaptureUserIdProperty);
 
     _captureUserId = [newCaptureUserId copy];
 }
@@ -1305,7 +2228,7 @@
         _onipinoL1Object = [[JROnipinoL1Object alloc] init];
         _oinoinoL1Object = [[JROinoinoL1Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -1447,6 +2370,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     captureUser.uuid =
         [dictionary objectForKey:@"uuid"] != [NSNull null] ? 
         [dictionary objectForKey:@"uuid"] : nil;
@@ -1559,29 +2484,47 @@
         [dictionary objectForKey:@"stringTestFeatures"] != [NSNull null] ? 
         [dictionary objectForKey:@"stringTestFeatures"] : nil;
 
-    captureUser.basicPlural =
-        [dictionary objectForKey:@"basicPlural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"basicPlural"] arrayOfBasicPluralElementsFromBasicPluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"basicPlural"] isKindOfClass:[NSArray class]])
+        captureUser->_basicPluralJson = [dictionary objectForKey:@"basicPlural"];
+    else
+        captureUser.basicPlural =
+            [dictionary objectForKey:@"basicPlural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"basicPlural"] arrayOfBasicPluralElementsFromBasicPluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.basicObject =
-        [dictionary objectForKey:@"basicObject"] != [NSNull null] ? 
-        [JRBasicObject basicObjectObjectFromDictionary:[dictionary objectForKey:@"basicObject"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"basicObject"] isKindOfClass:[NSDictionary class]])
+        captureUser->_basicObjectJson = [dictionary objectForKey:@"basicObject"];
+    else
+        captureUser.basicObject =
+            [dictionary objectForKey:@"basicObject"] != [NSNull null] ? 
+            [JRBasicObject basicObjectObjectFromDictionary:[dictionary objectForKey:@"basicObject"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.objectTestRequired =
-        [dictionary objectForKey:@"objectTestRequired"] != [NSNull null] ? 
-        [JRObjectTestRequired objectTestRequiredObjectFromDictionary:[dictionary objectForKey:@"objectTestRequired"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"objectTestRequired"] isKindOfClass:[NSDictionary class]])
+        captureUser->_objectTestRequiredJson = [dictionary objectForKey:@"objectTestRequired"];
+    else
+        captureUser.objectTestRequired =
+            [dictionary objectForKey:@"objectTestRequired"] != [NSNull null] ? 
+            [JRObjectTestRequired objectTestRequiredObjectFromDictionary:[dictionary objectForKey:@"objectTestRequired"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pluralTestUnique =
-        [dictionary objectForKey:@"pluralTestUnique"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pluralTestUnique"] arrayOfPluralTestUniqueElementsFromPluralTestUniqueDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pluralTestUnique"] isKindOfClass:[NSArray class]])
+        captureUser->_pluralTestUniqueJson = [dictionary objectForKey:@"pluralTestUnique"];
+    else
+        captureUser.pluralTestUnique =
+            [dictionary objectForKey:@"pluralTestUnique"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pluralTestUnique"] arrayOfPluralTestUniqueElementsFromPluralTestUniqueDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.objectTestRequiredUnique =
-        [dictionary objectForKey:@"objectTestRequiredUnique"] != [NSNull null] ? 
-        [JRObjectTestRequiredUnique objectTestRequiredUniqueObjectFromDictionary:[dictionary objectForKey:@"objectTestRequiredUnique"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"objectTestRequiredUnique"] isKindOfClass:[NSDictionary class]])
+        captureUser->_objectTestRequiredUniqueJson = [dictionary objectForKey:@"objectTestRequiredUnique"];
+    else
+        captureUser.objectTestRequiredUnique =
+            [dictionary objectForKey:@"objectTestRequiredUnique"] != [NSNull null] ? 
+            [JRObjectTestRequiredUnique objectTestRequiredUniqueObjectFromDictionary:[dictionary objectForKey:@"objectTestRequiredUnique"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pluralTestAlphabetic =
-        [dictionary objectForKey:@"pluralTestAlphabetic"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pluralTestAlphabetic"] arrayOfPluralTestAlphabeticElementsFromPluralTestAlphabeticDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pluralTestAlphabetic"] isKindOfClass:[NSArray class]])
+        captureUser->_pluralTestAlphabeticJson = [dictionary objectForKey:@"pluralTestAlphabetic"];
+    else
+        captureUser.pluralTestAlphabetic =
+            [dictionary objectForKey:@"pluralTestAlphabetic"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pluralTestAlphabetic"] arrayOfPluralTestAlphabeticElementsFromPluralTestAlphabeticDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     captureUser.simpleStringPluralOne =
         [dictionary objectForKey:@"simpleStringPluralOne"] != [NSNull null] ? 
@@ -1591,53 +2534,89 @@
         [dictionary objectForKey:@"simpleStringPluralTwo"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"simpleStringPluralTwo"] arrayOfStringsFromStringPluralDictionariesWithType:@"simpleTypeTwo"] : nil;
 
-    captureUser.pinapL1Plural =
-        [dictionary objectForKey:@"pinapL1Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapL1Plural"] arrayOfPinapL1PluralElementsFromPinapL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapL1Plural"] isKindOfClass:[NSArray class]])
+        captureUser->_pinapL1PluralJson = [dictionary objectForKey:@"pinapL1Plural"];
+    else
+        captureUser.pinapL1Plural =
+            [dictionary objectForKey:@"pinapL1Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapL1Plural"] arrayOfPinapL1PluralElementsFromPinapL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pinoL1Object =
-        [dictionary objectForKey:@"pinoL1Object"] != [NSNull null] ? 
-        [JRPinoL1Object pinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"pinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinoL1Object"] isKindOfClass:[NSDictionary class]])
+        captureUser->_pinoL1ObjectJson = [dictionary objectForKey:@"pinoL1Object"];
+    else
+        captureUser.pinoL1Object =
+            [dictionary objectForKey:@"pinoL1Object"] != [NSNull null] ? 
+            [JRPinoL1Object pinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"pinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.onipL1Plural =
-        [dictionary objectForKey:@"onipL1Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"onipL1Plural"] arrayOfOnipL1PluralElementsFromOnipL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipL1Plural"] isKindOfClass:[NSArray class]])
+        captureUser->_onipL1PluralJson = [dictionary objectForKey:@"onipL1Plural"];
+    else
+        captureUser.onipL1Plural =
+            [dictionary objectForKey:@"onipL1Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"onipL1Plural"] arrayOfOnipL1PluralElementsFromOnipL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.oinoL1Object =
-        [dictionary objectForKey:@"oinoL1Object"] != [NSNull null] ? 
-        [JROinoL1Object oinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinoL1Object"] isKindOfClass:[NSDictionary class]])
+        captureUser->_oinoL1ObjectJson = [dictionary objectForKey:@"oinoL1Object"];
+    else
+        captureUser.oinoL1Object =
+            [dictionary objectForKey:@"oinoL1Object"] != [NSNull null] ? 
+            [JROinoL1Object oinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pinapinapL1Plural =
-        [dictionary objectForKey:@"pinapinapL1Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapinapL1Plural"] arrayOfPinapinapL1PluralElementsFromPinapinapL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapinapL1Plural"] isKindOfClass:[NSArray class]])
+        captureUser->_pinapinapL1PluralJson = [dictionary objectForKey:@"pinapinapL1Plural"];
+    else
+        captureUser.pinapinapL1Plural =
+            [dictionary objectForKey:@"pinapinapL1Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinapL1Plural"] arrayOfPinapinapL1PluralElementsFromPinapinapL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pinonipL1Plural =
-        [dictionary objectForKey:@"pinonipL1Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinonipL1Plural"] arrayOfPinonipL1PluralElementsFromPinonipL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinonipL1Plural"] isKindOfClass:[NSArray class]])
+        captureUser->_pinonipL1PluralJson = [dictionary objectForKey:@"pinonipL1Plural"];
+    else
+        captureUser.pinonipL1Plural =
+            [dictionary objectForKey:@"pinonipL1Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinonipL1Plural"] arrayOfPinonipL1PluralElementsFromPinonipL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pinapinoL1Object =
-        [dictionary objectForKey:@"pinapinoL1Object"] != [NSNull null] ? 
-        [JRPinapinoL1Object pinapinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"pinapinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapinoL1Object"] isKindOfClass:[NSDictionary class]])
+        captureUser->_pinapinoL1ObjectJson = [dictionary objectForKey:@"pinapinoL1Object"];
+    else
+        captureUser.pinapinoL1Object =
+            [dictionary objectForKey:@"pinapinoL1Object"] != [NSNull null] ? 
+            [JRPinapinoL1Object pinapinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"pinapinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.pinoinoL1Object =
-        [dictionary objectForKey:@"pinoinoL1Object"] != [NSNull null] ? 
-        [JRPinoinoL1Object pinoinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"pinoinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinoinoL1Object"] isKindOfClass:[NSDictionary class]])
+        captureUser->_pinoinoL1ObjectJson = [dictionary objectForKey:@"pinoinoL1Object"];
+    else
+        captureUser.pinoinoL1Object =
+            [dictionary objectForKey:@"pinoinoL1Object"] != [NSNull null] ? 
+            [JRPinoinoL1Object pinoinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"pinoinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.onipinapL1Plural =
-        [dictionary objectForKey:@"onipinapL1Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"onipinapL1Plural"] arrayOfOnipinapL1PluralElementsFromOnipinapL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipinapL1Plural"] isKindOfClass:[NSArray class]])
+        captureUser->_onipinapL1PluralJson = [dictionary objectForKey:@"onipinapL1Plural"];
+    else
+        captureUser.onipinapL1Plural =
+            [dictionary objectForKey:@"onipinapL1Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"onipinapL1Plural"] arrayOfOnipinapL1PluralElementsFromOnipinapL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.oinonipL1Plural =
-        [dictionary objectForKey:@"oinonipL1Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"oinonipL1Plural"] arrayOfOinonipL1PluralElementsFromOinonipL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinonipL1Plural"] isKindOfClass:[NSArray class]])
+        captureUser->_oinonipL1PluralJson = [dictionary objectForKey:@"oinonipL1Plural"];
+    else
+        captureUser.oinonipL1Plural =
+            [dictionary objectForKey:@"oinonipL1Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"oinonipL1Plural"] arrayOfOinonipL1PluralElementsFromOinonipL1PluralDictionariesWithPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.onipinoL1Object =
-        [dictionary objectForKey:@"onipinoL1Object"] != [NSNull null] ? 
-        [JROnipinoL1Object onipinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipinoL1Object"] isKindOfClass:[NSDictionary class]])
+        captureUser->_onipinoL1ObjectJson = [dictionary objectForKey:@"onipinoL1Object"];
+    else
+        captureUser.onipinoL1Object =
+            [dictionary objectForKey:@"onipinoL1Object"] != [NSNull null] ? 
+            [JROnipinoL1Object onipinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
-    captureUser.oinoinoL1Object =
-        [dictionary objectForKey:@"oinoinoL1Object"] != [NSNull null] ? 
-        [JROinoinoL1Object oinoinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinoinoL1Object"] isKindOfClass:[NSDictionary class]])
+        captureUser->_oinoinoL1ObjectJson = [dictionary objectForKey:@"oinoinoL1Object"];
+    else
+        captureUser.oinoinoL1Object =
+            [dictionary objectForKey:@"oinoinoL1Object"] != [NSNull null] ? 
+            [JROinoinoL1Object oinoinoL1ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoinoL1Object"] withPath:captureUser.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     captureUser.captureUserId =
         [dictionary objectForKey:@"id"] != [NSNull null] ? 
@@ -1656,6 +2635,741 @@
     return [JRCaptureUser captureUserObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    captureUser.basicBoolean = [NSNumber numberWithBool:NO];
+    captureUser.basicInteger = [NSNumber numberWithInteger:0];
+    captureUser.basicObject = nil;
+    captureUser.objectTestRequired = nil;
+    captureUser.objectTestRequiredUnique = nil;
+    captureUser.pinoL1Object = nil;
+    captureUser.oinoL1Object = nil;
+    captureUser.pinapinoL1Object = nil;
+    captureUser.pinoinoL1Object = nil;
+    captureUser.onipinoL1Object = nil;
+    captureUser.oinoinoL1Object = nil;
+    captureUser.captureUserId = [NSNumber numberWithInteger:0];
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 9) & 511)
+        {
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "objectTestRequired")) break;
+                if (!lazily)
+                    captureUser.objectTestRequired = [JRObjectTestRequired objectTestRequiredObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_objectTestRequiredJson = value;
+                continue;
+            case 36:
+                if (!JRJsonKeyEquals(key, keyLength, "email")) break;
+                value = [reader readValue];
+                captureUser.email = value != [NSNull null] ? value : nil;
+                continue;
+            case 42:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinoL1Object")) break;
+                if (!lazily)
+                    captureUser.pinapinoL1Object = [JRPinapinoL1Object pinapinoL1ObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_pinapinoL1ObjectJson = value;
+                continue;
+            case 46:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestAlphanumeric")) break;
+                value = [reader readValue];
+                captureUser.stringTestAlphanumeric = value != [NSNull null] ? value : nil;
+                continue;
+            case 51:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestCaseSensitive")) break;
+                value = [reader readValue];
+                captureUser.stringTestCaseSensitive = value != [NSNull null] ? value : nil;
+                continue;
+            case 66:
+                if (!JRJsonKeyEquals(key, keyLength, "basicBoolean")) break;
+                value = [reader readValue];
+                captureUser.basicBoolean = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 71:
+                if (!JRJsonKeyEquals(key, keyLength, "uuid")) break;
+                value = [reader readValue];
+                captureUser.uuid = value != [NSNull null] ? value : nil;
+                continue;
+            case 95:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestNSNull")) break;
+                value = [reader readValue];
+                captureUser.stringTestNSNull = value != [NSNull null] ? value : nil;
+                continue;
+            case 107:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestUnicodePrintable")) break;
+                value = [reader readValue];
+                captureUser.stringTestUnicodePrintable = value != [NSNull null] ? value : nil;
+                continue;
+            case 113:
+                if (!JRJsonKeyEquals(key, keyLength, "basicDecimal")) break;
+                value = [reader readValue];
+                captureUser.basicDecimal = value != [NSNull null] ? value : nil;
+                continue;
+            case 137:
+                if (!JRJsonKeyEquals(key, keyLength, "onipL1Plural")) break;
+                if (!lazily)
+                    captureUser.onipL1Plural = [NSArray arrayOfOnipL1PluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_onipL1PluralJson = value;
+                continue;
+            case 139:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapL1Plural")) break;
+                if (!lazily)
+                    captureUser.pinapL1Plural = [NSArray arrayOfPinapL1PluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_pinapL1PluralJson = value;
+                continue;
+            case 153:
+                if (!JRJsonKeyEquals(key, keyLength, "pluralTestAlphabetic")) break;
+                if (!lazily)
+                    captureUser.pluralTestAlphabetic = [NSArray arrayOfPluralTestAlphabeticElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_pluralTestAlphabeticJson = value;
+                continue;
+            case 155:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestJson")) break;
+                value = [reader readValue];
+                captureUser.stringTestJson = value != [NSNull null] ? value : nil;
+                continue;
+            case 158:
+                if (!JRJsonKeyEquals(key, keyLength, "basicDate")) break;
+                value = [reader readValue];
+                captureUser.basicDate = value != [NSNull null] ? [JRDate dateFromISO8601DateString:value] : nil;
+                continue;
+            case 160:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinoL1Object")) break;
+                if (!lazily)
+                    captureUser.onipinoL1Object = [JROnipinoL1Object onipinoL1ObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_onipinoL1ObjectJson = value;
+                continue;
+            case 173:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestEmailAddress")) break;
+                value = [reader readValue];
+                captureUser.stringTestEmailAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 177:
+                if (!JRJsonKeyEquals(key, keyLength, "simpleStringPluralTwo")) break;
+                value = [reader readValue];
+                captureUser.simpleStringPluralTwo = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"simpleTypeTwo"] : nil;
+                continue;
+            case 183:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonArray")) break;
+                value = [reader readValue];
+                captureUser.jsonArray = value != [NSNull null] ? value : nil;
+                continue;
+            case 187:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonNumber")) break;
+                value = [reader readValue];
+                captureUser.jsonNumber = value != [NSNull null] ? value : nil;
+                continue;
+            case 193:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                captureUser.captureUserId = value != [NSNull null] ? [NSNumber numberWithInteger:[(NSNumber*)value integerValue]] : nil;
+                continue;
+            case 223:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonString")) break;
+                value = [reader readValue];
+                captureUser.jsonString = value != [NSNull null] ? value : nil;
+                continue;
+            case 226:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonDictionary")) break;
+                value = [reader readValue];
+                captureUser.jsonDictionary = value != [NSNull null] ? value : nil;
+                continue;
+            case 233:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoinoL1Object")) break;
+                if (!lazily)
+                    captureUser.oinoinoL1Object = [JROinoinoL1Object oinoinoL1ObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_oinoinoL1ObjectJson = value;
+                continue;
+            case 243:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinapL1Plural")) break;
+                if (!lazily)
+                    captureUser.onipinapL1Plural = [NSArray arrayOfOnipinapL1PluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_onipinapL1PluralJson = value;
+                continue;
+            case 244:
+                if (!JRJsonKeyEquals(key, keyLength, "basicPlural")) break;
+                if (!lazily)
+                    captureUser.basicPlural = [NSArray arrayOfBasicPluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_basicPluralJson = value;
+                continue;
+            case 254:
+                if (!JRJsonKeyEquals(key, keyLength, "pinonipL1Plural")) break;
+                if (!lazily)
+                    captureUser.pinonipL1Plural = [NSArray arrayOfPinonipL1PluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_pinonipL1PluralJson = value;
+                continue;
+            case 263:
+                if (!JRJsonKeyEquals(key, keyLength, "simpleStringPluralOne")) break;
+                value = [reader readValue];
+                captureUser.simpleStringPluralOne = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"simpleTypeOne"] : nil;
+                continue;
+            case 275:
+                if (!JRJsonKeyEquals(key, keyLength, "basicString")) break;
+                value = [reader readValue];
+                captureUser.basicString = value != [NSNull null] ? value : nil;
+                continue;
+            case 280:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoL1Object")) break;
+                if (!lazily)
+                    captureUser.pinoL1Object = [JRPinoL1Object pinoL1ObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_pinoL1ObjectJson = value;
+                continue;
+            case 285:
+                if (!JRJsonKeyEquals(key, keyLength, "pluralTestUnique")) break;
+                if (!lazily)
+                    captureUser.pluralTestUnique = [NSArray arrayOfPluralTestUniqueElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_pluralTestUniqueJson = value;
+                continue;
+            case 292:
+                if (!JRJsonKeyEquals(key, keyLength, "basicInteger")) break;
+                value = [reader readValue];
+                captureUser.basicInteger = value != [NSNull null] ? [NSNumber numberWithInteger:[(NSNumber*)value integerValue]] : nil;
+                continue;
+            case 305:
+                if (!JRJsonKeyEquals(key, keyLength, "basicObject")) break;
+                if (!lazily)
+                    captureUser.basicObject = [JRBasicObject basicObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_basicObjectJson = value;
+                continue;
+            case 311:
+                if (!JRJsonKeyEquals(key, keyLength, "basicPassword")) break;
+                value = [reader readValue];
+                captureUser.basicPassword = value != [NSNull null] ? value : nil;
+                continue;
+            case 315:
+                if (!JRJsonKeyEquals(key, keyLength, "lastUpdated")) break;
+                value = [reader readValue];
+                captureUser.lastUpdated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 333:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestLength")) break;
+                value = [reader readValue];
+                captureUser.stringTestLength = value != [NSNull null] ? value : nil;
+                continue;
+            case 338:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestFeatures")) break;
+                value = [reader readValue];
+                captureUser.stringTestFeatures = value != [NSNull null] ? value : nil;
+                continue;
+            case 390:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestEmpty")) break;
+                value = [reader readValue];
+                captureUser.stringTestEmpty = value != [NSNull null] ? value : nil;
+                continue;
+            case 392:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestInvalid")) break;
+                value = [reader readValue];
+                captureUser.stringTestInvalid = value != [NSNull null] ? value : nil;
+                continue;
+            case 401:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestUnicodeLetters")) break;
+                value = [reader readValue];
+                captureUser.stringTestUnicodeLetters = value != [NSNull null] ? value : nil;
+                continue;
+            case 407:
+                if (!JRJsonKeyEquals(key, keyLength, "basicDateTime")) break;
+                value = [reader readValue];
+                captureUser.basicDateTime = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 416:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoinoL1Object")) break;
+                if (!lazily)
+                    captureUser.pinoinoL1Object = [JRPinoinoL1Object pinoinoL1ObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_pinoinoL1ObjectJson = value;
+                continue;
+            case 421:
+                if (!JRJsonKeyEquals(key, keyLength, "objectTestRequiredUnique")) break;
+                if (!lazily)
+                    captureUser.objectTestRequiredUnique = [JRObjectTestRequiredUnique objectTestRequiredUniqueObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_objectTestRequiredUniqueJson = value;
+                continue;
+            case 433:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinapL1Plural")) break;
+                if (!lazily)
+                    captureUser.pinapinapL1Plural = [NSArray arrayOfPinapinapL1PluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_pinapinapL1PluralJson = value;
+                continue;
+            case 444:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestNull")) break;
+                value = [reader readValue];
+                captureUser.stringTestNull = value != [NSNull null] ? value : nil;
+                continue;
+            case 463:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoL1Object")) break;
+                if (!lazily)
+                    captureUser.oinoL1Object = [JROinoL1Object oinoL1ObjectObjectFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    captureUser->_oinoL1ObjectJson = value;
+                continue;
+            case 468:
+                if (!JRJsonKeyEquals(key, keyLength, "created")) break;
+                value = [reader readValue];
+                captureUser.created = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 473:
+                if (!JRJsonKeyEquals(key, keyLength, "basicIpAddress")) break;
+                value = [reader readValue];
+                captureUser.basicIpAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 475:
+                if (!JRJsonKeyEquals(key, keyLength, "oinonipL1Plural")) break;
+                if (!lazily)
+                    captureUser.oinonipL1Plural = [NSArray arrayOfOinonipL1PluralElementsFromJsonReader:reader withPath:captureUser.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    captureUser->_oinonipL1PluralJson = value;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [captureUser.dirtyPropertySet removeAllObjects];
+
+    return captureUser;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"uuid"];
+    [writer writeValue:self.uuid];
+    [writer writeKey:@"created"];
+    [writer writeValue:(self.created ? [self.created stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"lastUpdated"];
+    [writer writeValue:(self.lastUpdated ? [self.lastUpdated stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"email"];
+    [writer writeValue:self.email];
+    [writer writeKey:@"basicBoolean"];
+    [writer writeValue:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : nil)];
+    [writer writeKey:@"basicString"];
+    [writer writeValue:self.basicString];
+    [writer writeKey:@"basicInteger"];
+    [writer writeValue:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : nil)];
+    [writer writeKey:@"basicDecimal"];
+    [writer writeValue:self.basicDecimal];
+    [writer writeKey:@"basicDate"];
+    [writer writeValue:(self.basicDate ? [self.basicDate stringFromISO8601Date] : nil)];
+    [writer writeKey:@"basicDateTime"];
+    [writer writeValue:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : nil)];
+    [writer writeKey:@"basicIpAddress"];
+    [writer writeValue:self.basicIpAddress];
+    [writer writeKey:@"basicPassword"];
+    [writer writeValue:self.basicPassword];
+    [writer writeKey:@"jsonNumber"];
+    [writer writeValue:self.jsonNumber];
+    [writer writeKey:@"jsonString"];
+    [writer writeValue:self.jsonString];
+    [writer writeKey:@"jsonArray"];
+    [writer writeValue:self.jsonArray];
+    [writer writeKey:@"jsonDictionary"];
+    [writer writeValue:self.jsonDictionary];
+    [writer writeKey:@"stringTestJson"];
+    [writer writeValue:self.stringTestJson];
+    [writer writeKey:@"stringTestEmpty"];
+    [writer writeValue:self.stringTestEmpty];
+    [writer writeKey:@"stringTestNull"];
+    [writer writeValue:self.stringTestNull];
+    [writer writeKey:@"stringTestInvalid"];
+    [writer writeValue:self.stringTestInvalid];
+    [writer writeKey:@"stringTestNSNull"];
+    [writer writeValue:self.stringTestNSNull];
+    [writer writeKey:@"stringTestAlphanumeric"];
+    [writer writeValue:self.stringTestAlphanumeric];
+    [writer writeKey:@"stringTestUnicodeLetters"];
+    [writer writeValue:self.stringTestUnicodeLetters];
+    [writer writeKey:@"stringTestUnicodePrintable"];
+    [writer writeValue:self.stringTestUnicodePrintable];
+    [writer writeKey:@"stringTestEmailAddress"];
+    [writer writeValue:self.stringTestEmailAddress];
+    [writer writeKey:@"stringTestLength"];
+    [writer writeValue:self.stringTestLength];
+    [writer writeKey:@"stringTestCaseSensitive"];
+    [writer writeValue:self.stringTestCaseSensitive];
+    [writer writeKey:@"stringTestFeatures"];
+    [writer writeValue:self.stringTestFeatures];
+    [writer writeKey:@"basicPlural"];
+    if (self.basicPlural)
+        [self.basicPlural writeBasicPluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"basicObject"];
+    if (self.basicObject)
+        [self.basicObject writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"objectTestRequired"];
+    if (self.objectTestRequired)
+        [self.objectTestRequired writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pluralTestUnique"];
+    if (self.pluralTestUnique)
+        [self.pluralTestUnique writePluralTestUniqueElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"objectTestRequiredUnique"];
+    if (self.objectTestRequiredUnique)
+        [self.objectTestRequiredUnique writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pluralTestAlphabetic"];
+    if (self.pluralTestAlphabetic)
+        [self.pluralTestAlphabetic writePluralTestAlphabeticElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"simpleStringPluralOne"];
+    [writer writeValue:self.simpleStringPluralOne];
+    [writer writeKey:@"simpleStringPluralTwo"];
+    [writer writeValue:self.simpleStringPluralTwo];
+    [writer writeKey:@"pinapL1Plural"];
+    if (self.pinapL1Plural)
+        [self.pinapL1Plural writePinapL1PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pinoL1Object"];
+    if (self.pinoL1Object)
+        [self.pinoL1Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"onipL1Plural"];
+    if (self.onipL1Plural)
+        [self.onipL1Plural writeOnipL1PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"oinoL1Object"];
+    if (self.oinoL1Object)
+        [self.oinoL1Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pinapinapL1Plural"];
+    if (self.pinapinapL1Plural)
+        [self.pinapinapL1Plural writePinapinapL1PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pinonipL1Plural"];
+    if (self.pinonipL1Plural)
+        [self.pinonipL1Plural writePinonipL1PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pinapinoL1Object"];
+    if (self.pinapinoL1Object)
+        [self.pinapinoL1Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"pinoinoL1Object"];
+    if (self.pinoinoL1Object)
+        [self.pinoinoL1Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"onipinapL1Plural"];
+    if (self.onipinapL1Plural)
+        [self.onipinapL1Plural writeOnipinapL1PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"oinonipL1Plural"];
+    if (self.oinonipL1Plural)
+        [self.oinonipL1Plural writeOinonipL1PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"onipinoL1Object"];
+    if (self.onipinoL1Object)
+        [self.onipinoL1Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"oinoinoL1Object"];
+    if (self.oinoinoL1Object)
+        [self.oinoinoL1Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer writeKey:@"id"];
+    [writer writeValue:(self.captureUserId ? [NSNumber numberWithInteger:[self.captureUserId integerValue]] : nil)];
+    [writer endObject];
+}
+
++ (id)captureUserObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    captureUser.captureObjectPath = [reader readString];
+    captureUser.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 9) & 511)
+        {
+            case 26:
+                if (!JRJsonKeyEquals(key, keyLength, "objectTestRequired")) break;
+                captureUser.objectTestRequired = [JRObjectTestRequired objectTestRequiredObjectFromArchive:reader];
+                continue;
+            case 36:
+                if (!JRJsonKeyEquals(key, keyLength, "email")) break;
+                value = [reader readValue];
+                captureUser.email = value != [NSNull null] ? value : nil;
+                continue;
+            case 42:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinoL1Object")) break;
+                captureUser.pinapinoL1Object = [JRPinapinoL1Object pinapinoL1ObjectObjectFromArchive:reader];
+                continue;
+            case 46:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestAlphanumeric")) break;
+                value = [reader readValue];
+                captureUser.stringTestAlphanumeric = value != [NSNull null] ? value : nil;
+                continue;
+            case 51:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestCaseSensitive")) break;
+                value = [reader readValue];
+                captureUser.stringTestCaseSensitive = value != [NSNull null] ? value : nil;
+                continue;
+            case 66:
+                if (!JRJsonKeyEquals(key, keyLength, "basicBoolean")) break;
+                value = [reader readValue];
+                captureUser.basicBoolean = value != [NSNull null] ? [NSNumber numberWithBool:[(NSNumber*)value boolValue]] : nil;
+                continue;
+            case 71:
+                if (!JRJsonKeyEquals(key, keyLength, "uuid")) break;
+                value = [reader readValue];
+                captureUser.uuid = value != [NSNull null] ? value : nil;
+                continue;
+            case 95:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestNSNull")) break;
+                value = [reader readValue];
+                captureUser.stringTestNSNull = value != [NSNull null] ? value : nil;
+                continue;
+            case 107:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestUnicodePrintable")) break;
+                value = [reader readValue];
+                captureUser.stringTestUnicodePrintable = value != [NSNull null] ? value : nil;
+                continue;
+            case 113:
+                if (!JRJsonKeyEquals(key, keyLength, "basicDecimal")) break;
+                value = [reader readValue];
+                captureUser.basicDecimal = value != [NSNull null] ? value : nil;
+                continue;
+            case 137:
+                if (!JRJsonKeyEquals(key, keyLength, "onipL1Plural")) break;
+                captureUser.onipL1Plural = [NSArray arrayOfOnipL1PluralElementsFromArchive:reader];
+                continue;
+            case 139:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapL1Plural")) break;
+                captureUser.pinapL1Plural = [NSArray arrayOfPinapL1PluralElementsFromArchive:reader];
+                continue;
+            case 153:
+                if (!JRJsonKeyEquals(key, keyLength, "pluralTestAlphabetic")) break;
+                captureUser.pluralTestAlphabetic = [NSArray arrayOfPluralTestAlphabeticElementsFromArchive:reader];
+                continue;
+            case 155:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestJson")) break;
+                value = [reader readValue];
+                captureUser.stringTestJson = value != [NSNull null] ? value : nil;
+                continue;
+            case 158:
+                if (!JRJsonKeyEquals(key, keyLength, "basicDate")) break;
+                value = [reader readValue];
+                captureUser.basicDate = value != [NSNull null] ? [JRDate dateFromISO8601DateString:value] : nil;
+                continue;
+            case 160:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinoL1Object")) break;
+                captureUser.onipinoL1Object = [JROnipinoL1Object onipinoL1ObjectObjectFromArchive:reader];
+                continue;
+            case 173:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestEmailAddress")) break;
+                value = [reader readValue];
+                captureUser.stringTestEmailAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 177:
+                if (!JRJsonKeyEquals(key, keyLength, "simpleStringPluralTwo")) break;
+                value = [reader readValue];
+                captureUser.simpleStringPluralTwo = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"simpleTypeTwo"] : nil;
+                continue;
+            case 183:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonArray")) break;
+                value = [reader readValue];
+                captureUser.jsonArray = value != [NSNull null] ? value : nil;
+                continue;
+            case 187:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonNumber")) break;
+                value = [reader readValue];
+                captureUser.jsonNumber = value != [NSNull null] ? value : nil;
+                continue;
+            case 193:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                captureUser.captureUserId = value != [NSNull null] ? [NSNumber numberWithInteger:[(NSNumber*)value integerValue]] : nil;
+                continue;
+            case 223:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonString")) break;
+                value = [reader readValue];
+                captureUser.jsonString = value != [NSNull null] ? value : nil;
+                continue;
+            case 226:
+                if (!JRJsonKeyEquals(key, keyLength, "jsonDictionary")) break;
+                value = [reader readValue];
+                captureUser.jsonDictionary = value != [NSNull null] ? value : nil;
+                continue;
+            case 233:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoinoL1Object")) break;
+                captureUser.oinoinoL1Object = [JROinoinoL1Object oinoinoL1ObjectObjectFromArchive:reader];
+                continue;
+            case 243:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinapL1Plural")) break;
+                captureUser.onipinapL1Plural = [NSArray arrayOfOnipinapL1PluralElementsFromArchive:reader];
+                continue;
+            case 244:
+                if (!JRJsonKeyEquals(key, keyLength, "basicPlural")) break;
+                captureUser.basicPlural = [NSArray arrayOfBasicPluralElementsFromArchive:reader];
+                continue;
+            case 254:
+                if (!JRJsonKeyEquals(key, keyLength, "pinonipL1Plural")) break;
+                captureUser.pinonipL1Plural = [NSArray arrayOfPinonipL1PluralElementsFromArchive:reader];
+                continue;
+            case 263:
+                if (!JRJsonKeyEquals(key, keyLength, "simpleStringPluralOne")) break;
+                value = [reader readValue];
+                captureUser.simpleStringPluralOne = value != [NSNull null] ? [(NSArray*)value arrayOfStringsFromStringPluralDictionariesWithType:@"simpleTypeOne"] : nil;
+                continue;
+            case 275:
+                if (!JRJsonKeyEquals(key, keyLength, "basicString")) break;
+                value = [reader readValue];
+                captureUser.basicString = value != [NSNull null] ? value : nil;
+                continue;
+            case 280:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoL1Object")) break;
+                captureUser.pinoL1Object = [JRPinoL1Object pinoL1ObjectObjectFromArchive:reader];
+                continue;
+            case 285:
+                if (!JRJsonKeyEquals(key, keyLength, "pluralTestUnique")) break;
+                captureUser.pluralTestUnique = [NSArray arrayOfPluralTestUniqueElementsFromArchive:reader];
+                continue;
+            case 292:
+                if (!JRJsonKeyEquals(key, keyLength, "basicInteger")) break;
+                value = [reader readValue];
+                captureUser.basicInteger = value != [NSNull null] ? [NSNumber numberWithInteger:[(NSNumber*)value integerValue]] : nil;
+                continue;
+            case 305:
+                if (!JRJsonKeyEquals(key, keyLength, "basicObject")) break;
+                captureUser.basicObject = [JRBasicObject basicObjectObjectFromArchive:reader];
+                continue;
+            case 311:
+                if (!JRJsonKeyEquals(key, keyLength, "basicPassword")) break;
+                value = [reader readValue];
+                captureUser.basicPassword = value != [NSNull null] ? value : nil;
+                continue;
+            case 315:
+                if (!JRJsonKeyEquals(key, keyLength, "lastUpdated")) break;
+                value = [reader readValue];
+                captureUser.lastUpdated = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 333:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestLength")) break;
+                value = [reader readValue];
+                captureUser.stringTestLength = value != [NSNull null] ? value : nil;
+                continue;
+            case 338:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestFeatures")) break;
+                value = [reader readValue];
+                captureUser.stringTestFeatures = value != [NSNull null] ? value : nil;
+                continue;
+            case 390:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestEmpty")) break;
+                value = [reader readValue];
+                captureUser.stringTestEmpty = value != [NSNull null] ? value : nil;
+                continue;
+            case 392:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestInvalid")) break;
+                value = [reader readValue];
+                captureUser.stringTestInvalid = value != [NSNull null] ? value : nil;
+                continue;
+            case 401:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestUnicodeLetters")) break;
+                value = [reader readValue];
+                captureUser.stringTestUnicodeLetters = value != [NSNull null] ? value : nil;
+                continue;
+            case 407:
+                if (!JRJsonKeyEquals(key, keyLength, "basicDateTime")) break;
+                value = [reader readValue];
+                captureUser.basicDateTime = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 416:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoinoL1Object")) break;
+                captureUser.pinoinoL1Object = [JRPinoinoL1Object pinoinoL1ObjectObjectFromArchive:reader];
+                continue;
+            case 421:
+                if (!JRJsonKeyEquals(key, keyLength, "objectTestRequiredUnique")) break;
+                captureUser.objectTestRequiredUnique = [JRObjectTestRequiredUnique objectTestRequiredUniqueObjectFromArchive:reader];
+                continue;
+            case 433:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinapL1Plural")) break;
+                captureUser.pinapinapL1Plural = [NSArray arrayOfPinapinapL1PluralElementsFromArchive:reader];
+                continue;
+            case 444:
+                if (!JRJsonKeyEquals(key, keyLength, "stringTestNull")) break;
+                value = [reader readValue];
+                captureUser.stringTestNull = value != [NSNull null] ? value : nil;
+                continue;
+            case 463:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoL1Object")) break;
+                captureUser.oinoL1Object = [JROinoL1Object oinoL1ObjectObjectFromArchive:reader];
+                continue;
+            case 468:
+                if (!JRJsonKeyEquals(key, keyLength, "created")) break;
+                value = [reader readValue];
+                captureUser.created = value != [NSNull null] ? [JRDateTime dateFromISO8601DateTimeString:value] : nil;
+                continue;
+            case 473:
+                if (!JRJsonKeyEquals(key, keyLength, "basicIpAddress")) break;
+                value = [reader readValue];
+                captureUser.basicIpAddress = value != [NSNull null] ? value : nil;
+                continue;
+            case 475:
+                if (!JRJsonKeyEquals(key, keyLength, "oinonipL1Plural")) break;
+                captureUser.oinonipL1Plural = [NSArray arrayOfOinonipL1PluralElementsFromArchive:reader];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [captureUser.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return captureUser;
+}
+
 - (void)decodeFromDictionary:(NSDictionary*)dictionary
 {
     NSSet *dirtyPropertySetCopy = [NSSet setWithArray:[dictionary objectForKey:@"dirtyPropertiesSet"]];
@@ -1866,7 +3580,8 @@
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRCaptureUserPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -2093,7 +3808,7 @@
         [dictionary objectForKey:@"id"] != [NSNull null] ? 
         [NSNumber numberWithInteger:[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -2101,18 +3816,12 @@
     return [NSSet setWithObjects:@"uuid", @"created", @"lastUpdated", @"email", @"basicBoolean", @"basicString", @"basicInteger", @"basicDecimal", @"basicDate", @"basicDateTime", @"basicIpAddress", @"basicPassword", @"jsonNumber", @"jsonString", @"jsonArray", @"jsonDictionary", @"stringTestJson", @"stringTestEmpty", @"stringTestNull", @"stringTestInvalid", @"stringTestNSNull", @"stringTestAlphanumeric", @"stringTestUnicodeLetters", @"stringTestUnicodePrintable", @"stringTestEmailAddress", @"stringTestLength", @"stringTestCaseSensitive", @"stringTestFeatures", @"basicObject", @"objectTestRequired", @"objectTestRequiredUnique", @"pinoL1Object", @"oinoL1Object", @"pinapinoL1Object", @"pinoinoL1Object", @"onipinoL1Object", @"oinoinoL1Object", @"captureUserId", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"captureUser"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"captureUser"];
 
     if (self.basicObject)
         [snapshotDictionary setObject:[self.basicObject snapshotDictionaryFromDirtyPropertySet]
@@ -2156,7 +3865,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"captureUser"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"captureUser"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"captureUser"]];
 
     if ([snapshotDictionary objectForKey:@"basicObject"])
         [self.basicObject restoreDirtyPropertiesFromSnapshotDictionary:
@@ -2201,82 +3910,82 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"email"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty))
         [dictionary setObject:(self.email ? self.email : [NSNull null]) forKey:@"email"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicBoolean"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicBooleanProperty))
         [dictionary setObject:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : [NSNull null]) forKey:@"basicBoolean"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicStringProperty))
         [dictionary setObject:(self.basicString ? self.basicString : [NSNull null]) forKey:@"basicString"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicInteger"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIntegerProperty))
         [dictionary setObject:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : [NSNull null]) forKey:@"basicInteger"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicDecimal"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDecimalProperty))
         [dictionary setObject:(self.basicDecimal ? self.basicDecimal : [NSNull null]) forKey:@"basicDecimal"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicDate"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDateProperty))
         [dictionary setObject:(self.basicDate ? [self.basicDate stringFromISO8601Date] : [NSNull null]) forKey:@"basicDate"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicDateTime"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDateTimeProperty))
         [dictionary setObject:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : [NSNull null]) forKey:@"basicDateTime"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicIpAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIpAddressProperty))
         [dictionary setObject:(self.basicIpAddress ? self.basicIpAddress : [NSNull null]) forKey:@"basicIpAddress"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicPassword"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicPasswordProperty))
         [dictionary setObject:(self.basicPassword ? self.basicPassword : [NSNull null]) forKey:@"basicPassword"];
 
-    if ([self.dirtyPropertySet containsObject:@"jsonNumber"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonNumberProperty))
         [dictionary setObject:(self.jsonNumber ? self.jsonNumber : [NSNull null]) forKey:@"jsonNumber"];
 
-    if ([self.dirtyPropertySet containsObject:@"jsonString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonStringProperty))
         [dictionary setObject:(self.jsonString ? self.jsonString : [NSNull null]) forKey:@"jsonString"];
 
-    if ([self.dirtyPropertySet containsObject:@"jsonArray"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonArrayProperty))
         [dictionary setObject:(self.jsonArray ? self.jsonArray : [NSNull null]) forKey:@"jsonArray"];
 
-    if ([self.dirtyPropertySet containsObject:@"jsonDictionary"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonDictionaryProperty))
         [dictionary setObject:(self.jsonDictionary ? self.jsonDictionary : [NSNull null]) forKey:@"jsonDictionary"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestJson"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestJsonProperty))
         [dictionary setObject:(self.stringTestJson ? self.stringTestJson : [NSNull null]) forKey:@"stringTestJson"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestEmpty"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmptyProperty))
         [dictionary setObject:(self.stringTestEmpty ? self.stringTestEmpty : [NSNull null]) forKey:@"stringTestEmpty"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestNull"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestNullProperty))
         [dictionary setObject:(self.stringTestNull ? self.stringTestNull : [NSNull null]) forKey:@"stringTestNull"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestInvalid"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestInvalidProperty))
         [dictionary setObject:(self.stringTestInvalid ? self.stringTestInvalid : [NSNull null]) forKey:@"stringTestInvalid"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestNSNull"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestNSNullProperty))
         [dictionary setObject:(self.stringTestNSNull ? self.stringTestNSNull : [NSNull null]) forKey:@"stringTestNSNull"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestAlphanumeric"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestAlphanumericProperty))
         [dictionary setObject:(self.stringTestAlphanumeric ? self.stringTestAlphanumeric : [NSNull null]) forKey:@"stringTestAlphanumeric"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestUnicodeLetters"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodeLettersProperty))
         [dictionary setObject:(self.stringTestUnicodeLetters ? self.stringTestUnicodeLetters : [NSNull null]) forKey:@"stringTestUnicodeLetters"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestUnicodePrintable"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodePrintableProperty))
         [dictionary setObject:(self.stringTestUnicodePrintable ? self.stringTestUnicodePrintable : [NSNull null]) forKey:@"stringTestUnicodePrintable"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestEmailAddress"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmailAddressProperty))
         [dictionary setObject:(self.stringTestEmailAddress ? self.stringTestEmailAddress : [NSNull null]) forKey:@"stringTestEmailAddress"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestLength"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestLengthProperty))
         [dictionary setObject:(self.stringTestLength ? self.stringTestLength : [NSNull null]) forKey:@"stringTestLength"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestCaseSensitive"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestCaseSensitiveProperty))
         [dictionary setObject:(self.stringTestCaseSensitive ? self.stringTestCaseSensitive : [NSNull null]) forKey:@"stringTestCaseSensitive"];
 
-    if ([self.dirtyPropertySet containsObject:@"stringTestFeatures"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestFeaturesProperty))
         [dictionary setObject:(self.stringTestFeatures ? self.stringTestFeatures : [NSNull null]) forKey:@"stringTestFeatures"];
 
-    if ([self.dirtyPropertySet containsObject:@"basicObject"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicObjectProperty))
         [dictionary setObject:(self.basicObject ?
                               [self.basicObject toUpdateDictionary] :
                               [[JRBasicObject basicObject] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2285,7 +3994,7 @@
         [dictionary setObject:[self.basicObject toUpdateDictionary]
                        forKey:@"basicObject"];
 
-    if ([self.dirtyPropertySet containsObject:@"objectTestRequired"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserObjectTestRequiredProperty))
         [dictionary setObject:(self.objectTestRequired ?
                               [self.objectTestRequired toUpdateDictionary] :
                               [[JRObjectTestRequired objectTestRequired] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2294,7 +4003,7 @@
         [dictionary setObject:[self.objectTestRequired toUpdateDictionary]
                        forKey:@"objectTestRequired"];
 
-    if ([self.dirtyPropertySet containsObject:@"objectTestRequiredUnique"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserObjectTestRequiredUniqueProperty))
         [dictionary setObject:(self.objectTestRequiredUnique ?
                               [self.objectTestRequiredUnique toUpdateDictionary] :
                               [[JRObjectTestRequiredUnique objectTestRequiredUnique] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2303,7 +4012,7 @@
         [dictionary setObject:[self.objectTestRequiredUnique toUpdateDictionary]
                        forKey:@"objectTestRequiredUnique"];
 
-    if ([self.dirtyPropertySet containsObject:@"pinoL1Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinoL1ObjectProperty))
         [dictionary setObject:(self.pinoL1Object ?
                               [self.pinoL1Object toUpdateDictionary] :
                               [[JRPinoL1Object pinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2312,7 +4021,7 @@
         [dictionary setObject:[self.pinoL1Object toUpdateDictionary]
                        forKey:@"pinoL1Object"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinoL1Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOinoL1ObjectProperty))
         [dictionary setObject:(self.oinoL1Object ?
                               [self.oinoL1Object toUpdateDictionary] :
                               [[JROinoL1Object oinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2321,7 +4030,7 @@
         [dictionary setObject:[self.oinoL1Object toUpdateDictionary]
                        forKey:@"oinoL1Object"];
 
-    if ([self.dirtyPropertySet containsObject:@"pinapinoL1Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinapinoL1ObjectProperty))
         [dictionary setObject:(self.pinapinoL1Object ?
                               [self.pinapinoL1Object toUpdateDictionary] :
                               [[JRPinapinoL1Object pinapinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2330,7 +4039,7 @@
         [dictionary setObject:[self.pinapinoL1Object toUpdateDictionary]
                        forKey:@"pinapinoL1Object"];
 
-    if ([self.dirtyPropertySet containsObject:@"pinoinoL1Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinoinoL1ObjectProperty))
         [dictionary setObject:(self.pinoinoL1Object ?
                               [self.pinoinoL1Object toUpdateDictionary] :
                               [[JRPinoinoL1Object pinoinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2339,7 +4048,7 @@
         [dictionary setObject:[self.pinoinoL1Object toUpdateDictionary]
                        forKey:@"pinoinoL1Object"];
 
-    if ([self.dirtyPropertySet containsObject:@"onipinoL1Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOnipinoL1ObjectProperty))
         [dictionary setObject:(self.onipinoL1Object ?
                               [self.onipinoL1Object toUpdateDictionary] :
                               [[JROnipinoL1Object onipinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2348,7 +4057,7 @@
         [dictionary setObject:[self.onipinoL1Object toUpdateDictionary]
                        forKey:@"onipinoL1Object"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinoinoL1Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOinoinoL1ObjectProperty))
         [dictionary setObject:(self.oinoinoL1Object ?
                               [self.oinoinoL1Object toUpdateDictionary] :
                               [[JROinoinoL1Object oinoinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -2501,17 +4210,444 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
-- (void)replaceBasicPluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
-{
-    [self replaceArrayOnCapture:self.basicPlural named:@"basicPlural" isArrayOfStrings:NO
-                       withType:@"" forDelegate:delegate withContext:context];
-}
-
-- (void)replacePluralTestUniqueArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
 {
-    [self replaceArrayOnCapture:self.pluralTestUnique named:@"pluralTestUnique" isArrayOfStrings:NO
-                       withType:@"" forDelegate:delegate withContext:context];
-}
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty))
+    {
+        [writer writeKey:@"email"];
+        [writer writeValue:self.email];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicBooleanProperty))
+    {
+        [writer writeKey:@"basicBoolean"];
+        [writer writeValue:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicStringProperty))
+    {
+        [writer writeKey:@"basicString"];
+        [writer writeValue:self.basicString];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIntegerProperty))
+    {
+        [writer writeKey:@"basicInteger"];
+        [writer writeValue:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDecimalProperty))
+    {
+        [writer writeKey:@"basicDecimal"];
+        [writer writeValue:self.basicDecimal];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDateProperty))
+    {
+        [writer writeKey:@"basicDate"];
+        [writer writeValue:(self.basicDate ? [self.basicDate stringFromISO8601Date] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicDateTimeProperty))
+    {
+        [writer writeKey:@"basicDateTime"];
+        [writer writeValue:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : nil)];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicIpAddressProperty))
+    {
+        [writer writeKey:@"basicIpAddress"];
+        [writer writeValue:self.basicIpAddress];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicPasswordProperty))
+    {
+        [writer writeKey:@"basicPassword"];
+        [writer writeValue:self.basicPassword];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonNumberProperty))
+    {
+        [writer writeKey:@"jsonNumber"];
+        [writer writeValue:self.jsonNumber];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonStringProperty))
+    {
+        [writer writeKey:@"jsonString"];
+        [writer writeValue:self.jsonString];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonArrayProperty))
+    {
+        [writer writeKey:@"jsonArray"];
+        [writer writeValue:self.jsonArray];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserJsonDictionaryProperty))
+    {
+        [writer writeKey:@"jsonDictionary"];
+        [writer writeValue:self.jsonDictionary];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestJsonProperty))
+    {
+        [writer writeKey:@"stringTestJson"];
+        [writer writeValue:self.stringTestJson];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmptyProperty))
+    {
+        [writer writeKey:@"stringTestEmpty"];
+        [writer writeValue:self.stringTestEmpty];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestNullProperty))
+    {
+        [writer writeKey:@"stringTestNull"];
+        [writer writeValue:self.stringTestNull];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestInvalidProperty))
+    {
+        [writer writeKey:@"stringTestInvalid"];
+        [writer writeValue:self.stringTestInvalid];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestNSNullProperty))
+    {
+        [writer writeKey:@"stringTestNSNull"];
+        [writer writeValue:self.stringTestNSNull];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestAlphanumericProperty))
+    {
+        [writer writeKey:@"stringTestAlphanumeric"];
+        [writer writeValue:self.stringTestAlphanumeric];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodeLettersProperty))
+    {
+        [writer writeKey:@"stringTestUnicodeLetters"];
+        [writer writeValue:self.stringTestUnicodeLetters];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodePrintableProperty))
+    {
+        [writer writeKey:@"stringTestUnicodePrintable"];
+        [writer writeValue:self.stringTestUnicodePrintable];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmailAddressProperty))
+    {
+        [writer writeKey:@"stringTestEmailAddress"];
+        [writer writeValue:self.stringTestEmailAddress];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestLengthProperty))
+    {
+        [writer writeKey:@"stringTestLength"];
+        [writer writeValue:self.stringTestLength];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestCaseSensitiveProperty))
+    {
+        [writer writeKey:@"stringTestCaseSensitive"];
+        [writer writeValue:self.stringTestCaseSensitive];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestFeaturesProperty))
+    {
+        [writer writeKey:@"stringTestFeatures"];
+        [writer writeValue:self.stringTestFeatures];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserBasicObjectProperty))
+    {
+        [writer writeKey:@"basicObject"];
+        [(self.basicObject ? self.basicObject : [JRBasicObject basicObject]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.basicObject needsUpdate])
+    {
+        [writer writeKey:@"basicObject"];
+        [self.basicObject writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserObjectTestRequiredProperty))
+    {
+        [writer writeKey:@"objectTestRequired"];
+        [(self.objectTestRequired ? self.objectTestRequired : [JRObjectTestRequired objectTestRequired]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.objectTestRequired needsUpdate])
+    {
+        [writer writeKey:@"objectTestRequired"];
+        [self.objectTestRequired writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserObjectTestRequiredUniqueProperty))
+    {
+        [writer writeKey:@"objectTestRequiredUnique"];
+        [(self.objectTestRequiredUnique ? self.objectTestRequiredUnique : [JRObjectTestRequiredUnique objectTestRequiredUnique]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.objectTestRequiredUnique needsUpdate])
+    {
+        [writer writeKey:@"objectTestRequiredUnique"];
+        [self.objectTestRequiredUnique writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinoL1ObjectProperty))
+    {
+        [writer writeKey:@"pinoL1Object"];
+        [(self.pinoL1Object ? self.pinoL1Object : [JRPinoL1Object pinoL1Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.pinoL1Object needsUpdate])
+    {
+        [writer writeKey:@"pinoL1Object"];
+        [self.pinoL1Object writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOinoL1ObjectProperty))
+    {
+        [writer writeKey:@"oinoL1Object"];
+        [(self.oinoL1Object ? self.oinoL1Object : [JROinoL1Object oinoL1Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinoL1Object needsUpdate])
+    {
+        [writer writeKey:@"oinoL1Object"];
+        [self.oinoL1Object writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinapinoL1ObjectProperty))
+    {
+        [writer writeKey:@"pinapinoL1Object"];
+        [(self.pinapinoL1Object ? self.pinapinoL1Object : [JRPinapinoL1Object pinapinoL1Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.pinapinoL1Object needsUpdate])
+    {
+        [writer writeKey:@"pinapinoL1Object"];
+        [self.pinapinoL1Object writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserPinoinoL1ObjectProperty))
+    {
+        [writer writeKey:@"pinoinoL1Object"];
+        [(self.pinoinoL1Object ? self.pinoinoL1Object : [JRPinoinoL1Object pinoinoL1Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.pinoinoL1Object needsUpdate])
+    {
+        [writer writeKey:@"pinoinoL1Object"];
+        [self.pinoinoL1Object writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOnipinoL1ObjectProperty))
+    {
+        [writer writeKey:@"onipinoL1Object"];
+        [(self.onipinoL1Object ? self.onipinoL1Object : [JROnipinoL1Object onipinoL1Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.onipinoL1Object needsUpdate])
+    {
+        [writer writeKey:@"onipinoL1Object"];
+        [self.onipinoL1Object writeUpdateJsonToWriter:writer];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserOinoinoL1ObjectProperty))
+    {
+        [writer writeKey:@"oinoinoL1Object"];
+        [(self.oinoinoL1Object ? self.oinoinoL1Object : [JROinoinoL1Object oinoinoL1Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinoinoL1Object needsUpdate])
+    {
+        [writer writeKey:@"oinoinoL1Object"];
+        [self.oinoinoL1Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"email"];
+    [writer writeValue:self.email];
+
+    [writer writeKey:@"basicBoolean"];
+    [writer writeValue:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : nil)];
+
+    [writer writeKey:@"basicString"];
+    [writer writeValue:self.basicString];
+
+    [writer writeKey:@"basicInteger"];
+    [writer writeValue:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : nil)];
+
+    [writer writeKey:@"basicDecimal"];
+    [writer writeValue:self.basicDecimal];
+
+    [writer writeKey:@"basicDate"];
+    [writer writeValue:(self.basicDate ? [self.basicDate stringFromISO8601Date] : nil)];
+
+    [writer writeKey:@"basicDateTime"];
+    [writer writeValue:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : nil)];
+
+    [writer writeKey:@"basicIpAddress"];
+    [writer writeValue:self.basicIpAddress];
+
+    [writer writeKey:@"basicPassword"];
+    [writer writeValue:self.basicPassword];
+
+    [writer writeKey:@"jsonNumber"];
+    [writer writeValue:self.jsonNumber];
+
+    [writer writeKey:@"jsonString"];
+    [writer writeValue:self.jsonString];
+
+    [writer writeKey:@"jsonArray"];
+    [writer writeValue:self.jsonArray];
+
+    [writer writeKey:@"jsonDictionary"];
+    [writer writeValue:self.jsonDictionary];
+
+    [writer writeKey:@"stringTestJson"];
+    [writer writeValue:self.stringTestJson];
+
+    [writer writeKey:@"stringTestEmpty"];
+    [writer writeValue:self.stringTestEmpty];
+
+    [writer writeKey:@"stringTestNull"];
+    [writer writeValue:self.stringTestNull];
+
+    [writer writeKey:@"stringTestInvalid"];
+    [writer writeValue:self.stringTestInvalid];
+
+    [writer writeKey:@"stringTestNSNull"];
+    [writer writeValue:self.stringTestNSNull];
+
+    [writer writeKey:@"stringTestAlphanumeric"];
+    [writer writeValue:self.stringTestAlphanumeric];
+
+    [writer writeKey:@"stringTestUnicodeLetters"];
+    [writer writeValue:self.stringTestUnicodeLetters];
+
+    [writer writeKey:@"stringTestUnicodePrintable"];
+    [writer writeValue:self.stringTestUnicodePrintable];
+
+    [writer writeKey:@"stringTestEmailAddress"];
+    [writer writeValue:self.stringTestEmailAddress];
+
+    [writer writeKey:@"stringTestLength"];
+    [writer writeValue:self.stringTestLength];
+
+    [writer writeKey:@"stringTestCaseSensitive"];
+    [writer writeValue:self.stringTestCaseSensitive];
+
+    [writer writeKey:@"stringTestFeatures"];
+    [writer writeValue:self.stringTestFeatures];
+
+    [writer writeKey:@"basicPlural"];
+    [(self.basicPlural ? self.basicPlural : [NSArray array]) writeReplaceJsonOfBasicPluralElementsToWriter:writer];
+
+    [writer writeKey:@"basicObject"];
+    if (self.basicObject)
+        [self.basicObject writeReplaceJsonToWriter:writer];
+    else
+        [[JRBasicObject basicObject] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"objectTestRequired"];
+    if (self.objectTestRequired)
+        [self.objectTestRequired writeReplaceJsonToWriter:writer];
+    else
+        [[JRObjectTestRequired objectTestRequired] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"pluralTestUnique"];
+    [(self.pluralTestUnique ? self.pluralTestUnique : [NSArray array]) writeReplaceJsonOfPluralTestUniqueElementsToWriter:writer];
+
+    [writer writeKey:@"objectTestRequiredUnique"];
+    if (self.objectTestRequiredUnique)
+        [self.objectTestRequiredUnique writeReplaceJsonToWriter:writer];
+    else
+        [[JRObjectTestRequiredUnique objectTestRequiredUnique] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"pluralTestAlphabetic"];
+    [(self.pluralTestAlphabetic ? self.pluralTestAlphabetic : [NSArray array]) writeReplaceJsonOfPluralTestAlphabeticElementsToWriter:writer];
+
+    [writer writeKey:@"simpleStringPluralOne"];
+    [writer writeValue:(self.simpleStringPluralOne ? self.simpleStringPluralOne : [NSArray array])];
+
+    [writer writeKey:@"simpleStringPluralTwo"];
+    [writer writeValue:(self.simpleStringPluralTwo ? self.simpleStringPluralTwo : [NSArray array])];
+
+    [writer writeKey:@"pinapL1Plural"];
+    [(self.pinapL1Plural ? self.pinapL1Plural : [NSArray array]) writeReplaceJsonOfPinapL1PluralElementsToWriter:writer];
+
+    [writer writeKey:@"pinoL1Object"];
+    if (self.pinoL1Object)
+        [self.pinoL1Object writeReplaceJsonToWriter:writer];
+    else
+        [[JRPinoL1Object pinoL1Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"onipL1Plural"];
+    [(self.onipL1Plural ? self.onipL1Plural : [NSArray array]) writeReplaceJsonOfOnipL1PluralElementsToWriter:writer];
+
+    [writer writeKey:@"oinoL1Object"];
+    if (self.oinoL1Object)
+        [self.oinoL1Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinoL1Object oinoL1Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"pinapinapL1Plural"];
+    [(self.pinapinapL1Plural ? self.pinapinapL1Plural : [NSArray array]) writeReplaceJsonOfPinapinapL1PluralElementsToWriter:writer];
+
+    [writer writeKey:@"pinonipL1Plural"];
+    [(self.pinonipL1Plural ? self.pinonipL1Plural : [NSArray array]) writeReplaceJsonOfPinonipL1PluralElementsToWriter:writer];
+
+    [writer writeKey:@"pinapinoL1Object"];
+    if (self.pinapinoL1Object)
+        [self.pinapinoL1Object writeReplaceJsonToWriter:writer];
+    else
+        [[JRPinapinoL1Object pinapinoL1Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"pinoinoL1Object"];
+    if (self.pinoinoL1Object)
+        [self.pinoinoL1Object writeReplaceJsonToWriter:writer];
+    else
+        [[JRPinoinoL1Object pinoinoL1Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"onipinapL1Plural"];
+    [(self.onipinapL1Plural ? self.onipinapL1Plural : [NSArray array]) writeReplaceJsonOfOnipinapL1PluralElementsToWriter:writer];
+
+    [writer writeKey:@"oinonipL1Plural"];
+    [(self.oinonipL1Plural ? self.oinonipL1Plural : [NSArray array]) writeReplaceJsonOfOinonipL1PluralElementsToWriter:writer];
+
+    [writer writeKey:@"onipinoL1Object"];
+    if (self.onipinoL1Object)
+        [self.onipinoL1Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROnipinoL1Object onipinoL1Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer writeKey:@"oinoinoL1Object"];
+    if (self.oinoinoL1Object)
+        [self.oinoinoL1Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinoinoL1Object oinoinoL1Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)replaceBasicPluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.basicPlural named:@"basicPlural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replacePluralTestUniqueArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.pluralTestUnique named:@"pluralTestUnique" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
 
 - (void)replacePluralTestAlphabeticArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
@@ -2602,6 +4738,93 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserEmailProperty))
+        JRValidateCaptureAttribute(self.email, @"email", self.captureObjectPath, 0, 256, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestAlphanumericProperty))
+        JRValidateCaptureAttribute(self.stringTestAlphanumeric, @"stringTestAlphanumeric", self.captureObjectPath, JRCaptureAttributeAlphanumeric, 0, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodeLettersProperty))
+        JRValidateCaptureAttribute(self.stringTestUnicodeLetters, @"stringTestUnicodeLetters", self.captureObjectPath, JRCaptureAttributeUnicodeLetters, 0, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestUnicodePrintableProperty))
+        JRValidateCaptureAttribute(self.stringTestUnicodePrintable, @"stringTestUnicodePrintable", self.captureObjectPath, JRCaptureAttributeUnicodePrintable, 0, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestEmailAddressProperty))
+        JRValidateCaptureAttribute(self.stringTestEmailAddress, @"stringTestEmailAddress", self.captureObjectPath, JRCaptureAttributeEmailAddress, 0, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestLengthProperty))
+        JRValidateCaptureAttribute(self.stringTestLength, @"stringTestLength", self.captureObjectPath, 0, 100, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRCaptureUserStringTestFeaturesProperty))
+        JRValidateCaptureAttribute(self.stringTestFeatures, @"stringTestFeatures", self.captureObjectPath, 0, 1000, violations);
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.basicPlural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_basicObjectJson)
+        [self.basicObject validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || !_objectTestRequiredJson)
+        [self.objectTestRequired validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pluralTestUnique)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_objectTestRequiredUniqueJson)
+        [self.objectTestRequiredUnique validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pluralTestAlphabetic)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapL1Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_pinoL1ObjectJson)
+        [self.pinoL1Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.onipL1Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_oinoL1ObjectJson)
+        [self.oinoL1Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapinapL1Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinonipL1Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_pinapinoL1ObjectJson)
+        [self.pinapinoL1Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || !_pinoinoL1ObjectJson)
+        [self.pinoinoL1Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.onipinapL1Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.oinonipL1Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+
+    if (!dirtyPropertiesOnly || !_onipinoL1ObjectJson)
+        [self.onipinoL1Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+
+    if (!dirtyPropertiesOnly || !_oinoinoL1ObjectJson)
+        [self.oinoinoL1Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser
 {
     if (!self.email && !otherCaptureUser.email) /* Keep going... */;
@@ -2865,4 +5088,118 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_basicObjectJson)
+        _basicObjectJsonCleared = YES;
+    else
+        [self.basicObject deepClearDirtyProperties];
+
+    if (_objectTestRequiredJson)
+        _objectTestRequiredJsonCleared = YES;
+    else
+        [self.objectTestRequired deepClearDirtyProperties];
+
+    if (_objectTestRequiredUniqueJson)
+        _objectTestRequiredUniqueJsonCleared = YES;
+    else
+        [self.objectTestRequiredUnique deepClearDirtyProperties];
+
+    if (_pinoL1ObjectJson)
+        _pinoL1ObjectJsonCleared = YES;
+    else
+        [self.pinoL1Object deepClearDirtyProperties];
+
+    if (_oinoL1ObjectJson)
+        _oinoL1ObjectJsonCleared = YES;
+    else
+        [self.oinoL1Object deepClearDirtyProperties];
+
+    if (_pinapinoL1ObjectJson)
+        _pinapinoL1ObjectJsonCleared = YES;
+    else
+        [self.pinapinoL1Object deepClearDirtyProperties];
+
+    if (_pinoinoL1ObjectJson)
+        _pinoinoL1ObjectJsonCleared = YES;
+    else
+        [self.pinoinoL1Object deepClearDirtyProperties];
+
+    if (_onipinoL1ObjectJson)
+        _onipinoL1ObjectJsonCleared = YES;
+    else
+        [self.onipinoL1Object deepClearDirtyProperties];
+
+    if (_oinoinoL1ObjectJson)
+        _oinoinoL1ObjectJsonCleared = YES;
+    else
+        [self.oinoinoL1Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRCaptureUser class]]) return NO;
+
+    JRCaptureUser *otherCaptureUser = (JRCaptureUser *)otherObj;
+
+    if (self.basicPlural && ![self.basicPlural isEqualByPrivatePropertiesToBasicPluralArray:otherCaptureUser.basicPlural])
+        return NO;
+
+    if (self.basicObject && ![self.basicObject isEqualByPrivateProperties:otherCaptureUser.basicObject])
+        return NO;
+
+    if (self.objectTestRequired && ![self.objectTestRequired isEqualByPrivateProperties:otherCaptureUser.objectTestRequired])
+        return NO;
+
+    if (self.pluralTestUnique && ![self.pluralTestUnique isEqualByPrivatePropertiesToPluralTestUniqueArray:otherCaptureUser.pluralTestUnique])
+        return NO;
+
+    if (self.objectTestRequiredUnique && ![self.objectTestRequiredUnique isEqualByPrivateProperties:otherCaptureUser.objectTestRequiredUnique])
+        return NO;
+
+    if (self.pluralTestAlphabetic && ![self.pluralTestAlphabetic isEqualByPrivatePropertiesToPluralTestAlphabeticArray:otherCaptureUser.pluralTestAlphabetic])
+        return NO;
+
+    if (self.pinapL1Plural && ![self.pinapL1Plural isEqualByPrivatePropertiesToPinapL1PluralArray:otherCaptureUser.pinapL1Plural])
+        return NO;
+
+    if (self.pinoL1Object && ![self.pinoL1Object isEqualByPrivateProperties:otherCaptureUser.pinoL1Object])
+        return NO;
+
+    if (self.onipL1Plural && ![self.onipL1Plural isEqualByPrivatePropertiesToOnipL1PluralArray:otherCaptureUser.onipL1Plural])
+        return NO;
+
+    if (self.oinoL1Object && ![self.oinoL1Object isEqualByPrivateProperties:otherCaptureUser.oinoL1Object])
+        return NO;
+
+    if (self.pinapinapL1Plural && ![self.pinapinapL1Plural isEqualByPrivatePropertiesToPinapinapL1PluralArray:otherCaptureUser.pinapinapL1Plural])
+        return NO;
+
+    if (self.pinonipL1Plural && ![self.pinonipL1Plural isEqualByPrivatePropertiesToPinonipL1PluralArray:otherCaptureUser.pinonipL1Plural])
+        return NO;
+
+    if (self.pinapinoL1Object && ![self.pinapinoL1Object isEqualByPrivateProperties:otherCaptureUser.pinapinoL1Object])
+        return NO;
+
+    if (self.pinoinoL1Object && ![self.pinoinoL1Object isEqualByPrivateProperties:otherCaptureUser.pinoinoL1Object])
+        return NO;
+
+    if (self.onipinapL1Plural && ![self.onipinapL1Plural isEqualByPrivatePropertiesToOnipinapL1PluralArray:otherCaptureUser.onipinapL1Plural])
+        return NO;
+
+    if (self.oinonipL1Plural && ![self.oinonipL1Plural isEqualByPrivatePropertiesToOinonipL1PluralArray:otherCaptureUser.oinonipL1Plural])
+        return NO;
+
+    if (self.onipinoL1Object && ![self.onipinoL1Object isEqualByPrivateProperties:otherCaptureUser.onipinoL1Object])
+        return NO;
+
+    if (self.oinoinoL1Object && ![self.oinoinoL1Object isEqualByPrivateProperties:otherCaptureUser.oinoinoL1Object])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,6 +40,21 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRObjectTestRequired.h"
 
+enum
+{
+    JRObjectTestRequiredRequiredStringProperty,
+    JRObjectTestRequiredString1Property,
+    JRObjectTestRequiredString2Property,
+    JRObjectTestRequiredPropertyCount
+};
+
+static const char *const JRObjectTestRequiredPropertyNames[] =
+{
+    "requiredString",
+    "string1",
+    "string2",
+};
+
 @interface JRObjectTestRequired ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -52,6 +67,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRObjectTestRequiredPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRObjectTestRequiredPropertyCount;
+}
+
 - (NSString *)requiredString
 {
     return _requiredString;
@@ -59,7 +84,7 @@
 
 - (void)setRequiredString:(NSString *)newRequiredString
 {
-    [self.dirtyPropertySet addObject:@"requiredString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredRequiredStringProperty);
 
     _requiredString = [newRequiredString copy];
 }
@@ -71,7 +96,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -83,7 +108,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredString2Property);
 
     _string2 = [newString2 copy];
 }
@@ -96,7 +121,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -115,7 +140,7 @@
 
         _requiredString = [newRequiredString copy];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -195,11 +220,109 @@
     return [JRObjectTestRequired objectTestRequiredObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)objectTestRequiredObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRObjectTestRequired *objectTestRequired = [JRObjectTestRequired objectTestRequired];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "requiredString")) break;
+                value = [reader readValue];
+                objectTestRequired.requiredString = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                objectTestRequired.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                objectTestRequired.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [objectTestRequired.dirtyPropertySet removeAllObjects];
+
+    return objectTestRequired;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"requiredString"];
+    [writer writeValue:self.requiredString];
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer endObject];
+}
+
++ (id)objectTestRequiredObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRObjectTestRequired *objectTestRequired = [JRObjectTestRequired objectTestRequired];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    objectTestRequired.captureObjectPath = [reader readString];
+    objectTestRequired.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "requiredString")) break;
+                value = [reader readValue];
+                objectTestRequired.requiredString = value != [NSNull null] ? value : nil;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                objectTestRequired.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                objectTestRequired.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [objectTestRequired.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return objectTestRequired;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRObjectTestRequiredPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -215,7 +338,7 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -223,18 +346,12 @@
     return [NSSet setWithObjects:@"requiredString", @"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"objectTestRequired"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"objectTestRequired"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -242,7 +359,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"objectTestRequired"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"objectTestRequired"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"objectTestRequired"]];
 
 }
 
@@ -251,13 +368,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"requiredString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredRequiredStringProperty))
         [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null]) forKey:@"requiredString"];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,6 +399,49 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredRequiredStringProperty))
+    {
+        [writer writeKey:@"requiredString"];
+        [writer writeValue:self.requiredString];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"requiredString"];
+    [writer writeValue:self.requiredString];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -290,6 +450,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredRequiredStringProperty))
+        JRValidateCaptureAttribute(self.requiredString, @"requiredString", self.captureObjectPath, JRCaptureAttributeRequired, 0, violations);
+}
+
 - (BOOL)isEqualToObjectTestRequired:(JRObjectTestRequired *)otherObjectTestRequired
 {
     if (!self.requiredString && !otherObjectTestRequired.requiredString) /* Keep going... */;
@@ -319,4 +485,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRObjectTestRequired class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -40,6 +40,21 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRObjectTestRequiredUnique.h"
 
+enum
+{
+    JRObjectTestRequiredUniqueRequiredStringProperty,
+    JRObjectTestRequiredUniqueUniqueStringProperty,
+    JRObjectTestRequiredUniqueRequiredUniqueStringProperty,
+    JRObjectTestRequiredUniquePropertyCount
+};
+
+static const char *const JRObjectTestRequiredUniquePropertyNames[] =
+{
+    "requiredString",
+    "uniqueString",
+    "requiredUniqueString",
+};
+
 @interface JRObjectTestRequiredUnique ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -52,6 +67,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRObjectTestRequiredUniquePropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRObjectTestRequiredUniquePropertyCount;
+}
+
 - (NSString *)requiredString
 {
     return _requiredString;
@@ -59,7 +84,7 @@
 
 - (void)setRequiredString:(NSString *)newRequiredString
 {
-    [self.dirtyPropertySet addObject:@"requiredString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredStringProperty);
 
     _requiredString = [newRequiredString copy];
 }
@@ -71,7 +96,7 @@
 
 - (void)setUniqueString:(NSString *)newUniqueString
 {
-    [self.dirtyPropertySet addObject:@"uniqueString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueUniqueStringProperty);
 
     _uniqueString = [newUniqueString copy];
 }
@@ -83,7 +108,7 @@
 
 - (void)setRequiredUniqueString:(NSString *)newRequiredUniqueString
 {
-    [self.dirtyPropertySet addObject:@"requiredUniqueString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredUniqueStringProperty);
 
     _requiredUniqueString = [newRequiredUniqueString copy];
 }
@@ -96,7 +121,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -116,7 +141,7 @@
         _requiredString = [newRequiredString copy];
         _requiredUniqueString = [newRequiredUniqueString copy];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -196,11 +221,109 @@
     return [JRObjectTestRequiredUnique objectTestRequiredUniqueObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)objectTestRequiredUniqueObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRObjectTestRequiredUnique *objectTestRequiredUnique = [JRObjectTestRequiredUnique objectTestRequiredUnique];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "requiredString")) break;
+                value = [reader readValue];
+                objectTestRequiredUnique.requiredString = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "requiredUniqueString")) break;
+                value = [reader readValue];
+                objectTestRequiredUnique.requiredUniqueString = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "uniqueString")) break;
+                value = [reader readValue];
+                objectTestRequiredUnique.uniqueString = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [objectTestRequiredUnique.dirtyPropertySet removeAllObjects];
+
+    return objectTestRequiredUnique;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"requiredString"];
+    [writer writeValue:self.requiredString];
+    [writer writeKey:@"uniqueString"];
+    [writer writeValue:self.uniqueString];
+    [writer writeKey:@"requiredUniqueString"];
+    [writer writeValue:self.requiredUniqueString];
+    [writer endObject];
+}
+
++ (id)objectTestRequiredUniqueObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRObjectTestRequiredUnique *objectTestRequiredUnique = [JRObjectTestRequiredUnique objectTestRequiredUnique];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    objectTestRequiredUnique.captureObjectPath = [reader readString];
+    objectTestRequiredUnique.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "requiredString")) break;
+                value = [reader readValue];
+                objectTestRequiredUnique.requiredString = value != [NSNull null] ? value : nil;
+                continue;
+            case 2:
+                if (!JRJsonKeyEquals(key, keyLength, "requiredUniqueString")) break;
+                value = [reader readValue];
+                objectTestRequiredUnique.requiredUniqueString = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "uniqueString")) break;
+                value = [reader readValue];
+                objectTestRequiredUnique.uniqueString = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [objectTestRequiredUnique.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return objectTestRequiredUnique;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRObjectTestRequiredUniquePropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -216,7 +339,7 @@
         [dictionary objectForKey:@"requiredUniqueString"] != [NSNull null] ? 
         [dictionary objectForKey:@"requiredUniqueString"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -224,18 +347,12 @@
     return [NSSet setWithObjects:@"requiredString", @"uniqueString", @"requiredUniqueString", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"objectTestRequiredUnique"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"objectTestRequiredUnique"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -243,7 +360,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"objectTestRequiredUnique"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"objectTestRequiredUnique"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"objectTestRequiredUnique"]];
 
 }
 
@@ -252,13 +369,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"requiredString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredStringProperty))
         [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null]) forKey:@"requiredString"];
 
-    if ([self.dirtyPropertySet containsObject:@"uniqueString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueUniqueStringProperty))
         [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
 
-    if ([self.dirtyPropertySet containsObject:@"requiredUniqueString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredUniqueStringProperty))
         [dictionary setObject:(self.requiredUniqueString ? self.requiredUniqueString : [NSNull null]) forKey:@"requiredUniqueString"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -283,6 +400,49 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredStringProperty))
+    {
+        [writer writeKey:@"requiredString"];
+        [writer writeValue:self.requiredString];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueUniqueStringProperty))
+    {
+        [writer writeKey:@"uniqueString"];
+        [writer writeValue:self.uniqueString];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredUniqueStringProperty))
+    {
+        [writer writeKey:@"requiredUniqueString"];
+        [writer writeValue:self.requiredUniqueString];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"requiredString"];
+    [writer writeValue:self.requiredString];
+
+    [writer writeKey:@"uniqueString"];
+    [writer writeValue:self.uniqueString];
+
+    [writer writeKey:@"requiredUniqueString"];
+    [writer writeValue:self.requiredUniqueString];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -291,6 +451,15 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredStringProperty))
+        JRValidateCaptureAttribute(self.requiredString, @"requiredString", self.captureObjectPath, JRCaptureAttributeRequired, 0, violations);
+
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRObjectTestRequiredUniqueRequiredUniqueStringProperty))
+        JRValidateCaptureAttribute(self.requiredUniqueString, @"requiredUniqueString", self.captureObjectPath, JRCaptureAttributeRequired, 0, violations);
+}
+
 - (BOOL)isEqualToObjectTestRequiredUnique:(JRObjectTestRequiredUnique *)otherObjectTestRequiredUnique
 {
     if (!self.requiredString && !otherObjectTestRequiredUnique.requiredString) /* Keep going... */;
@@ -320,4 +489,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRObjectTestRequiredUnique class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROinoL1Object.h"
 
+enum
+{
+    JROinoL1ObjectString1Property,
+    JROinoL1ObjectString2Property,
+    JROinoL1ObjectOinoL2ObjectProperty,
+    JROinoL1ObjectPropertyCount
+};
+
+static const char *const JROinoL1ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinoL2Object",
+};
+
 @interface JROinoL2Object (JROinoL2Object_InternalMethods)
 + (id)oinoL2ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinoL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinoL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinoL2Object:(JROinoL2Object *)otherOinoL2Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROinoL2Object *_oinoL2Object;
+    NSDictionary *_oinoL2ObjectJson;
+    BOOL _oinoL2ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinoL1ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinoL1ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROinoL2Object *)oinoL2Object
 {
+    if (_oinoL2ObjectJson)
+    {
+        NSDictionary *json = _oinoL2ObjectJson;
+        _oinoL2ObjectJson = nil;
+        _oinoL2Object = [JROinoL2Object oinoL2ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinoL2ObjectJsonCleared)
+            [_oinoL2Object deepClearDirtyProperties];
+        else
+            [_oinoL2Object setAllPropertiesToDirty];
+    }
+
     return _oinoL2Object;
 }
 
 - (void)setOinoL2Object:(JROinoL2Object *)newOinoL2Object
 {
-    [self.dirtyPropertySet addObject:@"oinoL2Object"];
+    _oinoL2ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectOinoL2ObjectProperty);
 
     _oinoL2Object = newOinoL2Object;
 
@@ -104,7 +147,7 @@
 
         _oinoL2Object = [[JROinoL2Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -154,6 +197,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     oinoL1Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -162,9 +207,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    oinoL1Object.oinoL2Object =
-        [dictionary objectForKey:@"oinoL2Object"] != [NSNull null] ? 
-        [JROinoL2Object oinoL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoL2Object"] withPath:oinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinoL2Object"] isKindOfClass:[NSDictionary class]])
+        oinoL1Object->_oinoL2ObjectJson = [dictionary objectForKey:@"oinoL2Object"];
+    else
+        oinoL1Object.oinoL2Object =
+            [dictionary objectForKey:@"oinoL2Object"] != [NSNull null] ? 
+            [JROinoL2Object oinoL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoL2Object"] withPath:oinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [oinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -179,11 +227,116 @@
     return [JROinoL1Object oinoL1ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)oinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinoL1Object *oinoL1Object = [JROinoL1Object oinoL1Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    oinoL1Object.oinoL2Object = nil;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoL2Object")) break;
+                if (!lazily)
+                    oinoL1Object.oinoL2Object = [JROinoL2Object oinoL2ObjectObjectFromJsonReader:reader withPath:oinoL1Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    oinoL1Object->_oinoL2ObjectJson = value;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinoL1Object.dirtyPropertySet removeAllObjects];
+
+    return oinoL1Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"oinoL2Object"];
+    if (self.oinoL2Object)
+        [self.oinoL2Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)oinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinoL1Object *oinoL1Object = [JROinoL1Object oinoL1Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    oinoL1Object.captureObjectPath = [reader readString];
+    oinoL1Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoL2Object")) break;
+                oinoL1Object.oinoL2Object = [JROinoL2Object oinoL2ObjectObjectFromArchive:reader];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return oinoL1Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROinoL1ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -202,7 +355,7 @@
     else
         [self.oinoL2Object replaceFromDictionary:[dictionary objectForKey:@"oinoL2Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -210,18 +363,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"oinoL2Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinoL1Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"oinoL1Object"];
 
     if (self.oinoL2Object)
         [snapshotDictionary setObject:[self.oinoL2Object snapshotDictionaryFromDirtyPropertySet]
@@ -233,7 +380,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"oinoL1Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoL1Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"oinoL1Object"]];
 
     if ([snapshotDictionary objectForKey:@"oinoL2Object"])
         [self.oinoL2Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -246,13 +393,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinoL2Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectOinoL2ObjectProperty))
         [dictionary setObject:(self.oinoL2Object ?
                               [self.oinoL2Object toUpdateDictionary] :
                               [[JROinoL2Object oinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -287,6 +434,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoL1ObjectOinoL2ObjectProperty))
+    {
+        [writer writeKey:@"oinoL2Object"];
+        [(self.oinoL2Object ? self.oinoL2Object : [JROinoL2Object oinoL2Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinoL2Object needsUpdate])
+    {
+        [writer writeKey:@"oinoL2Object"];
+        [self.oinoL2Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"oinoL2Object"];
+    if (self.oinoL2Object)
+        [self.oinoL2Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinoL2Object oinoL2Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -298,6 +496,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_oinoL2ObjectJson)
+        [self.oinoL2Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOinoL1Object:(JROinoL1Object *)otherOinoL1Object
 {
     if (!self.string1 && !otherOinoL1Object.string1) /* Keep going... */;
@@ -328,4 +532,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_oinoL2ObjectJson)
+        _oinoL2ObjectJsonCleared = YES;
+    else
+        [self.oinoL2Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROinoL1Object class]]) return NO;
+
+    JROinoL1Object *otherOinoL1Object = (JROinoL1Object *)otherObj;
+
+    if (self.oinoL2Object && ![self.oinoL2Object isEqualByPrivateProperties:otherOinoL1Object.oinoL2Object])
+        return NO;
+
+    return YES;
+}
+
 @end
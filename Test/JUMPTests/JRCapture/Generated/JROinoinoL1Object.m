@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROinoinoL1Object.h"
 
+enum
+{
+    JROinoinoL1ObjectString1Property,
+    JROinoinoL1ObjectString2Property,
+    JROinoinoL1ObjectOinoinoL2ObjectProperty,
+    JROinoinoL1ObjectPropertyCount
+};
+
+static const char *const JROinoinoL1ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinoinoL2Object",
+};
+
 @interface JROinoinoL2Object (JROinoinoL2Object_InternalMethods)
 + (id)oinoinoL2ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinoinoL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinoinoL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinoinoL2Object:(JROinoinoL2Object *)otherOinoinoL2Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROinoinoL2Object *_oinoinoL2Object;
+    NSDictionary *_oinoinoL2ObjectJson;
+    BOOL _oinoinoL2ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinoinoL1ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinoinoL1ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROinoinoL2Object *)oinoinoL2Object
 {
+    if (_oinoinoL2ObjectJson)
+    {
+        NSDictionary *json = _oinoinoL2ObjectJson;
+        _oinoinoL2ObjectJson = nil;
+        _oinoinoL2Object = [JROinoinoL2Object oinoinoL2ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinoinoL2ObjectJsonCleared)
+            [_oinoinoL2Object deepClearDirtyProperties];
+        else
+            [_oinoinoL2Object setAllPropertiesToDirty];
+    }
+
     return _oinoinoL2Object;
 }
 
 - (void)setOinoinoL2Object:(JROinoinoL2Object *)newOinoinoL2Object
 {
-    [self.dirtyPropertySet addObject:@"oinoinoL2Object"];
+    _oinoinoL2ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectOinoinoL2ObjectProperty);
 
     _oinoinoL2Object = newOinoinoL2Object;
 
@@ -104,7 +147,7 @@
 
         _oinoinoL2Object = [[JROinoinoL2Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -154,6 +197,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     oinoinoL1Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -162,9 +207,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    oinoinoL1Object.oinoinoL2Object =
-        [dictionary objectForKey:@"oinoinoL2Object"] != [NSNull null] ? 
-        [JROinoinoL2Object oinoinoL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoinoL2Object"] withPath:oinoinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinoinoL2Object"] isKindOfClass:[NSDictionary class]])
+        oinoinoL1Object->_oinoinoL2ObjectJson = [dictionary objectForKey:@"oinoinoL2Object"];
+    else
+        oinoinoL1Object.oinoinoL2Object =
+            [dictionary objectForKey:@"oinoinoL2Object"] != [NSNull null] ? 
+            [JROinoinoL2Object oinoinoL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoinoL2Object"] withPath:oinoinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [oinoinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -179,11 +227,116 @@
     return [JROinoinoL1Object oinoinoL1ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)oinoinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinoinoL1Object *oinoinoL1Object = [JROinoinoL1Object oinoinoL1Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    oinoinoL1Object.oinoinoL2Object = nil;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 15)
+        {
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoinoL2Object")) break;
+                if (!lazily)
+                    oinoinoL1Object.oinoinoL2Object = [JROinoinoL2Object oinoinoL2ObjectObjectFromJsonReader:reader withPath:oinoinoL1Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    oinoinoL1Object->_oinoinoL2ObjectJson = value;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinoinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinoinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinoinoL1Object.dirtyPropertySet removeAllObjects];
+
+    return oinoinoL1Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"oinoinoL2Object"];
+    if (self.oinoinoL2Object)
+        [self.oinoinoL2Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)oinoinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinoinoL1Object *oinoinoL1Object = [JROinoinoL1Object oinoinoL1Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    oinoinoL1Object.captureObjectPath = [reader readString];
+    oinoinoL1Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 15)
+        {
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoinoL2Object")) break;
+                oinoinoL1Object.oinoinoL2Object = [JROinoinoL2Object oinoinoL2ObjectObjectFromArchive:reader];
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinoinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 12:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinoinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinoinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return oinoinoL1Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROinoinoL1ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -202,7 +355,7 @@
     else
         [self.oinoinoL2Object replaceFromDictionary:[dictionary objectForKey:@"oinoinoL2Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -210,18 +363,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"oinoinoL2Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinoinoL1Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"oinoinoL1Object"];
 
     if (self.oinoinoL2Object)
         [snapshotDictionary setObject:[self.oinoinoL2Object snapshotDictionaryFromDirtyPropertySet]
@@ -233,7 +380,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"oinoinoL1Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoinoL1Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"oinoinoL1Object"]];
 
     if ([snapshotDictionary objectForKey:@"oinoinoL2Object"])
         [self.oinoinoL2Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -246,13 +393,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinoinoL2Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectOinoinoL2ObjectProperty))
         [dictionary setObject:(self.oinoinoL2Object ?
                               [self.oinoinoL2Object toUpdateDictionary] :
                               [[JROinoinoL2Object oinoinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -287,6 +434,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL1ObjectOinoinoL2ObjectProperty))
+    {
+        [writer writeKey:@"oinoinoL2Object"];
+        [(self.oinoinoL2Object ? self.oinoinoL2Object : [JROinoinoL2Object oinoinoL2Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinoinoL2Object needsUpdate])
+    {
+        [writer writeKey:@"oinoinoL2Object"];
+        [self.oinoinoL2Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"oinoinoL2Object"];
+    if (self.oinoinoL2Object)
+        [self.oinoinoL2Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinoinoL2Object oinoinoL2Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -298,6 +496,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_oinoinoL2ObjectJson)
+        [self.oinoinoL2Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOinoinoL1Object:(JROinoinoL1Object *)otherOinoinoL1Object
 {
     if (!self.string1 && !otherOinoinoL1Object.string1) /* Keep going... */;
@@ -328,4 +532,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_oinoinoL2ObjectJson)
+        _oinoinoL2ObjectJsonCleared = YES;
+    else
+        [self.oinoinoL2Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROinoinoL1Object class]]) return NO;
+
+    JROinoinoL1Object *otherOinoinoL1Object = (JROinoinoL1Object *)otherObj;
+
+    if (self.oinoinoL2Object && ![self.oinoinoL2Object isEqualByPrivateProperties:otherOinoinoL1Object.oinoinoL2Object])
+        return NO;
+
+    return YES;
+}
+
 @end
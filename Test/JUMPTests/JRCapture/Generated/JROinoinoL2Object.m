@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROinoinoL2Object.h"
 
+enum
+{
+    JROinoinoL2ObjectString1Property,
+    JROinoinoL2ObjectString2Property,
+    JROinoinoL2ObjectOinoinoL3ObjectProperty,
+    JROinoinoL2ObjectPropertyCount
+};
+
+static const char *const JROinoinoL2ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinoinoL3Object",
+};
+
 @interface JROinoinoL3Object (JROinoinoL3Object_InternalMethods)
 + (id)oinoinoL3ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinoinoL3ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinoinoL3ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinoinoL3Object:(JROinoinoL3Object *)otherOinoinoL3Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROinoinoL3Object *_oinoinoL3Object;
+    NSDictionary *_oinoinoL3ObjectJson;
+    BOOL _oinoinoL3ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinoinoL2ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinoinoL2ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROinoinoL3Object *)oinoinoL3Object
 {
+    if (_oinoinoL3ObjectJson)
+    {
+        NSDictionary *json = _oinoinoL3ObjectJson;
+        _oinoinoL3ObjectJson = nil;
+        _oinoinoL3Object = [JROinoinoL3Object oinoinoL3ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinoinoL3ObjectJsonCleared)
+            [_oinoinoL3Object deepClearDirtyProperties];
+        else
+            [_oinoinoL3Object setAllPropertiesToDirty];
+    }
+
     return _oinoinoL3Object;
 }
 
 - (void)setOinoinoL3Object:(JROinoinoL3Object *)newOinoinoL3Object
 {
-    [self.dirtyPropertySet addObject:@"oinoinoL3Object"];
+    _oinoinoL3ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectOinoinoL3ObjectProperty);
 
     _oinoinoL3Object = newOinoinoL3Object;
 
@@ -104,7 +147,7 @@
 
         _oinoinoL3Object = [[JROinoinoL3Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -154,6 +197,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     oinoinoL2Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -162,9 +207,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    oinoinoL2Object.oinoinoL3Object =
-        [dictionary objectForKey:@"oinoinoL3Object"] != [NSNull null] ? 
-        [JROinoinoL3Object oinoinoL3ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoinoL3Object"] withPath:oinoinoL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinoinoL3Object"] isKindOfClass:[NSDictionary class]])
+        oinoinoL2Object->_oinoinoL3ObjectJson = [dictionary objectForKey:@"oinoinoL3Object"];
+    else
+        oinoinoL2Object.oinoinoL3Object =
+            [dictionary objectForKey:@"oinoinoL3Object"] != [NSNull null] ? 
+            [JROinoinoL3Object oinoinoL3ObjectObjectFromDictionary:[dictionary objectForKey:@"oinoinoL3Object"] withPath:oinoinoL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [oinoinoL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -179,11 +227,116 @@
     return [JROinoinoL2Object oinoinoL2ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)oinoinoL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinoinoL2Object *oinoinoL2Object = [JROinoinoL2Object oinoinoL2Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    oinoinoL2Object.oinoinoL3Object = nil;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinoinoL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoinoL3Object")) break;
+                if (!lazily)
+                    oinoinoL2Object.oinoinoL3Object = [JROinoinoL3Object oinoinoL3ObjectObjectFromJsonReader:reader withPath:oinoinoL2Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    oinoinoL2Object->_oinoinoL3ObjectJson = value;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinoinoL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinoinoL2Object.dirtyPropertySet removeAllObjects];
+
+    return oinoinoL2Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"oinoinoL3Object"];
+    if (self.oinoinoL3Object)
+        [self.oinoinoL3Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)oinoinoL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinoinoL2Object *oinoinoL2Object = [JROinoinoL2Object oinoinoL2Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    oinoinoL2Object.captureObjectPath = [reader readString];
+    oinoinoL2Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinoinoL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "oinoinoL3Object")) break;
+                oinoinoL2Object.oinoinoL3Object = [JROinoinoL3Object oinoinoL3ObjectObjectFromArchive:reader];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinoinoL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinoinoL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return oinoinoL2Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROinoinoL2ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -202,7 +355,7 @@
     else
         [self.oinoinoL3Object replaceFromDictionary:[dictionary objectForKey:@"oinoinoL3Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -210,18 +363,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"oinoinoL3Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinoinoL2Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"oinoinoL2Object"];
 
     if (self.oinoinoL3Object)
         [snapshotDictionary setObject:[self.oinoinoL3Object snapshotDictionaryFromDirtyPropertySet]
@@ -233,7 +380,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"oinoinoL2Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoinoL2Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"oinoinoL2Object"]];
 
     if ([snapshotDictionary objectForKey:@"oinoinoL3Object"])
         [self.oinoinoL3Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -246,13 +393,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinoinoL3Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectOinoinoL3ObjectProperty))
         [dictionary setObject:(self.oinoinoL3Object ?
                               [self.oinoinoL3Object toUpdateDictionary] :
                               [[JROinoinoL3Object oinoinoL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -287,6 +434,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinoinoL2ObjectOinoinoL3ObjectProperty))
+    {
+        [writer writeKey:@"oinoinoL3Object"];
+        [(self.oinoinoL3Object ? self.oinoinoL3Object : [JROinoinoL3Object oinoinoL3Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinoinoL3Object needsUpdate])
+    {
+        [writer writeKey:@"oinoinoL3Object"];
+        [self.oinoinoL3Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"oinoinoL3Object"];
+    if (self.oinoinoL3Object)
+        [self.oinoinoL3Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinoinoL3Object oinoinoL3Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -298,6 +496,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_oinoinoL3ObjectJson)
+        [self.oinoinoL3Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOinoinoL2Object:(JROinoinoL2Object *)otherOinoinoL2Object
 {
     if (!self.string1 && !otherOinoinoL2Object.string1) /* Keep going... */;
@@ -328,4 +532,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_oinoinoL3ObjectJson)
+        _oinoinoL3ObjectJsonCleared = YES;
+    else
+        [self.oinoinoL3Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROinoinoL2Object class]]) return NO;
+
+    JROinoinoL2Object *otherOinoinoL2Object = (JROinoinoL2Object *)otherObj;
+
+    if (self.oinoinoL3Object && ![self.oinoinoL3Object isEqualByPrivateProperties:otherOinoinoL2Object.oinoinoL3Object])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROinonipL1PluralElement.h"
 
+enum
+{
+    JROinonipL1PluralElementString1Property,
+    JROinonipL1PluralElementString2Property,
+    JROinonipL1PluralElementOinonipL2ObjectProperty,
+    JROinonipL1PluralElementPropertyCount
+};
+
+static const char *const JROinonipL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinonipL2Object",
+};
+
 @interface JROinonipL2Object (JROinonipL2Object_InternalMethods)
 + (id)oinonipL2ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinonipL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinonipL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinonipL2Object:(JROinonipL2Object *)otherOinonipL2Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROinonipL2Object *_oinonipL2Object;
+    NSDictionary *_oinonipL2ObjectJson;
+    BOOL _oinonipL2ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinonipL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinonipL1PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROinonipL2Object *)oinonipL2Object
 {
+    if (_oinonipL2ObjectJson)
+    {
+        NSDictionary *json = _oinonipL2ObjectJson;
+        _oinonipL2ObjectJson = nil;
+        _oinonipL2Object = [JROinonipL2Object oinonipL2ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinonipL2ObjectJsonCleared)
+            [_oinonipL2Object deepClearDirtyProperties];
+        else
+            [_oinonipL2Object setAllPropertiesToDirty];
+    }
+
     return _oinonipL2Object;
 }
 
 - (void)setOinonipL2Object:(JROinonipL2Object *)newOinonipL2Object
 {
-    [self.dirtyPropertySet addObject:@"oinonipL2Object"];
+    _oinonipL2ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementOinonipL2ObjectProperty);
 
     _oinonipL2Object = newOinonipL2Object;
 
@@ -104,7 +147,7 @@
 
         _oinonipL2Object = [[JROinonipL2Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -160,6 +203,8 @@
         oinonipL1PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     oinonipL1PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -168,9 +213,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    oinonipL1PluralElement.oinonipL2Object =
-        [dictionary objectForKey:@"oinonipL2Object"] != [NSNull null] ? 
-        [JROinonipL2Object oinonipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinonipL2Object"] withPath:oinonipL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinonipL2Object"] isKindOfClass:[NSDictionary class]])
+        oinonipL1PluralElement->_oinonipL2ObjectJson = [dictionary objectForKey:@"oinonipL2Object"];
+    else
+        oinonipL1PluralElement.oinonipL2Object =
+            [dictionary objectForKey:@"oinonipL2Object"] != [NSNull null] ? 
+            [JROinonipL2Object oinonipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinonipL2Object"] withPath:oinonipL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [oinonipL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -185,11 +233,129 @@
     return [JROinonipL1PluralElement oinonipL1PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)oinonipL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinonipL1PluralElement *oinonipL1PluralElement = [JROinonipL1PluralElement oinonipL1PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinonipL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinonipL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "oinonipL2Object")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"oinonipL2Object"];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    oinonipL1PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"oinonipL1Plural", (long)elementId];
+    oinonipL1PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"oinonipL2Object"] isKindOfClass:[NSDictionary class]])
+        oinonipL1PluralElement->_oinonipL2ObjectJson = [dictionary objectForKey:@"oinonipL2Object"];
+    else
+        oinonipL1PluralElement.oinonipL2Object =
+            [dictionary objectForKey:@"oinonipL2Object"] != [NSNull null] ? 
+            [JROinonipL2Object oinonipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"oinonipL2Object"] withPath:oinonipL1PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [oinonipL1PluralElement.dirtyPropertySet removeAllObjects];
+
+    return oinonipL1PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"oinonipL2Object"];
+    if (self.oinonipL2Object)
+        [self.oinonipL2Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)oinonipL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinonipL1PluralElement *oinonipL1PluralElement = [JROinonipL1PluralElement oinonipL1PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    oinonipL1PluralElement.captureObjectPath = [reader readString];
+    oinonipL1PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "oinonipL2Object")) break;
+                oinonipL1PluralElement.oinonipL2Object = [JROinonipL2Object oinonipL2ObjectObjectFromArchive:reader];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinonipL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinonipL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinonipL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return oinonipL1PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROinonipL1PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"oinonipL1Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -209,7 +375,7 @@
     else
         [self.oinonipL2Object replaceFromDictionary:[dictionary objectForKey:@"oinonipL2Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -217,18 +383,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"oinonipL2Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinonipL1PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"oinonipL1PluralElement"];
 
     if (self.oinonipL2Object)
         [snapshotDictionary setObject:[self.oinonipL2Object snapshotDictionaryFromDirtyPropertySet]
@@ -240,7 +400,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"oinonipL1PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinonipL1PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"oinonipL1PluralElement"]];
 
     if ([snapshotDictionary objectForKey:@"oinonipL2Object"])
         [self.oinonipL2Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -253,13 +413,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinonipL2Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementOinonipL2ObjectProperty))
         [dictionary setObject:(self.oinonipL2Object ?
                               [self.oinonipL2Object toUpdateDictionary] :
                               [[JROinonipL2Object oinonipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -294,6 +454,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL1PluralElementOinonipL2ObjectProperty))
+    {
+        [writer writeKey:@"oinonipL2Object"];
+        [(self.oinonipL2Object ? self.oinonipL2Object : [JROinonipL2Object oinonipL2Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinonipL2Object needsUpdate])
+    {
+        [writer writeKey:@"oinonipL2Object"];
+        [self.oinonipL2Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"oinonipL2Object"];
+    if (self.oinonipL2Object)
+        [self.oinonipL2Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinonipL2Object oinonipL2Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -305,6 +516,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_oinonipL2ObjectJson)
+        [self.oinonipL2Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOinonipL1PluralElement:(JROinonipL1PluralElement *)otherOinonipL1PluralElement
 {
     if (!self.string1 && !otherOinonipL1PluralElement.string1) /* Keep going... */;
@@ -335,4 +552,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_oinonipL2ObjectJson)
+        _oinonipL2ObjectJsonCleared = YES;
+    else
+        [self.oinonipL2Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROinonipL1PluralElement class]]) return NO;
+
+    JROinonipL1PluralElement *otherOinonipL1PluralElement = (JROinonipL1PluralElement *)otherObj;
+
+    if (self.oinonipL2Object && ![self.oinonipL2Object isEqualByPrivateProperties:otherOinonipL1PluralElement.oinonipL2Object])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROinonipL2Object.h"
 
+enum
+{
+    JROinonipL2ObjectString1Property,
+    JROinonipL2ObjectString2Property,
+    JROinonipL2ObjectOinonipL3ObjectProperty,
+    JROinonipL2ObjectPropertyCount
+};
+
+static const char *const JROinonipL2ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinonipL3Object",
+};
+
 @interface JROinonipL3Object (JROinonipL3Object_InternalMethods)
 + (id)oinonipL3ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)oinonipL3ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)oinonipL3ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOinonipL3Object:(JROinonipL3Object *)otherOinonipL3Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROinonipL3Object *_oinonipL3Object;
+    NSDictionary *_oinonipL3ObjectJson;
+    BOOL _oinonipL3ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinonipL2ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinonipL2ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROinonipL3Object *)oinonipL3Object
 {
+    if (_oinonipL3ObjectJson)
+    {
+        NSDictionary *json = _oinonipL3ObjectJson;
+        _oinonipL3ObjectJson = nil;
+        _oinonipL3Object = [JROinonipL3Object oinonipL3ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_oinonipL3ObjectJsonCleared)
+            [_oinonipL3Object deepClearDirtyProperties];
+        else
+            [_oinonipL3Object setAllPropertiesToDirty];
+    }
+
     return _oinonipL3Object;
 }
 
 - (void)setOinonipL3Object:(JROinonipL3Object *)newOinonipL3Object
 {
-    [self.dirtyPropertySet addObject:@"oinonipL3Object"];
+    _oinonipL3ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectOinonipL3ObjectProperty);
 
     _oinonipL3Object = newOinonipL3Object;
 
@@ -104,7 +147,7 @@
 
         _oinonipL3Object = [[JROinonipL3Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -160,6 +203,8 @@
         oinonipL2Object.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     oinonipL2Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -168,9 +213,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    oinonipL2Object.oinonipL3Object =
-        [dictionary objectForKey:@"oinonipL3Object"] != [NSNull null] ? 
-        [JROinonipL3Object oinonipL3ObjectObjectFromDictionary:[dictionary objectForKey:@"oinonipL3Object"] withPath:oinonipL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"oinonipL3Object"] isKindOfClass:[NSDictionary class]])
+        oinonipL2Object->_oinonipL3ObjectJson = [dictionary objectForKey:@"oinonipL3Object"];
+    else
+        oinonipL2Object.oinonipL3Object =
+            [dictionary objectForKey:@"oinonipL3Object"] != [NSNull null] ? 
+            [JROinonipL3Object oinonipL3ObjectObjectFromDictionary:[dictionary objectForKey:@"oinonipL3Object"] withPath:oinonipL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [oinonipL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -185,11 +233,119 @@
     return [JROinonipL2Object oinonipL2ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)oinonipL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinonipL2Object *oinonipL2Object = [JROinonipL2Object oinonipL2Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    oinonipL2Object.captureObjectPath      = [NSString stringWithFormat:@"%@/%@", capturePath, @"oinonipL2Object"];
+    oinonipL2Object.canBeUpdatedOnCapture = YES;
+
+    oinonipL2Object.oinonipL3Object = nil;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinonipL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinonipL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "oinonipL3Object")) break;
+                if (!lazily)
+                    oinonipL2Object.oinonipL3Object = [JROinonipL3Object oinonipL3ObjectObjectFromJsonReader:reader withPath:oinonipL2Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    oinonipL2Object->_oinonipL3ObjectJson = value;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinonipL2Object.dirtyPropertySet removeAllObjects];
+
+    return oinonipL2Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"oinonipL3Object"];
+    if (self.oinonipL3Object)
+        [self.oinonipL3Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)oinonipL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROinonipL2Object *oinonipL2Object = [JROinonipL2Object oinonipL2Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    oinonipL2Object.captureObjectPath = [reader readString];
+    oinonipL2Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                oinonipL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                oinonipL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "oinonipL3Object")) break;
+                oinonipL2Object.oinonipL3Object = [JROinonipL3Object oinonipL3ObjectObjectFromArchive:reader];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [oinonipL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return oinonipL2Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROinonipL2ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"oinonipL2Object"];
@@ -209,7 +365,7 @@
     else
         [self.oinonipL3Object replaceFromDictionary:[dictionary objectForKey:@"oinonipL3Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -217,18 +373,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"oinonipL3Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinonipL2Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"oinonipL2Object"];
 
     if (self.oinonipL3Object)
         [snapshotDictionary setObject:[self.oinonipL3Object snapshotDictionaryFromDirtyPropertySet]
@@ -240,7 +390,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"oinonipL2Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinonipL2Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"oinonipL2Object"]];
 
     if ([snapshotDictionary objectForKey:@"oinonipL3Object"])
         [self.oinonipL3Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -253,13 +403,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"oinonipL3Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectOinonipL3ObjectProperty))
         [dictionary setObject:(self.oinonipL3Object ?
                               [self.oinonipL3Object toUpdateDictionary] :
                               [[JROinonipL3Object oinonipL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -294,6 +444,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROinonipL2ObjectOinonipL3ObjectProperty))
+    {
+        [writer writeKey:@"oinonipL3Object"];
+        [(self.oinonipL3Object ? self.oinonipL3Object : [JROinonipL3Object oinonipL3Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.oinonipL3Object needsUpdate])
+    {
+        [writer writeKey:@"oinonipL3Object"];
+        [self.oinonipL3Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"oinonipL3Object"];
+    if (self.oinonipL3Object)
+        [self.oinonipL3Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROinonipL3Object oinonipL3Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -305,6 +506,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_oinonipL3ObjectJson)
+        [self.oinonipL3Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOinonipL2Object:(JROinonipL2Object *)otherOinonipL2Object
 {
     if (!self.string1 && !otherOinonipL2Object.string1) /* Keep going... */;
@@ -335,4 +542,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_oinonipL3ObjectJson)
+        _oinonipL3ObjectJsonCleared = YES;
+    else
+        [self.oinonipL3Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROinonipL2Object class]]) return NO;
+
+    JROinonipL2Object *otherOinonipL2Object = (JROinonipL2Object *)otherObj;
+
+    if (self.oinonipL3Object && ![self.oinonipL3Object isEqualByPrivateProperties:otherOinonipL2Object.oinonipL3Object])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROnipL1PluralElement.h"
 
+enum
+{
+    JROnipL1PluralElementString1Property,
+    JROnipL1PluralElementString2Property,
+    JROnipL1PluralElementOnipL2ObjectProperty,
+    JROnipL1PluralElementPropertyCount
+};
+
+static const char *const JROnipL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "onipL2Object",
+};
+
 @interface JROnipL2Object (JROnipL2Object_InternalMethods)
 + (id)onipL2ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipL2Object:(JROnipL2Object *)otherOnipL2Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROnipL2Object *_onipL2Object;
+    NSDictionary *_onipL2ObjectJson;
+    BOOL _onipL2ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROnipL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROnipL1PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROnipL2Object *)onipL2Object
 {
+    if (_onipL2ObjectJson)
+    {
+        NSDictionary *json = _onipL2ObjectJson;
+        _onipL2ObjectJson = nil;
+        _onipL2Object = [JROnipL2Object onipL2ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_onipL2ObjectJsonCleared)
+            [_onipL2Object deepClearDirtyProperties];
+        else
+            [_onipL2Object setAllPropertiesToDirty];
+    }
+
     return _onipL2Object;
 }
 
 - (void)setOnipL2Object:(JROnipL2Object *)newOnipL2Object
 {
-    [self.dirtyPropertySet addObject:@"onipL2Object"];
+    _onipL2ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementOnipL2ObjectProperty);
 
     _onipL2Object = newOnipL2Object;
 
@@ -104,7 +147,7 @@
 
         _onipL2Object = [[JROnipL2Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -160,6 +203,8 @@
         onipL1PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     onipL1PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -168,9 +213,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    onipL1PluralElement.onipL2Object =
-        [dictionary objectForKey:@"onipL2Object"] != [NSNull null] ? 
-        [JROnipL2Object onipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"onipL2Object"] withPath:onipL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipL2Object"] isKindOfClass:[NSDictionary class]])
+        onipL1PluralElement->_onipL2ObjectJson = [dictionary objectForKey:@"onipL2Object"];
+    else
+        onipL1PluralElement.onipL2Object =
+            [dictionary objectForKey:@"onipL2Object"] != [NSNull null] ? 
+            [JROnipL2Object onipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"onipL2Object"] withPath:onipL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [onipL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -185,11 +233,129 @@
     return [JROnipL1PluralElement onipL1PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)onipL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipL1PluralElement *onipL1PluralElement = [JROnipL1PluralElement onipL1PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "onipL2Object")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"onipL2Object"];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    onipL1PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipL1Plural", (long)elementId];
+    onipL1PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"onipL2Object"] isKindOfClass:[NSDictionary class]])
+        onipL1PluralElement->_onipL2ObjectJson = [dictionary objectForKey:@"onipL2Object"];
+    else
+        onipL1PluralElement.onipL2Object =
+            [dictionary objectForKey:@"onipL2Object"] != [NSNull null] ? 
+            [JROnipL2Object onipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"onipL2Object"] withPath:onipL1PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [onipL1PluralElement.dirtyPropertySet removeAllObjects];
+
+    return onipL1PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"onipL2Object"];
+    if (self.onipL2Object)
+        [self.onipL2Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)onipL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipL1PluralElement *onipL1PluralElement = [JROnipL1PluralElement onipL1PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    onipL1PluralElement.captureObjectPath = [reader readString];
+    onipL1PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "onipL2Object")) break;
+                onipL1PluralElement.onipL2Object = [JROnipL2Object onipL2ObjectObjectFromArchive:reader];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [onipL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return onipL1PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROnipL1PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipL1Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -209,7 +375,7 @@
     else
         [self.onipL2Object replaceFromDictionary:[dictionary objectForKey:@"onipL2Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -217,18 +383,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"onipL2Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipL1PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"onipL1PluralElement"];
 
     if (self.onipL2Object)
         [snapshotDictionary setObject:[self.onipL2Object snapshotDictionaryFromDirtyPropertySet]
@@ -240,7 +400,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"onipL1PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipL1PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"onipL1PluralElement"]];
 
     if ([snapshotDictionary objectForKey:@"onipL2Object"])
         [self.onipL2Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -253,13 +413,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"onipL2Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementOnipL2ObjectProperty))
         [dictionary setObject:(self.onipL2Object ?
                               [self.onipL2Object toUpdateDictionary] :
                               [[JROnipL2Object onipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -294,6 +454,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipL1PluralElementOnipL2ObjectProperty))
+    {
+        [writer writeKey:@"onipL2Object"];
+        [(self.onipL2Object ? self.onipL2Object : [JROnipL2Object onipL2Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.onipL2Object needsUpdate])
+    {
+        [writer writeKey:@"onipL2Object"];
+        [self.onipL2Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"onipL2Object"];
+    if (self.onipL2Object)
+        [self.onipL2Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROnipL2Object onipL2Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -305,6 +516,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_onipL2ObjectJson)
+        [self.onipL2Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOnipL1PluralElement:(JROnipL1PluralElement *)otherOnipL1PluralElement
 {
     if (!self.string1 && !otherOnipL1PluralElement.string1) /* Keep going... */;
@@ -335,4 +552,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_onipL2ObjectJson)
+        _onipL2ObjectJsonCleared = YES;
+    else
+        [self.onipL2Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROnipL1PluralElement class]]) return NO;
+
+    JROnipL1PluralElement *otherOnipL1PluralElement = (JROnipL1PluralElement *)otherObj;
+
+    if (self.onipL2Object && ![self.onipL2Object isEqualByPrivateProperties:otherOnipL1PluralElement.onipL2Object])
+        return NO;
+
+    return YES;
+}
+
 @end
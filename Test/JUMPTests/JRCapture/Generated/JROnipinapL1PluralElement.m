@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROnipinapL1PluralElement.h"
 
+enum
+{
+    JROnipinapL1PluralElementString1Property,
+    JROnipinapL1PluralElementString2Property,
+    JROnipinapL1PluralElementPropertyCount
+};
+
+static const char *const JROnipinapL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JROnipinapL2PluralElement (JROnipinapL2PluralElement_InternalMethods)
 + (id)onipinapL2PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipinapL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipinapL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipinapL2PluralElement:(JROnipinapL2PluralElement *)otherOnipinapL2PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfOnipinapL2PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipinapL2PluralElement class]])
+            [(JROnipinapL2PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipinapL2PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipinapL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipinapL2PluralElement *element = [JROnipinapL2PluralElement onipinapL2PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredOnipinapL2PluralArray addObject:element];
+    }
+
+    return filteredOnipinapL2PluralArray;
+}
+
+- (void)writeOnipinapL2PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipinapL2PluralElement class]])
+            [(JROnipinapL2PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipinapL2PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipinapL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipinapL2PluralElement *element = [JROnipinapL2PluralElement onipinapL2PluralElementFromArchive:reader];
+        if (element)
+            [filteredOnipinapL2PluralArray addObject:element];
+    }
+
+    return filteredOnipinapL2PluralArray;
+}
 @end
 
 @interface NSArray (OnipinapL1PluralElement_ArrayComparison)
 - (BOOL)isEqualToOnipinapL2PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToOnipinapL2PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (OnipinapL1PluralElement_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToOnipinapL2PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JROnipinapL2PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JROnipinapL1PluralElement ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_onipinapL2Plural;
+    NSArray *_onipinapL2PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROnipinapL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROnipinapL1PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinapL1PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinapL1PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)onipinapL2Plural
 {
+    if (_onipinapL2PluralJson)
+    {
+        NSArray *json = _onipinapL2PluralJson;
+        _onipinapL2PluralJson = nil;
+        _onipinapL2Plural = [[json arrayOfOnipinapL2PluralElementsFromOnipinapL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _onipinapL2Plural;
 }
 
 - (void)setOnipinapL2Plural:(NSArray *)newOnipinapL2Plural
 {
+    _onipinapL2PluralJson = nil;
+
     _onipinapL2Plural = [newOnipinapL2Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,6 +312,8 @@
         onipinapL1PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     onipinapL1PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -223,9 +322,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    onipinapL1PluralElement.onipinapL2Plural =
-        [dictionary objectForKey:@"onipinapL2Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"onipinapL2Plural"] arrayOfOnipinapL2PluralElementsFromOnipinapL2PluralDictionariesWithPath:onipinapL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipinapL2Plural"] isKindOfClass:[NSArray class]])
+        onipinapL1PluralElement->_onipinapL2PluralJson = [dictionary objectForKey:@"onipinapL2Plural"];
+    else
+        onipinapL1PluralElement.onipinapL2Plural =
+            [dictionary objectForKey:@"onipinapL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"onipinapL2Plural"] arrayOfOnipinapL2PluralElementsFromOnipinapL2PluralDictionariesWithPath:onipinapL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [onipinapL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -240,11 +342,129 @@
     return [JROnipinapL1PluralElement onipinapL1PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)onipinapL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinapL1PluralElement *onipinapL1PluralElement = [JROnipinapL1PluralElement onipinapL1PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinapL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinapL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinapL2Plural")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"onipinapL2Plural"];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    onipinapL1PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipinapL1Plural", (long)elementId];
+    onipinapL1PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"onipinapL2Plural"] isKindOfClass:[NSArray class]])
+        onipinapL1PluralElement->_onipinapL2PluralJson = [dictionary objectForKey:@"onipinapL2Plural"];
+    else
+        onipinapL1PluralElement.onipinapL2Plural =
+            [dictionary objectForKey:@"onipinapL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"onipinapL2Plural"] arrayOfOnipinapL2PluralElementsFromOnipinapL2PluralDictionariesWithPath:onipinapL1PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [onipinapL1PluralElement.dirtyPropertySet removeAllObjects];
+
+    return onipinapL1PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"onipinapL2Plural"];
+    if (self.onipinapL2Plural)
+        [self.onipinapL2Plural writeOnipinapL2PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)onipinapL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinapL1PluralElement *onipinapL1PluralElement = [JROnipinapL1PluralElement onipinapL1PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    onipinapL1PluralElement.captureObjectPath = [reader readString];
+    onipinapL1PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinapL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinapL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinapL2Plural")) break;
+                onipinapL1PluralElement.onipinapL2Plural = [NSArray arrayOfOnipinapL2PluralElementsFromArchive:reader];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [onipinapL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return onipinapL1PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROnipinapL1PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipinapL1Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -261,7 +481,7 @@
         [dictionary objectForKey:@"onipinapL2Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"onipinapL2Plural"] arrayOfOnipinapL2PluralElementsFromOnipinapL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -269,18 +489,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipinapL1PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"onipinapL1PluralElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -288,7 +502,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"onipinapL1PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinapL1PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"onipinapL1PluralElement"]];
 
 }
 
@@ -297,10 +511,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL1PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL1PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -329,6 +543,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL1PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL1PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"onipinapL2Plural"];
+    [(self.onipinapL2Plural ? self.onipinapL2Plural : [NSArray array]) writeReplaceJsonOfOnipinapL2PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replaceOnipinapL2PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.onipinapL2Plural named:@"onipinapL2Plural" isArrayOfStrings:NO
@@ -343,6 +594,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.onipinapL2Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToOnipinapL1PluralElement:(JROnipinapL1PluralElement *)otherOnipinapL1PluralElement
 {
     if (!self.string1 && !otherOnipinapL1PluralElement.string1) /* Keep going... */;
@@ -373,4 +631,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROnipinapL1PluralElement class]]) return NO;
+
+    JROnipinapL1PluralElement *otherOnipinapL1PluralElement = (JROnipinapL1PluralElement *)otherObj;
+
+    if (self.onipinapL2Plural && ![self.onipinapL2Plural isEqualByPrivatePropertiesToOnipinapL2PluralArray:otherOnipinapL1PluralElement.onipinapL2Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
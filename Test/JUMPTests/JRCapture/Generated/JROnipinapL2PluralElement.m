@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROnipinapL2PluralElement.h"
 
+enum
+{
+    JROnipinapL2PluralElementString1Property,
+    JROnipinapL2PluralElementString2Property,
+    JROnipinapL2PluralElementOnipinapL3ObjectProperty,
+    JROnipinapL2PluralElementPropertyCount
+};
+
+static const char *const JROnipinapL2PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "onipinapL3Object",
+};
+
 @interface JROnipinapL3Object (JROnipinapL3Object_InternalMethods)
 + (id)onipinapL3ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipinapL3ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipinapL3ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipinapL3Object:(JROnipinapL3Object *)otherOnipinapL3Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROnipinapL3Object *_onipinapL3Object;
+    NSDictionary *_onipinapL3ObjectJson;
+    BOOL _onipinapL3ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROnipinapL2PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROnipinapL2PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROnipinapL3Object *)onipinapL3Object
 {
+    if (_onipinapL3ObjectJson)
+    {
+        NSDictionary *json = _onipinapL3ObjectJson;
+        _onipinapL3ObjectJson = nil;
+        _onipinapL3Object = [JROnipinapL3Object onipinapL3ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_onipinapL3ObjectJsonCleared)
+            [_onipinapL3Object deepClearDirtyProperties];
+        else
+            [_onipinapL3Object setAllPropertiesToDirty];
+    }
+
     return _onipinapL3Object;
 }
 
 - (void)setOnipinapL3Object:(JROnipinapL3Object *)newOnipinapL3Object
 {
-    [self.dirtyPropertySet addObject:@"onipinapL3Object"];
+    _onipinapL3ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementOnipinapL3ObjectProperty);
 
     _onipinapL3Object = newOnipinapL3Object;
 
@@ -104,7 +147,7 @@
 
         _onipinapL3Object = [[JROnipinapL3Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -160,6 +203,8 @@
         onipinapL2PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     onipinapL2PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -168,9 +213,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    onipinapL2PluralElement.onipinapL3Object =
-        [dictionary objectForKey:@"onipinapL3Object"] != [NSNull null] ? 
-        [JROnipinapL3Object onipinapL3ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinapL3Object"] withPath:onipinapL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipinapL3Object"] isKindOfClass:[NSDictionary class]])
+        onipinapL2PluralElement->_onipinapL3ObjectJson = [dictionary objectForKey:@"onipinapL3Object"];
+    else
+        onipinapL2PluralElement.onipinapL3Object =
+            [dictionary objectForKey:@"onipinapL3Object"] != [NSNull null] ? 
+            [JROnipinapL3Object onipinapL3ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinapL3Object"] withPath:onipinapL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [onipinapL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -185,11 +233,129 @@
     return [JROnipinapL2PluralElement onipinapL2PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)onipinapL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinapL2PluralElement *onipinapL2PluralElement = [JROnipinapL2PluralElement onipinapL2PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinapL3Object")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"onipinapL3Object"];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinapL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinapL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    onipinapL2PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipinapL2Plural", (long)elementId];
+    onipinapL2PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"onipinapL3Object"] isKindOfClass:[NSDictionary class]])
+        onipinapL2PluralElement->_onipinapL3ObjectJson = [dictionary objectForKey:@"onipinapL3Object"];
+    else
+        onipinapL2PluralElement.onipinapL3Object =
+            [dictionary objectForKey:@"onipinapL3Object"] != [NSNull null] ? 
+            [JROnipinapL3Object onipinapL3ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinapL3Object"] withPath:onipinapL2PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [onipinapL2PluralElement.dirtyPropertySet removeAllObjects];
+
+    return onipinapL2PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"onipinapL3Object"];
+    if (self.onipinapL3Object)
+        [self.onipinapL3Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)onipinapL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinapL2PluralElement *onipinapL2PluralElement = [JROnipinapL2PluralElement onipinapL2PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    onipinapL2PluralElement.captureObjectPath = [reader readString];
+    onipinapL2PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinapL3Object")) break;
+                onipinapL2PluralElement.onipinapL3Object = [JROnipinapL3Object onipinapL3ObjectObjectFromArchive:reader];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinapL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinapL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [onipinapL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return onipinapL2PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROnipinapL2PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipinapL2Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -209,7 +375,7 @@
     else
         [self.onipinapL3Object replaceFromDictionary:[dictionary objectForKey:@"onipinapL3Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -217,18 +383,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"onipinapL3Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipinapL2PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"onipinapL2PluralElement"];
 
     if (self.onipinapL3Object)
         [snapshotDictionary setObject:[self.onipinapL3Object snapshotDictionaryFromDirtyPropertySet]
@@ -240,7 +400,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"onipinapL2PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinapL2PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"onipinapL2PluralElement"]];
 
     if ([snapshotDictionary objectForKey:@"onipinapL3Object"])
         [self.onipinapL3Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -253,13 +413,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"onipinapL3Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementOnipinapL3ObjectProperty))
         [dictionary setObject:(self.onipinapL3Object ?
                               [self.onipinapL3Object toUpdateDictionary] :
                               [[JROnipinapL3Object onipinapL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -294,6 +454,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinapL2PluralElementOnipinapL3ObjectProperty))
+    {
+        [writer writeKey:@"onipinapL3Object"];
+        [(self.onipinapL3Object ? self.onipinapL3Object : [JROnipinapL3Object onipinapL3Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.onipinapL3Object needsUpdate])
+    {
+        [writer writeKey:@"onipinapL3Object"];
+        [self.onipinapL3Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"onipinapL3Object"];
+    if (self.onipinapL3Object)
+        [self.onipinapL3Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROnipinapL3Object onipinapL3Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -305,6 +516,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_onipinapL3ObjectJson)
+        [self.onipinapL3Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOnipinapL2PluralElement:(JROnipinapL2PluralElement *)otherOnipinapL2PluralElement
 {
     if (!self.string1 && !otherOnipinapL2PluralElement.string1) /* Keep going... */;
@@ -335,4 +552,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_onipinapL3ObjectJson)
+        _onipinapL3ObjectJsonCleared = YES;
+    else
+        [self.onipinapL3Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROnipinapL2PluralElement class]]) return NO;
+
+    JROnipinapL2PluralElement *otherOnipinapL2PluralElement = (JROnipinapL2PluralElement *)otherObj;
+
+    if (self.onipinapL3Object && ![self.onipinapL3Object isEqualByPrivateProperties:otherOnipinapL2PluralElement.onipinapL3Object])
+        return NO;
+
+    return YES;
+}
+
 @end
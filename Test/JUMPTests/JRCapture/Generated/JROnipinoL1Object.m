@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROnipinoL1Object.h"
 
+enum
+{
+    JROnipinoL1ObjectString1Property,
+    JROnipinoL1ObjectString2Property,
+    JROnipinoL1ObjectPropertyCount
+};
+
+static const char *const JROnipinoL1ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JROnipinoL2PluralElement (JROnipinoL2PluralElement_InternalMethods)
 + (id)onipinoL2PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipinoL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipinoL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipinoL2PluralElement:(JROnipinoL2PluralElement *)otherOnipinoL2PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfOnipinoL2PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipinoL2PluralElement class]])
+            [(JROnipinoL2PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipinoL2PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipinoL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipinoL2PluralElement *element = [JROnipinoL2PluralElement onipinoL2PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredOnipinoL2PluralArray addObject:element];
+    }
+
+    return filteredOnipinoL2PluralArray;
+}
+
+- (void)writeOnipinoL2PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JROnipinoL2PluralElement class]])
+            [(JROnipinoL2PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfOnipinoL2PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredOnipinoL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JROnipinoL2PluralElement *element = [JROnipinoL2PluralElement onipinoL2PluralElementFromArchive:reader];
+        if (element)
+            [filteredOnipinoL2PluralArray addObject:element];
+    }
+
+    return filteredOnipinoL2PluralArray;
+}
 @end
 
 @interface NSArray (OnipinoL1Object_ArrayComparison)
 - (BOOL)isEqualToOnipinoL2PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToOnipinoL2PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (OnipinoL1Object_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToOnipinoL2PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JROnipinoL2PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JROnipinoL1Object ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_onipinoL2Plural;
+    NSArray *_onipinoL2PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROnipinoL1ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROnipinoL1ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinoL1ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinoL1ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)onipinoL2Plural
 {
+    if (_onipinoL2PluralJson)
+    {
+        NSArray *json = _onipinoL2PluralJson;
+        _onipinoL2PluralJson = nil;
+        _onipinoL2Plural = [[json arrayOfOnipinoL2PluralElementsFromOnipinoL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _onipinoL2Plural;
 }
 
 - (void)setOnipinoL2Plural:(NSArray *)newOnipinoL2Plural
 {
+    _onipinoL2PluralJson = nil;
+
     _onipinoL2Plural = [newOnipinoL2Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -209,6 +306,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     onipinoL1Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -217,9 +316,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    onipinoL1Object.onipinoL2Plural =
-        [dictionary objectForKey:@"onipinoL2Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"onipinoL2Plural"] arrayOfOnipinoL2PluralElementsFromOnipinoL2PluralDictionariesWithPath:onipinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipinoL2Plural"] isKindOfClass:[NSArray class]])
+        onipinoL1Object->_onipinoL2PluralJson = [dictionary objectForKey:@"onipinoL2Plural"];
+    else
+        onipinoL1Object.onipinoL2Plural =
+            [dictionary objectForKey:@"onipinoL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"onipinoL2Plural"] arrayOfOnipinoL2PluralElementsFromOnipinoL2PluralDictionariesWithPath:onipinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [onipinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -234,11 +336,114 @@
     return [JROnipinoL1Object onipinoL1ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)onipinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinoL1Object *onipinoL1Object = [JROnipinoL1Object onipinoL1Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinoL2Plural")) break;
+                if (!lazily)
+                    onipinoL1Object.onipinoL2Plural = [NSArray arrayOfOnipinoL2PluralElementsFromJsonReader:reader withPath:onipinoL1Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    onipinoL1Object->_onipinoL2PluralJson = value;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [onipinoL1Object.dirtyPropertySet removeAllObjects];
+
+    return onipinoL1Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"onipinoL2Plural"];
+    if (self.onipinoL2Plural)
+        [self.onipinoL2Plural writeOnipinoL2PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)onipinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinoL1Object *onipinoL1Object = [JROnipinoL1Object onipinoL1Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    onipinoL1Object.captureObjectPath = [reader readString];
+    onipinoL1Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinoL2Plural")) break;
+                onipinoL1Object.onipinoL2Plural = [NSArray arrayOfOnipinoL2PluralElementsFromArchive:reader];
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [onipinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return onipinoL1Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROnipinoL1ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -254,7 +459,7 @@
         [dictionary objectForKey:@"onipinoL2Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"onipinoL2Plural"] arrayOfOnipinoL2PluralElementsFromOnipinoL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -262,18 +467,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipinoL1Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"onipinoL1Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -281,7 +480,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"onipinoL1Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinoL1Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"onipinoL1Object"]];
 
 }
 
@@ -290,10 +489,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL1ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL1ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -322,6 +521,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL1ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL1ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"onipinoL2Plural"];
+    [(self.onipinoL2Plural ? self.onipinoL2Plural : [NSArray array]) writeReplaceJsonOfOnipinoL2PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replaceOnipinoL2PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.onipinoL2Plural named:@"onipinoL2Plural" isArrayOfStrings:NO
@@ -336,6 +572,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.onipinoL2Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToOnipinoL1Object:(JROnipinoL1Object *)otherOnipinoL1Object
 {
     if (!self.string1 && !otherOnipinoL1Object.string1) /* Keep going... */;
@@ -366,4 +609,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROnipinoL1Object class]]) return NO;
+
+    JROnipinoL1Object *otherOnipinoL1Object = (JROnipinoL1Object *)otherObj;
+
+    if (self.onipinoL2Plural && ![self.onipinoL2Plural isEqualByPrivatePropertiesToOnipinoL2PluralArray:otherOnipinoL1Object.onipinoL2Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JROnipinoL2PluralElement.h"
 
+enum
+{
+    JROnipinoL2PluralElementString1Property,
+    JROnipinoL2PluralElementString2Property,
+    JROnipinoL2PluralElementOnipinoL3ObjectProperty,
+    JROnipinoL2PluralElementPropertyCount
+};
+
+static const char *const JROnipinoL2PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "onipinoL3Object",
+};
+
 @interface JROnipinoL3Object (JROnipinoL3Object_InternalMethods)
 + (id)onipinoL3ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)onipinoL3ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)onipinoL3ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToOnipinoL3Object:(JROnipinoL3Object *)otherOnipinoL3Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JROnipinoL3Object *_onipinoL3Object;
+    NSDictionary *_onipinoL3ObjectJson;
+    BOOL _onipinoL3ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JROnipinoL2PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROnipinoL2PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JROnipinoL3Object *)onipinoL3Object
 {
+    if (_onipinoL3ObjectJson)
+    {
+        NSDictionary *json = _onipinoL3ObjectJson;
+        _onipinoL3ObjectJson = nil;
+        _onipinoL3Object = [JROnipinoL3Object onipinoL3ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_onipinoL3ObjectJsonCleared)
+            [_onipinoL3Object deepClearDirtyProperties];
+        else
+            [_onipinoL3Object setAllPropertiesToDirty];
+    }
+
     return _onipinoL3Object;
 }
 
 - (void)setOnipinoL3Object:(JROnipinoL3Object *)newOnipinoL3Object
 {
-    [self.dirtyPropertySet addObject:@"onipinoL3Object"];
+    _onipinoL3ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementOnipinoL3ObjectProperty);
 
     _onipinoL3Object = newOnipinoL3Object;
 
@@ -104,7 +147,7 @@
 
         _onipinoL3Object = [[JROnipinoL3Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -160,6 +203,8 @@
         onipinoL2PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     onipinoL2PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -168,9 +213,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    onipinoL2PluralElement.onipinoL3Object =
-        [dictionary objectForKey:@"onipinoL3Object"] != [NSNull null] ? 
-        [JROnipinoL3Object onipinoL3ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinoL3Object"] withPath:onipinoL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"onipinoL3Object"] isKindOfClass:[NSDictionary class]])
+        onipinoL2PluralElement->_onipinoL3ObjectJson = [dictionary objectForKey:@"onipinoL3Object"];
+    else
+        onipinoL2PluralElement.onipinoL3Object =
+            [dictionary objectForKey:@"onipinoL3Object"] != [NSNull null] ? 
+            [JROnipinoL3Object onipinoL3ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinoL3Object"] withPath:onipinoL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [onipinoL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -185,11 +233,129 @@
     return [JROnipinoL2PluralElement onipinoL2PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)onipinoL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinoL2PluralElement *onipinoL2PluralElement = [JROnipinoL2PluralElement onipinoL2PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinoL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinoL3Object")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"onipinoL3Object"];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinoL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    onipinoL2PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipinoL2Plural", (long)elementId];
+    onipinoL2PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"onipinoL3Object"] isKindOfClass:[NSDictionary class]])
+        onipinoL2PluralElement->_onipinoL3ObjectJson = [dictionary objectForKey:@"onipinoL3Object"];
+    else
+        onipinoL2PluralElement.onipinoL3Object =
+            [dictionary objectForKey:@"onipinoL3Object"] != [NSNull null] ? 
+            [JROnipinoL3Object onipinoL3ObjectObjectFromDictionary:[dictionary objectForKey:@"onipinoL3Object"] withPath:onipinoL2PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [onipinoL2PluralElement.dirtyPropertySet removeAllObjects];
+
+    return onipinoL2PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"onipinoL3Object"];
+    if (self.onipinoL3Object)
+        [self.onipinoL3Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)onipinoL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JROnipinoL2PluralElement *onipinoL2PluralElement = [JROnipinoL2PluralElement onipinoL2PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    onipinoL2PluralElement.captureObjectPath = [reader readString];
+    onipinoL2PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                onipinoL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "onipinoL3Object")) break;
+                onipinoL2PluralElement.onipinoL3Object = [JROnipinoL3Object onipinoL3ObjectObjectFromArchive:reader];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                onipinoL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [onipinoL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return onipinoL2PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JROnipinoL2PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"onipinoL2Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -209,7 +375,7 @@
     else
         [self.onipinoL3Object replaceFromDictionary:[dictionary objectForKey:@"onipinoL3Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -217,18 +383,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"onipinoL3Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipinoL2PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"onipinoL2PluralElement"];
 
     if (self.onipinoL3Object)
         [snapshotDictionary setObject:[self.onipinoL3Object snapshotDictionaryFromDirtyPropertySet]
@@ -240,7 +400,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"onipinoL2PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinoL2PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"onipinoL2PluralElement"]];
 
     if ([snapshotDictionary objectForKey:@"onipinoL3Object"])
         [self.onipinoL3Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -253,13 +413,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"onipinoL3Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementOnipinoL3ObjectProperty))
         [dictionary setObject:(self.onipinoL3Object ?
                               [self.onipinoL3Object toUpdateDictionary] :
                               [[JROnipinoL3Object onipinoL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -294,6 +454,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JROnipinoL2PluralElementOnipinoL3ObjectProperty))
+    {
+        [writer writeKey:@"onipinoL3Object"];
+        [(self.onipinoL3Object ? self.onipinoL3Object : [JROnipinoL3Object onipinoL3Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.onipinoL3Object needsUpdate])
+    {
+        [writer writeKey:@"onipinoL3Object"];
+        [self.onipinoL3Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"onipinoL3Object"];
+    if (self.onipinoL3Object)
+        [self.onipinoL3Object writeReplaceJsonToWriter:writer];
+    else
+        [[JROnipinoL3Object onipinoL3Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -305,6 +516,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_onipinoL3ObjectJson)
+        [self.onipinoL3Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToOnipinoL2PluralElement:(JROnipinoL2PluralElement *)otherOnipinoL2PluralElement
 {
     if (!self.string1 && !otherOnipinoL2PluralElement.string1) /* Keep going... */;
@@ -335,4 +552,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_onipinoL3ObjectJson)
+        _onipinoL3ObjectJsonCleared = YES;
+    else
+        [self.onipinoL3Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JROnipinoL2PluralElement class]]) return NO;
+
+    JROnipinoL2PluralElement *otherOnipinoL2PluralElement = (JROnipinoL2PluralElement *)otherObj;
+
+    if (self.onipinoL3Object && ![self.onipinoL3Object isEqualByPrivateProperties:otherOnipinoL2PluralElement.onipinoL3Object])
+        return NO;
+
+    return YES;
+}
+
 @end
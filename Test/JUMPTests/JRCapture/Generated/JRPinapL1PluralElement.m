@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinapL1PluralElement.h"
 
+enum
+{
+    JRPinapL1PluralElementString1Property,
+    JRPinapL1PluralElementString2Property,
+    JRPinapL1PluralElementPropertyCount
+};
+
+static const char *const JRPinapL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinapL2PluralElement (JRPinapL2PluralElement_InternalMethods)
 + (id)pinapL2PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapL2PluralElement:(JRPinapL2PluralElement *)otherPinapL2PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapL2PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapL2PluralElement class]])
+            [(JRPinapL2PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapL2PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapL2PluralElement *element = [JRPinapL2PluralElement pinapL2PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapL2PluralArray addObject:element];
+    }
+
+    return filteredPinapL2PluralArray;
+}
+
+- (void)writePinapL2PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapL2PluralElement class]])
+            [(JRPinapL2PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapL2PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapL2PluralElement *element = [JRPinapL2PluralElement pinapL2PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapL2PluralArray addObject:element];
+    }
+
+    return filteredPinapL2PluralArray;
+}
 @end
 
 @interface NSArray (PinapL1PluralElement_ArrayComparison)
 - (BOOL)isEqualToPinapL2PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapL2PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinapL1PluralElement_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinapL2PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapL2PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinapL1PluralElement ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinapL2Plural;
+    NSArray *_pinapL2PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinapL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinapL1PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapL1PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapL1PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinapL2Plural
 {
+    if (_pinapL2PluralJson)
+    {
+        NSArray *json = _pinapL2PluralJson;
+        _pinapL2PluralJson = nil;
+        _pinapL2Plural = [[json arrayOfPinapL2PluralElementsFromPinapL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapL2Plural;
 }
 
 - (void)setPinapL2Plural:(NSArray *)newPinapL2Plural
 {
+    _pinapL2PluralJson = nil;
+
     _pinapL2Plural = [newPinapL2Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,6 +312,8 @@
         pinapL1PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinapL1PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -223,9 +322,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinapL1PluralElement.pinapL2Plural =
-        [dictionary objectForKey:@"pinapL2Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapL2Plural"] arrayOfPinapL2PluralElementsFromPinapL2PluralDictionariesWithPath:pinapL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapL2Plural"] isKindOfClass:[NSArray class]])
+        pinapL1PluralElement->_pinapL2PluralJson = [dictionary objectForKey:@"pinapL2Plural"];
+    else
+        pinapL1PluralElement.pinapL2Plural =
+            [dictionary objectForKey:@"pinapL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapL2Plural"] arrayOfPinapL2PluralElementsFromPinapL2PluralDictionariesWithPath:pinapL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinapL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -240,11 +342,129 @@
     return [JRPinapL1PluralElement pinapL1PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinapL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapL1PluralElement *pinapL1PluralElement = [JRPinapL1PluralElement pinapL1PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapL2Plural")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"pinapL2Plural"];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    pinapL1PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapL1Plural", (long)elementId];
+    pinapL1PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"pinapL2Plural"] isKindOfClass:[NSArray class]])
+        pinapL1PluralElement->_pinapL2PluralJson = [dictionary objectForKey:@"pinapL2Plural"];
+    else
+        pinapL1PluralElement.pinapL2Plural =
+            [dictionary objectForKey:@"pinapL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapL2Plural"] arrayOfPinapL2PluralElementsFromPinapL2PluralDictionariesWithPath:pinapL1PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [pinapL1PluralElement.dirtyPropertySet removeAllObjects];
+
+    return pinapL1PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinapL2Plural"];
+    if (self.pinapL2Plural)
+        [self.pinapL2Plural writePinapL2PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinapL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapL1PluralElement *pinapL1PluralElement = [JRPinapL1PluralElement pinapL1PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinapL1PluralElement.captureObjectPath = [reader readString];
+    pinapL1PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapL2Plural")) break;
+                pinapL1PluralElement.pinapL2Plural = [NSArray arrayOfPinapL2PluralElementsFromArchive:reader];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinapL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinapL1PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinapL1PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapL1Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -261,7 +481,7 @@
         [dictionary objectForKey:@"pinapL2Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinapL2Plural"] arrayOfPinapL2PluralElementsFromPinapL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -269,18 +489,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinapL1PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinapL1PluralElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -288,7 +502,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinapL1PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapL1PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinapL1PluralElement"]];
 
 }
 
@@ -297,10 +511,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapL1PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapL1PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -329,6 +543,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapL1PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapL1PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinapL2Plural"];
+    [(self.pinapL2Plural ? self.pinapL2Plural : [NSArray array]) writeReplaceJsonOfPinapL2PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinapL2PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinapL2Plural named:@"pinapL2Plural" isArrayOfStrings:NO
@@ -343,6 +594,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapL2Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinapL1PluralElement:(JRPinapL1PluralElement *)otherPinapL1PluralElement
 {
     if (!self.string1 && !otherPinapL1PluralElement.string1) /* Keep going... */;
@@ -373,4 +631,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinapL1PluralElement class]]) return NO;
+
+    JRPinapL1PluralElement *otherPinapL1PluralElement = (JRPinapL1PluralElement *)otherObj;
+
+    if (self.pinapL2Plural && ![self.pinapL2Plural isEqualByPrivatePropertiesToPinapL2PluralArray:otherPinapL1PluralElement.pinapL2Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
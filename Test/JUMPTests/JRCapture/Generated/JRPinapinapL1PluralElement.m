@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinapinapL1PluralElement.h"
 
+enum
+{
+    JRPinapinapL1PluralElementString1Property,
+    JRPinapinapL1PluralElementString2Property,
+    JRPinapinapL1PluralElementPropertyCount
+};
+
+static const char *const JRPinapinapL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinapinapL2PluralElement (JRPinapinapL2PluralElement_InternalMethods)
 + (id)pinapinapL2PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapinapL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapinapL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapinapL2PluralElement:(JRPinapinapL2PluralElement *)otherPinapinapL2PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapinapL2PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinapL2PluralElement class]])
+            [(JRPinapinapL2PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinapL2PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinapL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinapL2PluralElement *element = [JRPinapinapL2PluralElement pinapinapL2PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapinapL2PluralArray addObject:element];
+    }
+
+    return filteredPinapinapL2PluralArray;
+}
+
+- (void)writePinapinapL2PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinapL2PluralElement class]])
+            [(JRPinapinapL2PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinapL2PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinapL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinapL2PluralElement *element = [JRPinapinapL2PluralElement pinapinapL2PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapinapL2PluralArray addObject:element];
+    }
+
+    return filteredPinapinapL2PluralArray;
+}
 @end
 
 @interface NSArray (PinapinapL1PluralElement_ArrayComparison)
 - (BOOL)isEqualToPinapinapL2PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapinapL2PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinapinapL1PluralElement_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinapinapL2PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapinapL2PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinapinapL1PluralElement ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinapinapL2Plural;
+    NSArray *_pinapinapL2PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinapinapL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinapinapL1PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinapL1PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinapL1PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinapinapL2Plural
 {
+    if (_pinapinapL2PluralJson)
+    {
+        NSArray *json = _pinapinapL2PluralJson;
+        _pinapinapL2PluralJson = nil;
+        _pinapinapL2Plural = [[json arrayOfPinapinapL2PluralElementsFromPinapinapL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapinapL2Plural;
 }
 
 - (void)setPinapinapL2Plural:(NSArray *)newPinapinapL2Plural
 {
+    _pinapinapL2PluralJson = nil;
+
     _pinapinapL2Plural = [newPinapinapL2Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,6 +312,8 @@
         pinapinapL1PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinapinapL1PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -223,9 +322,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinapinapL1PluralElement.pinapinapL2Plural =
-        [dictionary objectForKey:@"pinapinapL2Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapinapL2Plural"] arrayOfPinapinapL2PluralElementsFromPinapinapL2PluralDictionariesWithPath:pinapinapL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapinapL2Plural"] isKindOfClass:[NSArray class]])
+        pinapinapL1PluralElement->_pinapinapL2PluralJson = [dictionary objectForKey:@"pinapinapL2Plural"];
+    else
+        pinapinapL1PluralElement.pinapinapL2Plural =
+            [dictionary objectForKey:@"pinapinapL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinapL2Plural"] arrayOfPinapinapL2PluralElementsFromPinapinapL2PluralDictionariesWithPath:pinapinapL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinapinapL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -240,11 +342,129 @@
     return [JRPinapinapL1PluralElement pinapinapL1PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinapinapL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinapL1PluralElement *pinapinapL1PluralElement = [JRPinapinapL1PluralElement pinapinapL1PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinapL2Plural")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"pinapinapL2Plural"];
+                continue;
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinapL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinapL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    pinapinapL1PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapinapL1Plural", (long)elementId];
+    pinapinapL1PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"pinapinapL2Plural"] isKindOfClass:[NSArray class]])
+        pinapinapL1PluralElement->_pinapinapL2PluralJson = [dictionary objectForKey:@"pinapinapL2Plural"];
+    else
+        pinapinapL1PluralElement.pinapinapL2Plural =
+            [dictionary objectForKey:@"pinapinapL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinapL2Plural"] arrayOfPinapinapL2PluralElementsFromPinapinapL2PluralDictionariesWithPath:pinapinapL1PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [pinapinapL1PluralElement.dirtyPropertySet removeAllObjects];
+
+    return pinapinapL1PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinapinapL2Plural"];
+    if (self.pinapinapL2Plural)
+        [self.pinapinapL2Plural writePinapinapL2PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinapinapL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinapL1PluralElement *pinapinapL1PluralElement = [JRPinapinapL1PluralElement pinapinapL1PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinapinapL1PluralElement.captureObjectPath = [reader readString];
+    pinapinapL1PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinapL2Plural")) break;
+                pinapinapL1PluralElement.pinapinapL2Plural = [NSArray arrayOfPinapinapL2PluralElementsFromArchive:reader];
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinapL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinapL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinapinapL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinapinapL1PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinapinapL1PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapinapL1Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -261,7 +481,7 @@
         [dictionary objectForKey:@"pinapinapL2Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinapinapL2Plural"] arrayOfPinapinapL2PluralElementsFromPinapinapL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -269,18 +489,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinapinapL1PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinapinapL1PluralElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -288,7 +502,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinapinapL1PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinapL1PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinapinapL1PluralElement"]];
 
 }
 
@@ -297,10 +511,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL1PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL1PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -329,6 +543,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL1PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL1PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinapinapL2Plural"];
+    [(self.pinapinapL2Plural ? self.pinapinapL2Plural : [NSArray array]) writeReplaceJsonOfPinapinapL2PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinapinapL2PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinapinapL2Plural named:@"pinapinapL2Plural" isArrayOfStrings:NO
@@ -343,6 +594,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapinapL2Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinapinapL1PluralElement:(JRPinapinapL1PluralElement *)otherPinapinapL1PluralElement
 {
     if (!self.string1 && !otherPinapinapL1PluralElement.string1) /* Keep going... */;
@@ -373,4 +631,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinapinapL1PluralElement class]]) return NO;
+
+    JRPinapinapL1PluralElement *otherPinapinapL1PluralElement = (JRPinapinapL1PluralElement *)otherObj;
+
+    if (self.pinapinapL2Plural && ![self.pinapinapL2Plural isEqualByPrivatePropertiesToPinapinapL2PluralArray:otherPinapinapL1PluralElement.pinapinapL2Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinapinapL2PluralElement.h"
 
+enum
+{
+    JRPinapinapL2PluralElementString1Property,
+    JRPinapinapL2PluralElementString2Property,
+    JRPinapinapL2PluralElementPropertyCount
+};
+
+static const char *const JRPinapinapL2PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinapinapL3PluralElement (JRPinapinapL3PluralElement_InternalMethods)
 + (id)pinapinapL3PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapinapL3PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapinapL3PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapinapL3PluralElement:(JRPinapinapL3PluralElement *)otherPinapinapL3PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapinapL3PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinapL3PluralElement class]])
+            [(JRPinapinapL3PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinapL3PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinapL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinapL3PluralElement *element = [JRPinapinapL3PluralElement pinapinapL3PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapinapL3PluralArray addObject:element];
+    }
+
+    return filteredPinapinapL3PluralArray;
+}
+
+- (void)writePinapinapL3PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinapL3PluralElement class]])
+            [(JRPinapinapL3PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinapL3PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinapL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinapL3PluralElement *element = [JRPinapinapL3PluralElement pinapinapL3PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapinapL3PluralArray addObject:element];
+    }
+
+    return filteredPinapinapL3PluralArray;
+}
 @end
 
 @interface NSArray (PinapinapL2PluralElement_ArrayComparison)
 - (BOOL)isEqualToPinapinapL3PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapinapL3PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinapinapL2PluralElement_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinapinapL3PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapinapL3PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinapinapL2PluralElement ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinapinapL3Plural;
+    NSArray *_pinapinapL3PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinapinapL2PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinapinapL2PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinapL2PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinapL2PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinapinapL3Plural
 {
+    if (_pinapinapL3PluralJson)
+    {
+        NSArray *json = _pinapinapL3PluralJson;
+        _pinapinapL3PluralJson = nil;
+        _pinapinapL3Plural = [[json arrayOfPinapinapL3PluralElementsFromPinapinapL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapinapL3Plural;
 }
 
 - (void)setPinapinapL3Plural:(NSArray *)newPinapinapL3Plural
 {
+    _pinapinapL3PluralJson = nil;
+
     _pinapinapL3Plural = [newPinapinapL3Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,6 +312,8 @@
         pinapinapL2PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinapinapL2PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -223,9 +322,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinapinapL2PluralElement.pinapinapL3Plural =
-        [dictionary objectForKey:@"pinapinapL3Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapinapL3Plural"] arrayOfPinapinapL3PluralElementsFromPinapinapL3PluralDictionariesWithPath:pinapinapL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapinapL3Plural"] isKindOfClass:[NSArray class]])
+        pinapinapL2PluralElement->_pinapinapL3PluralJson = [dictionary objectForKey:@"pinapinapL3Plural"];
+    else
+        pinapinapL2PluralElement.pinapinapL3Plural =
+            [dictionary objectForKey:@"pinapinapL3Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinapL3Plural"] arrayOfPinapinapL3PluralElementsFromPinapinapL3PluralDictionariesWithPath:pinapinapL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinapinapL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -240,11 +342,129 @@
     return [JRPinapinapL2PluralElement pinapinapL2PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinapinapL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinapL2PluralElement *pinapinapL2PluralElement = [JRPinapinapL2PluralElement pinapinapL2PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 1:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinapL3Plural")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"pinapinapL3Plural"];
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinapL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinapL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    pinapinapL2PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapinapL2Plural", (long)elementId];
+    pinapinapL2PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"pinapinapL3Plural"] isKindOfClass:[NSArray class]])
+        pinapinapL2PluralElement->_pinapinapL3PluralJson = [dictionary objectForKey:@"pinapinapL3Plural"];
+    else
+        pinapinapL2PluralElement.pinapinapL3Plural =
+            [dictionary objectForKey:@"pinapinapL3Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinapL3Plural"] arrayOfPinapinapL3PluralElementsFromPinapinapL3PluralDictionariesWithPath:pinapinapL2PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [pinapinapL2PluralElement.dirtyPropertySet removeAllObjects];
+
+    return pinapinapL2PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinapinapL3Plural"];
+    if (self.pinapinapL3Plural)
+        [self.pinapinapL3Plural writePinapinapL3PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinapinapL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinapL2PluralElement *pinapinapL2PluralElement = [JRPinapinapL2PluralElement pinapinapL2PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinapinapL2PluralElement.captureObjectPath = [reader readString];
+    pinapinapL2PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinapL3Plural")) break;
+                pinapinapL2PluralElement.pinapinapL3Plural = [NSArray arrayOfPinapinapL3PluralElementsFromArchive:reader];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinapL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinapL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinapinapL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinapinapL2PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinapinapL2PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapinapL2Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -261,7 +481,7 @@
         [dictionary objectForKey:@"pinapinapL3Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinapinapL3Plural"] arrayOfPinapinapL3PluralElementsFromPinapinapL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -269,18 +489,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinapinapL2PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinapinapL2PluralElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -288,7 +502,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinapinapL2PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinapL2PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinapinapL2PluralElement"]];
 
 }
 
@@ -297,10 +511,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL2PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL2PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -329,6 +543,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL2PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinapL2PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinapinapL3Plural"];
+    [(self.pinapinapL3Plural ? self.pinapinapL3Plural : [NSArray array]) writeReplaceJsonOfPinapinapL3PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinapinapL3PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinapinapL3Plural named:@"pinapinapL3Plural" isArrayOfStrings:NO
@@ -343,6 +594,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapinapL3Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinapinapL2PluralElement:(JRPinapinapL2PluralElement *)otherPinapinapL2PluralElement
 {
     if (!self.string1 && !otherPinapinapL2PluralElement.string1) /* Keep going... */;
@@ -373,4 +631,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinapinapL2PluralElement class]]) return NO;
+
+    JRPinapinapL2PluralElement *otherPinapinapL2PluralElement = (JRPinapinapL2PluralElement *)otherObj;
+
+    if (self.pinapinapL3Plural && ![self.pinapinapL3Plural isEqualByPrivatePropertiesToPinapinapL3PluralArray:otherPinapinapL2PluralElement.pinapinapL3Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
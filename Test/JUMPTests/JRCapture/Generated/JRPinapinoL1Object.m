@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinapinoL1Object.h"
 
+enum
+{
+    JRPinapinoL1ObjectString1Property,
+    JRPinapinoL1ObjectString2Property,
+    JRPinapinoL1ObjectPropertyCount
+};
+
+static const char *const JRPinapinoL1ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinapinoL2PluralElement (JRPinapinoL2PluralElement_InternalMethods)
 + (id)pinapinoL2PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapinoL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapinoL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapinoL2PluralElement:(JRPinapinoL2PluralElement *)otherPinapinoL2PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapinoL2PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinoL2PluralElement class]])
+            [(JRPinapinoL2PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinoL2PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinoL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinoL2PluralElement *element = [JRPinapinoL2PluralElement pinapinoL2PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapinoL2PluralArray addObject:element];
+    }
+
+    return filteredPinapinoL2PluralArray;
+}
+
+- (void)writePinapinoL2PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinoL2PluralElement class]])
+            [(JRPinapinoL2PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinoL2PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinoL2PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinoL2PluralElement *element = [JRPinapinoL2PluralElement pinapinoL2PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapinoL2PluralArray addObject:element];
+    }
+
+    return filteredPinapinoL2PluralArray;
+}
 @end
 
 @interface NSArray (PinapinoL1Object_ArrayComparison)
 - (BOOL)isEqualToPinapinoL2PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapinoL2PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinapinoL1Object_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinapinoL2PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapinoL2PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinapinoL1Object ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinapinoL2Plural;
+    NSArray *_pinapinoL2PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinapinoL1ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinapinoL1ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinoL1ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinoL1ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinapinoL2Plural
 {
+    if (_pinapinoL2PluralJson)
+    {
+        NSArray *json = _pinapinoL2PluralJson;
+        _pinapinoL2PluralJson = nil;
+        _pinapinoL2Plural = [[json arrayOfPinapinoL2PluralElementsFromPinapinoL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapinoL2Plural;
 }
 
 - (void)setPinapinoL2Plural:(NSArray *)newPinapinoL2Plural
 {
+    _pinapinoL2PluralJson = nil;
+
     _pinapinoL2Plural = [newPinapinoL2Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -209,6 +306,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinapinoL1Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -217,9 +316,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinapinoL1Object.pinapinoL2Plural =
-        [dictionary objectForKey:@"pinapinoL2Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapinoL2Plural"] arrayOfPinapinoL2PluralElementsFromPinapinoL2PluralDictionariesWithPath:pinapinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapinoL2Plural"] isKindOfClass:[NSArray class]])
+        pinapinoL1Object->_pinapinoL2PluralJson = [dictionary objectForKey:@"pinapinoL2Plural"];
+    else
+        pinapinoL1Object.pinapinoL2Plural =
+            [dictionary objectForKey:@"pinapinoL2Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinoL2Plural"] arrayOfPinapinoL2PluralElementsFromPinapinoL2PluralDictionariesWithPath:pinapinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinapinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -234,11 +336,114 @@
     return [JRPinapinoL1Object pinapinoL1ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinapinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinoL1Object *pinapinoL1Object = [JRPinapinoL1Object pinapinoL1Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinoL2Plural")) break;
+                if (!lazily)
+                    pinapinoL1Object.pinapinoL2Plural = [NSArray arrayOfPinapinoL2PluralElementsFromJsonReader:reader withPath:pinapinoL1Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    pinapinoL1Object->_pinapinoL2PluralJson = value;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinapinoL1Object.dirtyPropertySet removeAllObjects];
+
+    return pinapinoL1Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinapinoL2Plural"];
+    if (self.pinapinoL2Plural)
+        [self.pinapinoL2Plural writePinapinoL2PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinapinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinoL1Object *pinapinoL1Object = [JRPinapinoL1Object pinapinoL1Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinapinoL1Object.captureObjectPath = [reader readString];
+    pinapinoL1Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinoL2Plural")) break;
+                pinapinoL1Object.pinapinoL2Plural = [NSArray arrayOfPinapinoL2PluralElementsFromArchive:reader];
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinapinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinapinoL1Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinapinoL1ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -254,7 +459,7 @@
         [dictionary objectForKey:@"pinapinoL2Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinapinoL2Plural"] arrayOfPinapinoL2PluralElementsFromPinapinoL2PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -262,18 +467,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinapinoL1Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinapinoL1Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -281,7 +480,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinapinoL1Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinoL1Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinapinoL1Object"]];
 
 }
 
@@ -290,10 +489,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL1ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL1ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -322,6 +521,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL1ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL1ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinapinoL2Plural"];
+    [(self.pinapinoL2Plural ? self.pinapinoL2Plural : [NSArray array]) writeReplaceJsonOfPinapinoL2PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinapinoL2PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinapinoL2Plural named:@"pinapinoL2Plural" isArrayOfStrings:NO
@@ -336,6 +572,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapinoL2Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinapinoL1Object:(JRPinapinoL1Object *)otherPinapinoL1Object
 {
     if (!self.string1 && !otherPinapinoL1Object.string1) /* Keep going... */;
@@ -366,4 +609,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinapinoL1Object class]]) return NO;
+
+    JRPinapinoL1Object *otherPinapinoL1Object = (JRPinapinoL1Object *)otherObj;
+
+    if (self.pinapinoL2Plural && ![self.pinapinoL2Plural isEqualByPrivatePropertiesToPinapinoL2PluralArray:otherPinapinoL1Object.pinapinoL2Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinapinoL2PluralElement.h"
 
+enum
+{
+    JRPinapinoL2PluralElementString1Property,
+    JRPinapinoL2PluralElementString2Property,
+    JRPinapinoL2PluralElementPropertyCount
+};
+
+static const char *const JRPinapinoL2PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinapinoL3PluralElement (JRPinapinoL3PluralElement_InternalMethods)
 + (id)pinapinoL3PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinapinoL3PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinapinoL3PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinapinoL3PluralElement:(JRPinapinoL3PluralElement *)otherPinapinoL3PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinapinoL3PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinoL3PluralElement class]])
+            [(JRPinapinoL3PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinoL3PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinoL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinoL3PluralElement *element = [JRPinapinoL3PluralElement pinapinoL3PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinapinoL3PluralArray addObject:element];
+    }
+
+    return filteredPinapinoL3PluralArray;
+}
+
+- (void)writePinapinoL3PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinapinoL3PluralElement class]])
+            [(JRPinapinoL3PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinapinoL3PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinapinoL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinapinoL3PluralElement *element = [JRPinapinoL3PluralElement pinapinoL3PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinapinoL3PluralArray addObject:element];
+    }
+
+    return filteredPinapinoL3PluralArray;
+}
 @end
 
 @interface NSArray (PinapinoL2PluralElement_ArrayComparison)
 - (BOOL)isEqualToPinapinoL3PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinapinoL3PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinapinoL2PluralElement_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinapinoL3PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinapinoL3PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinapinoL2PluralElement ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinapinoL3Plural;
+    NSArray *_pinapinoL3PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinapinoL2PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinapinoL2PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinoL2PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinapinoL2PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinapinoL3Plural
 {
+    if (_pinapinoL3PluralJson)
+    {
+        NSArray *json = _pinapinoL3PluralJson;
+        _pinapinoL3PluralJson = nil;
+        _pinapinoL3Plural = [[json arrayOfPinapinoL3PluralElementsFromPinapinoL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinapinoL3Plural;
 }
 
 - (void)setPinapinoL3Plural:(NSArray *)newPinapinoL3Plural
 {
+    _pinapinoL3PluralJson = nil;
+
     _pinapinoL3Plural = [newPinapinoL3Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,6 +312,8 @@
         pinapinoL2PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinapinoL2PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -223,9 +322,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinapinoL2PluralElement.pinapinoL3Plural =
-        [dictionary objectForKey:@"pinapinoL3Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinapinoL3Plural"] arrayOfPinapinoL3PluralElementsFromPinapinoL3PluralDictionariesWithPath:pinapinoL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinapinoL3Plural"] isKindOfClass:[NSArray class]])
+        pinapinoL2PluralElement->_pinapinoL3PluralJson = [dictionary objectForKey:@"pinapinoL3Plural"];
+    else
+        pinapinoL2PluralElement.pinapinoL3Plural =
+            [dictionary objectForKey:@"pinapinoL3Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinoL3Plural"] arrayOfPinapinoL3PluralElementsFromPinapinoL3PluralDictionariesWithPath:pinapinoL2PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinapinoL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -240,11 +342,129 @@
     return [JRPinapinoL2PluralElement pinapinoL2PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinapinoL2PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinoL2PluralElement *pinapinoL2PluralElement = [JRPinapinoL2PluralElement pinapinoL2PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinoL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinoL3Plural")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"pinapinoL3Plural"];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinoL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    pinapinoL2PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapinoL2Plural", (long)elementId];
+    pinapinoL2PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"pinapinoL3Plural"] isKindOfClass:[NSArray class]])
+        pinapinoL2PluralElement->_pinapinoL3PluralJson = [dictionary objectForKey:@"pinapinoL3Plural"];
+    else
+        pinapinoL2PluralElement.pinapinoL3Plural =
+            [dictionary objectForKey:@"pinapinoL3Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinapinoL3Plural"] arrayOfPinapinoL3PluralElementsFromPinapinoL3PluralDictionariesWithPath:pinapinoL2PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [pinapinoL2PluralElement.dirtyPropertySet removeAllObjects];
+
+    return pinapinoL2PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinapinoL3Plural"];
+    if (self.pinapinoL3Plural)
+        [self.pinapinoL3Plural writePinapinoL3PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinapinoL2PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinapinoL2PluralElement *pinapinoL2PluralElement = [JRPinapinoL2PluralElement pinapinoL2PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinapinoL2PluralElement.captureObjectPath = [reader readString];
+    pinapinoL2PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinapinoL2PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "pinapinoL3Plural")) break;
+                pinapinoL2PluralElement.pinapinoL3Plural = [NSArray arrayOfPinapinoL3PluralElementsFromArchive:reader];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinapinoL2PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinapinoL2PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinapinoL2PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinapinoL2PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinapinoL2Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -261,7 +481,7 @@
         [dictionary objectForKey:@"pinapinoL3Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinapinoL3Plural"] arrayOfPinapinoL3PluralElementsFromPinapinoL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -269,18 +489,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinapinoL2PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinapinoL2PluralElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -288,7 +502,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinapinoL2PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinoL2PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinapinoL2PluralElement"]];
 
 }
 
@@ -297,10 +511,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL2PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL2PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -329,6 +543,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL2PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinapinoL2PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinapinoL3Plural"];
+    [(self.pinapinoL3Plural ? self.pinapinoL3Plural : [NSArray array]) writeReplaceJsonOfPinapinoL3PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinapinoL3PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinapinoL3Plural named:@"pinapinoL3Plural" isArrayOfStrings:NO
@@ -343,6 +594,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinapinoL3Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinapinoL2PluralElement:(JRPinapinoL2PluralElement *)otherPinapinoL2PluralElement
 {
     if (!self.string1 && !otherPinapinoL2PluralElement.string1) /* Keep going... */;
@@ -373,4 +631,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinapinoL2PluralElement class]]) return NO;
+
+    JRPinapinoL2PluralElement *otherPinapinoL2PluralElement = (JRPinapinoL2PluralElement *)otherObj;
+
+    if (self.pinapinoL3Plural && ![self.pinapinoL3Plural isEqualByPrivatePropertiesToPinapinoL3PluralArray:otherPinapinoL2PluralElement.pinapinoL3Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
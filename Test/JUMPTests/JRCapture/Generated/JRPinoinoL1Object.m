@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinoinoL1Object.h"
 
+enum
+{
+    JRPinoinoL1ObjectString1Property,
+    JRPinoinoL1ObjectString2Property,
+    JRPinoinoL1ObjectPinoinoL2ObjectProperty,
+    JRPinoinoL1ObjectPropertyCount
+};
+
+static const char *const JRPinoinoL1ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "pinoinoL2Object",
+};
+
 @interface JRPinoinoL2Object (JRPinoinoL2Object_InternalMethods)
 + (id)pinoinoL2ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinoinoL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinoinoL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinoinoL2Object:(JRPinoinoL2Object *)otherPinoinoL2Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JRPinoinoL2Object *_pinoinoL2Object;
+    NSDictionary *_pinoinoL2ObjectJson;
+    BOOL _pinoinoL2ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinoinoL1ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinoinoL1ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JRPinoinoL2Object *)pinoinoL2Object
 {
+    if (_pinoinoL2ObjectJson)
+    {
+        NSDictionary *json = _pinoinoL2ObjectJson;
+        _pinoinoL2ObjectJson = nil;
+        _pinoinoL2Object = [JRPinoinoL2Object pinoinoL2ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_pinoinoL2ObjectJsonCleared)
+            [_pinoinoL2Object deepClearDirtyProperties];
+        else
+            [_pinoinoL2Object setAllPropertiesToDirty];
+    }
+
     return _pinoinoL2Object;
 }
 
 - (void)setPinoinoL2Object:(JRPinoinoL2Object *)newPinoinoL2Object
 {
-    [self.dirtyPropertySet addObject:@"pinoinoL2Object"];
+    _pinoinoL2ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectPinoinoL2ObjectProperty);
 
     _pinoinoL2Object = newPinoinoL2Object;
 
@@ -104,7 +147,7 @@
 
         _pinoinoL2Object = [[JRPinoinoL2Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -154,6 +197,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinoinoL1Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -162,9 +207,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinoinoL1Object.pinoinoL2Object =
-        [dictionary objectForKey:@"pinoinoL2Object"] != [NSNull null] ? 
-        [JRPinoinoL2Object pinoinoL2ObjectObjectFromDictionary:[dictionary objectForKey:@"pinoinoL2Object"] withPath:pinoinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinoinoL2Object"] isKindOfClass:[NSDictionary class]])
+        pinoinoL1Object->_pinoinoL2ObjectJson = [dictionary objectForKey:@"pinoinoL2Object"];
+    else
+        pinoinoL1Object.pinoinoL2Object =
+            [dictionary objectForKey:@"pinoinoL2Object"] != [NSNull null] ? 
+            [JRPinoinoL2Object pinoinoL2ObjectObjectFromDictionary:[dictionary objectForKey:@"pinoinoL2Object"] withPath:pinoinoL1Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinoinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -179,11 +227,116 @@
     return [JRPinoinoL1Object pinoinoL1ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinoinoL1ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinoinoL1Object *pinoinoL1Object = [JRPinoinoL1Object pinoinoL1Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    pinoinoL1Object.pinoinoL2Object = nil;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 15)
+        {
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoinoL2Object")) break;
+                if (!lazily)
+                    pinoinoL1Object.pinoinoL2Object = [JRPinoinoL2Object pinoinoL2ObjectObjectFromJsonReader:reader withPath:pinoinoL1Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSDictionary class]])
+                    pinoinoL1Object->_pinoinoL2ObjectJson = value;
+                continue;
+            case 11:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinoinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinoinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinoinoL1Object.dirtyPropertySet removeAllObjects];
+
+    return pinoinoL1Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinoinoL2Object"];
+    if (self.pinoinoL2Object)
+        [self.pinoinoL2Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinoinoL1ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinoinoL1Object *pinoinoL1Object = [JRPinoinoL1Object pinoinoL1Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinoinoL1Object.captureObjectPath = [reader readString];
+    pinoinoL1Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 15)
+        {
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoinoL2Object")) break;
+                pinoinoL1Object.pinoinoL2Object = [JRPinoinoL2Object pinoinoL2ObjectObjectFromArchive:reader];
+                continue;
+            case 11:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinoinoL1Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 14:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinoinoL1Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinoinoL1Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinoinoL1Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinoinoL1ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -202,7 +355,7 @@
     else
         [self.pinoinoL2Object replaceFromDictionary:[dictionary objectForKey:@"pinoinoL2Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -210,18 +363,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"pinoinoL2Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinoinoL1Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinoinoL1Object"];
 
     if (self.pinoinoL2Object)
         [snapshotDictionary setObject:[self.pinoinoL2Object snapshotDictionaryFromDirtyPropertySet]
@@ -233,7 +380,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinoinoL1Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinoinoL1Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinoinoL1Object"]];
 
     if ([snapshotDictionary objectForKey:@"pinoinoL2Object"])
         [self.pinoinoL2Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -246,13 +393,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"pinoinoL2Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectPinoinoL2ObjectProperty))
         [dictionary setObject:(self.pinoinoL2Object ?
                               [self.pinoinoL2Object toUpdateDictionary] :
                               [[JRPinoinoL2Object pinoinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -287,6 +434,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL1ObjectPinoinoL2ObjectProperty))
+    {
+        [writer writeKey:@"pinoinoL2Object"];
+        [(self.pinoinoL2Object ? self.pinoinoL2Object : [JRPinoinoL2Object pinoinoL2Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.pinoinoL2Object needsUpdate])
+    {
+        [writer writeKey:@"pinoinoL2Object"];
+        [self.pinoinoL2Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinoinoL2Object"];
+    if (self.pinoinoL2Object)
+        [self.pinoinoL2Object writeReplaceJsonToWriter:writer];
+    else
+        [[JRPinoinoL2Object pinoinoL2Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -298,6 +496,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_pinoinoL2ObjectJson)
+        [self.pinoinoL2Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToPinoinoL1Object:(JRPinoinoL1Object *)otherPinoinoL1Object
 {
     if (!self.string1 && !otherPinoinoL1Object.string1) /* Keep going... */;
@@ -328,4 +532,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_pinoinoL2ObjectJson)
+        _pinoinoL2ObjectJsonCleared = YES;
+    else
+        [self.pinoinoL2Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinoinoL1Object class]]) return NO;
+
+    JRPinoinoL1Object *otherPinoinoL1Object = (JRPinoinoL1Object *)otherObj;
+
+    if (self.pinoinoL2Object && ![self.pinoinoL2Object isEqualByPrivateProperties:otherPinoinoL1Object.pinoinoL2Object])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinoinoL2Object.h"
 
+enum
+{
+    JRPinoinoL2ObjectString1Property,
+    JRPinoinoL2ObjectString2Property,
+    JRPinoinoL2ObjectPropertyCount
+};
+
+static const char *const JRPinoinoL2ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinoinoL3PluralElement (JRPinoinoL3PluralElement_InternalMethods)
 + (id)pinoinoL3PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinoinoL3PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinoinoL3PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinoinoL3PluralElement:(JRPinoinoL3PluralElement *)otherPinoinoL3PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinoinoL3PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinoinoL3PluralElement class]])
+            [(JRPinoinoL3PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinoinoL3PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinoinoL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinoinoL3PluralElement *element = [JRPinoinoL3PluralElement pinoinoL3PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinoinoL3PluralArray addObject:element];
+    }
+
+    return filteredPinoinoL3PluralArray;
+}
+
+- (void)writePinoinoL3PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinoinoL3PluralElement class]])
+            [(JRPinoinoL3PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinoinoL3PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinoinoL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinoinoL3PluralElement *element = [JRPinoinoL3PluralElement pinoinoL3PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinoinoL3PluralArray addObject:element];
+    }
+
+    return filteredPinoinoL3PluralArray;
+}
 @end
 
 @interface NSArray (PinoinoL2Object_ArrayComparison)
 - (BOOL)isEqualToPinoinoL3PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinoinoL3PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinoinoL2Object_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinoinoL3PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinoinoL3PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinoinoL2Object ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinoinoL3Plural;
+    NSArray *_pinoinoL3PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinoinoL2ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinoinoL2ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinoinoL2ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinoinoL2ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinoinoL3Plural
 {
+    if (_pinoinoL3PluralJson)
+    {
+        NSArray *json = _pinoinoL3PluralJson;
+        _pinoinoL3PluralJson = nil;
+        _pinoinoL3Plural = [[json arrayOfPinoinoL3PluralElementsFromPinoinoL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinoinoL3Plural;
 }
 
 - (void)setPinoinoL3Plural:(NSArray *)newPinoinoL3Plural
 {
+    _pinoinoL3PluralJson = nil;
+
     _pinoinoL3Plural = [newPinoinoL3Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture = YES;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -209,6 +306,8 @@
                                                               nil : [dictionary objectForKey:@"captureObjectPath"]);
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinoinoL2Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -217,9 +316,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinoinoL2Object.pinoinoL3Plural =
-        [dictionary objectForKey:@"pinoinoL3Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinoinoL3Plural"] arrayOfPinoinoL3PluralElementsFromPinoinoL3PluralDictionariesWithPath:pinoinoL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinoinoL3Plural"] isKindOfClass:[NSArray class]])
+        pinoinoL2Object->_pinoinoL3PluralJson = [dictionary objectForKey:@"pinoinoL3Plural"];
+    else
+        pinoinoL2Object.pinoinoL3Plural =
+            [dictionary objectForKey:@"pinoinoL3Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinoinoL3Plural"] arrayOfPinoinoL3PluralElementsFromPinoinoL3PluralDictionariesWithPath:pinoinoL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinoinoL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -234,11 +336,114 @@
     return [JRPinoinoL2Object pinoinoL2ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinoinoL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinoinoL2Object *pinoinoL2Object = [JRPinoinoL2Object pinoinoL2Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoinoL3Plural")) break;
+                if (!lazily)
+                    pinoinoL2Object.pinoinoL3Plural = [NSArray arrayOfPinoinoL3PluralElementsFromJsonReader:reader withPath:pinoinoL2Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    pinoinoL2Object->_pinoinoL3PluralJson = value;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinoinoL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinoinoL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinoinoL2Object.dirtyPropertySet removeAllObjects];
+
+    return pinoinoL2Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinoinoL3Plural"];
+    if (self.pinoinoL3Plural)
+        [self.pinoinoL3Plural writePinoinoL3PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinoinoL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinoinoL2Object *pinoinoL2Object = [JRPinoinoL2Object pinoinoL2Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinoinoL2Object.captureObjectPath = [reader readString];
+    pinoinoL2Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinoinoL3Plural")) break;
+                pinoinoL2Object.pinoinoL3Plural = [NSArray arrayOfPinoinoL3PluralElementsFromArchive:reader];
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinoinoL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinoinoL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinoinoL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinoinoL2Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinoinoL2ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
 
@@ -254,7 +459,7 @@
         [dictionary objectForKey:@"pinoinoL3Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinoinoL3Plural"] arrayOfPinoinoL3PluralElementsFromPinoinoL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -262,18 +467,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinoinoL2Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinoinoL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -281,7 +480,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinoinoL2Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinoinoL2Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinoinoL2Object"]];
 
 }
 
@@ -290,10 +489,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL2ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL2ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -322,6 +521,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL2ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinoinoL2ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinoinoL3Plural"];
+    [(self.pinoinoL3Plural ? self.pinoinoL3Plural : [NSArray array]) writeReplaceJsonOfPinoinoL3PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinoinoL3PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinoinoL3Plural named:@"pinoinoL3Plural" isArrayOfStrings:NO
@@ -336,6 +572,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinoinoL3Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinoinoL2Object:(JRPinoinoL2Object *)otherPinoinoL2Object
 {
     if (!self.string1 && !otherPinoinoL2Object.string1) /* Keep going... */;
@@ -366,4 +609,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinoinoL2Object class]]) return NO;
+
+    JRPinoinoL2Object *otherPinoinoL2Object = (JRPinoinoL2Object *)otherObj;
+
+    if (self.pinoinoL3Plural && ![self.pinoinoL3Plural isEqualByPrivatePropertiesToPinoinoL3PluralArray:otherPinoinoL2Object.pinoinoL3Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,8 +40,25 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinonipL1PluralElement.h"
 
+enum
+{
+    JRPinonipL1PluralElementString1Property,
+    JRPinonipL1PluralElementString2Property,
+    JRPinonipL1PluralElementPinonipL2ObjectProperty,
+    JRPinonipL1PluralElementPropertyCount
+};
+
+static const char *const JRPinonipL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "pinonipL2Object",
+};
+
 @interface JRPinonipL2Object (JRPinonipL2Object_InternalMethods)
 + (id)pinonipL2ObjectObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinonipL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinonipL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinonipL2Object:(JRPinonipL2Object *)otherPinonipL2Object;
 @end
 
@@ -54,9 +71,21 @@
     NSString *_string1;
     NSString *_string2;
     JRPinonipL2Object *_pinonipL2Object;
+    NSDictionary *_pinonipL2ObjectJson;
+    BOOL _pinonipL2ObjectJsonCleared;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinonipL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinonipL1PluralElementPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -64,7 +93,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -76,19 +105,33 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (JRPinonipL2Object *)pinonipL2Object
 {
+    if (_pinonipL2ObjectJson)
+    {
+        NSDictionary *json = _pinonipL2ObjectJson;
+        _pinonipL2ObjectJson = nil;
+        _pinonipL2Object = [JRPinonipL2Object pinonipL2ObjectObjectFromDictionary:json withPath:self.captureObjectPath fromDecoder:NO];
+
+        if (_pinonipL2ObjectJsonCleared)
+            [_pinonipL2Object deepClearDirtyProperties];
+        else
+            [_pinonipL2Object setAllPropertiesToDirty];
+    }
+
     return _pinonipL2Object;
 }
 
 - (void)setPinonipL2Object:(JRPinonipL2Object *)newPinonipL2Object
 {
-    [self.dirtyPropertySet addObject:@"pinonipL2Object"];
+    _pinonipL2ObjectJson = nil;
+
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementPinonipL2ObjectProperty);
 
     _pinonipL2Object = newPinonipL2Object;
 
@@ -104,7 +147,7 @@
 
         _pinonipL2Object = [[JRPinonipL2Object alloc] init];
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -160,6 +203,8 @@
         pinonipL1PluralElement.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinonipL1PluralElement.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -168,9 +213,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinonipL1PluralElement.pinonipL2Object =
-        [dictionary objectForKey:@"pinonipL2Object"] != [NSNull null] ? 
-        [JRPinonipL2Object pinonipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"pinonipL2Object"] withPath:pinonipL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinonipL2Object"] isKindOfClass:[NSDictionary class]])
+        pinonipL1PluralElement->_pinonipL2ObjectJson = [dictionary objectForKey:@"pinonipL2Object"];
+    else
+        pinonipL1PluralElement.pinonipL2Object =
+            [dictionary objectForKey:@"pinonipL2Object"] != [NSNull null] ? 
+            [JRPinonipL2Object pinonipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"pinonipL2Object"] withPath:pinonipL1PluralElement.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinonipL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -185,11 +233,129 @@
     return [JRPinonipL1PluralElement pinonipL1PluralElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinonipL1PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinonipL1PluralElement *pinonipL1PluralElement = [JRPinonipL1PluralElement pinonipL1PluralElement];
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    NSInteger elementId = 0;
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinonipL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "pinonipL2Object")) break;
+                if ((value = [reader readValue]))
+                    [dictionary setObject:value forKey:@"pinonipL2Object"];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinonipL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    pinonipL1PluralElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinonipL1Plural", (long)elementId];
+    pinonipL1PluralElement.canBeUpdatedOnCapture = YES;
+
+    if (lazily && [[dictionary objectForKey:@"pinonipL2Object"] isKindOfClass:[NSDictionary class]])
+        pinonipL1PluralElement->_pinonipL2ObjectJson = [dictionary objectForKey:@"pinonipL2Object"];
+    else
+        pinonipL1PluralElement.pinonipL2Object =
+            [dictionary objectForKey:@"pinonipL2Object"] != [NSNull null] ? 
+            [JRPinonipL2Object pinonipL2ObjectObjectFromDictionary:[dictionary objectForKey:@"pinonipL2Object"] withPath:pinonipL1PluralElement.captureObjectPath fromDecoder:NO] : nil;
+
+    [pinonipL1PluralElement.dirtyPropertySet removeAllObjects];
+
+    return pinonipL1PluralElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinonipL2Object"];
+    if (self.pinonipL2Object)
+        [self.pinonipL2Object writeToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinonipL1PluralElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinonipL1PluralElement *pinonipL1PluralElement = [JRPinonipL1PluralElement pinonipL1PluralElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinonipL1PluralElement.captureObjectPath = [reader readString];
+    pinonipL1PluralElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinonipL1PluralElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "pinonipL2Object")) break;
+                pinonipL1PluralElement.pinonipL2Object = [JRPinonipL2Object pinonipL2ObjectObjectFromArchive:reader];
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinonipL1PluralElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinonipL1PluralElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinonipL1PluralElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinonipL1PluralElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pinonipL1Plural", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -209,7 +375,7 @@
     else
         [self.pinonipL2Object replaceFromDictionary:[dictionary objectForKey:@"pinonipL2Object"] withPath:self.captureObjectPath];
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -217,18 +383,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", @"pinonipL2Object", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinonipL1PluralElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinonipL1PluralElement"];
 
     if (self.pinonipL2Object)
         [snapshotDictionary setObject:[self.pinonipL2Object snapshotDictionaryFromDirtyPropertySet]
@@ -240,7 +400,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinonipL1PluralElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinonipL1PluralElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinonipL1PluralElement"]];
 
     if ([snapshotDictionary objectForKey:@"pinonipL2Object"])
         [self.pinonipL2Object restoreDirtyPropertiesFromSnapshotDictionary:
@@ -253,13 +413,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
-    if ([self.dirtyPropertySet containsObject:@"pinonipL2Object"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementPinonipL2ObjectProperty))
         [dictionary setObject:(self.pinonipL2Object ?
                               [self.pinonipL2Object toUpdateDictionary] :
                               [[JRPinonipL2Object pinonipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
@@ -294,6 +454,57 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL1PluralElementPinonipL2ObjectProperty))
+    {
+        [writer writeKey:@"pinonipL2Object"];
+        [(self.pinonipL2Object ? self.pinonipL2Object : [JRPinonipL2Object pinonipL2Object]) writeUpdateJsonToWriter:writer];
+    }
+    else if ([self.pinonipL2Object needsUpdate])
+    {
+        [writer writeKey:@"pinonipL2Object"];
+        [self.pinonipL2Object writeUpdateJsonToWriter:writer];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinonipL2Object"];
+    if (self.pinonipL2Object)
+        [self.pinonipL2Object writeReplaceJsonToWriter:writer];
+    else
+        [[JRPinonipL2Object pinonipL2Object] writeUpdateJsonToWriter:writer]; /* Use the default constructor to create an empty object */
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -305,6 +516,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || !_pinonipL2ObjectJson)
+        [self.pinonipL2Object validateIntoViolations:violations dirtyPropertiesOnly:dirtyPropertiesOnly];
+}
+
 - (BOOL)isEqualToPinonipL1PluralElement:(JRPinonipL1PluralElement *)otherPinonipL1PluralElement
 {
     if (!self.string1 && !otherPinonipL1PluralElement.string1) /* Keep going... */;
@@ -335,4 +552,27 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+
+    if (_pinonipL2ObjectJson)
+        _pinonipL2ObjectJsonCleared = YES;
+    else
+        [self.pinonipL2Object deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinonipL1PluralElement class]]) return NO;
+
+    JRPinonipL1PluralElement *otherPinonipL1PluralElement = (JRPinonipL1PluralElement *)otherObj;
+
+    if (self.pinonipL2Object && ![self.pinonipL2Object isEqualByPrivateProperties:otherPinonipL1PluralElement.pinonipL2Object])
+        return NO;
+
+    return YES;
+}
+
 @end
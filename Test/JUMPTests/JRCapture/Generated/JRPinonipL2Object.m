@@ -40,8 +40,23 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPinonipL2Object.h"
 
+enum
+{
+    JRPinonipL2ObjectString1Property,
+    JRPinonipL2ObjectString2Property,
+    JRPinonipL2ObjectPropertyCount
+};
+
+static const char *const JRPinonipL2ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
 @interface JRPinonipL3PluralElement (JRPinonipL3PluralElement_InternalMethods)
 + (id)pinonipL3PluralElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder;
++ (id)pinonipL3PluralElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath;
++ (id)pinonipL3PluralElementFromArchive:(JRCaptureArchiveReader *)reader;
 - (BOOL)isEqualToPinonipL3PluralElement:(JRPinonipL3PluralElement *)otherPinonipL3PluralElement;
 @end
 
@@ -85,10 +100,61 @@
 
     return filteredDictionaryArray;
 }
+
+- (void)writeReplaceJsonOfPinonipL3PluralElementsToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinonipL3PluralElement class]])
+            [(JRPinonipL3PluralElement*)object writeReplaceJsonToWriter:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinonipL3PluralElementsFromJsonReader:(JRJsonReader *)reader withPath:(NSString*)capturePath
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinonipL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinonipL3PluralElement *element = [JRPinonipL3PluralElement pinonipL3PluralElementFromJsonReader:reader withPath:capturePath];
+        if (element)
+            [filteredPinonipL3PluralArray addObject:element];
+    }
+
+    return filteredPinonipL3PluralArray;
+}
+
+- (void)writePinonipL3PluralElementsToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginArray];
+    for (NSObject *object in self)
+        if ([object isKindOfClass:[JRPinonipL3PluralElement class]])
+            [(JRPinonipL3PluralElement*)object writeToArchive:writer];
+    [writer endArray];
+}
+
++ (NSArray*)arrayOfPinonipL3PluralElementsFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginArray])
+        return nil;
+
+    NSMutableArray *filteredPinonipL3PluralArray = [NSMutableArray array];
+    while ([reader nextElement])
+    {
+        JRPinonipL3PluralElement *element = [JRPinonipL3PluralElement pinonipL3PluralElementFromArchive:reader];
+        if (element)
+            [filteredPinonipL3PluralArray addObject:element];
+    }
+
+    return filteredPinonipL3PluralArray;
+}
 @end
 
 @interface NSArray (PinonipL2Object_ArrayComparison)
 - (BOOL)isEqualToPinonipL3PluralArray:(NSArray *)otherArray;
+- (BOOL)isEqualByPrivatePropertiesToPinonipL3PluralArray:(NSArray *)otherArray;
 @end
 
 @implementation NSArray (PinonipL2Object_ArrayComparison)
@@ -103,6 +169,17 @@
 
     return YES;
 }
+
+- (BOOL)isEqualByPrivatePropertiesToPinonipL3PluralArray:(NSArray *)otherArray
+{
+    if (![otherArray isKindOfClass:[NSArray class]] || [self count] != [otherArray count]) return NO;
+
+    for (NSUInteger i = 0; i < [self count]; i++)
+        if (![((JRPinonipL3PluralElement *)[self objectAtIndex:i]) isEqualByPrivateProperties:[otherArray objectAtIndex:i]])
+            return NO;
+
+    return YES;
+}
 @end
 
 @interface JRPinonipL2Object ()
@@ -114,9 +191,20 @@
     NSString *_string1;
     NSString *_string2;
     NSArray *_pinonipL3Plural;
+    NSArray *_pinonipL3PluralJson;
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinonipL2ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinonipL2ObjectPropertyCount;
+}
+
 - (NSString *)string1
 {
     return _string1;
@@ -124,7 +212,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinonipL2ObjectString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -136,18 +224,27 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPinonipL2ObjectString2Property);
 
     _string2 = [newString2 copy];
 }
 
 - (NSArray *)pinonipL3Plural
 {
+    if (_pinonipL3PluralJson)
+    {
+        NSArray *json = _pinonipL3PluralJson;
+        _pinonipL3PluralJson = nil;
+        _pinonipL3Plural = [[json arrayOfPinonipL3PluralElementsFromPinonipL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] copy];
+    }
+
     return _pinonipL3Plural;
 }
 
 - (void)setPinonipL3Plural:(NSArray *)newPinonipL3Plural
 {
+    _pinonipL3PluralJson = nil;
+
     _pinonipL3Plural = [newPinonipL3Plural copy];
 }
 
@@ -159,7 +256,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -215,6 +312,8 @@
         pinonipL2Object.canBeUpdatedOnCapture = YES;
     }
 
+    BOOL lazily = !fromDecoder && [JRCaptureObject materializesLazily];
+
     pinonipL2Object.string1 =
         [dictionary objectForKey:@"string1"] != [NSNull null] ? 
         [dictionary objectForKey:@"string1"] : nil;
@@ -223,9 +322,12 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    pinonipL2Object.pinonipL3Plural =
-        [dictionary objectForKey:@"pinonipL3Plural"] != [NSNull null] ? 
-        [(NSArray*)[dictionary objectForKey:@"pinonipL3Plural"] arrayOfPinonipL3PluralElementsFromPinonipL3PluralDictionariesWithPath:pinonipL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
+    if (lazily && [[dictionary objectForKey:@"pinonipL3Plural"] isKindOfClass:[NSArray class]])
+        pinonipL2Object->_pinonipL3PluralJson = [dictionary objectForKey:@"pinonipL3Plural"];
+    else
+        pinonipL2Object.pinonipL3Plural =
+            [dictionary objectForKey:@"pinonipL3Plural"] != [NSNull null] ? 
+            [(NSArray*)[dictionary objectForKey:@"pinonipL3Plural"] arrayOfPinonipL3PluralElementsFromPinonipL3PluralDictionariesWithPath:pinonipL2Object.captureObjectPath fromDecoder:fromDecoder] : nil;
 
     if (fromDecoder)
         [pinonipL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
@@ -240,11 +342,117 @@
     return [JRPinonipL2Object pinonipL2ObjectObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pinonipL2ObjectObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinonipL2Object *pinonipL2Object = [JRPinonipL2Object pinonipL2Object];
+    BOOL lazily = [JRCaptureObject materializesLazily];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    pinonipL2Object.captureObjectPath      = [NSString stringWithFormat:@"%@/%@", capturePath, @"pinonipL2Object"];
+    pinonipL2Object.canBeUpdatedOnCapture = YES;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinonipL3Plural")) break;
+                if (!lazily)
+                    pinonipL2Object.pinonipL3Plural = [NSArray arrayOfPinonipL3PluralElementsFromJsonReader:reader withPath:pinonipL2Object.captureObjectPath];
+                else if ([(value = [reader readValue]) isKindOfClass:[NSArray class]])
+                    pinonipL2Object->_pinonipL3PluralJson = value;
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinonipL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinonipL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinonipL2Object.dirtyPropertySet removeAllObjects];
+
+    return pinonipL2Object;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer writeKey:@"pinonipL3Plural"];
+    if (self.pinonipL3Plural)
+        [self.pinonipL3Plural writePinonipL3PluralElementsToArchive:writer];
+    else
+        [writer writeNull];
+    [writer endObject];
+}
+
++ (id)pinonipL2ObjectObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPinonipL2Object *pinonipL2Object = [JRPinonipL2Object pinonipL2Object];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pinonipL2Object.captureObjectPath = [reader readString];
+    pinonipL2Object.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 1) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "pinonipL3Plural")) break;
+                pinonipL2Object.pinonipL3Plural = [NSArray arrayOfPinonipL3PluralElementsFromArchive:reader];
+                continue;
+            case 4:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pinonipL2Object.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 5:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pinonipL2Object.string2 = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pinonipL2Object.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pinonipL2Object;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPinonipL2ObjectPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@", capturePath, @"pinonipL2Object"];
@@ -261,7 +469,7 @@
         [dictionary objectForKey:@"pinonipL3Plural"] != [NSNull null] ? 
         [(NSArray*)[dictionary objectForKey:@"pinonipL3Plural"] arrayOfPinonipL3PluralElementsFromPinonipL3PluralDictionariesWithPath:self.captureObjectPath fromDecoder:NO] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -269,18 +477,12 @@
     return [NSSet setWithObjects:@"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinonipL2Object"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pinonipL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -288,7 +490,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pinonipL2Object"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinonipL2Object"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pinonipL2Object"]];
 
 }
 
@@ -297,10 +499,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL2ObjectString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL2ObjectString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -329,6 +531,43 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL2ObjectString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPinonipL2ObjectString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer writeKey:@"pinonipL3Plural"];
+    [(self.pinonipL3Plural ? self.pinonipL3Plural : [NSArray array]) writeReplaceJsonOfPinonipL3PluralElementsToWriter:writer];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (void)replacePinonipL3PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
 {
     [self replaceArrayOnCapture:self.pinonipL3Plural named:@"pinonipL3Plural" isArrayOfStrings:NO
@@ -343,6 +582,13 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly)
+        for (JRCaptureObject *element in self.pinonipL3Plural)
+            [element validateIntoViolations:violations dirtyPropertiesOnly:NO];
+}
+
 - (BOOL)isEqualToPinonipL2Object:(JRPinonipL2Object *)otherPinonipL2Object
 {
     if (!self.string1 && !otherPinonipL2Object.string1) /* Keep going... */;
@@ -373,4 +619,22 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPinonipL2Object class]]) return NO;
+
+    JRPinonipL2Object *otherPinonipL2Object = (JRPinonipL2Object *)otherObj;
+
+    if (self.pinonipL3Plural && ![self.pinonipL3Plural isEqualByPrivatePropertiesToPinonipL3PluralArray:otherPinonipL2Object.pinonipL3Plural])
+        return NO;
+
+    return YES;
+}
+
 @end
@@ -40,6 +40,21 @@
 #import "JRCaptureObject+Internal.h"
 #import "JRPluralTestAlphabeticElement.h"
 
+enum
+{
+    JRPluralTestAlphabeticElementUniqueStringProperty,
+    JRPluralTestAlphabeticElementString1Property,
+    JRPluralTestAlphabeticElementString2Property,
+    JRPluralTestAlphabeticElementPropertyCount
+};
+
+static const char *const JRPluralTestAlphabeticElementPropertyNames[] =
+{
+    "uniqueString",
+    "string1",
+    "string2",
+};
+
 @interface JRPluralTestAlphabeticElement ()
 @property BOOL canBeUpdatedOnCapture;
 @end
@@ -52,6 +67,16 @@
 }
 @synthesize canBeUpdatedOnCapture;
 
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPluralTestAlphabeticElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPluralTestAlphabeticElementPropertyCount;
+}
+
 - (NSString *)uniqueString
 {
     return _uniqueString;
@@ -59,7 +84,7 @@
 
 - (void)setUniqueString:(NSString *)newUniqueString
 {
-    [self.dirtyPropertySet addObject:@"uniqueString"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementUniqueStringProperty);
 
     _uniqueString = [newUniqueString copy];
 }
@@ -71,7 +96,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
-    [self.dirtyPropertySet addObject:@"string1"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementString1Property);
 
     _string1 = [newString1 copy];
 }
@@ -83,7 +108,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
-    [self.dirtyPropertySet addObject:@"string2"];
+    JRSetDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementString2Property);
 
     _string2 = [newString2 copy];
 }
@@ -96,7 +121,7 @@
         self.canBeUpdatedOnCapture  = NO;
 
 
-        [self.dirtyPropertySet setSet:[self updatablePropertySet]];
+        [self setAllPropertiesToDirty];
     }
     return self;
 }
@@ -177,11 +202,118 @@
     return [JRPluralTestAlphabeticElement pluralTestAlphabeticElementFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
 }
 
++ (id)pluralTestAlphabeticElementFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPluralTestAlphabeticElement *pluralTestAlphabeticElement = [JRPluralTestAlphabeticElement pluralTestAlphabeticElement];
+    NSInteger elementId = 0;
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 0:
+                if (!JRJsonKeyEquals(key, keyLength, "id")) break;
+                value = [reader readValue];
+                elementId = [value respondsToSelector:@selector(integerValue)] ? [value integerValue] : 0;
+                continue;
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pluralTestAlphabeticElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pluralTestAlphabeticElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "uniqueString")) break;
+                value = [reader readValue];
+                pluralTestAlphabeticElement.uniqueString = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    pluralTestAlphabeticElement.captureObjectPath      = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pluralTestAlphabetic", (long)elementId];
+    pluralTestAlphabeticElement.canBeUpdatedOnCapture = YES;
+
+    [pluralTestAlphabeticElement.dirtyPropertySet removeAllObjects];
+
+    return pluralTestAlphabeticElement;
+}
+
+- (void)writeToArchive:(JRCaptureArchiveWriter *)writer
+{
+    [writer beginObject];
+    [writer writeNameSet:self.dirtyPropertySet];
+    [writer writeString:self.captureObjectPath];
+    [writer writeBool:self.canBeUpdatedOnCapture];
+
+    [writer writeKey:@"uniqueString"];
+    [writer writeValue:self.uniqueString];
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+    [writer endObject];
+}
+
++ (id)pluralTestAlphabeticElementFromArchive:(JRCaptureArchiveReader *)reader
+{
+    if (![reader beginObject])
+        return nil;
+
+    JRPluralTestAlphabeticElement *pluralTestAlphabeticElement = [JRPluralTestAlphabeticElement pluralTestAlphabeticElement];
+    NSSet *dirtyPropertySetCopy = [reader readNameSet];
+    pluralTestAlphabeticElement.captureObjectPath = [reader readString];
+    pluralTestAlphabeticElement.canBeUpdatedOnCapture = [reader readBool];
+    const char *key;
+    size_t keyLength;
+    id value;
+
+    while ((key = [reader nextKey:&keyLength]))
+    {
+        switch (JRJsonKeyHash(key, keyLength, 0) & 7)
+        {
+            case 3:
+                if (!JRJsonKeyEquals(key, keyLength, "string1")) break;
+                value = [reader readValue];
+                pluralTestAlphabeticElement.string1 = value != [NSNull null] ? value : nil;
+                continue;
+            case 6:
+                if (!JRJsonKeyEquals(key, keyLength, "string2")) break;
+                value = [reader readValue];
+                pluralTestAlphabeticElement.string2 = value != [NSNull null] ? value : nil;
+                continue;
+            case 7:
+                if (!JRJsonKeyEquals(key, keyLength, "uniqueString")) break;
+                value = [reader readValue];
+                pluralTestAlphabeticElement.uniqueString = value != [NSNull null] ? value : nil;
+                continue;
+        }
+
+        [reader skipValue];
+    }
+
+    [pluralTestAlphabeticElement.dirtyPropertySet setSet:dirtyPropertySetCopy];
+
+    return pluralTestAlphabeticElement;
+}
+
 - (void)replaceFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
 {
     DLog(@"%@ %@", capturePath, [dictionary description]);
 
-    NSSet *dirtyPropertySetCopy = [self.dirtyPropertySet copy];
+    JRDirtyPropertyWord dirtyPropertyWordsCopy[JRDirtyPropertyWordCount(JRPluralTestAlphabeticElementPropertyCount)];
+    memcpy(dirtyPropertyWordsCopy, self.dirtyPropertyWords, sizeof(dirtyPropertyWordsCopy));
 
     self.canBeUpdatedOnCapture = YES;
     self.captureObjectPath = [NSString stringWithFormat:@"%@/%@#%ld", capturePath, @"pluralTestAlphabetic", (long)[(NSNumber*)[dictionary objectForKey:@"id"] integerValue]];
@@ -198,7 +330,7 @@
         [dictionary objectForKey:@"string2"] != [NSNull null] ? 
         [dictionary objectForKey:@"string2"] : nil;
 
-    [self.dirtyPropertySet setSet:dirtyPropertySetCopy];
+    memcpy(self.dirtyPropertyWords, dirtyPropertyWordsCopy, sizeof(dirtyPropertyWordsCopy));
 }
 
 - (NSSet *)updatablePropertySet
@@ -206,18 +338,12 @@
     return [NSSet setWithObjects:@"uniqueString", @"string1", @"string2", nil];
 }
 
-- (void)setAllPropertiesToDirty
-{
-    [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
-
-}
-
 - (NSDictionary *)snapshotDictionaryFromDirtyPropertySet
 {
     NSMutableDictionary *snapshotDictionary =
              [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pluralTestAlphabeticElement"];
+    [snapshotDictionary setObject:[self dirtyPropertyWordsSnapshot] forKey:@"pluralTestAlphabeticElement"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
 }
@@ -225,7 +351,7 @@
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
     if ([snapshotDictionary objectForKey:@"pluralTestAlphabeticElement"])
-        [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pluralTestAlphabeticElement"] allObjects]];
+        [self restoreDirtyPropertyWordsFromSnapshot:[snapshotDictionary objectForKey:@"pluralTestAlphabeticElement"]];
 
 }
 
@@ -234,13 +360,13 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    if ([self.dirtyPropertySet containsObject:@"uniqueString"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementUniqueStringProperty))
         [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
 
-    if ([self.dirtyPropertySet containsObject:@"string1"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementString1Property))
         [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
 
-    if ([self.dirtyPropertySet containsObject:@"string2"])
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementString2Property))
         [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -265,6 +391,49 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)writeUpdateJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementUniqueStringProperty))
+    {
+        [writer writeKey:@"uniqueString"];
+        [writer writeValue:self.uniqueString];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementString1Property))
+    {
+        [writer writeKey:@"string1"];
+        [writer writeValue:self.string1];
+    }
+
+    if (JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementString2Property))
+    {
+        [writer writeKey:@"string2"];
+        [writer writeValue:self.string2];
+    }
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
+- (void)writeReplaceJsonToWriter:(JRJsonFormWriter *)writer
+{
+    [writer beginObject];
+
+    [writer writeKey:@"uniqueString"];
+    [writer writeValue:self.uniqueString];
+
+    [writer writeKey:@"string1"];
+    [writer writeValue:self.string1];
+
+    [writer writeKey:@"string2"];
+    [writer writeValue:self.string2];
+
+    [writer endObject];
+    [self.dirtyPropertySet removeAllObjects];
+}
+
 - (BOOL)needsUpdate
 {
     if ([self.dirtyPropertySet count])
@@ -273,6 +442,12 @@
     return NO;
 }
 
+- (void)validateIntoViolations:(NSMutableArray *)violations dirtyPropertiesOnly:(BOOL)dirtyPropertiesOnly
+{
+    if (!dirtyPropertiesOnly || JRIsDirtyProperty(self.dirtyPropertyWords, JRPluralTestAlphabeticElementUniqueStringProperty))
+        JRValidateCaptureAttribute(self.uniqueString, @"uniqueString", self.captureObjectPath, JRCaptureAttributeAlphabetic, 0, violations);
+}
+
 - (BOOL)isEqualToPluralTestAlphabeticElement:(JRPluralTestAlphabeticElement *)otherPluralTestAlphabeticElement
 {
     if (!self.uniqueString && !otherPluralTestAlphabeticElement.uniqueString) /* Keep going... */;
@@ -302,4 +477,17 @@
     return [NSDictionary dictionaryWithDictionary:dictionary];
 }
 
+- (void)deepClearDirtyProperties
+{
+    [super deepClearDirtyProperties];
+}
+
+- (BOOL)isEqualByPrivateProperties:(JRCaptureObject *)otherObj
+{
+    if (![super isEqualByPrivateProperties:otherObj]) return NO;
+    if (![otherObj isKindOfClass:[JRPluralTestAlphabeticElement class]]) return NO;
+
+    return YES;
+}
+
 @end
@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JRBasicPluralElement.h"
+
+enum
+{
+    JRBasicPluralElementString1Property,
+    JRBasicPluralElementString2Property,
+    JRBasicPluralElementPropertyCount
+};
+
+static const char *const JRBasicPluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
+static const JRCaptureAttribute JRBasicPluralElementAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRBasicPluralElementString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRBasicPluralElementString2Property, NULL, nil },
+};
+
+static const JRCaptureSchema JRBasicPluralElementSchema =
+{
+    @"basicPluralElement", @"basicPlural", @"", YES, YES,
+    sizeof(JRBasicPluralElementAttributes) / sizeof(JRBasicPluralElementAttributes[0]), JRBasicPluralElementAttributes
+};
+
+@interface JRBasicPluralElement ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JRBasicPluralElement
+@dynamic string1;
+@dynamic string2;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JRBasicPluralElementSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JRBasicPluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRBasicPluralElementPropertyCount;
+}
+
++ (id)basicPluralElement
+{
+    return [[JRBasicPluralElement alloc] init];
+}
+
+- (BOOL)isEqualToBasicPluralElement:(JRBasicPluralElement *)otherBasicPluralElement
+{
+    return [self isEqualToCaptureObject:otherBasicPluralElement];
+}
+
+@end
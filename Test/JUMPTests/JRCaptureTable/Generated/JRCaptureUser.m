@@ -0,0 +1,423 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JRCaptureUser.h"
+
+enum
+{
+    JRCaptureUserUuidProperty,
+    JRCaptureUserCreatedProperty,
+    JRCaptureUserLastUpdatedProperty,
+    JRCaptureUserEmailProperty,
+    JRCaptureUserBasicBooleanProperty,
+    JRCaptureUserBasicStringProperty,
+    JRCaptureUserBasicIntegerProperty,
+    JRCaptureUserBasicDecimalProperty,
+    JRCaptureUserBasicDateProperty,
+    JRCaptureUserBasicDateTimeProperty,
+    JRCaptureUserBasicIpAddressProperty,
+    JRCaptureUserBasicPasswordProperty,
+    JRCaptureUserJsonNumberProperty,
+    JRCaptureUserJsonStringProperty,
+    JRCaptureUserJsonArrayProperty,
+    JRCaptureUserJsonDictionaryProperty,
+    JRCaptureUserStringTestJsonProperty,
+    JRCaptureUserStringTestEmptyProperty,
+    JRCaptureUserStringTestNullProperty,
+    JRCaptureUserStringTestInvalidProperty,
+    JRCaptureUserStringTestNSNullProperty,
+    JRCaptureUserStringTestAlphanumericProperty,
+    JRCaptureUserStringTestUnicodeLettersProperty,
+    JRCaptureUserStringTestUnicodePrintableProperty,
+    JRCaptureUserStringTestEmailAddressProperty,
+    JRCaptureUserStringTestLengthProperty,
+    JRCaptureUserStringTestCaseSensitiveProperty,
+    JRCaptureUserStringTestFeaturesProperty,
+    JRCaptureUserBasicObjectProperty,
+    JRCaptureUserObjectTestRequiredProperty,
+    JRCaptureUserObjectTestRequiredUniqueProperty,
+    JRCaptureUserPinoL1ObjectProperty,
+    JRCaptureUserOinoL1ObjectProperty,
+    JRCaptureUserPinapinoL1ObjectProperty,
+    JRCaptureUserPinoinoL1ObjectProperty,
+    JRCaptureUserOnipinoL1ObjectProperty,
+    JRCaptureUserOinoinoL1ObjectProperty,
+    JRCaptureUserCaptureUserIdProperty,
+    JRCaptureUserPropertyCount
+};
+
+static const char *const JRCaptureUserPropertyNames[] =
+{
+    "uuid",
+    "created",
+    "lastUpdated",
+    "email",
+    "basicBoolean",
+    "basicString",
+    "basicInteger",
+    "basicDecimal",
+    "basicDate",
+    "basicDateTime",
+    "basicIpAddress",
+    "basicPassword",
+    "jsonNumber",
+    "jsonString",
+    "jsonArray",
+    "jsonDictionary",
+    "stringTestJson",
+    "stringTestEmpty",
+    "stringTestNull",
+    "stringTestInvalid",
+    "stringTestNSNull",
+    "stringTestAlphanumeric",
+    "stringTestUnicodeLetters",
+    "stringTestUnicodePrintable",
+    "stringTestEmailAddress",
+    "stringTestLength",
+    "stringTestCaseSensitive",
+    "stringTestFeatures",
+    "basicObject",
+    "objectTestRequired",
+    "objectTestRequiredUnique",
+    "pinoL1Object",
+    "oinoL1Object",
+    "pinapinoL1Object",
+    "pinoinoL1Object",
+    "onipinoL1Object",
+    "oinoinoL1Object",
+    "captureUserId",
+};
+
+static const JRCaptureAttribute JRCaptureUserAttributes[] =
+{
+    { @"uuid", "uuid", @"uuid", @"JRUuid",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeReadOnly, 0, JRCaptureUserUuidProperty, NULL, nil },
+    { @"created", "created", @"created", @"JRDateTime",
+      JRCaptureAttributeTypeDateTime, JRCaptureAttributeReadOnly, 0, JRCaptureUserCreatedProperty, NULL, nil },
+    { @"lastUpdated", "lastUpdated", @"lastUpdated", @"JRDateTime",
+      JRCaptureAttributeTypeDateTime, JRCaptureAttributeReadOnly, 0, JRCaptureUserLastUpdatedProperty, NULL, nil },
+    { @"email", "email", @"email", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeUnique, 256, JRCaptureUserEmailProperty, NULL, nil },
+    { @"basicBoolean", "basicBoolean", @"basicBoolean", @"JRBoolean",
+      JRCaptureAttributeTypeBoolean, 0, 0, JRCaptureUserBasicBooleanProperty, NULL, nil },
+    { @"basicString", "basicString", @"basicString", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserBasicStringProperty, NULL, nil },
+    { @"basicInteger", "basicInteger", @"basicInteger", @"JRInteger",
+      JRCaptureAttributeTypeInteger, 0, 0, JRCaptureUserBasicIntegerProperty, NULL, nil },
+    { @"basicDecimal", "basicDecimal", @"basicDecimal", @"JRDecimal",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserBasicDecimalProperty, NULL, nil },
+    { @"basicDate", "basicDate", @"basicDate", @"JRDate",
+      JRCaptureAttributeTypeDate, 0, 0, JRCaptureUserBasicDateProperty, NULL, nil },
+    { @"basicDateTime", "basicDateTime", @"basicDateTime", @"JRDateTime",
+      JRCaptureAttributeTypeDateTime, 0, 0, JRCaptureUserBasicDateTimeProperty, NULL, nil },
+    { @"basicIpAddress", "basicIpAddress", @"basicIpAddress", @"JRIpAddress",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserBasicIpAddressProperty, NULL, nil },
+    { @"basicPassword", "basicPassword", @"basicPassword", @"JRPassword",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserBasicPasswordProperty, NULL, nil },
+    { @"jsonNumber", "jsonNumber", @"jsonNumber", @"JRJsonObject",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserJsonNumberProperty, NULL, nil },
+    { @"jsonString", "jsonString", @"jsonString", @"JRJsonObject",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserJsonStringProperty, NULL, nil },
+    { @"jsonArray", "jsonArray", @"jsonArray", @"JRJsonObject",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserJsonArrayProperty, NULL, nil },
+    { @"jsonDictionary", "jsonDictionary", @"jsonDictionary", @"JRJsonObject",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserJsonDictionaryProperty, NULL, nil },
+    { @"stringTestJson", "stringTestJson", @"stringTestJson", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserStringTestJsonProperty, NULL, nil },
+    { @"stringTestEmpty", "stringTestEmpty", @"stringTestEmpty", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserStringTestEmptyProperty, NULL, nil },
+    { @"stringTestNull", "stringTestNull", @"stringTestNull", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserStringTestNullProperty, NULL, nil },
+    { @"stringTestInvalid", "stringTestInvalid", @"stringTestInvalid", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserStringTestInvalidProperty, NULL, nil },
+    { @"stringTestNSNull", "stringTestNSNull", @"stringTestNSNull", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserStringTestNSNullProperty, NULL, nil },
+    { @"stringTestAlphanumeric", "stringTestAlphanumeric", @"stringTestAlphanumeric", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeAlphanumeric, 0, JRCaptureUserStringTestAlphanumericProperty, NULL, nil },
+    { @"stringTestUnicodeLetters", "stringTestUnicodeLetters", @"stringTestUnicodeLetters", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeUnicodeLetters, 0, JRCaptureUserStringTestUnicodeLettersProperty, NULL, nil },
+    { @"stringTestUnicodePrintable", "stringTestUnicodePrintable", @"stringTestUnicodePrintable", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeUnicodePrintable, 0, JRCaptureUserStringTestUnicodePrintableProperty, NULL, nil },
+    { @"stringTestEmailAddress", "stringTestEmailAddress", @"stringTestEmailAddress", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeEmailAddress, 0, JRCaptureUserStringTestEmailAddressProperty, NULL, nil },
+    { @"stringTestLength", "stringTestLength", @"stringTestLength", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 100, JRCaptureUserStringTestLengthProperty, NULL, nil },
+    { @"stringTestCaseSensitive", "stringTestCaseSensitive", @"stringTestCaseSensitive", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRCaptureUserStringTestCaseSensitiveProperty, NULL, nil },
+    { @"stringTestFeatures", "stringTestFeatures", @"stringTestFeatures", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 1000, JRCaptureUserStringTestFeaturesProperty, NULL, nil },
+    { @"basicPlural", "basicPlural", @"basicPlural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JRBasicPluralElement", nil },
+    { @"basicObject", "basicObject", @"basicObject", @"JRBasicObject",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserBasicObjectProperty, "JRBasicObject", nil },
+    { @"objectTestRequired", "objectTestRequired", @"objectTestRequired", @"JRObjectTestRequired",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserObjectTestRequiredProperty, "JRObjectTestRequired", nil },
+    { @"pluralTestUnique", "pluralTestUnique", @"pluralTestUnique", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JRPluralTestUniqueElement", nil },
+    { @"objectTestRequiredUnique", "objectTestRequiredUnique", @"objectTestRequiredUnique", @"JRObjectTestRequiredUnique",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserObjectTestRequiredUniqueProperty, "JRObjectTestRequiredUnique", nil },
+    { @"pluralTestAlphabetic", "pluralTestAlphabetic", @"pluralTestAlphabetic", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JRPluralTestAlphabeticElement", nil },
+    { @"simpleStringPluralOne", "simpleStringPluralOne", @"simpleStringPluralOne", @"JRStringArray",
+      JRCaptureAttributeTypeStringPlural, 0, 0, -1, NULL, @"simpleTypeOne" },
+    { @"simpleStringPluralTwo", "simpleStringPluralTwo", @"simpleStringPluralTwo", @"JRStringArray",
+      JRCaptureAttributeTypeStringPlural, 0, 0, -1, NULL, @"simpleTypeTwo" },
+    { @"pinapL1Plural", "pinapL1Plural", @"pinapL1Plural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JRPinapL1PluralElement", nil },
+    { @"pinoL1Object", "pinoL1Object", @"pinoL1Object", @"JRPinoL1Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserPinoL1ObjectProperty, "JRPinoL1Object", nil },
+    { @"onipL1Plural", "onipL1Plural", @"onipL1Plural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JROnipL1PluralElement", nil },
+    { @"oinoL1Object", "oinoL1Object", @"oinoL1Object", @"JROinoL1Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserOinoL1ObjectProperty, "JROinoL1Object", nil },
+    { @"pinapinapL1Plural", "pinapinapL1Plural", @"pinapinapL1Plural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JRPinapinapL1PluralElement", nil },
+    { @"pinonipL1Plural", "pinonipL1Plural", @"pinonipL1Plural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JRPinonipL1PluralElement", nil },
+    { @"pinapinoL1Object", "pinapinoL1Object", @"pinapinoL1Object", @"JRPinapinoL1Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserPinapinoL1ObjectProperty, "JRPinapinoL1Object", nil },
+    { @"pinoinoL1Object", "pinoinoL1Object", @"pinoinoL1Object", @"JRPinoinoL1Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserPinoinoL1ObjectProperty, "JRPinoinoL1Object", nil },
+    { @"onipinapL1Plural", "onipinapL1Plural", @"onipinapL1Plural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JROnipinapL1PluralElement", nil },
+    { @"oinonipL1Plural", "oinonipL1Plural", @"oinonipL1Plural", @"NSArray",
+      JRCaptureAttributeTypePlural, 0, 0, -1, "JROinonipL1PluralElement", nil },
+    { @"onipinoL1Object", "onipinoL1Object", @"onipinoL1Object", @"JROnipinoL1Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserOnipinoL1ObjectProperty, "JROnipinoL1Object", nil },
+    { @"oinoinoL1Object", "oinoinoL1Object", @"oinoinoL1Object", @"JROinoinoL1Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRCaptureUserOinoinoL1ObjectProperty, "JROinoinoL1Object", nil },
+    { @"id", "id", @"captureUserId", @"JRObjectId",
+      JRCaptureAttributeTypeInteger, JRCaptureAttributeReadOnly, 0, JRCaptureUserCaptureUserIdProperty, NULL, nil },
+};
+
+static const JRCaptureSchema JRCaptureUserSchema =
+{
+    @"captureUser", @"", @"", NO, NO,
+    sizeof(JRCaptureUserAttributes) / sizeof(JRCaptureUserAttributes[0]), JRCaptureUserAttributes
+};
+
+@interface JRCaptureUser ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JRCaptureUser
+@dynamic uuid;
+@dynamic created;
+@dynamic lastUpdated;
+@dynamic email;
+@dynamic basicBoolean;
+@dynamic basicString;
+@dynamic basicInteger;
+@dynamic basicDecimal;
+@dynamic basicDate;
+@dynamic basicDateTime;
+@dynamic basicIpAddress;
+@dynamic basicPassword;
+@dynamic jsonNumber;
+@dynamic jsonString;
+@dynamic jsonArray;
+@dynamic jsonDictionary;
+@dynamic stringTestJson;
+@dynamic stringTestEmpty;
+@dynamic stringTestNull;
+@dynamic stringTestInvalid;
+@dynamic stringTestNSNull;
+@dynamic stringTestAlphanumeric;
+@dynamic stringTestUnicodeLetters;
+@dynamic stringTestUnicodePrintable;
+@dynamic stringTestEmailAddress;
+@dynamic stringTestLength;
+@dynamic stringTestCaseSensitive;
+@dynamic stringTestFeatures;
+@dynamic basicPlural;
+@dynamic basicObject;
+@dynamic objectTestRequired;
+@dynamic pluralTestUnique;
+@dynamic objectTestRequiredUnique;
+@dynamic pluralTestAlphabetic;
+@dynamic simpleStringPluralOne;
+@dynamic simpleStringPluralTwo;
+@dynamic pinapL1Plural;
+@dynamic pinoL1Object;
+@dynamic onipL1Plural;
+@dynamic oinoL1Object;
+@dynamic pinapinapL1Plural;
+@dynamic pinonipL1Plural;
+@dynamic pinapinoL1Object;
+@dynamic pinoinoL1Object;
+@dynamic onipinapL1Plural;
+@dynamic oinonipL1Plural;
+@dynamic onipinoL1Object;
+@dynamic oinoinoL1Object;
+@dynamic captureUserId;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JRCaptureUserSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JRCaptureUserPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRCaptureUserPropertyCount;
+}
+
+- (BOOL)getBasicBooleanBoolValue
+{
+    return [self.basicBoolean boolValue];
+}
+
+- (void)setBasicBooleanWithBool:(BOOL)boolVal
+{
+    self.basicBoolean = [NSNumber numberWithBool:boolVal];
+}
+
+- (NSInteger)getBasicIntegerIntegerValue
+{
+    return [self.basicInteger integerValue];
+}
+
+- (void)setBasicIntegerWithInteger:(NSInteger)integerVal
+{
+    self.basicInteger = [NSNumber numberWithInteger:integerVal];
+}
+
++ (id)captureUser
+{
+    return [[JRCaptureUser alloc] init];
+}
+
++ (id)captureUserObjectFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath
+{
+    return [self captureObjectFromDictionary:dictionary withPath:capturePath fromDecoder:NO];
+}
+
++ (id)captureUserObjectFromJsonReader:(JRJsonReader *)reader withPath:(NSString *)capturePath
+{
+    return [self captureObjectFromJsonReader:reader withPath:capturePath];
+}
+
++ (id)captureUserObjectFromArchive:(JRCaptureArchiveReader *)reader
+{
+    return [self captureObjectFromArchive:reader];
+}
+
+- (void)decodeFromDictionary:(NSDictionary*)dictionary
+{
+    [self decodeAttributesFromDictionary:dictionary];
+}
+
+- (void)replaceBasicPluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.basicPlural named:@"basicPlural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replacePluralTestUniqueArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.pluralTestUnique named:@"pluralTestUnique" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replacePluralTestAlphabeticArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.pluralTestAlphabetic named:@"pluralTestAlphabetic" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replaceSimpleStringPluralOneArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.simpleStringPluralOne named:@"simpleStringPluralOne" isArrayOfStrings:YES
+                       withType:@"simpleTypeOne" forDelegate:delegate withContext:context];
+}
+
+- (void)replaceSimpleStringPluralTwoArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.simpleStringPluralTwo named:@"simpleStringPluralTwo" isArrayOfStrings:YES
+                       withType:@"simpleTypeTwo" forDelegate:delegate withContext:context];
+}
+
+- (void)replacePinapL1PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.pinapL1Plural named:@"pinapL1Plural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replaceOnipL1PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.onipL1Plural named:@"onipL1Plural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replacePinapinapL1PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.pinapinapL1Plural named:@"pinapinapL1Plural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replacePinonipL1PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.pinonipL1Plural named:@"pinonipL1Plural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replaceOnipinapL1PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.onipinapL1Plural named:@"onipinapL1Plural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (void)replaceOinonipL1PluralArrayOnCaptureForDelegate:(id<JRCaptureObjectDelegate>)delegate context:(NSObject *)context
+{
+    [self replaceArrayOnCapture:self.oinonipL1Plural named:@"oinonipL1Plural" isArrayOfStrings:NO
+                       withType:@"" forDelegate:delegate withContext:context];
+}
+
+- (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser
+{
+    return [self isEqualToCaptureObject:otherCaptureUser];
+}
+
+@end
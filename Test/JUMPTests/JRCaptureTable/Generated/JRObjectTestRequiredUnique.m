@@ -0,0 +1,132 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JRObjectTestRequiredUnique.h"
+
+enum
+{
+    JRObjectTestRequiredUniqueRequiredStringProperty,
+    JRObjectTestRequiredUniqueUniqueStringProperty,
+    JRObjectTestRequiredUniqueRequiredUniqueStringProperty,
+    JRObjectTestRequiredUniquePropertyCount
+};
+
+static const char *const JRObjectTestRequiredUniquePropertyNames[] =
+{
+    "requiredString",
+    "uniqueString",
+    "requiredUniqueString",
+};
+
+static const JRCaptureAttribute JRObjectTestRequiredUniqueAttributes[] =
+{
+    { @"requiredString", "requiredString", @"requiredString", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeRequired, 0, JRObjectTestRequiredUniqueRequiredStringProperty, NULL, nil },
+    { @"uniqueString", "uniqueString", @"uniqueString", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeUnique, 0, JRObjectTestRequiredUniqueUniqueStringProperty, NULL, nil },
+    { @"requiredUniqueString", "requiredUniqueString", @"requiredUniqueString", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeRequired | JRCaptureAttributeUnique, 0, JRObjectTestRequiredUniqueRequiredUniqueStringProperty, NULL, nil },
+};
+
+static const JRCaptureSchema JRObjectTestRequiredUniqueSchema =
+{
+    @"objectTestRequiredUnique", @"objectTestRequiredUnique", @"/objectTestRequiredUnique", NO, NO,
+    sizeof(JRObjectTestRequiredUniqueAttributes) / sizeof(JRObjectTestRequiredUniqueAttributes[0]), JRObjectTestRequiredUniqueAttributes
+};
+
+@interface JRObjectTestRequiredUnique ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JRObjectTestRequiredUnique
+@dynamic requiredString;
+@dynamic uniqueString;
+@dynamic requiredUniqueString;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JRObjectTestRequiredUniqueSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JRObjectTestRequiredUniquePropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRObjectTestRequiredUniquePropertyCount;
+}
+
+- (id)initWithRequiredString:(NSString *)newRequiredString andRequiredUniqueString:(NSString *)newRequiredUniqueString
+{
+    if (!newRequiredString || !newRequiredUniqueString)
+    {
+        return nil;
+     }
+
+    if ((self = [super init]))
+    {
+
+        self.requiredString = newRequiredString;
+        self.requiredUniqueString = newRequiredUniqueString;
+
+        [self setAllPropertiesToDirty];
+    }
+    return self;
+}
+
++ (id)objectTestRequiredUnique
+{
+    return [[JRObjectTestRequiredUnique alloc] init];
+}
+
++ (id)objectTestRequiredUniqueWithRequiredString:(NSString *)requiredString andRequiredUniqueString:(NSString *)requiredUniqueString
+{
+    return [[JRObjectTestRequiredUnique alloc] initWithRequiredString:requiredString andRequiredUniqueString:requiredUniqueString];
+}
+
+- (BOOL)isEqualToObjectTestRequiredUnique:(JRObjectTestRequiredUnique *)otherObjectTestRequiredUnique
+{
+    return [self isEqualToCaptureObject:otherObjectTestRequiredUnique];
+}
+
+@end
@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JROinoL2Object.h"
+
+enum
+{
+    JROinoL2ObjectString1Property,
+    JROinoL2ObjectString2Property,
+    JROinoL2ObjectPropertyCount
+};
+
+static const char *const JROinoL2ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
+static const JRCaptureAttribute JROinoL2ObjectAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinoL2ObjectString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinoL2ObjectString2Property, NULL, nil },
+};
+
+static const JRCaptureSchema JROinoL2ObjectSchema =
+{
+    @"oinoL2Object", @"oinoL2Object", @"/oinoL1Object/oinoL2Object", NO, NO,
+    sizeof(JROinoL2ObjectAttributes) / sizeof(JROinoL2ObjectAttributes[0]), JROinoL2ObjectAttributes
+};
+
+@interface JROinoL2Object ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JROinoL2Object
+@dynamic string1;
+@dynamic string2;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JROinoL2ObjectSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinoL2ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinoL2ObjectPropertyCount;
+}
+
++ (id)oinoL2Object
+{
+    return [[JROinoL2Object alloc] init];
+}
+
+- (BOOL)isEqualToOinoL2Object:(JROinoL2Object *)otherOinoL2Object
+{
+    return [self isEqualToCaptureObject:otherOinoL2Object];
+}
+
+@end
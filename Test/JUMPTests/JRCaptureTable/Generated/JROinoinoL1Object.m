@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JROinoinoL1Object.h"
+
+enum
+{
+    JROinoinoL1ObjectString1Property,
+    JROinoinoL1ObjectString2Property,
+    JROinoinoL1ObjectOinoinoL2ObjectProperty,
+    JROinoinoL1ObjectPropertyCount
+};
+
+static const char *const JROinoinoL1ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinoinoL2Object",
+};
+
+static const JRCaptureAttribute JROinoinoL1ObjectAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinoinoL1ObjectString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinoinoL1ObjectString2Property, NULL, nil },
+    { @"oinoinoL2Object", "oinoinoL2Object", @"oinoinoL2Object", @"JROinoinoL2Object",
+      JRCaptureAttributeTypeObject, 0, 0, JROinoinoL1ObjectOinoinoL2ObjectProperty, "JROinoinoL2Object", nil },
+};
+
+static const JRCaptureSchema JROinoinoL1ObjectSchema =
+{
+    @"oinoinoL1Object", @"oinoinoL1Object", @"/oinoinoL1Object", NO, NO,
+    sizeof(JROinoinoL1ObjectAttributes) / sizeof(JROinoinoL1ObjectAttributes[0]), JROinoinoL1ObjectAttributes
+};
+
+@interface JROinoinoL1Object ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JROinoinoL1Object
+@dynamic string1;
+@dynamic string2;
+@dynamic oinoinoL2Object;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JROinoinoL1ObjectSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinoinoL1ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinoinoL1ObjectPropertyCount;
+}
+
++ (id)oinoinoL1Object
+{
+    return [[JROinoinoL1Object alloc] init];
+}
+
+- (BOOL)isEqualToOinoinoL1Object:(JROinoinoL1Object *)otherOinoinoL1Object
+{
+    return [self isEqualToCaptureObject:otherOinoinoL1Object];
+}
+
+@end
@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JROinoinoL3Object.h"
+
+enum
+{
+    JROinoinoL3ObjectString1Property,
+    JROinoinoL3ObjectString2Property,
+    JROinoinoL3ObjectPropertyCount
+};
+
+static const char *const JROinoinoL3ObjectPropertyNames[] =
+{
+    "string1",
+    "string2",
+};
+
+static const JRCaptureAttribute JROinoinoL3ObjectAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinoinoL3ObjectString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinoinoL3ObjectString2Property, NULL, nil },
+};
+
+static const JRCaptureSchema JROinoinoL3ObjectSchema =
+{
+    @"oinoinoL3Object", @"oinoinoL3Object", @"/oinoinoL1Object/oinoinoL2Object/oinoinoL3Object", NO, NO,
+    sizeof(JROinoinoL3ObjectAttributes) / sizeof(JROinoinoL3ObjectAttributes[0]), JROinoinoL3ObjectAttributes
+};
+
+@interface JROinoinoL3Object ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JROinoinoL3Object
+@dynamic string1;
+@dynamic string2;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JROinoinoL3ObjectSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinoinoL3ObjectPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinoinoL3ObjectPropertyCount;
+}
+
++ (id)oinoinoL3Object
+{
+    return [[JROinoinoL3Object alloc] init];
+}
+
+- (BOOL)isEqualToOinoinoL3Object:(JROinoinoL3Object *)otherOinoinoL3Object
+{
+    return [self isEqualToCaptureObject:otherOinoinoL3Object];
+}
+
+@end
@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JROinonipL1PluralElement.h"
+
+enum
+{
+    JROinonipL1PluralElementString1Property,
+    JROinonipL1PluralElementString2Property,
+    JROinonipL1PluralElementOinonipL2ObjectProperty,
+    JROinonipL1PluralElementPropertyCount
+};
+
+static const char *const JROinonipL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "oinonipL2Object",
+};
+
+static const JRCaptureAttribute JROinonipL1PluralElementAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinonipL1PluralElementString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROinonipL1PluralElementString2Property, NULL, nil },
+    { @"oinonipL2Object", "oinonipL2Object", @"oinonipL2Object", @"JROinonipL2Object",
+      JRCaptureAttributeTypeObject, 0, 0, JROinonipL1PluralElementOinonipL2ObjectProperty, "JROinonipL2Object", nil },
+};
+
+static const JRCaptureSchema JROinonipL1PluralElementSchema =
+{
+    @"oinonipL1PluralElement", @"oinonipL1Plural", @"", YES, YES,
+    sizeof(JROinonipL1PluralElementAttributes) / sizeof(JROinonipL1PluralElementAttributes[0]), JROinonipL1PluralElementAttributes
+};
+
+@interface JROinonipL1PluralElement ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JROinonipL1PluralElement
+@dynamic string1;
+@dynamic string2;
+@dynamic oinonipL2Object;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JROinonipL1PluralElementSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JROinonipL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROinonipL1PluralElementPropertyCount;
+}
+
++ (id)oinonipL1PluralElement
+{
+    return [[JROinonipL1PluralElement alloc] init];
+}
+
+- (BOOL)isEqualToOinonipL1PluralElement:(JROinonipL1PluralElement *)otherOinonipL1PluralElement
+{
+    return [self isEqualToCaptureObject:otherOinonipL1PluralElement];
+}
+
+@end
@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JROnipinoL2PluralElement.h"
+
+enum
+{
+    JROnipinoL2PluralElementString1Property,
+    JROnipinoL2PluralElementString2Property,
+    JROnipinoL2PluralElementOnipinoL3ObjectProperty,
+    JROnipinoL2PluralElementPropertyCount
+};
+
+static const char *const JROnipinoL2PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "onipinoL3Object",
+};
+
+static const JRCaptureAttribute JROnipinoL2PluralElementAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROnipinoL2PluralElementString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JROnipinoL2PluralElementString2Property, NULL, nil },
+    { @"onipinoL3Object", "onipinoL3Object", @"onipinoL3Object", @"JROnipinoL3Object",
+      JRCaptureAttributeTypeObject, 0, 0, JROnipinoL2PluralElementOnipinoL3ObjectProperty, "JROnipinoL3Object", nil },
+};
+
+static const JRCaptureSchema JROnipinoL2PluralElementSchema =
+{
+    @"onipinoL2PluralElement", @"onipinoL2Plural", @"", YES, YES,
+    sizeof(JROnipinoL2PluralElementAttributes) / sizeof(JROnipinoL2PluralElementAttributes[0]), JROnipinoL2PluralElementAttributes
+};
+
+@interface JROnipinoL2PluralElement ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JROnipinoL2PluralElement
+@dynamic string1;
+@dynamic string2;
+@dynamic onipinoL3Object;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JROnipinoL2PluralElementSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JROnipinoL2PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JROnipinoL2PluralElementPropertyCount;
+}
+
++ (id)onipinoL2PluralElement
+{
+    return [[JROnipinoL2PluralElement alloc] init];
+}
+
+- (BOOL)isEqualToOnipinoL2PluralElement:(JROnipinoL2PluralElement *)otherOnipinoL2PluralElement
+{
+    return [self isEqualToCaptureObject:otherOnipinoL2PluralElement];
+}
+
+@end
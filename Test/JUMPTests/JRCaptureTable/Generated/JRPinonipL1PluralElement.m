@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JRPinonipL1PluralElement.h"
+
+enum
+{
+    JRPinonipL1PluralElementString1Property,
+    JRPinonipL1PluralElementString2Property,
+    JRPinonipL1PluralElementPinonipL2ObjectProperty,
+    JRPinonipL1PluralElementPropertyCount
+};
+
+static const char *const JRPinonipL1PluralElementPropertyNames[] =
+{
+    "string1",
+    "string2",
+    "pinonipL2Object",
+};
+
+static const JRCaptureAttribute JRPinonipL1PluralElementAttributes[] =
+{
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRPinonipL1PluralElementString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRPinonipL1PluralElementString2Property, NULL, nil },
+    { @"pinonipL2Object", "pinonipL2Object", @"pinonipL2Object", @"JRPinonipL2Object",
+      JRCaptureAttributeTypeObject, 0, 0, JRPinonipL1PluralElementPinonipL2ObjectProperty, "JRPinonipL2Object", nil },
+};
+
+static const JRCaptureSchema JRPinonipL1PluralElementSchema =
+{
+    @"pinonipL1PluralElement", @"pinonipL1Plural", @"", YES, YES,
+    sizeof(JRPinonipL1PluralElementAttributes) / sizeof(JRPinonipL1PluralElementAttributes[0]), JRPinonipL1PluralElementAttributes
+};
+
+@interface JRPinonipL1PluralElement ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JRPinonipL1PluralElement
+@dynamic string1;
+@dynamic string2;
+@dynamic pinonipL2Object;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JRPinonipL1PluralElementSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPinonipL1PluralElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPinonipL1PluralElementPropertyCount;
+}
+
++ (id)pinonipL1PluralElement
+{
+    return [[JRPinonipL1PluralElement alloc] init];
+}
+
+- (BOOL)isEqualToPinonipL1PluralElement:(JRPinonipL1PluralElement *)otherPinonipL1PluralElement
+{
+    return [self isEqualToCaptureObject:otherPinonipL1PluralElement];
+}
+
+@end
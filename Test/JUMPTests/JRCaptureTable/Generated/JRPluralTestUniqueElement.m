@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2012, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifdef DEBUG
+#define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+#else
+#define DLog(...)
+#endif
+
+#define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+
+#import "JRCaptureObject+Internal.h"
+#import "JRPluralTestUniqueElement.h"
+
+enum
+{
+    JRPluralTestUniqueElementUniqueStringProperty,
+    JRPluralTestUniqueElementString1Property,
+    JRPluralTestUniqueElementString2Property,
+    JRPluralTestUniqueElementPropertyCount
+};
+
+static const char *const JRPluralTestUniqueElementPropertyNames[] =
+{
+    "uniqueString",
+    "string1",
+    "string2",
+};
+
+static const JRCaptureAttribute JRPluralTestUniqueElementAttributes[] =
+{
+    { @"uniqueString", "uniqueString", @"uniqueString", @"NSString",
+      JRCaptureAttributeTypeValue, JRCaptureAttributeUnique, 0, JRPluralTestUniqueElementUniqueStringProperty, NULL, nil },
+    { @"string1", "string1", @"string1", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRPluralTestUniqueElementString1Property, NULL, nil },
+    { @"string2", "string2", @"string2", @"NSString",
+      JRCaptureAttributeTypeValue, 0, 0, JRPluralTestUniqueElementString2Property, NULL, nil },
+};
+
+static const JRCaptureSchema JRPluralTestUniqueElementSchema =
+{
+    @"pluralTestUniqueElement", @"pluralTestUnique", @"", YES, YES,
+    sizeof(JRPluralTestUniqueElementAttributes) / sizeof(JRPluralTestUniqueElementAttributes[0]), JRPluralTestUniqueElementAttributes
+};
+
+@interface JRPluralTestUniqueElement ()
+@property BOOL canBeUpdatedOnCapture;
+@end
+
+@implementation JRPluralTestUniqueElement
+@dynamic uniqueString;
+@dynamic string1;
+@dynamic string2;
+@synthesize canBeUpdatedOnCapture;
+
++ (const JRCaptureSchema *)captureSchema
+{
+    return &JRPluralTestUniqueElementSchema;
+}
+
++ (const char *const *)dirtyPropertyNames
+{
+    return JRPluralTestUniqueElementPropertyNames;
+}
+
++ (NSUInteger)dirtyPropertyCount
+{
+    return JRPluralTestUniqueElementPropertyCount;
+}
+
++ (id)pluralTestUniqueElement
+{
+    return [[JRPluralTestUniqueElement alloc] init];
+}
+
+- (BOOL)isEqualToPluralTestUniqueElement:(JRPluralTestUniqueElement *)otherPluralTestUniqueElement
+{
+    return [self isEqualToCaptureObject:otherPluralTestUniqueElement];
+}
+
+@end
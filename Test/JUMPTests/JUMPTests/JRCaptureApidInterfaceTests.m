@@ -0,0 +1,620 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import <OCMock/OCMock.h>
+#import "JRCaptureApidInterface.h"
+#import "JRConnectionManager.h"
+#import "JRConnectionTransport.h"
+#import "JRConnectionMetrics.h"
+#import "JRCaptureData.h"
+#import "JRJsonUtils.h"
+#import "JRCaptureUser.h"
+#import "JRCapture.h"
+
+@interface JRCapture (JRCaptureApidInterfaceTests)
++ (void)startRefreshAccessTokenWithCompletion:(void (^)(NSError *error))completion;
+@end
+
+/**
+ * Answers every task in-process and synchronously with the same body, so that a benchmark run through it only measures
+ * the client side: building the request, routing the response and parsing it
+ */
+@interface JRCaptureApidInterfaceTestTransport : NSObject <JRConnectionTransport>
+@property NSData *body;
+@end
+
+@implementation JRCaptureApidInterfaceTestTransport
+- (BOOL)canHandleRequest:(NSURLRequest *)request
+{
+    return YES;
+}
+
+- (id)newTaskWithRequest:(NSURLRequest *)request client:(id <JRConnectionTransportClient>)client
+{
+    return [NSArray arrayWithObjects:request, client, nil];
+}
+
+- (void)resumeTask:(id)task
+{
+    NSURLRequest *request = [task objectAtIndex:0];
+    id <JRConnectionTransportClient> client = [task objectAtIndex:1];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[request URL] statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    [client transportTask:task didReceiveResponse:response];
+    [client transportTask:task didReceiveData:self.body];
+    [client transportTask:task didCompleteWithError:nil];
+}
+
+- (void)cancelTask:(id)task
+{
+}
+
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler
+{
+}
+@end
+
+/**
+ * A stand-in for Capture that expires access tokens on a schedule: each token it issues is good for tokenLifetime
+ * seconds, and only until the next one is issued. Answers /oauth/refresh_access_token with a new token, /entity* with
+ * a 414 "access_token_expired" error unless the access token is current, and records how many times each request it
+ * saw had been sent before.
+ */
+@interface JRExpiringTokenTestTransport : NSObject <JRConnectionTransport>
+@property(readonly) NSTimeInterval tokenLifetime;
+@property(readonly) NSString *currentToken;
+@property(readonly) NSUInteger refreshCount;
+@property(readonly) NSUInteger expiredCount;
+@property(readonly) NSMutableArray *retryCounts;
+@end
+
+@implementation JRExpiringTokenTestTransport
+{
+    CFAbsoluteTime _issueTime;
+}
+
+- (id)initWithTokenLifetime:(NSTimeInterval)tokenLifetime
+{
+    if ((self = [super init]))
+    {
+        _tokenLifetime = tokenLifetime;
+        _currentToken = @"token0";
+        _issueTime = CFAbsoluteTimeGetCurrent();
+        _retryCounts = [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (NSDictionary *)paramsOfRequest:(NSURLRequest *)request
+{
+    NSMutableDictionary *params = [NSMutableDictionary dictionary];
+    NSString *body = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
+    for (NSString *pair in [body componentsSeparatedByString:@"&"])
+    {
+        NSArray *parts = [pair componentsSeparatedByString:@"="];
+        if ([parts count] == 2) [params setObject:[parts objectAtIndex:1] forKey:[parts objectAtIndex:0]];
+    }
+
+    return params;
+}
+
+- (NSData *)bodyForRequest:(NSURLRequest *)request
+{
+    NSDictionary *response;
+    @synchronized (self)
+    {
+        if ([[[request URL] path] isEqualToString:@"/oauth/refresh_access_token"])
+        {
+            _refreshCount++;
+            _currentToken = [NSString stringWithFormat:@"token%lu", (unsigned long) _refreshCount];
+            _issueTime = CFAbsoluteTimeGetCurrent();
+            response = @{ @"stat" : @"ok", @"access_token" : _currentToken, @"expires_in" : @(_tokenLifetime) };
+        }
+        else
+        {
+            NSNumber *retries = [NSURLProtocol propertyForKey:JRRequestRetryCountProperty inRequest:request];
+            [_retryCounts addObject:retries ? retries : @0];
+
+            NSString *token = [[self paramsOfRequest:request] objectForKey:@"access_token"];
+            if ([token isEqualToString:_currentToken] && CFAbsoluteTimeGetCurrent() - _issueTime < _tokenLifetime)
+            {
+                response = @{ @"stat" : @"ok", @"result" : @{ @"basicString" : @"value" } };
+            }
+            else
+            {
+                _expiredCount++;
+                response = @{ @"stat" : @"error", @"code" : @414, @"error" : @"access_token_expired" };
+            }
+        }
+    }
+
+    return [NSJSONSerialization dataWithJSONObject:response options:(NSJSONWritingOptions) 0 error:nil];
+}
+
+- (BOOL)canHandleRequest:(NSURLRequest *)request
+{
+    return YES;
+}
+
+- (id)newTaskWithRequest:(NSURLRequest *)request client:(id <JRConnectionTransportClient>)client
+{
+    return [NSArray arrayWithObjects:request, client, nil];
+}
+
+- (void)resumeTask:(id)task
+{
+    NSURLRequest *request = [task objectAtIndex:0];
+    id <JRConnectionTransportClient> client = [task objectAtIndex:1];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[request URL] statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    [client transportTask:task didReceiveResponse:response];
+    [client transportTask:task didReceiveData:[self bodyForRequest:request]];
+    [client transportTask:task didCompleteWithError:nil];
+}
+
+- (void)cancelTask:(id)task
+{
+}
+
+- (void)sendAsynchronousRequest:(NSURLRequest *)request queue:(NSOperationQueue *)queue
+              completionHandler:(void (^)(NSURLResponse *response, NSData *data, NSError *error))handler
+{
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[request URL] statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    NSData *body = [self bodyForRequest:request];
+    [queue addOperationWithBlock:^
+    {
+        handler(response, body, nil);
+    }];
+}
+@end
+
+@interface JRCaptureApidInterfaceTestDelegate : NSObject <JRCaptureInternalDelegate>
+@property NSMutableArray *contexts;
+
+/* Called after each result is recorded */
+@property(copy) void (^didRecordResult)(void);
+@end
+
+@implementation JRCaptureApidInterfaceTestDelegate
+- (id)init
+{
+    if ((self = [super init])) _contexts = [NSMutableArray array];
+    return self;
+}
+
+- (void)recordResult:(NSString *)result context:(NSObject *)context
+{
+    [self.contexts addObject:[NSString stringWithFormat:@"%@ %@", result, context]];
+    if (self.didRecordResult) self.didRecordResult();
+}
+
+- (void)getCaptureUserDidSucceedWithResult:(NSDictionary *)result context:(NSObject *)context
+{
+    [self recordResult:@"user" context:context];
+}
+
+- (void)getCaptureObjectDidSucceedWithResult:(NSObject *)result context:(NSObject *)context
+{
+    [self recordResult:@"object" context:context];
+}
+
+- (void)getCaptureUserDidFailWithResult:(NSDictionary *)result context:(NSObject *)context
+{
+    [self recordResult:@"user failed" context:context];
+}
+
+- (void)getCaptureObjectDidFailWithResult:(NSObject *)result context:(NSObject *)context
+{
+    [self recordResult:@"object failed" context:context];
+}
+
+- (void)updateCaptureObjectDidSucceedWithResult:(NSObject *)result context:(NSObject *)context
+{
+    [self recordResult:@"update" context:context];
+}
+
+- (void)updateCaptureObjectDidFailWithResult:(NSDictionary *)result context:(NSObject *)context
+{
+    [self recordResult:@"update failed" context:context];
+}
+@end
+
+@interface JRCaptureApidInterfaceTests : GHAsyncTestCase
+@property id connectionManager;
+@property id captureData;
+@property NSMutableArray *tags;
+@property NSMutableArray *requests;
+@end
+
+@implementation JRCaptureApidInterfaceTests
+
+/* Timers and the connection manager's callbacks run on the main run loop, which waitForStatus:timeout: runs */
+- (BOOL)shouldRunOnMainThread
+{
+    return YES;
+}
+
+- (void)setUp
+{
+    JRCaptureData *captureData = [[JRCaptureData alloc] init];
+    id mockData = [OCMockObject partialMockForObject:captureData];
+    [[[mockData stub] andReturn:@"https://base.uri"] captureBaseUrl];
+
+    self.captureData = [OCMockObject mockForClass:[JRCaptureData class]];
+    [[[self.captureData stub] andReturn:mockData] sharedCaptureData];
+
+    NSMutableArray *tags = [NSMutableArray array];
+    NSMutableArray *requests = [NSMutableArray array];
+    self.tags = tags;
+    self.requests = requests;
+    self.connectionManager = [OCMockObject mockForClass:[JRConnectionManager class]];
+    [[[self.connectionManager stub] andDo:^(NSInvocation *invocation)
+    {
+        __unsafe_unretained id tag;
+        __unsafe_unretained NSURLRequest *request;
+        [invocation getArgument:&tag atIndex:5];
+        [invocation getArgument:&request atIndex:2];
+        [tags addObject:tag];
+        [requests addObject:request];
+
+        bool created = YES;
+        [invocation setReturnValue:&created];
+    }] createConnectionFromRequest:OCMOCK_ANY forDelegate:OCMOCK_ANY returnFullResponse:YES withTag:OCMOCK_ANY];
+}
+
+- (void)tearDown
+{
+    [self.connectionManager stopMocking];
+    [self.captureData stopMocking];
+}
+
+- (void)finishTag:(id)tag withPayload:(NSString *)payload
+{
+    id <JRConnectionManagerDelegate> apid = (id <JRConnectionManagerDelegate>)
+            [JRCaptureApidInterface sharedCaptureApidInterface];
+    NSData *payloadData = [payload dataUsingEncoding:NSUTF8StringEncoding];
+    [apid connectionDidFinishLoadingWithFullResponse:nil unencodedPayload:payloadData request:nil andTag:tag];
+}
+
+- (void)test_identicalReadsShareOneRequest
+{
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    NSUInteger sent = [JRCaptureApidInterface sentReadCount];
+    NSUInteger coalesced = [JRCaptureApidInterface coalescedReadCount];
+
+    [JRCaptureApidInterface getCaptureUserWithToken:@"token1" forDelegate:delegate withContext:@"a"];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"token1" forDelegate:delegate withContext:@"b"];
+    [JRCaptureApidInterface getCaptureObjectAtPath:@"" withToken:@"token1" forDelegate:delegate withContext:@"c"];
+    [JRCaptureApidInterface getCaptureObjectAtPath:@"basicObject" withToken:@"token1" forDelegate:delegate
+                                       withContext:@"d"];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"token2" forDelegate:delegate withContext:@"e"];
+
+    GHAssertEquals([self.tags count], (NSUInteger) 3, nil);
+    GHAssertEquals([JRCaptureApidInterface sentReadCount] - sent, (NSUInteger) 3, nil);
+    GHAssertEquals([JRCaptureApidInterface coalescedReadCount] - coalesced, (NSUInteger) 2, nil);
+
+    [self finishTag:[self.tags objectAtIndex:0] withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+    GHAssertEqualObjects(delegate.contexts, (@[ @"user a", @"user b", @"object c" ]), nil);
+
+    [self finishTag:[self.tags objectAtIndex:2] withPayload:@"{\"stat\":\"error\"}"];
+    GHAssertEqualObjects([delegate.contexts lastObject], @"user failed e", nil);
+
+    // Once a read has finished, the next identical read goes to the network again
+    [JRCaptureApidInterface getCaptureUserWithToken:@"token1" forDelegate:delegate withContext:@"f"];
+    GHAssertEquals([self.tags count], (NSUInteger) 4, nil);
+
+    [self finishTag:[self.tags objectAtIndex:1] withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+    [self finishTag:[self.tags objectAtIndex:3] withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+}
+
+- (NSDictionary *)paramsOfRequest:(NSURLRequest *)request
+{
+    NSMutableDictionary *params = [NSMutableDictionary dictionary];
+    NSString *body = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
+    for (NSString *pair in [body componentsSeparatedByString:@"&"])
+    {
+        NSArray *parts = [pair componentsSeparatedByString:@"="];
+        if ([parts count] != 2) continue;
+        [params setObject:[[parts objectAtIndex:1] stringByReplacingPercentEscapesUsingEncoding:NSUTF8StringEncoding]
+                   forKey:[parts objectAtIndex:0]];
+    }
+
+    return params;
+}
+
+- (void)test_readsOfAProjectedUserOnlyAskForTheProjectedAttributes
+{
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    id user = [OCMockObject mockForClass:[JRCaptureUser class]];
+    [[[user stub] andReturn:(@[ @"email", @"primaryAddress.city", @"profiles" ])] attributeProjection];
+
+    [JRCaptureApidInterface getCaptureUserWithToken:@"token1" forDelegate:delegate withContext:nil];
+    [JRCaptureApidInterface getCaptureObjectAtPath:@"/primaryAddress" withToken:@"token1" forDelegate:delegate
+                                       withContext:nil];
+    [JRCaptureApidInterface getCaptureObjectAtPath:@"/profiles#3/profile" withToken:@"token1" forDelegate:delegate
+                                       withContext:nil];
+    [user stopMocking];
+
+    GHAssertEquals([self.requests count], (NSUInteger) 3, nil);
+    NSDictionary *params = [self paramsOfRequest:[self.requests objectAtIndex:0]];
+    GHAssertEqualObjects([[params objectForKey:@"attributes"] JR_objectFromJSONString],
+                         (@[ @"email", @"primaryAddress.city", @"profiles" ]), nil);
+
+    params = [self paramsOfRequest:[self.requests objectAtIndex:1]];
+    GHAssertEqualObjects([params objectForKey:@"attribute_name"], @"/primaryAddress", nil);
+    GHAssertEqualObjects([[params objectForKey:@"attributes"] JR_objectFromJSONString], (@[ @"city" ]), nil);
+
+    /* Plurals are projected whole, so their elements are read whole */
+    params = [self paramsOfRequest:[self.requests objectAtIndex:2]];
+    GHAssertNil([params objectForKey:@"attributes"], nil);
+
+    for (id tag in self.tags)
+        [self finishTag:tag withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+}
+
+- (void)test_perRequestClientOverheadNextToASyntheticReference
+{
+    const NSUInteger count = 2000;
+    NSDictionary *attributes = @{ @"basicString" : @"value", @"basicObject" : @{ @"string1" : @"a" } };
+    NSString *token = @"abcdefghijklmnopqrstuvwxyz012345";
+    NSData *responseData = [@"{\"stat\":\"ok\",\"result\":{\"basicString\":\"value\"}}"
+            dataUsingEncoding:NSUTF8StringEncoding];
+
+    // A synthetic reference, not the old code: a hand-written loop that builds the body a piece at a time, turns the
+    // response body into a string and back before parsing, and compares action strings in a chain. It only gives the
+    // request below a scale to be read against
+    NSArray *actions = @[ @"signinUser", @"getUser", @"getObject", @"updateObject" ];
+    NSUInteger matched = 0;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        NSString *escaped = [[attributes JR_jsonString] stringByAddingUrlPercentEscapes];
+        NSMutableData *body = [NSMutableData data];
+        NSString *arg = [NSString stringWithFormat:@"&attributes=%@", escaped];
+        [body appendData:[arg dataUsingEncoding:NSUTF8StringEncoding]];
+        arg = [NSString stringWithFormat:@"&access_token=%@", token];
+        [body appendData:[arg dataUsingEncoding:NSUTF8StringEncoding]];
+        [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
+        arg = [NSString stringWithFormat:@"&attribute_name=%@", @"/basicObject"];
+        [body appendData:[arg dataUsingEncoding:NSUTF8StringEncoding]];
+
+        NSString *payload = [[NSString alloc] initWithData:responseData encoding:NSUTF8StringEncoding];
+        NSDictionary *response = [payload JR_objectFromJSONString];
+        for (NSString *action in actions)
+            if ([action isEqualToString:@"updateObject"] && response) { matched++; break; }
+    }
+    NSTimeInterval reference = CFAbsoluteTimeGetCurrent() - start;
+    GHAssertEquals(matched, count, nil);
+
+    // A whole request, through the real connection manager and an in-process transport
+    [self.connectionManager stopMocking];
+    self.connectionManager = nil;
+    JRCaptureApidInterfaceTestTransport *transport = [[JRCaptureApidInterfaceTestTransport alloc] init];
+    transport.body = responseData;
+    [JRConnectionManager setTransport:transport];
+
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        [JRCaptureApidInterface updateCaptureObject:attributes atPath:@"/basicObject" withToken:token
+                                        forDelegate:delegate withContext:nil];
+    NSTimeInterval request = CFAbsoluteTimeGetCurrent() - start;
+    [JRConnectionManager setTransport:nil];
+
+    GHAssertEquals([JRConnectionManager openConnections], (NSUInteger) 0, nil);
+    GHTestLog(@"per-request client overhead: %.1fus for a whole request through the connection manager, next to "
+              "%.1fus for the synthetic body building and response handling reference", request * 1e6 / count,
+              reference * 1e6 / count);
+}
+
+- (void)test_requestsHeldBackOnTheTokensAgeAreSentWhenTheRefreshFails
+{
+    id data = [JRCaptureData sharedCaptureData];
+    [[[data stub] andReturn:@"secret"] refreshSecret];
+
+    __block NSUInteger refreshCount = 0;
+    id capture = [OCMockObject mockForClass:[JRCapture class]];
+    [[[capture stub] andDo:^(NSInvocation *invocation)
+    {
+        __unsafe_unretained void (^completion)(NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        refreshCount++;
+        completion([NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNotConnectedToInternet userInfo:nil]);
+    }] startRefreshAccessTokenWithCompletion:OCMOCK_ANY];
+
+    // By the client's clock the token has expired, but only Capture knows whether it has
+    [JRCaptureData setAccessToken:@"old" expiresIn:@0.01];
+    [NSThread sleepForTimeInterval:0.05];
+    GHAssertTrue([[JRCaptureData sharedCaptureData] accessTokenIsExpired], nil);
+
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"old" forDelegate:delegate withContext:@"a"];
+    GHAssertEquals(refreshCount, (NSUInteger) 1, nil);
+    GHAssertEquals([self.requests count], (NSUInteger) 1, @"the read should have been sent after the failed refresh");
+    GHAssertEqualObjects([[self paramsOfRequest:[self.requests objectAtIndex:0]] objectForKey:@"access_token"],
+                         @"old", nil);
+
+    // Nor is the next request held back on another refresh of a token that couldn't be refreshed
+    [JRCaptureApidInterface getCaptureObjectAtPath:@"/basicObject" withToken:@"old" forDelegate:delegate
+                                       withContext:@"b"];
+    GHAssertEquals(refreshCount, (NSUInteger) 1, nil);
+    GHAssertEquals([self.requests count], (NSUInteger) 2, nil);
+
+    for (id tag in self.tags)
+        [self finishTag:tag withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+    GHAssertEqualObjects(delegate.contexts, (@[ @"user a", @"object b" ]), nil);
+
+    [capture stopMocking];
+    [JRCaptureData clearSignInState];
+}
+
+- (void)test_requestsAreNotHeldBackWithoutARefreshSecret
+{
+    id data = [JRCaptureData sharedCaptureData];
+    [[[data stub] andReturn:nil] refreshSecret];
+    id capture = [OCMockObject mockForClass:[JRCapture class]];
+    [[capture reject] startRefreshAccessTokenWithCompletion:OCMOCK_ANY];
+
+    [JRCaptureData setAccessToken:@"old" expiresIn:@0.01];
+    [NSThread sleepForTimeInterval:0.05];
+
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"old" forDelegate:delegate withContext:@"a"];
+    GHAssertEquals([self.requests count], (NSUInteger) 1, nil);
+    [capture verify];
+
+    [self finishTag:[self.tags objectAtIndex:0] withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+    GHAssertEqualObjects(delegate.contexts, (@[ @"user a" ]), nil);
+
+    [capture stopMocking];
+    [JRCaptureData clearSignInState];
+}
+
+- (void)test_callbacksOffTheMainThreadAreHandledOnIt
+{
+    id data = [JRCaptureData sharedCaptureData];
+    [[[data stub] andReturn:@"secret"] refreshSecret];
+
+    __block void (^refreshCompletion)(NSError *) = nil;
+    id capture = [OCMockObject mockForClass:[JRCapture class]];
+    [[[capture stub] andDo:^(NSInvocation *invocation)
+    {
+        __unsafe_unretained void (^completion)(NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        refreshCompletion = [completion copy];
+    }] startRefreshAccessTokenWithCompletion:OCMOCK_ANY];
+
+    [JRCaptureData setAccessToken:@"old" expiresIn:@0.01];
+    [NSThread sleepForTimeInterval:0.05];
+
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"old" forDelegate:delegate withContext:@"a"];
+    GHAssertNotNil(refreshCompletion, nil);
+    GHAssertEquals([self.requests count], (NSUInteger) 0, nil);
+
+    // As they would with a callbackQueue other than the main queue, the refresh and the read finish on another thread
+    dispatch_queue_t queue = dispatch_queue_create("com.janrain.test.callbacks", DISPATCH_QUEUE_SERIAL);
+    dispatch_sync(queue, ^
+    {
+        refreshCompletion([NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNotConnectedToInternet
+                                          userInfo:nil]);
+    });
+    GHAssertEquals([self.requests count], (NSUInteger) 0, @"the parked read should only be sent from the main thread");
+
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:5.0];
+    while ([self.requests count] == 0 && [deadline timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+    GHAssertEquals([self.requests count], (NSUInteger) 1, nil);
+
+    dispatch_sync(queue, ^
+    {
+        [self finishTag:[self.tags objectAtIndex:0] withPayload:@"{\"stat\":\"ok\",\"result\":{}}"];
+    });
+    GHAssertEquals([delegate.contexts count], (NSUInteger) 0, nil);
+
+    deadline = [NSDate dateWithTimeIntervalSinceNow:5.0];
+    while ([delegate.contexts count] == 0 && [deadline timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+    GHAssertEqualObjects(delegate.contexts, (@[ @"user a" ]), nil);
+
+    [capture stopMocking];
+    [JRCaptureData clearSignInState];
+}
+
+- (void)test_expiredTokensAreRefreshedOnceAndRequestsReplayed
+{
+    [self.connectionManager stopMocking];
+    self.connectionManager = nil;
+    JRExpiringTokenTestTransport *standIn = [[JRExpiringTokenTestTransport alloc] initWithTokenLifetime:0.8];
+    [JRConnectionManager setTransport:standIn];
+
+    id data = [JRCaptureData sharedCaptureData];
+    [[[data stub] andReturn:@"secret"] refreshSecret];
+    [[[data stub] andReturn:@"abc123"] clientId];
+    [[[data stub] andReturn:@"en-US"] captureLocale];
+    [[[data stub] andReturn:@"standard_flow"] captureFlowName];
+    [[[data stub] andReturn:@"123456"] downloadedFlowVersion];
+
+    // As far as the client knows the token is good, as it came without an expires_in, but the stand-in has already
+    // moved on from it
+    [JRCaptureData setAccessToken:@"stale"];
+    NSUInteger sentRefreshes = [JRCaptureApidInterface sentRefreshCount];
+
+    JRCaptureApidInterfaceTestDelegate *delegate = [[JRCaptureApidInterfaceTestDelegate alloc] init];
+    __weak JRCaptureApidInterfaceTestDelegate *weakDelegate = delegate;
+    SEL test = _cmd;
+    delegate.didRecordResult = ^
+    {
+        if ([weakDelegate.contexts count] == 4) [self notify:kGHUnitWaitStatusSuccess forSelector:test];
+    };
+
+    [self prepare];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"stale" forDelegate:delegate withContext:@"a"];
+    [JRCaptureApidInterface getCaptureUserWithToken:@"stale" forDelegate:delegate withContext:@"b"];
+    [JRCaptureApidInterface getCaptureObjectAtPath:@"/basicObject" withToken:@"stale" forDelegate:delegate
+                                       withContext:@"c"];
+    [JRCaptureApidInterface updateCaptureObject:@{ @"basicString" : @"value" } atPath:@"" withToken:@"stale"
+                                    forDelegate:delegate withContext:@"d"];
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:10.0];
+
+    // Three requests went out (the two user reads share one), all three expired, one refresh, three replays
+    GHAssertEqualObjects([delegate.contexts sortedArrayUsingSelector:@selector(compare:)],
+                         (@[ @"object c", @"update d", @"user a", @"user b" ]), nil);
+    GHAssertEquals(standIn.refreshCount, (NSUInteger) 1, nil);
+    GHAssertEquals([JRCaptureApidInterface sentRefreshCount] - sentRefreshes, (NSUInteger) 1, nil);
+    GHAssertEquals(standIn.expiredCount, (NSUInteger) 3, nil);
+    GHAssertEqualObjects(standIn.retryCounts, (@[ @0, @0, @0, @1, @1, @1 ]), nil);
+    GHAssertEqualObjects([[JRCaptureData sharedCaptureData] accessToken], @"token1", nil);
+    GHAssertEquals([[JRCaptureData sharedCaptureData] accessTokenLifetime], standIn.tokenLifetime, nil);
+
+    // The new token lasts 0.8s, so the client refreshes it in the background 0.2s before it would expire
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:5.0];
+    while (![[[JRCaptureData sharedCaptureData] accessToken] isEqualToString:@"token2"] &&
+            [deadline timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+    GHAssertEquals(standIn.refreshCount, (NSUInteger) 2, nil);
+    GHAssertEqualObjects([[JRCaptureData sharedCaptureData] accessToken], @"token2", nil);
+
+    [delegate.contexts removeAllObjects];
+    delegate.didRecordResult = nil;
+    [JRCaptureApidInterface getCaptureUserWithToken:@"token2" forDelegate:delegate withContext:@"e"];
+    GHAssertEqualObjects(delegate.contexts, (@[ @"user e" ]), @"nothing should have had to wait on a refresh");
+    GHAssertEquals(standIn.expiredCount, (NSUInteger) 3, nil);
+
+    [JRConnectionManager setTransport:nil];
+    [JRCaptureData clearSignInState];
+}
+
+@end
@@ -33,11 +33,43 @@
 #import "JRCaptureFlow.h"
 #import <OCMock/OCMock.h>
 
+@interface JRCaptureData (JRCaptureDataTests)
++ (void)writeFlowData:(NSData *)flowData forUrl:(NSString *)url response:(NSHTTPURLResponse *)response;
++ (void)removeCachedFlow;
+@property(nonatomic) BOOL flowLoadPending;
+@end
+
 @interface JRCaptureDataTests : GHTestCase
 @end
 
 @implementation JRCaptureDataTests
 
+/**
+ * About the size of a large production flow: formCount forms of fieldsPerForm fields each
+ */
++ (NSDictionary *)flowDictionaryWithForms:(NSUInteger)formCount fieldsPerForm:(NSUInteger)fieldsPerForm
+{
+    NSMutableDictionary *fields = [NSMutableDictionary dictionary];
+    NSMutableDictionary *paths = [NSMutableDictionary dictionary];
+    for (NSUInteger f = 0; f < formCount; f++)
+    {
+        NSMutableArray *formFields = [NSMutableArray array];
+        for (NSUInteger i = 0; i < fieldsPerForm; i++)
+        {
+            NSString *name = [NSString stringWithFormat:@"form%lu_field%lu", (unsigned long) f, (unsigned long) i];
+            NSString *schemaId = [NSString stringWithFormat:@"object%lu.attribute%lu", (unsigned long) f,
+                                                            (unsigned long) i];
+            NSString *type = i == fieldsPerForm - 1 ? @"password" : (i == fieldsPerForm / 2 ? @"email" : @"select");
+            [fields setObject:@{ @"type" : type, @"schemaId" : schemaId, @"label" : name } forKey:name];
+            [paths setObject:schemaId forKey:name];
+            [formFields addObject:name];
+        }
+        [fields setObject:@{ @"fields" : formFields } forKey:[NSString stringWithFormat:@"form%lu", (unsigned long) f]];
+    }
+
+    return @{ @"version" : @"12345", @"fields" : fields, @"schema_info" : @{ @"paths" : paths } };
+}
+
 - (void)test_getForgottenPasswordFieldName
 {
     NSDictionary *flow = @{
@@ -79,6 +111,95 @@
     GHAssertEqualStrings([mockData getForgottenPasswordFieldName], @"username", nil, nil);
 }
 
+- (void)test_flowLookupsOnAProductionSizedFlow
+{
+    const NSUInteger formCount = 40, fieldsPerForm = 30;
+    NSDictionary *flowDict = [JRCaptureDataTests flowDictionaryWithForms:formCount fieldsPerForm:fieldsPerForm];
+    NSDictionary *fields = [flowDict objectForKey:@"fields"];
+
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    JRCaptureFlow *flow = [JRCaptureFlow flowWithDictionary:flowDict];
+    NSTimeInterval indexing = CFAbsoluteTimeGetCurrent() - start;
+
+    GHAssertEqualObjects([flow userIdentifyingFieldForForm:@"form7"], @"form7_field15", nil);
+    GHAssertEqualObjects([flow passwordFieldForForm:@"form7"], @"form7_field29", nil);
+    GHAssertEqualObjects([flow fieldNameForSchemaId:@"object7.attribute3"], @"form7_field3", nil);
+    GHAssertEqualObjects([flow schemaIdForFieldName:@"form7_field3"], @"object7.attribute3", nil);
+    GHAssertEqualObjects([[flow fieldForName:@"form7_field3"] objectForKey:@"label"], @"form7_field3", nil);
+    GHAssertEquals([[flow fieldNamesForForm:@"form7"] count], fieldsPerForm, nil);
+    GHAssertNil([flow userIdentifyingFieldForForm:@"noSuchForm"], nil);
+
+    // The same lookups as they used to be made, walking the flow's dictionaries every time
+    const NSUInteger runs = 1000;
+    NSUInteger found = 0;
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger r = 0; r < runs; r++)
+    {
+        NSString *formName = [NSString stringWithFormat:@"form%lu", (unsigned long) (r % formCount)];
+        for (NSString *fieldName in [[fields objectForKey:formName] objectForKey:@"fields"])
+        {
+            NSString *type = [[fields objectForKey:fieldName] objectForKey:@"type"];
+            if ([type isEqualToString:@"email"] || [type isEqualToString:@"text"]) { found++; break; }
+        }
+        for (id key in fields)
+            if ([key isEqual:@"form39_field29"]) { found++; break; }
+    }
+    NSTimeInterval walked = (CFAbsoluteTimeGetCurrent() - start) / runs;
+    GHAssertEquals(found, 2 * runs, nil);
+
+    found = 0;
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger r = 0; r < runs; r++)
+    {
+        NSString *formName = [NSString stringWithFormat:@"form%lu", (unsigned long) (r % formCount)];
+        if ([flow userIdentifyingFieldForForm:formName]) found++;
+        if ([flow fieldForName:@"form39_field29"]) found++;
+    }
+    NSTimeInterval indexed = (CFAbsoluteTimeGetCurrent() - start) / runs;
+    GHAssertEquals(found, 2 * runs, nil);
+
+    GHTestLog(@"flow of %lu fields: indexed once in %.2fms; an identifying field and a field definition looked up in "
+              "%.2fus by walking the flow, %.2fus from the index", (unsigned long) [fields count], indexing * 1e3,
+              walked * 1e6, indexed * 1e6);
+}
+
+- (void)test_flowColdStart
+{
+    NSDictionary *flowDict = [JRCaptureDataTests flowDictionaryWithForms:40 fieldsPerForm:30];
+    NSData *archived = [NSKeyedArchiver archivedDataWithRootObject:flowDict];
+    NSData *json = [NSJSONSerialization dataWithJSONObject:flowDict options:0 error:nil];
+    JRCaptureData *captureData = [JRCaptureData sharedCaptureData];
+    const NSUInteger runs = 20;
+
+    // What setCaptureConfig: used to do before returning: unarchive the whole flow from the user defaults
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+        @autoreleasepool
+        {
+            [JRCaptureFlow flowWithDictionary:[NSKeyedUnarchiver unarchiveObjectWithData:archived]];
+        }
+    NSTimeInterval unarchived = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    // Now setCaptureConfig: only marks the flow to be loaded, and the flow cache is read when the flow is first used
+    [JRCaptureData writeFlowData:json forUrl:@"https://flow.url" response:nil];
+    NSTimeInterval configured = 0, ready = 0;
+    for (NSUInteger i = 0; i < runs; i++)
+        @autoreleasepool
+        {
+            start = CFAbsoluteTimeGetCurrent();
+            captureData.flowLoadPending = YES;
+            configured += CFAbsoluteTimeGetCurrent() - start;
+            GHAssertEqualObjects([captureData downloadedFlowVersion], @"12345", nil);
+            ready += CFAbsoluteTimeGetCurrent() - start;
+        }
+    [JRCaptureData removeCachedFlow];
+
+    GHAssertEqualObjects([captureData.captureFlow fieldNameForSchemaId:@"object3.attribute4"], @"form3_field4", nil);
+    GHTestLog(@"flow of %lu bytes: %.2fms to unarchive from the user defaults at launch; now %.3fms at launch and "
+              "%.2fms to read from the flow cache when first used", (unsigned long) [json length], unarchived * 1e3,
+              configured / runs * 1e3, ready / runs * 1e3);
+}
+
 - (void)test_getForgottenPasswordFieldName_returns_nil_when_no_form
 {
     NSDictionary *flow = @{ };
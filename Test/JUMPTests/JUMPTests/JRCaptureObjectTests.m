@@ -29,8 +29,87 @@
 
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#import <malloc/malloc.h>
 #import <GHUnitIOS/GHUnit.h>
+#import <OCMock/OCMock.h>
+#import "JRCaptureObject+Internal.h"
+#import "JRCaptureApidInterface.h"
+#import "JRCaptureUser.h"
+#import "JRCaptureUser+Extras.h"
+#import "JRBasicPluralElement.h"
+#import "JRConnectionManager.h"
+#import "JRJsonUtils.h"
+#import "JRCaptureError.h"
+#import "JRNSDate+ISO8601_CaptureDateTimeString.h"
 
+@interface JRCaptureObjectTestDelegate : NSObject <JRCaptureObjectTesterDelegate>
+@property NSMutableArray *events;
+@property NSError *lastError;
+@end
+
+@implementation JRCaptureObjectTestDelegate
+- (id)init
+{
+    if ((self = [super init])) _events = [NSMutableArray array];
+    return self;
+}
+
+- (void)updateDidSucceedForObject:(JRCaptureObject *)object context:(NSObject *)context
+{
+    [self.events addObject:[NSString stringWithFormat:@"succeeded %@", context]];
+}
+
+- (void)updateDidFailForObject:(JRCaptureObject *)object withError:(NSError *)error context:(NSObject *)context
+{
+    [self.events addObject:[NSString stringWithFormat:@"failed %@", context]];
+    self.lastError = error;
+}
+
+- (void)replaceDidFailForObject:(JRCaptureObject *)object withError:(NSError *)error context:(NSObject *)context
+{
+    [self.events addObject:[NSString stringWithFormat:@"replace failed %@", context]];
+    self.lastError = error;
+}
+@end
+
+/* Stands in for a user generated from a projection file that left out some of its attributes */
+@interface JRPartialCaptureUser : JRCaptureUser
+@end
+
+@implementation JRPartialCaptureUser
++ (BOOL)isPartialProjection
+{
+    return YES;
+}
+@end
+
+static NSDateFormatter *JRReferenceDateFormatter(NSString *format, NSInteger secondsFromGMT)
+{
+    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
+    [dateFormatter setLocale:[[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"]];
+    [dateFormatter setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT:secondsFromGMT]];
+    [dateFormatter setDateFormat:format];
+    return dateFormatter;
+}
+
+/* How dates were parsed before: each of these formats tried in turn until one fit */
+static NSDate *JRReferenceDateFromString(NSString *string, NSArray *formatters)
+{
+    for (NSDateFormatter *dateFormatter in formatters)
+    {
+        NSDate *date = [dateFormatter dateFromString:string];
+        if (date) return date;
+    }
+
+    return nil;
+}
+
+static size_t JRBytesInUse(void)
+{
+    malloc_statistics_t statistics;
+    malloc_zone_statistics(NULL, &statistics);
+    return statistics.size_in_use;
+}
 
 @interface JRCaptureObjectTests : GHTestCase
 @end
@@ -66,4 +145,482 @@
     GHAssertEqualStrings(capitalizedString, @"My Test String", @"Capitalized strings do not much");
 }
 
-@end
\ No newline at end of file
+- (void)test_captureDatesAgreeWithNSDateFormatter
+{
+    NSArray *dateTimeFormats = @[ @"yyyy-MM-dd HH:mm:ss.SSSSSS ZZZ", @"yyyy-MM-dd'T'HH:mm:ss.SSSSSS ZZZ",
+            @"yyyy-MM-dd HH:mm:ss.SSSSSS", @"yyyy-MM-dd'T'HH:mm:ss.SSSSSS", @"yyyy-MM-dd HH:mm:ss ZZZ",
+            @"yyyy-MM-dd'T'HH:mm:ss ZZZ", @"yyyy-MM-dd HH:mm:ss", @"yyyy-MM-dd'T'HH:mm:ss" ];
+    NSArray *dateFormats = @[ @"yyyy-MM-dd", @"yyyyMMdd" ];
+    NSMutableArray *dateTimeParsers = [NSMutableArray array];
+    for (NSString *format in dateTimeFormats) [dateTimeParsers addObject:JRReferenceDateFormatter(format, 0)];
+    NSArray *dateParsers = @[ JRReferenceDateFormatter(@"yyyy-MM-dd", 0), JRReferenceDateFormatter(@"yyyyMMdd", 0) ];
+    NSArray *offsets = @[ @0, @(5 * 3600), @(-8 * 3600), @(5 * 3600 + 1800), @(-(9 * 3600 + 1800)) ];
+
+    const NSUInteger count = 2000;
+    NSMutableArray *dateTimeStrings = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray *dateStrings = [NSMutableArray arrayWithCapacity:count];
+    srandom(1);
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        // Whole eighths of a second, which both sides can carry exactly, from 1906 to 2096
+        long long seconds = (((long long) random() << 16) ^ random()) % 6000000000LL - 2000000000LL;
+        NSTimeInterval interval = (NSTimeInterval) seconds + (random() % 8) / 8.0;
+        NSDate *date = [NSDate dateWithTimeIntervalSince1970:interval];
+
+        GHAssertEqualStrings([date stringFromISO8601Date],
+                             [[dateParsers objectAtIndex:0] stringFromDate:date], nil);
+        GHAssertEqualStrings([date stringFromISO8601DateTime],
+                             [[dateTimeParsers objectAtIndex:0] stringFromDate:date], nil);
+        GHAssertEqualStrings([date stringFromISO8601DateTimeWithoutFraction],
+                             [[dateTimeParsers objectAtIndex:6] stringFromDate:date], nil);
+
+        NSInteger offset = [[offsets objectAtIndex:i % [offsets count]] integerValue];
+        NSString *format = [dateTimeFormats objectAtIndex:i % [dateTimeFormats count]];
+        [dateTimeStrings addObject:[JRReferenceDateFormatter(format, offset) stringFromDate:date]];
+        format = [dateFormats objectAtIndex:i % [dateFormats count]];
+        [dateStrings addObject:[JRReferenceDateFormatter(format, 0) stringFromDate:date]];
+    }
+    [dateTimeStrings addObjectsFromArray:@[ @"2012-02-02 01:33:20.122198 +0000", @"2012-02-02t01:33:20 +0100",
+            @"2012-02-30 01:33:20", @"2012-02-02 24:33:20", @"2012-02-02 01:33:20 +0000 and more", @"tomorrow" ]];
+    [dateStrings addObjectsFromArray:@[ @"2012-02-29", @"2011-02-29", @"2012-13-01", @"20120202", @"2012-0202" ]];
+
+    for (NSString *string in dateTimeStrings)
+    {
+        NSDate *expected = JRReferenceDateFromString([string uppercaseString], dateTimeParsers);
+        NSDate *actual = [NSDate dateFromISO8601DateTimeString:string];
+        GHAssertTrue((!expected && !actual) ||
+                     fabs([expected timeIntervalSince1970] - [actual timeIntervalSince1970]) < 1e-6, string);
+    }
+    for (NSString *string in dateStrings)
+    {
+        NSDate *expected = JRReferenceDateFromString(string, dateParsers);
+        NSDate *actual = [NSDate dateFromISO8601DateString:string];
+        GHAssertTrue((!expected && !actual) || [expected isEqualToDate:actual], string);
+    }
+
+    // The last format is the one a date-time without fractional seconds or a time zone, like utcTimeString's, needs
+    NSArray *lastStrings = [dateTimeStrings filteredArrayUsingPredicate:
+            [NSPredicate predicateWithFormat:@"SELF MATCHES '.*T[0-9:]*'"]];
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSString *string in lastStrings) JRReferenceDateFromString(string, dateTimeParsers);
+    NSTimeInterval before = (CFAbsoluteTimeGetCurrent() - start) / [lastStrings count];
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSString *string in lastStrings) [NSDate dateFromISO8601DateTimeString:string];
+    NSTimeInterval after = (CFAbsoluteTimeGetCurrent() - start) / [lastStrings count];
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSString *string in dateTimeStrings) [[NSDate dateFromISO8601DateTimeString:string] stringFromISO8601DateTime];
+    NSTimeInterval roundTrip = (CFAbsoluteTimeGetCurrent() - start) / [dateTimeStrings count];
+
+    GHTestLog(@"date-time in the last of eight formats: %.2fus through the NSDateFormatters, %.2fus now; %.2fus to "
+              "parse and format any date-time", before * 1e6, after * 1e6, roundTrip * 1e6);
+}
+
+- (void)test_batchedUpdatesAreMergedIntoOneRequest
+{
+    NSMutableArray *requests = [NSMutableArray array];
+    id apidInterface = [OCMockObject mockForClass:[JRCaptureApidInterface class]];
+    [[[apidInterface stub] andDo:^(NSInvocation *invocation)
+    {
+        __unsafe_unretained id dictionary, path, delegate, context;
+        [invocation getArgument:&dictionary atIndex:2];
+        [invocation getArgument:&path atIndex:3];
+        [invocation getArgument:&delegate atIndex:5];
+        [invocation getArgument:&context atIndex:6];
+        [requests addObject:@[ dictionary, path, delegate, context ]];
+    }] updateCaptureObject:OCMOCK_ANY atPath:OCMOCK_ANY withToken:OCMOCK_ANY forDelegate:OCMOCK_ANY
+               withContext:OCMOCK_ANY];
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    [captureUser deepClearDirtyProperties];
+    captureUser.basicString = @"basic";
+    captureUser.basicObject.string1 = @"string1";
+
+    JRCaptureObjectTestDelegate *delegate = [[JRCaptureObjectTestDelegate alloc] init];
+    [JRCaptureObject setUpdateBatchingWindow:60];
+    [captureUser.basicObject updateOnCaptureForDelegate:delegate context:@"object"];
+    [captureUser updateOnCaptureForDelegate:delegate context:@"user"];
+    GHAssertEquals([requests count], (NSUInteger) 0, nil);
+
+    [JRCaptureObject flushBatchedUpdates];
+    [JRCaptureObject setUpdateBatchingWindow:0];
+    [apidInterface stopMocking];
+
+    GHAssertEquals([requests count], (NSUInteger) 1, nil);
+    NSArray *request = [requests objectAtIndex:0];
+    NSDictionary *updateDictionary = [request objectAtIndex:0];
+    GHAssertEqualStrings([request objectAtIndex:1], @"", nil);
+    GHAssertEqualStrings([updateDictionary objectForKey:@"basicString"], @"basic", nil);
+    GHAssertEqualStrings([[updateDictionary objectForKey:@"basicObject"] objectForKey:@"string1"], @"string1", nil);
+    GHAssertFalse([captureUser.basicObject needsUpdate], nil);
+
+    // A failed batch messages every delegate and puts each object's dirty properties back
+    id <JRCaptureInternalDelegate> batchDelegate = [request objectAtIndex:2];
+    [batchDelegate updateCaptureObjectDidFailWithResult:@{ @"stat" : @"error" } context:[request objectAtIndex:3]];
+    GHAssertEqualObjects(delegate.events, (@[ @"failed object", @"failed user" ]), nil);
+    GHAssertTrue([captureUser.basicObject.dirtyPropertySet containsObject:@"string1"], nil);
+    GHAssertTrue([captureUser.dirtyPropertySet containsObject:@"basicString"], nil);
+
+    [batchDelegate updateCaptureObjectDidSucceedWithResult:@{ @"stat" : @"ok", @"result" : @"ok" }
+                                                   context:[request objectAtIndex:3]];
+    GHAssertEqualObjects([delegate.events subarrayWithRange:NSMakeRange(2, 2)],
+                         (@[ @"succeeded object", @"succeeded user" ]), nil);
+}
+
+- (void)test_updatesThatViolateConstraintsFailWithoutARoundTrip
+{
+    id apidInterface = [OCMockObject mockForClass:[JRCaptureApidInterface class]];
+    [[apidInterface reject] updateCaptureObjectWithAttributes:OCMOCK_ANY atPath:OCMOCK_ANY withToken:OCMOCK_ANY
+                                                  forDelegate:OCMOCK_ANY withContext:OCMOCK_ANY];
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    captureUser.objectTestRequiredUnique.requiredString = @"required";
+    captureUser.objectTestRequiredUnique.requiredUniqueString = @"required";
+    [captureUser deepClearDirtyProperties];
+    captureUser.stringTestAlphanumeric = @"not alphanumeric!";
+    captureUser.stringTestUnicodeLetters = @"Zo\u00eb";
+    captureUser.stringTestEmailAddress = @"user@example.com";
+    captureUser.objectTestRequired.requiredString = nil;
+
+    JRCaptureObjectTestDelegate *delegate = [[JRCaptureObjectTestDelegate alloc] init];
+    [captureUser updateOnCaptureForDelegate:delegate context:@"user"];
+    [apidInterface verify];
+    [apidInterface stopMocking];
+
+    // Only the first violation fails the update, and the dirty properties are kept for the next attempt
+    JRCaptureError *error = (JRCaptureError *) delegate.lastError;
+    GHAssertEqualObjects(delegate.events, (@[ @"failed user" ]), nil);
+    GHAssertTrue([error isConstraintViolationError], nil);
+    GHAssertEqualStrings([error violatingAttributePath], @"/stringTestAlphanumeric", nil);
+    GHAssertEqualStrings([error violatedConstraint], @"alphanumeric", nil);
+    GHAssertTrue([captureUser.dirtyPropertySet containsObject:@"stringTestAlphanumeric"], nil);
+
+    NSArray *errors = [captureUser validate];
+    GHAssertEquals([errors count], (NSUInteger) 2, nil);
+    GHAssertEqualStrings([[errors objectAtIndex:1] violatingAttributePath], @"/objectTestRequired/requiredString", nil);
+    GHAssertEqualStrings([[errors objectAtIndex:1] violatedConstraint], @"required", nil);
+
+    captureUser.stringTestAlphanumeric = @"alphanumeric1";
+    captureUser.objectTestRequired.requiredString = @"required";
+    captureUser.stringTestEmailAddress = @"user@@example";
+    errors = [captureUser validate];
+    GHAssertEquals([errors count], (NSUInteger) 1, nil);
+    GHAssertEqualStrings([[errors objectAtIndex:0] violatedConstraint], @"email-address", nil);
+}
+
+- (void)test_partlyProjectedObjectsAreNotReplacedOnCapture
+{
+    id apidInterface = [OCMockObject mockForClass:[JRCaptureApidInterface class]];
+    [[apidInterface reject] replaceCaptureObjectWithAttributes:OCMOCK_ANY atPath:OCMOCK_ANY withToken:OCMOCK_ANY
+                                                   forDelegate:OCMOCK_ANY withContext:OCMOCK_ANY];
+
+    JRCaptureUser *captureUser = [[JRPartialCaptureUser alloc] init];
+    captureUser.basicString = @"basic";
+
+    JRCaptureObjectTestDelegate *delegate = [[JRCaptureObjectTestDelegate alloc] init];
+    [captureUser replaceOnCaptureForDelegate:delegate context:@"user"];
+    [apidInterface verify];
+    [apidInterface stopMocking];
+
+    GHAssertEqualObjects(delegate.events, (@[ @"replace failed user" ]), nil);
+    GHAssertEquals([delegate.lastError code], (NSInteger) JRCaptureLocalApidErrorPartialProjection, nil);
+    GHAssertFalse([JRCaptureUser isPartialProjection], nil);
+}
+
+- (void)test_deepClearAndPrivateEqualityWithLargePlurals
+{
+    const NSUInteger count = 5000;
+    NSMutableArray *basicPlural = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray *pluralTestUnique = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [basicPlural addObject:@{ @"id" : @(i + 1), @"string1" : @"a", @"string2" : @"b" }];
+        [pluralTestUnique addObject:@{ @"id" : @(i + 1), @"uniqueString" : [NSString stringWithFormat:@"%lu",
+                (unsigned long) i], @"string1" : @"a", @"string2" : @"b" }];
+    }
+    NSDictionary *dictionary = @{ @"basicString" : @"basic", @"basicObject" : @{ @"string1" : @"string1" },
+            @"basicPlural" : basicPlural, @"pluralTestUnique" : pluralTestUnique };
+
+    JRCaptureUser *captureUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+    JRCaptureUser *otherUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+    captureUser.basicObject.string2 = @"string2";
+    ((JRBasicPluralElement *) [captureUser.basicPlural lastObject]).string1 = @"changed";
+
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    [captureUser deepClearDirtyProperties];
+    NSTimeInterval clear = CFAbsoluteTimeGetCurrent() - start;
+    [otherUser deepClearDirtyProperties];
+
+    GHAssertFalse([captureUser needsUpdate], nil);
+    GHAssertEquals([captureUser.basicObject.dirtyPropertySet count], (NSUInteger) 0, nil);
+
+    // Elements are compared pairwise by index, so a difference in the last one is found in a single pass
+    start = CFAbsoluteTimeGetCurrent();
+    GHAssertFalse([captureUser isEqualByPrivateProperties:otherUser], nil);
+    NSTimeInterval compare = CFAbsoluteTimeGetCurrent() - start;
+
+    [((JRBasicPluralElement *) [captureUser.basicPlural lastObject]).dirtyPropertySet removeAllObjects];
+    GHAssertTrue([captureUser isEqualByPrivateProperties:otherUser], nil);
+    GHAssertFalse([captureUser isEqualByPrivateProperties:captureUser.basicObject], nil);
+
+    GHTestLog(@"with %lu elements in each of two plurals: %.2fms to deep clear dirty properties, %.2fms to compare by "
+              "private properties", (unsigned long) count, clear * 1e3, compare * 1e3);
+}
+
+- (void)test_perOperationTimes
+{
+    // Runs in both JUMPTests and JUMPTableTests, so the two logs compare method mode with table mode
+    NSString *mode = [JRCaptureUser captureSchema] ? @"table" : @"method";
+    const NSUInteger elements = 100, count = 1000;
+    NSMutableArray *basicPlural = [NSMutableArray arrayWithCapacity:elements];
+    for (NSUInteger i = 0; i < elements; i++)
+        [basicPlural addObject:@{ @"id" : @(i + 1), @"string1" : @"a", @"string2" : @"b" }];
+    NSDictionary *dictionary = @{ @"email" : @"user@example.com", @"basicString" : @"basic",
+            @"basicObject" : @{ @"string1" : @"string1", @"string2" : @"string2" }, @"basicPlural" : basicPlural };
+
+    JRCaptureUser *captureUser = nil;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        @autoreleasepool
+        {
+            captureUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+        }
+    NSTimeInterval fromDictionary = CFAbsoluteTimeGetCurrent() - start;
+    JRCaptureUser *otherUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        @autoreleasepool
+        {
+            captureUser.basicString = @"basic";
+            captureUser.basicObject.string1 = @"string1";
+            [captureUser toUpdateDictionary];
+        }
+    NSTimeInterval toUpdateDictionary = CFAbsoluteTimeGetCurrent() - start;
+    GHAssertFalse([captureUser needsUpdate], nil);
+
+    captureUser.basicString = @"basic";
+    BOOL needsUpdate = NO;
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        @autoreleasepool
+        {
+            [captureUser restoreDirtyPropertiesFromSnapshotDictionary:
+                    [captureUser snapshotDictionaryFromDirtyPropertySet]];
+            needsUpdate = [captureUser needsUpdate];
+        }
+    NSTimeInterval snapshot = CFAbsoluteTimeGetCurrent() - start;
+    GHAssertTrue(needsUpdate, nil);
+
+    [captureUser deepClearDirtyProperties];
+    [otherUser deepClearDirtyProperties];
+    BOOL equal = NO;
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        equal = [captureUser isEqualByPrivateProperties:otherUser];
+        for (NSUInteger j = 0; j < elements; j++)
+            equal = equal && [[captureUser.basicPlural objectAtIndex:j]
+                    isEqualToBasicPluralElement:[otherUser.basicPlural objectAtIndex:j]];
+    }
+    NSTimeInterval isEqual = CFAbsoluteTimeGetCurrent() - start;
+    GHAssertTrue(equal, nil);
+
+    GHTestLog(@"%@ mode, a user with %lu plural elements: %.1fus from dictionary, %.1fus to build the update "
+              "dictionary, %.1fus to snapshot, restore and check needsUpdate, %.1fus to compare by private properties "
+              "and isEqualTo... on each element", mode, (unsigned long) elements, fromDictionary * 1e6 / count,
+              toUpdateDictionary * 1e6 / count, snapshot * 1e6 / count, isEqual * 1e6 / count);
+}
+
+- (void)test_dirtyPropertySetIsAViewOfTheDirtyPropertyBits
+{
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    GHAssertEquals([captureUser.dirtyPropertySet count], [[captureUser updatablePropertySet] count], nil);
+    GHAssertEqualObjects([NSSet setWithSet:captureUser.dirtyPropertySet], [captureUser updatablePropertySet], nil);
+
+    [captureUser deepClearDirtyProperties];
+    captureUser.basicString = @"basic";
+    [captureUser setBasicBooleanWithBool:YES];
+    GHAssertEqualObjects([NSSet setWithSet:captureUser.dirtyPropertySet],
+                         ([NSSet setWithObjects:@"basicString", @"basicBoolean", nil]), nil);
+
+    // Changes made through the set are seen by the generated code, and names that aren't properties are kept
+    [captureUser.dirtyPropertySet removeObject:@"basicBoolean"];
+    [captureUser.dirtyPropertySet addObject:@"email"];
+    [captureUser.dirtyPropertySet addObject:@"notAProperty"];
+    GHAssertTrue([captureUser.dirtyPropertySet containsObject:@"notAProperty"], nil);
+    GHAssertEquals([captureUser.dirtyPropertySet count], (NSUInteger) 3, nil);
+
+    NSDictionary *snapshot = [captureUser snapshotDictionaryFromDirtyPropertySet];
+    NSDictionary *updateDictionary = [captureUser toUpdateDictionary];
+    GHAssertEqualObjects([NSSet setWithArray:[updateDictionary allKeys]],
+                         ([NSSet setWithObjects:@"basicString", @"email", nil]), nil);
+    GHAssertEquals([captureUser.dirtyPropertySet count], (NSUInteger) 0, nil);
+
+    [captureUser restoreDirtyPropertiesFromSnapshotDictionary:snapshot];
+    GHAssertEqualObjects([NSSet setWithSet:captureUser.dirtyPropertySet],
+                         ([NSSet setWithObjects:@"basicString", @"email", nil]), nil);
+
+    JRCaptureUser *userCopy = [captureUser copy];
+    GHAssertEqualObjects(userCopy.dirtyPropertySet, captureUser.dirtyPropertySet, nil);
+
+    const NSUInteger count = 10000;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        captureUser.basicString = @"basic";
+        captureUser.stringTestFeatures = @"features";
+        snapshot = [captureUser snapshotDictionaryFromDirtyPropertySet];
+        [captureUser toUpdateDictionary];
+        [captureUser restoreDirtyPropertiesFromSnapshotDictionary:snapshot];
+    }
+    GHTestLog(@"%.2fus to set, snapshot, build the update for and restore two dirty properties",
+              (CFAbsoluteTimeGetCurrent() - start) * 1e6 / count);
+}
+
+- (void)test_copiesKeepTheDirtyPropertiesOfTheOriginal
+{
+    JRCaptureUser *captureUser = [JRCaptureUser captureUser];
+    captureUser.basicString = @"basic";
+    captureUser.basicObject.string1 = @"string1";
+    [captureUser deepClearDirtyProperties];
+    captureUser.email = @"user@example.com";
+
+    JRCaptureUser *userCopy = [captureUser copy];
+    GHAssertEqualObjects([NSSet setWithSet:userCopy.dirtyPropertySet], [NSSet setWithObject:@"email"], nil);
+    GHAssertEquals([captureUser.basicObject.dirtyPropertySet count], (NSUInteger) 0, nil);
+
+    // Table mode classes copy their values, sub-objects included, along with the dirty properties
+    if ([JRCaptureUser captureSchema])
+    {
+        GHAssertEqualStrings(userCopy.basicString, @"basic", nil);
+        GHAssertEqualStrings(userCopy.email, @"user@example.com", nil);
+        GHAssertTrue(userCopy.basicObject != captureUser.basicObject, nil);
+        GHAssertEqualStrings(userCopy.basicObject.string1, @"string1", nil);
+        GHAssertEquals([userCopy.basicObject.dirtyPropertySet count], (NSUInteger) 0, nil);
+    }
+}
+
+- (void)test_lazilyLoadedUsersOnlyBuildWhatIsRead
+{
+    if ([JRCaptureUser captureSchema])
+    {
+        GHTestLog(@"table mode classes always build their sub-objects and plural elements up front");
+        return;
+    }
+
+    const NSUInteger count = 5000;
+    NSMutableArray *basicPlural = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray *pluralTestUnique = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [basicPlural addObject:@{ @"id" : @(i + 1), @"string1" : @"a", @"string2" : @"b" }];
+        [pluralTestUnique addObject:@{ @"id" : @(i + 1), @"uniqueString" : [NSString stringWithFormat:@"%lu",
+                (unsigned long) i], @"string1" : @"a", @"string2" : @"b" }];
+    }
+    NSDictionary *dictionary = @{ @"email" : @"user@example.com", @"basicString" : @"basic",
+            @"basicObject" : @{ @"string1" : @"string1" }, @"basicPlural" : basicPlural,
+            @"pluralTestUnique" : pluralTestUnique, @"pinoL1Object" : @{ @"string1" : @"a",
+                    @"pinoL2Plural" : @[ @{ @"id" : @1, @"string1" : @"b" } ] } };
+
+    JRCaptureUser *eagerUser, *lazyUser;
+    size_t bytes = JRBytesInUse();
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    @autoreleasepool
+    {
+        eagerUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+    }
+    NSTimeInterval eagerTime = CFAbsoluteTimeGetCurrent() - start;
+    size_t eagerBytes = JRBytesInUse() - bytes;
+
+    [JRCaptureObject setMaterializesLazily:YES];
+    bytes = JRBytesInUse();
+    start = CFAbsoluteTimeGetCurrent();
+    @autoreleasepool
+    {
+        lazyUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+    }
+    NSTimeInterval lazyTime = CFAbsoluteTimeGetCurrent() - start;
+    size_t lazyBytes = JRBytesInUse() - bytes;
+    JRCaptureUser *uncleanedUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary withPath:@""];
+    [JRCaptureObject setMaterializesLazily:NO];
+
+    GHAssertEqualStrings(lazyUser.email, @"user@example.com", nil);
+    GHAssertNotNil([lazyUser valueForKey:@"basicPluralJson"], nil);
+    GHAssertFalse([lazyUser needsUpdate], nil);
+
+    // Once read, everything is as it would have been had it been built up front, whether or not it was cleared
+    JRCaptureUser *eagerUncleanedUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary withPath:@""];
+    GHAssertEqualObjects([NSSet setWithSet:uncleanedUser.basicObject.dirtyPropertySet],
+                         [NSSet setWithSet:eagerUncleanedUser.basicObject.dirtyPropertySet], nil);
+    GHAssertTrue([uncleanedUser isEqualByPrivateProperties:eagerUncleanedUser], nil);
+    GHAssertEquals([lazyUser.basicPlural count], count, nil);
+    GHAssertEqualStrings(((JRBasicPluralElement *) [lazyUser.basicPlural lastObject]).captureObjectPath,
+                         ((JRBasicPluralElement *) [eagerUser.basicPlural lastObject]).captureObjectPath, nil);
+    GHAssertTrue([lazyUser isEqualByPrivateProperties:eagerUser], nil);
+    GHAssertEqualObjects([lazyUser toReplaceDictionary], [eagerUser toReplaceDictionary], nil);
+    GHAssertNil([lazyUser valueForKey:@"basicPluralJson"], nil);
+
+    GHTestLog(@"loading a user with %lu elements in each of two plurals: %.2fms and %lu bytes up front, %.2fms and "
+              "%lu bytes lazily", (unsigned long) count, eagerTime * 1e3, (unsigned long) eagerBytes, lazyTime * 1e3,
+              (unsigned long) lazyBytes);
+}
+
+- (void)test_replaceBodyIsWrittenIntoOneBuffer
+{
+    const NSUInteger count = 2000;
+    NSMutableArray *basicPlural = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+        [basicPlural addObject:@{ @"id" : @(i + 1),
+                @"string1" : [NSString stringWithFormat:@"a&b=%lu", (unsigned long) i],
+                @"string2" : @"\u00fcnic\u00f8de \"quoted\"\n" }];
+    NSDictionary *dictionary = @{ @"email" : @"user+tag@example.com", @"basicBoolean" : @YES,
+            @"basicInteger" : @42, @"basicDecimal" : @1.5, @"basicObject" : @{ @"string1" : @"string1" },
+            @"jsonDictionary" : @{ @"nested" : @[ @1, [NSNull null], @"two" ] }, @"basicPlural" : basicPlural };
+    JRCaptureUser *captureUser = [JRCaptureUser captureUserObjectFromDictionary:dictionary];
+
+    NSDictionary *expected = [captureUser toReplaceDictionary];
+    JRJsonFormWriter *writer = [[JRJsonFormWriter alloc] init];
+    [writer appendFormParameterNamed:@"attributes"];
+    [captureUser writeReplaceJsonToWriter:writer];
+    NSUInteger allocations = writer.allocationCount;
+    NSData *body = [writer data];
+
+    NSString *bodyString = [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding];
+    GHAssertTrue([bodyString hasPrefix:@"attributes="], nil);
+    NSString *json = [[bodyString substringFromIndex:[@"attributes=" length]]
+            stringByReplacingPercentEscapesUsingEncoding:NSUTF8StringEncoding];
+    GHAssertEqualObjects([json JR_objectFromJSONString], expected, nil);
+    GHAssertEquals([captureUser.dirtyPropertySet count], (NSUInteger) 0, nil);
+
+    // The old body: the dictionary, its JSON string, the escaped string, the whole parameter string and its UTF-8 data
+    const NSUInteger runs = 20;
+    NSUInteger copiedBytes = 0;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+    {
+        NSString *jsonString = [[captureUser toReplaceDictionary] JR_jsonString];
+        NSString *escaped = [jsonString stringByAddingUrlPercentEscapes];
+        NSString *params = [NSString stringWithFormat:@"attributes=%@", escaped];
+        NSData *data = [params dataUsingEncoding:NSUTF8StringEncoding];
+        copiedBytes = [jsonString length] + [escaped length] + [params length] + [data length];
+    }
+    NSTimeInterval before = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+    {
+        writer = [[JRJsonFormWriter alloc] init];
+        [writer appendFormParameterNamed:@"attributes"];
+        [captureUser writeReplaceJsonToWriter:writer];
+        body = [writer data];
+    }
+    NSTimeInterval after = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    GHTestLog(@"replace of a user with %lu plural elements: %.2fms through four intermediate copies (%lu bytes), "
+              "%.2fms written into one %lu byte buffer with %lu allocations", (unsigned long) count, before * 1e3,
+              (unsigned long) copiedBytes, after * 1e3, (unsigned long) [body length], (unsigned long) allocations);
+}
+
+@end
@@ -37,8 +37,49 @@
 #import "JRCaptureUser+Extras.h"
 #import "JRCaptureFlow.h"
 #import "NSMutableURLRequest+JRRequestUtils.h"
+#import "JRBase64.h"
+#import "JREngageWrapper.h"
+#import "JRTrace.h"
 #import <OCMock/OCMock.h>
 
+@interface JRCapture (JRCaptureTests)
++ (NSString *)base64SignatureForRefreshWithDate:(NSString *)dateString refreshSecret:(NSString *)refreshSecret
+                                    accessToken:(NSString *)accessToken;
+@end
+
+@interface JREngageWrapper (JRCaptureTests)
++ (JREngageWrapper *)singletonInstance;
++ (void)beginSignInTraceWithSpanNamed:(NSString *)spanName kind:(JRTraceSpanKind)kind;
+- (void)authenticationDidSucceedForUser:(NSDictionary *)auth_info forProvider:(NSString *)provider;
+- (void)authenticationDidReachTokenUrl:(NSString *)tokenUrl withResponse:(NSURLResponse *)response
+                            andPayload:(NSData *)tokenUrlPayload forProvider:(NSString *)provider;
+@end
+
+@interface JRTraceRecorder : NSObject <JRTraceSink>
+@property(nonatomic, readonly) NSMutableArray *traces;
+@end
+
+@implementation JRTraceRecorder
+- (id)init
+{
+    if ((self = [super init])) _traces = [NSMutableArray array];
+    return self;
+}
+
+- (void)traceDidFinish:(JRTrace *)trace
+{
+    @synchronized (self)
+    {
+        [_traces addObject:trace];
+    }
+}
+@end
+
+static double JRMegabytesPerSecond(NSUInteger length, NSUInteger repeats, CFAbsoluteTime start)
+{
+    return length * repeats / (CFAbsoluteTimeGetCurrent() - start) / (1024 * 1024);
+}
+
 @interface JRCaptureTests : GHTestCase
 @end
 
@@ -85,7 +126,8 @@
     [expectedRequest JR_setBodyWithParams:expectedParams];
 
     id connectionManager = [OCMockObject mockForClass:[JRConnectionManager class]];
-    [[connectionManager expect] startURLConnectionWithRequest:expectedRequest completionHandler:[OCMArg any]];
+    [[connectionManager expect] startURLConnectionWithRequest:expectedRequest decoder:[OCMArg any]
+                                                callbackQueue:[OCMArg any] completionHandler:[OCMArg any]];
     [JRCapture startForgottenPasswordRecoveryForField:@"me@mydomain.name" delegate:nil];
     [connectionManager verify];
 }
@@ -130,7 +172,8 @@
     [expectedRequest JR_setBodyWithParams:expectedParams];
 
     id connectionManager = [OCMockObject mockForClass:[JRConnectionManager class]];
-    [[connectionManager expect] startURLConnectionWithRequest:expectedRequest completionHandler:[OCMArg any]];
+    [[connectionManager expect] startURLConnectionWithRequest:expectedRequest decoder:[OCMArg any]
+                                                callbackQueue:[OCMArg any] completionHandler:[OCMArg any]];
     [JRCapture resendVerificationEmail:@"me@mydomain.name" delegate:nil];
     [connectionManager verify];
 }
@@ -185,9 +228,165 @@
     [expectedRequest JR_setBodyWithParams:expectedParams];
 
     id connectionManager = [OCMockObject mockForClass:[JRConnectionManager class]];
-    [[connectionManager expect] startURLConnectionWithRequest:expectedRequest completionHandler:[OCMArg any]];
+    [[connectionManager expect] startURLConnectionWithRequest:expectedRequest decoder:[OCMArg any]
+                                                callbackQueue:[OCMArg any] completionHandler:[OCMArg any]];
     [JRCapture updateProfileForUser:user delegate:nil ];
     [connectionManager verify];
 }
 
-@end
\ No newline at end of file
+- (void)test_base64AgreesWithNSDataInEveryAlphabetAndChunking
+{
+    GHAssertEqualStrings([JRCapture base64SignatureForRefreshWithDate:@"2013-01-01 00:00:00" refreshSecret:@"secret"
+                                                          accessToken:@"token"], @"Bh6nPMX0i+WOz4dSY2Aoeyh/YKE=", nil);
+
+    srandom(1);
+    for (NSUInteger length = 1; length < 200; length++)
+    {
+        NSMutableData *data = [NSMutableData dataWithLength:length];
+        for (NSUInteger i = 0; i < length; i++) ((uint8_t *) [data mutableBytes])[i] = (uint8_t) random();
+
+        NSString *expected = [data base64EncodedStringWithOptions:0];
+        GHAssertEqualStrings([data JRBase64EncodedString], expected, nil);
+        GHAssertEqualStrings([data JRBase64EncodedStringWithWrapWidth:76],
+                             [data base64EncodedStringWithOptions:NSDataBase64Encoding76CharacterLineLength |
+                                     NSDataBase64EncodingEndLineWithCarriageReturn |
+                                     NSDataBase64EncodingEndLineWithLineFeed], nil);
+        NSString *urlSafe = [[[expected stringByReplacingOccurrencesOfString:@"+" withString:@"-"]
+                stringByReplacingOccurrencesOfString:@"/" withString:@"_"]
+                stringByReplacingOccurrencesOfString:@"=" withString:@""];
+        GHAssertEqualStrings([data JRBase64URLEncodedString], urlSafe, nil);
+        GHAssertEqualObjects([NSData dataWithJRBase64EncodedString:expected], data, nil);
+        GHAssertEqualObjects([NSData dataWithJRBase64EncodedString:urlSafe], data, nil);
+
+        // The same again, a random number of bytes or characters at a time
+        char encoded[JRBase64EncodedLengthForLength(200 + 2)];
+        size_t encodedLength = 0;
+        JRBase64Encoder encoder;
+        JRBase64EncoderInit(&encoder, JRBase64Standard);
+        for (NSUInteger i = 0, chunk; i < length; i += chunk)
+        {
+            chunk = MIN(length - i, (NSUInteger) random() % 8);
+            encodedLength += JRBase64EncoderUpdate(&encoder, (uint8_t *) [data bytes] + i, chunk,
+                                                   encoded + encodedLength);
+        }
+        encodedLength += JRBase64EncoderFinal(&encoder, encoded + encodedLength);
+        GHAssertEqualStrings([[NSString alloc] initWithBytes:encoded length:encodedLength
+                                                    encoding:NSASCIIStringEncoding], expected, nil);
+
+        uint8_t decoded[JRBase64DecodedLengthForLength(sizeof(encoded) + 3)];
+        size_t decodedLength = 0;
+        JRBase64Decoder decoder;
+        JRBase64DecoderInit(&decoder);
+        for (NSUInteger i = 0, chunk; i < encodedLength; i += chunk)
+        {
+            chunk = MIN(encodedLength - i, (NSUInteger) random() % 8);
+            decodedLength += JRBase64DecoderUpdate(&decoder, encoded + i, chunk, decoded + decodedLength);
+        }
+        decodedLength += JRBase64DecoderFinal(&decoder, decoded + decodedLength);
+        GHAssertEqualObjects([NSData dataWithBytes:decoded length:decodedLength], data, nil);
+    }
+
+    const NSUInteger length = 1024 * 1024, repeats = 20;
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    for (NSUInteger i = 0; i < length; i++) ((uint8_t *) [data mutableBytes])[i] = (uint8_t) random();
+    NSData *encodedData = [data base64EncodedDataWithOptions:0];
+    NSMutableData *output = [NSMutableData dataWithLength:JRBase64EncodedLengthForLength(length)];
+
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < repeats; i++) [data base64EncodedDataWithOptions:0];
+    double systemEncode = JRMegabytesPerSecond(length, repeats, start);
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < repeats; i++)
+        JRBase64Encode([data bytes], length, JRBase64Standard, [output mutableBytes]);
+    double encode = JRMegabytesPerSecond(length, repeats, start);
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < repeats; i++) [[NSData alloc] initWithBase64EncodedData:encodedData options:0];
+    double systemDecode = JRMegabytesPerSecond([encodedData length], repeats, start);
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < repeats; i++)
+        JRBase64Decode([encodedData bytes], [encodedData length], [output mutableBytes]);
+    double decode = JRMegabytesPerSecond([encodedData length], repeats, start);
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < repeats; i++)
+    {
+        JRBase64Decoder decoder;
+        JRBase64DecoderInit(&decoder);
+        size_t decodedLength = 0;
+        for (NSUInteger j = 0; j < [encodedData length]; j += 16 * 1024)
+            decodedLength += JRBase64DecoderUpdate(&decoder, (const char *) [encodedData bytes] + j,
+                                                   MIN([encodedData length] - j, 16 * 1024),
+                                                   (uint8_t *) [output mutableBytes] + decodedLength);
+        JRBase64DecoderFinal(&decoder, (uint8_t *) [output mutableBytes] + decodedLength);
+    }
+    double streamingDecode = JRMegabytesPerSecond([encodedData length], repeats, start);
+
+    GHTestLog(@"base64 encode: %.0f MB/s, NSData %.0f MB/s; decode: %.0f MB/s, %.0f MB/s in 16KB chunks, "
+              "NSData %.0f MB/s", encode, systemEncode, decode, streamingDecode, systemDecode);
+}
+
+- (void)test_signInTraceSpansShareATraceIdAndExportToChromeTraceJSON
+{
+    GHAssertNil([JRTrace beginTraceNamed:@"sign-in"], @"tracing should be off without a sink");
+
+    JRTraceRecorder *recorder = [[JRTraceRecorder alloc] init];
+    [JRTrace setSink:recorder];
+
+    id mockJRCaptureData = [OCMockObject mockForClass:[JRCaptureData class]];
+    [[mockJRCaptureData stub] setAccessToken:[OCMArg any] expiresIn:[OCMArg any]];
+    [[mockJRCaptureData stub] setLinkedProfiles:[OCMArg any]];
+
+    JREngageWrapper *wrapper = [JREngageWrapper singletonInstance];
+    [JREngageWrapper beginSignInTraceWithSpanNamed:@"engage_dialog" kind:JRTraceSpanKindUIWait];
+    JRTrace *trace = [JRTrace currentTrace];
+    GHAssertNotNil(trace, nil);
+
+    [wrapper authenticationDidSucceedForUser:@{@"token" : @"engage_token"} forProvider:@"facebook"];
+    // stands in for JRSessionData's call to the token URL
+    [[trace beginSpanNamed:@"token_url" kind:JRTraceSpanKindNetwork] end];
+    NSData *payload = [@"{\"stat\":\"ok\",\"access_token\":\"abc\",\"is_new\":false,"
+            "\"capture_user\":{\"basicString\":\"hello\"}}" dataUsingEncoding:NSUTF8StringEncoding];
+    [wrapper authenticationDidReachTokenUrl:@"https://token.url" withResponse:nil andPayload:payload
+                                forProvider:@"facebook"];
+
+    GHAssertNil([JRTrace currentTrace], @"the sign-in should have finished the trace");
+    GHAssertEquals([recorder.traces count], (NSUInteger) 1, nil);
+    GHAssertEquals([recorder.traces objectAtIndex:0], trace, nil);
+    GHAssertNil(trace.error, nil);
+    GHAssertNil([trace beginSpanNamed:@"late" kind:JRTraceSpanKindParse], nil);
+
+    NSArray *expectedKinds = @[ @(JRTraceSpanKindUIWait), @(JRTraceSpanKindNetwork), @(JRTraceSpanKindParse),
+            @(JRTraceSpanKindModelBuild) ];
+    GHAssertEqualObjects([[trace spans] valueForKey:@"kind"], expectedKinds, nil);
+
+    CFAbsoluteTime previousEnd = trace.startTime;
+    for (JRTraceSpan *span in [trace spans])
+    {
+        GHAssertEqualStrings(span.traceId, trace.traceId, nil);
+        GHAssertFalse([span isOpen], @"%@", span);
+        GHAssertTrue(span.startTime >= previousEnd, @"these stages run one after another: %@", span);
+        previousEnd = span.endTime;
+    }
+
+    NSData *json = [JRChromeTraceFileSink chromeTraceJSONDataForTrace:trace];
+    NSDictionary *chromeTrace = [NSJSONSerialization JSONObjectWithData:json options:0 error:nil];
+    NSArray *complete = [[chromeTrace objectForKey:@"traceEvents"]
+            filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"ph == 'X'"]];
+    GHAssertEquals([complete count], [[trace spans] count] + 1, @"a span per stage and one for the whole trace");
+    for (NSDictionary *event in complete)
+    {
+        GHAssertEqualStrings([event valueForKeyPath:@"args.trace_id"], trace.traceId, nil);
+        GHAssertTrue([[event objectForKey:@"ts"] doubleValue] >= 0, nil);
+        GHAssertTrue([[event objectForKey:@"dur"] doubleValue] >= 0, nil);
+    }
+    GHAssertEqualObjects([complete valueForKey:@"cat"],
+                         (@[ @"trace", @"ui_wait", @"network", @"parse", @"model_build" ]), nil);
+
+    [JRTrace setSink:nil];
+    [mockJRCaptureData stopMocking];
+}
+
+@end
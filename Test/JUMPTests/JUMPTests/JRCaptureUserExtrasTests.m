@@ -33,6 +33,9 @@
 #import "JRCaptureUser.h"
 #import "JRCaptureFlow.h"
 #import "JRCaptureUser+Extras.h"
+#import "JRCaptureObject+Internal.h"
+#import "JRBasicPluralElement.h"
+#import "JRJsonUtils.h"
 
 @interface JRCaptureUserExtrasTests : GHTestCase
 @end
@@ -140,4 +143,171 @@
     [user toFormFieldsForForm:@"editProfileForm" withFlow:[JRCaptureFlow flowWithDictionary:flow]];
 }
 
-@end
\ No newline at end of file
+- (void)test_compiledFieldPathsAreParsedOncePerFlowAndFindPluralElementsById
+{
+    NSDictionary *flowDict = @{
+            @"fields" : @{
+                    @"editProfileForm" : @{
+                            @"fields" : @[ @"message", @"gender", @"missing" ]
+                    },
+                    @"message" : @{
+                            @"schemaId" : @"basicString"
+                    },
+                    @"gender" : @{
+                            @"schemaId" : @"profiles#2.profile.gender"
+                    },
+                    @"missing" : @{
+                            @"schemaId" : @"profiles#7.profile.gender"
+                    }
+            }
+    };
+    JRCaptureFlow *flow = [JRCaptureFlow flowWithDictionary:flowDict];
+
+    NSArray *compiledFields = [flow compiledFieldsForForm:@"editProfileForm"];
+    GHAssertEquals([compiledFields count], (NSUInteger) 3, nil);
+    GHAssertTrue([flow compiledFieldsForForm:@"editProfileForm"] == compiledFields, nil);
+    GHAssertEqualObjects([[compiledFields objectAtIndex:1] parameterName], @"gender", nil);
+
+    NSDictionary *userDict = @{ @"basicString" : @"hello", @"profiles" : @[
+            @{ @"id" : @1, @"profile" : @{ @"gender" : @"female" } },
+            @{ @"id" : @2, @"profile" : @{ @"gender" : @"male" } } ] };
+    NSMutableDictionary *pluralIndexes = [NSMutableDictionary dictionary];
+    NSMutableArray *values = [NSMutableArray array];
+    for (JRCaptureFormField *field in compiledFields)
+    {
+        id value = [field.path valueInUserDictionary:userDict pluralIndexes:pluralIndexes];
+        [values addObject:value ? value : [NSNull null]];
+    }
+
+    GHAssertEqualObjects(values, (@[ @"hello", @"male", [NSNull null] ]), nil);
+    GHAssertEquals([pluralIndexes count], (NSUInteger) 1, nil);
+}
+
+- (void)test_captureUserObjectFromJsonReader_matches_captureUserObjectFromDictionary
+{
+    const NSUInteger count = 2000;
+    NSMutableArray *basicPlural = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray *pinapL1Plural = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [basicPlural addObject:@{ @"id" : @(i + 1), @"string1" : [NSString stringWithFormat:@"\u00fcnic\u00f8de %lu",
+                (unsigned long) i], @"string2" : @"\"quoted\"\n", @"notInTheSchema" : @{ @"a" : @[ @"}", @1 ] } }];
+        [pinapL1Plural addObject:@{ @"string1" : @"a", @"id" : @(i + 1),
+                @"pinapL2Plural" : @[ @{ @"id" : @1, @"string1" : @"b" } ] }];
+    }
+    NSDictionary *userDictionary = @{ @"email" : @"user@example.com", @"basicBoolean" : @YES, @"basicDecimal" : @1.5,
+            @"basicString" : @"sn\u00f8w \U0001F600", @"basicObject" : @{ @"string1" : @"a" },
+            @"objectTestRequired" : [NSNull null], @"jsonDictionary" : @{ @"nested" : @[ @1, [NSNull null], @NO ] },
+            @"basicPlural" : basicPlural, @"pinapL1Plural" : pinapL1Plural };
+    NSData *data = [NSJSONSerialization dataWithJSONObject:@{ @"stat" : @"ok", @"result" : userDictionary } options:0
+                                                     error:nil];
+
+    NSDictionary *response = [JRJsonReader dictionaryFromData:data deferringKey:@"result"];
+    GHAssertEqualObjects([response objectForKey:@"stat"], @"ok", nil);
+    JRCaptureUser *readUser = [JRCaptureUser captureUserObjectFromJsonReader:[[response objectForKey:@"result"] copy]];
+    JRCaptureUser *parsedUser = [JRCaptureUser captureUserObjectFromDictionary:
+            [[data JR_objectFromJSONData] objectForKey:@"result"]];
+
+    GHAssertNil(readUser.objectTestRequired, nil);
+    GHAssertEqualObjects(readUser.basicInteger, [NSNumber numberWithInteger:0], nil);
+    GHAssertTrue([readUser isEqualByPrivateProperties:parsedUser], nil);
+    GHAssertEqualObjects([readUser toReplaceDictionary], [parsedUser toReplaceDictionary], nil);
+
+    NSData *truncated = [data subdataWithRange:NSMakeRange(0, [data length] / 2)];
+    GHAssertNil([JRJsonReader dictionaryFromData:truncated deferringKey:@"stat"], nil);
+    NSData *malformed = [@"{\"email\":\"user@example.com\",\"basicPlural\":[{\"id\":1"
+            dataUsingEncoding:NSUTF8StringEncoding];
+    GHAssertNil([JRCaptureUser captureUserObjectFromJsonReader:[[JRJsonReader alloc] initWithData:malformed]], nil);
+
+    const NSUInteger runs = 10;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+        @autoreleasepool
+        {
+            [JRCaptureUser captureUserObjectFromDictionary:[[data JR_objectFromJSONData] objectForKey:@"result"]];
+        }
+    NSTimeInterval parsed = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+        @autoreleasepool
+        {
+            response = [JRJsonReader dictionaryFromData:data deferringKey:@"result"];
+            [JRCaptureUser captureUserObjectFromJsonReader:[[response objectForKey:@"result"] copy]];
+        }
+    NSTimeInterval read = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    GHTestLog(@"user with %lu elements in each of two plurals, %lu bytes of JSON: %.2fms parsed and then copied into "
+              "the user, %.2fms read straight into it", (unsigned long) count, (unsigned long) [data length],
+              parsed * 1e3, read * 1e3);
+}
+
+- (void)test_captureUserWithArchivedData_restores_the_archived_user
+{
+    const NSUInteger count = 2000;
+    NSMutableArray *basicPlural = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray *pinapL1Plural = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [basicPlural addObject:@{ @"id" : @(i + 1), @"string1" : [NSString stringWithFormat:@"\u00fcnic\u00f8de %lu",
+                (unsigned long) i], @"string2" : @"\"quoted\"\n" }];
+        [pinapL1Plural addObject:@{ @"id" : @(i + 1), @"string1" : @"a",
+                @"pinapL2Plural" : @[ @{ @"id" : @1, @"string1" : @"b" } ] }];
+    }
+    JRCaptureUser *user = [JRCaptureUser captureUserObjectFromDictionary:@{ @"email" : @"user@example.com",
+            @"basicBoolean" : @YES, @"basicInteger" : @-42, @"basicDecimal" : @1.5, @"basicDate" : @"2012-05-06",
+            @"basicDateTime" : @"2012-05-06 12:34:56.123456 +0000", @"basicString" : @"sn\u00f8w \U0001F600",
+            @"basicObject" : @{ @"string1" : @"a" }, @"simpleStringPluralOne" : @[ @"one", @"two" ],
+            @"jsonDictionary" : @{ @"nested" : @[ @1, [NSNull null], @NO, @2.25 ] }, @"basicPlural" : basicPlural,
+            @"pinapL1Plural" : pinapL1Plural }];
+    user.basicString = @"changed";
+    ((JRBasicPluralElement *) [user.basicPlural objectAtIndex:1]).string2 = @"changed";
+
+    NSData *archive = [user archivedData];
+    JRCaptureUser *restoredUser = [JRCaptureUser captureUserWithArchivedData:archive];
+
+    GHAssertTrue([restoredUser isEqualByPrivateProperties:user], nil);
+    GHAssertTrue([[restoredUser.basicPlural objectAtIndex:1]
+            isEqualByPrivateProperties:[user.basicPlural objectAtIndex:1]], nil);
+    GHAssertEqualObjects([restoredUser newDictionaryForEncoder:NO], [user newDictionaryForEncoder:NO], nil);
+
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"captureUser.archive"];
+    GHAssertTrue([user writeArchiveToFile:path], nil);
+    JRCaptureUser *partialUser = [JRCaptureUser captureUserWithContentsOfArchiveFile:path
+                                                                               keys:[NSSet setWithObjects:@"email",
+                                                                                       @"basicObject", nil]];
+    GHAssertEqualObjects(partialUser.email, user.email, nil);
+    GHAssertEqualObjects([partialUser.basicObject newDictionaryForEncoder:YES],
+                         [user.basicObject newDictionaryForEncoder:YES], nil);
+    GHAssertNil(partialUser.basicPlural, nil);
+    GHAssertNil(partialUser.basicString, nil);
+
+    GHAssertNil([JRCaptureUser captureUserWithArchivedData:[archive subdataWithRange:NSMakeRange(0, 100)]], nil);
+    GHAssertNil([JRCaptureUser captureUserWithArchivedData:[NSKeyedArchiver archivedDataWithRootObject:user]], nil);
+
+    const NSUInteger runs = 10;
+    NSData *keyedArchive = nil;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+        @autoreleasepool
+        {
+            keyedArchive = [NSKeyedArchiver archivedDataWithRootObject:user];
+            [NSKeyedUnarchiver unarchiveObjectWithData:keyedArchive];
+        }
+    NSTimeInterval keyed = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < runs; i++)
+        @autoreleasepool
+        {
+            archive = [user archivedData];
+            [JRCaptureUser captureUserWithArchivedData:archive];
+        }
+    NSTimeInterval binary = (CFAbsoluteTimeGetCurrent() - start) / runs;
+
+    GHTestLog(@"user with %lu elements in each of two plurals saved and restored: NSKeyedArchiver %lu bytes in %.2fms, "
+              "binary archive %lu bytes in %.2fms", (unsigned long) count, (unsigned long) [keyedArchive length],
+              keyed * 1e3, (unsigned long) [archive length], binary * 1e3);
+}
+
+@end
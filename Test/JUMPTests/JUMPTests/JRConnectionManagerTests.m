@@ -0,0 +1,641 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2016, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRConnectionManager.h"
+#import "JRConnectionTransport.h"
+#import "JRConnectionMetrics.h"
+#import "JRTrace.h"
+#import "debug_log.h"
+
+static NSString *const cLoopbackHost = @"loopback.janrain.test";
+static const NSUInteger cLoopbackChunkCount = 16;
+static const NSUInteger cLoopbackChunkSize = 512;
+
+static NSUInteger logArgumentEvaluations = 0;
+
+static NSString *JRCountedLogArgument(NSData *body)
+{
+    logArgumentEvaluations++;
+    return [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding];
+}
+
+/**
+ * Stands in for a Capture server on the loopback: answers every request to cLoopbackHost in-process with a 200 and
+ * a body delivered in cLoopbackChunkCount separate chunks, so the connection manager's per-chunk routing is exercised
+ * without touching the network. Paths registered with setBody:forPath: are answered with that body instead, and
+ * paths registered with setDelay:forPath: only start answering after that delay.
+ */
+@interface JRLoopbackURLProtocol : NSURLProtocol
++ (void)setBody:(NSData *)body forPath:(NSString *)path;
++ (void)setDelay:(NSTimeInterval)delay forPath:(NSString *)path;
+@end
+
+@implementation JRLoopbackURLProtocol
+
+static NSMutableDictionary *loopbackBodies = nil;
+static NSMutableDictionary *loopbackDelays = nil;
+
++ (void)setDelay:(NSTimeInterval)delay forPath:(NSString *)path
+{
+    @synchronized (self)
+    {
+        if (!loopbackDelays) loopbackDelays = [NSMutableDictionary dictionary];
+        [loopbackDelays setValue:delay ? @(delay) : nil forKey:path];
+    }
+}
+
++ (NSTimeInterval)delayForPath:(NSString *)path
+{
+    @synchronized (self)
+    {
+        return [[loopbackDelays objectForKey:path] doubleValue];
+    }
+}
+
++ (void)setBody:(NSData *)body forPath:(NSString *)path
+{
+    @synchronized (self)
+    {
+        if (!loopbackBodies) loopbackBodies = [NSMutableDictionary dictionary];
+        [loopbackBodies setValue:body forKey:path];
+    }
+}
+
++ (NSData *)bodyForPath:(NSString *)path
+{
+    @synchronized (self)
+    {
+        return [loopbackBodies objectForKey:path];
+    }
+}
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request
+{
+    return [[[request URL] host] isEqualToString:cLoopbackHost];
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request
+{
+    return request;
+}
+
+- (void)startLoading
+{
+    NSTimeInterval delay = [JRLoopbackURLProtocol delayForPath:[[[self request] URL] path]];
+    if (delay)
+        [self performSelector:@selector(respond) withObject:nil afterDelay:delay inModes:@[ NSRunLoopCommonModes ]];
+    else
+        [self respond];
+}
+
+- (void)respond
+{
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[[self request] URL] statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{ @"Content-Type" : @"application/json" }];
+    [[self client] URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+
+    NSData *body = [JRLoopbackURLProtocol bodyForPath:[[[self request] URL] path]];
+    if (body)
+    {
+        [[self client] URLProtocol:self didLoadData:body];
+        [[self client] URLProtocolDidFinishLoading:self];
+        return;
+    }
+
+    NSMutableData *chunk = [NSMutableData dataWithLength:cLoopbackChunkSize];
+    memset([chunk mutableBytes], ' ', cLoopbackChunkSize);
+    for (NSUInteger i = 0; i < cLoopbackChunkCount; i++)
+        [[self client] URLProtocol:self didLoadData:chunk];
+
+    [[self client] URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading
+{
+    [NSObject cancelPreviousPerformRequestsWithTarget:self];
+}
+@end
+
+@interface JRConnectionManagerTestDelegate : NSObject <JRConnectionManagerDelegate>
+@property NSUInteger expected;
+@property NSUInteger finished;
+@property NSUInteger failed;
+@property NSUInteger stopped;
+@property NSUInteger bytes;
+@property NSMutableArray *startTimes;
+@property NSMutableArray *latencies;
+@property (weak) GHAsyncTestCase *testCase;
+@property SEL testSelector;
+@end
+
+@implementation JRConnectionManagerTestDelegate
+- (void)checkDone
+{
+    if (self.finished + self.failed == self.expected)
+        [self.testCase notify:kGHUnitWaitStatusSuccess forSelector:self.testSelector];
+}
+
+- (void)connectionDidFinishLoadingWithPayload:(NSString *)payload request:(NSURLRequest *)request andTag:(id)userData
+{
+    if (self.startTimes)
+    {
+        NSDate *start = [self.startTimes objectAtIndex:[userData unsignedIntegerValue]];
+        [self.latencies addObject:@(-[start timeIntervalSinceNow])];
+    }
+
+    self.finished++;
+    self.bytes += [payload length];
+    [self checkDone];
+}
+
+- (void)connectionDidFailWithError:(NSError *)error request:(NSURLRequest *)request andTag:(id)userData
+{
+    self.failed++;
+    [self checkDone];
+}
+
+- (void)connectionWasStoppedWithTag:(id)userData
+{
+    self.stopped++;
+}
+@end
+
+@interface JRConnectionMetricsRecorder : NSObject <JRConnectionMetricsObserver>
+@property NSMutableArray *recorded;
+@property NSUInteger expected;
+@property (weak) GHAsyncTestCase *testCase;
+@property SEL testSelector;
+@end
+
+@implementation JRConnectionMetricsRecorder
+- (void)connectionDidCompleteWithMetrics:(JRRequestMetrics *)metrics
+{
+    @synchronized (self)
+    {
+        [self.recorded addObject:metrics];
+        if ([self.recorded count] == self.expected)
+            [self.testCase notify:kGHUnitWaitStatusSuccess forSelector:self.testSelector];
+    }
+}
+@end
+
+/**
+ * A session transport whose sessions can't create tasks, as happens once a session has been invalidated
+ */
+@interface JRInvalidatedSessionTransport : JRURLSessionTransport
+@end
+
+@implementation JRInvalidatedSessionTransport
+- (NSURLSession *)sessionForURL:(NSURL *)url
+{
+    return nil;
+}
+@end
+
+@interface JRConnectionManagerTests : GHAsyncTestCase
+@end
+
+@implementation JRConnectionManagerTests
+
+- (JRURLSessionTransport *)loopbackSessionTransport
+{
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration defaultSessionConfiguration];
+    configuration.protocolClasses = [@[ [JRLoopbackURLProtocol class] ]
+            arrayByAddingObjectsFromArray:configuration.protocolClasses];
+
+    return [[JRURLSessionTransport alloc] initWithConfiguration:configuration];
+}
+
+- (void)setUpClass
+{
+    [NSURLProtocol registerClass:[JRLoopbackURLProtocol class]];
+}
+
+- (void)setUp
+{
+    [JRConnectionManager setTransport:[self loopbackSessionTransport]];
+}
+
+- (void)tearDownClass
+{
+    [NSURLProtocol unregisterClass:[JRLoopbackURLProtocol class]];
+    [JRConnectionManager setTransport:nil];
+}
+
+- (NSURLRequest *)loopbackRequest:(NSUInteger)i
+{
+    NSString *url = [NSString stringWithFormat:@"http://%@/entity?n=%lu", cLoopbackHost, (unsigned long) i];
+    return [NSURLRequest requestWithURL:[NSURL URLWithString:url]];
+}
+
+- (void)test_concurrentConnectionsBenchmark
+{
+    const NSUInteger count = 500;
+    JRConnectionManagerTestDelegate *delegate = [[JRConnectionManagerTestDelegate alloc] init];
+    delegate.expected = count;
+    delegate.testCase = self;
+    delegate.testSelector = _cmd;
+
+    [self prepare];
+    NSDate *start = [NSDate date];
+    for (NSUInteger i = 0; i < count; i++)
+        GHAssertTrue([JRConnectionManager createConnectionFromRequest:[self loopbackRequest:i] forDelegate:delegate
+                                                              withTag:@(i)], nil);
+    GHAssertEquals([JRConnectionManager openConnections], count, nil);
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:30.0];
+    NSTimeInterval elapsed = -[start timeIntervalSinceNow];
+
+    GHAssertEquals(delegate.finished, count, nil);
+    GHAssertEquals(delegate.failed, (NSUInteger) 0, nil);
+    GHAssertEquals(delegate.bytes, count * cLoopbackChunkCount * cLoopbackChunkSize, nil);
+    GHAssertEquals([JRConnectionManager openConnections], (NSUInteger) 0, nil);
+    GHTestLog(@"%lu concurrent loopback requests, %lu chunks: %.3fs (%.1f req/s)", (unsigned long) count,
+              (unsigned long) (count * cLoopbackChunkCount), elapsed, count / elapsed);
+}
+
+- (void)test_stopConnectionsForDelegate_stopsOnlyThatDelegate
+{
+    const NSUInteger count = 200;
+    JRConnectionManagerTestDelegate *stoppedDelegate = [[JRConnectionManagerTestDelegate alloc] init];
+    JRConnectionManagerTestDelegate *otherDelegate = [[JRConnectionManagerTestDelegate alloc] init];
+    otherDelegate.expected = count;
+    otherDelegate.testCase = self;
+    otherDelegate.testSelector = _cmd;
+
+    [self prepare];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [JRConnectionManager createConnectionFromRequest:[self loopbackRequest:i] forDelegate:stoppedDelegate
+                                                 withTag:@(i)];
+        [JRConnectionManager createConnectionFromRequest:[self loopbackRequest:i] forDelegate:otherDelegate
+                                                 withTag:@(i)];
+    }
+    GHAssertEquals([JRConnectionManager openConnections], 2 * count, nil);
+
+    [JRConnectionManager stopConnectionsForDelegate:stoppedDelegate];
+    GHAssertEquals(stoppedDelegate.stopped, count, nil);
+    GHAssertEquals([JRConnectionManager openConnections], count, nil);
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:30.0];
+    GHAssertEquals(stoppedDelegate.finished, (NSUInteger) 0, nil);
+    GHAssertEquals(otherDelegate.finished, count, nil);
+    GHAssertEquals([JRConnectionManager openConnections], (NSUInteger) 0, nil);
+}
+
+- (void)runLoopbackRequests:(NSUInteger)count overTransport:(id <JRConnectionTransport>)transport
+                      named:(NSString *)name selector:(SEL)selector
+{
+    [JRConnectionManager setTransport:transport];
+
+    JRConnectionManagerTestDelegate *delegate = [[JRConnectionManagerTestDelegate alloc] init];
+    delegate.expected = count;
+    delegate.testCase = self;
+    delegate.testSelector = selector;
+    delegate.startTimes = [NSMutableArray arrayWithCapacity:count];
+    delegate.latencies = [NSMutableArray arrayWithCapacity:count];
+
+    [self prepare];
+    NSDate *start = [NSDate date];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [delegate.startTimes addObject:[NSDate date]];
+        [JRConnectionManager createConnectionFromRequest:[self loopbackRequest:i] forDelegate:delegate withTag:@(i)];
+    }
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:30.0];
+    NSTimeInterval elapsed = -[start timeIntervalSinceNow];
+    GHAssertEquals(delegate.finished, count, nil);
+
+    NSArray *latencies = [delegate.latencies sortedArrayUsingSelector:@selector(compare:)];
+    double p50 = [[latencies objectAtIndex:count / 2] doubleValue];
+    double p99 = [[latencies objectAtIndex:(count * 99) / 100] doubleValue];
+    GHTestLog(@"%@: %lu requests in %.3fs, %.1f req/s, p50 %.1fms, p99 %.1fms", name, (unsigned long) count,
+              elapsed, count / elapsed, p50 * 1000, p99 * 1000);
+}
+
+- (void)test_transportBenchmark
+{
+    const NSUInteger count = 500;
+
+    [self runLoopbackRequests:count overTransport:[[JRURLConnectionTransport alloc] init]
+                        named:@"NSURLConnection per request" selector:_cmd];
+    [self runLoopbackRequests:count overTransport:[self loopbackSessionTransport]
+                        named:@"shared NSURLSession, 4 per host" selector:_cmd];
+
+    JRURLSessionTransport *wideTransport = [self loopbackSessionTransport];
+    [wideTransport setMaximumConnections:16 forHost:cLoopbackHost];
+    [self runLoopbackRequests:count overTransport:wideTransport
+                        named:@"shared NSURLSession, 16 per host" selector:_cmd];
+}
+
+- (void)test_replacedSessionTransportIsReleased
+{
+    __weak JRURLSessionTransport *replacedTransport;
+    @autoreleasepool
+    {
+        JRURLSessionTransport *sessionTransport = [self loopbackSessionTransport];
+        replacedTransport = sessionTransport;
+        [self runLoopbackRequests:1 overTransport:sessionTransport named:@"one request" selector:_cmd];
+        [JRConnectionManager setTransport:[self loopbackSessionTransport]];
+    }
+
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:5.0];
+    while (replacedTransport && [deadline timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+    GHAssertNil(replacedTransport, @"the replaced transport's sessions should have been invalidated");
+}
+
+- (void)test_oneShotWithoutATaskFailsThroughItsHandler
+{
+    JRInvalidatedSessionTransport *transport = [[JRInvalidatedSessionTransport alloc] init];
+    NSOperationQueue *queue = [[NSOperationQueue alloc] init];
+    __block NSError *error = nil;
+    __block NSOperationQueue *calledBackOn = nil;
+
+    [self prepare];
+    [transport sendAsynchronousRequest:[self loopbackRequest:0] queue:queue metrics:nil
+                     completionHandler:^(NSURLResponse *response, NSData *data, NSError *e)
+    {
+        error = e;
+        calledBackOn = [NSOperationQueue currentQueue];
+        [self notify:kGHUnitWaitStatusSuccess forSelector:@selector(test_oneShotWithoutATaskFailsThroughItsHandler)];
+    }];
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+
+    GHAssertEqualStrings([error domain], NSURLErrorDomain, nil);
+    GHAssertEquals(calledBackOn, queue, nil);
+}
+
+- (NSData *)largeEntityResponse
+{
+    NSMutableArray *plural = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 5000; i++)
+        [plural addObject:@{ @"id" : @(i), @"string1" : [NSString stringWithFormat:@"value %lu", (unsigned long) i],
+                             @"string2" : @"some longer text that makes the record a realistic size",
+                             @"created" : @"2012-01-01 00:00:00.000000 +0000" }];
+
+    NSDictionary *entity = @{ @"stat" : @"ok", @"result" : @{ @"uuid" : @"abc-123", @"pluralTestUnique" : plural } };
+    return [NSJSONSerialization dataWithJSONObject:entity options:(NSJSONWritingOptions) 0 error:nil];
+}
+
+- (void)test_largeEntityDecodesOffTheMainThread
+{
+    NSData *body = [self largeEntityResponse];
+    [JRLoopbackURLProtocol setBody:body forPath:@"/entity.large"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:
+            [NSURL URLWithString:[NSString stringWithFormat:@"http://%@/entity.large", cLoopbackHost]]];
+
+    // What the main thread used to pay for every response: the logging string and the parse
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    NSString *bodyString = [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding];
+    id parsedOnMain = [NSJSONSerialization JSONObjectWithData:body options:(NSJSONReadingOptions) 0 error:nil];
+    NSTimeInterval oldMainThreadTime = CFAbsoluteTimeGetCurrent() - start;
+    GHAssertNotNil(bodyString, nil);
+    GHAssertNotNil(parsedOnMain, nil);
+
+    __block NSTimeInterval newMainThreadTime = 0;
+    __block id decoded = nil;
+    __block BOOL decodedOnMainThread = YES;
+    __block BOOL calledBackOnMainThread = NO;
+
+    [self prepare];
+    [JRConnectionManager startURLConnectionWithRequest:request decoder:^id(id parsedResponse, NSError **error)
+    {
+        decodedOnMainThread = [NSThread isMainThread];
+        return [parsedResponse objectForKey:@"result"];
+    } callbackQueue:nil completionHandler:^(id result, NSError *e)
+    {
+        CFAbsoluteTime callbackStart = CFAbsoluteTimeGetCurrent();
+        calledBackOnMainThread = [NSThread isMainThread];
+        decoded = result;
+        newMainThreadTime = CFAbsoluteTimeGetCurrent() - callbackStart;
+        [self notify:kGHUnitWaitStatusSuccess forSelector:@selector(test_largeEntityDecodesOffTheMainThread)];
+    }];
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:30.0];
+
+    GHAssertFalse(decodedOnMainThread, nil);
+    GHAssertTrue(calledBackOnMainThread, nil);
+    GHAssertEqualObjects([decoded objectForKey:@"uuid"], @"abc-123", nil);
+    GHTestLog(@"%lu byte entity: %.2fms of main-thread decoding before, %.2fms in the main-thread callback now",
+              (unsigned long) [body length], oldMainThreadTime * 1000, newMainThreadTime * 1000);
+}
+
+- (void)test_completionHandlerRunsOnCallbackQueue
+{
+    NSOperationQueue *callbackQueue = [[NSOperationQueue alloc] init];
+    __block NSOperationQueue *calledBackOn = nil;
+
+    [self prepare];
+    [JRConnectionManager startURLConnectionWithRequest:[self loopbackRequest:0] decoder:nil
+                                         callbackQueue:callbackQueue completionHandler:^(id result, NSError *e)
+    {
+        calledBackOn = [NSOperationQueue currentQueue];
+        [self notify:kGHUnitWaitStatusSuccess forSelector:@selector(test_completionHandlerRunsOnCallbackQueue)];
+    }];
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:10.0];
+
+    GHAssertEquals(calledBackOn, callbackQueue, nil);
+}
+
+- (void)test_onlyRequestsPassedATraceAreRecordedInIt
+{
+    NSData *ok = [@"{\"stat\":\"ok\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    [JRLoopbackURLProtocol setBody:ok forPath:@"/traced"];
+    [JRLoopbackURLProtocol setBody:ok forPath:@"/untraced"];
+    [JRTrace setSink:[[JRChromeTraceFileSink alloc] initWithDirectory:NSTemporaryDirectory()]];
+    JRTrace *trace = [JRTrace beginTraceNamed:@"sign-in"];
+
+    __block NSUInteger finished = 0;
+    void (^handler)(id, NSError *) = ^(id result, NSError *e)
+    {
+        if (++finished == 2)
+            [self notify:kGHUnitWaitStatusSuccess forSelector:@selector(test_onlyRequestsPassedATraceAreRecordedInIt)];
+    };
+    JRResponseDecoder decoder = ^id(id parsedResponse, NSError **error)
+    {
+        return parsedResponse;
+    };
+
+    [self prepare];
+    NSString *baseUrl = [NSString stringWithFormat:@"http://%@", cLoopbackHost];
+    [JRConnectionManager jsonRequestToUrl:[baseUrl stringByAppendingString:@"/untraced"] params:@{}
+                                  decoder:decoder completionHandler:handler];
+    [JRConnectionManager jsonRequestToUrl:[baseUrl stringByAppendingString:@"/traced"] params:@{} trace:trace
+                                  decoder:decoder completionHandler:handler];
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:10.0];
+
+    // A request sent while the sign-in was traced, but not by the sign-in, e.g. a flow download, stays out of it
+    GHAssertEqualObjects([[trace spans] valueForKey:@"name"], (@[ @"/traced", @"/traced", @"/traced" ]), nil);
+    GHAssertEqualObjects([[trace spans] valueForKey:@"kind"],
+                         (@[ @(JRTraceSpanKindNetwork), @(JRTraceSpanKindParse), @(JRTraceSpanKindModelBuild) ]), nil);
+
+    [trace finishWithError:nil];
+    [JRTrace setSink:nil];
+    [JRLoopbackURLProtocol setBody:nil forPath:@"/traced"];
+    [JRLoopbackURLProtocol setBody:nil forPath:@"/untraced"];
+}
+
+- (void)test_loggingCostsNothingWhenOffAndIsBufferedWhenOn
+{
+    NSData *body = [[@"" stringByPaddingToLength:4096 withString:@"x" startingAtIndex:0]
+            dataUsingEncoding:NSUTF8StringEncoding];
+    const NSUInteger count = 100000;
+    __block NSUInteger written = 0;
+    JRLogSetSink(^(const JRLogEntry *entry)
+    {
+        if ([entry->message hasPrefix:@"benchmark"]) written++;
+    });
+
+    // Off: the request body isn't decoded, as createConnectionFromRequest: used to decode it for every request
+    JRLogSetLevel(JRLogCategoryNetwork, JRLogLevelOff);
+    logArgumentEvaluations = 0;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        JRLog(JRLogCategoryNetwork, JRLogLevelDebug, @"benchmark body: %@", JRCountedLogArgument(body));
+    NSTimeInterval off = (CFAbsoluteTimeGetCurrent() - start) / count;
+    GHAssertEquals(logArgumentEvaluations, (NSUInteger) 0, nil);
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        [[NSString alloc] initWithFormat:@"benchmark body: %@", JRCountedLogArgument(body)];
+    NSTimeInterval eager = (CFAbsoluteTimeGetCurrent() - start) / count;
+
+    JRLogSetLevel(JRLogCategoryNetwork, JRLogLevelDebug);
+    uint64_t dropped = JRLogDroppedCount();
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; i++)
+        JRLog(JRLogCategoryNetwork, JRLogLevelDebug, @"benchmark request %lu", (unsigned long) i);
+    NSTimeInterval on = (CFAbsoluteTimeGetCurrent() - start) / count;
+    JRLogFlush();
+    GHAssertEquals((uint64_t) written + JRLogDroppedCount() - dropped, (uint64_t) count, nil);
+
+    JRLogSetSink(NULL);
+    JRLogSetLevel(JRLogCategoryNetwork, JR_LOG_COMPILED_LEVEL);
+    GHTestLog(@"per log call: %.1fns off, %.0fns for the old always-evaluated body, %.0fns on (%lu of %lu written, "
+              "the rest dropped while the buffer was full)", off * 1e9, eager * 1e9, on * 1e9,
+              (unsigned long) written, (unsigned long) count);
+}
+
+- (void)test_errorsReachTheSinkBeforeTheLogCallReturns
+{
+    NSMutableArray *written = [NSMutableArray array];
+    JRLogSetSink(^(const JRLogEntry *entry)
+    {
+        if ([entry->message hasPrefix:@"ordered"]) [written addObject:entry->message];
+    });
+    JRLogSetLevel(JRLogCategoryNetwork, JRLogLevelDebug);
+
+    JRLog(JRLogCategoryNetwork, JRLogLevelDebug, @"ordered debug");
+    JRLog(JRLogCategoryNetwork, JRLogLevelInfo, @"ordered info");
+    JRLog(JRLogCategoryNetwork, JRLogLevelError, @"ordered error");
+
+    // No flush: the error was written before JRLog returned, after the buffered messages logged before it
+    GHAssertEqualObjects([written copy], (@[ @"ordered debug", @"ordered info", @"ordered error" ]), nil);
+
+    JRLogSetSink(NULL);
+    JRLogSetLevel(JRLogCategoryNetwork, JR_LOG_COMPILED_LEVEL);
+    JRLogFlush();
+}
+
+- (void)test_metricsAreRecordedPerRequestAndAggregatedPerEndpoint
+{
+    const NSUInteger fastCount = 20, slowCount = 5;
+    const NSTimeInterval delay = 0.25;
+    NSString *updateUrl = [NSString stringWithFormat:@"http://%@/entity.update", cLoopbackHost];
+    NSData *updateBody = [@"attributes=%7B%7D&type_name=user" dataUsingEncoding:NSUTF8StringEncoding];
+    [JRLoopbackURLProtocol setBody:[@"{\"stat\":\"ok\"}" dataUsingEncoding:NSUTF8StringEncoding]
+                           forPath:@"/entity.update"];
+    [JRLoopbackURLProtocol setDelay:delay forPath:@"/entity.update"];
+
+    JRConnectionMetrics *metrics = [[JRConnectionMetrics alloc] init];
+    JRConnectionMetricsRecorder *recorder = [[JRConnectionMetricsRecorder alloc] init];
+    recorder.recorded = [NSMutableArray array];
+    recorder.expected = fastCount + slowCount;
+    recorder.testCase = self;
+    recorder.testSelector = _cmd;
+    [JRConnectionManager addMetricsObserver:metrics];
+    [JRConnectionManager addMetricsObserver:recorder];
+
+    [self prepare];
+    JRConnectionManagerTestDelegate *delegate = [[JRConnectionManagerTestDelegate alloc] init];
+    for (NSUInteger i = 0; i < fastCount; i++)
+        [JRConnectionManager createConnectionFromRequest:[self loopbackRequest:i] forDelegate:delegate withTag:@(i)];
+    for (NSUInteger i = 0; i < slowCount; i++)
+    {
+        NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:updateUrl]];
+        [request setHTTPMethod:@"POST"];
+        [request setHTTPBody:updateBody];
+        [JRConnectionManager startURLConnectionWithRequest:request completionHandler:^(id result, NSError *e) {}];
+    }
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:30.0];
+
+    [JRConnectionManager removeMetricsObserver:recorder];
+    [JRConnectionManager removeMetricsObserver:metrics];
+    [JRLoopbackURLProtocol setDelay:0 forPath:@"/entity.update"];
+    [JRLoopbackURLProtocol setBody:nil forPath:@"/entity.update"];
+
+    for (JRRequestMetrics *requestMetrics in recorder.recorded)
+    {
+        GHAssertNil(requestMetrics.error, nil);
+        GHAssertEquals(requestMetrics.statusCode, (NSInteger) 200, nil);
+        GHAssertTrue(requestMetrics.firstByteTime >= requestMetrics.startTime, nil);
+        GHAssertTrue(requestMetrics.endTime >= requestMetrics.firstByteTime, nil);
+
+        if (requestMetrics.endpointClass == JREndpointClassEntityUpdate)
+        {
+            GHAssertTrue([requestMetrics timeToFirstByte] >= delay, nil);
+            GHAssertEquals(requestMetrics.requestBytes, [updateBody length], nil);
+        }
+        else
+        {
+            GHAssertEquals(requestMetrics.endpointClass, JREndpointClassEntity, nil);
+            GHAssertEquals(requestMetrics.responseBytes, cLoopbackChunkCount * cLoopbackChunkSize, nil);
+        }
+    }
+
+    NSDictionary *endpoints = [[NSJSONSerialization JSONObjectWithData:[metrics JSONData] options:0 error:nil]
+            objectForKey:@"endpoints"];
+    NSDictionary *entity = [endpoints objectForKey:@"entity"];
+    NSDictionary *update = [endpoints objectForKey:@"entity.update"];
+    GHAssertEquals([[entity objectForKey:@"count"] unsignedIntegerValue], fastCount, nil);
+    GHAssertEquals([[update objectForKey:@"count"] unsignedIntegerValue], slowCount, nil);
+    GHAssertEquals([[[update objectForKey:@"status_codes"] objectForKey:@"200"] unsignedIntegerValue], slowCount, nil);
+    GHAssertTrue([[[update objectForKey:@"latency_ms"] objectForKey:@"min"] doubleValue] >= delay * 1000, nil);
+    GHAssertTrue([[[update objectForKey:@"latency_ms"] objectForKey:@"p50"] doubleValue] >= delay * 1000, nil);
+    GHAssertTrue([[[entity objectForKey:@"latency_ms"] objectForKey:@"p50"] doubleValue] < delay * 1000, nil);
+
+    GHTestLog(@"%@", [[NSString alloc] initWithData:[metrics JSONData] encoding:NSUTF8StringEncoding]);
+}
+
+@end